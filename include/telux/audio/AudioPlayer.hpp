@@ -118,6 +118,21 @@ class IPlayListListener {
      */
     virtual void onPlaybackFinished() { }
 
+    /**
+     * Invoked when the file being played could not be read ahead fast enough and
+     * playback had to wait for the file system. It is invoked at most once per
+     * buffer played and only when the count has changed.
+     *
+     * @param[in] file File being played
+     *
+     * @param[in] underrunCount Total number of underruns seen for this file since
+     *            it started playing
+     *
+     * @note Eval: This is a new API and is being evaluated. It is subject
+     *             to change and could break backwards compatibility.
+     */
+    virtual void onBufferUnderrun(std::string file, uint32_t underrunCount) { }
+
     /**
      * Destructor of IPlayListListener.
      */
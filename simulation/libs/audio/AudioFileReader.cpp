@@ -0,0 +1,406 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <cstring>
+#include <algorithm>
+
+#include "common/Logger.hpp"
+
+#include "AudioFileReader.hpp"
+
+namespace telux {
+namespace audio {
+
+AudioFileReader::AudioFileReader(uint32_t numBuffers, uint32_t chunkSize)
+    : numBuffers_(numBuffers),
+      chunkSize_(chunkSize) {
+
+    long pageSize = sysconf(_SC_PAGESIZE);
+    pageSize_ = (pageSize > 0) ? static_cast<size_t>(pageSize) : 4096;
+}
+
+AudioFileReader::~AudioFileReader() {
+    close();
+}
+
+telux::common::ErrorCode AudioFileReader::open(const std::string &path) {
+
+    int fd;
+
+    close();
+
+    fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        LOG(ERROR, __FUNCTION__, " can't open file ", path, ", lnx err ",
+            static_cast<int>(errno));
+        return telux::common::ErrorCode::NO_SUCH_ELEMENT;
+    }
+
+    std::lock_guard<std::mutex> lock(readerMtx_);
+
+    path_ = path;
+    pos_ = 0;
+    isPrimed_ = false;
+    hasError_ = false;
+    underrunCount_ = 0;
+
+    if (mapFile(fd)) {
+        /* Mapping stays valid after the descriptor is closed */
+        ::close(fd);
+        isOpen_ = true;
+        return telux::common::ErrorCode::SUCCESS;
+    }
+
+    file_ = ::fdopen(fd, "rb");
+    if (!file_) {
+        LOG(ERROR, __FUNCTION__, " can't fdopen file ", path);
+        ::close(fd);
+        return telux::common::ErrorCode::SYSTEM_ERR;
+    }
+
+    readAheadEof_ = false;
+    stopReadAhead_ = false;
+    seekPending_ = false;
+    chunkOffset_ = 0;
+    readAheadThread_ = std::thread(&AudioFileReader::readAhead, this);
+
+    isOpen_ = true;
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+void AudioFileReader::close() {
+
+    {
+        std::lock_guard<std::mutex> lock(readerMtx_);
+        stopReadAhead_ = true;
+        readerCv_.notify_all();
+    }
+
+    if (readAheadThread_.joinable()) {
+        readAheadThread_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(readerMtx_);
+
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    unmapFile();
+
+    for (auto &chunk : readyChunks_) {
+        freeChunks_.push_back(std::move(chunk));
+    }
+    readyChunks_.clear();
+    chunkOffset_ = 0;
+    isOpen_ = false;
+}
+
+bool AudioFileReader::isOpen() {
+    std::lock_guard<std::mutex> lock(readerMtx_);
+    return isOpen_;
+}
+
+std::string AudioFileReader::getPath() {
+    std::lock_guard<std::mutex> lock(readerMtx_);
+    return path_;
+}
+
+bool AudioFileReader::mapFile(int fd) {
+
+    struct stat st{};
+    void *addr;
+
+    if ((fstat(fd, &st) < 0) || !S_ISREG(st.st_mode) || (st.st_size <= 0)) {
+        return false;
+    }
+
+    addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+        LOG(DEBUG, __FUNCTION__, " can't mmap, lnx err ", static_cast<int>(errno));
+        return false;
+    }
+
+    map_ = static_cast<uint8_t *>(addr);
+    mapSize_ = st.st_size;
+    madvise(map_, mapSize_, MADV_SEQUENTIAL);
+    primeWindow();
+
+    return true;
+}
+
+void AudioFileReader::unmapFile() {
+
+    if (map_) {
+        munmap(map_, mapSize_);
+        map_ = nullptr;
+        mapSize_ = 0;
+    }
+}
+
+/*
+ * Asks the kernel to bring in the chunks following the current position.
+ */
+void AudioFileReader::primeWindow() {
+
+    size_t start, length;
+
+    if (static_cast<size_t>(pos_) >= mapSize_) {
+        return;
+    }
+
+    start = (pos_ / pageSize_) * pageSize_;
+    length = std::min(static_cast<size_t>(numBuffers_) * chunkSize_ + (pos_ - start),
+        mapSize_ - start);
+    madvise(map_ + start, length, MADV_WILLNEED);
+}
+
+bool AudioFileReader::isResident(size_t offset, size_t length) {
+
+    size_t start = (offset / pageSize_) * pageSize_;
+    size_t span = (offset + length) - start;
+    size_t pages = (span + pageSize_ - 1) / pageSize_;
+
+    residency_.resize(pages);
+    if (mincore(map_ + start, span, residency_.data()) < 0) {
+        /* Can't tell, don't report an underrun */
+        return true;
+    }
+
+    for (auto page : residency_) {
+        if (!(page & 1)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Keeps numBuffers_ chunks read ahead for files that aren't memory mapped. Only
+ * this thread accesses file_ while it is running.
+ */
+void AudioFileReader::readAhead() {
+
+    size_t numBytesRead;
+    uint32_t generation;
+    bool readError;
+    std::vector<uint8_t> chunk;
+    std::unique_lock<std::mutex> lock(readerMtx_);
+
+    while (true) {
+        readerCv_.wait(lock, [this] {
+            return (stopReadAhead_ || seekPending_ ||
+                (!readAheadEof_ && (readyChunks_.size() < numBuffers_)));
+        });
+
+        if (stopReadAhead_) {
+            return;
+        }
+
+        if (seekPending_) {
+            seekPending_ = false;
+            if (std::fseek(file_, seekTarget_, SEEK_SET)) {
+                LOG(ERROR, __FUNCTION__, " can't fseek");
+                hasError_ = true;
+                readAheadEof_ = true;
+            }
+            readerCv_.notify_all();
+            continue;
+        }
+
+        if (!freeChunks_.empty()) {
+            chunk = std::move(freeChunks_.back());
+            freeChunks_.pop_back();
+        }
+        chunk.resize(chunkSize_);
+        generation = generation_;
+
+        lock.unlock();
+        numBytesRead = std::fread(chunk.data(), 1, chunkSize_, file_);
+        readError = std::ferror(file_);
+        lock.lock();
+
+        if (generation != generation_) {
+            /* Position changed meanwhile, data is stale */
+            freeChunks_.push_back(std::move(chunk));
+            continue;
+        }
+
+        if (numBytesRead) {
+            chunk.resize(numBytesRead);
+            readyChunks_.push_back(std::move(chunk));
+        } else {
+            freeChunks_.push_back(std::move(chunk));
+        }
+
+        if (numBytesRead < chunkSize_) {
+            if (readError) {
+                LOG(ERROR, __FUNCTION__, " can't read file ", path_);
+                hasError_ = true;
+            }
+            readAheadEof_ = true;
+        }
+
+        chunk = std::vector<uint8_t>();
+        readerCv_.notify_all();
+    }
+}
+
+uint32_t AudioFileReader::readMapped(uint8_t *dest, uint32_t size) {
+
+    size_t count;
+
+    if (static_cast<size_t>(pos_) >= mapSize_) {
+        return 0;
+    }
+
+    count = std::min(static_cast<size_t>(size), mapSize_ - pos_);
+
+    if (isPrimed_ && !isResident(pos_, count)) {
+        ++underrunCount_;
+    }
+
+    std::memcpy(dest, map_ + pos_, count);
+    pos_ += count;
+    isPrimed_ = true;
+    primeWindow();
+
+    return count;
+}
+
+uint32_t AudioFileReader::readChunks(uint8_t *dest, uint32_t size,
+    std::unique_lock<std::mutex> &lock) {
+
+    uint32_t count, copied = 0;
+
+    while (copied < size) {
+        if (readyChunks_.empty()) {
+            if (readAheadEof_ || stopReadAhead_) {
+                break;
+            }
+
+            if (isPrimed_) {
+                ++underrunCount_;
+            }
+
+            readerCv_.wait(lock, [this] {
+                return (!readyChunks_.empty() || readAheadEof_ || stopReadAhead_);
+            });
+            continue;
+        }
+
+        std::vector<uint8_t> &chunk = readyChunks_.front();
+        count = std::min(size - copied, static_cast<uint32_t>(chunk.size()) - chunkOffset_);
+        std::memcpy(dest + copied, chunk.data() + chunkOffset_, count);
+        chunkOffset_ += count;
+        copied += count;
+        pos_ += count;
+
+        if (chunkOffset_ == chunk.size()) {
+            /* Give the chunk back to the read-ahead thread */
+            freeChunks_.push_back(std::move(chunk));
+            readyChunks_.pop_front();
+            chunkOffset_ = 0;
+            readerCv_.notify_all();
+        }
+    }
+
+    if (copied) {
+        isPrimed_ = true;
+    }
+
+    return copied;
+}
+
+uint32_t AudioFileReader::read(uint8_t *dest, uint32_t size) {
+
+    std::unique_lock<std::mutex> lock(readerMtx_);
+
+    if (!isOpen_ || !dest) {
+        return 0;
+    }
+
+    if (map_) {
+        return readMapped(dest, size);
+    }
+
+    return readChunks(dest, size, lock);
+}
+
+telux::common::ErrorCode AudioFileReader::seekLocked(long offset) {
+
+    if (!isOpen_) {
+        return telux::common::ErrorCode::INVALID_STATE;
+    }
+
+    if (offset < 0) {
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+
+    isPrimed_ = false;
+
+    if (map_) {
+        pos_ = std::min(static_cast<size_t>(offset), mapSize_);
+        primeWindow();
+        return telux::common::ErrorCode::SUCCESS;
+    }
+
+    ++generation_;
+    for (auto &chunk : readyChunks_) {
+        freeChunks_.push_back(std::move(chunk));
+    }
+    readyChunks_.clear();
+    chunkOffset_ = 0;
+    seekTarget_ = offset;
+    seekPending_ = true;
+    readAheadEof_ = false;
+    pos_ = offset;
+    readerCv_.notify_all();
+
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode AudioFileReader::seek(long offset) {
+
+    std::lock_guard<std::mutex> lock(readerMtx_);
+    return seekLocked(offset);
+}
+
+telux::common::ErrorCode AudioFileReader::skip(long delta) {
+
+    std::lock_guard<std::mutex> lock(readerMtx_);
+    return seekLocked(pos_ + delta);
+}
+
+bool AudioFileReader::isEof() {
+
+    std::lock_guard<std::mutex> lock(readerMtx_);
+
+    if (map_) {
+        return (static_cast<size_t>(pos_) >= mapSize_);
+    }
+
+    return (readAheadEof_ && !seekPending_ && readyChunks_.empty());
+}
+
+bool AudioFileReader::hasError() {
+    std::lock_guard<std::mutex> lock(readerMtx_);
+    return hasError_;
+}
+
+uint32_t AudioFileReader::getUnderrunCount() {
+    std::lock_guard<std::mutex> lock(readerMtx_);
+    return underrunCount_;
+}
+
+}  // end of namespace audio
+}  // end of namespace telux
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#ifndef AUDIOFILEREADER_HPP
+#define AUDIOFILEREADER_HPP
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <condition_variable>
+
+#include <telux/common/CommonDefines.hpp>
+
+namespace telux {
+namespace audio {
+
+/*
+ * Reads an audio file for the AudioPlayerImpl keeping data ahead of the player's
+ * write loop so that the loop doesn't block on the file system.
+ *
+ * A regular (local) file is memory mapped; every read copies from the mapping and
+ * asks the kernel to fetch the next numBuffers chunks (madvise WILLNEED). Any other
+ * file (for example a FIFO) is read by a read-ahead thread which keeps numBuffers
+ * chunks filled.
+ *
+ * An underrun is counted when the player wants data that isn't read ahead yet, that
+ * is, a read has to wait for the read-ahead thread or touches pages of the mapping
+ * which are not in memory. Reads right after open() or seek() are not counted.
+ */
+class AudioFileReader {
+
+ public:
+    AudioFileReader(uint32_t numBuffers, uint32_t chunkSize);
+    ~AudioFileReader();
+
+    telux::common::ErrorCode open(const std::string &path);
+
+    void close();
+
+    bool isOpen();
+
+    std::string getPath();
+
+    /*
+     * Copies up to size bytes from the current position. Less than size bytes are
+     * returned only at the end of the file or if an error occurred (hasError()).
+     */
+    uint32_t read(uint8_t *dest, uint32_t size);
+
+    /*
+     * Moves current position to the given absolute offset.
+     */
+    telux::common::ErrorCode seek(long offset);
+
+    /*
+     * Moves current position by the given (possibly negative) number of bytes.
+     */
+    telux::common::ErrorCode skip(long delta);
+
+    bool isEof();
+
+    bool hasError();
+
+    uint32_t getUnderrunCount();
+
+ private:
+    uint32_t numBuffers_;
+    uint32_t chunkSize_;
+    std::mutex readerMtx_;
+    std::condition_variable readerCv_;
+    std::string path_;
+    bool isOpen_ = false;
+    bool hasError_ = false;
+    /* Position of the next byte returned by read() */
+    long pos_ = 0;
+    /* Set once data has been delivered after open/seek, underruns are counted then */
+    bool isPrimed_ = false;
+    uint32_t underrunCount_ = 0;
+
+    /* Memory mapped file */
+    uint8_t *map_ = nullptr;
+    size_t mapSize_ = 0;
+    size_t pageSize_ = 0;
+    std::vector<unsigned char> residency_;
+
+    /* Read-ahead thread for files that can't be mapped */
+    std::FILE *file_ = nullptr;
+    std::thread readAheadThread_;
+    std::deque<std::vector<uint8_t>> readyChunks_;
+    std::vector<std::vector<uint8_t>> freeChunks_;
+    uint32_t chunkOffset_ = 0;
+    bool readAheadEof_ = false;
+    bool stopReadAhead_ = false;
+    bool seekPending_ = false;
+    long seekTarget_ = 0;
+    /* Incremented on seek, data read for an older generation is dropped */
+    uint32_t generation_ = 0;
+
+    telux::common::ErrorCode seekLocked(long offset);
+    bool mapFile(int fd);
+    void unmapFile();
+    bool isResident(size_t offset, size_t length);
+    void primeWindow();
+    void readAhead();
+    uint32_t readMapped(uint8_t *dest, uint32_t size);
+    uint32_t readChunks(uint8_t *dest, uint32_t size, std::unique_lock<std::mutex> &lock);
+};
+
+}  // end of namespace audio
+}  // end of namespace telux
+
+#endif  // AUDIOFILEREADER_HPP
@@ -138,6 +138,10 @@ enum class PlayerState {
 AudioPlayerImpl::AudioPlayerImpl(std::shared_ptr<IAudioManager> audioManager) {
 
     audioManager_      = audioManager;
+    curReader_         = std::unique_ptr<AudioFileReader>(
+        new AudioFileReader(READ_AHEAD_BUFFERS, READ_AHEAD_CHUNK_SIZE));
+    nextReader_        = std::unique_ptr<AudioFileReader>(
+        new AudioFileReader(READ_AHEAD_BUFFERS, READ_AHEAD_CHUNK_SIZE));
     applyCachedVolume_ = false;
     applyCachedMute_   = false;
     cachedDevices_.resize(0);
@@ -230,7 +234,7 @@ void AudioPlayerImpl::resetState() {
     contentOffset_         = 0;
     curFileName_           = "";
     bufferPool_            = {};
-    curFile_               = nullptr;
+    reportedUnderruns_     = 0;
     isFileOpened_          = false;
     hasSsrOccurred_        = false;
     isStreamOpened_        = false;
@@ -380,7 +384,7 @@ void AudioPlayerImpl::executePlayback() {
                 break;
 
             case PlayerState::INIT_FILE:
-                ec = initFileToPlay();
+                ec = initFileToPlay(curFileIdx);
                 if (ec != telux::common::ErrorCode::SUCCESS) {
                     errToReport_ = ec;
                     nextState    = PlayerState::REPORT_ERROR;
@@ -407,7 +411,7 @@ void AudioPlayerImpl::executePlayback() {
                     break;
                 }
 
-                if (std::feof(curFile_)) {
+                if (curReader_->isEof()) {
                     nextState = PlayerState::FILE_PLAY_END;
                 }
                 break;
@@ -461,6 +465,7 @@ void AudioPlayerImpl::executePlayback() {
                  */
                 deinitAudioStream();
                 deregisterForSSREvent();
+                nextReader_->close();
                 bufferPool_           = {};
                 isPlayInProgress_     = false;
                 hasUserRequestedStop_ = false;
@@ -531,6 +536,7 @@ void AudioPlayerImpl::terminatePlayback() {
         }
 
         deinitFileToPlay();
+        nextReader_->close();
 
         bufferPool_           = {};
         isPlayInProgress_     = false;
@@ -543,16 +549,12 @@ void AudioPlayerImpl::terminatePlayback() {
  * pointer at the 1st audio sample.
  */
 telux::common::ErrorCode AudioPlayerImpl::adjustFileAndState() {
-    int ret = 0;
-
-    std::rewind(curFile_);
+    telux::common::ErrorCode ec;
 
-    if (isCompressed_) {
-        ret = std::fseek(curFile_, contentOffset_, SEEK_CUR);
-        if (ret) {
-            LOG(ERROR, __FUNCTION__, " can't fseek");
-            return telux::common::ErrorCode::SYSTEM_ERR;
-        }
+    ec = curReader_->seek(isCompressed_ ? contentOffset_ : 0);
+    if (ec != telux::common::ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " can't seek");
+        return telux::common::ErrorCode::SYSTEM_ERR;
     }
 
     return telux::common::ErrorCode::SUCCESS;
@@ -903,48 +905,80 @@ telux::common::ErrorCode AudioPlayerImpl::prepareBuffers() {
 }
 
 /*
- * Opens a file for playback from the user specified path.
+ * Opens a file for playback from the user specified path. If this file was already
+ * opened in advance, it is used as is and its data is already read ahead.
  */
-telux::common::ErrorCode AudioPlayerImpl::initFileToPlay() {
+telux::common::ErrorCode AudioPlayerImpl::initFileToPlay(uint32_t curFileIdx) {
+
+    telux::common::ErrorCode ec;
 
     if (curFileName_.empty()) {
         LOG(ERROR, __FUNCTION__, " missing file name");
         return telux::common::ErrorCode::MISSING_RESOURCE;
     }
 
-    curFile_ = std::fopen(curFileName_.c_str(), "rb");
-    if (!curFile_) {
-        LOG(ERROR, __FUNCTION__, " can't open file ", curFileName_, ", lnx err ",
-            static_cast<int>(errno));
-        return telux::common::ErrorCode::NO_SUCH_ELEMENT;
+    if (nextReader_->isOpen() && (nextReader_->getPath() == curFileName_)) {
+        std::swap(curReader_, nextReader_);
+    } else {
+        nextReader_->close();
+        ec = curReader_->open(curFileName_);
+        if (ec != telux::common::ErrorCode::SUCCESS) {
+            return ec;
+        }
     }
 
+    reportedUnderruns_ = 0;
     isFileOpened_ = true;
+
+    preopenNextFile(curFileIdx);
     return telux::common::ErrorCode::SUCCESS;
 }
 
+/*
+ * Opens the file that will be played after the given one, so that moving to it
+ * doesn't wait for the file system. Failure is not fatal here, it is reported
+ * when the file is actually played.
+ */
+void AudioPlayerImpl::preopenNextFile(uint32_t curFileIdx) {
+
+    PlaybackConfig cfg{};
+
+    if (playbackConfigs_[curFileIdx].repeatInfo.type == RepeatType::INDEFINITELY) {
+        /* Current file never ends */
+        return;
+    }
+
+    for (uint32_t x = curFileIdx + 1; x < playbackConfigs_.size(); x++) {
+        cfg = playbackConfigs_[x];
+        if ((cfg.repeatInfo.type == RepeatType::SKIP) ||
+            ((cfg.repeatInfo.type == RepeatType::COUNT) && (cfg.repeatInfo.count == 0))) {
+            continue;
+        }
+
+        if (nextReader_->open(cfg.absoluteFilePath) != telux::common::ErrorCode::SUCCESS) {
+            LOG(DEBUG, __FUNCTION__, " can't preopen ", cfg.absoluteFilePath);
+        }
+        return;
+    }
+}
+
 /*
  * Closes the file.
  */
 telux::common::ErrorCode AudioPlayerImpl::deinitFileToPlay() {
-    int ret;
 
     /*
      * 1. File closed when in DEINIT_FILE state.
      * 2. Explicit stop playback request received, termination sequence started.
      * 3. This method is called again.
-     * Since curFile_ becomes invalid after step 1, prevent access to it.
+     * Since curReader_ becomes invalid after step 1, prevent access to it.
      */
-    if (!isFileOpened_ || !curFile_) {
+    if (!isFileOpened_ || !curReader_->isOpen()) {
         LOG(ERROR, __FUNCTION__, " no opened file");
         return telux::common::ErrorCode::INVALID_STATE;
     }
 
-    ret = std::fclose(curFile_);
-    if (ret) {
-        LOG(ERROR, __FUNCTION__, " can't close file");
-        return telux::common::ErrorCode::SYSTEM_ERR;
-    }
+    curReader_->close();
 
     isFileOpened_ = false;
     return telux::common::ErrorCode::SUCCESS;
@@ -1015,19 +1049,20 @@ telux::common::ErrorCode AudioPlayerImpl::playAudioSamples() {
         streamBuffer = bufferPool_.front();
         bufferPool_.pop();
 
-        numBytesRead = std::fread(streamBuffer->getRawBuffer(), 1, bufferSize_, curFile_);
+        /* Data is normally read ahead already, this doesn't wait for the file system */
+        numBytesRead = curReader_->read(streamBuffer->getRawBuffer(), bufferSize_);
 
 #ifdef AUDIOPLAYERIMPL_DDBG
         LOG(DEBUG, __FUNCTION__, " bytes read from file ", numBytesRead);
 #endif
 
-        if ((numBytesRead == 0) && std::feof(curFile_)) {
+        if ((numBytesRead == 0) && curReader_->isEof() && !curReader_->hasError()) {
             /* Complete file has been played */
             bufferPool_.push(streamBuffer);
             return telux::common::ErrorCode::SUCCESS;
         }
 
-        if ((numBytesRead != bufferSize_) && !std::feof(curFile_)) {
+        if ((numBytesRead != bufferSize_) && (!curReader_->isEof() || curReader_->hasError())) {
             /* Can't read requested number of bytes from the file system */
             bufferPool_.push(streamBuffer);
             LOG(ERROR, __FUNCTION__, " can't read file, numBytesRead ", numBytesRead);
@@ -1049,6 +1084,7 @@ telux::common::ErrorCode AudioPlayerImpl::playAudioSamples() {
         }
     }
 
+    reportUnderrun();
     return telux::common::ErrorCode::SUCCESS;
 }
 
@@ -1072,7 +1108,7 @@ void AudioPlayerImpl::writeComplete(std::shared_ptr<telux::audio::IStreamBuffer>
          * (rewindLength) we need to play again and rewind to it.
          */
         rewindLength = (-1) * (static_cast<long>((buffer->getDataSize() - bytesWritten)));
-        std::fseek(curFile_, rewindLength, SEEK_CUR);
+        curReader_->skip(rewindLength);
     } else {
         /* Success, send next buffer to play */
     }
@@ -1190,6 +1226,27 @@ void AudioPlayerImpl::reportPlaybackStarted() {
     }
 }
 
+/*
+ *  Updates client when the file could not be read ahead fast enough since the
+ *  last update. Called from the playback thread only.
+ */
+void AudioPlayerImpl::reportUnderrun() {
+
+    uint32_t underrunCount = curReader_->getUnderrunCount();
+
+    if (underrunCount == reportedUnderruns_) {
+        return;
+    }
+
+    LOG(DEBUG, __FUNCTION__, " file ", curFileName_, ", underruns ", underrunCount);
+    reportedUnderruns_ = underrunCount;
+
+    auto playListListener = statusListener_.lock();
+    if (playListListener) {
+        playListListener->onBufferUnderrun(curFileName_, underrunCount);
+    }
+}
+
 /*
  *  Updates client that the playback is terminated.
  */
@@ -9,8 +9,10 @@
 #include <queue>
 #include <cstdio>
 #include <mutex>
+#include <memory>
 
 #include "common/AsyncTaskQueue.hpp"
+#include "AudioFileReader.hpp"
 
 #include <telux/audio/AudioPlayer.hpp>
 #include <telux/audio/AudioListener.hpp>
@@ -138,6 +140,12 @@ class AudioPlayerImpl : public IAudioPlayer,
     /* Number of buffers used for playback */
     const size_t BUFFER_POOL_SIZE = 2;
 
+    /* Number of chunks of the file read ahead of the buffer being played */
+    const uint32_t READ_AHEAD_BUFFERS = 4;
+
+    /* Size in bytes of a chunk read ahead */
+    const uint32_t READ_AHEAD_CHUNK_SIZE = 8192;
+
     /* Time in seconds for which player thread waits for the response from audio server */
     const int32_t TIME_10_SECONDS = 10;
 
@@ -157,13 +165,16 @@ class AudioPlayerImpl : public IAudioPlayer,
     bool applyCachedMute_       = false;
     bool isStreamMuted_         = false;
     uint32_t bufferSize_        = 0;
+    uint32_t reportedUnderruns_ = 0;
     long contentOffset_         = 0;
     ChannelTypeMask curChannelTypeMask_;
 
     float cachedVolumeLevel_;
     std::vector<DeviceType> cachedDevices_;
     std::vector<DeviceType> lastUsedDevices_;
-    std::FILE *curFile_;
+    std::unique_ptr<AudioFileReader> curReader_;
+    /* Next file in the playlist, opened in advance for a gapless transition */
+    std::unique_ptr<AudioFileReader> nextReader_;
     std::string curFileName_;
     telux::common::Status status_;
     std::mutex writeMtx_;
@@ -185,7 +196,7 @@ class AudioPlayerImpl : public IAudioPlayer,
     telux::common::ErrorCode initAudioStream(StreamConfig streamConfig);
     telux::common::ErrorCode reinitAudioStream(uint32_t curFileIdx);
     telux::common::ErrorCode deinitAudioStream();
-    telux::common::ErrorCode initFileToPlay();
+    telux::common::ErrorCode initFileToPlay(uint32_t curFileIdx);
     telux::common::ErrorCode deinitFileToPlay();
     telux::common::ErrorCode prepareBuffers();
     telux::common::ErrorCode playAudioSamples();
@@ -210,6 +221,8 @@ class AudioPlayerImpl : public IAudioPlayer,
     void reportPlaybackFinished();
     void reportPlaybackStarted();
     void reportPlaybackStopped();
+    void reportUnderrun();
+    void preopenNextFile(uint32_t curFileIdx);
     void unblockPlayerThread(bool setSSRStatus);
 };
 
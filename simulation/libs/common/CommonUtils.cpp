@@ -7,6 +7,7 @@
 #include <ctime>
 #include <chrono>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 #include <sys/sysinfo.h>
 #include <jsoncpp/json/json.h>
@@ -417,6 +418,21 @@ std::string CommonUtils::getGrpcPort() {
     return ("localhost:" + config->getValue("RPC_PORT"));
 }
 
+std::shared_ptr<grpc::Channel> CommonUtils::getGrpcChannel() {
+    static std::mutex channelMutex;
+    static std::shared_ptr<grpc::Channel> channel;
+    std::lock_guard<std::mutex> lock(channelMutex);
+    if (!channel) {
+        auto config = std::make_shared<SimulationConfigParser>();
+        std::string udsPath = config->getValue("RPC_UDS_PATH");
+        std::string address = udsPath.empty() ?
+            ("localhost:" + config->getValue("RPC_PORT")) : ("unix:" + udsPath);
+        LOG(INFO, __FUNCTION__, " Connecting to ", address);
+        channel = grpc::CreateChannel(address, grpc::InsecureChannelCredentials());
+    }
+    return channel;
+}
+
 std::vector<std::string> CommonUtils::splitString(std::string msg) {
     std::stringstream ss(msg);
     std::vector<std::string> message;
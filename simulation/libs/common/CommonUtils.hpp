@@ -8,6 +8,7 @@
 
 #include <telux/common/CommonDefines.hpp>
 #include <grpcpp/grpcpp.h>
+#include <memory>
 #include <vector>
 
 #include "JsonParser.hpp"
@@ -101,6 +102,13 @@ class CommonUtils {
     static std::vector<int> convertStringToVector(std::string input);
     static std::string getGrpcPort();
 
+    /**
+     * Gets the channel to the simulation server, created on first use and shared by all the
+     * stubs of the process. The server is reached over the Unix domain socket RPC_UDS_PATH when
+     * it is configured and over RPC_PORT otherwise.
+     */
+    static std::shared_ptr<grpc::Channel> getGrpcChannel();
+
     /**
      * Print the SDK version in the predefined format to SDK log
      */
@@ -108,8 +116,7 @@ class CommonUtils {
 
     template<typename T>
     static std::unique_ptr<typename T::Stub> getGrpcStub() {
-        return T::NewStub(grpc::CreateChannel(CommonUtils::getGrpcPort(),
-            grpc::InsecureChannelCredentials()));
+        return T::NewStub(CommonUtils::getGrpcChannel());
     }
 
     template<typename T>
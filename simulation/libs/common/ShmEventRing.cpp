@@ -0,0 +1,214 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "ShmEventRing.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "Logger.hpp"
+#include "SimulationConfigParser.hpp"
+
+#define SHM_RING_NAME_PREFIX "/telsdk_sim_events_"
+#define MIN_RING_CAPACITY 4096
+
+namespace telux {
+namespace common {
+
+std::string ShmEventRing::getNextName(int clientId) {
+    static std::atomic<uint32_t> nextInstance(0);
+    return SHM_RING_NAME_PREFIX + std::to_string(clientId) + "_"
+        + std::to_string(nextInstance++);
+}
+
+bool ShmEventRing::isNameOf(const std::string &name, int clientId) {
+    std::string prefix = SHM_RING_NAME_PREFIX + std::to_string(clientId) + "_";
+    if ((name.size() <= prefix.size()) || (name.compare(0, prefix.size(), prefix) != 0)) {
+        return false;
+    }
+    return std::all_of(name.begin() + prefix.size(), name.end(), [](char c) {
+        return (c >= '0') && (c <= '9');
+    });
+}
+
+uint32_t ShmEventRing::getConfiguredCapacity() {
+    SimulationConfigParser config;
+    std::string value = config.getValue("EVENT_SHM_RING_SIZE");
+    if (value.empty()) {
+        return 0;
+    }
+    unsigned long capacity = 0;
+    try {
+        capacity = std::stoul(value);
+    } catch (const std::exception &e) {
+        LOG(ERROR, __FUNCTION__, " Invalid EVENT_SHM_RING_SIZE ", value);
+        return 0;
+    }
+    if ((capacity != 0) && (capacity < MIN_RING_CAPACITY)) {
+        capacity = MIN_RING_CAPACITY;
+    }
+    return static_cast<uint32_t>(capacity);
+}
+
+std::unique_ptr<ShmEventRing> ShmEventRing::create(const std::string &name, uint32_t capacity) {
+    if (!std::atomic<uint64_t>().is_lock_free()) {
+        LOG(ERROR, __FUNCTION__, " Lock free atomics are not supported");
+        return nullptr;
+    }
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        LOG(ERROR, __FUNCTION__, " shm_open ", name, " failed: ", strerror(errno));
+        return nullptr;
+    }
+    size_t size = sizeof(Header) + capacity;
+    void *addr = MAP_FAILED;
+    if (ftruncate(fd, size) == 0) {
+        addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (addr == MAP_FAILED) {
+        LOG(ERROR, __FUNCTION__, " Mapping ", name, " failed: ", strerror(errno));
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    Header *header = new (addr) Header;
+    header->capacity = capacity;
+    header->head.store(0);
+    header->tail.store(0);
+    if (sem_init(&header->records, 1, 0) != 0) {
+        LOG(ERROR, __FUNCTION__, " sem_init failed: ", strerror(errno));
+        munmap(addr, size);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    // Published last, a ring without it is rejected by open()
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = MAGIC;
+    LOG(DEBUG, __FUNCTION__, " Created ", name, ", capacity: ", capacity);
+    return std::unique_ptr<ShmEventRing>(new ShmEventRing(name, addr, size, true));
+}
+
+std::unique_ptr<ShmEventRing> ShmEventRing::open(const std::string &name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        LOG(ERROR, __FUNCTION__, " shm_open ", name, " failed: ", strerror(errno));
+        return nullptr;
+    }
+    struct stat st;
+    void *addr = MAP_FAILED;
+    if ((fstat(fd, &st) == 0) && (static_cast<size_t>(st.st_size) > sizeof(Header))) {
+        addr = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (addr == MAP_FAILED) {
+        LOG(ERROR, __FUNCTION__, " Mapping ", name, " failed");
+        return nullptr;
+    }
+    size_t size = st.st_size;
+    Header *header = static_cast<Header *>(addr);
+    if ((header->magic != MAGIC) || (sizeof(Header) + header->capacity != size)) {
+        LOG(ERROR, __FUNCTION__, " Invalid ring ", name);
+        munmap(addr, size);
+        return nullptr;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return std::unique_ptr<ShmEventRing>(new ShmEventRing(name, addr, size, false));
+}
+
+ShmEventRing::ShmEventRing(const std::string &name, void *addr, size_t size, bool isOwner)
+   : name_(name)
+   , addr_(addr)
+   , size_(size)
+   , isOwner_(isOwner)
+   , header_(static_cast<Header *>(addr))
+   , data_(static_cast<uint8_t *>(addr) + sizeof(Header)) {
+}
+
+ShmEventRing::~ShmEventRing() {
+    if (isOwner_) {
+        sem_destroy(&header_->records);
+        shm_unlink(name_.c_str());
+    }
+    munmap(addr_, size_);
+}
+
+const std::string &ShmEventRing::getName() const {
+    return name_;
+}
+
+void ShmEventRing::write(uint64_t offset, const void *src, uint32_t len) {
+    uint32_t start = offset % header_->capacity;
+    uint32_t first = std::min(len, header_->capacity - start);
+    memcpy(data_ + start, src, first);
+    memcpy(data_, static_cast<const uint8_t *>(src) + first, len - first);
+}
+
+void ShmEventRing::read(uint64_t offset, void *dst, uint32_t len) {
+    uint32_t start = offset % header_->capacity;
+    uint32_t first = std::min(len, header_->capacity - start);
+    memcpy(dst, data_ + start, first);
+    memcpy(static_cast<uint8_t *>(dst) + first, data_, len - first);
+}
+
+bool ShmEventRing::push(const std::string &record) {
+    uint64_t head = header_->head.load(std::memory_order_relaxed);
+    uint64_t tail = header_->tail.load(std::memory_order_acquire);
+    uint64_t needed = LENGTH_SIZE + static_cast<uint64_t>(record.size());
+    if (needed > header_->capacity - (head - tail)) {
+        return false;
+    }
+    uint32_t len = static_cast<uint32_t>(record.size());
+    write(head, &len, LENGTH_SIZE);
+    write(head + LENGTH_SIZE, record.data(), len);
+    header_->head.store(head + needed, std::memory_order_release);
+    sem_post(&header_->records);
+    return true;
+}
+
+bool ShmEventRing::pop(std::string &record, int timeoutMs) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeoutMs / 1000;
+    deadline.tv_nsec += (timeoutMs % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    int ret;
+    while (((ret = sem_timedwait(&header_->records, &deadline)) != 0) && (errno == EINTR)) {
+    }
+    if (ret != 0) {
+        return false;
+    }
+    uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+    uint64_t head = header_->head.load(std::memory_order_acquire);
+    uint32_t len = 0;
+    if (head - tail >= LENGTH_SIZE) {
+        read(tail, &len, LENGTH_SIZE);
+    }
+    if ((head - tail < LENGTH_SIZE) || (head - tail - LENGTH_SIZE < len)) {
+        LOG(ERROR, __FUNCTION__, " Corrupted ring ", name_);
+        header_->tail.store(head, std::memory_order_release);
+        return false;
+    }
+    record.resize(len);
+    read(tail + LENGTH_SIZE, &record[0], len);
+    header_->tail.store(tail + LENGTH_SIZE + len, std::memory_order_release);
+    return true;
+}
+
+}  // end of namespace common
+}  // end of namespace telux
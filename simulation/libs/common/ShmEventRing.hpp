@@ -0,0 +1,112 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @brief      ShmEventRing is a single producer, single consumer ring of serialized events
+ *             in POSIX shared memory. A client creates the ring and passes its name when
+ *             registering for events, the simulation server on the same host then writes the
+ *             events to the ring instead of the gRPC stream.
+ */
+
+#ifndef SHMEVENTRING_HPP
+#define SHMEVENTRING_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <semaphore.h>
+
+namespace telux {
+namespace common {
+
+class ShmEventRing {
+ public:
+    /**
+     * Gets a new ring name for a client. Every event listener of a process has its own ring,
+     * so the names are made unique with a per-process counter.
+     */
+    static std::string getNextName(int clientId);
+
+    /**
+     * Checks that a ring name was given by getNextName() to the client.
+     */
+    static bool isNameOf(const std::string &name, int clientId);
+
+    /**
+     * Gets the ring capacity configured with EVENT_SHM_RING_SIZE, 0 when the ring is disabled.
+     */
+    static uint32_t getConfiguredCapacity();
+
+    /**
+     * Creates the ring, replacing a stale one with the same name. The ring is removed when the
+     * returned instance is destroyed.
+     *
+     * @returns the ring, or nullptr on failure
+     */
+    static std::unique_ptr<ShmEventRing> create(const std::string &name, uint32_t capacity);
+
+    /**
+     * Opens a ring created by another process.
+     *
+     * @returns the ring, or nullptr if it doesn't exist or isn't valid
+     */
+    static std::unique_ptr<ShmEventRing> open(const std::string &name);
+
+    /**
+     * Appends a record and wakes up the consumer, only to be called by the producer.
+     *
+     * @returns false if there isn't enough free space for the record
+     */
+    bool push(const std::string &record);
+
+    /**
+     * Removes the oldest record, only to be called by the consumer.
+     *
+     * @param [out] record       Record removed
+     * @param [in]  timeoutMs    Time to wait for a record when the ring is empty
+     *
+     * @returns false if no record was available in time
+     */
+    bool pop(std::string &record, int timeoutMs);
+
+    const std::string &getName() const;
+
+    ~ShmEventRing();
+
+ private:
+    struct Header {
+        uint32_t magic;
+        uint32_t capacity;
+        /* Total number of bytes written and read, the offsets are taken modulo capacity */
+        std::atomic<uint64_t> head;
+        std::atomic<uint64_t> tail;
+        /* Posted once per record */
+        sem_t records;
+    };
+
+    static const uint32_t MAGIC = 0x54455652;
+    static const uint32_t LENGTH_SIZE = sizeof(uint32_t);
+
+    ShmEventRing(const std::string &name, void *addr, size_t size, bool isOwner);
+    ShmEventRing(const ShmEventRing &) = delete;
+    ShmEventRing &operator=(const ShmEventRing &) = delete;
+
+    void write(uint64_t offset, const void *src, uint32_t len);
+    void read(uint64_t offset, void *dst, uint32_t len);
+
+    std::string name_;
+    void *addr_;
+    size_t size_;
+    bool isOwner_;
+    Header *header_;
+    uint8_t *data_;
+};
+
+}  // end of namespace common
+}  // end of namespace telux
+
+#endif  // SHMEVENTRING_HPP
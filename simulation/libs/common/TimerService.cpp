@@ -0,0 +1,478 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+#include "Logger.hpp"
+#include "TimerService.hpp"
+
+#define NS_PER_MS 1000000ULL
+#define NS_PER_SEC 1000000000ULL
+
+namespace telux {
+namespace common {
+
+const TimerService::TimerId TimerService::INVALID_TIMER_ID;
+const int TimerService::WORKER_IDLE_TIMEOUT_MS;
+
+std::shared_ptr<TimerService> TimerService::getInstance() {
+    static std::shared_ptr<TimerService> instance(new TimerService());
+    return instance;
+}
+
+TimerService::TimerService() {
+    clock_gettime(CLOCK_MONOTONIC, &startTime_);
+
+    timerFd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timerFd_ < 0) {
+        LOG(ERROR, __FUNCTION__, " can't create timerfd, lnx err ", static_cast<int>(errno));
+    }
+
+    wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFd_ < 0) {
+        LOG(ERROR, __FUNCTION__, " can't create eventfd, lnx err ", static_cast<int>(errno));
+    }
+
+    timerThread_ = std::thread(&TimerService::runTimerLoop, this);
+}
+
+TimerService::~TimerService() {
+    uint64_t value = 1;
+
+    {
+        std::lock_guard<std::mutex> lock(wheelMtx_);
+        isShutdown_ = true;
+    }
+
+    if ((wakeFd_ < 0) || (write(wakeFd_, &value, sizeof(value)) < 0)) {
+        LOG(ERROR, __FUNCTION__, " can't wake timer thread");
+    }
+
+    if (timerThread_.joinable()) {
+        timerThread_.join();
+    }
+
+    /* Tasks not due yet are dropped, their futures are released so nobody waits */
+    {
+        std::lock_guard<std::mutex> lock(wheelMtx_);
+        for (auto &slot : rootSlots_) {
+            for (auto &entry : slot) {
+                if (!entry->isCancelled) {
+                    entry->done.set_value();
+                }
+            }
+        }
+        for (auto &level : upperSlots_) {
+            for (auto &slot : level) {
+                for (auto &entry : slot) {
+                    if (!entry->isCancelled) {
+                        entry->done.set_value();
+                    }
+                }
+            }
+        }
+        pendingTimers_.clear();
+    }
+
+    /* Workers finish the tasks already due before exiting */
+    {
+        std::unique_lock<std::mutex> lock(poolMtx_);
+        isPoolShutdown_ = true;
+        poolCv_.notify_all();
+        poolCv_.wait(lock, [this] { return (numWorkers_ == 0); });
+    }
+
+    if (timerFd_ >= 0) {
+        close(timerFd_);
+    }
+    if (wakeFd_ >= 0) {
+        close(wakeFd_);
+    }
+}
+
+uint64_t TimerService::getElapsedNs() {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - startTime_.tv_sec) * NS_PER_SEC + now.tv_nsec - startTime_.tv_nsec;
+}
+
+std::shared_future<void> TimerService::runAfter(int delayMs, std::function<void()> task,
+    TimerId *id) {
+
+    uint64_t nowNs, value = 1;
+    auto entry = std::make_shared<TimerEntry>();
+    std::shared_future<void> future = entry->done.get_future().share();
+
+    entry->id = INVALID_TIMER_ID;
+    entry->task = std::move(task);
+    entry->isCancelled = false;
+
+    if (delayMs < 0) {
+        delayMs = 0;
+    }
+
+    /* Round up so that the task never runs before the delay has elapsed */
+    nowNs = getElapsedNs();
+    entry->expiry = (nowNs + delayMs * NS_PER_MS + NS_PER_MS - 1) / NS_PER_MS;
+
+    std::lock_guard<std::mutex> lock(wheelMtx_);
+
+    if (id) {
+        *id = INVALID_TIMER_ID;
+    }
+
+    if (isShutdown_) {
+        LOG(ERROR, __FUNCTION__, " timer service is shut down");
+        entry->done.set_value();
+        return future;
+    }
+
+    if (id) {
+        entry->id = ++lastId_;
+        pendingTimers_[entry->id] = entry;
+        *id = entry->id;
+    }
+
+    if (!numPending_) {
+        /* Nothing pending, the wheel can jump to the current time */
+        nextTick_ = nowNs / NS_PER_MS;
+    }
+
+    addToWheel(entry);
+    ++numPending_;
+
+    if (!isArmed_ || (entry->expiry < armedTick_)) {
+        /* Timer thread has to re-arm for this earlier expiry */
+        isArmed_ = true;
+        armedTick_ = entry->expiry;
+        if ((wakeFd_ >= 0) && (write(wakeFd_, &value, sizeof(value)) < 0)) {
+            LOG(ERROR, __FUNCTION__, " can't wake timer thread");
+        }
+    }
+
+    return future;
+}
+
+bool TimerService::cancel(TimerId id) {
+    std::lock_guard<std::mutex> lock(wheelMtx_);
+
+    auto it = pendingTimers_.find(id);
+    if (it == pendingTimers_.end()) {
+        return false;
+    }
+
+    /* Entry stays in its slot and is discarded when the slot is processed */
+    it->second->isCancelled = true;
+    it->second->task = nullptr;
+    it->second->done.set_value();
+    pendingTimers_.erase(it);
+
+    return true;
+}
+
+/*
+ * Places the entry in the first level if it expires within ROOT_SLOTS ticks,
+ * otherwise in the slot of the level whose range covers its expiry. Entries in the
+ * upper levels are moved down (cascaded) as the wheel turns.
+ */
+void TimerService::addToWheel(std::shared_ptr<TimerEntry> entry) {
+    uint64_t delta;
+    uint32_t level, shift;
+
+    if (entry->expiry < nextTick_) {
+        entry->expiry = nextTick_;
+    }
+
+    delta = entry->expiry - nextTick_;
+    if (delta > MAX_DELAY_TICKS) {
+        entry->expiry = nextTick_ + MAX_DELAY_TICKS;
+        delta = MAX_DELAY_TICKS;
+    }
+
+    if (delta < ROOT_SLOTS) {
+        rootSlots_[entry->expiry & (ROOT_SLOTS - 1)].push_back(entry);
+        return;
+    }
+
+    for (level = 0; level < NUM_UPPER_LEVELS; ++level) {
+        shift = ROOT_BITS + level * LEVEL_BITS;
+        if ((delta < (1ULL << (shift + LEVEL_BITS))) || (level == NUM_UPPER_LEVELS - 1)) {
+            upperSlots_[level][(entry->expiry >> shift) & (LEVEL_SLOTS - 1)].push_back(entry);
+            return;
+        }
+    }
+}
+
+uint32_t TimerService::cascade(uint32_t level, uint32_t index) {
+    Slot slot;
+
+    slot.swap(upperSlots_[level][index]);
+    for (auto &entry : slot) {
+        if (entry->isCancelled) {
+            --numPending_;
+            continue;
+        }
+        addToWheel(entry);
+    }
+
+    return index;
+}
+
+void TimerService::advance(uint64_t nowTick,
+    std::vector<std::shared_ptr<TimerEntry>> &expired) {
+
+    uint32_t index, level;
+    Slot slot;
+
+    while (numPending_ && (nextTick_ <= nowTick)) {
+        index = nextTick_ & (ROOT_SLOTS - 1);
+
+        /* First level wrapped, refill it from the next level and so on */
+        if (!index) {
+            for (level = 0; level < NUM_UPPER_LEVELS; ++level) {
+                if (cascade(level, (nextTick_ >> (ROOT_BITS + level * LEVEL_BITS))
+                        & (LEVEL_SLOTS - 1))) {
+                    break;
+                }
+            }
+        }
+
+        slot.clear();
+        slot.swap(rootSlots_[index]);
+        for (auto &entry : slot) {
+            --numPending_;
+            if (entry->isCancelled) {
+                continue;
+            }
+            if (entry->id != INVALID_TIMER_ID) {
+                pendingTimers_.erase(entry->id);
+            }
+            expired.push_back(entry);
+        }
+
+        ++nextTick_;
+    }
+
+    if (!numPending_ && (nextTick_ <= nowTick)) {
+        nextTick_ = nowTick + 1;
+    }
+}
+
+/*
+ * Next tick the timer thread has to wake up at: the next non-empty slot of the first
+ * level, or the next wrap of the first level if the upper levels have entries.
+ */
+bool TimerService::getNextEventTick(uint64_t &tick) {
+    uint64_t wrapTick = (nextTick_ | (ROOT_SLOTS - 1)) + 1;
+    bool hasUpperEntries = false;
+
+    if (!numPending_) {
+        return false;
+    }
+
+    for (auto &level : upperSlots_) {
+        for (auto &slot : level) {
+            if (!slot.empty()) {
+                hasUpperEntries = true;
+                break;
+            }
+        }
+        if (hasUpperEntries) {
+            break;
+        }
+    }
+
+    if (hasUpperEntries && !(nextTick_ & (ROOT_SLOTS - 1))) {
+        tick = nextTick_;
+        return true;
+    }
+
+    for (tick = nextTick_; tick < wrapTick; ++tick) {
+        if (!rootSlots_[tick & (ROOT_SLOTS - 1)].empty()) {
+            return true;
+        }
+    }
+
+    if (hasUpperEntries) {
+        tick = wrapTick;
+        return true;
+    }
+
+    /* Remaining entries of the first level expire after the wrap */
+    for (; tick < nextTick_ + ROOT_SLOTS; ++tick) {
+        if (!rootSlots_[tick & (ROOT_SLOTS - 1)].empty()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TimerService::armTimer(bool isArmed, uint64_t tick) {
+    struct itimerspec spec{};
+    uint64_t ns;
+
+    isArmed_ = isArmed;
+    armedTick_ = tick;
+
+    if (timerFd_ < 0) {
+        return;
+    }
+
+    if (isArmed) {
+        ns = startTime_.tv_nsec + tick * NS_PER_MS;
+        spec.it_value.tv_sec = startTime_.tv_sec + ns / NS_PER_SEC;
+        spec.it_value.tv_nsec = ns % NS_PER_SEC;
+    }
+
+    /* Zero it_value disarms */
+    if (timerfd_settime(timerFd_, TFD_TIMER_ABSTIME, &spec, nullptr) < 0) {
+        LOG(ERROR, __FUNCTION__, " can't arm timerfd, lnx err ", static_cast<int>(errno));
+    }
+}
+
+uint64_t TimerService::getWakeups() {
+    std::lock_guard<std::mutex> lock(wheelMtx_);
+    return wakeups_;
+}
+
+void TimerService::runTimerLoop() {
+    struct pollfd fds[2];
+    std::vector<std::shared_ptr<TimerEntry>> expired;
+    uint64_t value, nowTick, tick;
+    int timeout = -1;
+    bool hasEvent;
+
+    fds[0].fd = wakeFd_;
+    fds[0].events = POLLIN;
+    fds[1].fd = timerFd_;
+    fds[1].events = POLLIN;
+
+    while (true) {
+        /* Without a timerfd, fall back on the poll timeout */
+        if (poll(fds, (timerFd_ < 0) ? 1 : 2, timeout) < 0 && (errno != EINTR)) {
+            LOG(ERROR, __FUNCTION__, " poll failed, lnx err ", static_cast<int>(errno));
+        }
+
+        if ((wakeFd_ >= 0) && (read(wakeFd_, &value, sizeof(value)) < 0)) {
+            /* Nothing to read, EAGAIN */
+        }
+        if ((timerFd_ >= 0) && (read(timerFd_, &value, sizeof(value)) < 0)) {
+            /* Nothing to read, EAGAIN */
+        }
+
+        expired.clear();
+        {
+            std::lock_guard<std::mutex> lock(wheelMtx_);
+            if (isShutdown_) {
+                break;
+            }
+
+            nowTick = getElapsedNs() / NS_PER_MS;
+            advance(nowTick, expired);
+            if (!expired.empty()) {
+                ++wakeups_;
+            }
+
+            hasEvent = getNextEventTick(tick);
+            armTimer(hasEvent, tick);
+
+            timeout = -1;
+            if (hasEvent && (timerFd_ < 0)) {
+                timeout = (tick > nowTick) ? static_cast<int>(tick - nowTick) : 0;
+            }
+        }
+
+        dispatch(expired);
+    }
+}
+
+void TimerService::dispatch(std::vector<std::shared_ptr<TimerEntry>> &expired) {
+    if (expired.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(poolMtx_);
+
+    for (auto &entry : expired) {
+        readyTasks_.push_back(entry);
+    }
+
+    /*
+     * Grow the pool while tasks would otherwise wait for a busy worker. A new worker
+     * counts as idle until it picks its first task.
+     */
+    while ((readyTasks_.size() > numIdleWorkers_) && (numWorkers_ < MAX_WORKERS)) {
+        std::thread(&TimerService::runWorker, this).detach();
+        ++numWorkers_;
+        ++numIdleWorkers_;
+    }
+
+    poolCv_.notify_all();
+}
+
+void TimerService::runWorker() {
+    bool isReady;
+    std::shared_ptr<TimerEntry> entry;
+    std::unique_lock<std::mutex> lock(poolMtx_);
+
+    --numIdleWorkers_;
+
+    while (true) {
+        if (readyTasks_.empty()) {
+            if (isPoolShutdown_) {
+                break;
+            }
+
+            ++numIdleWorkers_;
+            isReady = poolCv_.wait_for(lock,
+                std::chrono::milliseconds(WORKER_IDLE_TIMEOUT_MS),
+                [this] { return (!readyTasks_.empty() || isPoolShutdown_); });
+            --numIdleWorkers_;
+
+            /* Pool shrinks back when idle */
+            if (!isReady && (numWorkers_ > MIN_WORKERS)) {
+                break;
+            }
+            continue;
+        }
+
+        entry = readyTasks_.front();
+        readyTasks_.pop_front();
+
+        lock.unlock();
+        runTask(entry);
+        entry = nullptr;
+        lock.lock();
+    }
+
+    --numWorkers_;
+    poolCv_.notify_all();
+}
+
+void TimerService::runTask(std::shared_ptr<TimerEntry> &entry) {
+    try {
+        if (entry->task) {
+            entry->task();
+        }
+    } catch (const std::exception &e) {
+        LOG(ERROR, __FUNCTION__, " task failed, ", e.what());
+    } catch (...) {
+        LOG(ERROR, __FUNCTION__, " task failed with an unknown exception");
+    }
+
+    /* Release whatever the task captured before anyone waiting proceeds */
+    entry->task = nullptr;
+    entry->done.set_value();
+}
+
+}  // end of namespace common
+}  // end of namespace telux
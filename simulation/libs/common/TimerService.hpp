@@ -0,0 +1,138 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @brief      TimerService runs tasks after a delay. Pending tasks are kept in a
+ *             hierarchical timer wheel served by one timerfd thread and expired tasks
+ *             are executed by a small worker pool, so that a burst of delayed
+ *             callbacks doesn't need one sleeping thread per callback.
+ */
+
+#ifndef TIMERSERVICE_HPP
+#define TIMERSERVICE_HPP
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace telux {
+namespace common {
+
+class TimerService {
+ public:
+    using TimerId = uint64_t;
+
+    static const TimerId INVALID_TIMER_ID = 0;
+
+    static std::shared_ptr<TimerService> getInstance();
+
+    /**
+     * Runs the task on a worker thread once delayMs milliseconds have elapsed, a
+     * negative delay runs it as soon as possible. Delays beyond the wheel's range
+     * (about 18 hours) are clamped.
+     *
+     * @param [in]  delayMs      Delay in milliseconds
+     * @param [in]  task         Task to run
+     * @param [out] id           Optional handle to cancel the task with
+     *
+     * @returns future that becomes ready when the task has run or has been cancelled.
+     *          It can be added to an AsyncTaskQueue to keep the owner of the task
+     *          alive until then.
+     */
+    std::shared_future<void> runAfter(int delayMs, std::function<void()> task,
+        TimerId *id = nullptr);
+
+    /**
+     * Cancels a task which hasn't started running yet.
+     *
+     * @returns true if the task was cancelled, false if it already started/ran or
+     *          the id is unknown
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * Gets the number of times the timer thread woke up and found tasks due, tasks
+     * due in the same tick share one wakeup.
+     */
+    uint64_t getWakeups();
+
+    ~TimerService();
+
+ private:
+    struct TimerEntry {
+        TimerId id;
+        uint64_t expiry;
+        std::function<void()> task;
+        std::promise<void> done;
+        bool isCancelled;
+    };
+
+    using Slot = std::vector<std::shared_ptr<TimerEntry>>;
+
+    /* Wheel with 1 ms ticks, 8 bits in the first level and 6 bits in the others */
+    static const uint32_t ROOT_BITS = 8;
+    static const uint32_t LEVEL_BITS = 6;
+    static const uint32_t ROOT_SLOTS = (1 << ROOT_BITS);
+    static const uint32_t LEVEL_SLOTS = (1 << LEVEL_BITS);
+    static const uint32_t NUM_UPPER_LEVELS = 3;
+    static const uint64_t MAX_DELAY_TICKS
+        = (1ULL << (ROOT_BITS + NUM_UPPER_LEVELS * LEVEL_BITS)) - 1;
+
+    static const uint32_t MIN_WORKERS = 2;
+    static const uint32_t MAX_WORKERS = 64;
+    static const int WORKER_IDLE_TIMEOUT_MS = 5000;
+
+    TimerService();
+
+    uint64_t getElapsedNs();
+    void addToWheel(std::shared_ptr<TimerEntry> entry);
+    uint32_t cascade(uint32_t level, uint32_t index);
+    void advance(uint64_t nowTick, std::vector<std::shared_ptr<TimerEntry>> &expired);
+    bool getNextEventTick(uint64_t &tick);
+    void armTimer(bool isArmed, uint64_t tick);
+    void runTimerLoop();
+    void dispatch(std::vector<std::shared_ptr<TimerEntry>> &expired);
+    void runWorker();
+    void runTask(std::shared_ptr<TimerEntry> &entry);
+
+    struct timespec startTime_;
+    int timerFd_ = -1;
+    int wakeFd_ = -1;
+    std::thread timerThread_;
+
+    /* Protects the wheel and pending timers */
+    std::mutex wheelMtx_;
+    std::array<Slot, ROOT_SLOTS> rootSlots_;
+    std::array<std::array<Slot, LEVEL_SLOTS>, NUM_UPPER_LEVELS> upperSlots_;
+    std::unordered_map<TimerId, std::shared_ptr<TimerEntry>> pendingTimers_;
+    uint64_t nextTick_ = 0;
+    uint64_t armedTick_ = 0;
+    bool isArmed_ = false;
+    uint32_t numPending_ = 0;
+    TimerId lastId_ = INVALID_TIMER_ID;
+    bool isShutdown_ = false;
+    uint64_t wakeups_ = 0;
+
+    /* Protects the worker pool */
+    std::mutex poolMtx_;
+    std::condition_variable poolCv_;
+    std::deque<std::shared_ptr<TimerEntry>> readyTasks_;
+    uint32_t numWorkers_ = 0;
+    uint32_t numIdleWorkers_ = 0;
+    bool isPoolShutdown_ = false;
+};
+
+}  // end of namespace common
+}  // end of namespace telux
+
+#endif  // TIMERSERVICE_HPP
@@ -44,8 +44,10 @@
 #ifndef EVENT_MANAGER_HPP
 #define EVENT_MANAGER_HPP
 
+#include <atomic>
 #include <thread>
 #include <chrono>
+#include <map>
 #include <unordered_map>
 #include <string>
 #include <memory>
@@ -61,6 +63,7 @@
 #include "protos/proto-src/event_simulation.grpc.pb.h"
 #include "Logger.hpp"
 #include "CommonUtils.hpp"
+#include "ShmEventRing.hpp"
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -69,6 +72,9 @@ using grpc::Status;
 
 #define UNSOLICITED_COMMON_EVENT "all"
 #define DEFAULT_DELAY 100
+#define EVENT_RING_WAIT_MS 100
+/* Out of order events held before a missing one is given up on */
+#define MAX_PENDING_EVENTS 1024
 
 namespace telux {
 namespace common {
@@ -310,6 +316,17 @@ private:
             return;
         }
 
+        // Ask the server to write the events to a shared memory ring when it's enabled, the
+        // stream still delivers the events that don't fit in the ring
+        std::unique_ptr<ShmEventRing> ring;
+        uint32_t ringCapacity = ShmEventRing::getConfiguredCapacity();
+        if (ringCapacity > 0) {
+            ring = ShmEventRing::create(ShmEventRing::getNextName(getpid()), ringCapacity);
+            if (ring) {
+                request.set_shm_ring(ring->getName());
+            }
+        }
+
         std::unique_ptr<grpc::ClientReader<::eventService::EventResponse> > reader(
             stub_->registerForEvents(getClientContext(), request));
 
@@ -325,17 +342,39 @@ private:
         }
         updateFilters();
 
-        std::string readStr;
+        {
+            std::lock_guard<std::mutex> lck(seqMutex_);
+            nextSeq_ = 1;
+            pendingEvents_.clear();
+        }
+
+        std::atomic<bool> isStreamActive(true);
+        std::thread ringReader;
+        if (ring) {
+            ringReader = std::thread([this, &ring, &isStreamActive]() {
+                std::string record;
+                ::eventService::EventResponse event;
+                // Drain the ring once the stream ends, the server may have written to it last
+                while (true) {
+                    if (ring->pop(record, EVENT_RING_WAIT_MS)) {
+                        if (event.ParseFromString(record)) {
+                            dispatchInOrder(event);
+                        }
+                    } else if (!isStreamActive) {
+                        break;
+                    }
+                }
+            });
+        }
+
         while (reader->Read(&response)) {
-            LOG(DEBUG, __FUNCTION__, " Received event for::", response.filter());
-            if (response.has_any()) {
-                auto f = std::async(policy_, [this, response]() {
-                        this->handleEventNotifications(response);
-                        }).share();
-                taskQ_->add(f);
-            }
+            dispatchInOrder(response);
         }
         grpc::Status status = reader->Finish();
+        isStreamActive = false;
+        if (ringReader.joinable()) {
+            ringReader.join();
+        }
         connectedToSimulationServer_ = false;
 
         if (status.ok()) {
@@ -345,6 +384,50 @@ private:
         }
     }
 
+    /**
+     * @brief Events arrive through both the stream and the ring, this API dispatches them
+     * in the order the server sent them.
+     */
+    void dispatchInOrder(const ::eventService::EventResponse &response) {
+        std::lock_guard<std::mutex> lck(seqMutex_);
+        if (response.seq() == 0) {
+            dispatchEvent(response);
+            return;
+        }
+        if (response.seq() < nextSeq_) {
+            LOG(ERROR, __FUNCTION__, " Duplicate event ", response.seq());
+            return;
+        }
+        if (response.seq() != nextSeq_) {
+            pendingEvents_[response.seq()] = response;
+            if (pendingEvents_.size() <= MAX_PENDING_EVENTS) {
+                return;
+            }
+            // The missing event was lost, e.g. with a corrupted ring
+            LOG(ERROR, __FUNCTION__, " Missing event ", nextSeq_);
+            nextSeq_ = pendingEvents_.begin()->first;
+        } else {
+            dispatchEvent(response);
+            ++nextSeq_;
+        }
+        auto it = pendingEvents_.begin();
+        while ((it != pendingEvents_.end()) && (it->first == nextSeq_)) {
+            dispatchEvent(it->second);
+            ++nextSeq_;
+            it = pendingEvents_.erase(it);
+        }
+    }
+
+    void dispatchEvent(const ::eventService::EventResponse &response) {
+        LOG(DEBUG, __FUNCTION__, " Received event for::", response.filter());
+        if (response.has_any()) {
+            auto f = std::async(policy_, [this, response]() {
+                    this->handleEventNotifications(response);
+                    }).share();
+            taskQ_->add(f);
+        }
+    }
+
     /**
      * @brief To achieve multicast from server, a list of filters is provided by client
      * while connecting to server, that filter list is maintained on server side in RAM.
@@ -432,6 +515,11 @@ private:
     std::mutex connectToServerMtx_;
     std::condition_variable connectToServerCv_;
 
+    std::mutex seqMutex_;
+    /* Sequence number of the next event to dispatch */
+    uint64_t nextSeq_ = 1;
+    std::map<uint64_t, ::eventService::EventResponse> pendingEvents_;
+
     grpc::ClientContext* contextPtr_;
     /*
     * owner_less performs an owner-based comparison b/w
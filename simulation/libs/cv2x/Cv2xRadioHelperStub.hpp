@@ -8,6 +8,7 @@
 
 #include "common/ListenerManager.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 #include <telux/common/CommonDefines.hpp>
 #include <telux/cv2x/Cv2xRadioManager.hpp>
 
@@ -50,12 +51,10 @@ const std::string CV2X_EVENT_RADIO_FILTER      = "cv2x_radio";
         if (cb && taskq                                                            \
             && telux::common::Status::SUCCESS                                      \
                    == static_cast<telux::common::Status>(response.status())) {     \
-            auto f = std::async(std::launch::async, [=]() {                        \
-                if (delay > 0) {                                                   \
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay)); \
-                }                                                                  \
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,   \
+                [=]() {                                                            \
                 cb(static_cast<telux::common::ErrorCode>(response.error()));       \
-            }).share();                                                            \
+            });                                                                    \
             taskq->add(f);                                                         \
         }                                                                          \
     }
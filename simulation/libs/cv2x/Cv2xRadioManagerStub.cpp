@@ -9,6 +9,7 @@
 #include "common/Logger.hpp"
 #include "common/SimulationConfigParser.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -191,16 +192,13 @@ telux::common::Status Cv2xRadioManagerStub::requestCv2xStatus(RequestCv2xStatusC
     int delay = DEFAULT_DELAY;
     CALL_RPC(stub_->requestCv2xStatus, request, status, response, delay);
     if (cb) {
-        auto f = std::async(std::launch::async, [=]() {
-            if (delay > 0) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            }
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay, [=]() {
             telux::cv2x::Cv2xStatus cv2xStatus;
             if (status == telux::common::Status::SUCCESS) {
                 RPC_TO_CV2X_STATUS(response.cv2xstatus(), cv2xStatus);
             }
             cb(cv2xStatus, static_cast<telux::common::ErrorCode>(response.error()));
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
@@ -213,16 +211,13 @@ telux::common::Status Cv2xRadioManagerStub::requestCv2xStatus(RequestCv2xStatusC
     int delay = DEFAULT_DELAY;
     CALL_RPC(stub_->requestCv2xStatus, request, status, response, delay);
     if (cb) {
-        auto f = std::async(std::launch::async, [=]() {
-            if (delay > 0) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            }
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay, [=]() {
             telux::cv2x::Cv2xStatusEx cv2xStatusEx;
             if (status == telux::common::Status::SUCCESS) {
                 RPC_TO_CV2X_STATUS(response.cv2xstatus(), cv2xStatusEx.status);
             }
             cb(cv2xStatusEx, static_cast<telux::common::ErrorCode>(response.error()));
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
@@ -291,12 +286,9 @@ telux::common::Status Cv2xRadioManagerStub::getSlssRxInfo(GetSlssRxInfoCallback
     const ::google::protobuf::Empty request;
     CALL_RPC(stub_->getSlssRxInfo, request, status, response, delay);
     if (cb) {
-        auto f = std::async(std::launch::async, [=]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay, [=]() {
             SlssRxInfo info;
 
-            if (delay > 0) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            }
             if (status != telux::common::Status::SUCCESS) {
                 LOG(ERROR, __FUNCTION__, "Fail to get slss Rx info");
             } else {
@@ -308,7 +300,7 @@ telux::common::Status Cv2xRadioManagerStub::getSlssRxInfo(GetSlssRxInfoCallback
                 }
             }
             cb(info, static_cast<telux::common::ErrorCode>(response.error()));
-        }).share();
+        });
         taskQ_->add(f);
     }
 
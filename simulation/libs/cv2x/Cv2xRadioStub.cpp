@@ -15,6 +15,7 @@
 #include "Cv2xRxSubscriptionStub.hpp"
 #include "Cv2xTxFlowStub.hpp"
 #include "Cv2xTxRxSocketStub.hpp"
+#include "common/TimerService.hpp"
 #include <telux/cv2x/Cv2xRxMetaDataHelper.hpp>
 
 #define RPC_FAIL_SUFFIX " RPC Request failed - "
@@ -1980,12 +1981,9 @@ telux::common::Status Cv2xRadioSimulation::registerTxStatusReportListener(uint16
             }
         }
         if (cb && taskQ_) {
-            auto f = std::async(std::launch::async, [=]() {
-                if (delay > 0) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-                }
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay, [=]() {
                 cb(static_cast<telux::common::ErrorCode>(response.error()));
-            }).share();
+            });
             taskQ_->add(f);
         }
     } else {
@@ -2096,15 +2094,12 @@ telux::common::Status Cv2xRadioSimulation::requestDataSessionSettings(
     CALL_RPC(serviceStub_->requestDataSessionSettings, request, res, response, delay);
     if (res == telux::common::Status::SUCCESS && cb && taskQ_) {
         auto ec = static_cast<telux::common::ErrorCode>(response.error());
-        auto f = std::async(std::launch::async, [this, delay, ec, cb]() {
-            if (delay > 0) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            }
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay, [this, ec, cb]() {
             DataSessionSettings nonIpSettings;
             nonIpSettings.mtuValid = true;
             nonIpSettings.mtu = getCapabilities().linkNonIpMtuBytes;
             cb(nonIpSettings, ec);
-        }).share();
+        });
         taskQ_->add(f);
     }
     return res;
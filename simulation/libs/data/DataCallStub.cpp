@@ -3,17 +3,20 @@
  *  SPDX-License-Identifier: BSD-3-Clause-Clear
  */
 
+#include <algorithm>
+
 #include "DataCallStub.hpp"
 #include "DataHelper.hpp"
 #include "common/Logger.hpp"
+#include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::common;
 using namespace std;
 
 #define MAX_LTE_TX_RATE 1000
 #define MAX_LTE_RX_RATE 1000
-#define LTE_AVG_TX_RATE 500
-#define LTE_AVG_RX_RATE 500
+#define SKIP_CALLBACK -1
 
 namespace telux {
 
@@ -22,6 +25,7 @@ namespace data {
 DataCallStub::DataCallStub(std::string ifaceName) {
    LOG(DEBUG, __FUNCTION__);
    taskQ_ = std::make_shared<AsyncTaskQueue<void>>();
+   stub_ = CommonUtils::getGrpcStub<::dataStub::DataConnectionManager>();
    ifaceName_ = ifaceName;
 }
 
@@ -113,28 +117,70 @@ OperationType DataCallStub::getOperationType() {
 
 telux::common::Status DataCallStub::requestDataCallStatistics(StatisticsResponseCb callback) {
     LOG(DEBUG, __FUNCTION__);
-    ErrorCode error = ErrorCode::SUCCESS;
-    lock_guard<mutex> lock(statusMutex_);
-    DataCallStats stats;
-    auto f = std::async(std::launch::async,
-             [this, stats, error, callback]() {
-                   callback(stats, error);
-               }).share();
-    taskQ_->add(f);
-    return Status::SUCCESS;
+    ::dataStub::DataCallStatisticsRequest request;
+    ::dataStub::RequestDataCallStatisticsReply response;
+    grpc::ClientContext context;
+    {
+        lock_guard<mutex> lock(statusMutex_);
+        request.set_slot_id(slotId_);
+        request.set_profile_id(profileId_);
+    }
+
+    grpc::Status reqStatus = stub_->RequestDatacallStatistics(&context, request, &response);
+    if (!reqStatus.ok()) {
+        LOG(ERROR, __FUNCTION__, " RequestDatacallStatistics request failed");
+        return Status::FAILED;
+    }
+
+    ErrorCode error = static_cast<ErrorCode>(response.reply().error());
+    Status status = static_cast<Status>(response.reply().status());
+    int delay = static_cast<int>(response.reply().delay());
+
+    if ((status == Status::SUCCESS) && callback && (delay != SKIP_CALLBACK)) {
+        DataCallStats stats;
+        stats.packetsTx = response.packets_tx();
+        stats.packetsRx = response.packets_rx();
+        stats.bytesTx = response.bytes_tx();
+        stats.bytesRx = response.bytes_rx();
+        stats.packetsDroppedTx = response.packets_dropped_tx();
+        stats.packetsDroppedRx = response.packets_dropped_rx();
+        auto f = TimerService::getInstance()->runAfter(delay, [stats, error, callback]() {
+            callback(stats, error);
+        });
+        taskQ_->add(f);
+    }
+    return status;
 }
 
 telux::common::Status DataCallStub::resetDataCallStatistics(
     telux::common::ResponseCallback callback) {
     LOG(DEBUG, __FUNCTION__);
-    ErrorCode error = ErrorCode::SUCCESS;
-    lock_guard<mutex> lock(statusMutex_);
-    auto f = std::async(std::launch::async,
-             [this, error, callback]() {
-                   callback(error);
-               }).share();
-    taskQ_->add(f);
-    return Status::SUCCESS;
+    ::dataStub::DataCallStatisticsRequest request;
+    ::dataStub::DefaultReply response;
+    grpc::ClientContext context;
+    {
+        lock_guard<mutex> lock(statusMutex_);
+        request.set_slot_id(slotId_);
+        request.set_profile_id(profileId_);
+    }
+
+    grpc::Status reqStatus = stub_->ResetDatacallStatistics(&context, request, &response);
+    if (!reqStatus.ok()) {
+        LOG(ERROR, __FUNCTION__, " ResetDatacallStatistics request failed");
+        return Status::FAILED;
+    }
+
+    ErrorCode error = static_cast<ErrorCode>(response.error());
+    Status status = static_cast<Status>(response.status());
+    int delay = static_cast<int>(response.delay());
+
+    if ((status == Status::SUCCESS) && callback && (delay != SKIP_CALLBACK)) {
+        auto f = TimerService::getInstance()->runAfter(delay, [error, callback]() {
+            callback(error);
+        });
+        taskQ_->add(f);
+    }
+    return status;
 }
 
 telux::common::Status DataCallStub::requestTrafficFlowTemplate(IpFamilyType family,
@@ -146,18 +192,41 @@ telux::common::Status DataCallStub::requestTrafficFlowTemplate(IpFamilyType fami
 telux::common::Status DataCallStub::requestDataCallBitRate(
     requestDataCallBitRateResponseCb callback) {
     LOG(DEBUG, __FUNCTION__);
-    auto f = std::async(std::launch::async,
-             [this, callback]() {
-                    BitRateInfo bitRate{};
-                    bitRate.maxTxRate = MAX_LTE_TX_RATE;
-                    bitRate.maxRxRate = MAX_LTE_RX_RATE;
-                    bitRate.txRate = LTE_AVG_TX_RATE;
-                    bitRate.rxRate = LTE_AVG_RX_RATE;
-                    ErrorCode error = ErrorCode::SUCCESS;
-                   callback(bitRate, error);
-               }).share();
-    taskQ_->add(f);
-    return Status::SUCCESS;
+    ::dataStub::DataCallBitRateRequest request;
+    ::dataStub::RequestDataCallBitRateReply response;
+    grpc::ClientContext context;
+    {
+        lock_guard<mutex> lock(statusMutex_);
+        request.mutable_bit_rate()->set_slot_id(slotId_);
+        request.mutable_bit_rate()->set_profile_id(profileId_);
+    }
+
+    grpc::Status reqStatus = stub_->RequestDataCallBitRate(&context, request, &response);
+    if (!reqStatus.ok()) {
+        LOG(ERROR, __FUNCTION__, " RequestDataCallBitRate request failed");
+        return Status::FAILED;
+    }
+
+    ErrorCode error = static_cast<ErrorCode>(response.reply().error());
+    Status status = static_cast<Status>(response.reply().status());
+    int delay = static_cast<int>(response.reply().delay());
+
+    if ((status == Status::SUCCESS) && callback && (delay != SKIP_CALLBACK)) {
+        BitRateInfo bitRate{};
+        // txRate and rxRate hold the rates measured over the last sampling period of the
+        // call's interface. The maximum rates are raised to them, so that clients reading
+        // only the maximum never see less than what the call is carrying.
+        bitRate.txRate = response.tx_rate();
+        bitRate.rxRate = response.rx_rate();
+        bitRate.maxTxRate = std::max<uint64_t>(MAX_LTE_TX_RATE, bitRate.txRate);
+        bitRate.maxRxRate = std::max<uint64_t>(MAX_LTE_RX_RATE, bitRate.rxRate);
+        auto f = TimerService::getInstance()->runAfter(delay, [bitRate, error, callback]() {
+            BitRateInfo info = bitRate;
+            callback(info, error);
+        });
+        taskQ_->add(f);
+    }
+    return status;
 }
 
 void DataCallStub::setProfileId(int id) {
@@ -13,6 +13,7 @@
 #include <memory>
 
 #include "common/AsyncTaskQueue.hpp"
+#include "protos/proto-src/data_simulation.grpc.pb.h"
 
 using namespace telux::common;
 
@@ -43,6 +44,8 @@ public:
         telux::common::ResponseCallback callback = nullptr) override;
     telux::common::Status requestTrafficFlowTemplate(IpFamilyType family,
         TrafficFlowTemplateCb callback) override;
+    /* Reports the measured rates in BitRateInfo::txRate/rxRate, the maximum rates are never
+     * below them */
     telux::common::Status requestDataCallBitRate(
         requestDataCallBitRateResponseCb callback) override;
 
@@ -61,6 +64,7 @@ public:
 private:
     std::string ifaceName_;
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
+    std::unique_ptr<::dataStub::DataConnectionManager::Stub> stub_;
     int profileId_;
     SlotId slotId_ = DEFAULT_SLOT_ID;
     IpFamilyType family_ = IpFamilyType::UNKNOWN;
@@ -13,6 +13,7 @@
 #include "common/Logger.hpp"
 #include "common/SimulationConfigParser.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -238,11 +239,10 @@ void DataConnectionManagerStub::invokeCallback(telux::common::ResponseCallback c
     telux::common::ErrorCode error, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -291,11 +291,7 @@ telux::common::Status DataConnectionManagerStub::setDefaultProfile(OperationType
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -343,11 +339,10 @@ telux::common::Status DataConnectionManagerStub::getDefaultProfile(OperationType
         uint8_t profileId = response.profile_id();
         LOG(DEBUG, __FUNCTION__, " profileId:", profileId);
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f = std::async(std::launch::async,
-             [this, error, profileId, slotID, delay,callback]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+             [this, error, profileId, slotID, callback]() {
                     callback(profileId, slotID, error);
-               }).share();
+               });
             taskQ_->add(f);
         }
     }
@@ -402,11 +397,7 @@ telux::common::Status DataConnectionManagerStub::setRoamingMode(bool enable,
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -461,11 +452,10 @@ telux::common::Status DataConnectionManagerStub::requestRoamingMode(uint8_t prof
         uint8_t profile_Id = response.profile_id();
         LOG(DEBUG, __FUNCTION__, " profile_Id:", profile_Id, " mode:", mode);
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f = std::async(std::launch::async,
-             [this, mode, profile_Id, error, delay, callback]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+             [this, mode, profile_Id, error, callback]() {
                     callback(mode, profile_Id, error);
-               }).share();
+               });
             taskQ_->add(f);
         }
     }
@@ -735,11 +725,10 @@ telux::common::Status DataConnectionManagerStub::startDataCall(
     } while(0);
 
     if (callback && (delay != SKIP_CALLBACK)) {
-        auto f = std::async(std::launch::async,
-        [this, baseCallPtr, error, delay, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+        [this, baseCallPtr, error, callback]() {
                 callback(baseCallPtr, error);
-        }).share();
+        });
         taskQ_->add(f);
     }
 
@@ -844,11 +833,10 @@ telux::common::Status DataConnectionManagerStub::startDataCall(int profileId,
     } while(0);
 
     if (callback && (delay != SKIP_CALLBACK)) {
-        auto f = std::async(std::launch::async,
-        [this, baseCallPtr, error, delay, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+        [this, baseCallPtr, error, callback]() {
                 callback(baseCallPtr, error);
-        }).share();
+        });
         taskQ_->add(f);
     }
 
@@ -951,13 +939,12 @@ telux::common::Status DataConnectionManagerStub::stopDataCall(
     } while (0);
 
     if (callback) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
                 [this, baseCallPtr, error, delay, callback]() {
                     if (callback && (delay != SKIP_CALLBACK)) {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                         callback(baseCallPtr, error);
                     }
-                }).share();
+                });
         f.wait();
     }
 
@@ -1132,13 +1119,12 @@ telux::common::Status DataConnectionManagerStub::stopDataCall(int profileId,
     } while (0);
 
     if (callback) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
                 [this, baseCallPtr, error, delay, callback]() {
                     if (callback && (delay != SKIP_CALLBACK)) {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                         callback(baseCallPtr, error);
                     }
-                }).share();
+                });
         f.wait();
     }
 
@@ -1238,14 +1224,12 @@ telux::common::Status DataConnectionManagerStub::requestDataCallList(
             dataCalls.push_back(std::static_pointer_cast<IDataCall>(it.second));
         }
         LOG(DEBUG, __FUNCTION__, " found ", dataCalls.size(), " datacall");
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
                 [this, dataCalls, error, delay, callback]() {
                     if (callback && (delay != SKIP_CALLBACK)){
-                        std::this_thread::sleep_for(
-                            std::chrono::milliseconds(delay));
                         callback(dataCalls, error);
                     }
-                }).share();
+                });
         taskQ_->add(f);
     }
 
@@ -1307,11 +1291,10 @@ telux::common::Status DataConnectionManagerStub::requestThrottledApnInfo(Throttl
 
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f = std::async(std::launch::async,
-             [this, apnThrottleInfo, error, delay, callback]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+             [this, apnThrottleInfo, error, callback]() {
                     callback(apnThrottleInfo, error);
-               }).share();
+               });
             taskQ_->add(f);
         }
     }
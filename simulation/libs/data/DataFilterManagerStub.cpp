@@ -7,6 +7,7 @@
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -125,11 +126,10 @@ void DataFilterManagerStub::invokeCallback(telux::common::ResponseCallback callb
     telux::common::ErrorCode error, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -178,11 +178,7 @@ telux::common::Status DataFilterManagerStub::setDataRestrictMode(DataRestrictMod
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -228,11 +224,10 @@ telux::common::Status DataFilterManagerStub::requestDataRestrictMode(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f = std::async(std::launch::async,
-                [this, error, mode, callback, delay]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, error, mode, callback]() {
                     callback(mode, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -275,12 +270,14 @@ telux::common::Status DataFilterManagerStub::addDataRestrictFilter(
             error = telux::common::ErrorCode::INTERNAL_ERROR;
         }
 
+        if (error == telux::common::ErrorCode::SUCCESS) {
+            std::lock_guard<std::mutex> lock(filterMutex_);
+            filters_.push_back(filter);
+            matcher_ = nullptr;
+        }
+
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -317,12 +314,14 @@ telux::common::Status DataFilterManagerStub::removeAllDataRestrictFilters(
             error = telux::common::ErrorCode::INTERNAL_ERROR;
         }
 
+        if (error == telux::common::ErrorCode::SUCCESS) {
+            std::lock_guard<std::mutex> lock(filterMutex_);
+            filters_.clear();
+            matcher_ = nullptr;
+        }
+
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -402,6 +401,18 @@ telux::common::Status DataFilterManagerStub::removeAllDataRestrictFilters(
     return telux::common::Status::NOTSUPPORTED;
 }
 
+bool DataFilterManagerStub::matchesDataRestrictFilter(const IpPacketHeader &header) {
+    std::shared_ptr<const DataRestrictFilterMatcher> matcher;
+    {
+        std::lock_guard<std::mutex> lock(filterMutex_);
+        if (!matcher_) {
+            matcher_ = std::make_shared<const DataRestrictFilterMatcher>(filters_);
+        }
+        matcher = matcher_;
+    }
+    return matcher->matches(header);
+}
+
 void DataFilterManagerStub::onEventUpdate(google::protobuf::Any event) {
     if (event.Is<::dataStub::SetDataRestrictModeRequest>()) {
         ::dataStub::SetDataRestrictModeRequest modeUpdateEvent;
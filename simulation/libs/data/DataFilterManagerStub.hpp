@@ -13,6 +13,7 @@
 #include "common/ListenerManager.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
 #include "protos/proto-src/data_simulation.grpc.pb.h"
+#include "DataRestrictFilterMatcher.hpp"
 
 namespace telux {
 namespace data {
@@ -75,6 +76,12 @@ public:
 
     void onEventUpdate(google::protobuf::Any event) override;
 
+    /**
+     * Simulation only, tells whether a packet matches one of the data restrict filters
+     * added so far. Packets are checked with it by the telsdk_data_filter_matcher tool.
+     */
+    bool matchesDataRestrictFilter(const IpPacketHeader &header);
+
 private:
     void initSync(telux::common::InitResponseCb callback);
     void setSubSystemStatus(telux::common::ServiceStatus status);
@@ -95,6 +102,11 @@ private:
 
     SlotId slotId_ = DEFAULT_SLOT_ID;
     telux::common::ServiceStatus subSystemStatus_;
+
+    std::mutex filterMutex_;
+    std::vector<std::shared_ptr<IIpFilter>> filters_;
+    /* Compiled from filters_ on the first match after they change */
+    std::shared_ptr<const DataRestrictFilterMatcher> matcher_;
 };
 
 } // end of namespace data
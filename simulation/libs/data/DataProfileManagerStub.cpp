@@ -10,6 +10,7 @@
 #include <thread>
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -405,11 +406,10 @@ telux::common::Status DataProfileManagerStub::requestProfile(uint8_t profileId,
         LOG(DEBUG, __FUNCTION__, " requestProfile successful profileId:",
                 profileId);
         if (callback && (delay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            auto f = std::async(std::launch::async,
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
              [this, error, queryProfile, callback]() {
                    callback->onResponse(queryProfile, error);
-               }).share();
+               });
             taskQ_->add(f);
         }
     }
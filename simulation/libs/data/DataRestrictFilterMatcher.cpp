@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "DataRestrictFilterMatcher.hpp"
+
+#include <algorithm>
+#include <arpa/inet.h>
+
+#include "common/Logger.hpp"
+
+#define BITS_PER_WORD 64
+#define IPV4_ADDR_BITS 32
+#define IPV6_ADDR_BITS 128
+#define MAX_PORT 65535
+
+namespace telux {
+namespace data {
+
+static void setBit(std::vector<uint64_t> &bits, size_t index) {
+    bits[index / BITS_PER_WORD] |= (1ULL << (index % BITS_PER_WORD));
+}
+
+void DataRestrictFilterMatcher::IntervalTable::build(const std::vector<Range> &ranges,
+    size_t words) {
+    starts_.assign(1, Key());
+    for (auto &range : ranges) {
+        if (range.isAny) {
+            continue;
+        }
+        starts_.push_back(range.first);
+        // The interval after the range starts at last + 1, unless last is the highest value
+        Key next = range.last;
+        if (++next.lo == 0) {
+            ++next.hi;
+        }
+        if (!((next.hi == 0) && (next.lo == 0))) {
+            starts_.push_back(next);
+        }
+    }
+    std::sort(starts_.begin(), starts_.end());
+    starts_.erase(std::unique(starts_.begin(), starts_.end()), starts_.end());
+
+    sets_.assign(starts_.size(), Bitset(words, 0));
+    for (size_t rule = 0; rule < ranges.size(); rule++) {
+        const Range &range = ranges[rule];
+        size_t begin = 0;
+        size_t end = starts_.size();
+        if (!range.isAny) {
+            begin = std::lower_bound(starts_.begin(), starts_.end(), range.first)
+                - starts_.begin();
+            end = std::upper_bound(starts_.begin(), starts_.end(), range.last)
+                - starts_.begin();
+        }
+        for (size_t idx = begin; idx < end; idx++) {
+            setBit(sets_[idx], rule);
+        }
+    }
+}
+
+const DataRestrictFilterMatcher::Bitset &DataRestrictFilterMatcher::IntervalTable::lookup(
+    const Key &key) const {
+    // The first interval starts at 0 so there is always one holding the key
+    size_t idx = std::upper_bound(starts_.begin(), starts_.end(), key) - starts_.begin();
+    return sets_[idx - 1];
+}
+
+DataRestrictFilterMatcher::DataRestrictFilterMatcher(
+    const std::vector<std::shared_ptr<IIpFilter>> &filters) {
+    words_ = (filters.size() + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    v4Rules_.assign(words_, 0);
+    v6Rules_.assign(words_, 0);
+
+    std::vector<Range> src4, dest4, src6, dest6, srcPort, destPort;
+    for (size_t idx = 0; idx < filters.size(); idx++) {
+        Rule rule = compileFilter(filters[idx]);
+        if (rule.isV4) {
+            setBit(v4Rules_, idx);
+        }
+        if (rule.isV6) {
+            setBit(v6Rules_, idx);
+        }
+        Bitset &protocolRules = protocolRules_[rule.protocol];
+        protocolRules.resize(words_, 0);
+        setBit(protocolRules, idx);
+        src4.push_back(rule.src4);
+        dest4.push_back(rule.dest4);
+        src6.push_back(rule.src6);
+        dest6.push_back(rule.dest6);
+        srcPort.push_back(rule.srcPort);
+        destPort.push_back(rule.destPort);
+    }
+    src4_.build(src4, words_);
+    dest4_.build(dest4, words_);
+    src6_.build(src6, words_);
+    dest6_.build(dest6, words_);
+    srcPort_.build(srcPort, words_);
+    destPort_.build(destPort, words_);
+    LOG(DEBUG, __FUNCTION__, " compiled ", filters.size(), " filters");
+}
+
+DataRestrictFilterMatcher::Rule DataRestrictFilterMatcher::compileFilter(
+    std::shared_ptr<IIpFilter> filter) {
+    Rule rule;
+    rule.protocol = filter->getIpProtocol();
+
+    IPv4Info ipv4Info = filter->getIPv4Info();
+    IPv6Info ipv6Info = filter->getIPv6Info();
+    bool hasIPv4 = !ipv4Info.srcAddr.empty() || !ipv4Info.destAddr.empty();
+    bool hasIPv6 = !ipv6Info.srcAddr.empty() || !ipv6Info.destAddr.empty();
+    IpFamilyType family = filter->getIpFamily();
+    // Without an explicit family, the filter applies to the family of its addresses
+    if ((family == IpFamilyType::IPV6) || ((family != IpFamilyType::IPV4) && hasIPv6
+        && !hasIPv4)) {
+        rule.isV4 = false;
+    }
+    if ((family == IpFamilyType::IPV4) || ((family != IpFamilyType::IPV6) && hasIPv4
+        && !hasIPv6)) {
+        rule.isV6 = false;
+    }
+    if (!getIPv4Range(ipv4Info.srcAddr, ipv4Info.srcSubnetMask, rule.src4)
+        || !getIPv4Range(ipv4Info.destAddr, ipv4Info.destSubnetMask, rule.dest4)) {
+        LOG(ERROR, __FUNCTION__, " invalid IPv4 address, filter won't match IPv4");
+        rule.isV4 = false;
+    }
+    if (!getIPv6Range(ipv6Info.srcAddr, ipv6Info.srcPrefixLen, rule.src6)
+        || !getIPv6Range(ipv6Info.destAddr, ipv6Info.dstPrefixLen, rule.dest6)) {
+        LOG(ERROR, __FUNCTION__, " invalid IPv6 address, filter won't match IPv6");
+        rule.isV6 = false;
+    }
+
+    if (auto udpFilter = std::dynamic_pointer_cast<IUdpFilter>(filter)) {
+        UdpInfo udpInfo = udpFilter->getUdpInfo();
+        rule.srcPort = getPortRange(udpInfo.src);
+        rule.destPort = getPortRange(udpInfo.dest);
+    } else if (auto tcpFilter = std::dynamic_pointer_cast<ITcpFilter>(filter)) {
+        TcpInfo tcpInfo = tcpFilter->getTcpInfo();
+        rule.srcPort = getPortRange(tcpInfo.src);
+        rule.destPort = getPortRange(tcpInfo.dest);
+    }
+    return rule;
+}
+
+bool DataRestrictFilterMatcher::getIPv4Range(const std::string &addr, const std::string &mask,
+    Range &range) {
+    range = Range();
+    if (addr.empty()) {
+        return true;
+    }
+    uint8_t bytes[4];
+    if (inet_pton(AF_INET, addr.c_str(), bytes) != 1) {
+        return false;
+    }
+    uint32_t netmask = UINT32_MAX;
+    if (!mask.empty()) {
+        uint8_t maskBytes[4];
+        if (inet_pton(AF_INET, mask.c_str(), maskBytes) != 1) {
+            return false;
+        }
+        netmask = static_cast<uint32_t>(getIPv4Key(maskBytes).lo);
+    }
+    uint32_t value = static_cast<uint32_t>(getIPv4Key(bytes).lo);
+    range.isAny = false;
+    range.first.lo = value & netmask;
+    range.last.lo = value | ~netmask;
+    return true;
+}
+
+bool DataRestrictFilterMatcher::getIPv6Range(const std::string &addr, uint8_t prefixLength,
+    Range &range) {
+    range = Range();
+    if (addr.empty()) {
+        return true;
+    }
+    uint8_t bytes[16];
+    if (inet_pton(AF_INET6, addr.c_str(), bytes) != 1) {
+        return false;
+    }
+    // An address without a valid prefix length is a host address
+    int length = ((prefixLength == 0) || (prefixLength > IPV6_ADDR_BITS))
+        ? IPV6_ADDR_BITS : prefixLength;
+    uint64_t hiMask = (length >= 64) ? UINT64_MAX : ~(UINT64_MAX >> length);
+    uint64_t loMask = (length <= 64) ? 0 : ~(UINT64_MAX >> (length - 64));
+    Key value = getIPv6Key(bytes);
+    range.isAny = false;
+    range.first.hi = value.hi & hiMask;
+    range.first.lo = value.lo & loMask;
+    range.last.hi = value.hi | ~hiMask;
+    range.last.lo = value.lo | ~loMask;
+    return true;
+}
+
+DataRestrictFilterMatcher::Range DataRestrictFilterMatcher::getPortRange(
+    const PortInfo &port) {
+    Range range;
+    if ((port.port == 0) && (port.range == 0)) {
+        return range;
+    }
+    range.isAny = false;
+    range.first.lo = port.port;
+    range.last.lo = std::min<uint32_t>(MAX_PORT, static_cast<uint32_t>(port.port) + port.range);
+    return range;
+}
+
+DataRestrictFilterMatcher::Key DataRestrictFilterMatcher::getIPv4Key(const uint8_t *addr) {
+    Key key;
+    key.lo = (static_cast<uint32_t>(addr[0]) << 24) | (static_cast<uint32_t>(addr[1]) << 16)
+        | (static_cast<uint32_t>(addr[2]) << 8) | addr[3];
+    return key;
+}
+
+DataRestrictFilterMatcher::Key DataRestrictFilterMatcher::getIPv6Key(const uint8_t *addr) {
+    Key key;
+    for (int idx = 0; idx < 8; idx++) {
+        key.hi = (key.hi << 8) | addr[idx];
+        key.lo = (key.lo << 8) | addr[idx + 8];
+    }
+    return key;
+}
+
+DataRestrictFilterMatcher::Key DataRestrictFilterMatcher::getPortKey(uint16_t port) {
+    Key key;
+    key.lo = port;
+    return key;
+}
+
+bool DataRestrictFilterMatcher::makeHeader(const std::string &srcAddr,
+    const std::string &destAddr, IpProtocol protocol, uint16_t srcPort, uint16_t destPort,
+    IpPacketHeader &header) {
+    if ((inet_pton(AF_INET, srcAddr.c_str(), header.srcAddr) == 1)
+        && (inet_pton(AF_INET, destAddr.c_str(), header.destAddr) == 1)) {
+        header.family = IpFamilyType::IPV4;
+    } else if ((inet_pton(AF_INET6, srcAddr.c_str(), header.srcAddr) == 1)
+        && (inet_pton(AF_INET6, destAddr.c_str(), header.destAddr) == 1)) {
+        header.family = IpFamilyType::IPV6;
+    } else {
+        return false;
+    }
+    header.protocol = protocol;
+    header.srcPort = srcPort;
+    header.destPort = destPort;
+    return true;
+}
+
+int DataRestrictFilterMatcher::getFirstMatch(const IpPacketHeader &header) const {
+    const Bitset *family = nullptr;
+    const Bitset *src = nullptr;
+    const Bitset *dest = nullptr;
+    if (header.family == IpFamilyType::IPV4) {
+        family = &v4Rules_;
+        src = &src4_.lookup(getIPv4Key(header.srcAddr));
+        dest = &dest4_.lookup(getIPv4Key(header.destAddr));
+    } else if (header.family == IpFamilyType::IPV6) {
+        family = &v6Rules_;
+        src = &src6_.lookup(getIPv6Key(header.srcAddr));
+        dest = &dest6_.lookup(getIPv6Key(header.destAddr));
+    } else {
+        return -1;
+    }
+    auto protocol = protocolRules_.find(header.protocol);
+    if (protocol == protocolRules_.end()) {
+        return -1;
+    }
+    const Bitset &srcPort = srcPort_.lookup(getPortKey(header.srcPort));
+    const Bitset &destPort = destPort_.lookup(getPortKey(header.destPort));
+
+    for (size_t word = 0; word < words_; word++) {
+        uint64_t bits = (*family)[word] & (*src)[word] & (*dest)[word]
+            & protocol->second[word] & srcPort[word] & destPort[word];
+        if (bits) {
+            return static_cast<int>(word * BITS_PER_WORD + __builtin_ctzll(bits));
+        }
+    }
+    return -1;
+}
+
+bool DataRestrictFilterMatcher::matches(const IpPacketHeader &header) const {
+    return getFirstMatch(header) >= 0;
+}
+
+} // end of namespace data
+} // end of namespace telux
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       DataRestrictFilterMatcher.hpp
+ *
+ * @brief      DataRestrictFilterMatcher tells whether a packet is let through by a set of
+ *             data restrict filters. The filters are compiled once into one table per
+ *             header field. A table splits the values of the field into intervals that
+ *             no filter boundary crosses and keeps, for each interval, the bitset of the
+ *             filters accepting it. Matching a packet is a lookup per field followed by
+ *             the intersection of the bitsets, so its cost hardly depends on the number
+ *             of filters.
+ *             The IP family, source and destination prefixes, protocol and the TCP/UDP
+ *             port ranges are matched. The other fields of the filters are ignored.
+ */
+
+#ifndef DATA_RESTRICT_FILTER_MATCHER_HPP
+#define DATA_RESTRICT_FILTER_MATCHER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <telux/data/IpFilter.hpp>
+
+namespace telux {
+namespace data {
+
+/**
+ * Header of a packet checked against the filters, addresses are in network byte order.
+ */
+struct IpPacketHeader {
+    IpFamilyType family = IpFamilyType::UNKNOWN; /**< IPV4 or IPV6 */
+    uint8_t srcAddr[16] = {};
+    uint8_t destAddr[16] = {};
+    IpProtocol protocol = 0;
+    uint16_t srcPort = 0;
+    uint16_t destPort = 0;
+};
+
+class DataRestrictFilterMatcher {
+ public:
+    /**
+     * Compiles the filters, the first one has the lowest rank.
+     */
+    DataRestrictFilterMatcher(const std::vector<std::shared_ptr<IIpFilter>> &filters);
+
+    /**
+     * Fills a packet header from the textual addresses.
+     *
+     * @returns false if the addresses aren't both IPv4 or both IPv6
+     */
+    static bool makeHeader(const std::string &srcAddr, const std::string &destAddr,
+        IpProtocol protocol, uint16_t srcPort, uint16_t destPort, IpPacketHeader &header);
+
+    bool matches(const IpPacketHeader &header) const;
+
+    /**
+     * @returns Rank of the first filter matching the packet, -1 if none does
+     */
+    int getFirstMatch(const IpPacketHeader &header) const;
+
+ private:
+    using Bitset = std::vector<uint64_t>;
+
+    /* Field value, IPv6 addresses use both words and the other fields the low word only */
+    struct Key {
+        uint64_t hi = 0;
+        uint64_t lo = 0;
+        bool operator<(const Key &other) const {
+            return (hi != other.hi) ? (hi < other.hi) : (lo < other.lo);
+        }
+        bool operator==(const Key &other) const {
+            return (hi == other.hi) && (lo == other.lo);
+        }
+    };
+
+    /* Inclusive range of values a filter accepts for a field */
+    struct Range {
+        Key first;
+        Key last;
+        bool isAny = true;
+    };
+
+    class IntervalTable {
+     public:
+        void build(const std::vector<Range> &ranges, size_t words);
+        const Bitset &lookup(const Key &key) const;
+
+     private:
+        /* Start of each interval, the first one is always 0 */
+        std::vector<Key> starts_;
+        std::vector<Bitset> sets_;
+    };
+
+    struct Rule {
+        bool isV4 = true;
+        bool isV6 = true;
+        IpProtocol protocol = 0;
+        Range src4;
+        Range dest4;
+        Range src6;
+        Range dest6;
+        Range srcPort;
+        Range destPort;
+    };
+
+    static Rule compileFilter(std::shared_ptr<IIpFilter> filter);
+    static bool getIPv4Range(const std::string &addr, const std::string &mask, Range &range);
+    static bool getIPv6Range(const std::string &addr, uint8_t prefixLength, Range &range);
+    static Range getPortRange(const PortInfo &port);
+    static Key getIPv4Key(const uint8_t *addr);
+    static Key getIPv6Key(const uint8_t *addr);
+    static Key getPortKey(uint16_t port);
+
+    size_t words_;
+    Bitset v4Rules_;
+    Bitset v6Rules_;
+    std::unordered_map<IpProtocol, Bitset> protocolRules_;
+    IntervalTable src4_;
+    IntervalTable dest4_;
+    IntervalTable src6_;
+    IntervalTable dest6_;
+    IntervalTable srcPort_;
+    IntervalTable destPort_;
+};
+
+} // end of namespace data
+} // end of namespace telux
+
+#endif // DATA_RESTRICT_FILTER_MATCHER_HPP
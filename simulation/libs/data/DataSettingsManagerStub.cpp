@@ -6,6 +6,7 @@
 #include "DataSettingsManagerStub.hpp"
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include "DataUtilsStub.hpp"
 #include <thread>
 
@@ -107,11 +108,10 @@ void DataSettingsManagerStub::invokeCallback(telux::common::ResponseCallback cal
     telux::common::ErrorCode error, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -148,11 +148,7 @@ telux::common::Status DataSettingsManagerStub::requestDdsSwitch(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
 
         if (error == telux::common::ErrorCode::SUCCESS) {
@@ -197,11 +193,10 @@ telux::common::Status DataSettingsManagerStub::requestCurrentDds(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            auto f = std::async(std::launch::async,
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
                 [this, error, ddsResponse, callback]() {
                    callback(ddsResponse, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -252,11 +247,7 @@ telux::common::Status DataSettingsManagerStub::setBackhaulPreference(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -299,11 +290,10 @@ telux::common::Status DataSettingsManagerStub::requestBackhaulPreference(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            auto f = std::async(std::launch::async,
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
                 [this, error, backhaulPref, callback]() {
                    callback(backhaulPref, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -349,11 +339,7 @@ telux::common::Status DataSettingsManagerStub::setBandInterferenceConfig(bool en
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -402,11 +388,10 @@ telux::common::Status DataSettingsManagerStub::requestBandInterferenceConfig(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            auto f = std::async(std::launch::async,
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
                 [this, error, enabled, config, callback]() {
                    callback(enabled, config, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -447,11 +432,7 @@ telux::common::Status DataSettingsManagerStub::setWwanConnectivityConfig(SlotId
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -496,11 +477,10 @@ telux::common::Status DataSettingsManagerStub::requestWwanConnectivityConfig(Slo
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            auto f = std::async(std::launch::async,
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
                 [this, error, slotId, isallowed, callback]() {
                    callback(slotId, isallowed, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -541,11 +521,7 @@ telux::common::Status DataSettingsManagerStub::switchBackHaul(BackhaulInfo sourc
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -821,11 +797,7 @@ telux::common::Status DataSettingsManagerStub::setMacSecState(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -865,11 +837,10 @@ telux::common::Status DataSettingsManagerStub::requestMacSecState(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            auto f = std::async(std::launch::async,
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
                 [this, error, isenabled, callback]() {
                    callback(isenabled, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
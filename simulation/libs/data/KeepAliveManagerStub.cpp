@@ -24,6 +24,12 @@ KeepAliveManagerStub::KeepAliveManagerStub (SlotId slotId) : slotId_(slotId) {
     LOG(DEBUG, __FUNCTION__);
     taskQ_ = std::make_shared<AsyncTaskQueue<void>>();
     listenerMgr_ = std::make_shared<telux::common::ListenerManager<IKeepAliveListener>>();
+    // The offloader may report after this stub is gone, it only holds the listeners
+    auto listenerMgr = listenerMgr_;
+    offloader_ = std::make_shared<TcpKeepAliveOffloader>(
+        [listenerMgr](telux::common::ErrorCode error, TCPKAOffloadHandle handle) {
+        KeepAliveManagerStub::onKeepAliveStatusChange(listenerMgr, error, handle);
+    });
     subSystemStatus_ = telux::common::ServiceStatus::SERVICE_UNAVAILABLE;
 }
 
@@ -131,34 +137,106 @@ telux::common::Status KeepAliveManagerStub::deregisterListener(
     return listenerMgr_->deRegisterListener(listener);
 }
 
+bool KeepAliveManagerStub::isServiceAvailable() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (subSystemStatus_ != telux::common::ServiceStatus::SERVICE_AVAILABLE) {
+        LOG(ERROR, __FUNCTION__, " KeepAlive Manager not ready");
+        return false;
+    }
+    return true;
+}
+
+void KeepAliveManagerStub::onKeepAliveStatusChange(
+    std::shared_ptr<telux::common::ListenerManager<IKeepAliveListener>> listenerMgr,
+    telux::common::ErrorCode error, TCPKAOffloadHandle handle) {
+    LOG(DEBUG, __FUNCTION__, " handle::", handle, " error::", static_cast<int>(error));
+    std::vector<std::weak_ptr<IKeepAliveListener>> listeners;
+    listenerMgr->getAvailableListeners(listeners);
+    for (auto &wp : listeners) {
+        if (auto sp = wp.lock()) {
+            sp->onKeepAliveStatusChange(error, handle);
+        }
+    }
+}
+
 telux::common::ErrorCode  KeepAliveManagerStub::enableTCPMonitor(
     const TCPKAParams &tcpKaParams, MonitorHandleType &monHandle) {
     LOG(DEBUG, __FUNCTION__);
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    if (!TcpKeepAliveOffloader::isValid(tcpKaParams)) {
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    // The session parameters are assumed to be learned as soon as the monitor is enabled
+    std::lock_guard<std::mutex> lk(monitorMtx_);
+    monHandle = ++lastMonHandle_;
+    monitors_[monHandle] = tcpKaParams;
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode  KeepAliveManagerStub::disableTCPMonitor(
     const MonitorHandleType monHandle) {
     LOG(DEBUG, __FUNCTION__);
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    std::lock_guard<std::mutex> lk(monitorMtx_);
+    if (monitors_.erase(monHandle) == 0) {
+        return telux::common::ErrorCode::NO_SUCH_ELEMENT;
+    }
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode  KeepAliveManagerStub::startTCPKeepAliveOffload(
     const TCPKAParams &tcpKaParams, const TCPSessionParams &tcpSessionParams,
     const uint32_t interval, TCPKAOffloadHandle &handle) {
-    LOG(DEBUG, __FUNCTION__);
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__, " interval::", interval);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    return offloader_->start(tcpKaParams, interval, handle);
 }
 
 telux::common::ErrorCode  KeepAliveManagerStub::startTCPKeepAliveOffload(
     const MonitorHandleType monHandle, const uint32_t interval, TCPKAOffloadHandle &handle) {
-    LOG(DEBUG, __FUNCTION__);
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__, " monHandle::", monHandle, " interval::", interval);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    TCPKAParams tcpKaParams;
+    {
+        std::lock_guard<std::mutex> lk(monitorMtx_);
+        auto it = monitors_.find(monHandle);
+        if (it == monitors_.end()) {
+            LOG(ERROR, __FUNCTION__, " no TCP monitor ", monHandle);
+            return telux::common::ErrorCode::INVALID_ARGUMENTS;
+        }
+        tcpKaParams = it->second;
+    }
+    return offloader_->start(tcpKaParams, interval, handle);
 }
 
 telux::common::ErrorCode  KeepAliveManagerStub::stopTCPKeepAliveOffload(const TCPKAOffloadHandle handle) {
-    LOG(DEBUG, __FUNCTION__);
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__, " handle::", handle);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    return offloader_->stop(handle);
+}
+
+void KeepAliveManagerStub::setPeerReachable(const std::string &ipAddress, bool isReachable) {
+    LOG(DEBUG, __FUNCTION__, " ", ipAddress, " reachable::", isReachable);
+    offloader_->setPeerReachable(ipAddress, isReachable);
+}
+
+telux::common::ErrorCode KeepAliveManagerStub::getKeepAliveStats(
+    const TCPKAOffloadHandle handle, KeepAliveStats &stats) {
+    return offloader_->getStats(handle, stats);
+}
+
+uint64_t KeepAliveManagerStub::getKeepAliveWakeups() {
+    return offloader_->getWakeups();
 }
 
 } // end of namespace data
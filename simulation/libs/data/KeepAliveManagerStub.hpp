@@ -6,6 +6,8 @@
  #ifndef KEEPALIVE_MANAGER_STUB_HPP
  #define KEEPALIVE_MANAGER_STUB_HPP
 
+#include <map>
+
 #include <telux/data/KeepAliveManager.hpp>
 #include <telux/common/CommonDefines.hpp>
 #include <telux/data/DataDefines.hpp>
@@ -13,6 +15,7 @@
 #include "common/AsyncTaskQueue.hpp"
 #include "common/ListenerManager.hpp"
 #include "protos/proto-src/data_simulation.grpc.pb.h"
+#include "TcpKeepAliveOffloader.hpp"
 
 namespace telux {
 namespace data {
@@ -44,6 +47,24 @@ public:
     telux::common::Status registerListener(std::weak_ptr<IKeepAliveListener> listener) override;
     telux::common::Status deregisterListener(std::weak_ptr<IKeepAliveListener> listener) override;
 
+    /**
+     * Simulation only: probes to a peer set unreachable aren't answered. Probes to loopback
+     * peers are answered if a TCP connection to the peer can be made.
+     */
+    void setPeerReachable(const std::string &ipAddress, bool isReachable);
+
+    /**
+     * Simulation only: gets the probe counters and timing of a keep-alive offload.
+     */
+    telux::common::ErrorCode getKeepAliveStats(
+        const TCPKAOffloadHandle handle, KeepAliveStats &stats);
+
+    /**
+     * Simulation only: gets the number of wakeups of the timer thread running the
+     * probes which found tasks due.
+     */
+    uint64_t getKeepAliveWakeups();
+
 private:
     SlotId slotId_ = DEFAULT_SLOT_ID;
     telux::data::OperationType oprType_;
@@ -56,11 +77,20 @@ private:
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
     telux::common::InitResponseCb initCb_;
     std::shared_ptr<telux::common::ListenerManager<IKeepAliveListener>> listenerMgr_;
+    std::shared_ptr<TcpKeepAliveOffloader> offloader_;
+
+    std::mutex monitorMtx_;
+    MonitorHandleType lastMonHandle_ = 0;
+    std::map<MonitorHandleType, TCPKAParams> monitors_;
 
     void initSync(telux::common::InitResponseCb callback);
     void setSubSystemStatus(telux::common::ServiceStatus status);
     void invokeInitCallback(telux::common::ServiceStatus status);
     void onServiceStatusChange(telux::common::ServiceStatus status);
+    bool isServiceAvailable();
+    static void onKeepAliveStatusChange(
+        std::shared_ptr<telux::common::ListenerManager<IKeepAliveListener>> listenerMgr,
+        telux::common::ErrorCode error, TCPKAOffloadHandle handle);
 };
 
 } // end of namespace data
@@ -6,6 +6,7 @@
 #include "ServingSystemManagerStub.hpp"
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include <thread>
 using grpc::Channel;
 using grpc::ClientContext;
@@ -94,11 +95,10 @@ void ServingSystemManagerStub::invokeCallback(telux::common::ResponseCallback ca
     telux::common::ErrorCode error, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -174,11 +174,10 @@ telux::common::Status ServingSystemManagerStub::requestServiceStatus(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f = std::async(std::launch::async,
-                [this, error, serviceStatus, delay, callback]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, error, serviceStatus, callback]() {
                     callback(serviceStatus, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -223,11 +222,10 @@ telux::common::Status ServingSystemManagerStub::requestRoamingStatus(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f = std::async(std::launch::async,
-                [this, error, roamingStatus, delay, callback]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, error, roamingStatus, callback]() {
                     callback(roamingStatus, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -276,11 +274,10 @@ telux::common::Status ServingSystemManagerStub::requestNrIconType(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f = std::async(std::launch::async,
-                [this, error, type, delay, callback]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, error, type, callback]() {
                     callback(type, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
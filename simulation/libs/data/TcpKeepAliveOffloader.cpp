@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "TcpKeepAliveOffloader.hpp"
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/Logger.hpp"
+
+#define MAX_PORT 65535
+
+namespace telux {
+namespace data {
+
+TcpKeepAliveOffloader::TcpKeepAliveOffloader(StatusCallback onStatusChange)
+   : onStatusChange_(onStatusChange)
+   , timerService_(telux::common::TimerService::getInstance()) {
+    LOG(DEBUG, __FUNCTION__);
+    wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFd_ < 0) {
+        LOG(ERROR, __FUNCTION__, " can't create eventfd, errno ", errno);
+        return;
+    }
+    connectThread_ = std::thread(&TcpKeepAliveOffloader::runConnectLoop, this);
+}
+
+TcpKeepAliveOffloader::~TcpKeepAliveOffloader() {
+    LOG(DEBUG, __FUNCTION__);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &entry : sessions_) {
+            if (entry.second.timerId != telux::common::TimerService::INVALID_TIMER_ID) {
+                timerService_->cancel(entry.second.timerId);
+            }
+        }
+        isShutdown_ = true;
+    }
+    uint64_t value = 1;
+    if ((wakeFd_ >= 0) && (write(wakeFd_, &value, sizeof(value)) < 0)) {
+        LOG(ERROR, __FUNCTION__, " can't wake connect thread");
+    }
+    if (connectThread_.joinable()) {
+        connectThread_.join();
+    }
+    if (wakeFd_ >= 0) {
+        close(wakeFd_);
+    }
+}
+
+bool TcpKeepAliveOffloader::isValid(const TCPKAParams &params) {
+    uint8_t addr[16];
+    int family = AF_INET;
+    if (inet_pton(AF_INET, params.srcIp.c_str(), addr) != 1) {
+        family = AF_INET6;
+        if (inet_pton(AF_INET6, params.srcIp.c_str(), addr) != 1) {
+            return false;
+        }
+    }
+    if (inet_pton(family, params.dstIp.c_str(), addr) != 1) {
+        return false;
+    }
+    return (params.srcPort > 0) && (params.srcPort <= MAX_PORT) && (params.dstPort > 0)
+        && (params.dstPort <= MAX_PORT);
+}
+
+std::string TcpKeepAliveOffloader::getConnectionKey(const TCPKAParams &params) {
+    return params.srcIp + "|" + std::to_string(params.srcPort) + "|" + params.dstIp + "|"
+        + std::to_string(params.dstPort);
+}
+
+bool TcpKeepAliveOffloader::isLoopbackAddress(const std::string &ipAddress) {
+    struct in_addr v4;
+    if (inet_pton(AF_INET, ipAddress.c_str(), &v4) == 1) {
+        return (ntohl(v4.s_addr) >> 24) == 127;
+    }
+    struct in6_addr v6;
+    return (inet_pton(AF_INET6, ipAddress.c_str(), &v6) == 1) && IN6_IS_ADDR_LOOPBACK(&v6);
+}
+
+telux::common::ErrorCode TcpKeepAliveOffloader::start(const TCPKAParams &params,
+    uint32_t intervalMs, TCPKAOffloadHandle &handle) {
+    if (!isValid(params) || (intervalMs == 0)) {
+        LOG(ERROR, __FUNCTION__, " invalid keep-alive parameters");
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    std::string key = getConnectionKey(params);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (connections_.find(key) != connections_.end()) {
+        LOG(ERROR, __FUNCTION__, " connection already offloaded");
+        return telux::common::ErrorCode::ALREADY;
+    }
+    connections_.insert(key);
+    handle = ++lastHandle_;
+    Session &session = sessions_[handle];
+    session.params = params;
+    session.intervalMs = intervalMs;
+    session.isLoopback = isLoopbackAddress(params.dstIp);
+    session.dueTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(intervalMs);
+    scheduleLocked(handle, session);
+    LOG(DEBUG, __FUNCTION__, " handle::", handle, " interval::", intervalMs);
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode TcpKeepAliveOffloader::stop(TCPKAOffloadHandle handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sessions_.find(handle);
+    if (it == sessions_.end()) {
+        LOG(ERROR, __FUNCTION__, " no keep-alive offload ", handle);
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    if (it->second.timerId != telux::common::TimerService::INVALID_TIMER_ID) {
+        timerService_->cancel(it->second.timerId);
+    }
+    connections_.erase(getConnectionKey(it->second.params));
+    sessions_.erase(it);
+    LOG(DEBUG, __FUNCTION__, " handle::", handle);
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+void TcpKeepAliveOffloader::setPeerReachable(const std::string &ipAddress, bool isReachable) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (isReachable) {
+        unreachablePeers_.erase(ipAddress);
+    } else {
+        unreachablePeers_.insert(ipAddress);
+    }
+}
+
+telux::common::ErrorCode TcpKeepAliveOffloader::getStats(TCPKAOffloadHandle handle,
+    KeepAliveStats &stats) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sessions_.find(handle);
+    if (it == sessions_.end()) {
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    stats = it->second.stats;
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+uint64_t TcpKeepAliveOffloader::getWakeups() {
+    return timerService_->getWakeups();
+}
+
+/*
+ * Starts a non-blocking connection attempt to the peer.
+ *
+ * @returns the socket if the attempt is in progress or has connected, as told by
+ *          isConnected, -1 if it failed
+ */
+int TcpKeepAliveOffloader::startConnect(const TCPKAParams &params, bool &isConnected) {
+    struct sockaddr_storage peer;
+    socklen_t peerLength = 0;
+    memset(&peer, 0, sizeof(peer));
+    auto v4 = reinterpret_cast<struct sockaddr_in *>(&peer);
+    auto v6 = reinterpret_cast<struct sockaddr_in6 *>(&peer);
+    if (inet_pton(AF_INET, params.dstIp.c_str(), &v4->sin_addr) == 1) {
+        v4->sin_family = AF_INET;
+        v4->sin_port = htons(static_cast<uint16_t>(params.dstPort));
+        peerLength = sizeof(struct sockaddr_in);
+    } else if (inet_pton(AF_INET6, params.dstIp.c_str(), &v6->sin6_addr) == 1) {
+        v6->sin6_family = AF_INET6;
+        v6->sin6_port = htons(static_cast<uint16_t>(params.dstPort));
+        peerLength = sizeof(struct sockaddr_in6);
+    } else {
+        return -1;
+    }
+
+    int fd = socket(peer.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        LOG(ERROR, __FUNCTION__, " socket failed, errno ", errno);
+        return -1;
+    }
+    isConnected = false;
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&peer), peerLength) == 0) {
+        isConnected = true;
+    } else if (errno != EINPROGRESS) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void TcpKeepAliveOffloader::probe(TCPKAOffloadHandle handle) {
+    bool isAnswered = false;
+    uint64_t value = 1;
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = sessions_.find(handle);
+        if (it == sessions_.end()) {
+            return;
+        }
+        Session &session = it->second;
+        session.timerId = telux::common::TimerService::INVALID_TIMER_ID;
+
+        uint64_t latenessUs = (now > session.dueTime)
+            ? std::chrono::duration_cast<std::chrono::microseconds>(
+                now - session.dueTime).count() : 0;
+        session.stats.totalLatenessUs += latenessUs;
+        if (latenessUs > session.stats.maxLatenessUs) {
+            session.stats.maxLatenessUs = latenessUs;
+        }
+        if (session.isLoopback && (wakeFd_ >= 0)) {
+            // The connect thread completes the probe, the timer worker doesn't wait for it
+            dueConnects_.push_back(handle);
+            if (write(wakeFd_, &value, sizeof(value)) < 0) {
+                LOG(ERROR, __FUNCTION__, " can't wake connect thread");
+            }
+            return;
+        }
+        if (!session.isLoopback) {
+            isAnswered = (unreachablePeers_.find(session.params.dstIp)
+                == unreachablePeers_.end());
+        }
+    }
+    completeProbe(handle, isAnswered);
+}
+
+void TcpKeepAliveOffloader::completeProbe(TCPKAOffloadHandle handle, bool isAnswered) {
+    bool isNotified = false;
+    telux::common::ErrorCode status = telux::common::ErrorCode::SUCCESS;
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = sessions_.find(handle);
+        if (it == sessions_.end()) {
+            return;
+        }
+        Session &session = it->second;
+        session.stats.probesSent++;
+        if (isAnswered) {
+            session.missedProbes = 0;
+            if (!session.isStarted || session.isFailed) {
+                session.isStarted = true;
+                session.isFailed = false;
+                isNotified = true;
+            }
+        } else {
+            session.stats.probesMissed++;
+            if ((++session.missedProbes >= MAX_MISSED_PROBES) && !session.isFailed) {
+                session.isFailed = true;
+                status = telux::common::ErrorCode::NETWORK_ERR;
+                isNotified = true;
+            }
+        }
+        // Probes that couldn't be sent on time are skipped rather than sent in a burst
+        session.dueTime += std::chrono::milliseconds(session.intervalMs);
+        if (session.dueTime < now) {
+            session.dueTime = now + std::chrono::milliseconds(session.intervalMs);
+        }
+        scheduleLocked(handle, session);
+    }
+    if (isNotified && onStatusChange_) {
+        LOG(DEBUG, __FUNCTION__, " handle::", handle, " status::", static_cast<int>(status));
+        onStatusChange_(status, handle);
+    }
+}
+
+/*
+ * Starts the connection attempts of the loopback probes that became due. Attempts that
+ * complete at once are reported right away, the others are added to connects.
+ */
+void TcpKeepAliveOffloader::startConnects(std::vector<Connect> &connects) {
+    std::vector<std::pair<TCPKAOffloadHandle, TCPKAParams>> due;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto handle : dueConnects_) {
+            auto it = sessions_.find(handle);
+            if (it != sessions_.end()) {
+                due.emplace_back(handle, it->second.params);
+            }
+        }
+        dueConnects_.clear();
+    }
+    auto deadline = std::chrono::steady_clock::now()
+        + std::chrono::milliseconds(LOOPBACK_CONNECT_TIMEOUT_MS);
+    for (auto &entry : due) {
+        bool isConnected = false;
+        int fd = startConnect(entry.second, isConnected);
+        if ((fd < 0) || isConnected) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            completeProbe(entry.first, isConnected);
+            continue;
+        }
+        Connect connect;
+        connect.handle = entry.first;
+        connect.fd = fd;
+        connect.deadline = deadline;
+        connects.push_back(connect);
+    }
+}
+
+/*
+ * Connect thread, polls the wakeup eventfd and every connection attempt in progress, and
+ * completes the probes as the attempts connect, fail or time out.
+ */
+void TcpKeepAliveOffloader::runConnectLoop() {
+    std::vector<Connect> connects;
+    std::vector<struct pollfd> fds;
+    uint64_t value;
+
+    while (true) {
+        auto now = std::chrono::steady_clock::now();
+        int timeout = -1;
+        fds.resize(1 + connects.size());
+        fds[0].fd = wakeFd_;
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+        for (size_t i = 0; i < connects.size(); ++i) {
+            fds[i + 1].fd = connects[i].fd;
+            fds[i + 1].events = POLLOUT;
+            fds[i + 1].revents = 0;
+            auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                connects[i].deadline - now).count();
+            if (remaining < 0) {
+                remaining = 0;
+            }
+            if ((timeout < 0) || (remaining < timeout)) {
+                timeout = static_cast<int>(remaining);
+            }
+        }
+
+        if ((poll(fds.data(), fds.size(), timeout) < 0) && (errno != EINTR)) {
+            LOG(ERROR, __FUNCTION__, " poll failed, errno ", errno);
+        }
+
+        if (read(wakeFd_, &value, sizeof(value)) < 0) {
+            /* Nothing to read, EAGAIN */
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (isShutdown_) {
+                break;
+            }
+        }
+
+        // Completed and timed out attempts first, the poll results are for them
+        now = std::chrono::steady_clock::now();
+        size_t kept = 0;
+        for (size_t i = 0; i < connects.size(); ++i) {
+            Connect &connect = connects[i];
+            bool isDone = (fds[i + 1].revents != 0);
+            if (!isDone && (now < connect.deadline)) {
+                connects[kept++] = connect;
+                continue;
+            }
+            int error = 0;
+            socklen_t errorLength = sizeof(error);
+            bool isConnected = isDone
+                && (getsockopt(connect.fd, SOL_SOCKET, SO_ERROR, &error, &errorLength) == 0)
+                && (error == 0);
+            close(connect.fd);
+            completeProbe(connect.handle, isConnected);
+        }
+        connects.resize(kept);
+
+        startConnects(connects);
+    }
+
+    for (auto &connect : connects) {
+        close(connect.fd);
+    }
+}
+
+void TcpKeepAliveOffloader::scheduleLocked(TCPKAOffloadHandle handle, Session &session) {
+    auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(
+        session.dueTime - std::chrono::steady_clock::now()).count();
+    std::weak_ptr<TcpKeepAliveOffloader> weakSelf;
+    try {
+        weakSelf = shared_from_this();
+    } catch (const std::bad_weak_ptr &e) {
+        // Completed on the connect thread while the offloader is being destroyed
+        return;
+    }
+    timerService_->runAfter((delay > 0) ? static_cast<int>(delay) : 0, [weakSelf, handle]() {
+        if (auto self = weakSelf.lock()) {
+            self->probe(handle);
+        }
+    }, &session.timerId);
+}
+
+} // end of namespace data
+} // end of namespace telux
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       TcpKeepAliveOffloader.hpp
+ *
+ * @brief      TcpKeepAliveOffloader simulates the TCP keep-alive offload of the modem.
+ *             Every offloaded session is a timer of the TimerService wheel that sends a
+ *             probe each interval, so one timer thread serves any number of sessions and
+ *             sessions due at the same tick share a wakeup.
+ *             Probes to loopback peers are real TCP connection attempts, made with
+ *             non-blocking sockets on the offloader's own thread which polls all the
+ *             attempts in progress, so the timer workers never wait for a peer. Probes to
+ *             other peers are answered unless the peer is set unreachable. A session failing
+ *             MAX_MISSED_PROBES probes in a row is reported with NETWORK_ERR, and with
+ *             SUCCESS once a probe is answered again.
+ */
+
+#ifndef TCP_KEEP_ALIVE_OFFLOADER_HPP
+#define TCP_KEEP_ALIVE_OFFLOADER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <telux/data/KeepAliveManager.hpp>
+
+#include "common/TimerService.hpp"
+
+namespace telux {
+namespace data {
+
+struct KeepAliveStats {
+    uint64_t probesSent = 0;
+    uint64_t probesMissed = 0;
+    /* Delay between the time a probe was due and the time it was sent */
+    uint64_t maxLatenessUs = 0;
+    uint64_t totalLatenessUs = 0;
+};
+
+class TcpKeepAliveOffloader : public std::enable_shared_from_this<TcpKeepAliveOffloader> {
+ public:
+    using StatusCallback =
+        std::function<void(telux::common::ErrorCode error, TCPKAOffloadHandle handle)>;
+
+    TcpKeepAliveOffloader(StatusCallback onStatusChange);
+    ~TcpKeepAliveOffloader();
+
+    static bool isValid(const TCPKAParams &params);
+
+    /**
+     * Starts sending probes every interval milliseconds.
+     *
+     * @returns INVALID_ARGUMENTS for invalid parameters, ALREADY if the connection is
+     *          already offloaded
+     */
+    telux::common::ErrorCode start(const TCPKAParams &params, uint32_t intervalMs,
+        TCPKAOffloadHandle &handle);
+
+    telux::common::ErrorCode stop(TCPKAOffloadHandle handle);
+
+    void setPeerReachable(const std::string &ipAddress, bool isReachable);
+
+    telux::common::ErrorCode getStats(TCPKAOffloadHandle handle, KeepAliveStats &stats);
+
+    /**
+     * @returns Number of wakeups of the shared timer thread that found tasks due, it
+     *          includes the tasks of other TimerService users
+     */
+    uint64_t getWakeups();
+
+ private:
+    static const uint32_t MAX_MISSED_PROBES = 3;
+    static const int LOOPBACK_CONNECT_TIMEOUT_MS = 100;
+
+    /* Loopback probe whose connection attempt is in progress */
+    struct Connect {
+        TCPKAOffloadHandle handle;
+        int fd;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    struct Session {
+        TCPKAParams params;
+        uint32_t intervalMs = 0;
+        bool isLoopback = false;
+        bool isStarted = false;
+        bool isFailed = false;
+        uint32_t missedProbes = 0;
+        std::chrono::steady_clock::time_point dueTime;
+        telux::common::TimerService::TimerId timerId =
+            telux::common::TimerService::INVALID_TIMER_ID;
+        KeepAliveStats stats;
+    };
+
+    static std::string getConnectionKey(const TCPKAParams &params);
+    static bool isLoopbackAddress(const std::string &ipAddress);
+    static int startConnect(const TCPKAParams &params, bool &isConnected);
+
+    void probe(TCPKAOffloadHandle handle);
+    void completeProbe(TCPKAOffloadHandle handle, bool isAnswered);
+    void scheduleLocked(TCPKAOffloadHandle handle, Session &session);
+    void runConnectLoop();
+    void startConnects(std::vector<Connect> &connects);
+
+    StatusCallback onStatusChange_;
+    std::shared_ptr<telux::common::TimerService> timerService_;
+    std::mutex mutex_;
+    TCPKAOffloadHandle lastHandle_ = 0;
+    std::unordered_map<TCPKAOffloadHandle, Session> sessions_;
+    /* Offloaded connections, to reject offloading the same connection twice */
+    std::set<std::string> connections_;
+    std::set<std::string> unreachablePeers_;
+    /* Loopback probes due, handed to the connect thread through wakeFd_ */
+    std::vector<TCPKAOffloadHandle> dueConnects_;
+    bool isShutdown_ = false;
+    int wakeFd_ = -1;
+    std::thread connectThread_;
+};
+
+} // end of namespace data
+} // end of namespace telux
+
+#endif // TCP_KEEP_ALIVE_OFFLOADER_HPP
@@ -6,6 +6,7 @@
 #include "BridgeManagerStub.hpp"
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include <thread>
 using grpc::Channel;
 using grpc::ClientContext;
@@ -97,11 +98,10 @@ void BridgeManagerStub::invokeCallback(telux::common::ResponseCallback callback,
     telux::common::ErrorCode error, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
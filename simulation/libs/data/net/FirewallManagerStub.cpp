@@ -6,6 +6,7 @@
 #include "FirewallManagerStub.hpp"
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include "data/DataUtilsStub.hpp"
 #include "data/DataFactoryImplStub.hpp"
 #include "data/net/FirewallEntryImpl.hpp"
@@ -103,11 +104,10 @@ void FirewallManagerStub::invokeCallback(telux::common::ResponseCallback callbac
     telux::common::ErrorCode error, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -218,11 +218,7 @@ telux::common::Status FirewallManagerStub::setFirewallConfig(FirewallConfig fwCo
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -266,11 +262,10 @@ telux::common::Status FirewallManagerStub::requestFirewallConfig(BackhaulInfo bh
         config.bhInfo = bhInfo;
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, config, delay]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, error, callback, config]() {
                     callback(config, error);
-                }).share();
+                });
             taskQ_->add(f1);
         }
     }
@@ -302,11 +297,10 @@ telux::common::Status FirewallManagerStub::addFirewallEntryRequest(FirewallEntry
             error = telux::common::ErrorCode::INVALID_ARG;
             auto handle = -1;
             if (callback && (delay != SKIP_CALLBACK)) {
-                auto f1 = std::async(std::launch::async,
-                    [this, error, callback, handle, delay]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+                auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+                    [this, error, callback, handle]() {
                         callback(handle, error);
-                    }).share();
+                    });
                 taskQ_->add(f1);
             }
             break;
@@ -408,11 +402,10 @@ telux::common::Status FirewallManagerStub::addFirewallEntryRequest(FirewallEntry
             auto handle = response.handle();
 
             if (callback && (delay != SKIP_CALLBACK)) {
-                auto f1 = std::async(std::launch::async,
-                    [this, error, callback, handle, delay]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+                auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+                    [this, error, callback, handle]() {
                         callback(handle, error);
-                    }).share();
+                    });
                 taskQ_->add(f1);
             }
         }
@@ -615,11 +608,7 @@ telux::common::Status FirewallManagerStub::removeFirewallEntry(BackhaulInfo bhIn
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -666,11 +655,7 @@ telux::common::Status FirewallManagerStub::enableDmz(DmzConfig config,
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -717,11 +702,7 @@ telux::common::Status FirewallManagerStub::disableDmz(BackhaulInfo bhInfo,
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -775,11 +756,10 @@ telux::common::Status FirewallManagerStub::requestDmzEntry(BackhaulInfo bhInfo,
                 config.ipAddr = entry;
                 dmzEntries.push_back(config);
             }
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, dmzEntries, delay]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, error, callback, dmzEntries]() {
                     callback(dmzEntries, error);
-                }).share();
+                });
             taskQ_->add(f1);
         }
     }
@@ -9,6 +9,7 @@
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
 #include "common/AsyncTaskQueue.hpp"
+#include "common/TimerService.hpp"
 #include <thread>
 
 using grpc::Channel;
@@ -103,11 +104,10 @@ void L2tpManagerStub::invokeCallback(telux::common::ResponseCallback callback,
     telux::common::ErrorCode error, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -187,11 +187,7 @@ telux::common::Status L2tpManagerStub::setConfig(bool enable, bool enableMss,
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -252,11 +248,10 @@ telux::common::Status L2tpManagerStub::requestConfig(L2tpConfigCb l2tpConfigCb)
             l2tpSysConfig.configList.push_back(l2tpTunnelConfig);
         }
         if (l2tpConfigCb && (delay != SKIP_CALLBACK)) {
-            auto f = std::async(std::launch::async,
-                [this, l2tpSysConfig, error, delay, l2tpConfigCb]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, l2tpSysConfig, error, l2tpConfigCb]() {
                         l2tpConfigCb(l2tpSysConfig, error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -312,11 +307,7 @@ telux::common::Status L2tpManagerStub::addTunnel(const L2tpTunnelConfig &l2tpTun
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -353,11 +344,7 @@ telux::common::Status L2tpManagerStub::removeTunnel(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -396,11 +383,7 @@ telux::common::Status L2tpManagerStub::addSession(uint32_t tunnelId,
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -438,11 +421,7 @@ telux::common::Status L2tpManagerStub::removeSession(uint32_t tunnelId,
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -484,11 +463,7 @@ telux::common::Status L2tpManagerStub::bindSessionToBackhaul(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -531,11 +506,7 @@ telux::common::Status L2tpManagerStub::unbindSessionFromBackhaul(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
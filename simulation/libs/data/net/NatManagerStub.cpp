@@ -6,6 +6,7 @@
 #include "NatManagerStub.hpp"
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include "DataUtilsStub.hpp"
 #include <thread>
 
@@ -101,11 +102,10 @@ void NatManagerStub::invokeCallback(telux::common::ResponseCallback callback,
     telux::common::ErrorCode error, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -190,11 +190,7 @@ telux::common::Status NatManagerStub::addStaticNatEntry(int profileId,
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -252,11 +248,7 @@ telux::common::Status NatManagerStub::addStaticNatEntry(const BackhaulInfo &bhIn
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -306,11 +298,7 @@ telux::common::Status NatManagerStub::removeStaticNatEntry(int profileId,
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -367,11 +355,7 @@ telux::common::Status NatManagerStub::removeStaticNatEntry(const BackhaulInfo &b
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -423,11 +407,10 @@ telux::common::Status NatManagerStub::requestStaticNatEntries(int profileId,
         }
 
         if (snatEntriesCb && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, snatEntries, snatEntriesCb, delay]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, error, snatEntries, snatEntriesCb]() {
                     snatEntriesCb(snatEntries, error);
-                }).share();
+                });
             taskQ_->add(f1);
         }
     }
@@ -487,11 +470,10 @@ telux::common::Status NatManagerStub::requestStaticNatEntries(const BackhaulInfo
         }
 
         if (snatEntriesCb && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, snatEntries, snatEntriesCb, delay]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, error, snatEntries, snatEntriesCb]() {
                     snatEntriesCb(snatEntries, error);
-                }).share();
+                });
             taskQ_->add(f1);
         }
     }
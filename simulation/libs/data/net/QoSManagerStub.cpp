@@ -9,6 +9,7 @@
 #include "QoSManagerStub.hpp"
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/SimulationConfigParser.hpp"
 #include "data/TrafficFilterImpl.hpp"
 
 using grpc::Channel;
@@ -27,6 +28,17 @@ QoSManagerStub::QoSManagerStub() {
     taskQ_ = std::make_shared<AsyncTaskQueue<void>>();
     listenerMgr_ = std::make_shared<telux::common::ListenerManager<IQoSListener>>();
     subSystemStatus_ = telux::common::ServiceStatus::SERVICE_UNAVAILABLE;
+    linkRateMbps_ = DEFAULT_LINK_RATE_MBPS;
+    auto config = std::make_shared<SimulationConfigParser>();
+    std::string linkRate = config->getValue("sim.data.qos_link_rate_mbps");
+    if (!linkRate.empty()) {
+        try {
+            linkRateMbps_ = static_cast<uint32_t>(std::stoul(linkRate));
+        } catch (const std::exception &e) {
+            LOG(ERROR, __FUNCTION__, " Invalid link rate ", linkRate);
+        }
+    }
+    shaper_ = std::unique_ptr<QoSShaper>(new QoSShaper(linkRateMbps_));
 }
 
 QoSManagerStub::~QoSManagerStub() {
@@ -134,45 +146,276 @@ void QoSManagerStub::onServiceStatusChange(ServiceStatus status) {
     }
 }
 
+bool QoSManagerStub::isServiceAvailable() {
+    std::lock_guard<std::mutex> lk(mtx_);
+    if (subSystemStatus_ != telux::common::ServiceStatus::SERVICE_AVAILABLE) {
+        LOG(ERROR, __FUNCTION__, " QoS manager is not ready");
+        return false;
+    }
+    return true;
+}
+
+uint32_t QoSManagerStub::getMinBandwidthLocked(Direction direction, TrafficClass exclude) {
+    uint32_t minBandwidth = 0;
+    for (auto &entry : trafficClasses_) {
+        if ((entry.first.second != direction) || (entry.first.first == exclude)) {
+            continue;
+        }
+        auto tcConfig = entry.second;
+        if (tcConfig->getTcConfigValidFields() & TcConfigValidField::TC_BANDWIDTH_CONFIG_VALID) {
+            minBandwidth +=
+                tcConfig->getBandwidthConfig().dlBandwidthValue.bandwidthRange.minBandwidth;
+        }
+    }
+    return minBandwidth;
+}
+
 telux::common::ErrorCode QoSManagerStub::addQoSFilter(
     QoSFilterConfig qosFilterConfig, QoSFilterHandle &filterHandle,
-    QoSFilterErrorCode &QoSFilterErrorCode) {
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    QoSFilterErrorCode &qosFilterErrorCode) {
+    LOG(DEBUG, __FUNCTION__);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    auto trafficFilter = qosFilterConfig.trafficFilter;
+    if (!trafficFilter) {
+        LOG(ERROR, __FUNCTION__, " traffic filter is missing");
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    TrafficFilterValidFields mask = trafficFilter->getTrafficFilterValidFields();
+    if (!(mask & TrafficFilterValidField::TF_DIRECTION_VALID)) {
+        qosFilterErrorCode = QoSFilterErrorCode::MISSING_DIRECTION;
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    // Only one of the address and VLAN list can identify each end of the traffic
+    int srcInfo = !!(mask & TrafficFilterValidField::TF_SOURCE_IPV4_ADDRESS_VALID)
+        + !!(mask & TrafficFilterValidField::TF_SOURCE_IPV6_ADDRESS_VALID)
+        + !!(mask & TrafficFilterValidField::TF_SOURCE_VLAN_LIST_VALID);
+    if (srcInfo > 1) {
+        qosFilterErrorCode = QoSFilterErrorCode::INVALID_MULTIPLE_SOURCE_INFO;
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    int destInfo = !!(mask & TrafficFilterValidField::TF_DESTINATION_IPV4_ADDRESS_VALID)
+        + !!(mask & TrafficFilterValidField::TF_DESTINATION_IPV6_ADDRESS_VALID)
+        + !!(mask & TrafficFilterValidField::TF_DESTINATION_VLAN_LIST_VALID);
+    if (destInfo > 1) {
+        qosFilterErrorCode = QoSFilterErrorCode::INVALID_MULTIPLE_DESTINATION_INFO;
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    qosFilterErrorCode = QoSFilterErrorCode::SUCCESS;
+
+    Direction direction = trafficFilter->getDirection();
+    std::lock_guard<std::mutex> lock(qosMtx_);
+    auto tc = trafficClasses_.find(std::make_pair(qosFilterConfig.trafficClass, direction));
+    if (tc == trafficClasses_.end()) {
+        LOG(ERROR, __FUNCTION__, " traffic class ", +qosFilterConfig.trafficClass,
+            " isn't created for the direction");
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    QoSFilterHandle handle = nextFilterHandle_;
+    if (!shaper_->addFilter(handle, qosFilterConfig.trafficClass, trafficFilter)) {
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    nextFilterHandle_++;
+
+    DataPath dataPath = tc->second->getDataPath();
+    QoSFilterStatus status;
+    status.ethStatus = (dataPath == DataPath::APPS_TO_WAN)
+        ? FilterInstallationStatus::NOT_APPLICABLE : FilterInstallationStatus::SUCCESS;
+    status.modemStatus = ((dataPath != DataPath::TETHERED_TO_APPS_SW)
+        && (direction == Direction::UPLINK))
+        ? FilterInstallationStatus::SUCCESS : FilterInstallationStatus::NOT_APPLICABLE;
+    status.ipaStatus = (dataPath == DataPath::TETHERED_TO_WAN_HW)
+        ? FilterInstallationStatus::SUCCESS : FilterInstallationStatus::NOT_APPLICABLE;
+
+    auto qosFilter = std::make_shared<QoSFilterImpl>();
+    qosFilter->setHandle(handle);
+    qosFilter->setTrafficClass(qosFilterConfig.trafficClass);
+    qosFilter->setTrafficFilter(trafficFilter);
+    qosFilter->setStatus(status);
+    qosFilters_[handle] = qosFilter;
+    filterHandle = handle;
+    LOG(DEBUG, __FUNCTION__, " added filter ", handle);
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode QoSManagerStub::getQosFilter(
     QoSFilterHandle filterHandle, std::shared_ptr<IQoSFilter> &qosFilter) {
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    std::lock_guard<std::mutex> lock(qosMtx_);
+    auto it = qosFilters_.find(filterHandle);
+    if (it == qosFilters_.end()) {
+        LOG(ERROR, __FUNCTION__, " no filter ", filterHandle);
+        return telux::common::ErrorCode::NO_SUCH_ELEMENT;
+    }
+    qosFilter = it->second;
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode QoSManagerStub::getQosFilters(
     std::vector<std::shared_ptr<IQoSFilter>> &qosFilter) {
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    std::lock_guard<std::mutex> lock(qosMtx_);
+    qosFilter.clear();
+    for (auto &entry : qosFilters_) {
+        qosFilter.push_back(entry.second);
+    }
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode QoSManagerStub::deleteQosFilter(
     uint32_t policyHandle) {
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    std::lock_guard<std::mutex> lock(qosMtx_);
+    if (!qosFilters_.erase(policyHandle)) {
+        LOG(ERROR, __FUNCTION__, " no filter ", policyHandle);
+        return telux::common::ErrorCode::NO_SUCH_ELEMENT;
+    }
+    shaper_->removeFilter(policyHandle);
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode QoSManagerStub::deleteAllQosConfigs() {
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    std::lock_guard<std::mutex> lock(qosMtx_);
+    qosFilters_.clear();
+    trafficClasses_.clear();
+    shaper_->clear();
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode QoSManagerStub::createTrafficClass(
     std::shared_ptr<ITcConfig> tcConfig,
     TcConfigErrorCode &tcConfigErrorCode) {
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    if (!tcConfig) {
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    TcConfigValidFields mask = tcConfig->getTcConfigValidFields();
+    if (!(mask & TcConfigValidField::TC_TRAFFIC_CLASS_VALID)) {
+        tcConfigErrorCode = TcConfigErrorCode::MISSING_TRAFFIC_CLASS;
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    if (!(mask & TcConfigValidField::TC_DATA_PATH_VALID)) {
+        tcConfigErrorCode = TcConfigErrorCode::MISSING_DATA_PATH;
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    if (!(mask & TcConfigValidField::TC_DIRECTION_VALID)) {
+        tcConfigErrorCode = TcConfigErrorCode::MISSING_DIRECTION;
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    tcConfigErrorCode = TcConfigErrorCode::SUCCESS;
+
+    TrafficClass trafficClass = tcConfig->getTrafficClass();
+    Direction direction = tcConfig->getDirection();
+    bool hasBandwidth = (mask & TcConfigValidField::TC_BANDWIDTH_CONFIG_VALID);
+    uint32_t minBandwidth = 0;
+    uint32_t maxBandwidth = 0;
+    if (hasBandwidth) {
+        BandwidthRange range = tcConfig->getBandwidthConfig().dlBandwidthValue.bandwidthRange;
+        minBandwidth = range.minBandwidth;
+        maxBandwidth = range.maxBandwidth;
+        if ((maxBandwidth != 0) && (minBandwidth > maxBandwidth)) {
+            LOG(ERROR, __FUNCTION__, " min bandwidth is above max bandwidth");
+            return telux::common::ErrorCode::INVALID_ARGUMENTS;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(qosMtx_);
+    // The minimum bandwidths of a direction are all assured out of the link
+    if (hasBandwidth && (linkRateMbps_ != 0) && (static_cast<uint64_t>(minBandwidth)
+        + getMinBandwidthLocked(direction, trafficClass) > linkRateMbps_)) {
+        LOG(ERROR, __FUNCTION__, " min bandwidths exceed the link rate ", linkRateMbps_);
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    // Creating an existing traffic class updates its config
+    trafficClasses_[std::make_pair(trafficClass, direction)] = tcConfig;
+    shaper_->addTrafficClass(trafficClass, direction, hasBandwidth, minBandwidth, maxBandwidth);
+    LOG(DEBUG, __FUNCTION__, tcConfig->toString());
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode QoSManagerStub::getAllTrafficClasses(
     std::vector<std::shared_ptr<ITcConfig>> &tcConfigs) {
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    std::lock_guard<std::mutex> lock(qosMtx_);
+    tcConfigs.clear();
+    for (auto &entry : trafficClasses_) {
+        tcConfigs.push_back(entry.second);
+    }
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode QoSManagerStub::deleteTrafficClass(
     std::shared_ptr<ITcConfig> tcConfig) {
-    return telux::common::ErrorCode::NOT_SUPPORTED;
+    LOG(DEBUG, __FUNCTION__);
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    if (!tcConfig) {
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    TcConfigValidFields mask = tcConfig->getTcConfigValidFields();
+    if (!(mask & TcConfigValidField::TC_TRAFFIC_CLASS_VALID)
+        || !(mask & TcConfigValidField::TC_DIRECTION_VALID)) {
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    TrafficClass trafficClass = tcConfig->getTrafficClass();
+    Direction direction = tcConfig->getDirection();
+
+    std::lock_guard<std::mutex> lock(qosMtx_);
+    if (!trafficClasses_.erase(std::make_pair(trafficClass, direction))) {
+        LOG(ERROR, __FUNCTION__, " no traffic class ", +trafficClass);
+        return telux::common::ErrorCode::NO_SUCH_ELEMENT;
+    }
+    // The filters steering traffic to the class go away with it
+    for (auto it = qosFilters_.begin(); it != qosFilters_.end();) {
+        if ((it->second->getTrafficClass() == trafficClass)
+            && (it->second->getTrafficFilter()->getDirection() == direction)) {
+            shaper_->removeFilter(it->first);
+            it = qosFilters_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    shaper_->removeTrafficClass(trafficClass, direction);
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode QoSManagerStub::meterPacket(
+    const QoSPacket &packet, QoSPacketResult &result) {
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    shaper_->meter(packet, result);
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode QoSManagerStub::shapePacket(
+    const QoSPacket &packet, QoSPacketResult &result) {
+    if (!isServiceAvailable()) {
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+    shaper_->shape(packet, result);
+    return telux::common::ErrorCode::SUCCESS;
 }
 
 uint32_t QoSFilterImpl::getHandle() {
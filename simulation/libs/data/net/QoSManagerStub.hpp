@@ -6,12 +6,16 @@
  #ifndef QOS_MANAGER_STUB_HPP
  #define QOS_MANAGER_STUB_HPP
 
+#include <map>
+#include <utility>
+
 #include <telux/data/net/QoSManager.hpp>
 #include <telux/common/CommonDefines.hpp>
 
 #include "common/AsyncTaskQueue.hpp"
 #include "common/ListenerManager.hpp"
 #include "protos/proto-src/data_simulation.grpc.pb.h"
+#include "QoSShaper.hpp"
 
 namespace telux {
 namespace data {
@@ -95,7 +99,20 @@ public:
 
     telux::common::ErrorCode deleteTrafficClass(std::shared_ptr<ITcConfig> tcConfig) override;
 
+    /**
+     * Simulation only, meters a packet against the traffic classes and filters in place.
+     * Packet streams are run through it and shapePacket with the telsdk_qos_shaper tool.
+     */
+    telux::common::ErrorCode meterPacket(const QoSPacket &packet, QoSPacketResult &result);
+
+    /**
+     * Simulation only, computes when a packet leaves the traffic class it is classified in.
+     */
+    telux::common::ErrorCode shapePacket(const QoSPacket &packet, QoSPacketResult &result);
+
 private:
+    static const uint32_t DEFAULT_LINK_RATE_MBPS = 1000;
+
     std::mutex mtx_;
     std::mutex initMtx_;
 
@@ -105,10 +122,20 @@ private:
     telux::common::InitResponseCb initCb_;
     std::shared_ptr<telux::common::ListenerManager<IQoSListener>> listenerMgr_;
 
+    /* Guards the QoS configuration below */
+    std::mutex qosMtx_;
+    uint32_t linkRateMbps_;
+    QoSFilterHandle nextFilterHandle_ = 1;
+    std::map<std::pair<TrafficClass, Direction>, std::shared_ptr<ITcConfig>> trafficClasses_;
+    std::map<QoSFilterHandle, std::shared_ptr<QoSFilterImpl>> qosFilters_;
+    std::unique_ptr<QoSShaper> shaper_;
+
     void initSync(telux::common::InitResponseCb callback);
     void setSubSystemStatus(telux::common::ServiceStatus status);
     void invokeInitCallback(telux::common::ServiceStatus status);
     void onServiceStatusChange(ServiceStatus status);
+    bool isServiceAvailable();
+    uint32_t getMinBandwidthLocked(Direction direction, TrafficClass exclude);
 };
 
 } // end of namespace net
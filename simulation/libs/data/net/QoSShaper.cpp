@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "QoSShaper.hpp"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "common/Logger.hpp"
+
+#define IPV4_ADDR_BITS 32
+#define IPV6_ADDR_BITS 128
+#define ANY_PROTOCOL 0x100
+
+namespace telux {
+namespace data {
+namespace net {
+
+void QoSShaper::TokenBucket::setRate(bool unlimited, double mbps) {
+    isUnlimited = unlimited;
+    // 1 Mbps is 1/8 byte per microsecond
+    bytesPerUs = unlimited ? 0 : (mbps / 8);
+    depth = (bytesPerUs > 0)
+        ? std::max(static_cast<double>(MIN_BURST_BYTES), bytesPerUs * BURST_US) : 0;
+    tokens = depth;
+}
+
+void QoSShaper::TokenBucket::refill(uint64_t nowUs) {
+    if (isUnlimited || (nowUs <= lastUs)) {
+        return;
+    }
+    tokens = std::min(depth, tokens + (nowUs - lastUs) * bytesPerUs);
+    lastUs = nowUs;
+}
+
+uint64_t QoSShaper::TokenBucket::readyAt(uint64_t nowUs, uint32_t length) const {
+    if (isUnlimited) {
+        return nowUs;
+    }
+    if (bytesPerUs <= 0) {
+        return UINT64_MAX;
+    }
+    uint64_t startUs = std::max(nowUs, lastUs);
+    double available = std::min(depth, tokens + (startUs - lastUs) * bytesPerUs);
+    // Packets larger than the bucket are sent on a full bucket and leave it in debt
+    double needed = std::min(depth, static_cast<double>(length));
+    if (available >= needed) {
+        return startUs;
+    }
+    return startUs + static_cast<uint64_t>(std::ceil((needed - available) / bytesPerUs));
+}
+
+void QoSShaper::TokenBucket::consume(uint32_t length) {
+    if (!isUnlimited) {
+        tokens -= length;
+    }
+}
+
+QoSShaper::QoSShaper(uint32_t linkRateMbps)
+   : linkRateMbps_(linkRateMbps) {
+    LOG(DEBUG, __FUNCTION__, " link rate Mbps::", linkRateMbps);
+    updateRootRate(Direction::UPLINK);
+    updateRootRate(Direction::DOWNLINK);
+}
+
+void QoSShaper::updateRootRate(Direction direction) {
+    TokenBucket &root = roots_[direction];
+    if (linkRateMbps_ <= 0) {
+        root.setRate(true, 0);
+        return;
+    }
+    double spareMbps = linkRateMbps_;
+    for (auto &entry : classes_) {
+        if ((entry.first.second == direction) && entry.second.hasBandwidth) {
+            spareMbps -= entry.second.minMbps;
+        }
+    }
+    root.setRate(false, std::max(0.0, spareMbps));
+}
+
+void QoSShaper::addTrafficClass(TrafficClass trafficClass, Direction direction,
+    bool hasBandwidth, uint32_t minBandwidthMbps, uint32_t maxBandwidthMbps) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ClassState &state = classes_[ClassKey(trafficClass, direction)];
+    state = ClassState();
+    state.hasBandwidth = hasBandwidth;
+    if (hasBandwidth) {
+        state.minMbps = minBandwidthMbps;
+        state.assured.setRate(false, minBandwidthMbps);
+        // No maximum means the class can take all the spare bandwidth
+        state.ceil.setRate(maxBandwidthMbps == 0,
+            std::max(minBandwidthMbps, maxBandwidthMbps));
+    }
+    updateRootRate(direction);
+}
+
+void QoSShaper::removeTrafficClass(TrafficClass trafficClass, Direction direction) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (classes_.erase(ClassKey(trafficClass, direction))) {
+        updateRootRate(direction);
+    }
+}
+
+uint32_t QoSShaper::getFilterKey(Direction direction, bool hasProtocol, IpProtocol protocol) {
+    return (static_cast<uint32_t>(direction) << 9) | (hasProtocol ? protocol : ANY_PROTOCOL);
+}
+
+bool QoSShaper::parsePrefix(const std::string &text, Prefix &prefix) {
+    std::string addr = text;
+    std::string length;
+    size_t pos = text.find('/');
+    if (pos != std::string::npos) {
+        addr = text.substr(0, pos);
+        length = text.substr(pos + 1);
+    }
+    int maxLength = 0;
+    if (inet_pton(AF_INET, addr.c_str(), prefix.addr) == 1) {
+        prefix.family = AF_INET;
+        maxLength = IPV4_ADDR_BITS;
+    } else if (inet_pton(AF_INET6, addr.c_str(), prefix.addr) == 1) {
+        prefix.family = AF_INET6;
+        maxLength = IPV6_ADDR_BITS;
+    } else {
+        return false;
+    }
+    prefix.length = maxLength;
+    if (!length.empty()) {
+        char *end = nullptr;
+        long value = std::strtol(length.c_str(), &end, 10);
+        if ((*end != '\0') || (value < 0) || (value > maxLength)) {
+            return false;
+        }
+        prefix.length = static_cast<int>(value);
+    }
+    return true;
+}
+
+bool QoSShaper::matchPrefix(const Prefix &prefix, int family, const uint8_t *addr) {
+    if (prefix.family == 0) {
+        return true;
+    }
+    if (prefix.family != family) {
+        return false;
+    }
+    int bytes = prefix.length / 8;
+    if (std::memcmp(prefix.addr, addr, bytes) != 0) {
+        return false;
+    }
+    int bits = prefix.length % 8;
+    if (bits == 0) {
+        return true;
+    }
+    uint8_t mask = static_cast<uint8_t>(0xFF << (8 - bits));
+    return (prefix.addr[bytes] & mask) == (addr[bytes] & mask);
+}
+
+bool QoSShaper::compileFilter(QoSFilterHandle handle, TrafficClass trafficClass,
+    std::shared_ptr<ITrafficFilter> filter, CompiledFilter &compiled, uint32_t &key) {
+    TrafficFilterValidFields mask = filter->getTrafficFilterValidFields();
+    if (!(mask & TrafficFilterValidField::TF_DIRECTION_VALID)) {
+        return false;
+    }
+    compiled.handle = handle;
+    compiled.trafficClass = trafficClass;
+
+    if (mask & TrafficFilterValidField::TF_SOURCE_IPV4_ADDRESS_VALID) {
+        if (!parsePrefix(filter->getIPv4Address(FieldType::SOURCE), compiled.src)) {
+            return false;
+        }
+    } else if (mask & TrafficFilterValidField::TF_SOURCE_IPV6_ADDRESS_VALID) {
+        if (!parsePrefix(filter->getIPv6Address(FieldType::SOURCE), compiled.src)) {
+            return false;
+        }
+    }
+    if (mask & TrafficFilterValidField::TF_DESTINATION_IPV4_ADDRESS_VALID) {
+        if (!parsePrefix(filter->getIPv4Address(FieldType::DESTINATION), compiled.dest)) {
+            return false;
+        }
+    } else if (mask & TrafficFilterValidField::TF_DESTINATION_IPV6_ADDRESS_VALID) {
+        if (!parsePrefix(filter->getIPv6Address(FieldType::DESTINATION), compiled.dest)) {
+            return false;
+        }
+    }
+
+    uint16_t startPort = 0;
+    uint16_t range = 0;
+    if (mask & TrafficFilterValidField::TF_SOURCE_PORT_VALID) {
+        compiled.srcPortMin = compiled.srcPortMax = filter->getPort(FieldType::SOURCE);
+    } else if (mask & TrafficFilterValidField::TF_SOURCE_PORT_RANGE_VALID) {
+        filter->getPortRange(FieldType::SOURCE, startPort, range);
+        compiled.srcPortMin = startPort;
+        compiled.srcPortMax = static_cast<uint16_t>(
+            std::min<uint32_t>(UINT16_MAX, static_cast<uint32_t>(startPort) + range));
+    }
+    if (mask & TrafficFilterValidField::TF_DESTINATION_PORT_VALID) {
+        compiled.destPortMin = compiled.destPortMax = filter->getPort(FieldType::DESTINATION);
+    } else if (mask & TrafficFilterValidField::TF_DESTINATION_PORT_RANGE_VALID) {
+        filter->getPortRange(FieldType::DESTINATION, startPort, range);
+        compiled.destPortMin = startPort;
+        compiled.destPortMax = static_cast<uint16_t>(
+            std::min<uint32_t>(UINT16_MAX, static_cast<uint32_t>(startPort) + range));
+    }
+
+    if (mask & TrafficFilterValidField::TF_SOURCE_VLAN_LIST_VALID) {
+        compiled.srcVlans = filter->getVlanList(FieldType::SOURCE);
+    }
+    if (mask & TrafficFilterValidField::TF_DESTINATION_VLAN_LIST_VALID) {
+        compiled.destVlans = filter->getVlanList(FieldType::DESTINATION);
+    }
+    if (mask & TrafficFilterValidField::TF_PCP_VALID) {
+        compiled.hasPcp = true;
+        compiled.pcp = filter->getPCP();
+    }
+
+    bool hasProtocol = (mask & TrafficFilterValidField::TF_IP_PROTOCOL_VALID);
+    key = getFilterKey(filter->getDirection(), hasProtocol,
+        hasProtocol ? filter->getIPProtocol() : 0);
+    return true;
+}
+
+bool QoSShaper::addFilter(QoSFilterHandle handle, TrafficClass trafficClass,
+    std::shared_ptr<ITrafficFilter> filter) {
+    CompiledFilter compiled;
+    uint32_t key = 0;
+    if (!filter || !compileFilter(handle, trafficClass, filter, compiled, key)) {
+        LOG(ERROR, __FUNCTION__, " can't compile filter ", handle);
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<CompiledFilter> &filters = classifier_[key];
+    auto pos = std::upper_bound(filters.begin(), filters.end(), handle,
+        [](QoSFilterHandle value, const CompiledFilter &entry) {
+            return value < entry.handle;
+        });
+    filters.insert(pos, compiled);
+    filterKeys_[handle] = key;
+    flowCache_.clear();
+    return true;
+}
+
+void QoSShaper::removeFilter(QoSFilterHandle handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = filterKeys_.find(handle);
+    if (it == filterKeys_.end()) {
+        return;
+    }
+    std::vector<CompiledFilter> &filters = classifier_[it->second];
+    filters.erase(std::remove_if(filters.begin(), filters.end(),
+        [handle](const CompiledFilter &entry) {
+            return entry.handle == handle;
+        }), filters.end());
+    if (filters.empty()) {
+        classifier_.erase(it->second);
+    }
+    filterKeys_.erase(it);
+    flowCache_.clear();
+}
+
+void QoSShaper::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    classes_.clear();
+    classifier_.clear();
+    filterKeys_.clear();
+    flowCache_.clear();
+    updateRootRate(Direction::UPLINK);
+    updateRootRate(Direction::DOWNLINK);
+}
+
+bool QoSShaper::matches(const CompiledFilter &filter, const QoSPacket &packet, int srcFamily,
+    const uint8_t *srcAddr, int destFamily, const uint8_t *destAddr) {
+    if (!matchPrefix(filter.src, srcFamily, srcAddr)
+        || !matchPrefix(filter.dest, destFamily, destAddr)) {
+        return false;
+    }
+    if ((packet.srcPort < filter.srcPortMin) || (packet.srcPort > filter.srcPortMax)
+        || (packet.destPort < filter.destPortMin) || (packet.destPort > filter.destPortMax)) {
+        return false;
+    }
+    if (!filter.srcVlans.empty() && (std::find(filter.srcVlans.begin(),
+        filter.srcVlans.end(), packet.vlanId) == filter.srcVlans.end())) {
+        return false;
+    }
+    if (!filter.destVlans.empty() && (std::find(filter.destVlans.begin(),
+        filter.destVlans.end(), packet.vlanId) == filter.destVlans.end())) {
+        return false;
+    }
+    return !filter.hasPcp || (filter.pcp == packet.pcp);
+}
+
+std::string QoSShaper::getFlowKey(const QoSPacket &packet) {
+    return std::to_string(static_cast<int>(packet.direction)) + "|"
+        + std::to_string(packet.protocol) + "|" + packet.srcAddr + "|" + packet.destAddr
+        + "|" + std::to_string(packet.srcPort) + "|" + std::to_string(packet.destPort) + "|"
+        + std::to_string(packet.vlanId) + "|" + std::to_string(packet.pcp);
+}
+
+QoSShaper::Match QoSShaper::classify(const QoSPacket &packet) {
+    std::string flowKey = getFlowKey(packet);
+    auto cached = flowCache_.find(flowKey);
+    if (cached != flowCache_.end()) {
+        return cached->second;
+    }
+
+    uint8_t srcAddr[16] = {};
+    uint8_t destAddr[16] = {};
+    int srcFamily = 0;
+    int destFamily = 0;
+    if (inet_pton(AF_INET, packet.srcAddr.c_str(), srcAddr) == 1) {
+        srcFamily = AF_INET;
+    } else if (inet_pton(AF_INET6, packet.srcAddr.c_str(), srcAddr) == 1) {
+        srcFamily = AF_INET6;
+    }
+    if (inet_pton(AF_INET, packet.destAddr.c_str(), destAddr) == 1) {
+        destFamily = AF_INET;
+    } else if (inet_pton(AF_INET6, packet.destAddr.c_str(), destAddr) == 1) {
+        destFamily = AF_INET6;
+    }
+
+    // The filters of the packet protocol and the ones for any protocol are both candidates,
+    // the first installed filter wins
+    Match match;
+    const uint32_t keys[] = {getFilterKey(packet.direction, true, packet.protocol),
+        getFilterKey(packet.direction, false, 0)};
+    for (uint32_t key : keys) {
+        auto it = classifier_.find(key);
+        if (it == classifier_.end()) {
+            continue;
+        }
+        for (const CompiledFilter &filter : it->second) {
+            if (match.isMatched && (filter.handle > match.handle)) {
+                break;
+            }
+            if (matches(filter, packet, srcFamily, srcAddr, destFamily, destAddr)) {
+                match.isMatched = true;
+                match.handle = filter.handle;
+                match.trafficClass = filter.trafficClass;
+                break;
+            }
+        }
+    }
+
+    if (flowCache_.size() >= MAX_FLOW_CACHE_SIZE) {
+        flowCache_.clear();
+    }
+    flowCache_[flowKey] = match;
+    return match;
+}
+
+QoSShaper::ClassState *QoSShaper::getClass(const Match &match, Direction direction) {
+    if (!match.isMatched) {
+        return nullptr;
+    }
+    auto it = classes_.find(ClassKey(match.trafficClass, direction));
+    return (it == classes_.end()) ? nullptr : &it->second;
+}
+
+void QoSShaper::meter(const QoSPacket &packet, QoSPacketResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Match match = classify(packet);
+    result = QoSPacketResult();
+    result.isClassified = match.isMatched;
+    result.filterHandle = match.handle;
+    result.trafficClass = match.trafficClass;
+    result.departureUs = packet.timestampUs;
+
+    ClassState *state = getClass(match, packet.direction);
+    if (!state || !state->hasBandwidth) {
+        return;
+    }
+    uint64_t nowUs = packet.timestampUs;
+    TokenBucket &root = roots_[packet.direction];
+    if (state->ceil.readyAt(nowUs, packet.length) > nowUs) {
+        result.verdict = QoSVerdict::EXCEED;
+        return;
+    }
+    TokenBucket *used = nullptr;
+    if (state->assured.readyAt(nowUs, packet.length) <= nowUs) {
+        result.verdict = QoSVerdict::CONFORM;
+        used = &state->assured;
+    } else if (root.readyAt(nowUs, packet.length) <= nowUs) {
+        result.verdict = QoSVerdict::BORROW;
+        used = &root;
+    } else {
+        result.verdict = QoSVerdict::EXCEED;
+        return;
+    }
+    state->ceil.refill(nowUs);
+    state->ceil.consume(packet.length);
+    used->refill(nowUs);
+    used->consume(packet.length);
+}
+
+void QoSShaper::shape(const QoSPacket &packet, QoSPacketResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Match match = classify(packet);
+    result = QoSPacketResult();
+    result.isClassified = match.isMatched;
+    result.filterHandle = match.handle;
+    result.trafficClass = match.trafficClass;
+    result.departureUs = packet.timestampUs;
+
+    ClassState *state = getClass(match, packet.direction);
+    if (!state || !state->hasBandwidth) {
+        return;
+    }
+    // A packet can't leave before the earlier packets of its class
+    uint64_t startUs = std::max(packet.timestampUs, state->lastDepartureUs);
+    TokenBucket &root = roots_[packet.direction];
+    uint64_t ceilUs = state->ceil.readyAt(startUs, packet.length);
+    uint64_t assuredUs = state->assured.readyAt(startUs, packet.length);
+    uint64_t rootUs = root.readyAt(startUs, packet.length);
+    bool isAssured = (assuredUs <= rootUs);
+    uint64_t departureUs = std::max(ceilUs, isAssured ? assuredUs : rootUs);
+    if (departureUs == UINT64_MAX) {
+        result.verdict = QoSVerdict::EXCEED;
+        result.departureUs = UINT64_MAX;
+        return;
+    }
+    TokenBucket &used = isAssured ? state->assured : root;
+    state->ceil.refill(departureUs);
+    state->ceil.consume(packet.length);
+    used.refill(departureUs);
+    used.consume(packet.length);
+    state->lastDepartureUs = departureUs;
+    result.verdict = isAssured ? QoSVerdict::CONFORM : QoSVerdict::BORROW;
+    result.departureUs = departureUs;
+}
+
+} // end of namespace net
+} // end of namespace data
+} // end of namespace telux
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       QoSShaper.hpp
+ *
+ * @brief      QoSShaper simulates the QoS configuration of the QoS manager on packet
+ *             streams supplied by the caller. The filters are compiled into a classifier
+ *             which maps a packet to a traffic class. Each shaped traffic class has an
+ *             assured bucket refilled at its minimum bandwidth and a ceil bucket refilled
+ *             at its maximum bandwidth, and borrows the link bandwidth not assured to any
+ *             class from a root bucket of its direction.
+ *             Time is taken from the packet timestamps so that results are reproducible.
+ */
+
+#ifndef QOS_SHAPER_HPP
+#define QOS_SHAPER_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <telux/data/net/QoSManager.hpp>
+
+namespace telux {
+namespace data {
+namespace net {
+
+/**
+ * Packet submitted to the QoS simulation.
+ */
+struct QoSPacket {
+    Direction direction = Direction::UPLINK;
+    IpProtocol protocol = 0;
+    std::string srcAddr;      /**< IPv4 or IPv6 address, empty if unknown */
+    std::string destAddr;
+    uint16_t srcPort = 0;
+    uint16_t destPort = 0;
+    int vlanId = -1;          /**< -1 for untagged packets */
+    int8_t pcp = 0;
+    uint32_t length = 0;      /**< Bytes */
+    uint64_t timestampUs = 0; /**< Arrival time in microseconds */
+};
+
+enum class QoSVerdict {
+    CONFORM, /**< Within the assured bandwidth of the traffic class */
+    BORROW,  /**< Above the assured bandwidth, served by the spare link bandwidth */
+    EXCEED,  /**< Above the bandwidth the traffic class can get at this time */
+};
+
+struct QoSPacketResult {
+    bool isClassified = false;
+    QoSFilterHandle filterHandle = IQoSFilter::INVALID_HANDLE;
+    TrafficClass trafficClass = 0;
+    QoSVerdict verdict = QoSVerdict::CONFORM;
+    uint64_t departureUs = 0; /**< Time at which the packet leaves the shaper */
+};
+
+class QoSShaper {
+ public:
+    /**
+     * @param [in] linkRateMbps  Bandwidth of the link shared by the traffic classes of a
+     *                           direction, 0 if unlimited
+     */
+    QoSShaper(uint32_t linkRateMbps);
+
+    /**
+     * Adds or replaces a traffic class. A class without bandwidth config isn't shaped.
+     */
+    void addTrafficClass(TrafficClass trafficClass, Direction direction, bool hasBandwidth,
+        uint32_t minBandwidthMbps, uint32_t maxBandwidthMbps);
+
+    void removeTrafficClass(TrafficClass trafficClass, Direction direction);
+
+    /**
+     * Compiles the filter into the classifier.
+     *
+     * @returns false if the filter has no direction or an address can't be parsed
+     */
+    bool addFilter(QoSFilterHandle handle, TrafficClass trafficClass,
+        std::shared_ptr<ITrafficFilter> filter);
+
+    void removeFilter(QoSFilterHandle handle);
+
+    void clear();
+
+    /**
+     * Marks the packet against the buckets of its traffic class without delaying it.
+     * Packets found to exceed don't consume tokens.
+     */
+    void meter(const QoSPacket &packet, QoSPacketResult &result);
+
+    /**
+     * Queues the packet behind the earlier packets of its traffic class and computes its
+     * departure time. The verdict tells whether the packet was served by the assured or
+     * the borrowed bandwidth. Unclassified packets leave on arrival. A packet that can't
+     * ever be sent exceeds and departs at UINT64_MAX.
+     */
+    void shape(const QoSPacket &packet, QoSPacketResult &result);
+
+ private:
+    static const uint64_t BURST_US = 10000;
+    static const uint32_t MIN_BURST_BYTES = 65535;
+    static const size_t MAX_FLOW_CACHE_SIZE = 4096;
+
+    struct TokenBucket {
+        bool isUnlimited = true;
+        double bytesPerUs = 0;
+        double depth = 0;
+        double tokens = 0;
+        uint64_t lastUs = 0;
+
+        void setRate(bool unlimited, double mbps);
+        void refill(uint64_t nowUs);
+        uint64_t readyAt(uint64_t nowUs, uint32_t length) const;
+        void consume(uint32_t length);
+    };
+
+    struct ClassState {
+        bool hasBandwidth = false;
+        double minMbps = 0;
+        TokenBucket assured;
+        TokenBucket ceil;
+        uint64_t lastDepartureUs = 0;
+    };
+
+    struct Prefix {
+        int family = 0; /**< AF_INET, AF_INET6 or 0 for any address */
+        uint8_t addr[16] = {};
+        int length = 0;
+    };
+
+    struct CompiledFilter {
+        QoSFilterHandle handle = IQoSFilter::INVALID_HANDLE;
+        TrafficClass trafficClass = 0;
+        Prefix src;
+        Prefix dest;
+        uint16_t srcPortMin = 0;
+        uint16_t srcPortMax = UINT16_MAX;
+        uint16_t destPortMin = 0;
+        uint16_t destPortMax = UINT16_MAX;
+        std::vector<int> srcVlans; /**< Empty for any VLAN */
+        std::vector<int> destVlans;
+        bool hasPcp = false;
+        int8_t pcp = 0;
+    };
+
+    struct Match {
+        bool isMatched = false;
+        QoSFilterHandle handle = IQoSFilter::INVALID_HANDLE;
+        TrafficClass trafficClass = 0;
+    };
+
+    using ClassKey = std::pair<TrafficClass, Direction>;
+
+    static bool compileFilter(QoSFilterHandle handle, TrafficClass trafficClass,
+        std::shared_ptr<ITrafficFilter> filter, CompiledFilter &compiled, uint32_t &key);
+    static bool parsePrefix(const std::string &text, Prefix &prefix);
+    static bool matchPrefix(const Prefix &prefix, int family, const uint8_t *addr);
+    static bool matches(const CompiledFilter &filter, const QoSPacket &packet, int srcFamily,
+        const uint8_t *srcAddr, int destFamily, const uint8_t *destAddr);
+    static uint32_t getFilterKey(Direction direction, bool hasProtocol, IpProtocol protocol);
+    static std::string getFlowKey(const QoSPacket &packet);
+
+    void updateRootRate(Direction direction);
+    Match classify(const QoSPacket &packet);
+    ClassState *getClass(const Match &match, Direction direction);
+
+    std::mutex mutex_;
+    double linkRateMbps_;
+    std::map<ClassKey, ClassState> classes_;
+    std::map<Direction, TokenBucket> roots_;
+    /* Compiled filters by direction and protocol (or any protocol), in handle order */
+    std::unordered_map<uint32_t, std::vector<CompiledFilter>> classifier_;
+    std::map<QoSFilterHandle, uint32_t> filterKeys_;
+    /* Classification of the recent flows, cleared whenever the filters change */
+    std::unordered_map<std::string, Match> flowCache_;
+};
+
+} // end of namespace net
+} // end of namespace data
+} // end of namespace telux
+
+#endif // QOS_SHAPER_HPP
@@ -9,6 +9,7 @@
 #include "VlanManagerStub.hpp"
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include "libs/data/DataUtilsStub.hpp"
 
 using grpc::Channel;
@@ -103,11 +104,10 @@ void VlanManagerStub::invokeCallback(telux::common::ResponseCallback callback,
     telux::common::ErrorCode error, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -222,11 +222,10 @@ telux::common::Status VlanManagerStub::createVlan(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay, isAccelerated]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, error, callback, isAccelerated]() {
                     callback(isAccelerated, error);
-                }).share();
+                });
             taskQ_->add(f1);
         }
     }
@@ -267,11 +266,7 @@ telux::common::Status VlanManagerStub::removeVlan(int16_t vlanId,
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -370,11 +365,7 @@ telux::common::Status VlanManagerStub::bindToBackhaul(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -417,11 +408,7 @@ telux::common::Status VlanManagerStub::unbindFromBackhaul(
         }
 
         if (callback && (delay != SKIP_CALLBACK)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error, delay);
         }
     }
 
@@ -38,6 +38,7 @@
 #include "common/CommonUtils.hpp"
 #include "LocationDefinesStub.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 
 //Default cb delay.
 #define DEFAULT_CALLBACK_DELAY 100
@@ -170,12 +171,11 @@ telux::common::Status LocationConfiguratorStub::configureCTunc(bool enable,
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -199,12 +199,11 @@ telux::common::Status LocationConfiguratorStub::configurePACE(bool enable,
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -227,12 +226,11 @@ telux::common::Status LocationConfiguratorStub::deleteAllAidingData(telux::commo
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -273,12 +271,11 @@ telux::common::Status LocationConfiguratorStub::configureLeverArm(const LeverArm
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -309,12 +306,11 @@ telux::common::Status LocationConfiguratorStub::configureConstellations(const Sv
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -339,12 +335,11 @@ telux::common::Status LocationConfiguratorStub::configureRobustLocation(bool ena
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -377,12 +372,11 @@ telux::common::Status LocationConfiguratorStub::requestRobustLocation(
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (cb && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             cb(rLConfig, errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -407,12 +401,11 @@ telux::common::Status LocationConfiguratorStub::configureMinGpsWeek(uint16_t min
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -436,12 +429,11 @@ telux::common::Status LocationConfiguratorStub::requestMinGpsWeek(GetMinGpsWeekC
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (cb && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             cb(minGpsWeek, errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -465,12 +457,11 @@ telux::common::Status LocationConfiguratorStub::configureMinSVElevation(uint8_t
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -494,12 +485,11 @@ telux::common::Status LocationConfiguratorStub::requestMinSVElevation(GetMinSVEl
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (cb && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             cb(minSVElevation, errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -527,12 +517,11 @@ telux::common::Status LocationConfiguratorStub::configureSecondaryBand(const Con
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -577,12 +566,11 @@ telux::common::Status LocationConfiguratorStub::requestSecondaryBandConfig(GetSe
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (cb && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             cb(set, errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -606,12 +594,11 @@ telux::common::Status LocationConfiguratorStub::deleteAidingData(AidingData aidi
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -644,12 +631,11 @@ telux::common::Status LocationConfiguratorStub::configureDR(const DREngineConfig
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -674,12 +660,11 @@ telux::common::Status LocationConfiguratorStub::configureEngineState(const Engin
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -703,12 +688,11 @@ telux::common::Status LocationConfiguratorStub::provideConsentForTerrestrialPosi
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -732,12 +716,11 @@ telux::common::Status LocationConfiguratorStub::configureNmeaTypes(
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -767,12 +750,11 @@ telux::common::Status LocationConfiguratorStub::configureNmea(const NmeaConfig c
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -798,12 +780,11 @@ telux::common::Status LocationConfiguratorStub::configureEngineIntegrityRisk(
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -856,12 +837,11 @@ telux::common::Status LocationConfiguratorStub::configureXtraParams(bool enable,
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -899,12 +879,11 @@ telux::common::Status LocationConfiguratorStub::requestXtraStatus(GetXtraStatusC
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (cb && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             cb(xtraStatus, errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -949,9 +928,8 @@ telux::common::Status LocationConfiguratorStub::registerListener(
     if(reqstatus.ok()) {
         status = telux::common::Status::SUCCESS;
     }
-    auto f = std::async(std::launch::async, [=]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(400));
-    }).share();
+    auto f = telux::common::TimerService::getInstance()->runAfter(400, [=]() {
+    });
     taskQ_.add(f);
     return status;
 }
@@ -1074,12 +1052,11 @@ telux::common::Status LocationConfiguratorStub::injectMerkleTreeInformation(
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -1103,12 +1080,11 @@ telux::common::Status LocationConfiguratorStub::configureOsnma(bool enable,
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -1132,12 +1108,11 @@ telux::common::Status LocationConfiguratorStub::provideConsentForXtra(bool userC
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
 
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
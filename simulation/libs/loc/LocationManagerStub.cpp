@@ -39,9 +39,11 @@
 #include "common/CommonUtils.hpp"
 #include "common/SimulationConfigParser.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 
 #include <chrono>
 #include <string>
+#include <unistd.h>
 
 //Default cb delay.
 #define DEFAULT_CALLBACK_DELAY 100
@@ -179,6 +181,15 @@ telux::common::Status LocationManagerStub::deRegisterListenerEx(std::weak_ptr<IL
     return (retVal);
 }
 
+void LocationManagerStub::fillStartReportsRequest(::locStub::StartReportsRequest &request,
+    uint32_t interval, LocReqEngine engineMask) {
+    // The server decimates the location reports to the interval, the report stream of the
+    // process is identified by its pid
+    request.set_client_id(getpid());
+    request.set_interval((filter_ != nullptr) ? interval : 0);
+    request.set_engine_mask(static_cast<uint32_t>(engineMask));
+}
+
 void LocationManagerStub::adjustTimeInterval(uint32_t &interval) {
     //If multiple position sessions are started in a process, requesting for different time
     //intervals, the filtering logic usually passes the client requested interval to the lower
@@ -205,7 +216,8 @@ telux::common::Status LocationManagerStub::startDetailedReports(uint32_t interva
     std::vector<std::string> filters = {"LOC_REPORTS"};
     auto &locationReportListener = telux::common::LocationReportListener::getInstance();
     locationReportListener.registerListener(myselfForReports_, filters);
-    const ::google::protobuf::Empty request;
+    ::locStub::StartReportsRequest request;
+    fillStartReportsRequest(request, interval, LocReqEngineType::LOC_REQ_ENGINE_FUSED_BIT);
     ::locStub::LocManagerCommandReply response;
     ClientContext context;
     telux::common::Status status = telux::common::Status::FAILED;
@@ -220,12 +232,11 @@ telux::common::Status LocationManagerStub::startDetailedReports(uint32_t interva
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
     if (status == telux::common::Status::SUCCESS) {
-        auto f = std::async(std::launch::async, [=]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
             if (callback && (cbDelay != SKIP_CALLBACK)) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(errorCode);
             }
-        }).share();
+        });
         taskQ_.add(f);
         if (filter_ != nullptr) {
             telux::common::Status rc = filter_->startReportFilter(interval, ReportType::FUSED);
@@ -248,11 +259,16 @@ telux::common::Status LocationManagerStub::startDetailedEngineReports(uint32_t i
     }
     interval_ = interval;
     engineType_ = engineType;
+    // Without filtering, the reports of all the engines are delivered
+    LocReqEngine engineMask = (filter_ != nullptr) ? engineType
+        : (LocReqEngineType::LOC_REQ_ENGINE_FUSED_BIT | LocReqEngineType::LOC_REQ_ENGINE_SPE_BIT
+        | LocReqEngineType::LOC_REQ_ENGINE_PPE_BIT | LocReqEngineType::LOC_REQ_ENGINE_VPE_BIT);
     //Register for Reports.
     std::vector<std::string> filters = {"LOC_REPORTS"};
     auto &locationReportListener = telux::common::LocationReportListener::getInstance();
     locationReportListener.registerListener(myselfForReports_, filters);
-    const ::google::protobuf::Empty request;
+    ::locStub::StartReportsRequest request;
+    fillStartReportsRequest(request, interval, engineMask);
     ::locStub::LocManagerCommandReply response;
     ClientContext context;
     telux::common::Status status = telux::common::Status::FAILED;
@@ -267,12 +283,11 @@ telux::common::Status LocationManagerStub::startDetailedEngineReports(uint32_t i
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
     if (status == telux::common::Status::SUCCESS) {
-        auto f = std::async(std::launch::async, [=]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
             if (callback && (cbDelay != SKIP_CALLBACK)) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(errorCode);
             }
-        }).share();
+        });
         taskQ_.add(f);
         if (filter_ != nullptr) {
             telux::common::Status rc = telux::common::Status::SUCCESS;
@@ -318,7 +333,8 @@ telux::common::Status LocationManagerStub::startBasicReports(
     std::vector<std::string> filters = {"LOC_REPORTS"};
     auto &locationReportListener = telux::common::LocationReportListener::getInstance();
     locationReportListener.registerListener(myselfForReports_, filters);
-    const ::google::protobuf::Empty request;
+    ::locStub::StartReportsRequest request;
+    fillStartReportsRequest(request, interval, LocReqEngineType::LOC_REQ_ENGINE_FUSED_BIT);
     ::locStub::LocManagerCommandReply response;
     ClientContext context;
     telux::common::Status status = telux::common::Status::FAILED;
@@ -333,12 +349,11 @@ telux::common::Status LocationManagerStub::startBasicReports(
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
     if (status == telux::common::Status::SUCCESS) {
-        auto f = std::async(std::launch::async, [=]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
             if (callback && (cbDelay != SKIP_CALLBACK)) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(errorCode);
             }
-        }).share();
+        });
         taskQ_.add(f);
         if (filter_ != nullptr) {
             telux::common::Status rc = filter_->startReportFilter(interval, ReportType::FUSED);
@@ -362,7 +377,8 @@ telux::common::Status LocationManagerStub::startBasicReports(
     std::vector<std::string> filters = {"LOC_REPORTS"};
     auto &locationReportListener = telux::common::LocationReportListener::getInstance();
     locationReportListener.registerListener(myselfForReports_, filters);
-    const ::google::protobuf::Empty request;
+    ::locStub::StartReportsRequest request;
+    fillStartReportsRequest(request, interval, LocReqEngineType::LOC_REQ_ENGINE_FUSED_BIT);
     ::locStub::LocManagerCommandReply response;
     ClientContext context;
     telux::common::Status status = telux::common::Status::FAILED;
@@ -377,12 +393,11 @@ telux::common::Status LocationManagerStub::startBasicReports(
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
     if (status == telux::common::Status::SUCCESS) {
-        auto f = std::async(std::launch::async, [=]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
             if (callback && (cbDelay != SKIP_CALLBACK)) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(errorCode);
             }
-        }).share();
+        });
         taskQ_.add(f);
         if (filter_ != nullptr) {
             telux::common::Status rc = filter_->startReportFilter(interval, ReportType::FUSED);
@@ -400,17 +415,18 @@ telux::common::Status LocationManagerStub::stopReports(telux::common::ResponseCa
     std::vector<std::string> filters = {"LOC_REPORTS"};
     auto &locationReportListener = telux::common::LocationReportListener::getInstance();
     locationReportListener.deregisterListener(myselfForReports_, filters);
-    const ::google::protobuf::Empty request;
+    ::locStub::StopReportsRequest request;
+    request.set_client_id(getpid());
     ::google::protobuf::Empty response;
     ClientContext context;
     ::grpc::Status reqstatus = stub_->StopReports(&context, request, &response);
     if(reqstatus.ok()) {
-        auto f = std::async(std::launch::async, [=]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(DEFAULT_CALLBACK_DELAY,
+            [=]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(DEFAULT_CALLBACK_DELAY));
                 callback(telux::common::ErrorCode::SUCCESS);
             }
-        }).share();
+        });
         taskQ_.add(f);
         if (filter_ != nullptr) {
             filter_->resetAllFilters();
@@ -464,12 +480,11 @@ telux::common::Status LocationManagerStub::registerForSystemInfoUpdates(
             LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
         }
     }
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
             callback(errorCode);
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -503,12 +518,11 @@ telux::common::Status LocationManagerStub::deRegisterForSystemInfoUpdates(
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
     if (status == telux::common::Status::SUCCESS) {
-        auto f = std::async(std::launch::async, [=]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
             if (callback && (cbDelay != SKIP_CALLBACK)) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(errorCode);
             }
-        }).share();
+        });
         taskQ_.add(f);
     }
     return status;
@@ -534,12 +548,11 @@ telux::common::Status LocationManagerStub::requestEnergyConsumedInfo(GetEnergyCo
         telux::loc::GnssEnergyConsumedInfo energyConsumed = {};
         energyConsumed.valid = static_cast<int>(response.validity());
         energyConsumed.energySinceFirstBoot = static_cast<int>(response.energy_consumed());
-        auto f = std::async(std::launch::async, [=]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
             if (cb && (cbDelay != SKIP_CALLBACK)) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 cb(energyConsumed, errorCode);
             }
-        }).share();
+        });
         taskQ_.add(f);
     }
     return status;
@@ -563,12 +576,11 @@ telux::common::Status LocationManagerStub::getYearOfHw(GetYearOfHwCallback cb) {
     }
     if (status == telux::common::Status::SUCCESS) {
         uint16_t yearOfHw = static_cast<int>(response.year_of_hw());
-        auto f = std::async(std::launch::async, [=]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
             if (cb && (cbDelay != SKIP_CALLBACK)) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 cb(yearOfHw, errorCode);
             }
-        }).share();
+        });
         taskQ_.add(f);
     }
     return status;
@@ -529,6 +529,8 @@ private:
     void invokeSysInfoUpdateEvent(telux::loc::LocationSystemInfo &locSystemInfo);
     void parseRequest(::locStub::StartReportsEvent startEvent);
     void adjustTimeInterval(uint32_t &interval);
+    void fillStartReportsRequest(::locStub::StartReportsRequest &request, uint32_t interval,
+        LocReqEngine engineMask);
     void parseDetailedPvtReports(std::shared_ptr<LocationInfoEx> &loc,
         std::vector<std::string> &message);
     void setLocationInfoBase(std::shared_ptr<LocationInfoBase> &loc,
@@ -12,113 +12,83 @@ const uint64_t GRACE_TIME_MS = 50;
 namespace telux {
 namespace loc {
 
-TimeWindow::TimeWindow(uint64_t timeInterval) {
-    LOG(DEBUG, __FUNCTION__, " timeInterval: ", timeInterval);
-    timeInterval_ = timeInterval;
-    previousTimeStamp_ = telux::loc::UNKNOWN_TIMESTAMP;
-}
-
-bool TimeWindow::isTimeStampValid() {
-    bool status = (previousTimeStamp_ != telux::loc::UNKNOWN_TIMESTAMP) ? true : false;
-    return status;
+TimeWindow::TimeWindow()
+   : timeInterval_(0)
+   , previousTimeStamp_(telux::loc::UNKNOWN_TIMESTAMP) {
 }
 
 void TimeWindow::setTimeInterval(uint64_t timeInterval) {
     LOG(DEBUG, __FUNCTION__, "timeInterval: ", timeInterval);
-    std::lock_guard<std::mutex> lock(mutex_);
-    timeInterval_ = timeInterval;
-    return;
+    timeInterval_.store(timeInterval);
 }
 
 void TimeWindow::resetWindow() {
     LOG(DEBUG, __FUNCTION__);
-    std::lock_guard<std::mutex> lock(mutex_);
-    previousTimeStamp_ = telux::loc::UNKNOWN_TIMESTAMP;
-    return;
-}
-
-void TimeWindow::updateTimeStamp(uint64_t timestamp) {
-    previousTimeStamp_ = timestamp;
-    return;
+    previousTimeStamp_.store(telux::loc::UNKNOWN_TIMESTAMP);
 }
 
 bool TimeWindow::isInWindow(uint64_t currentTimeStamp) {
-    LOG(DEBUG, __FUNCTION__, " Current Timestamp: ", currentTimeStamp);
-    std::lock_guard<std::mutex> lock(mutex_);
-    uint64_t timeDifference = currentTimeStamp - previousTimeStamp_;
-    uint64_t lowerBound = timeInterval_ - GRACE_TIME_MS;
-    uint64_t upperBound = timeInterval_ + GRACE_TIME_MS;
-    bool isFiltered = false;
-    if (!isTimeStampValid()) {
-        LOG(WARNING, __FUNCTION__, " Window doesn't have a valid previous timestamp");
-        updateTimeStamp(currentTimeStamp);
-        return isFiltered;
-    }
-    if ((timeDifference > lowerBound) && (timeDifference < upperBound)) {
-        updateTimeStamp(currentTimeStamp);
-    } else if (timeDifference > upperBound) {
-        LOG(DEBUG, __FUNCTION__, " A glitch has occured, updating windows");
-        updateTimeStamp(currentTimeStamp);
-    } else {
-        LOG(DEBUG, __FUNCTION__, " Filtering the report");
-        isFiltered = true;
-    }
-    return isFiltered;
+    uint64_t timeInterval = timeInterval_.load(std::memory_order_relaxed);
+    uint64_t lowerBound = timeInterval - GRACE_TIME_MS;
+    uint64_t upperBound = timeInterval + GRACE_TIME_MS;
+    uint64_t previousTimeStamp = previousTimeStamp_.load(std::memory_order_relaxed);
+    do {
+        // Without a previous timestamp, the report starts the window
+        if (previousTimeStamp != telux::loc::UNKNOWN_TIMESTAMP) {
+            uint64_t timeDifference = currentTimeStamp - previousTimeStamp;
+            if (!((timeDifference > lowerBound) && (timeDifference < upperBound))
+                && !(timeDifference > upperBound)) {
+                return true;
+            }
+        }
+    } while (!previousTimeStamp_.compare_exchange_weak(previousTimeStamp, currentTimeStamp,
+        std::memory_order_relaxed));
+    return false;
 }
 
 // LocationReportFilter class
 
 LocationReportFilter::LocationReportFilter() {
+    for (auto &isStarted : isStarted_) {
+        isStarted.store(false);
+    }
 }
 
 Status LocationReportFilter::startReportFilter(uint64_t timeInterval, ReportType reportType) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    Status status = Status::FAILED;
-    if (windows_.find(reportType) == windows_.end()) {
-        try {
-            windows_[reportType] = std::make_shared<TimeWindow>(timeInterval);
-            status = Status::SUCCESS;
-        } catch (std::bad_alloc & e) {
-            LOG(ERROR, __FUNCTION__, " TimeWindow: ", e.what());
-            status = Status::NOMEMORY;
-        }
-    } else {
-        windows_[reportType]->resetWindow();
-        windows_[reportType]->setTimeInterval(timeInterval);
+    int index = static_cast<int>(reportType);
+    if ((index < 0) || (index >= REPORT_TYPE_COUNT)) {
+        return Status::INVALIDPARAM;
     }
-    return status;
+    LOG(DEBUG, __FUNCTION__, " reportType: ", index, " timeInterval: ", timeInterval);
+    windows_[index].resetWindow();
+    windows_[index].setTimeInterval(timeInterval);
+    isStarted_[index].store(true);
+    return Status::SUCCESS;
 }
 
 void LocationReportFilter::resetAllFilters() {
     LOG(DEBUG, __FUNCTION__);
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto itr : windows_) {
-        itr.second->resetWindow();
+    for (auto &window : windows_) {
+        window.resetWindow();
     }
     return;
 }
 
 bool LocationReportFilter::isReportIgnored(const uint64_t timestamp, const ReportType reportType) {
     /*
-     * Acquire mutex and check if the report type exists in the map before
-     * checking the timing window.
-     * This check is done because if LCA invokes onLocationCb prior to onResponseCb,
-     * accessing the uninitialized shared_ptr would result in a crash.
-     *
+     * The window of the report type may not be started yet, if LCA invokes onLocationCb
+     * prior to onResponseCb.
      */
-    std::lock_guard<std::mutex> lock(mutex_);
-    if(windows_.find(reportType) != windows_.end()) {
-        if (timestamp == telux::loc::UNKNOWN_TIMESTAMP) {
-            LOG(ERROR, __FUNCTION__, " Unknown timestamp is reported");
-            return false;
-        }
-        auto TimeWindow = windows_[reportType];
-        bool status = TimeWindow->isInWindow(timestamp);
-        return status;
-    } else {
+    int index = static_cast<int>(reportType);
+    if ((index < 0) || (index >= REPORT_TYPE_COUNT) || !isStarted_[index].load()) {
         LOG(ERROR, __FUNCTION__, " Window not yet initialized");
         return true;
     }
+    if (timestamp == telux::loc::UNKNOWN_TIMESTAMP) {
+        LOG(ERROR, __FUNCTION__, " Unknown timestamp is reported");
+        return false;
+    }
+    return windows_[index].isInWindow(timestamp);
 }
 
 } // end of namespace loc
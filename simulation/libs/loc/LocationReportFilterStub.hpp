@@ -6,9 +6,8 @@
 #ifndef LOCATIONREPORTFILTER_HPP
 #define LOCATIONREPORTFILTER_HPP
 
-#include <mutex>
+#include <atomic>
 #include <memory>
-#include <map>
 #include <telux/loc/LocationDefines.hpp>
 
 using namespace telux::common;
@@ -24,19 +23,20 @@ enum class ReportType {
     VPE
 };
 
+/*
+ * The reports are decimated by the server already, the window only checks them again. It is
+ * lock free as it is checked for every report.
+ */
 class TimeWindow {
 public:
-    TimeWindow(uint64_t timeInterval);
+    TimeWindow();
     bool isInWindow(const uint64_t currentTimestamp);
     void setTimeInterval(uint64_t timeInterval);
     void resetWindow();
 
 private:
-    bool isTimeStampValid();
-    void updateTimeStamp(uint64_t timestamp);
-    uint32_t timeInterval_;
-    uint64_t previousTimeStamp_;
-    std::mutex mutex_;
+    std::atomic<uint64_t> timeInterval_;
+    std::atomic<uint64_t> previousTimeStamp_;
 };
 
 class LocationReportFilter {
@@ -50,8 +50,9 @@ public:
     bool isReportIgnored(const uint64_t timestamp, const ReportType reportType);
     void resetAllFilters();
 private:
-    std::map<ReportType, std::shared_ptr<TimeWindow>> windows_;
-    std::mutex mutex_;
+    static const int REPORT_TYPE_COUNT = 4;
+    TimeWindow windows_[REPORT_TYPE_COUNT];
+    std::atomic<bool> isStarted_[REPORT_TYPE_COUNT];
 };
 
 } // end of namespace loc
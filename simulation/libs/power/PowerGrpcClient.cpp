@@ -6,6 +6,7 @@
 #include "PowerGrpcClient.hpp"
 
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 
 #define DEFAULT_CALLBACK_DELAY 100
 #define SKIP_CALLBACK -1
@@ -237,10 +238,9 @@ telux::common::Status PowerGrpcClient::sendActivityStateCommand(TcuActivityState
     }
     if (status == telux::common::Status::SUCCESS) {
         if (callback && (cbDelay != SKIP_CALLBACK)) {
-            auto f = std::async(std::launch::async, [=]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
                 callback(errorCode);
-            }).share();
+            });
             taskQ_.add(f);
         }
     }
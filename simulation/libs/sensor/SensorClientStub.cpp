@@ -41,6 +41,7 @@
 #include "libs/common/Logger.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
+#include "libs/common/TimerService.hpp"
 
 //Default cb delay.
 #define DEFAULT_CALLBACK_DELAY 100
@@ -72,7 +73,6 @@ SensorClientStub::SensorClientStub(SensorInfo sensorInfo, std::shared_ptr<::sens
     config_.isRotated = 1;
     config_.validityMask.reset();
     config_.updateMask.reset();
-    updateSensorSamplingMap();
 }
 
 void SensorClientStub::init() {
@@ -84,22 +84,12 @@ void SensorClientStub::init() {
     clientEventManager.registerListener(myself_, filters);
 }
 
-void SensorClientStub::updateSensorSamplingMap(){
-    LOG(DEBUG,__FUNCTION__);
-    sensorSamplingMap_[12] = 8;
-    sensorSamplingMap_[26] = 4;
-    sensorSamplingMap_[52] = 2;
-    sensorSamplingMap_[104] = 1;
-}
-
-uint64_t SensorClientStub::getSamplesToSkip(uint64_t sampleRate){
-    LOG(DEBUG,__FUNCTION__);
-    auto it = sensorSamplingMap_.find(sampleRate);
-    if (it != sensorSamplingMap_.end()) {
-        return it->second;
-    } else {
-        return 1;
-    }
+void SensorClientStub::fillStreamConfig(::sensorStub::SensorStreamConfig *streamConfig) {
+    // The server decimates and batches the reports of the stream as configured here
+    streamConfig->set_report_type(static_cast<uint32_t>(sensorInfo_.type));
+    streamConfig->set_is_rotated(config_.isRotated);
+    streamConfig->set_sampling_rate(config_.samplingRate);
+    streamConfig->set_batch_count(config_.batchCount);
 }
 
 SensorClientStub::~SensorClientStub() {
@@ -267,6 +257,7 @@ telux::common::Status SensorClientStub::activate(){
         sensorType = ::sensorStub::SensorType::GYRO;
     }
     request.set_sensor_type(sensorType);
+    fillStreamConfig(request.mutable_stream_config());
 
     ::grpc::Status reqstatus = stub_->Activate(&context, request, &response);
     if(reqstatus.ok()) {
@@ -276,7 +267,6 @@ telux::common::Status SensorClientStub::activate(){
     }
     if (status == telux::common::Status::SUCCESS) {
         sensorSessionActive_ = true;
-        sampleCountFromMap_ = getSamplesToSkip(config_.samplingRate);
     }
     return status;
 }
@@ -303,6 +293,7 @@ telux::common::Status SensorClientStub::deactivate(){
         sensorType = ::sensorStub::SensorType::GYRO;
     }
     request.set_sensor_type(sensorType);
+    fillStreamConfig(request.mutable_stream_config());
 
     ::grpc::Status reqstatus = stub_->Deactivate(&context, request, &response);
     if(reqstatus.ok()) {
@@ -313,10 +304,6 @@ telux::common::Status SensorClientStub::deactivate(){
     if (status == telux::common::Status::SUCCESS) {
         sensorSessionActive_ = false;
         isConfigurationRequired_ = true;
-        receivedSampleCount_ = 0;
-        events_.clear();
-        sampleCountFromMap_ = 1;
-        firstSample_ = true;
     }
     return status;
 }
@@ -375,10 +362,9 @@ telux::common::Status SensorClientStub::selfTest(
             errorCode = telux::common::ErrorCode::DEVICE_IN_USE;
         }
         int cbDelay = static_cast<int>(response.delay());
-        auto f = std::async(std::launch::async, [=]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
                 cb(errorCode);
-        }).share();
+        });
         taskQ_.add(f);
     }
 
@@ -431,10 +417,9 @@ telux::common::Status SensorClientStub::selfTest(SelfTestType selfTestType,
         }
         selfTestResultParams.timestamp_ = response.timestamp();
         int cbDelay = static_cast<int>(response.delay());
-        auto f = std::async(std::launch::async, [=]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
                 cb(errorCode, selfTestResultParams);
-        }).share();
+        });
         taskQ_.add(f);
     }
 
@@ -636,36 +621,21 @@ void SensorClientStub::parseSensorEvents(std::vector<std::vector<std::string>> e
     notifySensorEvent(sensorEvents);
 }
 
-void SensorClientStub::batchSensorEvents(std::vector<std::string> message)
-{
-    if (firstSample_) {
-        events_.push_back(message);
-        firstSample_ = false;
-    }
-    else {
-        ++receivedSampleCount_;
-        if (receivedSampleCount_ == sampleCountFromMap_) {
-            events_.push_back(message);
-            receivedSampleCount_ = 0;
-            if (events_.size() == config_.batchCount) {
-                parseSensorEvents(events_, config_.batchCount);
-                events_.clear();
-            }
-        }
-    }
-}
-
 void SensorClientStub::parseRequest(::sensorStub::StartReportsEvent startEvent) {
     LOG(DEBUG, __FUNCTION__);
-    std::string msg = startEvent.sensor_report();
-    std::vector<std::string> message = CommonUtils::splitString(msg);
-    uint32_t type = std::stoul(message[0]);
-    uint32_t rotated = std::stoul(message[1]);
-    if ( (type == static_cast<uint32_t>(sensorInfo_.type)) && (rotated == config_.isRotated)
-    && (sensorSessionActive_) )
-    {
-        batchSensorEvents(message);
-    }
+    const ::sensorStub::SensorStreamConfig &streamConfig = startEvent.stream_config();
+    if ((streamConfig.report_type() != static_cast<uint32_t>(sensorInfo_.type))
+        || (streamConfig.is_rotated() != config_.isRotated)
+        || (streamConfig.sampling_rate() != config_.samplingRate)
+        || (streamConfig.batch_count() != config_.batchCount) || (!sensorSessionActive_)) {
+        return;
+    }
+    std::vector<std::vector<std::string>> events;
+    events.reserve(startEvent.sensor_reports_size());
+    for (const auto &report : startEvent.sensor_reports()) {
+        events.push_back(CommonUtils::splitString(report));
+    }
+    parseSensorEvents(events, static_cast<uint32_t>(events.size()));
 }
 
 
@@ -98,15 +98,13 @@ class SensorClientStub: public ISensorClient,
     void notifyConfigurationUpdate(SensorConfiguration configuration);
     float updateSamplingRate(float sampleRate);
     uint32_t updateBatchCount(uint32_t batchCount);
-    void batchSensorEvents(std::vector<std::string> message);
     void parseRequest(::sensorStub::StartReportsEvent startEvent);
     void handleStreamingStoppedEvent();
     void handleSelfTestFailedEvent(::sensorStub::SelfTestFailedEvent &selfTestFailedEvent);
     void notifySelfTestFailedEvent();
     void notifySensorEvent(std::shared_ptr<std::vector<SensorEvent>> events);
     void parseSensorEvents(std::vector<std::vector<std::string>> events, uint32_t count);
-    void updateSensorSamplingMap();
-    uint64_t getSamplesToSkip(uint64_t sampleRate);
+    void fillStreamConfig(::sensorStub::SensorStreamConfig *streamConfig);
     SensorInfo sensorInfo_;
     std::string sensorLogPrefix_;
     telux::common::CommandCallbackManager cmdCallbackMgr_;
@@ -120,12 +118,7 @@ class SensorClientStub: public ISensorClient,
     uint64_t lastReceivedEvent_;
     uint64_t lastReceivedSample_=0;
     uint64_t outgoingSampleCount_=0;
-    uint64_t receivedSampleCount_=0;
     uint64_t reqTimeGap_ =0;
-    std::vector<std::vector<std::string>> events_;
-    std::map<uint64_t, uint64_t> sensorSamplingMap_;
-    uint64_t sampleCountFromMap_;
-    bool firstSample_ = true;
     std::weak_ptr<telux::sensor::SensorClientStub> myself_;
 };
 
@@ -12,6 +12,7 @@
 #include "SensorFeatureManagerStub.hpp"
 #include "common/Logger.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include "telux/sensor/SensorDefines.hpp"
 #include "SensorDefinesStub.hpp"
 
@@ -241,11 +242,10 @@ telux::common::Status SensorFeatureManagerStub::getAvailableFeatures(
     } else {
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (cbDelay != SKIP_CALLBACK) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -266,11 +266,10 @@ telux::common::Status SensorFeatureManagerStub::enableFeature(std::string name){
     } else {
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (cbDelay != SKIP_CALLBACK) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
@@ -291,11 +290,10 @@ telux::common::Status SensorFeatureManagerStub::disableFeature(std::string name)
     } else {
         LOG(ERROR, RPC_FAIL_SUFFIX, reqstatus.error_code());
     }
-    auto f = std::async(std::launch::async, [=]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay, [=]() {
         if (cbDelay != SKIP_CALLBACK) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
         }
-    }).share();
+    });
     taskQ_.add(f);
     return status;
 }
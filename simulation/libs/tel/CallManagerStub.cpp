@@ -7,6 +7,7 @@
 #include <telux/tel/ECallDefines.hpp>
 #include "CallManagerStub.hpp"
 #include "ECallMsd.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::common;
 using namespace telux::tel;
@@ -77,11 +78,10 @@ void CallManagerStub::setServiceStatus(telux::common::ServiceStatus status) {
         subSystemStatus_ = status;
     }
     if(initCb_) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay_,
         [this, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay_));
                 initCb_(status);
-        }).share();
+        });
         taskQ_->add(f1);
     } else {
         LOG(ERROR, __FUNCTION__, " Callback is NULL");
@@ -241,23 +241,21 @@ void CallManagerStub::findMatchingCall(int index, std::string remotePartyNumber,
         size_t value = std::distance(calls_.begin(), iter);
         (*iter)->setCallIndex(index);
         if(iMakecallback) {
-            auto f = std::async(std::launch::async,
-                [this, error, iter, iMakecallback, cbDelay, value]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+                [this, error, iter, iMakecallback, value]() {
                     LOG(DEBUG, __FUNCTION__, " invoking callback");
                     iMakecallback->makeCallResponse(error, calls_[value]);
                     if(error != telux::common::ErrorCode::SUCCESS) {
                         // update local cache to clear calls
                         updateCurrentCalls();
                     }
-                }).share();
+                });
             taskQ_->add(f);
 
         }
         if(callback) {
-            auto f = std::async(std::launch::async,
-                [this, error, iter, callback, cbDelay, value]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+                [this, error, iter, callback, value]() {
                     LOG(DEBUG, __FUNCTION__, " invoking callback");
                     callback(error, calls_[value]);
                     if(error != telux::common::ErrorCode::SUCCESS) {
@@ -265,7 +263,7 @@ void CallManagerStub::findMatchingCall(int index, std::string remotePartyNumber,
                         LOG(DEBUG, __FUNCTION__, " updating call cache");
                         updateCurrentCalls();
                     }
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -1068,11 +1066,10 @@ telux::common::Status CallManagerStub::updateECallMsd(int phoneId, const ECallMs
         status = static_cast<telux::common::Status>(response.status());
         int cbDelay = static_cast<int>(response.delay());
         if(callback) {
-            auto f = std::async(std::launch::async,
-            [this, error, callback, cbDelay]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 callback->commandResponse(error);
-            }).share();
+            });
             taskQ_->add(f);
         }
     }
@@ -1106,11 +1103,10 @@ telux::common::Status CallManagerStub::updateECallMsd(int phoneId,
         status = static_cast<telux::common::Status>(response.status());
         int cbDelay = static_cast<int>(response.delay());
         if(callback) {
-            auto f = std::async(std::launch::async,
-            [this, error, callback, cbDelay]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 callback(error);
-            }).share();
+            });
             taskQ_->add(f);
         }
     }
@@ -1156,17 +1152,58 @@ telux::common::Status CallManagerStub::requestECallHlapTimerStatus(int phoneId,
             response.hlap_timer_status()).t10());
         int cbDelay = static_cast<int>(response.delay());
         if(callback) {
-            auto f = std::async(std::launch::async,
-            [this, error, phoneId, timersStatus, callback, cbDelay]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, phoneId, timersStatus, callback]() {
                 callback(error, phoneId, timersStatus);
-            }).share();
+            });
             taskQ_->add(f);
         }
     }
     return status;
 }
 
+telux::common::ErrorCode CallManagerStub::getECallHlapTimerAccuracy(int phoneId,
+    std::vector<ECallHlapTimerAccuracy> &accuracy) {
+    LOG(DEBUG, "CallManager - ", __FUNCTION__);
+
+    if (phoneId <= 0 || phoneId > noOfSlots_) {
+        LOG(DEBUG, __FUNCTION__, " Invalid PhoneId");
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    if (telux::common::ServiceStatus::SERVICE_AVAILABLE != getServiceStatus()) {
+        LOG(ERROR, __FUNCTION__, " Call Manager is not ready");
+        return telux::common::ErrorCode::SUBSYSTEM_UNAVAILABLE;
+    }
+
+    ::telStub::RequestECallHlapTimerStatusRequest request;
+    ::telStub::RequestECallHlapTimerStatusReply response;
+    ClientContext context;
+
+    request.set_phone_id(phoneId);
+
+    grpc::Status reqstatus = stub_->RequestECallHlapTimerStatus(&context, request, &response);
+    if (!reqstatus.ok()) {
+        LOG(ERROR, __FUNCTION__, " RequestECallHlapTimerStatus request failed");
+        return telux::common::ErrorCode::INTERNAL_ERR;
+    }
+    telux::common::ErrorCode error = static_cast<telux::common::ErrorCode>(response.error());
+    if (error != telux::common::ErrorCode::SUCCESS) {
+        return error;
+    }
+    accuracy.clear();
+    for (auto &timerAccuracy : response.timer_accuracy()) {
+        ECallHlapTimerAccuracy info;
+        info.timer = timerAccuracy.timer();
+        info.durationMs = timerAccuracy.duration_ms();
+        info.elapsedMs = timerAccuracy.elapsed_ms();
+        info.isRunning = timerAccuracy.is_running();
+        info.isExpired = timerAccuracy.is_expired();
+        info.expiryDeviationMs = timerAccuracy.expiry_deviation_ms();
+        accuracy.push_back(info);
+    }
+    return telux::common::ErrorCode::SUCCESS;
+}
+
 std::vector<std::shared_ptr<ICall>> CallManagerStub::getInProgressCalls() {
     LOG(DEBUG, __FUNCTION__);
     std::vector<std::shared_ptr<ICall>> iCalls(calls_.begin(), calls_.end());
@@ -1225,11 +1262,10 @@ telux::common::Status CallManagerStub::swap(std::shared_ptr<ICall> callToHold,
 
         if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
             if(callback) {
-                auto f = std::async(std::launch::async,
-                    [this, error, callback, delay]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+                auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+                    [this, error, callback]() {
                         callback->commandResponse(error);
-                    }).share();
+                    });
                 taskQ_->add(f);
             }
         }
@@ -1261,11 +1297,10 @@ telux::common::Status CallManagerStub::hangupForegroundResumeBackground(int phon
         int delay = static_cast<int>(response.delay());
         if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
             if(callback) {
-                auto f = std::async(std::launch::async,
-                    [this, error, callback, delay]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+                auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+                    [this, error, callback]() {
                         callback(error);
-                    }).share();
+                    });
                 taskQ_->add(f);
             }
         }
@@ -1297,11 +1332,10 @@ telux::common::Status CallManagerStub::hangupWaitingOrBackground(int phoneId,
         int delay = static_cast<int>(response.delay());
         if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
         if(callback) {
-                auto f = std::async(std::launch::async,
-                    [this, error, callback, delay]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+                auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+                    [this, error, callback]() {
                         callback(error);
-                    }).share();
+                    });
                 taskQ_->add(f);
             }
         }
@@ -1335,11 +1369,10 @@ telux::common::Status CallManagerStub::requestEcbm(int phoneId, EcbmStatusCallba
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
         if ((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
             if(callback) {
-                auto f = std::async(std::launch::async,
-                    [this, error , callback, ecbMode, cbDelay]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+                auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+                    [this, error , callback, ecbMode]() {
                         callback(ecbMode, error);
-                    }).share();
+                    });
                 taskQ_->add(f);
             }
         }
@@ -1370,11 +1403,10 @@ telux::common::Status CallManagerStub::exitEcbm(int phoneId, common::ResponseCal
         int cbDelay = static_cast<int>(response.delay());
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
         if ((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
-            auto f = std::async(std::launch::async,
-                [this, error, cbDelay, callback]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+                [this, error, callback]() {
                     callback(error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -1405,11 +1437,10 @@ telux::common::Status CallManagerStub::requestNetworkDeregistration(int phoneId,
         int cbDelay = static_cast<int>(response.delay());
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
         if ((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
-            auto f = std::async(std::launch::async,
-                [this, error, cbDelay, callback]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+                [this, error, callback]() {
                     callback(error);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -1444,11 +1475,10 @@ telux::common::Status CallManagerStub::updateEcallHlapTimer(int phoneId, HlapTim
             bool isCallbackNeeded = static_cast<bool>(response.iscallback());
 
             if ((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
-                auto f = std::async(std::launch::async,
-                    [this, error , callback, cbDelay]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+                auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+                    [this, error , callback]() {
                         callback(error);
-                    }).share();
+                    });
                 taskQ_->add(f);
             }
         }
@@ -1487,11 +1517,10 @@ telux::common::Status CallManagerStub::requestEcallHlapTimer(int phoneId, HlapTi
             int timeDuration = static_cast<int>(response.time_duration());
             if ((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
                 if(callback) {
-                    auto f = std::async(std::launch::async,
-                    [this, error , callback, cbDelay, timeDuration]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+                    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+                    [this, error , callback, timeDuration]() {
                         callback(error, timeDuration);
-                    }).share();
+                    });
                     taskQ_->add(f);
                 }
             }
@@ -1687,11 +1716,10 @@ telux::common::Status CallManagerStub::sendRtt(int phoneId, std::string message,
         status = static_cast<telux::common::Status>(response.status());
         int cbDelay = static_cast<int>(response.delay());
         if(callback) {
-            auto f = std::async(std::launch::async,
-            [this, error, callback, cbDelay]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 callback(error);
-            }).share();
+            });
             taskQ_->add(f);
         }
     }
@@ -1722,11 +1750,10 @@ telux::common::Status CallManagerStub::configureECallRedial(RedialConfigType con
         status = static_cast<telux::common::Status>(response.status());
         int cbDelay = static_cast<int>(response.delay());
         if(callback) {
-            auto f = std::async(std::launch::async,
-            [this, error, callback, cbDelay]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 callback(error);
-            }).share();
+            });
             taskQ_->add(f);
         }
     }
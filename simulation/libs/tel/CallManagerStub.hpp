@@ -27,6 +27,18 @@
 namespace telux {
 namespace tel {
 
+/* Timing of the last run of a HLAP timer, as measured by the simulation */
+struct ECallHlapTimerAccuracy {
+    std::string timer;
+    int durationMs = 0;
+    /* Time the timer has been running for */
+    int elapsedMs = 0;
+    bool isRunning = false;
+    bool isExpired = false;
+    /* Expiry time minus duration, valid if isExpired */
+    int expiryDeviationMs = 0;
+};
+
 class CallManagerStub : public ICallManager,
                         public IEventListener,
                         public std::enable_shared_from_this<CallManagerStub> {
@@ -112,6 +124,13 @@ public:
         common::ResponseCallback callback) override;
     telux::common::ErrorCode getECallPostTestRegistrationTimer(int phoneId,
         uint32_t &timer) override;
+
+    /**
+     * Simulation only: gets how closely the HLAP timers of the phone kept their durations.
+     */
+    telux::common::ErrorCode getECallHlapTimerAccuracy(int phoneId,
+        std::vector<ECallHlapTimerAccuracy> &accuracy);
+
     ~CallManagerStub();
     void cleanup();
     void onEventUpdate(google::protobuf::Any event)  override;
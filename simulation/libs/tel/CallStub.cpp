@@ -33,6 +33,8 @@
  */
 
 #include "CallStub.hpp"
+#include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include <thread>
 
 #define INVALID_CALL_INDEX -1
@@ -42,8 +44,7 @@ using namespace telux::tel;
 using namespace std;
 
 CallStub::CallStub(int phoneId, CallInfo callInfo)
-    : stub_(DialerService::NewStub(grpc::CreateChannel("localhost:8089",
-    grpc::InsecureChannelCredentials())))
+    : stub_(CommonUtils::getGrpcStub<DialerService>())
     , phoneId_(phoneId)
     , callInfo_(callInfo) {
     taskQ_ = std::make_shared<AsyncTaskQueue<void>>();
@@ -72,11 +73,7 @@ telux::common::Status CallStub::answer(
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
         int delay = static_cast<int>(response.delay());
         if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCommandCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCommandCallback(callback, error, delay);
         }
     } else {
         LOG(ERROR, "call in wrong state:", (int)callInfo_.callState);
@@ -109,11 +106,7 @@ telux::common::Status CallStub::hold(
         int delay = static_cast<int>(response.delay());
 
         if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCommandCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCommandCallback(callback, error, delay);
         }
     } else {
         LOG(ERROR, "call in wrong state:", (int)callInfo_.callState);
@@ -145,11 +138,7 @@ telux::common::Status CallStub::resume(
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
         int delay = static_cast<int>(response.delay());
         if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCommandCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCommandCallback(callback, error, delay);
         }
     } else {
         LOG(ERROR, "call in wrong state:", (int)callInfo_.callState);
@@ -182,11 +171,7 @@ telux::common::Status CallStub::reject(
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
         int delay = static_cast<int>(response.delay());
         if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCommandCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCommandCallback(callback, error, delay);
         }
     } else {
         LOG(ERROR, "call in wrong state:", (int)callInfo_.callState);
@@ -220,11 +205,7 @@ telux::common::Status CallStub::reject(const std::string &rejectSMS,
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
         int delay = static_cast<int>(response.delay());
         if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCommandCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCommandCallback(callback, error, delay);
         }
     } else {
         LOG(ERROR, "call in wrong state:", (int)callInfo_.callState);
@@ -259,11 +240,7 @@ telux::common::Status CallStub::hangup(
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
         int delay = static_cast<int>(response.delay());
         if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-            auto f1 = std::async(std::launch::async,
-                [this, error, callback, delay]() {
-                    this->invokeCommandCallback(callback, error, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCommandCallback(callback, error, delay);
         }
     } else {
         LOG(ERROR, "call in wrong state:", (int)callInfo_.callState);
@@ -274,11 +251,10 @@ telux::common::Status CallStub::hangup(
 
 void CallStub::invokeCommandCallback(std::shared_ptr<ICommandResponseCallback> callback,
     ErrorCode error, int cbDelay) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback->commandResponse(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -539,11 +515,7 @@ telux::common::Status CallStub::modifyOrRespondToModifyCall(RttMode mode, std::s
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int delay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback, delay]() {
-                this->invokeCommandCallback(callback, error, delay);
-            }).share();
-        taskQ_->add(f1);
+        this->invokeCommandCallback(callback, error, delay);
     }
     return status;
 }
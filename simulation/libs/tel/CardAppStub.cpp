@@ -35,6 +35,7 @@
 #include "CardFileHandlerStub.hpp"
 #include "CardAppStub.hpp"
 #include "CardManagerStub.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::common;
 
@@ -96,11 +97,7 @@ telux::common::Status CardAppStub::changeCardPassword(CardLockType lockType, std
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
 
         if ((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-            auto f1 = std::async(std::launch::async,
-                [this, callback, error , retrycount, delay]() {
-                    this->invokeCallback(callback, error , retrycount, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error , retrycount, delay);
             if(IsCardInfoChanged) {
                 auto f2 = std::async(std::launch::async,
                     [this]() {
@@ -118,11 +115,10 @@ telux::common::Status CardAppStub::changeCardPassword(CardLockType lockType, std
 
 void CardAppStub::invokeCallback(PinOperationResponseCb callback,telux::common::ErrorCode error,
     int retryCount, int delay) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-    auto f1 = std::async(std::launch::async,
+    auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
         [this, error , retryCount, callback]() {
             callback(retryCount, error);
-        }).share();
+        });
     taskQ_->add(f1);
 
 }
@@ -175,11 +171,7 @@ telux::common::Status CardAppStub::unlockCardByPuk(CardLockType lockType, std::s
         bool isCallbackNeeded = static_cast<bool>(response.iscallback());
 
         if ((status == telux::common::Status::SUCCESS)&&(isCallbackNeeded)) {
-            auto f1 = std::async(std::launch::async,
-            [this,callback, error , retrycount, delay]() {
-                this->invokeCallback(callback, error , retrycount, delay);
-            }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error , retrycount, delay);
 
             bool IsCardInfoChanged  = static_cast<int>(response.iscardinfochanged());
             if(IsCardInfoChanged) {
@@ -230,11 +222,7 @@ telux::common::Status CardAppStub::unlockCardByPin(CardLockType lockType, std::s
 
         if ((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
             bool IsCardInfoChanged  = static_cast<int>(response.iscardinfochanged());
-            auto f1 = std::async(std::launch::async,
-                [this,callback, error , retrycount, delay]() {
-                    this->invokeCallback(callback, error , retrycount, delay);
-                }).share();
-            taskQ_->add(f1);
+            this->invokeCallback(callback, error , retrycount, delay);
             if(IsCardInfoChanged) {
                 auto f2 = std::async(std::launch::async,
                     [this]() {
@@ -252,11 +240,10 @@ telux::common::Status CardAppStub::unlockCardByPin(CardLockType lockType, std::s
 
 void CardAppStub::invokeCallback(QueryPin1LockResponseCb callback,
     telux::common::ErrorCode error, int delay, bool state) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-    auto f1 = std::async(std::launch::async,
+    auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
         [this, error, state, callback]() {
             callback(state, error);
-        }).share();
+        });
     taskQ_->add(f1);
 }
 
@@ -279,11 +266,7 @@ telux::common::Status CardAppStub::queryPin1LockState(QueryPin1LockResponseCb ca
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
 
     if ((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, callback, error, delay, state]() {
-                this->invokeCallback(callback, error , delay, state );
-            }).share();
-        taskQ_->add(f1);
+        this->invokeCallback(callback, error , delay, state );
     }
     return status;
 }
@@ -291,11 +274,10 @@ telux::common::Status CardAppStub::queryPin1LockState(QueryPin1LockResponseCb ca
 void CardAppStub::invokeCallback( bool isavailable, bool isenabled,
     QueryFdnLockResponseCb callback,telux::common::ErrorCode error,
     int delay) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(delay,
         [this, isavailable, isenabled, error , callback]() {
             callback(isavailable, isenabled, error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -319,11 +301,7 @@ telux::common::Status CardAppStub::queryFdnLockState(QueryFdnLockResponseCb call
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
 
     if ((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-            [this, isavailable, isenabled, callback, error, delay]() {
-                this->invokeCallback(isavailable, isenabled, callback, error, delay);
-            }).share();
-        taskQ_->add(f);
+        this->invokeCallback(isavailable, isenabled, callback, error, delay);
     }
     return status;
 }
@@ -375,11 +353,7 @@ telux::common::Status CardAppStub::setCardLock(CardLockType lockType, std::strin
 
     if ((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
         bool IsCardInfoChanged  = static_cast<int>(response.iscardinfochanged());
-        auto f = std::async(std::launch::async,
-            [this, error , retrycount, callback, delay]() {
-                this->invokeCallback(callback, retrycount, error, delay);
-            }).share();
-        taskQ_->add(f);
+        this->invokeCallback(callback, retrycount, error, delay);
         if(IsCardInfoChanged) {
             auto f2 = std::async(std::launch::async,
                 [this]() {
@@ -393,11 +367,10 @@ telux::common::Status CardAppStub::setCardLock(CardLockType lockType, std::strin
 
 void CardAppStub::invokeCallback(PinOperationResponseCb callback, int retrycount,
     telux::common::ErrorCode error, int delay) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(delay,
         [this, error , retrycount, callback]() {
             callback(retrycount, error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
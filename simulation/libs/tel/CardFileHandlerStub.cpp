@@ -35,6 +35,7 @@
 #include "CardFileHandlerStub.hpp"
 #include <telux/tel/CardDefines.hpp>
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include <thread>
 using namespace telux::common;
 
@@ -135,11 +136,7 @@ telux::common::Status CardFileHandlerStub::readEFLinearFixed(std::string filePat
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
 
     if ((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-        [this, error , iccresult, cbDelay, callback]() {
-                this->invokeCallback(callback, error, iccresult, cbDelay );
-            }).share();
-        taskQ_->add(f);
+        this->invokeCallback(callback, error, iccresult, cbDelay );
     }
     return status;
 }
@@ -197,11 +194,7 @@ telux::common::Status CardFileHandlerStub::readEFLinearFixedAll(std::string file
     int cbDelay = static_cast<int>(response.delay());
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     if ((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-            [this, error , records, cbDelay, callback]() {
-                this->invokeCallback(callback, error, records, cbDelay );
-            }).share();
-        taskQ_->add(f);
+        this->invokeCallback(callback, error, records, cbDelay );
     }
     return status;
 
@@ -263,11 +256,7 @@ telux::common::Status CardFileHandlerStub::readEFTransparent(std::string filePat
         ,iccresult.sw2,"payload " ,iccresult.payload );
 
     if ((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-            [this, error , iccresult, callback, cbDelay]() {
-                this->invokeCallback(callback, error, iccresult, cbDelay);
-            }).share();
-        taskQ_->add(f);
+        this->invokeCallback(callback, error, iccresult, cbDelay);
     }
     return status;
 }
@@ -329,11 +318,7 @@ telux::common::Status CardFileHandlerStub::writeEFLinearFixed(std::string filePa
     int cbDelay = static_cast<int>(response.delay());
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     if ((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-            [this, error , iccresult, callback, cbDelay]() {
-                this->invokeCallback(callback, error, iccresult, cbDelay);
-            }).share();
-        taskQ_->add(f);
+        this->invokeCallback(callback, error, iccresult, cbDelay);
     }
     return status;
 }
@@ -395,11 +380,7 @@ telux::common::Status CardFileHandlerStub::writeEFTransparent(std::string filePa
     LOG(DEBUG, __FUNCTION__,"sw1 " ,iccresult.sw1, "sw2 " ,iccresult.sw2,
         "payload " ,iccresult.payload );
     if ((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-            [this, error , iccresult, callback, cbDelay]() {
-                this->invokeCallback(callback, error, iccresult, cbDelay);
-            }).share();
-        taskQ_->add(f);
+        this->invokeCallback(callback, error, iccresult, cbDelay);
     }
     return status;
 }
@@ -463,11 +444,7 @@ telux::common::Status CardFileHandlerStub::requestEFAttributes(EfType efType,
     }
     (iccresult.data).assign(store.begin(), store.end());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-            [this, error , iccresult, attributes, callback, cbDelay]() {
-                this->invokeCallback(callback, error, iccresult, attributes, cbDelay);
-            }).share();
-        taskQ_->add(f);
+        this->invokeCallback(callback, error, iccresult, attributes, cbDelay);
     }
     return status;
 }
@@ -475,31 +452,28 @@ telux::common::Status CardFileHandlerStub::requestEFAttributes(EfType efType,
 void CardFileHandlerStub::invokeCallback(EfGetFileAttributesCallback callback,
     telux::common::ErrorCode error, telux::tel::IccResult iccresult,
     telux::tel::FileAttributes attributes, int cbDelay ) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , iccresult, attributes, callback]() {
             callback(error, iccresult, attributes);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
 void CardFileHandlerStub::invokeCallback(EfReadAllRecordsCallback callback,
     telux::common::ErrorCode error, std::vector<IccResult> records, int cbDelay) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , records, callback]() {
             callback(error, records);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
 void CardFileHandlerStub::invokeCallback(EfOperationCallback callback,
     telux::common::ErrorCode error, telux::tel::IccResult iccresult, int cbDelay) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , iccresult, callback]() {
             callback(error, iccresult);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
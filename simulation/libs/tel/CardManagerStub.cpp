@@ -6,6 +6,7 @@
 #include "CardManagerStub.hpp"
 #include <telux/common/DeviceConfig.hpp>
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::common;
 
@@ -68,11 +69,10 @@ void CardManagerStub::setServiceStatus(telux::common::ServiceStatus status) {
         subSystemStatus_ = status;
     }
     if(initCb_) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay_,
         [this, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay_));
                 initCb_(status);
-        }).share();
+        });
         taskQ_->add(f1);
     } else {
         LOG(ERROR, __FUNCTION__, " Callback is NULL");
@@ -229,11 +229,7 @@ telux::common::Status CardManagerStub::cardPowerUp(SlotId slotId,
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback, delay]() {
-                this->invokeCallback(callback, error, delay);
-            }).share();
-        taskQ_->add(f1);
+        this->invokeCallback(callback, error, delay);
 
         if (error != telux::common::ErrorCode::NO_EFFECT) {
             int slotid = static_cast<int>(slotId);
@@ -249,11 +245,10 @@ telux::common::Status CardManagerStub::cardPowerUp(SlotId slotId,
 
 void CardManagerStub::invokeCallback(telux::common::ResponseCallback callback,
     telux::common::ErrorCode error, int cbDelay ) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, error , callback]() {
             callback(error);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -297,11 +292,7 @@ telux::common::Status CardManagerStub::cardPowerDown(SlotId slotId,
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback, delay]() {
-                this->invokeCallback(callback, error, delay);
-            }).share();
-        taskQ_->add(f1);
+        this->invokeCallback(callback, error, delay);
 
         if (error != telux::common::ErrorCode::NO_EFFECT) {
             int slotid = static_cast<int>(slotId);
@@ -585,11 +576,10 @@ telux::common::Status CardManagerStub::requestLastRefreshEvent(SlotId slotId,
             respRefreshParams.aid         = respRefreshs->aid();;
         }
 
-        auto f = std::async(std::launch::async,
-            [this, stage, mode, efFiles, respRefreshParams, error, callback, delay]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, stage, mode, efFiles, respRefreshParams, error, callback]() {
             callback(stage, mode, efFiles, respRefreshParams, error);
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
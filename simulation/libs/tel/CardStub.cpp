@@ -34,6 +34,7 @@
 
 #include "CardStub.hpp"
 #include "common/CommonUtils.hpp"
+#include "common/TimerService.hpp"
 #include <thread>
 namespace telux {
 
@@ -146,10 +147,10 @@ telux::common::Status CardStub::openLogicalChannel(
             "payload " ,iccresult.payload );
 
         if((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
-            auto f = std::async(std::launch::async,
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
              [this, delay, callback, channel, iccresult, error]() {
                    this->invokeCallback(callback, channel, iccresult, error, delay);
-             }).share();
+             });
             taskQ_->add(f);
         }
         return status;
@@ -163,7 +164,6 @@ telux::common::Status CardStub::openLogicalChannel(
 void CardStub::invokeCallback(std::shared_ptr<ICardChannelCallback> callback, int channel,
     IccResult result, telux::common::ErrorCode error, int delay) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
 
     if(callback) {
         callback->onChannelResponse(channel, result, error);
@@ -189,10 +189,10 @@ telux::common::Status CardStub::closeLogicalChannel(
     int delay = static_cast<int>(response.delay());
 
     if((isCallbackNeeded) && (status == telux::common::Status::SUCCESS )) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
         [this, callback, delay, error]() {
             this->invokeCallback(callback, delay, error);
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
@@ -201,7 +201,6 @@ telux::common::Status CardStub::closeLogicalChannel(
 void CardStub::invokeCallback(std::shared_ptr<telux::common::ICommandResponseCallback> callback,
     int delay, telux::common::ErrorCode error ) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
 
     if (callback) {
         callback->commandResponse(error);
@@ -247,10 +246,10 @@ telux::common::Status CardStub::transmitApduLogicalChannel(int channel, uint8_t
         "sw2 " ,iccresult.sw2,"payload " ,iccresult.payload, "status", static_cast<int>(status));
 
     if((isCallbackNeeded) && (status == telux::common::Status::SUCCESS )) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
             [this, delay, iccresult, error , callback]() {
                 this->invokeCallback(callback, delay, iccresult, error);
-            }).share();
+            });
         taskQ_->add(f);
     }
     return status;
@@ -259,7 +258,6 @@ telux::common::Status CardStub::transmitApduLogicalChannel(int channel, uint8_t
 void CardStub::invokeCallback(std::shared_ptr<ICardCommandCallback> callback, int delay,
     telux::tel::IccResult iccresult, telux::common::ErrorCode error ) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
 
     if (callback) {
         callback->onResponse(iccresult, error);
@@ -305,10 +303,10 @@ telux::common::Status CardStub::transmitApduBasicChannel(uint8_t cla, uint8_t in
         "sw2 " ,iccresult.sw2,"payload " ,iccresult.payload);
 
     if((isCallbackNeeded) && (status == telux::common::Status::SUCCESS )) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
             [this, iccresult, error, callback, delay]() {
                 this->invokeCallback(callback, delay, iccresult, error);
-            }).share();
+            });
         taskQ_->add(f);
     }
     return status;
@@ -355,10 +353,10 @@ telux::common::Status CardStub::exchangeSimIO(uint16_t fileId, uint8_t command,
         "sw2 " ,iccresult.sw2,"payload " ,iccresult.payload);
 
     if((isCallbackNeeded) && (status == telux::common::Status::SUCCESS )) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
             [this, delay, iccresult, error , callback]() {
                 this->invokeCallback(callback, delay, iccresult, error);
-            }).share();
+            });
         taskQ_->add(f);
     }
     return status;
@@ -383,10 +381,10 @@ telux::common::Status CardStub::requestEid(EidResponseCallback callback) {
     int delay = static_cast<int>(response.delay());
 
     if((status == telux::common::Status::SUCCESS ) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(delay,
             [this, eid, error , callback, delay]() {
                 this->invokeCallback(callback, eid, delay, error);
-            }).share();
+            });
         taskQ_->add(f);
     }
     return status;
@@ -413,7 +411,6 @@ bool CardStub::isNtnProfileActive() {
 void CardStub::invokeCallback(EidResponseCallback callback, std::string eid, int delay,
     telux::common::ErrorCode error ) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
 
     if (callback) {
         callback(eid, error);
@@ -5,6 +5,7 @@
 
 #include "CellBroadcastManagerStub.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 
 #define DELAY 100
 using namespace telux::common;
@@ -63,10 +64,12 @@ std::future<bool> CellBroadcastManagerStub::onSubsystemReady() {
 void CellBroadcastManagerStub::invokeInitResponseCallback(telux::common::ServiceStatus cbStatus,
     telux::common::InitResponseCb callback) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(DELAY));
-
     if (callback) {
-        callback(cbStatus);
+        auto f = telux::common::TimerService::getInstance()->runAfter(DELAY,
+            [cbStatus, callback]() {
+                callback(cbStatus);
+            });
+        taskQ_->add(f);
     }
 }
 
@@ -132,11 +135,7 @@ telux::common::Status CellBroadcastManagerStub::updateMessageFilters(
     }
     telux::common::ErrorCode error = telux::common::ErrorCode::SUCCESS;
     if(callback) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback]() {
-                this->invokeCallback(callback, error);
-            }).share();
-        taskQ_->add(f1);
+        this->invokeCallback(callback, error);
     }
     return telux::common::Status::SUCCESS;
 }
@@ -150,23 +149,18 @@ telux::common::Status CellBroadcastManagerStub::requestMessageFilters(
     std::vector<CellBroadcastFilter> filters = {};
     telux::common::ErrorCode error = telux::common::ErrorCode::SUCCESS;
     if(callback) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback, filters]() {
-                this->invokeCallback(callback, error, filters);
-            }).share();
-        taskQ_->add(f1);
+        this->invokeCallback(callback, error, filters);
     }
     return telux::common::Status::SUCCESS;
 }
 
 void CellBroadcastManagerStub::invokeCallback(RequestFiltersResponseCallback callback,
     telux::common::ErrorCode error, std::vector<CellBroadcastFilter> filters) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(DELAY));
     if(callback) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(DELAY,
             [this, error , filters, callback]() {
                 callback(filters, error);
-            }).share();
+            });
         taskQ_->add(f);
     }
 }
@@ -179,11 +173,7 @@ telux::common::Status CellBroadcastManagerStub::setActivationStatus(bool activat
     }
     telux::common::ErrorCode error = telux::common::ErrorCode::SUCCESS;
     if(callback) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback]() {
-                this->invokeCallback(callback, error);
-            }).share();
-        taskQ_->add(f1);
+        this->invokeCallback(callback, error);
     }
     return telux::common::Status::SUCCESS;
 }
@@ -197,35 +187,29 @@ telux::common::Status CellBroadcastManagerStub::requestActivationStatus(
     bool isActivated = true;
     telux::common::ErrorCode error = telux::common::ErrorCode::SUCCESS;
     if(callback) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback, isActivated]() {
-                this->invokeCallback(callback, error, isActivated);
-            }).share();
-        taskQ_->add(f1);
+        this->invokeCallback(callback, error, isActivated);
     }
     return telux::common::Status::SUCCESS;
 }
 
 void CellBroadcastManagerStub::invokeCallback(RequestActivationStatusResponseCallback callback,
     telux::common::ErrorCode error, bool isActivated) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(DELAY));
     if(callback) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(DELAY,
             [this, error , isActivated, callback]() {
                 callback(isActivated, error);
-            }).share();
+            });
         taskQ_->add(f);
     }
 }
 
 void CellBroadcastManagerStub::invokeCallback(telux::common::ResponseCallback callback,
     telux::common::ErrorCode error) {
-    std::this_thread::sleep_for(std::chrono::milliseconds(DELAY));
     if(callback) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(DELAY,
             [this, error , callback]() {
                 callback(error);
-            }).share();
+            });
         taskQ_->add(f);
     }
 }
@@ -6,7 +6,6 @@
 #include <sstream>
 #include <cstdint>
 #include <iomanip>
-#include <algorithm>
 
 #include "ECallMsd.hpp"
 
@@ -16,7 +15,6 @@
 #define MSD_VERSION_THREE 3
 
 #define MSD_PDU_SIZE 140  // in bytes
-#define INVALID -1
 
 #define ONE_BIT_FIELD 1
 #define THREE_BIT_FIELD 3
@@ -35,8 +33,6 @@
 #define DELTAV_MIN -255
 #define DELTAV_MAX 255
 
-#define MSD_PADDING 0
-
 #define POSITION_CONVERSION 2147483648LL
 #define N1N2_DELTA_CONVERSION 512
 
@@ -122,97 +118,64 @@ void ECallMsd::logMsd(const ECallMsdData &eCallMsdData) {
     LOG(DEBUG, "OAD:", dataString);
 }
 
-template <size_t bitsize>
-void ECallMsd::writeMsdPdu(std::bitset<bitsize> b, std::string &pdu) {
-    pdu.append(b.to_string());
+MsdBitWriter::MsdBitWriter(std::vector<uint8_t> &buffer)
+   : buffer_(buffer),
+     bitLength_(buffer.size() * BYTE_SIZE) {
 }
 
-int ECallMsd::calculateMsdMessageLength(const ECallMsdData &eCallMsdData, uint8_t msdVersion) {
-    int msdBitsLength = 0;
-    if (msdVersion == MSD_VERSION_TWO) {
-        msdBitsLength = MSD_VERSION_TWO_MANDATORY_FIELD_BITS;
-    } else if (msdVersion == MSD_VERSION_THREE) {
-        msdBitsLength = MSD_VERSION_THREE_MANDATORY_FIELD_BITS;
-    }
-    // Check for optional flag and update msdBits
-    bool isOptionalPresent = false;
-
-    if (msdVersion == MSD_VERSION_TWO) {
-        // Loc N1 present
-        isOptionalPresent = eCallMsdData.optionals.recentVehicleLocationN1Present;
-        if (isOptionalPresent) {
-            msdBitsLength += TEN_BIT_FIELD;  // lat
-            msdBitsLength += TEN_BIT_FIELD;  // long
-        }
-        // loc N2 present
-        isOptionalPresent = eCallMsdData.optionals.recentVehicleLocationN2Present;
-        if (isOptionalPresent) {
-            msdBitsLength += TEN_BIT_FIELD;  // lat
-            msdBitsLength += TEN_BIT_FIELD;  // long
+void MsdBitWriter::write(uint64_t value, uint32_t noOfBits) {
+    // Fill the last byte first and then continue with whole bytes, MSB first
+    while (noOfBits > 0) {
+        uint32_t usedBits = bitLength_ % BYTE_SIZE;
+        if (usedBits == 0) {
+            buffer_.push_back(0);
         }
+        uint32_t freeBits = BYTE_SIZE - usedBits;
+        uint32_t chunk    = (noOfBits < freeBits) ? noOfBits : freeBits;
+        noOfBits -= chunk;
+        uint8_t bits = static_cast<uint8_t>((value >> noOfBits) & ((1u << chunk) - 1));
+        buffer_.back() |= static_cast<uint8_t>(bits << (freeBits - chunk));
+        bitLength_ += chunk;
     }
+}
 
-    // No.of passengers
-    isOptionalPresent = eCallMsdData.optionals.numberOfPassengersPresent;
-    if (isOptionalPresent) {
-        msdBitsLength += EIGHT_BIT_FIELD;
-    }
+void MsdBitWriter::alignToByte() {
+    // The unused bits of the last byte are already zero
+    bitLength_ = buffer_.size() * BYTE_SIZE;
+}
 
-    isOptionalPresent = eCallMsdData.optionals.optionalDataPresent;
-    if (isOptionalPresent) {
-        LOG(DEBUG, __FUNCTION__, " Optional data present");
-        // Octet oid
-        std::string oidString = eCallMsdData.optionalPdu.oid;
-        if (!oidString.empty()) {
-            msdBitsLength += EIGHT_BIT_FIELD;  // OID Content length store in byte
-            int oidLen = getEncodedOIDLengthInBits(oidString);
-            LOG(DEBUG, __FUNCTION__, " OID Content length in bits:", oidLen);
-            if (oidLen <= 0) {
-                LOG(ERROR, __FUNCTION__, " Invalid OID content");
-                return INVALID;
-            }
-            msdBitsLength += oidLen;
-        } else {
-            LOG(ERROR, __FUNCTION__, " Invalid OID content");
-            return INVALID;
-        }
-        std::vector<uint8_t> data = eCallMsdData.optionalPdu.data;
-        std::string oadString(data.begin(), data.end());
-        if (!oadString.empty()) {
-            // OAD contains encoded PDU, consider 2 characters for 1 byte of data.
-            if ((oadString.length() % 2) != 0) {
-                LOG(ERROR, __FUNCTION__, " Invalid OAD content");
-                return INVALID;
-            }
-            int length = oadString.length() / 2;
-            if (length > MAX_OAD_LENGTH) {
-                LOG(ERROR, __FUNCTION__, " Invalid OAD content for MSD version 2 or 3");
-                return INVALID;
-            } else {
-                msdBitsLength += EIGHT_BIT_FIELD;  // Additional DATA Content length store in byte
-                int oadLen = length * BYTE_SIZE;
-                LOG(DEBUG, __FUNCTION__, " OAD Content length in bits:", oadLen);
-                msdBitsLength += oadLen;
-            }
-        } else {
-            LOG(ERROR, __FUNCTION__, " Invalid OAD content");
-            return INVALID;
-        }
-    } else {
-        LOG(DEBUG, __FUNCTION__, " Optional data not present");
-    }
+uint32_t MsdBitWriter::getBitLength() const {
+    return bitLength_;
+}
 
-    // Add trailing bits to make a byte boundary
-    int leftOverBits = msdBitsLength % 8;
-    if (leftOverBits != 0) {
-        msdBitsLength = msdBitsLength + 8 - leftOverBits;
-    }
+MsdBitReader::MsdBitReader(const std::vector<uint8_t> &buffer, uint32_t bitOffset)
+   : buffer_(buffer),
+     bitPosition_(bitOffset),
+     isOverrun_(false) {
+}
 
-    LOG(DEBUG, __FUNCTION__, " msdBitsLength = ", msdBitsLength,
-        " in bytes = ", (msdBitsLength / 8));
+uint64_t MsdBitReader::read(uint32_t noOfBits) {
+    if (isOverrun_ || (bitPosition_ + noOfBits > buffer_.size() * BYTE_SIZE)) {
+        isOverrun_ = true;
+        return 0;
+    }
+    uint64_t value = 0;
+    while (noOfBits > 0) {
+        uint32_t usedBits = bitPosition_ % BYTE_SIZE;
+        uint32_t freeBits = BYTE_SIZE - usedBits;
+        uint32_t chunk    = (noOfBits < freeBits) ? noOfBits : freeBits;
+        uint8_t bits      = buffer_[bitPosition_ / BYTE_SIZE] >> (freeBits - chunk);
+        value = (value << chunk) | (bits & ((1u << chunk) - 1));
+        noOfBits -= chunk;
+        bitPosition_ += chunk;
+    }
+    return value;
+}
 
-    return msdBitsLength / 8;
+bool MsdBitReader::isOverrun() const {
+    return isOverrun_;
 }
+
 /**
  * Write printable Pdu From String according to ISO 3779 specification for VIN
  * This function converts the VIN characters to printable string format.
@@ -221,20 +184,21 @@ int ECallMsd::calculateMsdMessageLength(const ECallMsdData &eCallMsdData, uint8_
  *     "A"  .. "H" |"J"  .. "N" |"P" |"R"  .. "Z" |"0"  .. "9"
  *     ASN.1 will map the above characters to:
  *     0x0a .. 0x11|0x12 .. 0x16|0x17|0x18 .. 0x20|0x00 .. 0x09
- * @param input denotes user provided VIN string
- * @param pdu denotes the msd pdu being constructed
- * @param pduBitPosition denotes the bit position where the next bit needs to be
- * written
- * @returns pdu denotes the msd pdu constructed
- * @returns pduBitPosition denotes the updated bit position where the next bit
- * needs to be written
+ * Optional additional data is a hex string, each character is written as a 4 bit nibble.
+ * @param input denotes user provided VIN or optional additional data string
+ * @param writer denotes the msd pdu being constructed
  */
-void ECallMsd::writePrintableString(std::string input, std::string &msdPdu, bool optionalData) {
+void ECallMsd::writePrintableString(std::string input, MsdBitWriter &writer, bool optionalData) {
     // TODO: we have defines for these numbers : 48, 55, etc.
     for (unsigned int character = 0; character < input.length(); ++character) {
         uint8_t convertedChar = 0;
         if ((input[character] >= '0') && (input[character] <= '9')) {
             convertedChar = (input[character] - 48);
+        } else if (optionalData && (input[character] >= 'a') && (input[character] <= 'f')) {
+            convertedChar = (input[character] - 87);
+        } else if (optionalData && ((input[character] < 'A') || (input[character] > 'F'))) {
+            LOG(ERROR, "writePrintableString Unsupported Char: ", input[character]);
+            convertedChar = 0x00;
         } else if ((input[character] >= 'A') && (input[character] <= 'H')) {
             convertedChar = (input[character] - 55);
         } else if ((input[character] >= 'J') && (input[character] <= 'N')) {
@@ -247,22 +211,42 @@ void ECallMsd::writePrintableString(std::string input, std::string &msdPdu, bool
             LOG(ERROR, "writePrintableString Unsupported Char: ", input[character]);
             convertedChar = 0x00;
         }
-        LOG(DEBUG, "writePrintableString convertedChar: ", (int)convertedChar);
-        if (optionalData) {
-            writeMsdPdu(std::bitset<FOUR_BIT_FIELD>(convertedChar), msdPdu);
+        writer.write(convertedChar, optionalData ? FOUR_BIT_FIELD : SIX_BIT_FIELD);
+    }
+}
+
+/**
+ * Reverse of writePrintableString for the VIN characters.
+ */
+bool ECallMsd::readPrintableString(MsdBitReader &reader, uint32_t length, std::string &output) {
+    output.clear();
+    for (uint32_t character = 0; character < length; ++character) {
+        uint8_t value = static_cast<uint8_t>(reader.read(SIX_BIT_FIELD));
+        if (value <= 0x09) {
+            output.append(1, static_cast<char>(value + 48));
+        } else if (value <= 0x11) {
+            output.append(1, static_cast<char>(value + 55));
+        } else if (value <= 0x16) {
+            output.append(1, static_cast<char>(value + 56));
+        } else if (value == 0x17) {
+            output.append(1, static_cast<char>(value + 57));
+        } else if (value <= 0x20) {
+            output.append(1, static_cast<char>(value + 58));
         } else {
-            writeMsdPdu(std::bitset<SIX_BIT_FIELD>(convertedChar), msdPdu);
+            LOG(ERROR, __FUNCTION__, " Unsupported value: ", static_cast<int>(value));
+            return false;
         }
     }
+    return true;
 }
 
 /**
  * Vehicle Identification Number
  */
-void ECallMsd::writeVehicleIdentification(const ECallMsdData &eCallMsdData, std::string &msdPdu) {
+void ECallMsd::writeVehicleIdentification(const ECallMsdData &eCallMsdData, MsdBitWriter &writer) {
     LOG(DEBUG, "eCallMsdData.vehicleIdentificationNumber.isowmi: ",
         eCallMsdData.vehicleIdentificationNumber.isowmi);
-    writePrintableString(eCallMsdData.vehicleIdentificationNumber.isowmi, msdPdu, false);
+    writePrintableString(eCallMsdData.vehicleIdentificationNumber.isowmi, writer, false);
 
     LOG(DEBUG, "eCallMsdData.vehicleIdentificationNumber.isovds: ",
         eCallMsdData.vehicleIdentificationNumber.isovds);
@@ -274,7 +258,7 @@ void ECallMsd::writeVehicleIdentification(const ECallMsdData &eCallMsdData, std:
         return;
     }
 
-    writePrintableString(eCallMsdData.vehicleIdentificationNumber.isovds, msdPdu, false);
+    writePrintableString(eCallMsdData.vehicleIdentificationNumber.isovds, writer, false);
 
     if (eCallMsdData.vehicleIdentificationNumber.isovisModelyear.length() != 1) {
         LOG(ERROR,
@@ -283,7 +267,7 @@ void ECallMsd::writeVehicleIdentification(const ECallMsdData &eCallMsdData, std:
     }
     LOG(DEBUG, "eCallMsdData.vehicleIdentificationNumber.isovisModelyear: ",
         eCallMsdData.vehicleIdentificationNumber.isovisModelyear);
-    writePrintableString(eCallMsdData.vehicleIdentificationNumber.isovisModelyear, msdPdu, false);
+    writePrintableString(eCallMsdData.vehicleIdentificationNumber.isovisModelyear, writer, false);
 
     if (eCallMsdData.vehicleIdentificationNumber.isovisSeqPlant.length() != 7) {
         LOG(ERROR,
@@ -292,110 +276,70 @@ void ECallMsd::writeVehicleIdentification(const ECallMsdData &eCallMsdData, std:
     }
     LOG(DEBUG, "eCallMsdData.vehicleIdentificationNumber.isovisSeqPlant: ",
         eCallMsdData.vehicleIdentificationNumber.isovisSeqPlant);
-    writePrintableString(eCallMsdData.vehicleIdentificationNumber.isovisSeqPlant, msdPdu, false);
+    writePrintableString(eCallMsdData.vehicleIdentificationNumber.isovisSeqPlant, writer, false);
 }
 
 /**
  * Vehicle Propulsion Storage
  */
 void ECallMsd::writeVehiclePropulsionStorage(
-    const ECallMsdData &eCallMsdData, std::string &msdPdu) {
+    const ECallMsdData &eCallMsdData, MsdBitWriter &writer) {
     LOG(DEBUG, __FUNCTION__);
+    const ECallVehiclePropulsionStorageType &storage = eCallMsdData.vehiclePropulsionStorage;
 
     /* Extension Marker for the Sequence: VehiclePropulsionStorageType */
     /* Value of 0 to represent no extension additions */
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(0), msdPdu);
+    writer.write(0, ONE_BIT_FIELD);
 
     // No of fuel storage types 7
-    writeMsdPdu(std::bitset<SEVEN_BIT_FIELD>(NO_OF_STORAGE_TYPE), msdPdu);
-
-    bool isPresent = false;
-
-    // gasolineTankPresent
-    isPresent = eCallMsdData.vehiclePropulsionStorage.gasolineTankPresent;
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isPresent ? 1 : 0), msdPdu);
-    LOG(DEBUG, "eCallMsdData.vehiclePropulsionStorage.gasolineTankPresent:",
-        eCallMsdData.vehiclePropulsionStorage.gasolineTankPresent);
-
-    // dieselTankPresent
-    isPresent = eCallMsdData.vehiclePropulsionStorage.dieselTankPresent;
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isPresent ? 1 : 0), msdPdu);
-    LOG(DEBUG, "eCallMsdData.vehiclePropulsionStorage.dieselTankPresent:",
-        eCallMsdData.vehiclePropulsionStorage.dieselTankPresent);
-
-    // compressedNaturalGas
-    isPresent = eCallMsdData.vehiclePropulsionStorage.compressedNaturalGas;
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isPresent ? 1 : 0), msdPdu);
-    LOG(DEBUG, "eCallMsdData.vehiclePropulsionStorage.compressedNaturalGas:",
-        eCallMsdData.vehiclePropulsionStorage.compressedNaturalGas);
-
-    // liquidPropaneGas
-    isPresent = eCallMsdData.vehiclePropulsionStorage.liquidPropaneGas;
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isPresent ? 1 : 0), msdPdu);
-    LOG(DEBUG, "eCallMsdData.vehiclePropulsionStorage.liquidPropaneGas:",
-        eCallMsdData.vehiclePropulsionStorage.liquidPropaneGas);
-
-    // electricEnergyStorage
-    isPresent = eCallMsdData.vehiclePropulsionStorage.electricEnergyStorage;
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isPresent ? 1 : 0), msdPdu);
-    LOG(DEBUG, "eCallMsdData.vehiclePropulsionStorage.electricEnergyStorage:",
-        eCallMsdData.vehiclePropulsionStorage.electricEnergyStorage);
-
-    // hydrogenStorage
-    isPresent = eCallMsdData.vehiclePropulsionStorage.hydrogenStorage;
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isPresent ? 1 : 0), msdPdu);
-    LOG(DEBUG, "eCallMsdData.vehiclePropulsionStorage.hydrogenStorage:",
-        eCallMsdData.vehiclePropulsionStorage.hydrogenStorage);
-
-    // OTHER_STORAGE
-    isPresent = eCallMsdData.vehiclePropulsionStorage.otherStorage;
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isPresent ? 1 : 0), msdPdu);
-    LOG(DEBUG, "eCallMsdData.vehiclePropulsionStorage.otherStorage:",
-        eCallMsdData.vehiclePropulsionStorage.otherStorage);
+    writer.write(NO_OF_STORAGE_TYPE, SEVEN_BIT_FIELD);
+
+    writer.write(storage.gasolineTankPresent ? 1 : 0, ONE_BIT_FIELD);
+    writer.write(storage.dieselTankPresent ? 1 : 0, ONE_BIT_FIELD);
+    writer.write(storage.compressedNaturalGas ? 1 : 0, ONE_BIT_FIELD);
+    writer.write(storage.liquidPropaneGas ? 1 : 0, ONE_BIT_FIELD);
+    writer.write(storage.electricEnergyStorage ? 1 : 0, ONE_BIT_FIELD);
+    writer.write(storage.hydrogenStorage ? 1 : 0, ONE_BIT_FIELD);
+    writer.write(storage.otherStorage ? 1 : 0, ONE_BIT_FIELD);
 }
 
 void ECallMsd::writeVehicleLocationDelta(
-    const ECallMsdData &eCallMsdData, std::string &msdPdu, int16_t latitude, int16_t longitude) {
-    writeMsdPdu(std::bitset<TEN_BIT_FIELD>(latitude + N1N2_DELTA_CONVERSION), msdPdu);
-    writeMsdPdu(std::bitset<TEN_BIT_FIELD>(longitude + N1N2_DELTA_CONVERSION), msdPdu);
+    const ECallMsdData &eCallMsdData, MsdBitWriter &writer, int16_t latitude, int16_t longitude) {
+    writer.write(latitude + N1N2_DELTA_CONVERSION, TEN_BIT_FIELD);
+    writer.write(longitude + N1N2_DELTA_CONVERSION, TEN_BIT_FIELD);
     LOG(DEBUG, "eCallMsdData.recentVehicleLocation ( N1 or N2) latitude: ", latitude,
         ", longitude: ", longitude);
 }
 
 telux::common::Status ECallMsd::writeOptionalAdditionalData(
-    const ECallMsdData &eCallMsdData, std::string &msdPdu) {
+    const ECallMsdData &eCallMsdData, MsdBitWriter &writer) {
     telux::common::Status status = telux::common::Status::FAILED;
     LOG(DEBUG, __FUNCTION__);
-    status = writeOid(eCallMsdData, msdPdu);
+    status = writeOid(eCallMsdData, writer);
     if (status != telux::common::Status::SUCCESS) {
         return status;
     }
-    status = writeOptionalData(eCallMsdData, msdPdu);
+    status = writeOptionalData(eCallMsdData, writer);
     return status;
 }
 
-telux::common::Status ECallMsd::writeOid(const ECallMsdData &eCallMsdData, std::string &msdPdu) {
-    std::vector<int> encodedOid;
+telux::common::Status ECallMsd::writeOid(const ECallMsdData &eCallMsdData, MsdBitWriter &writer) {
     std::string oidString = eCallMsdData.optionalPdu.oid;
-    if (!oidString.empty()) {
-        std::vector<int> octets = convertOidToOctets(oidString);
-        encodedOid              = uperEncodingForOctets(octets);
-        LOG(DEBUG, __FUNCTION__, " OID length = ", encodedOid.size());
-        if (encodedOid.size() <= 0) {
-            LOG(ERROR, __FUNCTION__, " Invalid OID content");
-            return telux::common::Status::INVALIDPARAM;
-        }
-        // Write OID size to pdu
-        writeMsdPdu(std::bitset<EIGHT_BIT_FIELD>(encodedOid.size()), msdPdu);
-        for (unsigned int index = 0; index < encodedOid.size(); index++) {
-            LOG(DEBUG, __FUNCTION__, " encodedOid: ", encodedOid[index]);
-            // Write OID content to PDU
-            writeMsdPdu(std::bitset<EIGHT_BIT_FIELD>(encodedOid[index]), msdPdu);
-        }
-    } else {
+    if (oidString.empty()) {
         LOG(ERROR, __FUNCTION__, " Invalid OID content");
         return telux::common::Status::INVALIDPARAM;
     }
+    std::vector<uint8_t> encodedOid = uperEncodingForOctets(convertOidToOctets(oidString));
+    LOG(DEBUG, __FUNCTION__, " OID length = ", encodedOid.size());
+    if (encodedOid.empty() || (encodedOid.size() > MSD_PDU_SIZE)) {
+        LOG(ERROR, __FUNCTION__, " Invalid OID content");
+        return telux::common::Status::INVALIDPARAM;
+    }
+    // Write OID size and content to pdu
+    writer.write(encodedOid.size(), EIGHT_BIT_FIELD);
+    for (auto octet : encodedOid) {
+        writer.write(octet, EIGHT_BIT_FIELD);
+    }
     return telux::common::Status::SUCCESS;
 }
 
@@ -403,8 +347,8 @@ telux::common::Status ECallMsd::writeOid(const ECallMsdData &eCallMsdData, std::
  * MSD optional data
  */
 telux::common::Status ECallMsd::writeOptionalData(
-    const ECallMsdData &eCallMsdData, std::string &msdPdu) {
-    std::vector<uint8_t> data = eCallMsdData.optionalPdu.data;
+    const ECallMsdData &eCallMsdData, MsdBitWriter &writer) {
+    const std::vector<uint8_t> &data = eCallMsdData.optionalPdu.data;
     std::string oadString(data.begin(), data.end());
     if (!oadString.empty()) {
         if ((oadString.length() % 2) != 0) {
@@ -418,9 +362,9 @@ telux::common::Status ECallMsd::writeOptionalData(
         } else {
             LOG(DEBUG, __FUNCTION__, " datalen = ", dataLen);
             // Additional DATA Content size write to pdu
-            writeMsdPdu(std::bitset<EIGHT_BIT_FIELD>(dataLen), msdPdu);
+            writer.write(dataLen, EIGHT_BIT_FIELD);
             // OAD can contain printable character, convert to 4 bit binary and write to pdu.
-            writePrintableString(oadString, msdPdu, true);
+            writePrintableString(oadString, writer, true);
         }
     } else {
         LOG(DEBUG, __FUNCTION__, " Optional additional data is not present");
@@ -441,7 +385,6 @@ telux::common::Status ECallMsd::writeOptionalData(
 telux::common::Status ECallMsd::generateECallMsd(
     const ECallMsdData &eCallMsdData, std::vector<uint8_t> &pdu) {
     LOG(DEBUG, __FUNCTION__);
-    std::string msdPdu = "";
 
     // Decoding logic is based on MSD version provided in eCallMsdData.msdVersion field
     // Supports MSD Version-2: CEN 15722 2015 and MSD Version-3: CEN 15722 2020
@@ -450,29 +393,24 @@ telux::common::Status ECallMsd::generateECallMsd(
         LOG(ERROR, __FUNCTION__, " Unsupported msdVersion: ", (int)msdVersion);
         return telux::common::Status::INVALIDPARAM;
     }
-    writeMsdPdu(std::bitset<EIGHT_BIT_FIELD>(msdVersion), msdPdu);
-
-    int pduSize = calculateMsdMessageLength(eCallMsdData, msdVersion);
-    LOG(DEBUG, __FUNCTION__, " PDU Size = ", pduSize);
 
-    if ((msdVersion == MSD_VERSION_TWO)
-        && (pduSize < (MSD_VERSION_TWO_MANDATORY_FIELD_BITS / BYTE_SIZE))) {
-        return telux::common::Status::FAILED;
-    } else if ((msdVersion == MSD_VERSION_THREE)
-               && (pduSize < (MSD_VERSION_THREE_MANDATORY_FIELD_BITS / BYTE_SIZE))) {
-        return telux::common::Status::FAILED;
-    }
-    writeMsdPdu(std::bitset<EIGHT_BIT_FIELD>(pduSize), msdPdu);
+    // The PDU size byte is filled in once the message has been written, as the writer
+    // tracks the exact number of bits encoded.
+    std::vector<uint8_t> msdPdu;
+    msdPdu.reserve(MSD_PDU_SIZE);
+    msdPdu.push_back(msdVersion);
+    msdPdu.push_back(0);
+    MsdBitWriter writer(msdPdu);
 
     // OPTIONALS - START
     // Extension Marker or flag for the Sequence: MSDMessage
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(0), msdPdu);
+    writer.write(0, ONE_BIT_FIELD);
     // OPTIONAL optionalAdditionalData.Present
     bool isOptionalDataPresent = eCallMsdData.optionals.optionalDataPresent;
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isOptionalDataPresent ? 1 : 0), msdPdu);
+    writer.write(isOptionalDataPresent ? 1 : 0, ONE_BIT_FIELD);
 
     // Extension Marker for the Sequence: MSDStructure
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(0), msdPdu);
+    writer.write(0, ONE_BIT_FIELD);
 
     // N1 present
     bool isN1LocPresent = eCallMsdData.optionals.recentVehicleLocationN1Present;
@@ -481,8 +419,8 @@ telux::common::Status ECallMsd::generateECallMsd(
     // recentVehicleLocationN1 and recentVehicleLocationN2 are optional fields only in MSD
     // version-2. These are mandatory fields in MSD version-3.
     if (msdVersion == MSD_VERSION_TWO) {
-        writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isN1LocPresent ? 1 : 0), msdPdu);
-        writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isN2LocPresent ? 1 : 0), msdPdu);
+        writer.write(isN1LocPresent ? 1 : 0, ONE_BIT_FIELD);
+        writer.write(isN2LocPresent ? 1 : 0, ONE_BIT_FIELD);
     } else if (!isN1LocPresent || !isN2LocPresent) {
         LOG(ERROR, __FUNCTION__, " isN1LocPresent(", isN1LocPresent, ") or isN2LocPresent(",
             isN2LocPresent, ") are not SET for MSDv3");
@@ -490,110 +428,215 @@ telux::common::Status ECallMsd::generateECallMsd(
     }
     // No.of passengers
     bool isNoPassengerPresent = eCallMsdData.optionals.numberOfPassengersPresent;
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(isNoPassengerPresent ? 1 : 0), msdPdu);
+    writer.write(isNoPassengerPresent ? 1 : 0, ONE_BIT_FIELD);
     // OPTIONALS - END
 
     // message identifier
-    writeMsdPdu(std::bitset<EIGHT_BIT_FIELD>(eCallMsdData.messageIdentifier), msdPdu);
+    writer.write(eCallMsdData.messageIdentifier, EIGHT_BIT_FIELD);
 
     // Mandatory fields CONTROL
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(eCallMsdData.control.automaticActivation), msdPdu);
+    writer.write(eCallMsdData.control.automaticActivation, ONE_BIT_FIELD);
 
     // test call
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(eCallMsdData.control.testCall), msdPdu);
+    writer.write(eCallMsdData.control.testCall, ONE_BIT_FIELD);
 
     // Position Can Be Trusted
-    writeMsdPdu(std::bitset<ONE_BIT_FIELD>(eCallMsdData.control.positionCanBeTrusted), msdPdu);
+    writer.write(eCallMsdData.control.positionCanBeTrusted, ONE_BIT_FIELD);
 
     // Extension Marker for vehicleType
     if (msdVersion == MSD_VERSION_THREE) {
-        writeMsdPdu(std::bitset<ONE_BIT_FIELD>(0), msdPdu);
+        writer.write(0, ONE_BIT_FIELD);
     }
 
     // eCall_vehicletype
-    writeMsdPdu(std::bitset<FIVE_BIT_FIELD>(eCallMsdData.control.vehicleType), msdPdu);
+    writer.write(static_cast<uint64_t>(eCallMsdData.control.vehicleType), FIVE_BIT_FIELD);
     // Vehicle Identification Number
-    writeVehicleIdentification(eCallMsdData, msdPdu);
+    writeVehicleIdentification(eCallMsdData, writer);
 
     // Vehicle Propulsion Storage
-    writeVehiclePropulsionStorage(eCallMsdData, msdPdu);
+    writeVehiclePropulsionStorage(eCallMsdData, writer);
 
     // time stamp
-    writeMsdPdu(std::bitset<THIRTYTWO_BIT_FIELD>(eCallMsdData.timestamp), msdPdu);
+    writer.write(eCallMsdData.timestamp, THIRTYTWO_BIT_FIELD);
 
     // vehicleLocation + POSITION_CONVERSION
-    writeMsdPdu(std::bitset<THIRTYTWO_BIT_FIELD>(
-                    eCallMsdData.vehicleLocation.positionLatitude + POSITION_CONVERSION),
-        msdPdu);
-    writeMsdPdu(std::bitset<THIRTYTWO_BIT_FIELD>(
-                    eCallMsdData.vehicleLocation.positionLongitude + POSITION_CONVERSION),
-        msdPdu);
+    writer.write(eCallMsdData.vehicleLocation.positionLatitude + POSITION_CONVERSION,
+        THIRTYTWO_BIT_FIELD);
+    writer.write(eCallMsdData.vehicleLocation.positionLongitude + POSITION_CONVERSION,
+        THIRTYTWO_BIT_FIELD);
 
     // vehicleDirection
-    writeMsdPdu(std::bitset<EIGHT_BIT_FIELD>(eCallMsdData.vehicleDirection), msdPdu);
+    writer.write(eCallMsdData.vehicleDirection, EIGHT_BIT_FIELD);
 
     // N1
     if (isN1LocPresent || (msdVersion == MSD_VERSION_THREE)) {
-        writeVehicleLocationDelta(eCallMsdData, msdPdu,
+        writeVehicleLocationDelta(eCallMsdData, writer,
             eCallMsdData.recentVehicleLocationN1.latitudeDelta,
             eCallMsdData.recentVehicleLocationN1.longitudeDelta);
     }
 
     // N2
     if (isN2LocPresent || (msdVersion == MSD_VERSION_THREE)) {
-        writeVehicleLocationDelta(eCallMsdData, msdPdu,
+        writeVehicleLocationDelta(eCallMsdData, writer,
             eCallMsdData.recentVehicleLocationN2.latitudeDelta,
             eCallMsdData.recentVehicleLocationN2.longitudeDelta);
     }
 
     // # of passengers
     if (isNoPassengerPresent) {
-        writeMsdPdu(std::bitset<EIGHT_BIT_FIELD>(eCallMsdData.numberOfPassengers), msdPdu);
+        writer.write(eCallMsdData.numberOfPassengers, EIGHT_BIT_FIELD);
     }
 
     // Optional additional data
     if (isOptionalDataPresent) {
-        telux::common::Status status = writeOptionalAdditionalData(eCallMsdData, msdPdu);
-        if (status != telux::common::Status::SUCCESS) {
-            return status;
+        LOG(DEBUG, __FUNCTION__, " Optional data present");
+        if (writeOptionalAdditionalData(eCallMsdData, writer) != telux::common::Status::SUCCESS) {
+            return telux::common::Status::FAILED;
         }
     }
 
     // set trailing bits to zero
-    while (msdPdu.length() % 8 != 0) {
-        writeMsdPdu(std::bitset<ONE_BIT_FIELD>(MSD_PADDING), msdPdu);
-    }
+    writer.alignToByte();
 
-    // Clear the provided input vector
-    pdu.clear();
-    // Convert bit representation into vector of uints
-    for (unsigned int i = 0; i < msdPdu.length(); i = i + 8) {
-        std::string sstr = msdPdu.substr(i, 8);
-        uint8_t val      = std::stoi(sstr, nullptr, 2);
-        pdu.push_back(val);
+    // Size of the message excluding the version and size bytes
+    int pduSize = msdPdu.size() - 2;
+    LOG(DEBUG, __FUNCTION__, " PDU Size = ", pduSize, " for ", writer.getBitLength(), " bits");
+    if ((msdVersion == MSD_VERSION_TWO)
+        && (pduSize < (MSD_VERSION_TWO_MANDATORY_FIELD_BITS / BYTE_SIZE))) {
+        return telux::common::Status::FAILED;
+    } else if ((msdVersion == MSD_VERSION_THREE)
+               && (pduSize < (MSD_VERSION_THREE_MANDATORY_FIELD_BITS / BYTE_SIZE))) {
+        return telux::common::Status::FAILED;
     }
+    msdPdu[1] = static_cast<uint8_t>(pduSize);
+    pdu.swap(msdPdu);
 
     std::stringstream ss;
     for (auto i : pdu) {
         ss << std::setw(2) << std::setfill('0') << std::uppercase << std::hex << (int)i;
     }
     LOG(DEBUG, __FUNCTION__, " PDU Hex String = ", ss.str());
-    if ((ss.str().length() / 2) > MSD_PDU_SIZE) {
+    if (pdu.size() > MSD_PDU_SIZE) {
         LOG(DEBUG, " ECall MSD pdu should not exceed 140 bytes");
         return telux::common::Status::FAILED;
     }
     return telux::common::Status::SUCCESS;
 }
 
-/*
- * Get encoded OID length in bits.
+/**
+ * Decode MSD PDU, reverse of generateECallMsd
+ * @param pdu denotes the msd pdu generated by generateECallMsd
+ * @param eCallMsdData is filled with the decoded fields
+ * @returns Status of decoding
  */
-int ECallMsd::getEncodedOIDLengthInBits(std::string oidString) {
-    std::vector<int> octets     = convertOidToOctets(oidString);
-    std::vector<int> encodedOid = uperEncodingForOctets(octets);
-    int oidLengthInBits         = (encodedOid.size() * BYTE_SIZE);
-    LOG(DEBUG, __FUNCTION__, " Oid length in bits, ", oidLengthInBits);
-    return oidLengthInBits;
+telux::common::Status ECallMsd::decodeECallMsd(
+    const std::vector<uint8_t> &pdu, ECallMsdData &eCallMsdData) {
+    LOG(DEBUG, __FUNCTION__);
+    if ((pdu.size() < 2) || (pdu.size() > MSD_PDU_SIZE) || (pdu[1] != pdu.size() - 2)) {
+        LOG(ERROR, __FUNCTION__, " Invalid PDU size: ", pdu.size());
+        return telux::common::Status::INVALIDPARAM;
+    }
+    uint8_t msdVersion = pdu[0];
+    if ((msdVersion != MSD_VERSION_TWO) && (msdVersion != MSD_VERSION_THREE)) {
+        LOG(ERROR, __FUNCTION__, " Unsupported msdVersion: ", (int)msdVersion);
+        return telux::common::Status::INVALIDPARAM;
+    }
+    ECallMsdData msdData;
+    msdData.msdVersion = msdVersion;
+    MsdBitReader reader(pdu, 2 * BYTE_SIZE);
+
+    // OPTIONALS, extension markers are skipped
+    reader.read(ONE_BIT_FIELD);
+    msdData.optionals.optionalDataPresent = reader.read(ONE_BIT_FIELD);
+    reader.read(ONE_BIT_FIELD);
+    if (msdVersion == MSD_VERSION_TWO) {
+        msdData.optionals.recentVehicleLocationN1Present = reader.read(ONE_BIT_FIELD);
+        msdData.optionals.recentVehicleLocationN2Present = reader.read(ONE_BIT_FIELD);
+    } else {
+        msdData.optionals.recentVehicleLocationN1Present = true;
+        msdData.optionals.recentVehicleLocationN2Present = true;
+    }
+    msdData.optionals.numberOfPassengersPresent = reader.read(ONE_BIT_FIELD);
+
+    msdData.messageIdentifier            = reader.read(EIGHT_BIT_FIELD);
+    msdData.control.automaticActivation  = reader.read(ONE_BIT_FIELD);
+    msdData.control.testCall             = reader.read(ONE_BIT_FIELD);
+    msdData.control.positionCanBeTrusted = reader.read(ONE_BIT_FIELD);
+    if (msdVersion == MSD_VERSION_THREE) {
+        reader.read(ONE_BIT_FIELD);
+    }
+    msdData.control.vehicleType = static_cast<ECallVehicleType>(reader.read(FIVE_BIT_FIELD));
+
+    ECallVehicleIdentificationNumber &vin = msdData.vehicleIdentificationNumber;
+    if (!readPrintableString(reader, 3, vin.isowmi) || !readPrintableString(reader, 6, vin.isovds)
+        || !readPrintableString(reader, 1, vin.isovisModelyear)
+        || !readPrintableString(reader, 7, vin.isovisSeqPlant)) {
+        return telux::common::Status::FAILED;
+    }
+
+    ECallVehiclePropulsionStorageType &storage = msdData.vehiclePropulsionStorage;
+    reader.read(ONE_BIT_FIELD);
+    reader.read(SEVEN_BIT_FIELD);
+    storage.gasolineTankPresent   = reader.read(ONE_BIT_FIELD);
+    storage.dieselTankPresent     = reader.read(ONE_BIT_FIELD);
+    storage.compressedNaturalGas  = reader.read(ONE_BIT_FIELD);
+    storage.liquidPropaneGas      = reader.read(ONE_BIT_FIELD);
+    storage.electricEnergyStorage = reader.read(ONE_BIT_FIELD);
+    storage.hydrogenStorage       = reader.read(ONE_BIT_FIELD);
+    storage.otherStorage          = reader.read(ONE_BIT_FIELD);
+
+    msdData.timestamp = reader.read(THIRTYTWO_BIT_FIELD);
+    msdData.vehicleLocation.positionLatitude
+        = static_cast<int64_t>(reader.read(THIRTYTWO_BIT_FIELD)) - POSITION_CONVERSION;
+    msdData.vehicleLocation.positionLongitude
+        = static_cast<int64_t>(reader.read(THIRTYTWO_BIT_FIELD)) - POSITION_CONVERSION;
+    msdData.vehicleDirection = reader.read(EIGHT_BIT_FIELD);
+
+    if (msdData.optionals.recentVehicleLocationN1Present) {
+        msdData.recentVehicleLocationN1.latitudeDelta
+            = static_cast<int>(reader.read(TEN_BIT_FIELD)) - N1N2_DELTA_CONVERSION;
+        msdData.recentVehicleLocationN1.longitudeDelta
+            = static_cast<int>(reader.read(TEN_BIT_FIELD)) - N1N2_DELTA_CONVERSION;
+    }
+    if (msdData.optionals.recentVehicleLocationN2Present) {
+        msdData.recentVehicleLocationN2.latitudeDelta
+            = static_cast<int>(reader.read(TEN_BIT_FIELD)) - N1N2_DELTA_CONVERSION;
+        msdData.recentVehicleLocationN2.longitudeDelta
+            = static_cast<int>(reader.read(TEN_BIT_FIELD)) - N1N2_DELTA_CONVERSION;
+    }
+    if (msdData.optionals.numberOfPassengersPresent) {
+        msdData.numberOfPassengers = reader.read(EIGHT_BIT_FIELD);
+    }
+
+    if (msdData.optionals.optionalDataPresent) {
+        // OID arcs in base 128, arcs are joined with '.'
+        uint32_t oidLen = reader.read(EIGHT_BIT_FIELD);
+        std::string oid;
+        uint64_t arc = 0;
+        for (uint32_t index = 0; index < oidLen; ++index) {
+            uint8_t octet = reader.read(EIGHT_BIT_FIELD);
+            arc           = (arc << 7) | (octet & 0x7f);
+            if (!(octet & 0x80)) {
+                oid.append(oid.empty() ? "" : ".").append(std::to_string(arc));
+                arc = 0;
+            }
+        }
+        msdData.optionalPdu.oid = oid;
+        // OAD nibbles as hex characters
+        uint32_t dataLen = reader.read(EIGHT_BIT_FIELD);
+        msdData.optionalPdu.data.clear();
+        for (uint32_t index = 0; index < dataLen * 2; ++index) {
+            uint8_t nibble = reader.read(FOUR_BIT_FIELD);
+            msdData.optionalPdu.data.push_back(nibble > 9 ? nibble + 55 : nibble + 48);
+        }
+    }
+
+    if (reader.isOverrun()) {
+        LOG(ERROR, __FUNCTION__, " PDU is shorter than its fields");
+        return telux::common::Status::FAILED;
+    }
+    eCallMsdData = msdData;
+    return telux::common::Status::SUCCESS;
 }
 
 /**
@@ -613,172 +656,29 @@ std::vector<int> ECallMsd::convertOidToOctets(std::string oid) {
 }
 
 /**
- * Returns encoded data corresponding to OID octets.
- */
-std::vector<int> ECallMsd::uperEncodingForOctets(std::vector<int> octetOids) {
-    std::vector<int> encodedOctets;
-    std::vector<int> tempOctets;
-    for (unsigned int index = 0; index < octetOids.size(); index++) {
-        tempOctets = processOctet(octetOids[index]);
-        encodedOctets.insert(encodedOctets.end(), tempOctets.begin(), tempOctets.end());
-        tempOctets.clear();
-    }
-    for (unsigned int index = 0; index < encodedOctets.size(); ++index) {
-        LOG(DEBUG, __FUNCTION__, " encodedOctets: ", encodedOctets[index]);
-    }
-    return encodedOctets;
-}
-
-/**
- * Returns vector after applying UPER encoding where octet value is less than or equal to 127
- * are pushed to cached encoded vector and values greater than 127 are encoded into multiple bytes
- * and pushed to cached encoded vector.
- */
-std::vector<int> ECallMsd::processOctet(int oidValue) {
-    std::vector<int> encodedOctets;
-    if (oidValue <= 127) {
-        encodedOctets.emplace_back(oidValue);
-    } else {
-        encodedOctets = encodingToMultiByte(oidValue);
-    }
-    return encodedOctets;
-}
-
-/**
- * Encode OID octet to multi byte using uper encoding if octet value is > 127.
+ * Returns encoded data corresponding to OID octets, an empty vector if any arc is negative.
  */
-std::vector<int> ECallMsd::encodingToMultiByte(int octet) {
-    std::vector<int> encodedOctets;
-    std::stringstream stream;
-    stream << std::hex << octet;
-    std::string result(stream.str());
-    LOG(DEBUG, __FUNCTION__, " Input Hex String: ", std::hex, result);
-    int counter = 0;
-    // In case of length with odd value, increment counter by 1 for encoding 2 bytes at a time
-    if (result.length() % 2 == 0) {
-        counter = result.length() / 2;
-    } else {
-        counter = result.length() / 2 + 1;
-    }
-    int temp       = octet;
-    int bitToCheck = 7;
-    // bitToCheck is used depending on counter value, for counter greater than 3
-    // bittocheck to decrement not otherwise
-    for (int i = 1; i < counter; i++) {
-        if (counter > 2) {
-            temp = temp >> 8;
-            bitToCheck--;
-        } else {
-            temp       = temp >> 8;
-            bitToCheck = 7;
-            break;
+std::vector<uint8_t> ECallMsd::uperEncodingForOctets(std::vector<int> octetOids) {
+    std::vector<uint8_t> encodedOctets;
+    for (auto arc : octetOids) {
+        if (arc < 0) {
+            LOG(ERROR, __FUNCTION__, " Invalid OID arc: ", arc);
+            return std::vector<uint8_t>();
         }
-    }
-    LOG(DEBUG, __FUNCTION__, " bitToCheck: ", bitToCheck);
-    // Iterate from leftmost bit till bitToCheck to see if any bit is 1,
-    // if yes increment the counter as another byte gets added during left shifting
-    for (int bit = 7; bit >= bitToCheck; bit--) {
-        int flag = ((temp >> bit) & 0x01);
-        LOG(DEBUG, __FUNCTION__, " flag: ", flag);
-        if (flag == 1) {
-            // Increment the counter if flag is set
-            counter = counter + 1;
-            break;
+        // Seven bits per octet, most significant group first
+        uint32_t value  = static_cast<uint32_t>(arc);
+        int groupsCount = 1;
+        while ((value >> (7 * groupsCount)) != 0) {
+            ++groupsCount;
         }
-    }
-
-    temp = octet;  // number which will contain the result
-    LOG(DEBUG, __FUNCTION__, " temp: ", temp);
-    int leftMostBit = 0;
-    for (int i = 0; i < counter; i++) {
-        // Right most byte is encoded, where leftmost bit is ignored
-        if (i == 0) {
-            int out = temp & 0x7f;  // Ignore left most bit and push the value to vector
-            encodedOctets.emplace_back(out);
-            leftMostBit = ((temp >> 7) & 0x01);  // Preserve left most bit of the value for use
-                                                 // with further encoding
-            LOG(DEBUG, __FUNCTION__, " leftMostBit ", leftMostBit);
-            LOG(DEBUG, __FUNCTION__, " temp: ", temp);
-        } else {
-            // Encoding of left most bytes
-            temp = temp >> 8;  // temp holds left most byte of the oid value
-            LOG(DEBUG, __FUNCTION__, " temp: ", temp);
-            int left = temp;
-            left     = left << 1;  // Bits left shift by 1
-            LOG(DEBUG, __FUNCTION__, " left: ", left);
-            temp = left;
-            left = left | 0x80;  // Setting left most bit as 1
-            left = left | leftMostBit;  // left most bit in above if condition was 1,
-                                        // Set left most bit as 1
-            LOG(DEBUG, __FUNCTION__, " leftMostBit: ", leftMostBit);
-            left = left & 0xff;  // separate out right most part i.e if value was 38D, left after
-                                 // this operation would be 8D
-            LOG(DEBUG, __FUNCTION__, " left: ", left);
-            encodedOctets.push_back(left);
-            leftMostBit = ((temp >> 7) & 0x01);  // preserve leftmost bit of byte from line 415
-            LOG(DEBUG, __FUNCTION__, " temp leftMostBit: ", leftMostBit);
+        for (int group = groupsCount - 1; group >= 0; --group) {
+            uint8_t octet = (value >> (7 * group)) & 0x7f;
+            encodedOctets.push_back(group ? (octet | 0x80) : octet);
         }
     }
-
-    std::reverse(encodedOctets.begin(), encodedOctets.end());
-    for (unsigned int i = 0; i < encodedOctets.size(); i++) {
-        LOG(DEBUG, __FUNCTION__, " encodedOctets ", encodedOctets[i]);
-    }
     return encodedOctets;
 }
 
-uint16_t ECallMsd::encodeOneByteField(
-    uint16_t bitOffset, uint16_t noOfBits, uint8_t *dataField, uint8_t *encodedData) {
-    LOG(DEBUG, __FUNCTION__);
-    std::vector<uint8_t> oneByteBitMask({0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01});
-    uint8_t bitOffsetPos = bitOffset & 0x07;
-    uint8_t bitPos       = 8 - ((noOfBits & 0x07) ? noOfBits & 0x07 : (noOfBits & 0x07) + 8);
-    encodedData += bitOffset >> 3;
-    for (uint16_t i = 0; i < noOfBits; i++) {
-        uint8_t val  = (*dataField) & oneByteBitMask[bitPos];
-        uint8_t mask = oneByteBitMask[bitPos];
-        int8_t shift = bitOffsetPos - bitPos;
-        if (shift >= 0) {
-            val >>= shift;
-            mask >>= shift;
-        } else {
-            val <<= (-shift);
-            mask <<= (-shift);
-        }
-
-        *encodedData &= ~mask;
-        *encodedData |= val;
-        bitPos++;
-        bitOffsetPos++;
-        if (bitPos > 7) {
-            dataField++;
-            bitPos = 0;
-        }
-        if (bitOffsetPos > 7) {
-            encodedData++;
-            bitOffsetPos = 0;
-        }
-    }
-    return bitOffset + noOfBits;
-}
-
-uint16_t ECallMsd::encodeTwoBytesField(
-    uint16_t bitOffset, uint16_t noOfBits, uint16_t *dataField, uint8_t *encodedData) {
-    LOG(DEBUG, __FUNCTION__);
-    uint16_t bitOffsetCurr = bitOffset;
-    std::vector<uint16_t> twoBytesBitMask({0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x100,
-        0x200, 0x400, 0x800, 0x1000, 0x2000, 0x4000, 0x8000});
-    for (uint16_t i = 0; i < noOfBits; i++) {
-        if ((*dataField & twoBytesBitMask[noOfBits - i - 1]) != 0) {
-            encodedData[bitOffsetCurr >> 3] |= 0x01 << (7 - (bitOffsetCurr & 0x07));
-        } else {
-            encodedData[bitOffsetCurr >> 3] &= ~(0x01 << (7 - (bitOffsetCurr & 0x07)));
-        }
-        bitOffsetCurr++;
-    }
-    return bitOffset + noOfBits;
-}
-
 /* Euro NCAP Optional additional data content encoding
 A.2.2 ASN.1 definition
 MSD_ADDITIIONAL_EURONCAP_1
@@ -833,94 +733,69 @@ Encoding of overall optional additional data.
 telux::common::Status ECallMsd::encodeEuroNcapOptionalAdditionalDataContent(
     ECallOptionalEuroNcapData optionalEuroNcapData, std::vector<uint8_t> &data) {
     LOG(DEBUG, __FUNCTION__);
-    auto status                                  = telux::common::Status::FAILED;
-    uint8_t extension_flag                       = 0;
-    int offset                                   = 0;
-    uint16_t msdOptionalAdditionalDataContentLen = 0;
-    uint8_t encodedData[MAX_OAD_LENGTH];
-    memset(encodedData, 0, sizeof(encodedData));
-    if (encodedData) {
-        // Extension Marker for the Sequence: INCINFO
-        offset = encodeOneByteField(offset, ONE_BIT_FIELD, &extension_flag, encodedData);
-        // rollOverDetected optional flag
-        offset = encodeOneByteField(offset, ONE_BIT_FIELD,
-            (uint8_t *)&optionalEuroNcapData.rollOverDetectedPresent, encodedData);
-        // Extension Marker for the Enumerated: ILocations
-        offset = encodeOneByteField(offset, ONE_BIT_FIELD, &extension_flag, encodedData);
-        // location of impact
-        int locationOfImpact = static_cast<int>(optionalEuroNcapData.locationOfImpact);
-        if (locationOfImpact < static_cast<int>(ECallLocationOfImpact::UNKNOWN)
-            || locationOfImpact > static_cast<int>(ECallLocationOfImpact::OTHER)) {
-            LOG(ERROR, __FUNCTION__, " invalid location of impact ", locationOfImpact);
-            status = telux::common::Status::INVALIDPARAM;
-            return status;
-        }
-        offset = encodeOneByteField(
-            offset, THREE_BIT_FIELD, (uint8_t *)&locationOfImpact, encodedData);
-        // rollOverDetected
-        if (optionalEuroNcapData.rollOverDetectedPresent) {
-            offset = encodeOneByteField(offset, ONE_BIT_FIELD,
-                (uint8_t *)&optionalEuroNcapData.rollOverDetected, encodedData);
-        }
-        // delta-v range limit
-        int rangeLimit = static_cast<int>(optionalEuroNcapData.deltaV.rangeLimit);
-        if (rangeLimit < RANGELIMIT_MIN || rangeLimit > RANGELIMIT_MAX) {
-            LOG(ERROR, __FUNCTION__, " invalid rangelimit = ", rangeLimit);
-            status = telux::common::Status::INVALIDPARAM;
-            return status;
-        }
-        rangeLimit = rangeLimit - RANGELIMIT_MIN;
-        // delta-v deltaVX
-        int16_t deltaVX = optionalEuroNcapData.deltaV.deltaVX;
-        if (deltaVX < DELTAV_MIN || deltaVX > DELTAV_MAX) {
-            LOG(ERROR, __FUNCTION__, " invalid deltaVX = ", deltaVX);
-            status = telux::common::Status::INVALIDPARAM;
-            return status;
-        }
-        deltaVX = deltaVX - DELTAV_MIN;
-        // delta-v deltaVY
-        int16_t deltaVY = optionalEuroNcapData.deltaV.deltaVY;
-        if (deltaVY < DELTAV_MIN || deltaVY > DELTAV_MAX) {
-            LOG(ERROR, __FUNCTION__, " invalid deltaVY = ", deltaVY);
-            status = telux::common::Status::INVALIDPARAM;
-            return status;
-        }
-        deltaVY = deltaVY - DELTAV_MIN;
-        // Extension Marker for the Sequence: IDeltaV
-        offset = encodeOneByteField(offset, ONE_BIT_FIELD, &extension_flag, encodedData);
-        offset = encodeOneByteField(offset, EIGHT_BIT_FIELD, (uint8_t *)&rangeLimit, encodedData);
-        offset = encodeTwoBytesField(offset, NINE_BIT_FIELD, (uint16_t *)&deltaVX, encodedData);
-        offset = encodeTwoBytesField(offset, NINE_BIT_FIELD, (uint16_t *)&deltaVY, encodedData);
-
-        if (offset % BYTE_SIZE) {
-            msdOptionalAdditionalDataContentLen = (offset / BYTE_SIZE) + 1;
-        } else {
-            msdOptionalAdditionalDataContentLen = (offset / BYTE_SIZE);
-        }
-        LOG(INFO, __FUNCTION__,
-            " MSD optional additional data content length = ", msdOptionalAdditionalDataContentLen,
-            " bytes for ", offset, " bits");
-        std::string oadDataString;
-        for (int i = 0; i < static_cast<int>(msdOptionalAdditionalDataContentLen); i++) {
-            char s1 = char(encodedData[i] >> 4);
-            char s2 = char(encodedData[i] & 0xf);
-            // if character is greater than 1 byte, add ascii value of 7(55),
-            // otherwise ascii value of 0(48) is added to character.
-            s1 > 9 ? s1 += 55 : s1 += 48;
-            s2 > 9 ? s2 += 55 : s2 += 48;
-            // append single character at the end
-            oadDataString.append(1, s1);
-            oadDataString.append(1, s2);
-        }
-        LOG(DEBUG, " Euro NCAP MSD OAD data content = ", oadDataString.c_str());
-        std::vector<uint8_t> encodedBytes(oadDataString.begin(), oadDataString.end());
-        // copy encoded data
-        data   = encodedBytes;
-        status = telux::common::Status::SUCCESS;
-    } else {
-        status = telux::common::Status::FAILED;
+    // location of impact
+    int locationOfImpact = static_cast<int>(optionalEuroNcapData.locationOfImpact);
+    if (locationOfImpact < static_cast<int>(ECallLocationOfImpact::UNKNOWN)
+        || locationOfImpact > static_cast<int>(ECallLocationOfImpact::OTHER)) {
+        LOG(ERROR, __FUNCTION__, " invalid location of impact ", locationOfImpact);
+        return telux::common::Status::INVALIDPARAM;
     }
-    return status;
+    // delta-v range limit
+    int rangeLimit = static_cast<int>(optionalEuroNcapData.deltaV.rangeLimit);
+    if (rangeLimit < RANGELIMIT_MIN || rangeLimit > RANGELIMIT_MAX) {
+        LOG(ERROR, __FUNCTION__, " invalid rangelimit = ", rangeLimit);
+        return telux::common::Status::INVALIDPARAM;
+    }
+    // delta-v deltaVX
+    int16_t deltaVX = optionalEuroNcapData.deltaV.deltaVX;
+    if (deltaVX < DELTAV_MIN || deltaVX > DELTAV_MAX) {
+        LOG(ERROR, __FUNCTION__, " invalid deltaVX = ", deltaVX);
+        return telux::common::Status::INVALIDPARAM;
+    }
+    // delta-v deltaVY
+    int16_t deltaVY = optionalEuroNcapData.deltaV.deltaVY;
+    if (deltaVY < DELTAV_MIN || deltaVY > DELTAV_MAX) {
+        LOG(ERROR, __FUNCTION__, " invalid deltaVY = ", deltaVY);
+        return telux::common::Status::INVALIDPARAM;
+    }
+
+    std::vector<uint8_t> encodedData;
+    MsdBitWriter writer(encodedData);
+    // Extension Marker for the Sequence: INCINFO
+    writer.write(0, ONE_BIT_FIELD);
+    // rollOverDetected optional flag
+    writer.write(optionalEuroNcapData.rollOverDetectedPresent ? 1 : 0, ONE_BIT_FIELD);
+    // Extension Marker for the Enumerated: ILocations
+    writer.write(0, ONE_BIT_FIELD);
+    writer.write(locationOfImpact, THREE_BIT_FIELD);
+    // rollOverDetected
+    if (optionalEuroNcapData.rollOverDetectedPresent) {
+        writer.write(optionalEuroNcapData.rollOverDetected ? 1 : 0, ONE_BIT_FIELD);
+    }
+    // Extension Marker for the Sequence: IDeltaV
+    writer.write(0, ONE_BIT_FIELD);
+    writer.write(rangeLimit - RANGELIMIT_MIN, EIGHT_BIT_FIELD);
+    writer.write(deltaVX - DELTAV_MIN, NINE_BIT_FIELD);
+    writer.write(deltaVY - DELTAV_MIN, NINE_BIT_FIELD);
+
+    LOG(INFO, __FUNCTION__, " MSD optional additional data content length = ",
+        encodedData.size(), " bytes for ", writer.getBitLength(), " bits");
+    std::string oadDataString;
+    for (auto byte : encodedData) {
+        char s1 = char(byte >> 4);
+        char s2 = char(byte & 0xf);
+        // if character is greater than 1 byte, add ascii value of 7(55),
+        // otherwise ascii value of 0(48) is added to character.
+        s1 > 9 ? s1 += 55 : s1 += 48;
+        s2 > 9 ? s2 += 55 : s2 += 48;
+        // append single character at the end
+        oadDataString.append(1, s1);
+        oadDataString.append(1, s2);
+    }
+    LOG(DEBUG, " Euro NCAP MSD OAD data content = ", oadDataString.c_str());
+    // copy encoded data
+    data.assign(oadDataString.begin(), oadDataString.end());
+    return telux::common::Status::SUCCESS;
 }
 
 }  // namespace tel
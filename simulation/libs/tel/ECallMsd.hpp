@@ -6,7 +6,8 @@
 #ifndef ECALLMSD_HPP
 #define ECALLMSD_HPP
 
-#include <bitset>
+#include <cstdint>
+#include <string>
 #include <vector>
 
 #include <telux/tel/ECallDefines.hpp>
@@ -15,6 +16,56 @@
 namespace telux {
 namespace tel {
 
+/**
+ * MsdBitWriter packs fields MSB first into a byte buffer as required by ASN.1 UPER. The
+ * number of bits written so far is tracked, so that the encoded length is known as soon
+ * as the last field has been written.
+ */
+class MsdBitWriter {
+ public:
+    /**
+     * Appends to the buffer, writing starts at the end of its current content.
+     */
+    MsdBitWriter(std::vector<uint8_t> &buffer);
+
+    /**
+     * Writes the noOfBits (up to 64) least significant bits of the value.
+     */
+    void write(uint64_t value, uint32_t noOfBits);
+
+    /**
+     * Pads with zero bits up to the next byte boundary.
+     */
+    void alignToByte();
+
+    uint32_t getBitLength() const;
+
+ private:
+    std::vector<uint8_t> &buffer_;
+    uint32_t bitLength_;
+};
+
+/**
+ * MsdBitReader reads fields written by MsdBitWriter back from a byte buffer.
+ */
+class MsdBitReader {
+ public:
+    MsdBitReader(const std::vector<uint8_t> &buffer, uint32_t bitOffset = 0);
+
+    /**
+     * Reads noOfBits (up to 64) bits. Reading past the end of the buffer returns 0 and
+     * marks the reader as overrun, so that a decoder can check once after its last field.
+     */
+    uint64_t read(uint32_t noOfBits);
+
+    bool isOverrun() const;
+
+ private:
+    const std::vector<uint8_t> &buffer_;
+    uint32_t bitPosition_;
+    bool isOverrun_;
+};
+
 /**
  * ECallMsd class - An utility class with helper functions required for ECall MSD creation
  */
@@ -35,6 +86,11 @@ class ECallMsd {
      */
     telux::common::Status generateECallMsd(const ECallMsdData &msdData, std::vector<uint8_t> &pdu);
 
+    /**
+     * Decodes a MSD PDU generated by generateECallMsd, used to verify the encoding.
+     */
+    telux::common::Status decodeECallMsd(const std::vector<uint8_t> &pdu, ECallMsdData &msdData);
+
     /**
      * Gets encoded optional additional data content for ecall MSD.
      */
@@ -61,75 +117,50 @@ class ECallMsd {
     /**
      * Vehicle Identification Number
      */
-    void writeVehicleIdentification(const ECallMsdData &eCallMsdData, std::string &msdPdu);
+    void writeVehicleIdentification(const ECallMsdData &eCallMsdData, MsdBitWriter &writer);
     /**
      * Vehicle Propulsion Storage
      */
-    void writeVehiclePropulsionStorage(const ECallMsdData &eCallMsdData, std::string &msdPdu);
+    void writeVehiclePropulsionStorage(const ECallMsdData &eCallMsdData, MsdBitWriter &writer);
     /**
      * Vehicle Location Delta N1 and N2
      */
     void writeVehicleLocationDelta(
-        const ECallMsdData &eCallMsdData, std::string &msdPdu, int16_t latitude, int16_t longitude);
+        const ECallMsdData &eCallMsdData, MsdBitWriter &writer, int16_t latitude, int16_t longitude);
 
     /**
      * MSD optional data
      */
-    telux::common::Status writeOptionalData(const ECallMsdData &eCallMsdData, std::string &msdPdu);
+    telux::common::Status writeOptionalData(const ECallMsdData &eCallMsdData, MsdBitWriter &writer);
     /**
      * Generate 6Bit Pdu From String according to ISO 3779 specification for VIN
      * and 4 bit Pdu from encoded optional additional data String.
      * This function converts the VIN or optional additional data content characters
      * to printable string format.
      */
-    void writePrintableString(std::string input, std::string &pdu, bool optionalData = false);
+    void writePrintableString(std::string input, MsdBitWriter &writer, bool optionalData = false);
     /**
      * MSD optional object identifier.
-     * Generate 8 bit Pdu from String by using UPER encoding and write into bitset.
+     * Generate 8 bit Pdu from String by using UPER encoding and write it to the PDU.
      */
-    telux::common::Status writeOid(const ECallMsdData &eCallMsdData, std::string &msdPdu);
+    telux::common::Status writeOid(const ECallMsdData &eCallMsdData, MsdBitWriter &writer);
     /**
      * MSD optional additional data.
      */
     telux::common::Status writeOptionalAdditionalData(
-        const ECallMsdData &eCallMsdData, std::string &msdPdu);
-    /**
-     * Writes PDU string serially
-     */
-    template <size_t bitsize>
-    void writeMsdPdu(std::bitset<bitsize> b, std::string &pdu);
-
-    int calculateMsdMessageLength(const ECallMsdData &eCallMsdData, uint8_t msdVersion);
-
-    int calculateAdditionalDataLength(const ECallMsdData &eCallMsdData);
-
-    int getEncodedOIDLengthInBits(std::string oid);
+        const ECallMsdData &eCallMsdData, MsdBitWriter &writer);
 
     std::vector<int> convertOidToOctets(std::string oid);
     /**
-     * Returns encoded data corresponding to OID octets.
-     */
-    std::vector<int> uperEncodingForOctets(std::vector<int> octetOid);
-    /**
-     * Returns vector after applying UPER encoding where octet value is less than or equal to 127
-     * are pushed to cached encoded vector and values greater than 127 are encoded into multiple
-     * bytes and pushed to cached encoded vector.
+     * Returns the contents octets of a RELATIVE-OID, each arc is encoded in base 128 with
+     * the most significant bit set on all but its last octet.
      */
-    std::vector<int> processOctet(int oidValue);
-    /**
-     * Encode OID octet to multi byte using uper encoding if octet value is > 127.
-     */
-    std::vector<int> encodingToMultiByte(int octet);
-    /**
-     * Encodes one byte MSD optional additional data content.
-     */
-    uint16_t encodeOneByteField(
-        uint16_t bitOffset, uint16_t noOfBits, uint8_t *dataField, uint8_t *encodedData);
+    std::vector<uint8_t> uperEncodingForOctets(std::vector<int> octetOid);
+
     /**
-     * Encodes two bytes MSD optional additional data content.
+     * Reads back the fields written by writeVehicleIdentification.
      */
-    uint16_t encodeTwoBytesField(
-        uint16_t bitOffset, uint16_t noOfBits, uint16_t *dataField, uint8_t *encodedData);
+    bool readPrintableString(MsdBitReader &reader, uint32_t length, std::string &output);
 };
 
 }  // End of namespace tel
@@ -6,6 +6,7 @@
 #include <telux/common/DeviceConfig.hpp>
 #include "ImsServingSystemManagerStub.hpp"
 #include "TelDefinesStub.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::common;
 using namespace telux::tel;
@@ -24,11 +25,10 @@ void ImsServingSystemManagerStub::setServiceStatus(telux::common::ServiceStatus
         subSystemStatus_ = status;
     }
     if(initCb_) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay_,
         [this, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay_));
                 initCb_(status);
-        }).share();
+        });
         taskQ_->add(f1);
     } else {
         LOG(ERROR, __FUNCTION__, " Callback is NULL");
@@ -173,13 +173,12 @@ telux::common::Status
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, info, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, info, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(info, error);
             }
-            }).share();
+            });
         taskQ_->add(f1);
     }
     return status;
@@ -212,13 +211,12 @@ telux::common::Status ImsServingSystemManagerStub::requestServiceInfo(ImsService
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, info, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, info, error, callback]() {
                 if (callback) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                     callback(info, error);
                 }
-            }).share();
+            });
         taskQ_->add(f1);
     }
     return status;
@@ -255,13 +253,12 @@ telux::common::Status ImsServingSystemManagerStub::requestPdpStatus(ImsPdpStatus
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, info, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, info, error, callback]() {
                 if (callback) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                     callback(info, error);
                 }
-            }).share();
+            });
         taskQ_->add(f1);
     }
     return status;
@@ -6,6 +6,7 @@
 #include <telux/common/DeviceConfig.hpp>
 #include "ImsSettingsManagerStub.hpp"
 #include "TelDefinesStub.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::tel;
 
@@ -22,11 +23,10 @@ void ImsSettingsManagerStub::setServiceStatus(telux::common::ServiceStatus statu
         subSystemStatus_ = status;
     }
     if(initCb_) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay_,
         [this, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay_));
                 initCb_(status);
-        }).share();
+        });
         taskQ_->add(f1);
     } else {
         LOG(ERROR, __FUNCTION__, " Callback is NULL");
@@ -207,15 +207,14 @@ telux::common::Status
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, slotId, config, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, slotId, config, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(slotId, config, error);
             } else {
                 LOG(ERROR, __FUNCTION__, " Callback is null");
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -269,13 +268,12 @@ telux::common::Status ImsSettingsManagerStub::setServiceConfig(SlotId slotId,
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(error);
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -312,13 +310,12 @@ telux::common::Status ImsSettingsManagerStub::requestSipUserAgent(SlotId slotId,
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, slotId, sipUserAgent, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, slotId, sipUserAgent, error, callback]() {
                 if (callback) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                     callback(slotId, sipUserAgent, error);
                 }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -355,15 +352,14 @@ telux::common::Status ImsSettingsManagerStub::setSipUserAgent(SlotId slotId,
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, error, callback]() {
                 if (callback) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                     callback(error);
                 } else {
                     LOG(ERROR, __FUNCTION__, " Callback is null");
                 }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -399,15 +395,14 @@ telux::common::Status
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, slotId, vonrEnabled, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, slotId, vonrEnabled, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(slotId, vonrEnabled, error);
             } else {
                 LOG(ERROR, __FUNCTION__, " Callback is null");
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -445,13 +440,12 @@ telux::common::Status ImsSettingsManagerStub::toggleVonr(SlotId slotId,
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(error);
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -4,6 +4,7 @@
  */
 
 #include "MultiSimManagerStub.hpp"
+#include "common/TimerService.hpp"
 
 #define FIRST_SIM_SLOT_ID 1
 #define INIT_DELAY 100
@@ -42,12 +43,12 @@ void MultiSimManagerStub::cleanup() {
 void MultiSimManagerStub::initSync(telux::common::InitResponseCb callback) {
     LOG(DEBUG, __FUNCTION__);
     if(callback) {
-        auto f = std::async(std::launch::async, [this, callback]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(INIT_DELAY));
+        auto f = telux::common::TimerService::getInstance()->runAfter(INIT_DELAY,
+            [this, callback]() {
             if (callback) {
                 callback(telux::common::ServiceStatus::SERVICE_AVAILABLE);
             }
-        }).share();
+        });
         taskQ_->add(f);
     }
 }
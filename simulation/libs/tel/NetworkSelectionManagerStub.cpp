@@ -6,6 +6,7 @@
 #include <telux/common/DeviceConfig.hpp>
 #include "NetworkSelectionManagerStub.hpp"
 #include "TelDefinesStub.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::common;
 using namespace telux::tel;
@@ -24,11 +25,10 @@ void NetworkSelectionManagerStub::setServiceStatus(telux::common::ServiceStatus
         subSystemStatus_ = status;
     }
     if(initCb_) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay_,
         [this, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay_));
                 initCb_(status);
-        }).share();
+        });
         taskQ_->add(f1);
     } else {
         LOG(ERROR, __FUNCTION__, " Callback is NULL");
@@ -197,13 +197,12 @@ telux::common::Status NetworkSelectionManagerStub::requestNetworkSelectionMode
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, info, error, callback]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, info, error, callback]() {
             if (callback) {
                 callback(info, error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -234,13 +233,12 @@ telux::common::Status NetworkSelectionManagerStub::setNetworkSelectionMode
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-            [this, cbDelay, error, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 if (callback) {
                     callback(error);
                 }
-            }).share();
+            });
         taskQ_->add(f);
     }
     return status;
@@ -289,13 +287,12 @@ telux::common::Status NetworkSelectionManagerStub::requestPreferredNetworks(
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, preferredNetworks3gppInfo, staticPreferredNetworksInfo, error, callback]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, preferredNetworks3gppInfo, staticPreferredNetworksInfo, error, callback]() {
             if (callback) {
                 callback(preferredNetworks3gppInfo, staticPreferredNetworksInfo, error);
             }
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
@@ -337,13 +334,12 @@ telux::common::Status NetworkSelectionManagerStub::setPreferredNetworks(
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-        [this, cbDelay, error, callback]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, error, callback]() {
             if (callback) {
                 callback(error);
             }
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
@@ -380,13 +376,12 @@ telux::common::Status NetworkSelectionManagerStub::performNetworkScan(NetworkSca
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, error, callback]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, error, callback]() {
             if (callback) {
                 callback(error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -416,13 +411,12 @@ telux::common::Status NetworkSelectionManagerStub::requestNetworkSelectionMode
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, mode, error, callback]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, mode, error, callback]() {
             if (callback) {
                 callback(mode, error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -8,6 +8,7 @@
 #include <telux/tel/PhoneDefines.hpp>
 #include "PhoneManagerStub.hpp"
 #include "common/Logger.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::tel;
 
@@ -55,11 +56,10 @@ void PhoneManagerStub::setServiceStatus(telux::common::ServiceStatus status) {
         subSystemStatus_ = status;
     }
     if(initCb_) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay_,
         [this, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay_));
                 initCb_(status);
-        }).share();
+        });
         taskQ_->add(f1);
     } else {
         LOG(ERROR, __FUNCTION__, " Callback is NULL");
@@ -441,13 +441,12 @@ telux::common::Status PhoneManagerStub::requestCellularCapabilityInfo(
     int cbDelay = static_cast<int>(response.delay());
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     if ((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback, cellularCapabilityInfo]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback, cellularCapabilityInfo]() {
                 if (callback) {
                     callback->cellularCapabilityResponse(cellularCapabilityInfo, error);
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -480,13 +479,12 @@ telux::common::Status PhoneManagerStub::setOperatingMode(telux::tel::OperatingMo
         updateRadioState(operatingMode);
     }
     if ((status == telux::common::Status::SUCCESS)&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 if (callback) {
                     callback(error);
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -512,13 +510,12 @@ telux::common::Status PhoneManagerStub::requestOperatingMode(
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, operatingMode, callback, error]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, operatingMode, callback, error]() {
                 if (callback) {
                     callback->operatingModeResponse(operatingMode, error);
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -544,13 +541,12 @@ telux::common::Status PhoneManagerStub::resetWwan(telux::common::ResponseCallbac
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 if (callback) {
                     callback(error);
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -656,47 +652,86 @@ void PhoneManagerStub::handleServiceStateChanged(::telStub::ServiceStateChangeEv
 }
 
 
+::telStub::SignalStrength PhoneManagerStub::createInvalidSignalStrength() {
+    ::telStub::SignalStrength signalStrength;
+    auto gsm = signalStrength.mutable_gsm_signal_strength_info();
+    gsm->set_gsm_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
+    gsm->set_gsm_bit_error_rate(INVALID_SIGNAL_STRENGTH_VALUE);
+    auto wcdma = signalStrength.mutable_wcdma_signal_strength_info();
+    wcdma->set_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
+    wcdma->set_bit_error_rate(INVALID_SIGNAL_STRENGTH_VALUE);
+    wcdma->set_ecio(INVALID_SIGNAL_STRENGTH_VALUE);
+    wcdma->set_rscp(INVALID_SIGNAL_STRENGTH_VALUE);
+    auto lte = signalStrength.mutable_lte_signal_strength_info();
+    lte->set_lte_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
+    lte->set_lte_rsrp(INVALID_SIGNAL_STRENGTH_VALUE);
+    lte->set_lte_rsrq(INVALID_SIGNAL_STRENGTH_VALUE);
+    lte->set_lte_rssnr(INVALID_SIGNAL_STRENGTH_VALUE);
+    lte->set_lte_cqi(INVALID_SIGNAL_STRENGTH_VALUE);
+    lte->set_timing_advance(INVALID_SIGNAL_STRENGTH_VALUE);
+    auto nr5g = signalStrength.mutable_nr5g_signal_strength_info();
+    nr5g->set_rsrp(INVALID_SIGNAL_STRENGTH_VALUE);
+    nr5g->set_rsrq(INVALID_SIGNAL_STRENGTH_VALUE);
+    nr5g->set_rssnr(INVALID_SIGNAL_STRENGTH_VALUE);
+    auto nb1Ntn = signalStrength.mutable_nb1_ntn_signal_strength_info();
+    nb1Ntn->set_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
+    nb1Ntn->set_rsrp(INVALID_SIGNAL_STRENGTH_VALUE);
+    nb1Ntn->set_rsrq(INVALID_SIGNAL_STRENGTH_VALUE);
+    nb1Ntn->set_rssnr(INVALID_SIGNAL_STRENGTH_VALUE);
+    return signalStrength;
+}
+
 void PhoneManagerStub::handleSignalStrengthChanged(::telStub::SignalStrengthChangeEvent event) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = event.phone_id();
+    // The event only carries the RATs which changed, merge them into the last known values
+    ::telStub::SignalStrength signalStrength;
+    {
+        std::lock_guard<std::mutex> lock(signalStrengthMutex_);
+        auto it = signalStrengths_.find(phoneId);
+        if (it == signalStrengths_.end()) {
+            it = signalStrengths_.emplace(phoneId, createInvalidSignalStrength()).first;
+        }
+        const ::telStub::SignalStrength &changed = event.signal_strength();
+        if (changed.has_gsm_signal_strength_info()) {
+            *it->second.mutable_gsm_signal_strength_info() = changed.gsm_signal_strength_info();
+        }
+        if (changed.has_wcdma_signal_strength_info()) {
+            *it->second.mutable_wcdma_signal_strength_info()
+                = changed.wcdma_signal_strength_info();
+        }
+        if (changed.has_lte_signal_strength_info()) {
+            *it->second.mutable_lte_signal_strength_info() = changed.lte_signal_strength_info();
+        }
+        if (changed.has_nr5g_signal_strength_info()) {
+            *it->second.mutable_nr5g_signal_strength_info() = changed.nr5g_signal_strength_info();
+        }
+        if (changed.has_nb1_ntn_signal_strength_info()) {
+            *it->second.mutable_nb1_ntn_signal_strength_info()
+                = changed.nb1_ntn_signal_strength_info();
+        }
+        signalStrength = it->second;
+    }
     std::shared_ptr<SignalStrength> signalStrengthNotify = nullptr;
+    const auto &gsm = signalStrength.gsm_signal_strength_info();
     std::shared_ptr<GsmSignalStrengthInfo> gsmSignalStrength =
-         std::make_shared<GsmSignalStrengthInfo>(
-             event.mutable_signal_strength()->mutable_gsm_signal_strength_info()->
-                gsm_signal_strength(),
-             event.mutable_signal_strength()->mutable_gsm_signal_strength_info()->
-                gsm_bit_error_rate(), INVALID_SIGNAL_STRENGTH_VALUE);
+         std::make_shared<GsmSignalStrengthInfo>(gsm.gsm_signal_strength(),
+            gsm.gsm_bit_error_rate(), INVALID_SIGNAL_STRENGTH_VALUE);
+    const auto &lte = signalStrength.lte_signal_strength_info();
     std::shared_ptr<LteSignalStrengthInfo> lteSignalStrength
-        = std::make_shared<LteSignalStrengthInfo>(
-            event.mutable_signal_strength()->mutable_lte_signal_strength_info()->
-                lte_signal_strength(),
-            event.mutable_signal_strength()->mutable_lte_signal_strength_info()->lte_rsrp(),
-            event.mutable_signal_strength()->mutable_lte_signal_strength_info()->lte_rsrq(),
-            event.mutable_signal_strength()->mutable_lte_signal_strength_info()->lte_rssnr(),
-            event.mutable_signal_strength()->mutable_lte_signal_strength_info()->lte_cqi(),
-            event.mutable_signal_strength()->mutable_lte_signal_strength_info()->
-                timing_advance());
+        = std::make_shared<LteSignalStrengthInfo>(lte.lte_signal_strength(), lte.lte_rsrp(),
+            lte.lte_rsrq(), lte.lte_rssnr(), lte.lte_cqi(), lte.timing_advance());
+    const auto &wcdma = signalStrength.wcdma_signal_strength_info();
     std::shared_ptr<WcdmaSignalStrengthInfo> wcdmaSignalStrength
-        = std::make_shared<WcdmaSignalStrengthInfo>(
-            event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->
-                signal_strength(), event.mutable_signal_strength()->
-                    mutable_wcdma_signal_strength_info()->bit_error_rate(),
-                event.mutable_signal_strength()->
-                    mutable_wcdma_signal_strength_info()->ecio(),
-                event.mutable_signal_strength()->
-                    mutable_wcdma_signal_strength_info()->rscp());
+        = std::make_shared<WcdmaSignalStrengthInfo>(wcdma.signal_strength(),
+            wcdma.bit_error_rate(), wcdma.ecio(), wcdma.rscp());
+    const auto &nr5g = signalStrength.nr5g_signal_strength_info();
     std::shared_ptr<Nr5gSignalStrengthInfo> nr5gSignalStrength
-        = std::make_shared<Nr5gSignalStrengthInfo>(
-            event.mutable_signal_strength()->mutable_nr5g_signal_strength_info()->rsrp(),
-            event.mutable_signal_strength()->mutable_nr5g_signal_strength_info()->rsrq(),
-            event.mutable_signal_strength()->mutable_nr5g_signal_strength_info()->rssnr());
+        = std::make_shared<Nr5gSignalStrengthInfo>(nr5g.rsrp(), nr5g.rsrq(), nr5g.rssnr());
+    const auto &nb1Ntn = signalStrength.nb1_ntn_signal_strength_info();
     std::shared_ptr<Nb1NtnSignalStrengthInfo> nb1NtnSignalStrength
-        = std::make_shared<Nb1NtnSignalStrengthInfo>(
-            event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->
-                signal_strength(),
-            event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->rsrp(),
-            event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->rsrq(),
-            event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->rssnr());
+        = std::make_shared<Nb1NtnSignalStrengthInfo>(nb1Ntn.signal_strength(), nb1Ntn.rsrp(),
+            nb1Ntn.rsrq(), nb1Ntn.rssnr());
     signalStrengthNotify
         = std::make_shared<SignalStrength>(lteSignalStrength, gsmSignalStrength,
             nullptr/*cdma deprecated*/, wcdmaSignalStrength, nullptr/*tdscdma deprecated*/,
@@ -69,11 +69,15 @@ private:
     std::shared_ptr<telux::common::ListenerManager<IPhoneListener>> listenerMgr_;
     std::unique_ptr<::telStub::PhoneService::Stub> phoneStub_;
     std::unique_ptr<::telStub::CardService::Stub> cardStub_;
+    std::mutex signalStrengthMutex_;
+    /* Last known signal strength of each phone, notifications only carry the changes */
+    std::map<int, ::telStub::SignalStrength> signalStrengths_;
     telux::common::ServiceStatus subSystemStatus_;
     void setServiceStatus(telux::common::ServiceStatus status);
     void initSync();
     void setSubsystemReady(bool status);
     bool waitForInitialization();
+    ::telStub::SignalStrength createInvalidSignalStrength();
     void handleSignalStrengthChanged(::telStub::SignalStrengthChangeEvent event);
     void handleCellInfoListChanged(::telStub::CellInfoListEvent event);
     void handleVoiceServiceStateChanged(::telStub::VoiceServiceStateEvent event);
@@ -33,6 +33,7 @@
  */
 
 #include "PhoneStub.hpp"
+#include "common/TimerService.hpp"
 #include <telux/common/DeviceConfig.hpp>
 
 #define DELAY 100
@@ -41,8 +42,7 @@ static constexpr int INVALID_ECALL_OPRT_MODE = -1;
 using namespace telux::tel;
 
 PhoneStub::PhoneStub(int phoneId)
-    : stub_(PhoneService::NewStub(grpc::CreateChannel("localhost:8089",
-    grpc::InsecureChannelCredentials())))  {
+    : stub_(telux::common::CommonUtils::getGrpcStub<PhoneService>())  {
     LOG(DEBUG, __FUNCTION__);
     phoneId_ = phoneId;
     ready_ = false;
@@ -189,9 +189,8 @@ telux::common::Status
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback, vocSrvInfo]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback, vocSrvInfo]() {
                 if (vocSrvInfo) {
                     handleDeprecatedVoiceServiceStateResponse(vocSrvInfo);
                 }
@@ -201,7 +200,7 @@ telux::common::Status
                 } else {
                     LOG(DEBUG, __FUNCTION__, " Callback is null");
                 }
-        }).share();
+        });
         taskQ_->add(fut);
     }
     return status;
@@ -226,15 +225,14 @@ telux::common::Status PhoneStub::setRadioPower(
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 if (callback) {
                     callback->commandResponse(error);
                 } else {
                     LOG(ERROR, __FUNCTION__, " Callback is null");
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -419,15 +417,14 @@ telux::common::Status PhoneStub::requestCellInfo(telux::tel::CellInfoCallback ca
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback, cellInfoList]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback, cellInfoList]() {
                 if (callback) {
                     callback(cellInfoList, error);
                 } else {
                     LOG(ERROR, __FUNCTION__, " Callback is null");
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -451,15 +448,14 @@ telux::common::Status PhoneStub::setCellInfoListRate(uint32_t timeInterval,
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 if (callback) {
                     callback(error);
                 }  else {
                     LOG(ERROR, __FUNCTION__, " Callback is null");
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -525,15 +521,14 @@ telux::common::Status PhoneStub::requestSignalStrength(
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback, signalStrengthNotify]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback, signalStrengthNotify]() {
                 if (callback) {
                     callback->signalStrengthResponse(signalStrengthNotify, error);
                 } else {
                     LOG(ERROR, __FUNCTION__, " Callback is null");
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -558,15 +553,14 @@ telux::common::Status PhoneStub::setECallOperatingMode(ECallMode eCallMode,
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 if (callback) {
                     callback(error);
                 } else {
                     LOG(DEBUG, __FUNCTION__, " Callabck is null");
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -590,15 +584,14 @@ telux::common::Status PhoneStub::requestECallOperatingMode(ECallGetOperatingMode
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback, eCallMode]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback, eCallMode]() {
                 if (callback) {
                     callback(eCallMode, error);
                 } else {
                     LOG(ERROR, __FUNCTION__, " Callback is null");
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -655,15 +648,14 @@ telux::common::Status PhoneStub::requestOperatorInfo(OperatorInfoCallback callba
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay,  error, callback, plmnInfo]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this,  error, callback, plmnInfo]() {
                 if (callback) {
                     callback(plmnInfo, error);
                 } else {
                     LOG(ERROR, __FUNCTION__, " Callback is null");
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -714,15 +706,14 @@ telux::common::Status PhoneStub::configureSignalStrength(
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 if (callback) {
                     callback(error);
                 } else {
                     LOG(ERROR, __FUNCTION__, " Callback is null");
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
@@ -793,15 +784,14 @@ telux::common::Status PhoneStub::configureSignalStrength(
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto fut = std::async(std::launch::async,
-            [this, cbDelay, error, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+        auto fut = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, error, callback]() {
                 if (callback) {
                     callback(error);
                 } else {
                     LOG(ERROR, __FUNCTION__, " Callback is null");
                 }
-            }).share();
+            });
         taskQ_->add(fut);
     }
     return status;
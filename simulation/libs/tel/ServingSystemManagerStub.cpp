@@ -6,6 +6,7 @@
 #include <telux/common/DeviceConfig.hpp>
 #include "ServingSystemManagerStub.hpp"
 #include "TelDefinesStub.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::common;
 using namespace telux::tel;
@@ -24,11 +25,10 @@ void ServingSystemManagerStub::setServiceStatus(telux::common::ServiceStatus sta
         subSystemStatus_ = status;
     }
     if(initCb_) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay_,
         [this, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay_));
                 initCb_(status);
-        }).share();
+        });
         taskQ_->add(f1);
     } else {
         LOG(ERROR, __FUNCTION__, " Callback is NULL");
@@ -374,13 +374,12 @@ telux::common::Status ServingSystemManagerStub::setRatPreference(RatPreference r
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, error, callback]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -412,13 +411,12 @@ telux::common::Status
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, preference, error, callback]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, preference, error, callback]() {
             if (callback) {
                 callback(preference, error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -447,13 +445,12 @@ telux::common::Status ServingSystemManagerStub::setServiceDomainPreference(
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, error, callback]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -483,13 +480,12 @@ telux::common::Status ServingSystemManagerStub::requestServiceDomainPreference(
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, preference, error, callback]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, preference, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(preference, error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -551,13 +547,12 @@ telux::common::Status ServingSystemManagerStub::requestNetworkTime(
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
-            [this, cbDelay, info, error, callback]() {
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+            [this, info, error, callback]() {
                 if (callback) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                     callback(info, error);
                 }
-            }).share();
+            });
         taskQ_->add(f);
     }
     return status;
@@ -598,13 +593,12 @@ telux::common::Status ServingSystemManagerStub::requestRFBandInfo(RFBandInfoCall
     telux::common::Status status = static_cast<telux::common::Status>(response.status());
     telux::common::ErrorCode error = static_cast<telux::common::ErrorCode>(response.error());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, info, error, callback]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, info, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(info, error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -767,13 +761,12 @@ telux::common::Status ServingSystemManagerStub::requestRFBandPreferences
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, prefBands, error, callback]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, prefBands, error, callback]() {
             if (callback) {
                 callback(prefBands, error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -815,13 +808,12 @@ telux::common::Status ServingSystemManagerStub::setRFBandPreferences
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, error, callback]() {
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
                 callback(error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -872,13 +864,12 @@ telux::common::Status ServingSystemManagerStub::requestRFBandCapability
     bool isCallbackNeeded = static_cast<bool>(response.is_callback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
-        [this, cbDelay, capabilityBands, error, callback]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+        [this, capabilityBands, error, callback]() {
             if (callback) {
                 callback(capabilityBands, error);
             }
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
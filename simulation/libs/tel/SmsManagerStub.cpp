@@ -12,6 +12,7 @@
 #include "common/SimulationConfigParser.hpp"
 #include "common/CommonUtils.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::common;
 using namespace telux::tel;
@@ -31,11 +32,10 @@ void SmsManagerStub::setServiceStatus(telux::common::ServiceStatus status) {
         subSystemStatus_ = status;
     }
     if(initCb_) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay_,
         [this, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay_));
                 initCb_(status);
-        }).share();
+        });
         taskQ_->add(f1);
     } else {
         LOG(ERROR, __FUNCTION__, " Callback is NULL");
@@ -59,6 +59,7 @@ telux::common::Status SmsManagerStub::init(telux::common::InitResponseCb callbac
         LOG(ERROR, __FUNCTION__, " unable to instantiate AsyncTaskQueue");
         return telux::common::Status::FAILED;
     }
+    reassembler_ = std::make_shared<SmsReassembler>();
     initCb_ = callback;
     auto f = std::async(std::launch::async,
         [this]() {
@@ -185,32 +186,24 @@ telux::common::Status SmsManagerStub::sendSms(const std::string &message,
     LOG(DEBUG, __FUNCTION__, " Invoking callback for old SMS API");
     // Sending the callback response.
     if (status == telux::common::Status::SUCCESS) {
-        auto f1 = std::async(std::launch::async,
-            [this, sentCallbackDelay, sentCallback, sentCallbackErrorcode]() {
-                this->invokesendSmsCallback(sentCallbackDelay, sentCallback,
+        this->invokesendSmsCallback(sentCallbackDelay, sentCallback,
                     sentCallbackErrorcode);
-            }).share();
-            taskQ_->add(f1);
         // Send delivery report to listeners.
         if((isDeliveryReportNeeded) &&
             (sentCallbackErrorcode == telux::common::ErrorCode::SUCCESS)) {
             LOG(DEBUG, __FUNCTION__, " Invoking delivery report to listeners");
-            auto f2 = std::async(std::launch::async,
+            auto f2 = telux::common::TimerService::getInstance()->runAfter(deliveryCallbackDelay,
             [this, receiverAddress, noofsegments, refs,
                 deliveryCallbackErrorCode, deliveryCallbackDelay]() {
                 this->invokeDeliveryReportListener(receiverAddress, noofsegments,
                 refs, deliveryCallbackErrorCode, deliveryCallbackDelay );
-            }).share();
+            });
             taskQ_->add(f2);
 
             // Sending the delivery callback Response.
             LOG(DEBUG, __FUNCTION__, " Invoking delivery callback");
-            auto f3 = std::async(std::launch::async,
-            [this, deliveryCallbackDelay, deliveryCallback, deliveryCallbackErrorCode]() {
-                this->invokesendSmsCallback(deliveryCallbackDelay,
+            this->invokesendSmsCallback(deliveryCallbackDelay,
                     deliveryCallback, deliveryCallbackErrorCode);
-            }).share();
-            taskQ_->add(f3);
         }
     }
     return status;
@@ -265,11 +258,11 @@ telux::common::Status SmsManagerStub::sendSms(std::string message, std::string r
 
     if (status == telux::common::Status::SUCCESS) {
         // Invoking response callback
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(smsResponseCbDelay,
         [this, smsResponseCbDelay, smsResponsecbErrorCode, refs, sentCallback]() {
             this->invokeCallback(smsResponseCbDelay,
             smsResponsecbErrorCode, refs, sentCallback);
-        }).share();
+        });
         taskQ_->add(f1);
 
         // Notifying listeners about the change event.
@@ -311,7 +304,6 @@ void SmsManagerStub::invokeDeliveryReportListener(std::string receiverAddress,
     int noofdeliveryreport, std::vector<int> refs, telux::common::ErrorCode error,
     int deliveryCallbackDelay) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(deliveryCallbackDelay));
     std::vector<std::weak_ptr<ISmsListener>> applisteners;
         if (listenerMgr_) {
             listenerMgr_->getAvailableListeners(applisteners);
@@ -382,11 +374,11 @@ telux::common::Status SmsManagerStub::sendRawSms(const std::vector<PduBuffer> ra
 
     if (status == telux::common::Status::SUCCESS) {
         // Invoking response callback
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(smsResponseCbDelay,
         [this, smsResponseCbDelay, smsResponsecbErrorCode, refs, sentCallback]() {
             this->invokeCallback(smsResponseCbDelay,
                 smsResponsecbErrorCode, refs, sentCallback);
-        }).share();
+        });
         taskQ_->add(f1);
 
         // Notifying listeners about the change event.
@@ -404,7 +396,6 @@ telux::common::Status SmsManagerStub::sendRawSms(const std::vector<PduBuffer> ra
 void SmsManagerStub::invokeCallback(int cbDelay, ErrorCode error, std::vector<int> msgRefs,
      SmsResponseCb sentCallback) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
     if (sentCallback) {
         sentCallback(msgRefs,error);
     }
@@ -414,11 +405,10 @@ void SmsManagerStub::invokesendSmsCallback(int cbDelay,
     std::shared_ptr<telux::common::ICommandResponseCallback> callback,
     telux::common::ErrorCode error) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
-    auto f1 = std::async(std::launch::async,
+    auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, callback, error]() {
             callback->commandResponse(error);
-        }).share();
+        });
     taskQ_->add(f1);
 }
 
@@ -448,10 +438,10 @@ telux::common::Status SmsManagerStub::requestSmscAddress
     LOG(DEBUG, __FUNCTION__, "smscAddress is ", smscAddress );
 
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
             [this, cbDelay, callback, smscAddress, error]() {
                 this->invokeGetSmscCallback(cbDelay, callback, smscAddress, error);
-            }).share();
+            });
         taskQ_->add(f);
     }
     return status;
@@ -461,7 +451,6 @@ void SmsManagerStub::invokeGetSmscCallback(int cbDelay,
     std::shared_ptr<ISmscAddressCallback> callback, std::string smscAddress,
     telux::common::ErrorCode error) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
 
     if (callback) {
         callback->smscAddressResponse(smscAddress, error);
@@ -497,10 +486,10 @@ telux::common::Status SmsManagerStub::setSmscAddress(const std::string &smscAddr
     int cbDelay = static_cast<int>(response.delay());
 
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, cbDelay, error, callback]() {
             this->invokeResponseCallback(cbDelay, error, callback);
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
@@ -509,7 +498,6 @@ telux::common::Status SmsManagerStub::setSmscAddress(const std::string &smscAddr
 void SmsManagerStub::invokeResponseCallback(int cbDelay, telux::common::ErrorCode error,
     telux::common::ResponseCallback callback) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
 
     if (callback) {
         callback(error);
@@ -547,10 +535,10 @@ telux::common::Status SmsManagerStub::requestSmsMessageList(SmsTagType type,
     int cbDelay = static_cast<int>(response.delay());
 
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
             [this, infos ,error, callback, cbDelay]() {
                 this->invokeRequestSmsInfoListCb(infos, error, callback, cbDelay);
-            }).share();
+            });
         taskQ_->add(f);
     }
     return status;
@@ -559,7 +547,6 @@ telux::common::Status SmsManagerStub::requestSmsMessageList(SmsTagType type,
 void SmsManagerStub::invokeRequestSmsInfoListCb(std::vector<SmsMetaInfo> infos,
     telux::common::ErrorCode error, RequestSmsInfoListCb callback, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
 
     if (callback) {
         callback(infos, error);
@@ -618,10 +605,10 @@ telux::common::Status SmsManagerStub::readMessage(uint32_t messageIndex,
     int cbDelay = static_cast<int>(response.delay());
 
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay,
             [this, msg, error, callback, cbDelay]() {
                 this->invokeReadSmsMessageCb(msg, error, callback, cbDelay);
-            }).share();
+            });
         taskQ_->add(f1);
     }
     return status;
@@ -630,7 +617,6 @@ telux::common::Status SmsManagerStub::readMessage(uint32_t messageIndex,
 void SmsManagerStub::invokeReadSmsMessageCb(SmsMessage message, telux::common::ErrorCode error,
     ReadSmsMessageCb callback, int cbDelay ) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
 
     if (callback) {
         callback(message, error);
@@ -663,10 +649,10 @@ telux::common::Status SmsManagerStub::deleteMessage(DeleteInfo info,
     int cbDelay = static_cast<int>(response.delay());
 
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, cbDelay, error, callback]() {
             this->invokeResponseCallback(cbDelay, error, callback);
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
@@ -694,10 +680,10 @@ telux::common::Status SmsManagerStub::requestPreferredStorage(RequestPreferredSt
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
             [this, callback, storageType, cbDelay, error]() {
                 this->invokeRequestPreferredStorageCb(storageType,cbDelay, error, callback);
-            }).share();
+            });
         taskQ_->add(f);
     }
     return status;
@@ -706,7 +692,6 @@ telux::common::Status SmsManagerStub::requestPreferredStorage(RequestPreferredSt
 void SmsManagerStub::invokeRequestPreferredStorageCb(telux::tel::StorageType storageType,
     int cbDelay, telux::common::ErrorCode error, RequestPreferredStorageCb callback) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
 
     if (callback) {
         callback(storageType, error);
@@ -737,10 +722,10 @@ telux::common::Status SmsManagerStub::setPreferredStorage(StorageType storageTyp
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, cbDelay, error, callback]() {
             this->invokeResponseCallback(cbDelay, error, callback);
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
@@ -771,10 +756,10 @@ telux::common::Status SmsManagerStub::setTag(uint32_t msgIndex, SmsTagType tagTy
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, cbDelay, error, callback]() {
             this->invokeResponseCallback(cbDelay, error, callback);
-        }).share();
+        });
         taskQ_->add(f);
     }
     return status;
@@ -799,11 +784,11 @@ telux::common::Status SmsManagerStub::requestStorageDetails(RequestStorageDetail
     bool isCallbackNeeded = static_cast<bool>(response.iscallback());
     int cbDelay = static_cast<int>(response.delay());
     if((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-    auto f = std::async(std::launch::async,
+    auto f = telux::common::TimerService::getInstance()->runAfter(cbDelay,
         [this, maxCount, availableCount, cbDelay, error, callback]() {
             this->invokeRequestStorageDetailsCb(maxCount, availableCount,
                 cbDelay, error, callback);
-        }).share();
+        });
     taskQ_->add(f);
     }
     return status;
@@ -812,7 +797,6 @@ telux::common::Status SmsManagerStub::requestStorageDetails(RequestStorageDetail
 void SmsManagerStub::invokeRequestStorageDetailsCb(int maxCount, int availableCount,
     int cbDelay, telux::common::ErrorCode error, RequestStorageDetailsCb callback) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
 
     if (callback) {
         callback(maxCount, availableCount, error);
@@ -847,24 +831,24 @@ MessageAttributes SmsManagerStub::calculateMessageAttributes(const std::string &
  */
 SmsMessage::SmsMessage(std::string text, std::string sender, std::string receiver,
     SmsEncoding encoding, std::string pdu, PduBuffer rawPdu, std::shared_ptr<MessagePartInfo> info)
-   : text_(text)
-   , sender_(sender)
-   , receiver_(receiver)
+   : text_(std::move(text))
+   , sender_(std::move(sender))
+   , receiver_(std::move(receiver))
    , encoding_(encoding)
-   , pdu_(pdu)
-   , rawPdu_(rawPdu)
+   , pdu_(std::move(pdu))
+   , rawPdu_(std::move(rawPdu))
    , msgPartInfo_(info) {
 }
 
 SmsMessage::SmsMessage(std::string text, std::string sender, std::string receiver,
     SmsEncoding encoding, std::string pdu, PduBuffer rawPdu, std::shared_ptr<MessagePartInfo> info
     , bool isMetaInfoValid, SmsMetaInfo metaInfo)
-   : text_(text)
-   , sender_(sender)
-   , receiver_(receiver)
+   : text_(std::move(text))
+   , sender_(std::move(sender))
+   , receiver_(std::move(receiver))
    , encoding_(encoding)
-   , pdu_(pdu)
-   , rawPdu_(rawPdu)
+   , pdu_(std::move(pdu))
+   , rawPdu_(std::move(rawPdu))
    , msgPartInfo_(info)
    , isMetaInfoValid_(isMetaInfoValid)
    , metaInfo_(metaInfo) {
@@ -941,19 +925,10 @@ void SmsManagerStub::handleIncomingSms(::telStub::SmsMessage event) {
     telux::tel::SmsTagType tagType = static_cast<telux::tel::SmsTagType>(event.tag_type());
     telux::tel::SmsEncoding encoding = static_cast<telux::tel::SmsEncoding>(event.encoding());
     bool isMetaInfoValid = event.ismetainfo_valid();
-    std::string pdu = event.pdu();
-    std::string rawPdu = event.pdu();
-    std::string receiver= event.receiver();
-    std::string sender = event.sender();
-    std::string text = event.text();
-
-    const uint8_t* p = reinterpret_cast<const uint8_t*>(pdu.c_str());
-    std::vector <uint8_t> pduBuffer;
-    while (*p !='\0')
-    {
-        pduBuffer.push_back(*p);
-        p++;
-    }
+    const std::string &pdu = event.pdu();
+
+    /* Raw PDU is the PDU string up to its first NUL */
+    std::vector<uint8_t> pduBuffer(pdu.begin(), std::find(pdu.begin(), pdu.end(), '\0'));
     /* Construct sendMessage based on the inputs */
     std::shared_ptr<MessagePartInfo> info = std::make_shared< MessagePartInfo >();
     SmsMetaInfo metaInfo = {};
@@ -963,24 +938,28 @@ void SmsManagerStub::handleIncomingSms(::telStub::SmsMessage event) {
 
     metaInfo.msgIndex = msgIndex;
     metaInfo.tagType = tagType;
-    SmsMessage msg(text, sender, receiver, encoding, pdu, pduBuffer,
-        info, isMetaInfoValid, metaInfo);
-    auto sharedPtr = std::make_shared<SmsMessage> (msg);
+    auto sharedPtr = std::make_shared<SmsMessage>(event.text(), event.sender(),
+        event.receiver(), encoding, pdu, std::move(pduBuffer), info, isMetaInfoValid, metaInfo);
     // Invoke incomingSms notification to clients
     invokeIncomingSmslisteners(phoneId, sharedPtr);
     isMemoryFull(phoneId);
 
     // Consolidated message for all incomingSms segments and send the notification to clients
-    if ((msg.getMessagePartInfo())->numberOfSegments > 1 ) {
-        parseAndConcatenateSmsMessage (phoneId, msg);
-    } else if((((msg.getMessagePartInfo())->numberOfSegments == 1) //Single part messages
-        && ((msg.getMessagePartInfo())->segmentNumber == 1))) {
-        auto ptr = std::make_shared<std::vector<SmsMessage>> (std::vector<SmsMessage>{msg});
+    if (numberOfSegments > 1) {
+        if (!reassembler_) {
+            LOG(ERROR, __FUNCTION__, " SMS reassembler is null");
+            return;
+        }
+        auto messages = reassembler_->addSegment(sharedPtr);
+        if (messages) {
+            invokeIncomingSmslisteners(phoneId, messages);
+        }
+    } else if((numberOfSegments == 1) && (segmentNumber == 1)) { //Single part messages
+        auto ptr = std::make_shared<std::vector<SmsMessage>>(1, *sharedPtr);
         invokeIncomingSmslisteners(phoneId, ptr);
     } else {
-        LOG(ERROR, __FUNCTION__, " Invalid input for current segment "
-            , (msg.getMessagePartInfo())->segmentNumber ,
-            " and total number of segments " , (msg.getMessagePartInfo())->numberOfSegments);
+        LOG(ERROR, __FUNCTION__, " Invalid input for current segment ", segmentNumber,
+            " and total number of segments " , numberOfSegments);
         return;
     }
 }
@@ -1036,74 +1015,6 @@ void SmsManagerStub::invokeIncomingSmslisteners(int phoneId,
     }
 }
 
-void SmsManagerStub::parseAndConcatenateSmsMessage (int phoneId, SmsMessage& message) {
-    LOG(DEBUG, __FUNCTION__);
-    bool found = false;
-    for ( auto &smsInfo : smsMessageMap_ ) {
-        if (smsInfo.first.refNumber == ((message.getMessagePartInfo())->refNumber) &&
-            smsInfo.first.senderAddress == message.getSender()) {
-            LOG(DEBUG, __FUNCTION__, " Key with refNumber: ", (smsInfo.first).refNumber,
-                " and senderAddress: ", smsInfo.first.senderAddress, " exists.");
-
-            MessageMetaData metaData = smsInfo.first;
-            std::vector<SmsMessage> smsInfos = smsMessageMap_[metaData];
-            bool isPartAlreadyExist = false;
-            int index = 0;
-            for ( auto &smsInfoElement : smsInfos ) {
-                if ((smsInfoElement.getMessagePartInfo())->segmentNumber ==
-                    (message.getMessagePartInfo())->segmentNumber) {
-                    LOG(DEBUG, __FUNCTION__, " Already part exist with segment no: ",
-                        static_cast<int>((message.getMessagePartInfo())->segmentNumber));
-                    isPartAlreadyExist = true;
-                    break;
-                }
-                index++;
-            }
-            if (isPartAlreadyExist) {
-                LOG(ERROR, __FUNCTION__,
-                    " Duplicate or latest updated SMS info received at index: ", index);
-                smsInfos[index] = message;
-            } else {
-                LOG(DEBUG, __FUNCTION__, " Add SMS info");
-                smsInfos.emplace_back(message);
-            }
-
-            auto comp = [] ( SmsMessage& lhs,
-                 SmsMessage& rhs )
-                    {return (lhs.getMessagePartInfo())->segmentNumber <
-                            (rhs.getMessagePartInfo())->segmentNumber;};
-            sort(smsInfos.begin(), smsInfos.end(), comp);
-            smsMessageMap_[metaData] = smsInfos;
-            found = true;
-            if (static_cast<int>(smsInfos.size())
-                == (message.getMessagePartInfo())->numberOfSegments)  {
-                LOG(DEBUG, __FUNCTION__, " All the parts of SMS is received");
-                std::vector<SmsMessage> messages;
-                for ( auto &smsInfoElement : smsInfos ) {
-                    messages.emplace_back(smsInfoElement);
-                }
-
-                auto sharedPtr = std::make_shared<std::vector<SmsMessage>> (messages);
-                invokeIncomingSmslisteners(phoneId, sharedPtr);
-                smsMessageMap_.erase(metaData);
-                return;
-            }
-            break;
-        }
-    }
-        if(!found) {
-            LOG(DEBUG, __FUNCTION__,
-                " Key with refNumber: ", (message.getMessagePartInfo())->segmentNumber,
-                " and senderAddress: ", message.getSender(), " does not exists.");
-            MessageMetaData metaData;
-            metaData.refNumber = (message.getMessagePartInfo())->segmentNumber;
-            metaData.senderAddress = message.getSender();
-            std::vector<SmsMessage> smsInfos;
-            smsInfos.emplace_back(message);
-            smsMessageMap_[metaData] = smsInfos;
-        }
-}
-
 void SmsManagerStub::handleMemoryFullEvent(::telStub::memoryFullEvent event) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = event.phone_id();
@@ -24,6 +24,7 @@
 #include <list>
 #include "TelDefinesStub.hpp"
 #include "Helper.hpp"
+#include "SmsReassembler.hpp"
 #include "common/JsonParser.hpp"
 #include <telux/common/CommonDefines.hpp>
 #include <grpcpp/grpcpp.h>
@@ -46,16 +47,6 @@ struct smsDeliveryInfo {
 namespace telux {
 namespace tel {
 
-struct MessageMetaData {
-    std::string senderAddress;
-    uint16_t refNumber;
-    // overload '<' operator in order to use MessageMetaData as key in std::map
-        bool operator < (const MessageMetaData &mp) const {
-            return refNumber < mp.refNumber ||
-                (refNumber == mp.refNumber && senderAddress < mp.senderAddress);
-        }
-};
-
 class SmsManagerStub : public ISmsManager,
                        public IEventListener,
                        public std::enable_shared_from_this<SmsManagerStub> {
@@ -154,8 +145,7 @@ private:
     void invokeIncomingSmslisteners(int phoneId,
         std::shared_ptr<std::vector<SmsMessage>> messages);
     void isMemoryFull(int phoneId);
-    void parseAndConcatenateSmsMessage (int phoneId, SmsMessage &msg);
-    std::map<MessageMetaData, std::vector<SmsMessage>> smsMessageMap_;
+    std::shared_ptr<SmsReassembler> reassembler_;
     void onEventUpdate(std::string event);
 };
 
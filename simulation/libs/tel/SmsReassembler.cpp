@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "SmsReassembler.hpp"
+
+#include "common/Logger.hpp"
+
+using namespace telux::common;
+using namespace telux::tel;
+
+SmsReassembler::SmsReassembler(int timeoutMs)
+   : timeoutMs_(timeoutMs) {
+    LOG(DEBUG, __FUNCTION__);
+    /* Slots and their segment tables are allocated once, never on the receive path */
+    slots_.resize(MAX_PENDING_MESSAGES);
+    for (auto &slot : slots_) {
+        slot.isUsed = false;
+        slot.refNumber = 0;
+        slot.numberOfSegments = 0;
+        slot.numberOfReceived = 0;
+        slot.generation = 0;
+        slot.lastUpdate = 0;
+        slot.timerId = TimerService::INVALID_TIMER_ID;
+        slot.segments.resize(MAX_SEGMENTS);
+    }
+}
+
+SmsReassembler::~SmsReassembler() {
+    LOG(DEBUG, __FUNCTION__);
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (auto &slot : slots_) {
+        if (slot.isUsed) {
+            releaseSlot(slot);
+        }
+    }
+}
+
+std::shared_ptr<std::vector<SmsMessage>> SmsReassembler::addSegment(
+    std::shared_ptr<SmsMessage> segment) {
+    std::shared_ptr<MessagePartInfo> info = segment->getMessagePartInfo();
+    if ((!info) || (info->numberOfSegments < 1) || (info->numberOfSegments > MAX_SEGMENTS)
+        || (info->segmentNumber < 1) || (info->segmentNumber > info->numberOfSegments)) {
+        LOG(ERROR, __FUNCTION__, " Invalid segment info");
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mtx_);
+    int slotIndex = findSlot(segment->getSender(), info->refNumber, info->numberOfSegments);
+    if (slotIndex < 0) {
+        slotIndex = allocateSlot();
+        Slot &slot = slots_[slotIndex];
+        slot.isUsed = true;
+        slot.sender = segment->getSender();
+        slot.refNumber = info->refNumber;
+        slot.numberOfSegments = info->numberOfSegments;
+        slot.numberOfReceived = 0;
+        std::weak_ptr<SmsReassembler> weakSelf = shared_from_this();
+        uint64_t generation = slot.generation;
+        TimerService::getInstance()->runAfter(timeoutMs_, [weakSelf, slotIndex, generation]() {
+            if (auto self = weakSelf.lock()) {
+                self->onTimeout(slotIndex, generation);
+            }
+        }, &slot.timerId);
+    }
+
+    Slot &slot = slots_[slotIndex];
+    slot.lastUpdate = ++updateCount_;
+    std::shared_ptr<SmsMessage> &entry = slot.segments[info->segmentNumber - 1];
+    if (entry) {
+        LOG(ERROR, __FUNCTION__, " Duplicate or latest updated SMS info received for segment ",
+            info->segmentNumber);
+    } else {
+        slot.numberOfReceived++;
+    }
+    entry = segment;
+    if (slot.numberOfReceived < slot.numberOfSegments) {
+        return nullptr;
+    }
+
+    LOG(DEBUG, __FUNCTION__, " All the parts of SMS is received");
+    auto messages = std::make_shared<std::vector<SmsMessage>>();
+    messages->reserve(slot.numberOfSegments);
+    for (int i = 0; i < slot.numberOfSegments; i++) {
+        messages->push_back(*slot.segments[i]);
+    }
+    releaseSlot(slot);
+    return messages;
+}
+
+int SmsReassembler::findSlot(const std::string &sender, int refNumber, int numberOfSegments) {
+    for (size_t i = 0; i < slots_.size(); i++) {
+        const Slot &slot = slots_[i];
+        if (slot.isUsed && (slot.refNumber == refNumber)
+            && (slot.numberOfSegments == numberOfSegments) && (slot.sender == sender)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int SmsReassembler::allocateSlot() {
+    int oldest = 0;
+    for (size_t i = 0; i < slots_.size(); i++) {
+        if (!slots_[i].isUsed) {
+            return i;
+        }
+        if (slots_[i].lastUpdate < slots_[oldest].lastUpdate) {
+            oldest = i;
+        }
+    }
+    LOG(ERROR, __FUNCTION__, " No free slot, dropping incomplete message with refNumber ",
+        slots_[oldest].refNumber, " from ", slots_[oldest].sender);
+    releaseSlot(slots_[oldest]);
+    return oldest;
+}
+
+void SmsReassembler::releaseSlot(Slot &slot) {
+    if (slot.timerId != TimerService::INVALID_TIMER_ID) {
+        TimerService::getInstance()->cancel(slot.timerId);
+        slot.timerId = TimerService::INVALID_TIMER_ID;
+    }
+    for (int i = 0; i < slot.numberOfSegments; i++) {
+        slot.segments[i].reset();
+    }
+    slot.isUsed = false;
+    slot.generation++;
+}
+
+void SmsReassembler::onTimeout(int slotIndex, uint64_t generation) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    Slot &slot = slots_[slotIndex];
+    if ((!slot.isUsed) || (slot.generation != generation)) {
+        return;
+    }
+    LOG(ERROR, __FUNCTION__, " Dropping incomplete message with refNumber ", slot.refNumber,
+        " from ", slot.sender, ", received ", slot.numberOfReceived, " of ",
+        slot.numberOfSegments, " segments");
+    slot.timerId = TimerService::INVALID_TIMER_ID;
+    releaseSlot(slot);
+}
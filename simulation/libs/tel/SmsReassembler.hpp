@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       SmsReassembler.hpp
+ *
+ * @brief      SmsReassembler collects the segments of concatenated SMS messages until all
+ *             of them have been received. Partial messages are kept in a fixed number of
+ *             preallocated slots, keyed by sender, reference number and number of
+ *             segments, and are dropped when they don't complete within a timeout or when
+ *             their slot is needed for a newer message.
+ */
+
+#ifndef SMS_REASSEMBLER_HPP
+#define SMS_REASSEMBLER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <telux/tel/SmsManager.hpp>
+
+#include "common/TimerService.hpp"
+
+namespace telux {
+namespace tel {
+
+class SmsReassembler : public std::enable_shared_from_this<SmsReassembler> {
+ public:
+    /* Concatenation information element carries the number of segments in one octet */
+    static const int MAX_SEGMENTS = 255;
+    static const int MAX_PENDING_MESSAGES = 16;
+    static const int SEGMENT_TIMEOUT_MS = 60000;
+
+    SmsReassembler(int timeoutMs = SEGMENT_TIMEOUT_MS);
+    ~SmsReassembler();
+
+    /**
+     * Adds a segment of a concatenated message.
+     *
+     * @returns all segments ordered by segment number when this segment completes the
+     *          message, nullptr otherwise
+     */
+    std::shared_ptr<std::vector<SmsMessage>> addSegment(std::shared_ptr<SmsMessage> segment);
+
+ private:
+    struct Slot {
+        bool isUsed;
+        std::string sender;
+        int refNumber;
+        int numberOfSegments;
+        int numberOfReceived;
+        /* Incremented whenever the slot is released, so that a stale timer is ignored */
+        uint64_t generation;
+        uint64_t lastUpdate;
+        telux::common::TimerService::TimerId timerId;
+        /* Indexed by segment number - 1 */
+        std::vector<std::shared_ptr<SmsMessage>> segments;
+    };
+
+    int findSlot(const std::string &sender, int refNumber, int numberOfSegments);
+    int allocateSlot();
+    void releaseSlot(Slot &slot);
+    void onTimeout(int slotIndex, uint64_t generation);
+
+    std::mutex mtx_;
+    int timeoutMs_;
+    uint64_t updateCount_ = 0;
+    std::vector<Slot> slots_;
+};
+
+}  // end of namespace tel
+}  // end of namespace telux
+
+#endif  // SMS_REASSEMBLER_HPP
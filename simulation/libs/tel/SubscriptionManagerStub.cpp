@@ -7,6 +7,7 @@
 #include <telux/common/DeviceConfig.hpp>
 #include "CardManagerStub.hpp"
 #include "common/event-manager/ClientEventManager.hpp"
+#include "common/TimerService.hpp"
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -33,11 +34,10 @@ void SubscriptionManagerStub::setServiceStatus(telux::common::ServiceStatus stat
         subSystemStatus_ = status;
     }
     if(initCb_) {
-        auto f1 = std::async(std::launch::async,
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay_,
         [this, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay_));
                 initCb_(status);
-        }).share();
+        });
         taskQ_->add(f1);
     } else {
         LOG(ERROR, __FUNCTION__, " Callback is NULL");
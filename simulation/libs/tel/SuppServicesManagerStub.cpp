@@ -6,6 +6,7 @@
 #include <telux/common/DeviceConfig.hpp>
 #include "SuppServicesManagerStub.hpp"
 #include "TelDefinesStub.hpp"
+#include "common/TimerService.hpp"
 
 using namespace telux::tel;
 
@@ -54,11 +55,10 @@ void SuppServicesManagerStub::initSync(telux::common::InitResponseCb callback) {
         LOG(DEBUG, __FUNCTION__, " cbDelay::", cbDelay, " cbStatus::", static_cast<int>(cbStatus));
         this->onServiceStatusChange(cbStatus);
         if (callback) {
-            auto f1 = std::async(std::launch::async,
-                [this, cbDelay, cbStatus, callback]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(cbDelay));
+            auto f1 = telux::common::TimerService::getInstance()->runAfter(cbDelay,
+                [this, cbStatus, callback]() {
                 callback(cbStatus);
-            }).share();
+            });
             taskQ_->add(f1);
         }
     }
@@ -161,15 +161,14 @@ telux::common::Status SuppServicesManagerStub::setCallWaitingPref(
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, failCause, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, failCause, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(error, failCause);
             } else {
                 LOG(ERROR, __FUNCTION__, " Callback is null");
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -203,15 +202,14 @@ telux::common::Status SuppServicesManagerStub::requestCallWaitingPref(
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS) && (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, suppSvcStatus, failureCause, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, suppSvcStatus, failureCause, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(suppSvcStatus, failureCause, error);
             } else {
                 LOG(ERROR, __FUNCTION__, " Callback is null");
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -256,15 +254,14 @@ telux::common::Status SuppServicesManagerStub::setForwardingPref(ForwardReq forw
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, failureCause, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, failureCause, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(error, failureCause);
             } else {
                 LOG(ERROR, __FUNCTION__, " Callback is null");
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -319,15 +316,14 @@ telux::common::Status SuppServicesManagerStub::requestForwardingPref(ServiceClas
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, forwardInfoList, failureCause, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, forwardInfoList, failureCause, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(forwardInfoList, failureCause, error);
             } else {
                 LOG(ERROR, __FUNCTION__, " Callback is null");
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -368,15 +364,14 @@ telux::common::Status SuppServicesManagerStub::setOirPref(ServiceClass serviceCl
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, failureCause, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, failureCause, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(error, failureCause);
             } else {
                 LOG(ERROR, __FUNCTION__, " Callback is null");
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -418,15 +413,14 @@ telux::common::Status SuppServicesManagerStub::requestOirPref(ServiceClass servi
     int delay = static_cast<int>(response.delay());
 
     if ((status == telux::common::Status::SUCCESS )&& (isCallbackNeeded)) {
-        auto f1 = std::async(std::launch::async,
-            [this, suppSvcStatus, provisionStatus, failureCause, error, callback, delay]() {
+        auto f1 = telux::common::TimerService::getInstance()->runAfter(delay,
+            [this, suppSvcStatus, provisionStatus, failureCause, error, callback]() {
             if (callback) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
                 callback(suppSvcStatus, provisionStatus, failureCause, error);
             } else {
                 LOG(ERROR, __FUNCTION__, " Callback is null");
             }
-        }).share();
+        });
         taskQ_->add(f1);
     }
     return status;
@@ -8,7 +8,6 @@
 
 #include "ThermalManagerImplStub.hpp"
 #include "JsonParser.hpp"
-#include "common/therm/ThermalZoneImpl.hpp"
 #include "common/therm/CoolingDeviceImpl.hpp"
 
 #define DELAY 100
@@ -16,6 +15,7 @@
 #define THERM_SSR_FILTER "thermal_ssr"
 #define THERM_TRIP_FILTER "thermal_onTripChange"
 #define THERM_CDEV_FILTER "thermal_onCdevChange"
+#define THERM_STATE_FILTER "thermal_onStateChange"
 
 namespace telux {
 
@@ -101,6 +101,14 @@ Status ThermalManagerImplStub::registerDefaultIndications() {
         LOG(ERROR, __FUNCTION__, ":: Registering default SSR indications failed");
         return status;
     }
+
+    // Tells when the thermal zones and cooling devices cached must be read again
+    status = clientEventMgr_.registerListener(shared_from_this(), THERM_STATE_FILTER);
+    if ((status != Status::SUCCESS) &&
+        (status != Status::ALREADY)) {
+        LOG(ERROR, __FUNCTION__, ":: Registering thermal state change indications failed");
+        return status;
+    }
     return status;
 }
 
@@ -159,6 +167,8 @@ void ThermalManagerImplStub::onEventUpdate(google::protobuf::Any event) {
                 handleOnTripEvent(event);
             } else if (event.Is<::thermStub::RegisterOnCoolingDeviceLevelChangeReply>()) {
                 handleCdevStateChangeEvent(event);
+            } else if (event.Is<::thermStub::ThermalStateChangeEvent>()) {
+                handleStateChangeEvent(event);
             } else {
                 LOG(ERROR, __FUNCTION__, ":: Invalid event");
     }}).share();
@@ -184,6 +194,12 @@ void ThermalManagerImplStub::handleSSREvent(google::protobuf::Any event) {
         LOG(ERROR, __FUNCTION__, ":: INVALID SSR event");
         return;
     }
+    // The thermal state may have changed meanwhile and the generations start over
+    {
+        std::lock_guard<std::mutex> lock(snapshotMtx_);
+        snapshot_ = nullptr;
+        latestGeneration_ = 0;
+    }
     setServiceReady(srvcStatus);
     onTeluxThermalServiceStatusChange(srvcStatus);
 }
@@ -192,6 +208,7 @@ void ThermalManagerImplStub::handleOnTripEvent(google::protobuf::Any event) {
     LOG(DEBUG, __FUNCTION__);
     ::thermStub::RegisterOnTripEventReply tripRes;
     event.UnpackTo(&tripRes);
+    invalidateSnapshot();
 
     std::shared_ptr<TripPointImpl> tripPoint = nullptr;
     try {
@@ -228,6 +245,7 @@ void ThermalManagerImplStub::handleCdevStateChangeEvent(google::protobuf::Any ev
     LOG(DEBUG, __FUNCTION__);
     thermStub::RegisterOnCoolingDeviceLevelChangeReply cdevRes;
     event.UnpackTo(&cdevRes);
+    invalidateSnapshot();
 
     std::shared_ptr<CoolingDeviceImpl> cDev = nullptr;
     try {
@@ -260,6 +278,22 @@ void ThermalManagerImplStub::handleCdevStateChangeEvent(google::protobuf::Any ev
     }
 }
 
+void ThermalManagerImplStub::handleStateChangeEvent(google::protobuf::Any event) {
+    thermStub::ThermalStateChangeEvent stateEvent;
+    event.UnpackTo(&stateEvent);
+    LOG(DEBUG, __FUNCTION__, ":: generation: ", stateEvent.generation());
+
+    std::lock_guard<std::mutex> lock(snapshotMtx_);
+    if (stateEvent.generation() > latestGeneration_) {
+        latestGeneration_ = stateEvent.generation();
+    }
+}
+
+void ThermalManagerImplStub::invalidateSnapshot() {
+    std::lock_guard<std::mutex> lock(snapshotMtx_);
+    snapshot_ = nullptr;
+}
+
 void ThermalManagerImplStub::onTeluxThermalServiceStatusChange(
         ServiceStatus srvcStatus) {
     LOG(DEBUG, __FUNCTION__, ":: Service Status: ", static_cast<int>(srvcStatus));
@@ -445,76 +479,187 @@ TripType ThermalManagerImplStub::getTripType(thermStub::TripPoint_TripType grpcT
 }
 
 
-std::vector<std::shared_ptr<IThermalZone>> ThermalManagerImplStub::getThermalZones() {
-    std::vector<std::shared_ptr<IThermalZone>> tZones;
-    thermStub::GetThermalZonesRequest request;
-    thermStub::GetThermalZonesReply response;
-    ClientContext context;
+std::shared_ptr<TripPointImpl> ThermalManagerImplStub::createTripPoint(
+        const thermStub::TripPoint &grpcTripPoint) {
+    std::shared_ptr<TripPointImpl> tripPoint = std::make_shared<TripPointImpl>();
+    tripPoint->setType(getTripType(grpcTripPoint.trip_type()));
+    tripPoint->setThresholdTemp(grpcTripPoint.threshold_temp());
+    tripPoint->setHysteresis(grpcTripPoint.hysteresis());
+    tripPoint->setTripId(grpcTripPoint.trip_id());
+    tripPoint->setTZoneId(grpcTripPoint.tzone_id());
+    return tripPoint;
+}
 
-    if (SimulationManagerStub::getServiceStatus() !=
-            ServiceStatus::SERVICE_AVAILABLE) {
-        LOG(ERROR, __FUNCTION__, ":: thermal service is not available");
-        return tZones;
+std::shared_ptr<ThermalZoneImpl> ThermalManagerImplStub::createThermalZone(
+        const thermStub::ThermalZone &grpcTzone) {
+    std::shared_ptr<ThermalZoneImpl> tZone = std::make_shared<ThermalZoneImpl>();
+    tZone->setId(grpcTzone.id());
+    tZone->setDescription(grpcTzone.type());
+    tZone->setCurrentTemp(grpcTzone.current_temp());
+    tZone->setPassiveTemp(grpcTzone.passive_temp());
+    std::vector<std::shared_ptr<TripPointImpl>> tripInfo;
+    for (auto &grpcTripPoint : grpcTzone.trip_points()) {
+        tripInfo.push_back(createTripPoint(grpcTripPoint));
     }
+    tZone->setTripPoints(tripInfo);
+    std::vector<BoundCoolingDevice> boundCoolingDevices;
+    for (auto &grpcCdev : grpcTzone.bound_cooling_devices()) {
+        BoundCoolingDevice boundCoolingDevice;
+        boundCoolingDevice.coolingDeviceId = grpcCdev.cooling_device_id();
+        for (auto &grpcCdevTripPoint : grpcCdev.trip_points()) {
+            boundCoolingDevice.bindingInfo.push_back(createTripPoint(grpcCdevTripPoint));
+        }
+        boundCoolingDevices.push_back(boundCoolingDevice);
+    }
+    tZone->setBoundCoolingDevices(boundCoolingDevices);
+    return tZone;
+}
 
-    request.set_oper_type(thermStub::ProcType::LOCAL_PROC);
+std::shared_ptr<ICoolingDevice> ThermalManagerImplStub::createCoolingDevice(
+        const thermStub::CoolingDevice &grpcCdev) {
+    std::shared_ptr<CoolingDeviceImpl> cDev = std::make_shared<CoolingDeviceImpl>();
+    cDev->setId(grpcCdev.id());
+    cDev->setDescription(grpcCdev.type());
+    cDev->setMaxCoolingLevel(grpcCdev.max_cooling_state());
+    cDev->setCurrentCoolingLevel(grpcCdev.current_cooling_state());
+    return cDev;
+}
 
-    const grpc::Status status = stub_->GetThermalZones(&context, request, &response);
+std::shared_ptr<ThermalManagerImplStub::ThermalSnapshot>
+        ThermalManagerImplStub::fetchSnapshot() {
+    thermStub::GetThermalZonesRequest tzRequest;
+    thermStub::GetThermalZonesReply tzResponse;
+    ClientContext tzContext;
+
+    tzRequest.set_oper_type(thermStub::ProcType::LOCAL_PROC);
+    grpc::Status status = stub_->GetThermalZones(&tzContext, tzRequest, &tzResponse);
     if (!status.ok()) {
         LOG(ERROR, __FUNCTION__, ":: Server request failed, error: ", status.error_message());
-        return tZones;
+        return nullptr;
     }
-    LOG(DEBUG, __FUNCTION__, ":: Received Thermal Zones: ", response.thermal_zones_size());
-
-    auto grpcTzones = response.thermal_zones();
-    for(const thermStub::ThermalZone &grpcTzone : grpcTzones) {
-        std::shared_ptr<ThermalZoneImpl> tZone = std::make_shared<ThermalZoneImpl>();
-        tZone->setId(grpcTzone.id());
-        tZone->setDescription(grpcTzone.type());
-        tZone->setCurrentTemp(grpcTzone.current_temp());
-        tZone->setPassiveTemp(grpcTzone.passive_temp());
-        std::vector<std::shared_ptr<TripPointImpl>> tripInfo;
-        auto grpcTripPoints = grpcTzone.trip_points();
-        for(auto grpcTripPoint : grpcTripPoints) {
-            std::shared_ptr<TripPointImpl> tripPoint = std::make_shared<TripPointImpl>();
-            tripPoint->setType(getTripType(grpcTripPoint.trip_type()));
-            tripPoint->setThresholdTemp(grpcTripPoint.threshold_temp());
-            tripPoint->setHysteresis(grpcTripPoint.hysteresis());
-            tripPoint->setTripId(grpcTripPoint.trip_id());
-            tripPoint->setTZoneId(grpcTripPoint.tzone_id());
-            tripInfo.push_back(tripPoint);
+
+    thermStub::GetCoolingDevicesRequest cdevRequest;
+    thermStub::GetCoolingDevicesReply cdevResponse;
+    ClientContext cdevContext;
+
+    cdevRequest.set_oper_type(thermStub::ProcType::LOCAL_PROC);
+    status = stub_->GetCoolingDevices(&cdevContext, cdevRequest, &cdevResponse);
+    if (!status.ok()) {
+        LOG(ERROR, __FUNCTION__, ":: Server request failed, error: ", status.error_message());
+        return nullptr;
+    }
+    LOG(DEBUG, __FUNCTION__, ":: Received Thermal Zones: ", tzResponse.thermal_zones_size(),
+            ", Cooling devices: ", cdevResponse.cooling_devices_size());
+
+    std::shared_ptr<ThermalSnapshot> snapshot = std::make_shared<ThermalSnapshot>();
+    // A change between the two requests leaves the snapshot at the older generation,
+    // so it is read again once the change is announced
+    snapshot->generation = std::min(tzResponse.generation(), cdevResponse.generation());
+    snapshot->tZonesStatus = static_cast<telux::common::Status>(tzResponse.status());
+    snapshot->cDevsStatus = static_cast<telux::common::Status>(cdevResponse.status());
+    snapshot->tZoneByIdStatus = static_cast<telux::common::Status>(tzResponse.by_id_status());
+    snapshot->cDevByIdStatus = static_cast<telux::common::Status>(cdevResponse.by_id_status());
+    for (auto &grpcTzone : tzResponse.thermal_zones()) {
+        std::shared_ptr<IThermalZone> tZone = createThermalZone(grpcTzone);
+        snapshot->tZones.push_back(tZone);
+        snapshot->tZoneById.insert(std::make_pair(tZone->getId(), tZone));
+    }
+    for (auto &grpcCdev : cdevResponse.cooling_devices()) {
+        std::shared_ptr<ICoolingDevice> cDev = createCoolingDevice(grpcCdev);
+        snapshot->cDevs.push_back(cDev);
+        snapshot->cDevById.insert(std::make_pair(cDev->getId(), cDev));
+    }
+    return snapshot;
+}
+
+std::shared_ptr<const ThermalManagerImplStub::ThermalSnapshot>
+        ThermalManagerImplStub::getSnapshot() {
+    {
+        std::lock_guard<std::mutex> lock(snapshotMtx_);
+        if (snapshot_ && (snapshot_->generation >= latestGeneration_)) {
+            return snapshot_;
         }
-        tZone->setTripPoints(tripInfo);
-        std::vector<BoundCoolingDevice> boundCoolingDevices;
-        auto grpcCdevs = grpcTzone.bound_cooling_devices();
-        for(auto grpcCdev : grpcCdevs) {
-            BoundCoolingDevice boundCoolingDevice;
-            boundCoolingDevice.coolingDeviceId = grpcCdev.cooling_device_id();
-            std::vector<std::shared_ptr<ITripPoint>> bindingInfo;
-            auto grpcCdevTripPoints = grpcCdev.trip_points();
-            for(auto grpcCdevTripPoint : grpcCdevTripPoints) {
-                std::shared_ptr<TripPointImpl> tripPoint = std::make_shared<TripPointImpl>();
-                tripPoint->setType(getTripType(grpcCdevTripPoint.trip_type()));
-                tripPoint->setThresholdTemp(grpcCdevTripPoint.threshold_temp());
-                tripPoint->setHysteresis(grpcCdevTripPoint.hysteresis());
-                tripPoint->setTripId(grpcCdevTripPoint.trip_id());
-                tripPoint->setTZoneId(grpcCdevTripPoint.tzone_id());
-                bindingInfo.push_back(tripPoint);
-            }
-            boundCoolingDevice.bindingInfo = bindingInfo;
-            boundCoolingDevices.push_back(boundCoolingDevice);
+    }
+
+    // The callers waiting for a refresh in progress use its snapshot
+    std::lock_guard<std::mutex> refreshLock(refreshMtx_);
+    {
+        std::lock_guard<std::mutex> lock(snapshotMtx_);
+        if (snapshot_ && (snapshot_->generation >= latestGeneration_)) {
+            return snapshot_;
         }
-        tZone->setBoundCoolingDevices(boundCoolingDevices);
-        tZones.push_back(tZone);
+    }
+    std::shared_ptr<const ThermalSnapshot> snapshot = fetchSnapshot();
+    if (!snapshot) {
+        return nullptr;
+    }
+    // A snapshot missing a list is only used by this caller, the next one asks again
+    if ((snapshot->tZonesStatus != telux::common::Status::SUCCESS)
+            || (snapshot->cDevsStatus != telux::common::Status::SUCCESS)) {
+        return snapshot;
+    }
+    std::lock_guard<std::mutex> lock(snapshotMtx_);
+    snapshot_ = snapshot;
+    return snapshot;
+}
+
+std::shared_ptr<IThermalZone> ThermalManagerImplStub::fetchThermalZone(int thermalZoneId) {
+    thermStub::GetThermalZoneByIdRequest request;
+    thermStub::GetThermalZoneByIdReply response;
+    ClientContext context;
+
+    request.set_oper_type(thermStub::ProcType::LOCAL_PROC);
+    request.set_id(thermalZoneId);
+    grpc::Status status = stub_->GetThermalZoneById(&context, request, &response);
+    if (!status.ok()) {
+        LOG(ERROR, __FUNCTION__, ":: Server request failed, error: ", status.error_message());
+        return nullptr;
+    }
+    // The zone is left out of the reply on error
+    if (!response.has_thermal_zone()) {
+        return nullptr;
+    }
+    return createThermalZone(response.thermal_zone());
+}
+
+std::shared_ptr<ICoolingDevice> ThermalManagerImplStub::fetchCoolingDevice(
+        int coolingDeviceId) {
+    thermStub::GetCoolingDeviceByIdRequest request;
+    thermStub::GetCoolingDeviceByIdReply response;
+    ClientContext context;
+
+    request.set_oper_type(thermStub::ProcType::LOCAL_PROC);
+    request.set_id(coolingDeviceId);
+    grpc::Status status = stub_->GetCoolingDeviceById(&context, request, &response);
+    if (!status.ok()) {
+        LOG(ERROR, __FUNCTION__, ":: Server request failed, error: ", status.error_message());
+        return nullptr;
+    }
+    // The device is left out of the reply on error
+    if (!response.has_cooling_device()) {
+        return nullptr;
+    }
+    return createCoolingDevice(response.cooling_device());
+}
+
+std::vector<std::shared_ptr<IThermalZone>> ThermalManagerImplStub::getThermalZones() {
+    std::vector<std::shared_ptr<IThermalZone>> tZones;
+
+    if (SimulationManagerStub::getServiceStatus() !=
+            ServiceStatus::SERVICE_AVAILABLE) {
+        LOG(ERROR, __FUNCTION__, ":: thermal service is not available");
+        return tZones;
+    }
+
+    auto snapshot = getSnapshot();
+    if (snapshot && (snapshot->tZonesStatus == telux::common::Status::SUCCESS)) {
+        tZones = snapshot->tZones;
     }
     return tZones;
 }
 
 std::vector<std::shared_ptr<ICoolingDevice>> ThermalManagerImplStub::getCoolingDevices() {
     std::vector<std::shared_ptr<ICoolingDevice>> cdevs;
-    thermStub::GetCoolingDevicesRequest request;
-    thermStub::GetCoolingDevicesReply response;
-    ClientContext context;
 
     if (SimulationManagerStub::getServiceStatus() !=
             ServiceStatus::SERVICE_AVAILABLE) {
@@ -522,121 +667,54 @@ std::vector<std::shared_ptr<ICoolingDevice>> ThermalManagerImplStub::getCoolingD
         return cdevs;
     }
 
-    request.set_oper_type(thermStub::ProcType::LOCAL_PROC);
-
-    const grpc::Status status = stub_->GetCoolingDevices(&context, request, &response);
-    LOG(DEBUG, __FUNCTION__, ":: Received Cooling devices: ",
-            response.cooling_devices_size());
-
-    auto grpcCdevs = response.cooling_devices();
-    for(const thermStub::CoolingDevice &grpcCdev : grpcCdevs) {
-        std::shared_ptr<CoolingDeviceImpl> cDev = std::make_shared<CoolingDeviceImpl>();
-        cDev->setId(grpcCdev.id());
-        cDev->setDescription(grpcCdev.type());
-        cDev->setMaxCoolingLevel(grpcCdev.max_cooling_state());
-        cDev->setCurrentCoolingLevel(grpcCdev.current_cooling_state());
-        cdevs.push_back(cDev);
+    auto snapshot = getSnapshot();
+    if (snapshot && (snapshot->cDevsStatus == telux::common::Status::SUCCESS)) {
+        cdevs = snapshot->cDevs;
     }
     return cdevs;
 }
 
 std::shared_ptr<IThermalZone> ThermalManagerImplStub::getThermalZone(int thermalZoneId) {
-    thermStub::GetThermalZoneByIdRequest request;
-    thermStub::GetThermalZoneByIdReply response;
-    ClientContext context;
-
-    std::shared_ptr<ThermalZoneImpl> tZone = std::make_shared<ThermalZoneImpl>();
     if (SimulationManagerStub::getServiceStatus() !=
             ServiceStatus::SERVICE_AVAILABLE) {
         LOG(ERROR, __FUNCTION__, ":: thermal service is not available");
         return nullptr;
     }
 
-    request.set_id(thermalZoneId);
-    request.set_oper_type(thermStub::ProcType::LOCAL_PROC);
-
-    const grpc::Status status = stub_->GetThermalZoneById(&context, request, &response);
-    if (!status.ok()) {
-        LOG(ERROR, __FUNCTION__, ":: request failed");
-        return tZone;
-    }
-
-    if (!response.has_thermal_zone()) {
+    auto snapshot = getSnapshot();
+    if (!snapshot) {
         return nullptr;
     }
-
-    auto grpcTz = response.thermal_zone();
-
-    tZone->setId(grpcTz.id());
-    tZone->setDescription(grpcTz.type());
-    tZone->setCurrentTemp(grpcTz.current_temp());
-    tZone->setPassiveTemp(grpcTz.passive_temp());
-    std::vector<std::shared_ptr<TripPointImpl>> tripInfo;
-    auto grpcTripPoints = grpcTz.trip_points();
-    for(auto grpcTripPoint : grpcTripPoints) {
-        std::shared_ptr<TripPointImpl> tripPoint = std::make_shared<TripPointImpl>();
-        tripPoint->setType(getTripType(grpcTripPoint.trip_type()));
-        tripPoint->setThresholdTemp(grpcTripPoint.threshold_temp());
-        tripPoint->setHysteresis(grpcTripPoint.hysteresis());
-        tripPoint->setTripId(grpcTripPoint.trip_id());
-        tripPoint->setTZoneId(grpcTripPoint.tzone_id());
-        tripInfo.push_back(tripPoint);
+    // Without the list of zones, the zone is asked to the server on its own
+    if (snapshot->tZonesStatus != telux::common::Status::SUCCESS) {
+        return fetchThermalZone(thermalZoneId);
     }
-    tZone->setTripPoints(tripInfo);
-    std::vector<BoundCoolingDevice> boundCoolingDevices;
-    auto grpcCdevs = grpcTz.bound_cooling_devices();
-    for(auto grpcCdev : grpcCdevs) {
-        BoundCoolingDevice boundCoolingDevice;
-        boundCoolingDevice.coolingDeviceId = grpcCdev.cooling_device_id();
-        std::vector<std::shared_ptr<ITripPoint>> bindingInfo;
-        auto grpcCdevTripPoints = grpcCdev.trip_points();
-        for(auto grpcCdevTripPoint : grpcCdevTripPoints) {
-            std::shared_ptr<TripPointImpl> tripPoint = std::make_shared<TripPointImpl>();
-            tripPoint->setType(getTripType(grpcCdevTripPoint.trip_type()));
-            tripPoint->setThresholdTemp(grpcCdevTripPoint.threshold_temp());
-            tripPoint->setHysteresis(grpcCdevTripPoint.hysteresis());
-            tripPoint->setTripId(grpcCdevTripPoint.trip_id());
-            tripPoint->setTZoneId(grpcCdevTripPoint.tzone_id());
-            bindingInfo.push_back(tripPoint);
-        }
-        boundCoolingDevice.bindingInfo = bindingInfo;
-        boundCoolingDevices.push_back(boundCoolingDevice);
+    if (snapshot->tZoneByIdStatus != telux::common::Status::SUCCESS) {
+        return nullptr;
     }
-    tZone->setBoundCoolingDevices(boundCoolingDevices);
-    return tZone;
+    auto itr = snapshot->tZoneById.find(thermalZoneId);
+    return (itr != snapshot->tZoneById.end()) ? itr->second : nullptr;
 }
 
 std::shared_ptr<ICoolingDevice> ThermalManagerImplStub::getCoolingDevice(int coolingDeviceId) {
-    thermStub::GetCoolingDeviceByIdRequest request;
-    thermStub::GetCoolingDeviceByIdReply response;
-    ClientContext context;
-
-    std::shared_ptr<CoolingDeviceImpl> cDev = std::make_shared<CoolingDeviceImpl>();
     if (SimulationManagerStub::getServiceStatus() !=
             ServiceStatus::SERVICE_AVAILABLE) {
         LOG(ERROR, __FUNCTION__, ":: thermal service is not available");
         return nullptr;
     }
 
-    request.set_id(coolingDeviceId);
-    request.set_oper_type(thermStub::ProcType::LOCAL_PROC);
-
-    const grpc::Status status = stub_->GetCoolingDeviceById(&context, request, &response);
-    if (!status.ok()) {
-        LOG(ERROR, __FUNCTION__, ":: request failed");
-        return cDev;
+    auto snapshot = getSnapshot();
+    if (!snapshot) {
+        return nullptr;
     }
-
-    if (!response.has_cooling_device()) {
+    if (snapshot->cDevsStatus != telux::common::Status::SUCCESS) {
+        return fetchCoolingDevice(coolingDeviceId);
+    }
+    if (snapshot->cDevByIdStatus != telux::common::Status::SUCCESS) {
         return nullptr;
     }
-
-    auto grpcCdev = response.cooling_device();
-    cDev->setId(grpcCdev.id());
-    cDev->setDescription(grpcCdev.type());
-    cDev->setMaxCoolingLevel(grpcCdev.max_cooling_state());
-    cDev->setCurrentCoolingLevel(grpcCdev.current_cooling_state());
-    return cDev;
+    auto itr = snapshot->cDevById.find(coolingDeviceId);
+    return (itr != snapshot->cDevById.end()) ? itr->second : nullptr;
 }
 
 }  // end of namespace therm
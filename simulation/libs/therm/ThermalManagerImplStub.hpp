@@ -6,6 +6,9 @@
 #ifndef THERMAL_MANAGER_IMPL_STUB_HPP
 #define THERMAL_MANAGER_IMPL_STUB_HPP
 
+#include <map>
+#include <mutex>
+
 #include <telux/therm/ThermalManager.hpp>
 #include <telux/common/CommonDefines.hpp>
 #include "AsyncTaskQueue.hpp"
@@ -13,6 +16,7 @@
 #include "ListenerManager.hpp"
 #include "event-manager/ClientEventManager.hpp"
 #include "protos/proto-src/therm_simulation.grpc.pb.h"
+#include "common/therm/ThermalZoneImpl.hpp"
 
 using thermStub::Thermal;
 
@@ -58,12 +62,43 @@ class ThermalManagerImplStub : public IThermalManager,
     telux::common::Status registerDefaultIndications();
 
  private:
+    /* Thermal zones and cooling devices of one generation of the server thermal state.
+     * It isn't modified once published, the callers share its objects. */
+    struct ThermalSnapshot {
+        uint64_t generation = 0;
+        /* Status of the list and by id APIs, only a snapshot without error is kept */
+        telux::common::Status tZonesStatus = telux::common::Status::FAILED;
+        telux::common::Status cDevsStatus = telux::common::Status::FAILED;
+        telux::common::Status tZoneByIdStatus = telux::common::Status::FAILED;
+        telux::common::Status cDevByIdStatus = telux::common::Status::FAILED;
+        std::vector<std::shared_ptr<IThermalZone>> tZones;
+        std::vector<std::shared_ptr<ICoolingDevice>> cDevs;
+        std::map<int, std::shared_ptr<IThermalZone>> tZoneById;
+        std::map<int, std::shared_ptr<ICoolingDevice>> cDevById;
+    };
+
     uint32_t cbDelay_ = 0;
     telux::common::ProcType procType_;
     std::shared_ptr<ListenerManager<IThermalListener, ThermalNotificationMask>> listenerMgr_;
     ClientEventManager &clientEventMgr_;
     std::mutex mgrListenerMtx_;
     telux::common::AsyncTaskQueue<void> taskQ_;
+    std::mutex snapshotMtx_;
+    std::shared_ptr<const ThermalSnapshot> snapshot_;
+    /* Latest generation announced by the server */
+    uint64_t latestGeneration_ = 0;
+    /* Serializes the snapshot refreshes */
+    std::mutex refreshMtx_;
+
+    std::shared_ptr<const ThermalSnapshot> getSnapshot();
+    std::shared_ptr<ThermalSnapshot> fetchSnapshot();
+    void invalidateSnapshot();
+    std::shared_ptr<IThermalZone> fetchThermalZone(int thermalZoneId);
+    std::shared_ptr<ICoolingDevice> fetchCoolingDevice(int coolingDeviceId);
+    std::shared_ptr<TripPointImpl> createTripPoint(const thermStub::TripPoint &grpcTripPoint);
+    std::shared_ptr<ThermalZoneImpl> createThermalZone(const thermStub::ThermalZone &grpcTzone);
+    std::shared_ptr<ICoolingDevice> createCoolingDevice(
+        const thermStub::CoolingDevice &grpcCdev);
 
     TripType getTripType(thermStub::TripPoint_TripType grpcTripType);
     TripEvent getTripEvent(thermStub::TripEvent grpcTripEvent);
@@ -73,6 +108,7 @@ class ThermalManagerImplStub : public IThermalManager,
     void handleSSREvent(google::protobuf::Any event);
     void handleOnTripEvent(google::protobuf::Any event);
     void handleCdevStateChangeEvent(google::protobuf::Any event);
+    void handleStateChangeEvent(google::protobuf::Any event);
     void onTeluxThermalServiceStatusChange(telux::common::ServiceStatus srvcStatus);
 
 };
@@ -13,14 +13,17 @@
 
 #include <iostream>
 #include <thread>
+#include <unistd.h>
 #include <telux/common/CommonDefines.hpp>
 
 #include <grpcpp/grpcpp.h>
+#include <grpcpp/resource_quota.h>
 
 #include "../../libs/common/SimulationConfigParser.hpp"
 #include "../../libs/common/Logger.hpp"
 
 #include "SimulationServer.hpp"
+#include "common/RpcExecutor.hpp"
 #include "cv2x/Cv2xManagerServerImpl.hpp"
 #include "cv2x/Cv2xThrottleManagerServerImpl.hpp"
 #include "cv2x/Cv2xConfigServerImpl.hpp"
@@ -103,6 +106,53 @@ std::string SimulationServer::createServerAddress(std::string ipAddress, std::st
     return ipAddress+ ":" + portNo;
 }
 
+int SimulationServer::getConfigValue(std::shared_ptr<SimulationConfigParser> config,
+    std::string key) {
+    std::string value = config->getValue(key);
+    if (value.empty()) {
+        return -1;
+    }
+    int number = -1;
+    try {
+        number = std::stoi(value);
+    } catch (const std::exception& e) {
+        number = -1;
+    }
+    if (number < 1) {
+        LOG(ERROR, __FUNCTION__, " Invalid value of ", key, ": ", value);
+        return -1;
+    }
+    return number;
+}
+
+void SimulationServer::configureServerBuilder(std::shared_ptr<SimulationConfigParser> config,
+    ServerBuilder &builder) {
+    int numCqs = getConfigValue(config, "RPC_NUM_CQS");
+    if (numCqs > 0) {
+        builder.SetSyncServerOption(ServerBuilder::SyncServerOption::NUM_CQS, numCqs);
+    }
+    int minPollers = getConfigValue(config, "RPC_MIN_POLLERS");
+    if (minPollers > 0) {
+        builder.SetSyncServerOption(ServerBuilder::SyncServerOption::MIN_POLLERS, minPollers);
+    }
+    int maxPollers = getConfigValue(config, "RPC_MAX_POLLERS");
+    if (maxPollers > 0) {
+        builder.SetSyncServerOption(ServerBuilder::SyncServerOption::MAX_POLLERS, maxPollers);
+    }
+    int maxThreads = getConfigValue(config, "RPC_MAX_THREADS");
+    if (maxThreads > 0) {
+        grpc::ResourceQuota quota(APP_NAME);
+        quota.SetMaxThreads(maxThreads);
+        builder.SetResourceQuota(quota);
+    }
+    int executorThreads = getConfigValue(config, "RPC_EXECUTOR_THREADS");
+    if (executorThreads > 0) {
+        RpcExecutor::getInstance().setThreadCount(executorThreads);
+    }
+    LOG(INFO, __FUNCTION__, " CQs: ", numCqs, ", pollers: ", minPollers, "-", maxPollers,
+        ", max threads: ", maxThreads, ", executor threads: ", executorThreads);
+}
+
 void SimulationServer::startGrpcServer() {
     LOG(DEBUG, __FUNCTION__);
     std::string serverIpAddress = LOCAL_HOST;
@@ -113,6 +163,14 @@ void SimulationServer::startGrpcServer() {
     grpc::EnableDefaultHealthCheckService(true);
     ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    // Clients on the same host can skip the TCP stack, the port stays open for the others
+    std::string udsPath = config->getValue("RPC_UDS_PATH");
+    if (!udsPath.empty()) {
+        unlink(udsPath.c_str());
+        builder.AddListeningPort("unix:" + udsPath, grpc::InsecureServerCredentials());
+        LOG(INFO, __FUNCTION__, " Listening on unix:", udsPath);
+    }
+    configureServerBuilder(config, builder);
 
     std::shared_ptr<CardManagerServerImpl> cardService = std::make_shared<CardManagerServerImpl>();
     builder.RegisterService(cardService.get());
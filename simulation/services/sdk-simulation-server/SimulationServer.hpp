@@ -44,10 +44,13 @@
 
 #include <string>
 #include <memory>
+#include <grpcpp/grpcpp.h>
 #include "libs/common/AsyncTaskQueue.hpp"
 
 #define APP_NAME "SimulationServer"
 
+class SimulationConfigParser;
+
 class SimulationServer {
 public:
     static SimulationServer &getInstance();
@@ -60,6 +63,9 @@ private:
     std::string createServerAddress(std::string ipAddress,
         std::string portNo);
     void startGrpcServer();
+    int getConfigValue(std::shared_ptr<SimulationConfigParser> config, std::string key);
+    void configureServerBuilder(std::shared_ptr<SimulationConfigParser> config,
+        grpc::ServerBuilder &builder);
     void updateJsonValue(std::string message);
 
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
@@ -11,6 +11,9 @@ extern "C" {
 #include "libs/common/SimulationConfigParser.hpp"
 
 #define DEFAULT_DEVICE "default"
+#define DEFAULT_MIXER_SAMPLE_RATE 48000
+/* Bitrate used when encoding to AMR-WB, mode 8 is 23.85 kbps */
+#define AMRWB_ENCODE_MODE 8
 
 /* #define DDEBUG 1 */
 
@@ -68,8 +71,7 @@ Alsa::Alsa() {
     }
     runLoopback_ = false;
     runTone_ = false;
-    pipelineLen = rand() % 10;
-    sendWriteReady = 0;
+    runDtmf_ = false;
 }
 
 Alsa::~Alsa() {
@@ -91,6 +93,14 @@ telux::common::ErrorCode Alsa::init(std::shared_ptr<ISSREventListener> ssrEventL
          LOG(INFO, __FUNCTION__, " default device mapping loaded");
     }
 
+    /* All PLAY streams are mixed in software and played through a single PCM handle */
+    mixer_ = std::unique_ptr<AudioMixer>(new (std::nothrow) AudioMixer(pcmDevice_,
+        loadMixerSampleRate()));
+    if (!mixer_) {
+        LOG(ERROR, __FUNCTION__, " can't allocate AudioMixer");
+        return telux::common::ErrorCode::NO_MEMORY;
+    }
+
     /* Register for event-injection notification for audio filter. */
     auto &serverEventManager = ServerEventManager::getInstance();
     status = serverEventManager.registerListener(shared_from_this(), AUDIO_FILTER);
@@ -193,6 +203,7 @@ telux::common::ErrorCode Alsa::createStream(StreamHandle& streamHandle,
         /*
          * Enable DTMF detection. Currently only RX path is supported.
          */
+        std::lock_guard<std::mutex> lock(dtmfMutex_);
         dtmfIndicationListenerMap_[streamParams.streamId] = streamParams.streamEventListener;
         LOG(DEBUG, __FUNCTION__,"Registered listener ");
         return telux::common::ErrorCode::SUCCESS;
@@ -238,6 +249,24 @@ telux::common::ErrorCode Alsa::createStream(StreamHandle& streamHandle,
         return telux::common::ErrorCode::SUCCESS;
     }
 
+    if (((StreamType::PLAY == streamHandle.type) ||
+            (StreamType::TONE_GENERATOR == streamHandle.type)) && mixer_) {
+        uint32_t periodFrames = 0;
+
+        /* Playback stream becomes an input of the software mixer, no PCM handle is opened */
+        ec = mixer_->addInput(streamParams.streamId,
+            streamParams.config.streamConfig.sampleRate, streamHandle.channels, periodFrames);
+        if (ec != telux::common::ErrorCode::SUCCESS) {
+            return ec;
+        }
+
+        streamHandle.mixerInputId = streamParams.streamId;
+        streamHandle.frames = std::min(periodFrames,
+            static_cast<uint32_t>(MAX_BUFFER_SIZE / (streamHandle.channels * 2)));
+        writeBufferMinSize = streamHandle.frames * streamHandle.channels * 2;
+        return telux::common::ErrorCode::SUCCESS;
+    }
+
     ec = mapStreamType(streamHandle.type, stream);
     if (ec != telux::common::ErrorCode::SUCCESS) {
         return ec;
@@ -266,19 +295,11 @@ telux::common::ErrorCode Alsa::createStream(StreamHandle& streamHandle,
         return telux::common::ErrorCode::SYSTEM_ERR;
     }
 
-    if(StreamType::TONE_GENERATOR == streamHandle.type) {
-        ret = snd_pcm_hw_params_set_format(streamHandle.pcmHandle, params, SND_PCM_FORMAT_FLOAT);
-        if (ret < 0){
-            LOG(ERROR, __FUNCTION__,"Can't set format.");
-            return telux::common::ErrorCode::SYSTEM_ERR;
-        }
-    } else {
-        /* Restrict a configuration space to contain only one format. */
-        ret = snd_pcm_hw_params_set_format(streamHandle.pcmHandle, params, format);
-        if (ret < 0){
-            LOG(ERROR, __FUNCTION__,"Can't set format.");
-            return telux::common::ErrorCode::SYSTEM_ERR;
-        }
+    /* Restrict a configuration space to contain only one format. */
+    ret = snd_pcm_hw_params_set_format(streamHandle.pcmHandle, params, format);
+    if (ret < 0){
+        LOG(ERROR, __FUNCTION__,"Can't set format.");
+        return telux::common::ErrorCode::SYSTEM_ERR;
     }
 
     /* Restrict a configuration space to contain only given no channels count.*/
@@ -335,6 +356,18 @@ telux::common::ErrorCode Alsa::createStream(StreamHandle& streamHandle,
         if (ec != telux::common::ErrorCode::SUCCESS) {
             return telux::common::ErrorCode::SYSTEM_ERR;
         }
+        {
+            /* Captured samples are scanned for DTMF digits while a listener is registered */
+            std::weak_ptr<Alsa> wp = shared_from_this();
+            streamHandle.dtmfDetector = std::make_shared<DtmfDetector>(
+                streamParams.config.streamConfig.sampleRate,
+                [wp](uint32_t lowFreq, uint32_t highFreq) {
+                    auto sp = wp.lock();
+                    if (sp) {
+                        sp->notifyDtmfDetected(lowFreq, highFreq);
+                    }
+                });
+        }
     default:
         /* Default values of writeBufferMinSize and readBufferMinSize set to 0.*/
         break;
@@ -349,19 +382,42 @@ telux::common::ErrorCode Alsa::deleteStream(StreamHandle& streamHandle) {
 
     switch (streamHandle.type) {
     case StreamType::VOICE_CALL:
+        if (streamHandle.privateStreamData) {
+            stopDtmfPlayback();
+            std::lock_guard<std::mutex> lock(dtmfMutex_);
+            dtmfIndicationListenerMap_.erase(streamHandle.privateStreamData->streamId);
+        }
         return telux::common::ErrorCode::SUCCESS;
         break;
     case StreamType::TONE_GENERATOR:
+        runTone_ = false;
         for(std::thread &th: toneThread_) {
             if(th.joinable()){
                 th.join();
             }
         }
     case StreamType::PLAY:
-        if(streamHandle.inTranscodeStreamId == inTranscodeStreamId_) {
+        if (streamHandle.transcoder) {
+            TranscoderStats stats = streamHandle.transcoder->getStats();
+            LOG(INFO, __FUNCTION__, " transcoded frames ", stats.framesTranscoded,
+                " invalid ", stats.invalidFrames, " codec ns ", stats.codecTimeNs,
+                " max batch ns ", stats.maxBatchTimeNs, " write stalls ", stats.writeStalls,
+                " read shortfalls ", stats.readShortfalls);
+            streamHandle.transcoder->stop();
+            streamHandle.transcoder = nullptr;
             return telux::common::ErrorCode::SUCCESS;
         }
 
+        if (streamHandle.mixerInputId >= 0) {
+            MixerStats stats = mixer_->getStats();
+            LOG(INFO, __FUNCTION__, " mixer inputs ", stats.activeInputs,
+                " periods ", stats.periodsMixed, " input underruns ", stats.inputUnderruns,
+                " device underruns ", stats.deviceUnderruns,
+                " avg mix ns ", stats.avgMixLatencyNs, " max mix ns ", stats.maxMixLatencyNs,
+                " queued us ", stats.queuedLatencyUs);
+            return mixer_->removeInput(streamHandle.mixerInputId);
+        }
+
         ret = snd_pcm_drop(streamHandle.pcmHandle);
         if (ret  < 0){
             LOG(ERROR, __FUNCTION__,"Can't drain PCM. ");
@@ -375,7 +431,9 @@ telux::common::ErrorCode Alsa::deleteStream(StreamHandle& streamHandle) {
         }
         break;
     case StreamType::CAPTURE:
-        if(streamHandle.outTranscodeStreamId == outTranscodeStreamId_) {
+        if (streamHandle.transcoder) {
+            streamHandle.transcoder->stop();
+            streamHandle.transcoder = nullptr;
             return telux::common::ErrorCode::SUCCESS;
         }
 
@@ -497,6 +555,38 @@ telux::common::ErrorCode Alsa::setVolume(StreamHandle streamHandle,
 
     numChannels = channelsVolume.size();
 
+    if (streamHandle.mixerInputId >= 0) {
+        /* Volume of a mixed stream is applied by the mixer, other streams are not affected */
+        float gains[2];
+        telux::common::ErrorCode ec;
+
+        ec = mixer_->getGain(streamHandle.mixerInputId, gains[0], gains[1]);
+        if (ec != telux::common::ErrorCode::SUCCESS) {
+            return ec;
+        }
+
+        for (uint32_t x = 0; x < numChannels; x++) {
+            switch(channelsVolume.at(x).channelType) {
+                case ChannelType::LEFT:
+                    gains[0] = channelsVolume.at(x).vol;
+                    break;
+                case ChannelType::RIGHT:
+                    gains[1] = channelsVolume.at(x).vol;
+                    break;
+                default:
+                    LOG(ERROR, __FUNCTION__, " invalid channel type ",
+                        channelsVolume.at(x).channelType);
+                    return telux::common::ErrorCode::INVALID_ARGUMENTS;
+            }
+            if (streamHandle.channels == 1) {
+                /* Mono stream is played on both channels */
+                gains[0] = gains[1] = channelsVolume.at(x).vol;
+            }
+        }
+
+        return mixer_->setGain(streamHandle.mixerInputId, gains[0], gains[1]);
+    }
+
     if ((err = snd_mixer_open(&h_mixer, 0)) < 0) {
         LOG(ERROR, __FUNCTION__,"Mixer open error: ", err);
     }
@@ -606,6 +696,28 @@ telux::common::ErrorCode Alsa::getVolume(StreamHandle streamHandle,
             return telux::common::ErrorCode::INVALID_ARGUMENTS;
     }
 
+    if (streamHandle.mixerInputId >= 0) {
+        float gains[2];
+        telux::common::ErrorCode ec;
+
+        ec = mixer_->getGain(streamHandle.mixerInputId, gains[0], gains[1]);
+        if (ec != telux::common::ErrorCode::SUCCESS) {
+            return ec;
+        }
+
+        for (auto channel : channels) {
+            if (channel == SND_MIXER_SCHN_FRONT_LEFT) {
+                tmp.channelType = ChannelType::LEFT;
+                tmp.vol = std::ceil(gains[0] * 10.0) / 10.0;
+            } else {
+                tmp.channelType = ChannelType::RIGHT;
+                tmp.vol = std::ceil(gains[1] * 10.0) / 10.0;
+            }
+            channelsVolume.emplace_back(tmp);
+        }
+        return telux::common::ErrorCode::SUCCESS;
+    }
+
     if ((err = snd_mixer_open(&h_mixer, 0)) < 0) {
         LOG(ERROR, __FUNCTION__,"Mixer open error: ", err);
     }
@@ -725,27 +837,21 @@ telux::common::ErrorCode Alsa::write(StreamHandle& streamHandle,
         uint32_t offset, int64_t timeStamp, bool isLastBuffer,
         int64_t& actualLengthWritten) {
 
-    if(streamHandle.inTranscodeStreamId == inTranscodeStreamId_) {
-        sendWriteReady++;
-        if(sendWriteReady%pipelineLen == 0 && (!isLastBuffer)){
-            auto streamEventListener = streamHandle.privateStreamData->streamEventListener.lock();
-            if (streamEventListener) {
-                streamEventListener->onWriteReadyEvent(inTranscodeStreamId_);
-            }
-
-            actualLengthWritten = 0;
+    if (streamHandle.transcoder) {
+        /* Remaining data is sent again after the write ready event */
+        actualLengthWritten = streamHandle.transcoder->write(data, writeLengthRequested,
+            isLastBuffer);
+        return telux::common::ErrorCode::SUCCESS;
+    }
 
-            return telux::common::ErrorCode::SUCCESS;
+    if (streamHandle.mixerInputId >= 0) {
+        /* Blocks while the stream's mixer queue is full */
+        telux::common::ErrorCode ec = mixer_->write(streamHandle.mixerInputId, data,
+            writeLengthRequested);
+        if (ec != telux::common::ErrorCode::SUCCESS) {
+            return ec;
         }
-
         actualLengthWritten = writeLengthRequested;
-        if(isLastBuffer){
-            auto streamEventListener = streamHandle.privateStreamData->streamEventListener.lock();
-            if (streamEventListener) {
-                streamEventListener->onDrainDoneEvent(inTranscodeStreamId_);
-            }
-            sendWriteReady = 0;
-        }
         return telux::common::ErrorCode::SUCCESS;
     }
 
@@ -753,18 +859,15 @@ telux::common::ErrorCode Alsa::write(StreamHandle& streamHandle,
     actualLengthWritten = snd_pcm_writei(streamHandle.pcmHandle, data, streamHandle.frames);
     if (actualLengthWritten == -EPIPE) {
         snd_pcm_prepare(streamHandle.pcmHandle);
-        free(data);
         actualLengthWritten = 0;
         return telux::common::ErrorCode::SUCCESS;
     }
 
     if(actualLengthWritten == -ESTRPIPE) {
         LOG(ERROR, __FUNCTION__,"write error: ", snd_strerror(actualLengthWritten));
-        free(data);
         return telux::common::ErrorCode::SYSTEM_ERR;
     }
 
-    free(data);
     LOG(DEBUG, __FUNCTION__,"written frames ", actualLengthWritten);
     /*
      * Set the actualLengthWritten to writeLengthRequested as the value for the last buffer size
@@ -777,22 +880,26 @@ telux::common::ErrorCode Alsa::write(StreamHandle& streamHandle,
 }
 
 telux::common::ErrorCode Alsa::read(StreamHandle& streamHandle,
-        std::shared_ptr<std::vector<uint8_t>> data, uint32_t readLengthRequested,
+        uint8_t *data, uint32_t readLengthRequested,
         int64_t& actualReadLength) {
 
-    if(streamHandle.outTranscodeStreamId == outTranscodeStreamId_) {
-        actualReadLength = readLengthRequested;
+    if (streamHandle.transcoder) {
+        actualReadLength = streamHandle.transcoder->read(data, readLengthRequested);
         return telux::common::ErrorCode::SUCCESS;
     }
 
-    uint8_t* bufferPtr = data->data();
-    actualReadLength = snd_pcm_readi(streamHandle.pcmHandle, bufferPtr, streamHandle.frames);
+    actualReadLength = snd_pcm_readi(streamHandle.pcmHandle, data, streamHandle.frames);
 
     if (actualReadLength == -EPIPE || actualReadLength == -ESTRPIPE) {
         LOG(ERROR, __FUNCTION__,"read error: ", snd_strerror(actualReadLength));
         return telux::common::ErrorCode::SYSTEM_ERR;
     }
 
+    if ((actualReadLength > 0) && streamHandle.dtmfDetector && hasDtmfListeners()) {
+        streamHandle.dtmfDetector->process(reinterpret_cast<const int16_t *>(data),
+            actualReadLength, streamHandle.channels);
+    }
+
     LOG(DEBUG, __FUNCTION__,"read frames ", actualReadLength);
     actualReadLength = actualReadLength * streamHandle.channels * 2;
 
@@ -801,6 +908,14 @@ telux::common::ErrorCode Alsa::read(StreamHandle& streamHandle,
 
 telux::common::ErrorCode Alsa::drain(StreamHandle streamHandle) {
 
+    /* Drain is done once the mixer has played out what this stream queued */
+    if (streamHandle.mixerInputId >= 0) {
+        telux::common::ErrorCode ec = mixer_->drain(streamHandle.mixerInputId);
+        if (ec != telux::common::ErrorCode::SUCCESS) {
+            return ec;
+        }
+    }
+
     auto streamEventListener = streamHandle.privateStreamData->streamEventListener.lock();
     if (streamEventListener) {
         streamEventListener->onDrainDoneEvent(streamHandle.privateStreamData->streamId);
@@ -811,6 +926,10 @@ telux::common::ErrorCode Alsa::drain(StreamHandle streamHandle) {
 
 telux::common::ErrorCode Alsa::flush(StreamHandle streamHandle) {
 
+    if (streamHandle.mixerInputId >= 0) {
+        return mixer_->flush(streamHandle.mixerInputId);
+    }
+
     return telux::common::ErrorCode::SUCCESS;
 }
 
@@ -819,18 +938,74 @@ telux::common::ErrorCode Alsa::flush(StreamHandle streamHandle) {
  */
 telux::common::ErrorCode Alsa::startDtmf(StreamHandle streamHandle, uint16_t gain,
         uint16_t duration, DtmfTone dtmfTone) {
+
+    telux::common::ErrorCode ec;
+    uint32_t periodFrames;
+    uint32_t inputId;
+    std::vector<uint16_t> frequencies{static_cast<uint16_t>(dtmfTone.lowFreq),
+        static_cast<uint16_t>(dtmfTone.highFreq)};
+
+    if (!mixer_ || !streamHandle.privateStreamData) {
+        return telux::common::ErrorCode::INVALID_STATE;
+    }
+
+    /* Tone is played on the local device, as an input of the mixer */
+    stopDtmfPlayback();
+
+    std::lock_guard<std::mutex> lock(dtmfPlayMutex_);
+
+    inputId = streamHandle.privateStreamData->streamId;
+    ec = mixer_->addInput(inputId, mixer_->getSampleRate(), 1, periodFrames);
+    if (ec != telux::common::ErrorCode::SUCCESS) {
+        return ec;
+    }
+
+    dtmfMixerInputId_ = inputId;
+    runDtmf_ = true;
+    dtmfThread_ = std::thread(&Alsa::generateTone, this, inputId, 1, mixer_->getSampleRate(),
+        gain, duration, frequencies, std::ref(runDtmf_));
+
     return telux::common::ErrorCode::SUCCESS;
 }
 
 telux::common::ErrorCode Alsa::stopDtmf(StreamHandle streamHandle, StreamDirection direction) {
+
+    stopDtmfPlayback();
     return telux::common::ErrorCode::SUCCESS;
 }
 
+void Alsa::stopDtmfPlayback() {
+
+    std::lock_guard<std::mutex> lock(dtmfPlayMutex_);
+
+    runDtmf_ = false;
+    if (dtmfThread_.joinable()) {
+        dtmfThread_.join();
+    }
+
+    if (dtmfMixerInputId_ >= 0) {
+        mixer_->removeInput(dtmfMixerInputId_);
+        dtmfMixerInputId_ = -1;
+    }
+}
+
 /*
  * Enable DTMF detection. Currently only RX path is supported.
  */
 telux::common::ErrorCode Alsa::registerDTMFDetection(StreamHandle streamHandle) {
 
+    if (!streamHandle.privateStreamData) {
+        return telux::common::ErrorCode::INVALID_STATE;
+    }
+
+    auto listener = streamHandle.privateStreamData->streamEventListener.lock();
+    if (!listener) {
+        return telux::common::ErrorCode::INVALID_STATE;
+    }
+
+    std::lock_guard<std::mutex> lock(dtmfMutex_);
+    dtmfIndicationListenerMap_[streamHandle.privateStreamData->streamId] = listener;
+
     return telux::common::ErrorCode::SUCCESS;
 }
 
@@ -839,9 +1014,33 @@ telux::common::ErrorCode Alsa::registerDTMFDetection(StreamHandle streamHandle)
  */
 telux::common::ErrorCode Alsa::deRegisterDTMFDetection(StreamHandle streamHandle) {
 
+    if (!streamHandle.privateStreamData) {
+        return telux::common::ErrorCode::INVALID_STATE;
+    }
+
+    std::lock_guard<std::mutex> lock(dtmfMutex_);
+    dtmfIndicationListenerMap_.erase(streamHandle.privateStreamData->streamId);
+
     return telux::common::ErrorCode::SUCCESS;
 }
 
+bool Alsa::hasDtmfListeners() {
+
+    std::lock_guard<std::mutex> lock(dtmfMutex_);
+    return !dtmfIndicationListenerMap_.empty();
+}
+
+void Alsa::notifyDtmfDetected(uint32_t lowFreq, uint32_t highFreq) {
+
+    std::lock_guard<std::mutex> lock(dtmfMutex_);
+
+    LOG(DEBUG, __FUNCTION__, " low ", lowFreq, " high ", highFreq);
+    for (auto it = dtmfIndicationListenerMap_.begin(); it != dtmfIndicationListenerMap_.end();
+            it++) {
+        it->second->onDTMFDetectedEvent(it->first, lowFreq, highFreq, StreamDirection::RX);
+    }
+}
+
 /*
  * AMR* data
  *  Input(from telsdk's perspective)/Play(from PAL's perspective)
@@ -857,8 +1056,8 @@ telux::common::ErrorCode Alsa::setupInTranscodeStream(StreamHandle& streamHandle
         uint32_t streamId, TranscodingFormatInfo inInfo,
         std::shared_ptr<IStreamEventListener> streamEventListener,
         uint32_t& writeMinSize) {
-    streamHandle.inTranscodeStreamId = streamId;
-    inTranscodeStreamId_ = streamId;
+
+    std::weak_ptr<IStreamEventListener> wp = streamEventListener;
 
     streamHandle.privateStreamData = new (std::nothrow) PrivateStreamData();
     if (!streamHandle.privateStreamData) {
@@ -869,6 +1068,29 @@ telux::common::ErrorCode Alsa::setupInTranscodeStream(StreamHandle& streamHandle
     streamHandle.privateStreamData->streamId = streamId;
     streamHandle.privateStreamData->streamEventListener = streamEventListener;
 
+    /* Write ready and drain done are indicated on the input stream */
+    try {
+        streamHandle.transcoder = std::make_shared<Transcoder>(inInfo,
+            std::unique_ptr<ISpeechCodec>(new AmrwbCodec(AMRWB_ENCODE_MODE)),
+            [wp, streamId] {
+                auto sp = wp.lock();
+                if (sp) {
+                    sp->onWriteReadyEvent(streamId);
+                }
+            },
+            [wp, streamId] {
+                auto sp = wp.lock();
+                if (sp) {
+                    sp->onDrainDoneEvent(streamId);
+                }
+            });
+    } catch (const std::exception& e) {
+        LOG(ERROR, __FUNCTION__, " can't create Transcoder");
+        return telux::common::ErrorCode::NO_MEMORY;
+    }
+
+    writeMinSize = streamHandle.transcoder->getWriteMinSize();
+
     return telux::common::ErrorCode::SUCCESS;
 }
 
@@ -877,10 +1099,15 @@ telux::common::ErrorCode Alsa::setupOutTranscodeStream(StreamHandle& streamHandl
         std::shared_ptr<IStreamEventListener> streamEventListener,
         uint32_t& readMinSize) {
 
-    streamHandle.outTranscodeStreamId = streamId;
-    outTranscodeStreamId_ = streamId;
+    telux::common::ErrorCode ec;
+
+    /* The caller passes the transcoder created with the input stream in streamHandle */
+    if (!streamHandle.transcoder) {
+        LOG(ERROR, __FUNCTION__, " input stream not setup");
+        return telux::common::ErrorCode::INVALID_STATE;
+    }
 
-     streamHandle.privateStreamData = new (std::nothrow) PrivateStreamData();
+    streamHandle.privateStreamData = new (std::nothrow) PrivateStreamData();
     if (!streamHandle.privateStreamData) {
         LOG(ERROR, __FUNCTION__, " can't allocate PrivateStreamData");
         return telux::common::ErrorCode::NO_MEMORY;
@@ -889,86 +1116,52 @@ telux::common::ErrorCode Alsa::setupOutTranscodeStream(StreamHandle& streamHandl
     streamHandle.privateStreamData->streamId = streamId;
     streamHandle.privateStreamData->streamEventListener = streamEventListener;
 
-    return telux::common::ErrorCode::SUCCESS;
-}
-
-
-float Alsa::generateSignal(float t1, float t2) {
-    //Z transform used for 2 frequency tone.
-    float ret = 2;
-
-    InFreq1_ = 2*cos(t1)*RegFreq1_[0]-RegFreq1_[1];
-    RegFreq1_[1] = RegFreq1_[0];
-    RegFreq1_[0] = InFreq1_;
-
-    ret += sin(t1)*RegFreq1_[1];
-
-    InFreq2_ = 2*cos(t2)*RegFreq2_[0]-RegFreq2_[1];
-    RegFreq2_[1] = RegFreq2_[0];
-    RegFreq2_[0] = InFreq2_;
-
-    ret += sin(t2)*RegFreq2_[1];
+    ec = streamHandle.transcoder->start(outInfo);
+    if (ec != telux::common::ErrorCode::SUCCESS) {
+        streamHandle.transcoder = nullptr;
+        return ec;
+    }
 
-    return ret;
+    readMinSize = streamHandle.transcoder->getReadMinSize();
+    return telux::common::ErrorCode::SUCCESS;
 }
 
-void Alsa::genTone(std::vector<uint16_t> toneFrequency, int channels, uint32_t sampleRate,
-    uint16_t gain, float buf[]) {
 
-    int noOfFreq = toneFrequency.size();
-    float t, t1, t2;
-
-    switch(noOfFreq) {
-        case 1:
-            t = 2*M_PI*toneFrequency[0]/(sampleRate*channels);
-            for (uint32_t i=0; i < sampleRate; i++) {
-                buf[i] = sin(t*i);
-            }
-            break;
-        case 2:
-            t1 = 2*M_PI*toneFrequency[0]/(sampleRate*channels);
-            t2 = 2*M_PI*toneFrequency[1]/(sampleRate*channels);
-            for (uint32_t i=0; i < sampleRate ; i++) {
-                buf[i] = generateSignal(t1,t2);
-            }
-            break;
-        default:
-            break;
-    }
-}
+/*
+ * Writes the tone to the given mixer input until the duration elapses or playback
+ * is stopped. Writing blocks while the input's queue is full, which paces the tone.
+ */
+telux::common::ErrorCode Alsa::generateTone(uint32_t mixerInputId, int channels,
+        uint32_t sampleRate, uint16_t gain, uint16_t duration,
+        std::vector<uint16_t> toneFrequency, std::atomic<bool> &running) {
 
-telux::common::ErrorCode Alsa::generateTone(StreamHandle streamHandle, uint32_t sampleRate,
-    uint16_t gain, uint16_t duration, std::vector<uint16_t> toneFrequency) {
-    int ret;
-    float buf[sampleRate];
-    int nbSamples = sampleRate * streamHandle.channels * (duration/1000);
-    int nbTimes = nbSamples / sampleRate;
-    int restFrames = nbSamples % sampleRate;
-
-    if (nbSamples >0) {
-        genTone(toneFrequency, streamHandle.channels, sampleRate, gain, buf);
-        if (nbTimes > 0) {
-            for (int i=0; i < nbTimes; i++) {
-                if(!runTone_){
-                    break;
-                }
-                ret = snd_pcm_writei(streamHandle.pcmHandle, buf, sampleRate);
-                if (ret == -EPIPE || ret == -ESTRPIPE) {
-                    LOG(ERROR, __FUNCTION__,"write error: ", snd_strerror(ret));
-                    snd_pcm_prepare(streamHandle.pcmHandle);
-                    return telux::common::ErrorCode::SYSTEM_ERR;
-                }
-            }
+    telux::common::ErrorCode ec;
+    uint32_t frames;
+    uint32_t periodFrames = MAX_BUFFER_SIZE / (channels * 2);
+    bool infinite = (duration == INFINITE_TONE_DURATION);
+    uint64_t remainingFrames = (static_cast<uint64_t>(sampleRate) * duration) / 1000;
+    std::vector<int16_t> buf(periodFrames * channels);
+    ToneGenerator generator(sampleRate, channels);
+
+    generator.configure(toneFrequency, gain);
+
+    while (running && (infinite || remainingFrames)) {
+        frames = infinite ? periodFrames :
+            static_cast<uint32_t>(std::min<uint64_t>(periodFrames, remainingFrames));
+
+        generator.generate(buf.data(), frames);
+        ec = mixer_->write(mixerInputId, reinterpret_cast<const uint8_t *>(buf.data()),
+            frames * channels * 2);
+        if (ec != telux::common::ErrorCode::SUCCESS) {
+            LOG(ERROR, __FUNCTION__, " can't write tone, input ", mixerInputId);
+            return ec;
         }
-        if (restFrames > 0 && runTone_) {
-            ret = snd_pcm_writei(streamHandle.pcmHandle, buf, restFrames);
-            if (ret == -EPIPE || ret == -ESTRPIPE) {
-                LOG(ERROR, __FUNCTION__,"write error: ", snd_strerror(ret));
-                snd_pcm_prepare(streamHandle.pcmHandle);
-                return telux::common::ErrorCode::SYSTEM_ERR;
-            }
+
+        if (!infinite) {
+            remainingFrames -= frames;
         }
     }
+
     return telux::common::ErrorCode::SUCCESS;
 }
 
@@ -982,10 +1175,14 @@ telux::common::ErrorCode Alsa::startTone(StreamHandle& streamHandle, uint32_t sa
         stopTone(streamHandle);
     }
 
+    if (streamHandle.mixerInputId < 0) {
+        return telux::common::ErrorCode::INVALID_STATE;
+    }
+
     runTone_ = true;
     streamHandle.streamStarted = true;
-    std::thread toneThread(&Alsa::generateTone, this, streamHandle, sampleRate, gain,
-        duration, toneFrequency);
+    std::thread toneThread(&Alsa::generateTone, this, streamHandle.mixerInputId,
+        streamHandle.channels, sampleRate, gain, duration, toneFrequency, std::ref(runTone_));
 
     toneThread_.emplace_back(std::move(toneThread));
 
@@ -1004,11 +1201,10 @@ telux::common::ErrorCode Alsa::stopTone(StreamHandle& streamHandle) {
         }
     }
 
-    RegFreq1_[0] = 1;
-    RegFreq1_[1] = 0;
-    RegFreq2_[0] = 1;
-    RegFreq2_[1] = 0;
-    snd_pcm_prepare(streamHandle.pcmHandle);
+    /* Drop the part of the tone still queued in the mixer */
+    if (streamHandle.mixerInputId >= 0) {
+        mixer_->flush(streamHandle.mixerInputId);
+    }
 
     return telux::common::ErrorCode::SUCCESS;
 }
@@ -1131,6 +1327,29 @@ int Alsa::loadUserDeviceMapping() {
 }
 
 
+uint32_t Alsa::loadMixerSampleRate() {
+
+    uint32_t sampleRate = DEFAULT_MIXER_SAMPLE_RATE;
+
+    if (config_) {
+        std::string value = config_->getValue("MIXER_SAMPLE_RATE");
+        if (!value.empty()) {
+            try {
+                sampleRate = std::stoul(value, nullptr, 10);
+            } catch (const std::exception& e) {
+                LOG(ERROR, __FUNCTION__, " can't interpret MIXER_SAMPLE_RATE");
+                sampleRate = DEFAULT_MIXER_SAMPLE_RATE;
+            }
+        }
+    }
+
+    if (!sampleRate) {
+        sampleRate = DEFAULT_MIXER_SAMPLE_RATE;
+    }
+
+    return sampleRate;
+}
+
 void Alsa::onEventUpdate(::eventService::UnsolicitedEvent event) {
     if (event.filter() == AUDIO_FILTER) {
         onEventUpdate(event.event());
@@ -1195,10 +1414,7 @@ void Alsa::handleDTMFDetectedEvent(std::string eventParams) {
             return;
     }
     LOG(DEBUG, __FUNCTION__,"Registered listener, sending notifcation ");
-    for(auto it = dtmfIndicationListenerMap_.begin(); it != dtmfIndicationListenerMap_.end(); it++)
-    {
-        it->second->onDTMFDetectedEvent(it->first, lowFreq, highFreq, StreamDirection::RX);
-    }
+    notifyDtmfDetected(lowFreq, highFreq);
 }
 
 
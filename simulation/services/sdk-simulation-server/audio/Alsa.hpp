@@ -6,6 +6,8 @@
 #ifndef ALSA_HPP
 #define ALSA_HPP
 
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <thread>
 extern "C" {
@@ -13,6 +15,10 @@ extern "C" {
 }
 
 #include "IAudioBackend.hpp"
+#include "AudioMixer.hpp"
+#include "ToneGenerator.hpp"
+#include "DtmfDetector.hpp"
+#include "Transcoder.hpp"
 #include "libs/common/Logger.hpp"
 #include "TransportDefines.hpp"
 #include "event/ServerEventManager.hpp"
@@ -20,8 +26,6 @@ extern "C" {
 #include "libs/common/event-manager/EventParserUtil.hpp"
 #include "libs/common/event-manager/EventManager.hpp"
 
-#define FILTER_ORDER 2
-
 namespace telux {
 namespace audio {
 
@@ -103,7 +107,7 @@ class Alsa : public IAudioBackend,
         int64_t &actualLengthWritten) override;
 
     telux::common::ErrorCode read(StreamHandle &streamHandle,
-        std::shared_ptr<std::vector<uint8_t>> data, uint32_t readLengthRequested,
+        uint8_t *data, uint32_t readLengthRequested,
         int64_t &actualReadLength) override;
 
     telux::common::ErrorCode drain(StreamHandle streamHandle) override;
@@ -148,37 +152,37 @@ private:
     DeviceMappingTable finalDevicesTable_{};
     std::vector<std::thread> runningThreads_;
     std::shared_ptr<SimulationConfigParser> config_;
+    std::mutex dtmfMutex_;
     std::unordered_map<uint32_t, std::shared_ptr<IStreamEventListener>> dtmfIndicationListenerMap_;
     std::vector<std::shared_ptr<ISSREventListener>> ssrListenerMap_;
     bool isBTScoEnabled_ = false;
     std::atomic<bool> runLoopback_;
     std::atomic<bool> runTone_;
+    std::atomic<bool> runDtmf_;
     std::vector<std::thread> toneThread_, loopThread_;
-    float RegFreq1_[FILTER_ORDER]={1,0};
-    float InFreq1_;
-    float RegFreq2_[FILTER_ORDER]={1,0};
-    float InFreq2_;
+    std::mutex dtmfPlayMutex_;
+    std::thread dtmfThread_;
+    int dtmfMixerInputId_ = -1;
     std::string pcmDevice_;
     std::string sndCardCtlDevice_;
-    uint32_t inTranscodeStreamId_ = INT_MAX;
-    uint32_t outTranscodeStreamId_ = INT_MAX;
-    int sendWriteReady;
-    int pipelineLen;
+    std::unique_ptr<AudioMixer> mixer_;
 
     int loadMappingArray(std::string key, MappedValueType mappedValueType,
         uint32_t numOfValues, DeviceMappingTable& deviceTbl);
     int loadUserDeviceMapping(void);
+    uint32_t loadMixerSampleRate(void);
     telux::common::ErrorCode mapStreamType(StreamType streamType, snd_pcm_stream_t& stream);
     telux::common::ErrorCode mapStreamChannelMask( uint32_t channelTypeMask, int& channels);
     telux::common::ErrorCode setBufferSize(StreamHandle streamHandle,
         size_t& inSize, size_t& outSize);
     telux::common::ErrorCode startLoopback(snd_pcm_t *captureHandle, snd_pcm_t *playHandle,
         int channels);
-    telux::common::ErrorCode generateTone(StreamHandle streamHandle, uint32_t sampleRate,
-    uint16_t gain, uint16_t duration, std::vector<uint16_t> toneFrequency);
-    void genTone(std::vector<uint16_t> toneFrequency, int channels, uint32_t sampleRate,
-        uint16_t gain, float buf[]);
-    float generateSignal(float t1, float t2);
+    telux::common::ErrorCode generateTone(uint32_t mixerInputId, int channels,
+        uint32_t sampleRate, uint16_t gain, uint16_t duration,
+        std::vector<uint16_t> toneFrequency, std::atomic<bool> &running);
+    void stopDtmfPlayback();
+    bool hasDtmfListeners();
+    void notifyDtmfDetected(uint32_t lowFreq, uint32_t highFreq);
     void onEventUpdate(std::string event);
     void handleDTMFDetectedEvent(std::string eventParams);
     void handleSSREvent(std::string eventParams);
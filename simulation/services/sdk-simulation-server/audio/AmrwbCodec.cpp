@@ -0,0 +1,103 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include <cstring>
+
+#ifdef AMRWB_CODEC_LIBS
+#include <opencore-amrwb/dec_if.h>
+#include <vo-amrwbenc/enc_if.h>
+#endif
+
+#include "libs/common/Logger.hpp"
+#include "AmrwbCodec.hpp"
+
+/* Frame type of a frame carrying no data */
+#define AMRWB_NO_DATA 15
+/* Highest speech mode */
+#define AMRWB_MAX_MODE 8
+
+namespace telux {
+namespace audio {
+
+/* Frame length including the header byte for every frame type, 0 for reserved types */
+static const uint8_t FRAME_LENGTHS[16] = {
+    18, 24, 33, 37, 41, 47, 51, 59, 61, 6, 0, 0, 0, 0, 1, 1
+};
+
+AmrwbCodec::AmrwbCodec(uint32_t mode)
+    : mode_((mode > AMRWB_MAX_MODE) ? AMRWB_MAX_MODE : mode) {
+
+#ifdef AMRWB_CODEC_LIBS
+    decoder_ = D_IF_init();
+    encoder_ = E_IF_init();
+    if (!decoder_ || !encoder_) {
+        LOG(ERROR, __FUNCTION__, " can't initialize AMR-WB codec");
+    }
+#else
+    LOG(INFO, __FUNCTION__, " built without AMR-WB codec, frames are parsed only, mode ",
+        mode_);
+#endif
+}
+
+AmrwbCodec::~AmrwbCodec() {
+
+#ifdef AMRWB_CODEC_LIBS
+    if (decoder_) {
+        D_IF_exit(decoder_);
+    }
+    if (encoder_) {
+        E_IF_exit(encoder_);
+    }
+#endif
+}
+
+uint32_t AmrwbCodec::getSampleRate() {
+    return SAMPLE_RATE;
+}
+
+uint32_t AmrwbCodec::getFrameSamples() {
+    return FRAME_SAMPLES;
+}
+
+uint32_t AmrwbCodec::getMaxFrameLength() {
+    return FRAME_LENGTHS[AMRWB_MAX_MODE];
+}
+
+uint32_t AmrwbCodec::getFrameLength(uint8_t header) {
+    return FRAME_LENGTHS[(header >> 3) & 0x0F];
+}
+
+void AmrwbCodec::decode(const uint8_t *frame, int16_t *pcm) {
+
+#ifdef AMRWB_CODEC_LIBS
+    if (decoder_) {
+        D_IF_decode(decoder_, frame, pcm, _good_frame);
+        return;
+    }
+#endif
+
+    std::memset(pcm, 0, FRAME_SAMPLES * sizeof(int16_t));
+}
+
+uint32_t AmrwbCodec::encode(const int16_t *pcm, uint8_t *frame) {
+
+#ifdef AMRWB_CODEC_LIBS
+    int length;
+
+    if (encoder_) {
+        length = E_IF_encode(encoder_, mode_, pcm, frame, 0);
+        if (length > 0) {
+            return length;
+        }
+    }
+#endif
+
+    /* Header with quality bit set */
+    frame[0] = (AMRWB_NO_DATA << 3) | 0x04;
+    return 1;
+}
+
+}  // end of namespace audio
+}  // end of namespace telux
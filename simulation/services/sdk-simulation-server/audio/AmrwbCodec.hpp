@@ -0,0 +1,75 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#ifndef AMRWBCODEC_HPP
+#define AMRWBCODEC_HPP
+
+#include <cstdint>
+
+namespace telux {
+namespace audio {
+
+/*
+ * Speech codec working on fixed size frames of mono 16-bit PCM. A compressed frame
+ * starts with a one byte header from which its total length can be found, as in the
+ * AMR file storage format.
+ */
+class ISpeechCodec {
+
+ public:
+    virtual uint32_t getSampleRate() = 0;
+
+    /* Number of PCM samples in one frame */
+    virtual uint32_t getFrameSamples() = 0;
+
+    /* Largest compressed frame, header included */
+    virtual uint32_t getMaxFrameLength() = 0;
+
+    /* Length of the compressed frame starting with the given header, 0 if invalid */
+    virtual uint32_t getFrameLength(uint8_t header) = 0;
+
+    /* Decodes one compressed frame into getFrameSamples() samples */
+    virtual void decode(const uint8_t *frame, int16_t *pcm) = 0;
+
+    /* Encodes getFrameSamples() samples, returns length of the compressed frame */
+    virtual uint32_t encode(const int16_t *pcm, uint8_t *frame) = 0;
+
+    virtual ~ISpeechCodec() {}
+};
+
+/*
+ * AMR-WB codec, 20 ms frames at 16 kHz.
+ *
+ * When the server is built with the opencore-amrwb decoder and the vo-amrwbenc
+ * encoder (AMRWB_CODEC_LIBS), frames are really decoded/encoded. Otherwise frames
+ * are only parsed; decoding gives silence and encoding gives NO_DATA frames.
+ */
+class AmrwbCodec : public ISpeechCodec {
+
+ public:
+    static const uint32_t SAMPLE_RATE = 16000;
+    static const uint32_t FRAME_SAMPLES = 320;
+
+    /* mode is the encoder's bitrate, 0 (6.60 kbps) to 8 (23.85 kbps) */
+    explicit AmrwbCodec(uint32_t mode);
+    ~AmrwbCodec();
+
+    uint32_t getSampleRate() override;
+    uint32_t getFrameSamples() override;
+    uint32_t getMaxFrameLength() override;
+    uint32_t getFrameLength(uint8_t header) override;
+    void decode(const uint8_t *frame, int16_t *pcm) override;
+    uint32_t encode(const int16_t *pcm, uint8_t *frame) override;
+
+ private:
+    uint32_t mode_;
+    void *decoder_ = nullptr;
+    void *encoder_ = nullptr;
+};
+
+}  // end of namespace audio
+}  // end of namespace telux
+
+#endif  // AMRWBCODEC_HPP
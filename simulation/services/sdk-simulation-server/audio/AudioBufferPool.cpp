@@ -0,0 +1,110 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include <new>
+
+#include "libs/common/Logger.hpp"
+#include "AudioBufferPool.hpp"
+
+namespace telux {
+namespace audio {
+
+AudioBufferPool::AudioBufferPool(uint32_t bufferSize, uint32_t capacity)
+    : bufferSize_(bufferSize),
+      capacity_(capacity) {
+
+    uint8_t *buffer;
+
+    freeBuffers_.reserve(capacity_);
+    for (uint32_t x = 0; x < capacity_; x++) {
+        buffer = allocateBuffer();
+        if (!buffer) {
+            LOG(ERROR, __FUNCTION__, " can't prime pool, buffers ", x);
+            break;
+        }
+        freeBuffers_.push_back(buffer);
+    }
+
+    stats_.bufferSize = bufferSize_;
+    stats_.capacity = capacity_;
+}
+
+AudioBufferPool::~AudioBufferPool() {
+
+    std::lock_guard<std::mutex> lock(poolMutex_);
+
+    if (stats_.inUse) {
+        LOG(ERROR, __FUNCTION__, " buffers not released ", stats_.inUse);
+    }
+
+    for (auto buffer : freeBuffers_) {
+        delete[] buffer;
+    }
+    freeBuffers_.clear();
+}
+
+uint8_t *AudioBufferPool::allocateBuffer() {
+    return new (std::nothrow) uint8_t[bufferSize_];
+}
+
+uint8_t *AudioBufferPool::acquire() {
+
+    uint8_t *buffer = nullptr;
+    std::lock_guard<std::mutex> lock(poolMutex_);
+
+    ++stats_.acquireCount;
+
+    if (!freeBuffers_.empty()) {
+        buffer = freeBuffers_.back();
+        freeBuffers_.pop_back();
+    } else {
+        /* Pool exhausted, don't stall the data path */
+        ++stats_.exhaustionCount;
+        buffer = allocateBuffer();
+        if (!buffer) {
+            LOG(ERROR, __FUNCTION__, " can't allocate buffer");
+            return nullptr;
+        }
+        ++stats_.allocationCount;
+    }
+
+    ++stats_.inUse;
+    if (stats_.inUse > stats_.peakInUse) {
+        stats_.peakInUse = stats_.inUse;
+    }
+
+    return buffer;
+}
+
+void AudioBufferPool::release(uint8_t *buffer) {
+
+    if (!buffer) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(poolMutex_);
+
+    --stats_.inUse;
+
+    if (freeBuffers_.size() < capacity_) {
+        freeBuffers_.push_back(buffer);
+        return;
+    }
+
+    /* Buffer allocated when the pool was exhausted and pool is full again */
+    delete[] buffer;
+}
+
+uint32_t AudioBufferPool::getBufferSize() {
+    return bufferSize_;
+}
+
+BufferPoolStats AudioBufferPool::getStats() {
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    return stats_;
+}
+
+}  // end of namespace audio
+}  // end of namespace telux
@@ -0,0 +1,77 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#ifndef AUDIOBUFFERPOOL_HPP
+#define AUDIOBUFFERPOOL_HPP
+
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+namespace telux {
+namespace audio {
+
+/*
+ * Snapshot of the counters maintained by an AudioBufferPool.
+ */
+struct BufferPoolStats {
+    /* Size of every buffer in the pool, in bytes */
+    uint32_t bufferSize = 0;
+    /* Number of buffers retained by the pool for recycling */
+    uint32_t capacity = 0;
+    /* Number of buffers currently handed out */
+    uint32_t inUse = 0;
+    /* Highest number of buffers handed out at the same time */
+    uint32_t peakInUse = 0;
+    /* Total number of acquire() calls */
+    uint64_t acquireCount = 0;
+    /* Number of acquire() calls that found no free buffer in the pool */
+    uint64_t exhaustionCount = 0;
+    /* Number of buffers allocated after the pool was primed */
+    uint64_t allocationCount = 0;
+};
+
+/*
+ * Fixed-size buffer pool used on the audio data path (write/read). All buffers
+ * are allocated once when the pool is created and are recycled between requests
+ * instead of being allocated and freed per request.
+ *
+ * If all buffers are in use, a new buffer is allocated so that the data path never
+ * stalls. Such a buffer is kept for recycling if the pool has room for it, otherwise
+ * it is freed when released. These events are reported through BufferPoolStats so
+ * that an undersized pool can be spotted.
+ */
+class AudioBufferPool {
+
+ public:
+    AudioBufferPool(uint32_t bufferSize, uint32_t capacity);
+    ~AudioBufferPool();
+
+    /*
+     * Returns a buffer of getBufferSize() bytes or nullptr if memory can't be
+     * allocated. The buffer must be given back with release().
+     */
+    uint8_t *acquire();
+
+    void release(uint8_t *buffer);
+
+    uint32_t getBufferSize();
+
+    BufferPoolStats getStats();
+
+ private:
+    std::mutex poolMutex_;
+    uint32_t bufferSize_;
+    uint32_t capacity_;
+    std::vector<uint8_t *> freeBuffers_;
+    BufferPoolStats stats_{};
+
+    uint8_t *allocateBuffer();
+};
+
+}  // end of namespace audio
+}  // end of namespace telux
+
+#endif  // AUDIOBUFFERPOOL_HPP
@@ -85,13 +85,14 @@ struct PrivateStreamData {
     std::weak_ptr<IStreamEventListener> streamEventListener;
 };
 
+class DtmfDetector;
+class Transcoder;
+
 /*
  * Data that needs to be passed back and forth between service and backend.
  */
 struct StreamHandle {
     StreamType type;
-    uint32_t inTranscodeStreamId;
-    uint32_t outTranscodeStreamId;
     snd_pcm_t *pcmHandle;
     snd_pcm_t *loopbackPlayHandle;
     snd_pcm_t *loopbackCaptureHandle;
@@ -101,6 +102,12 @@ struct StreamHandle {
     bool streamStarted = false;
     bool dtmfStarted = false;
     bool isAMR = false;
+    /* Input of the software mixer used by a PLAY/TONE_GENERATOR stream, -1 if not mixed */
+    int mixerInputId = -1;
+    /* DTMF detector running over the samples read from a CAPTURE stream */
+    std::shared_ptr<DtmfDetector> dtmfDetector;
+    /* Transcoder shared by the transcoder's input (PLAY) and output (CAPTURE) streams */
+    std::shared_ptr<Transcoder> transcoder;
 };
 
 /*
@@ -142,6 +149,8 @@ struct CreatedTranscoderInfo {
     uint32_t outStreamId;
     uint32_t readMinSize;
     uint32_t writeMinSize;
+    /* Created with the input stream and handed to the output stream */
+    std::shared_ptr<Transcoder> transcoder;
 };
 
 }  // end of namespace audio
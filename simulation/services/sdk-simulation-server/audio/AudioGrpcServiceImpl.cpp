@@ -24,6 +24,7 @@
  */
 
 #include "AudioGrpcServiceImpl.hpp"
+#include "common/RpcExecutor.hpp"
 
 namespace telux {
 namespace audio {
@@ -99,8 +100,8 @@ AudioGrpcServiceImpl::~AudioGrpcServiceImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status AudioGrpcServiceImpl::ClientConnected(::grpc::ServerContext* context, const
-    ::audioStub::AudioClientConnect* request, ::commonStub::GetServiceStatusReply* response) {
+grpc::Status AudioGrpcServiceImpl::ClientConnected(const ::audioStub::AudioClientConnect* request,
+    ::commonStub::GetServiceStatusReply* response) {
 
     std::shared_ptr<AudioClient> audioClient;
 
@@ -145,8 +146,8 @@ grpc::Status AudioGrpcServiceImpl::ClientConnected(::grpc::ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::GetStreamTypes(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::GetStreamTypes(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -182,8 +183,8 @@ grpc::Status AudioGrpcServiceImpl::GetStreamTypes(::grpc::ServerContext* context
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::GetCalibrationInitStatus(::grpc::ServerContext*
-    context, const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::GetCalibrationInitStatus(
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -215,8 +216,8 @@ grpc::Status AudioGrpcServiceImpl::GetCalibrationInitStatus(::grpc::ServerContex
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::GetDevices(::grpc::ServerContext*
-    context, const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response){
+grpc::Status AudioGrpcServiceImpl::GetDevices(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -247,8 +248,8 @@ grpc::Status AudioGrpcServiceImpl::GetDevices(::grpc::ServerContext*
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::CreateStream(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::CreateStream(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -279,8 +280,8 @@ grpc::Status AudioGrpcServiceImpl::CreateStream(::grpc::ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::StartAudio(::grpc::ServerContext* context, const
-    ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::StartAudio(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -311,8 +312,8 @@ grpc::Status AudioGrpcServiceImpl::StartAudio(::grpc::ServerContext* context, co
     return grpc::Status::OK;
 }
 
-grpc::Status  AudioGrpcServiceImpl::StopAudio(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::StopAudio(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -344,8 +345,8 @@ grpc::Status  AudioGrpcServiceImpl::StopAudio(::grpc::ServerContext* context,
 }
 
 
-grpc::Status AudioGrpcServiceImpl::PlayDtmfTone(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::PlayDtmfTone(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -376,8 +377,8 @@ grpc::Status AudioGrpcServiceImpl::PlayDtmfTone(::grpc::ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::StopDtmfTone(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::StopDtmfTone(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -408,8 +409,8 @@ grpc::Status AudioGrpcServiceImpl::StopDtmfTone(::grpc::ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::GetStreamDevices(grpc::ServerContext* context, const
-    ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::GetStreamDevices(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -440,8 +441,8 @@ grpc::Status AudioGrpcServiceImpl::GetStreamDevices(grpc::ServerContext* context
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::SetStreamDevices(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::SetStreamDevices(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -473,8 +474,8 @@ grpc::Status AudioGrpcServiceImpl::SetStreamDevices(::grpc::ServerContext* conte
 }
 
 
-grpc::Status AudioGrpcServiceImpl::GetStreamMuteStatus(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::GetStreamMuteStatus(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -505,8 +506,8 @@ grpc::Status AudioGrpcServiceImpl::GetStreamMuteStatus(::grpc::ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::SetStreamMute(::grpc::ServerContext* context, const
-    ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::SetStreamMute(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -537,8 +538,8 @@ grpc::Status AudioGrpcServiceImpl::SetStreamMute(::grpc::ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::GetStreamVolume(::grpc::ServerContext* context, const
-    ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::GetStreamVolume(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -569,8 +570,8 @@ grpc::Status AudioGrpcServiceImpl::GetStreamVolume(::grpc::ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::SetStreamVolume(::grpc::ServerContext* context, const
-    ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::SetStreamVolume(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -601,8 +602,8 @@ grpc::Status AudioGrpcServiceImpl::SetStreamVolume(::grpc::ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::DeleteStream(::grpc::ServerContext* context, const
-    ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::DeleteStream(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -633,8 +634,8 @@ grpc::Status AudioGrpcServiceImpl::DeleteStream(::grpc::ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::Write(::grpc::ServerContext* context, const
-    ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::Write(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -666,8 +667,8 @@ grpc::Status AudioGrpcServiceImpl::Write(::grpc::ServerContext* context, const
 }
 
 
-grpc::Status AudioGrpcServiceImpl::Read(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::Read(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -698,8 +699,8 @@ grpc::Status AudioGrpcServiceImpl::Read(::grpc::ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::PlayTone(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::PlayTone(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -730,8 +731,8 @@ grpc::Status AudioGrpcServiceImpl::PlayTone(::grpc::ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::StopTone(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::StopTone(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     ApiResponse apiResp{};
@@ -762,8 +763,8 @@ grpc::Status AudioGrpcServiceImpl::StopTone(::grpc::ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::CreateTranscoder(::grpc::ServerContext* context,
-        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::CreateTranscoder(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     status = jsonHelper_->loadJson();
@@ -787,8 +788,8 @@ grpc::Status AudioGrpcServiceImpl::CreateTranscoder(::grpc::ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::DeleteTranscoder(::grpc::ServerContext* context,
-        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::DeleteTranscoder(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     status = jsonHelper_->loadJson();
@@ -812,8 +813,8 @@ grpc::Status AudioGrpcServiceImpl::DeleteTranscoder(::grpc::ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::Flush(::grpc::ServerContext* context,
-    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+grpc::Status AudioGrpcServiceImpl::Flush(const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
     status = jsonHelper_->loadJson();
@@ -837,7 +838,7 @@ grpc::Status AudioGrpcServiceImpl::Flush(::grpc::ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::Drain(::grpc::ServerContext* context, const ::audioStub::AudioRequest* request,
+grpc::Status AudioGrpcServiceImpl::Drain(const ::audioStub::AudioRequest* request,
     ::commonStub::StatusMsg* response) {
 
     telux::common::Status status;
@@ -877,8 +878,8 @@ grpc::Status AudioGrpcServiceImpl::SetupAsyncResponseStream(::grpc::ServerContex
     return grpc::Status::OK;
 }
 
-grpc::Status AudioGrpcServiceImpl::ClientDisconnected(::grpc::ServerContext* context, const
-    ::audioStub::AudioClientDisconnect* request, ::google::protobuf::Empty* response) {
+grpc::Status AudioGrpcServiceImpl::ClientDisconnected(
+    const ::audioStub::AudioClientDisconnect* request, ::google::protobuf::Empty* response) {
 
     int clientId = request->clientid();
     LOG(ERROR, __FUNCTION__, " Disconnecting, server Side stream for client: ", clientId);
@@ -1684,7 +1685,7 @@ void AudioGrpcServiceImpl::read(
 
 void AudioGrpcServiceImpl::sendReadResponse(
         std::shared_ptr<AudioRequest> audioReq, telux::common::ErrorCode ec,
-        uint32_t streamId, std::shared_ptr<std::vector<uint8_t>> data,
+        uint32_t streamId, const uint8_t *data,
         uint32_t actualReadLength, uint32_t offset, int64_t timeStamp, bool isIncallStream,
         bool isHpcmStream) {
 
@@ -1709,9 +1710,9 @@ void AudioGrpcServiceImpl::sendReadResponse(
 
     response.set_streamid(streamId);
     response.set_datalength(actualReadLength);
-    //Get raw pointer to data buffer
-    uint8_t* bufferPtr = data->data();
-    response.set_buffer(bufferPtr, actualReadLength);
+    if (data) {
+        response.set_buffer(data, actualReadLength);
+    }
     resp.mutable_any()->PackFrom(response);
 
     if(isIncallStream || isHpcmStream) {
@@ -1736,17 +1737,16 @@ void AudioGrpcServiceImpl::write(
     audioStub::writeRequest request{};
     any.UnpackTo(&request);
 
-    uint8_t *data = new uint8_t[request.datalength()]{};
-
-    std::string buffer = request.buffer();
-    for (uint32_t i = 0; i < buffer.size(); i++) {
-        data[i] = buffer[i];
-    }
+    /* Stream copies the data into a pooled buffer, no need to allocate here. */
+    const std::string &buffer = request.buffer();
+    uint32_t dataLength = std::min(request.datalength(),
+        static_cast<uint32_t>(buffer.size()));
 
     isLastBuffer = static_cast<bool>(request.islastbuffer());
 
-    audioMsgListener->write(audioReq, request.streamid(), data,
-        request.datalength(), request.offset(), request.timestamp(), isLastBuffer);
+    audioMsgListener->write(audioReq, request.streamid(),
+        reinterpret_cast<const uint8_t *>(buffer.data()), dataLength,
+        request.offset(), request.timestamp(), isLastBuffer);
 }
 
 void AudioGrpcServiceImpl::sendWriteResponse(
@@ -2374,5 +2374,165 @@ void AudioGrpcServiceImpl::sendDTMFDetectedEvent(
 
 }
 
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::ClientConnected(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioClientConnect* request,
+    ::commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ClientConnected(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::GetStreamTypes(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetStreamTypes(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::ClientDisconnected(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioClientDisconnect* request,
+    ::google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ClientDisconnected(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::GetDevices(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetDevices(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::GetCalibrationInitStatus(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetCalibrationInitStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::CreateStream(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CreateStream(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::StartAudio(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StartAudio(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::StopAudio(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StopAudio(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::PlayDtmfTone(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return PlayDtmfTone(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::StopDtmfTone(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StopDtmfTone(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::GetStreamDevices(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetStreamDevices(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::SetStreamDevices(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetStreamDevices(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::GetStreamMuteStatus(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetStreamMuteStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::SetStreamMute(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetStreamMute(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::GetStreamVolume(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetStreamVolume(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::SetStreamVolume(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetStreamVolume(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::DeleteStream(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DeleteStream(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::Write(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Write(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::Read(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Read(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::PlayTone(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return PlayTone(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::StopTone(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StopTone(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::CreateTranscoder(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CreateTranscoder(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::DeleteTranscoder(
+    grpc::CallbackServerContext* context, const ::audioStub::AudioRequest* request,
+    ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DeleteTranscoder(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::Flush(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Flush(request, response); });
+}
+
+grpc::ServerUnaryReactor* AudioGrpcServiceImpl::Drain(grpc::CallbackServerContext* context,
+    const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Drain(request, response); });
+}
+
 } // end namespace audio
 } // end namespace telux
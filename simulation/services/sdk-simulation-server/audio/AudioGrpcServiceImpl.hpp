@@ -6,6 +6,7 @@
 #ifndef AUDIOGRPCSERVICETIMPL_HPP
 #define AUDIOGRPCSERVICETIMPL_HPP
 
+#include <algorithm>
 #include <cstdlib>
 #include <condition_variable>
 #include <mutex>
@@ -33,81 +34,111 @@
 namespace telux {
 namespace audio {
 
+/* The async response stream stays synchronous, the other RPCs run on the RPC executor */
+using AudioRpcService = ::audioStub::AudioService::WithCallbackMethod_ClientConnected<
+    ::audioStub::AudioService::WithCallbackMethod_ClientDisconnected<
+    ::audioStub::AudioService::WithCallbackMethod_CreateStream<
+    ::audioStub::AudioService::WithCallbackMethod_DeleteStream<
+    ::audioStub::AudioService::WithCallbackMethod_GetStreamDevices<
+    ::audioStub::AudioService::WithCallbackMethod_SetStreamDevices<
+    ::audioStub::AudioService::WithCallbackMethod_GetStreamMuteStatus<
+    ::audioStub::AudioService::WithCallbackMethod_SetStreamMute<
+    ::audioStub::AudioService::WithCallbackMethod_GetStreamVolume<
+    ::audioStub::AudioService::WithCallbackMethod_SetStreamVolume<
+    ::audioStub::AudioService::WithCallbackMethod_StartAudio<
+    ::audioStub::AudioService::WithCallbackMethod_StopAudio<
+    ::audioStub::AudioService::WithCallbackMethod_PlayDtmfTone<
+    ::audioStub::AudioService::WithCallbackMethod_StopDtmfTone<
+    ::audioStub::AudioService::WithCallbackMethod_GetDevices<
+    ::audioStub::AudioService::WithCallbackMethod_GetStreamTypes<
+    ::audioStub::AudioService::WithCallbackMethod_GetCalibrationInitStatus<
+    ::audioStub::AudioService::WithCallbackMethod_Write<
+    ::audioStub::AudioService::WithCallbackMethod_Read<
+    ::audioStub::AudioService::WithCallbackMethod_PlayTone<
+    ::audioStub::AudioService::WithCallbackMethod_StopTone<
+    ::audioStub::AudioService::WithCallbackMethod_CreateTranscoder<
+    ::audioStub::AudioService::WithCallbackMethod_DeleteTranscoder<
+    ::audioStub::AudioService::WithCallbackMethod_Flush<
+    ::audioStub::AudioService::WithCallbackMethod_Drain<
+    ::audioStub::AudioService::Service>>>>>>>>>>>>>>>>>>>>>>>>>;
+
 class AudioGrpcServiceImpl : public IAudioMsgDispatcher,
-                             public ::audioStub::AudioService::Service,
+                             public AudioRpcService,
                              public std::enable_shared_from_this<AudioGrpcServiceImpl> {
  public:
     AudioGrpcServiceImpl();
     ~AudioGrpcServiceImpl();
 
-    grpc::Status ClientConnected(::grpc::ServerContext* context, const
-    ::audioStub::AudioClientConnect* request, ::commonStub::GetServiceStatusReply* response);
+    grpc::ServerUnaryReactor* ClientConnected(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioClientConnect* request,
+        ::commonStub::GetServiceStatusReply* response) override;
 
     telux::common::ErrorCode onClientProcessReq(const ::audioStub::AudioRequest* request);
 
-    grpc::Status GetStreamTypes(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
+    grpc::ServerUnaryReactor* GetStreamTypes(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
     grpc::Status SetupAsyncResponseStream(::grpc::ServerContext* context,
         const ::audioStub::AudioClientConnect* request,
             ::grpc::ServerWriter< ::audioStub::AsyncResponseMessage>* writer);
-    grpc::Status ClientDisconnected(::grpc::ServerContext* context, const
-        ::audioStub::AudioClientDisconnect* request, ::google::protobuf::Empty* response);
-    grpc::Status GetDevices(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-    grpc::Status GetCalibrationInitStatus(::grpc::ServerContext* context, const
-        ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response);
-
-    grpc::Status CreateStream(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-    grpc::Status StartAudio(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-
-    grpc::Status StopAudio(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-
-    grpc::Status PlayDtmfTone(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-    grpc::Status StopDtmfTone(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-    grpc::Status GetStreamDevices(grpc::ServerContext* context, const
-        ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response);
-    grpc::Status SetStreamDevices(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-    grpc::Status GetStreamMuteStatus(::grpc::ServerContext* context, const
-        ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response);
-    grpc::Status SetStreamMute(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-    grpc::Status GetStreamVolume(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-    grpc::Status SetStreamVolume(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-        request, ::commonStub::StatusMsg* response);
-
-    grpc::Status DeleteStream(::grpc::ServerContext* context, const ::audioStub::AudioRequest*
-    request, ::commonStub::StatusMsg* response);
-
-    grpc::Status Write(::grpc::ServerContext* context, const ::audioStub::AudioRequest* request,
-        ::commonStub::StatusMsg* response);
-
-    grpc::Status Read(::grpc::ServerContext* context, const ::audioStub::AudioRequest* request,
-        ::commonStub::StatusMsg* response);
-
-    grpc::Status PlayTone(::grpc::ServerContext* context, const ::audioStub::AudioRequest* request,
-        ::commonStub::StatusMsg* response);
-
-    grpc::Status StopTone(::grpc::ServerContext* context, const ::audioStub::AudioRequest* request,
-        ::commonStub::StatusMsg* response);
-
-    grpc::Status CreateTranscoder(::grpc::ServerContext* context,
-        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response);
-
-    grpc::Status DeleteTranscoder(::grpc::ServerContext* context,
-        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response);
-
-    grpc::Status Flush(::grpc::ServerContext* context, const ::audioStub::AudioRequest* request,
-        ::commonStub::StatusMsg* response);
-
-    grpc::Status Drain(::grpc::ServerContext* context, const ::audioStub::AudioRequest* request,
-        ::commonStub::StatusMsg* response);
+    grpc::ServerUnaryReactor* ClientDisconnected(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioClientDisconnect* request,
+        ::google::protobuf::Empty* response) override;
+    grpc::ServerUnaryReactor* GetDevices(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+    grpc::ServerUnaryReactor* GetCalibrationInitStatus(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* CreateStream(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+    grpc::ServerUnaryReactor* StartAudio(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* StopAudio(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* PlayDtmfTone(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+    grpc::ServerUnaryReactor* StopDtmfTone(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+    grpc::ServerUnaryReactor* GetStreamDevices(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+    grpc::ServerUnaryReactor* SetStreamDevices(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+    grpc::ServerUnaryReactor* GetStreamMuteStatus(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+    grpc::ServerUnaryReactor* SetStreamMute(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+    grpc::ServerUnaryReactor* GetStreamVolume(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+    grpc::ServerUnaryReactor* SetStreamVolume(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* DeleteStream(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* Write(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* Read(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* PlayTone(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* StopTone(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* CreateTranscoder(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* DeleteTranscoder(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* Flush(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
+
+    grpc::ServerUnaryReactor* Drain(grpc::CallbackServerContext* context,
+        const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response) override;
 
     /*** Overrides - IAudioMsgDispatcher ***/
 
@@ -168,7 +199,7 @@ class AudioGrpcServiceImpl : public IAudioMsgDispatcher,
 
     void sendReadResponse(
             std::shared_ptr<AudioRequest> audioReq, telux::common::ErrorCode ec,
-            uint32_t streamId, std::shared_ptr<std::vector<uint8_t>> data,
+            uint32_t streamId, const uint8_t *data,
             uint32_t dataLength, uint32_t offset, int64_t timeStamp, bool isIncallStream,
             bool isHpcmStream) override;
 
@@ -225,6 +256,54 @@ class AudioGrpcServiceImpl : public IAudioMsgDispatcher,
         StreamDirection streamDirection) override;
 
  private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status ClientConnected(const ::audioStub::AudioClientConnect* request,
+        ::commonStub::GetServiceStatusReply* response);
+    grpc::Status GetStreamTypes(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status ClientDisconnected(const ::audioStub::AudioClientDisconnect* request,
+        ::google::protobuf::Empty* response);
+    grpc::Status GetDevices(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status GetCalibrationInitStatus(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status CreateStream(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status StartAudio(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status StopAudio(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status PlayDtmfTone(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status StopDtmfTone(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status GetStreamDevices(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status SetStreamDevices(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status GetStreamMuteStatus(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status SetStreamMute(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status GetStreamVolume(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status SetStreamVolume(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status DeleteStream(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status Write(const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response);
+    grpc::Status Read(const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response);
+    grpc::Status PlayTone(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status StopTone(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status CreateTranscoder(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status DeleteTranscoder(const ::audioStub::AudioRequest* request,
+        ::commonStub::StatusMsg* response);
+    grpc::Status Flush(const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response);
+    grpc::Status Drain(const ::audioStub::AudioRequest* request, ::commonStub::StatusMsg* response);
+
     std::shared_ptr<AudioServiceImpl> audioService_;
     telux::common::ServiceStatus serviceStatus_ = telux::common::ServiceStatus::SERVICE_UNAVAILABLE;
 
@@ -0,0 +1,570 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "libs/common/Logger.hpp"
+#include "AudioMixer.hpp"
+
+/* Latency requested from ALSA for the mixer's playback handle, in micro seconds */
+#define MIXER_DEVICE_LATENCY_US 100000
+
+namespace telux {
+namespace audio {
+
+AudioMixer::AudioMixer(std::string pcmDevice, uint32_t sampleRate)
+    : pcmDevice_(pcmDevice),
+      sampleRate_(sampleRate) {
+
+    mixBuffer_.resize(PERIOD_FRAMES * MIXER_CHANNELS);
+    inputBuffer_.resize(PERIOD_FRAMES * MIXER_CHANNELS);
+}
+
+AudioMixer::~AudioMixer() {
+
+    std::unique_lock<std::mutex> lock(mixerMutex_);
+
+    for (auto &input : inputs_) {
+        input.second->removed = true;
+    }
+    inputs_.clear();
+
+    lock.unlock();
+    std::lock_guard<std::mutex> deviceLock(deviceMutex_);
+    closeDevice();
+}
+
+telux::common::ErrorCode AudioMixer::openDevice() {
+
+    int ret;
+
+    ret = snd_pcm_open(&pcmHandle_, pcmDevice_.c_str(), SND_PCM_STREAM_PLAYBACK, 0);
+    if (ret < 0) {
+        LOG(ERROR, __FUNCTION__, " can't open PCM device: ", pcmDevice_.c_str());
+        pcmHandle_ = nullptr;
+        return telux::common::ErrorCode::SYSTEM_ERR;
+    }
+
+    ret = snd_pcm_set_params(pcmHandle_, SND_PCM_FORMAT_S16_LE, SND_PCM_ACCESS_RW_INTERLEAVED,
+        MIXER_CHANNELS, sampleRate_, 1, MIXER_DEVICE_LATENCY_US);
+    if (ret < 0) {
+        LOG(ERROR, __FUNCTION__, " can't set params, rate ", sampleRate_);
+        snd_pcm_close(pcmHandle_);
+        pcmHandle_ = nullptr;
+        return telux::common::ErrorCode::SYSTEM_ERR;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mixerMutex_);
+        runMixer_ = true;
+    }
+    mixThread_ = std::thread(&AudioMixer::mixLoop, this);
+
+    LOG(DEBUG, __FUNCTION__, " mixer started, rate ", sampleRate_);
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+/*
+ * Must be called with deviceMutex_ held and mixerMutex_ released, as the mixer
+ * thread is joined.
+ */
+void AudioMixer::closeDevice() {
+
+    {
+        std::lock_guard<std::mutex> lock(mixerMutex_);
+        runMixer_ = false;
+    }
+    inputCv_.notify_all();
+    spaceCv_.notify_all();
+
+    if (mixThread_.joinable()) {
+        mixThread_.join();
+    }
+
+    if (pcmHandle_) {
+        snd_pcm_drop(pcmHandle_);
+        snd_pcm_close(pcmHandle_);
+        pcmHandle_ = nullptr;
+        LOG(DEBUG, __FUNCTION__, " mixer stopped");
+    }
+}
+
+telux::common::ErrorCode AudioMixer::addInput(uint32_t inputId, uint32_t sampleRate,
+        int channels, uint32_t &periodFrames) {
+
+    telux::common::ErrorCode ec;
+    std::shared_ptr<MixerInput> input;
+
+    if ((channels != 1) && (channels != 2)) {
+        LOG(ERROR, __FUNCTION__, " invalid channels ", channels);
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+
+    if (!sampleRate) {
+        LOG(ERROR, __FUNCTION__, " invalid sample rate");
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+
+    input = std::make_shared<MixerInput>();
+    input->sampleRate = sampleRate;
+    input->channels = channels;
+    input->queue.resize(PERIOD_FRAMES * QUEUE_PERIODS * MIXER_CHANNELS);
+    input->resampler.step = static_cast<uint32_t>(
+        (static_cast<uint64_t>(sampleRate) << 16) / sampleRate_);
+
+    std::lock_guard<std::mutex> deviceLock(deviceMutex_);
+    std::unique_lock<std::mutex> lock(mixerMutex_);
+
+    if (inputs_.find(inputId) != inputs_.end()) {
+        LOG(ERROR, __FUNCTION__, " input exists ", inputId);
+        return telux::common::ErrorCode::INVALID_STATE;
+    }
+
+    if (!runMixer_) {
+        lock.unlock();
+        ec = openDevice();
+        if (ec != telux::common::ErrorCode::SUCCESS) {
+            return ec;
+        }
+        lock.lock();
+    }
+
+    inputs_[inputId] = input;
+    stats_.activeInputs = inputs_.size();
+
+    /* One mixer period expressed in input's frames */
+    periodFrames = static_cast<uint32_t>(
+        (static_cast<uint64_t>(PERIOD_FRAMES) * sampleRate) / sampleRate_);
+    if (!periodFrames) {
+        periodFrames = 1;
+    }
+
+    LOG(DEBUG, __FUNCTION__, " input ", inputId, " rate ", sampleRate, " channels ", channels);
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode AudioMixer::removeInput(uint32_t inputId) {
+
+    bool lastInput;
+    std::lock_guard<std::mutex> deviceLock(deviceMutex_);
+    std::unique_lock<std::mutex> lock(mixerMutex_);
+
+    auto itr = inputs_.find(inputId);
+    if (itr == inputs_.end()) {
+        LOG(ERROR, __FUNCTION__, " invalid input ", inputId);
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+
+    /* Unblock a writer waiting for space in this input's queue */
+    itr->second->removed = true;
+    inputs_.erase(itr);
+    stats_.activeInputs = inputs_.size();
+    lastInput = inputs_.empty();
+    lock.unlock();
+
+    spaceCv_.notify_all();
+
+    if (lastInput) {
+        closeDevice();
+    }
+
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+/*
+ * Converts given samples to stereo at mixer's sample rate, the result is kept in
+ * input.converted. Only the thread writing to this input accesses it.
+ */
+void AudioMixer::convert(MixerInput &input, const int16_t *samples, uint32_t frames) {
+
+    int16_t cur[MIXER_CHANNELS];
+    Resampler &rs = input.resampler;
+    std::vector<int16_t> &out = input.converted;
+
+    out.clear();
+
+    if (rs.step == (1u << 16)) {
+        out.resize(frames * MIXER_CHANNELS);
+        if (input.channels == MIXER_CHANNELS) {
+            std::memcpy(out.data(), samples, frames * MIXER_CHANNELS * sizeof(int16_t));
+            return;
+        }
+        for (uint32_t x = 0; x < frames; x++) {
+            out[x * MIXER_CHANNELS] = samples[x];
+            out[x * MIXER_CHANNELS + 1] = samples[x];
+        }
+        return;
+    }
+
+    /*
+     * Linear interpolation, for every output frame the phase advances by step. An input
+     * frame is consumed when the phase crosses 1.0 (0x10000).
+     */
+    out.reserve(((static_cast<uint64_t>(frames) << 16) / rs.step + 2) * MIXER_CHANNELS);
+    for (uint32_t x = 0; x < frames; x++) {
+        cur[0] = samples[x * input.channels];
+        cur[1] = (input.channels == MIXER_CHANNELS) ? samples[x * input.channels + 1] : cur[0];
+
+        while (rs.phase < (1u << 16)) {
+            for (uint32_t ch = 0; ch < MIXER_CHANNELS; ch++) {
+                out.push_back(static_cast<int16_t>(rs.prev[ch] +
+                    ((static_cast<int64_t>(cur[ch] - rs.prev[ch]) * rs.phase) >> 16)));
+            }
+            rs.phase += rs.step;
+        }
+        rs.phase -= (1u << 16);
+        rs.prev[0] = cur[0];
+        rs.prev[1] = cur[1];
+    }
+}
+
+telux::common::ErrorCode AudioMixer::write(uint32_t inputId, const uint8_t *data,
+        uint32_t length) {
+
+    uint32_t totalFrames, offset = 0, writePos, space, count, firstPart;
+    uint32_t queueFrames = PERIOD_FRAMES * QUEUE_PERIODS;
+    std::shared_ptr<MixerInput> input;
+
+    {
+        std::lock_guard<std::mutex> lock(mixerMutex_);
+        auto itr = inputs_.find(inputId);
+        if (itr == inputs_.end()) {
+            LOG(ERROR, __FUNCTION__, " invalid input ", inputId);
+            return telux::common::ErrorCode::INVALID_ARGUMENTS;
+        }
+        input = itr->second;
+    }
+
+    convert(*input, reinterpret_cast<const int16_t *>(data),
+        length / (input->channels * sizeof(int16_t)));
+    totalFrames = input->converted.size() / MIXER_CHANNELS;
+
+    std::unique_lock<std::mutex> lock(mixerMutex_);
+
+    while (offset < totalFrames) {
+        spaceCv_.wait(lock, [&] {
+            return (input->removed || !runMixer_ || (input->queuedFrames < queueFrames));
+        });
+
+        if (input->removed || !runMixer_) {
+            LOG(DEBUG, __FUNCTION__, " input removed ", inputId);
+            return telux::common::ErrorCode::INVALID_STATE;
+        }
+
+        space = queueFrames - input->queuedFrames;
+        count = std::min(space, totalFrames - offset);
+        writePos = (input->readPos + input->queuedFrames) % queueFrames;
+        firstPart = std::min(count, queueFrames - writePos);
+
+        std::memcpy(&input->queue[writePos * MIXER_CHANNELS],
+            &input->converted[offset * MIXER_CHANNELS],
+            firstPart * MIXER_CHANNELS * sizeof(int16_t));
+        if (count > firstPart) {
+            std::memcpy(&input->queue[0],
+                &input->converted[(offset + firstPart) * MIXER_CHANNELS],
+                (count - firstPart) * MIXER_CHANNELS * sizeof(int16_t));
+        }
+
+        input->queuedFrames += count;
+        offset += count;
+        inputCv_.notify_one();
+    }
+
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode AudioMixer::flush(uint32_t inputId) {
+
+    std::unique_lock<std::mutex> lock(mixerMutex_);
+
+    auto itr = inputs_.find(inputId);
+    if (itr == inputs_.end()) {
+        LOG(ERROR, __FUNCTION__, " invalid input ", inputId);
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+
+    itr->second->readPos = 0;
+    itr->second->queuedFrames = 0;
+    lock.unlock();
+
+    spaceCv_.notify_all();
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode AudioMixer::setGain(uint32_t inputId, float leftGain,
+        float rightGain) {
+
+    float gains[MIXER_CHANNELS] = {leftGain, rightGain};
+    std::lock_guard<std::mutex> lock(mixerMutex_);
+
+    auto itr = inputs_.find(inputId);
+    if (itr == inputs_.end()) {
+        LOG(ERROR, __FUNCTION__, " invalid input ", inputId);
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+
+    for (uint32_t ch = 0; ch < MIXER_CHANNELS; ch++) {
+        if ((gains[ch] < 0) || (gains[ch] > 1)) {
+            LOG(ERROR, __FUNCTION__, " invalid gain ", gains[ch]);
+            return telux::common::ErrorCode::INVALID_ARGUMENTS;
+        }
+        itr->second->gain[ch] = static_cast<int32_t>(std::lround(gains[ch] * UNITY_GAIN));
+    }
+
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode AudioMixer::getGain(uint32_t inputId, float &leftGain,
+        float &rightGain) {
+
+    std::lock_guard<std::mutex> lock(mixerMutex_);
+
+    auto itr = inputs_.find(inputId);
+    if (itr == inputs_.end()) {
+        LOG(ERROR, __FUNCTION__, " invalid input ", inputId);
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+
+    leftGain = static_cast<float>(itr->second->gain[0]) / UNITY_GAIN;
+    rightGain = static_cast<float>(itr->second->gain[1]) / UNITY_GAIN;
+
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode AudioMixer::drain(uint32_t inputId) {
+
+    std::shared_ptr<MixerInput> input;
+    std::unique_lock<std::mutex> lock(mixerMutex_);
+
+    auto itr = inputs_.find(inputId);
+    if (itr == inputs_.end()) {
+        LOG(ERROR, __FUNCTION__, " invalid input ", inputId);
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+    input = itr->second;
+
+    /* Don't make the mixer wait for more data on this input */
+    input->draining = true;
+    inputCv_.notify_one();
+
+    /* Woken up by the mixer thread after every period */
+    spaceCv_.wait(lock, [&] {
+        return (input->removed || !runMixer_ || !input->queuedFrames);
+    });
+    input->draining = false;
+
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+uint32_t AudioMixer::getSampleRate() {
+    return sampleRate_;
+}
+
+MixerStats AudioMixer::getStats() {
+
+    std::lock_guard<std::mutex> lock(mixerMutex_);
+    return stats_;
+}
+
+/*
+ * Copies given number of frames from the input's queue, pads with silence if
+ * the input doesn't have enough data queued.
+ */
+void AudioMixer::pull(MixerInput &input, int16_t *dest, uint32_t frames) {
+
+    uint32_t queueFrames = PERIOD_FRAMES * QUEUE_PERIODS;
+    uint32_t count = std::min(frames, input.queuedFrames);
+    uint32_t firstPart = std::min(count, queueFrames - input.readPos);
+
+    std::memcpy(dest, &input.queue[input.readPos * MIXER_CHANNELS],
+        firstPart * MIXER_CHANNELS * sizeof(int16_t));
+    if (count > firstPart) {
+        std::memcpy(dest + firstPart * MIXER_CHANNELS, &input.queue[0],
+            (count - firstPart) * MIXER_CHANNELS * sizeof(int16_t));
+    }
+
+    if (count < frames) {
+        std::memset(dest + count * MIXER_CHANNELS, 0,
+            (frames - count) * MIXER_CHANNELS * sizeof(int16_t));
+    }
+
+    input.readPos = (input.readPos + count) % queueFrames;
+    input.queuedFrames -= count;
+}
+
+/*
+ * Multiplies interleaved stereo samples with Q15 gain of the respective channel.
+ */
+void AudioMixer::applyGain(int16_t *samples, uint32_t frames, const int32_t gain[]) {
+
+    uint32_t x = 0;
+    uint32_t numSamples = frames * MIXER_CHANNELS;
+    /* Unity can't be represented in 16-bit Q15, closest value is used for vector path */
+    int16_t left = static_cast<int16_t>(std::min(gain[0], UNITY_GAIN - 1));
+    int16_t right = static_cast<int16_t>(std::min(gain[1], UNITY_GAIN - 1));
+
+    if ((gain[0] == UNITY_GAIN) && (gain[1] == UNITY_GAIN)) {
+        return;
+    }
+
+#if defined(__SSE2__)
+    const __m128i vgain = _mm_set_epi16(right, left, right, left, right, left, right, left);
+    for (; x + 8 <= numSamples; x += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(samples + x));
+        /* (v * gain) >> 16 doubled gives (v * gain) >> 15 */
+        v = _mm_mulhi_epi16(v, vgain);
+        v = _mm_adds_epi16(v, v);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(samples + x), v);
+    }
+#elif defined(__ARM_NEON)
+    const int16_t lanes[8] = {left, right, left, right, left, right, left, right};
+    const int16x8_t vgain = vld1q_s16(lanes);
+    for (; x + 8 <= numSamples; x += 8) {
+        vst1q_s16(samples + x, vqdmulhq_s16(vld1q_s16(samples + x), vgain));
+    }
+#endif
+
+    for (; x < numSamples; x++) {
+        samples[x] = static_cast<int16_t>((samples[x] * gain[x % MIXER_CHANNELS]) >> 15);
+    }
+}
+
+void AudioMixer::saturatingAdd(int16_t *dest, const int16_t *src, uint32_t samples) {
+
+    uint32_t x = 0;
+    int32_t sum;
+
+#if defined(__SSE2__)
+    for (; x + 8 <= samples; x += 8) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dest + x));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x), _mm_adds_epi16(a, b));
+    }
+#elif defined(__ARM_NEON)
+    for (; x + 8 <= samples; x += 8) {
+        vst1q_s16(dest + x, vqaddq_s16(vld1q_s16(dest + x), vld1q_s16(src + x)));
+    }
+#endif
+
+    for (; x < samples; x++) {
+        sum = static_cast<int32_t>(dest[x]) + src[x];
+        dest[x] = static_cast<int16_t>(std::max(-32768, std::min(32767, sum)));
+    }
+}
+
+/*
+ * Returns false if an input has some data queued but less than a period, and isn't
+ * being drained. Must be called with mixerMutex_ held.
+ */
+bool AudioMixer::areInputsReady() {
+
+    for (auto &entry : inputs_) {
+        MixerInput &input = *entry.second;
+        if (input.queuedFrames && (input.queuedFrames < PERIOD_FRAMES) && !input.draining) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Mixer thread, mixes one period from every input while any input has data queued
+ * and writes it to the device. Device is written without holding mixerMutex_ so that
+ * writers can queue the next period meanwhile.
+ */
+void AudioMixer::mixLoop() {
+
+    snd_pcm_sframes_t ret;
+    uint32_t deepest;
+    uint64_t elapsedNs;
+    std::chrono::steady_clock::time_point start;
+    std::unique_lock<std::mutex> lock(mixerMutex_);
+
+    while (runMixer_) {
+        inputCv_.wait(lock, [&] {
+            if (!runMixer_) {
+                return true;
+            }
+            for (auto &input : inputs_) {
+                if (input.second->queuedFrames) {
+                    return true;
+                }
+            }
+            return false;
+        });
+
+        /*
+         * An input short of a period is usually a writer scheduled a little late, give it
+         * the jitter allowance before padding it with silence. The device has
+         * MIXER_DEVICE_LATENCY_US of audio buffered, so this doesn't underrun it.
+         */
+        inputCv_.wait_for(lock, std::chrono::microseconds(JITTER_ALLOWANCE_US), [&] {
+            return (!runMixer_ || areInputsReady());
+        });
+
+        if (!runMixer_) {
+            break;
+        }
+
+        start = std::chrono::steady_clock::now();
+        std::memset(mixBuffer_.data(), 0, mixBuffer_.size() * sizeof(int16_t));
+        deepest = 0;
+
+        for (auto &entry : inputs_) {
+            MixerInput &input = *entry.second;
+
+            if (!input.queuedFrames) {
+                /* Idle input, nothing to mix */
+                continue;
+            }
+
+            deepest = std::max(deepest, input.queuedFrames);
+            if (input.queuedFrames < PERIOD_FRAMES) {
+                ++stats_.inputUnderruns;
+            }
+
+            pull(input, inputBuffer_.data(), PERIOD_FRAMES);
+            if (!input.gain[0] && !input.gain[1]) {
+                continue;
+            }
+            applyGain(inputBuffer_.data(), PERIOD_FRAMES, input.gain);
+            saturatingAdd(mixBuffer_.data(), inputBuffer_.data(),
+                PERIOD_FRAMES * MIXER_CHANNELS);
+        }
+
+        elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        ++stats_.periodsMixed;
+        totalMixLatencyNs_ += elapsedNs;
+        stats_.avgMixLatencyNs = totalMixLatencyNs_ / stats_.periodsMixed;
+        stats_.maxMixLatencyNs = std::max(stats_.maxMixLatencyNs, elapsedNs);
+        stats_.queuedLatencyUs = (static_cast<uint64_t>(deepest) * 1000000) / sampleRate_;
+
+        lock.unlock();
+        spaceCv_.notify_all();
+
+        ret = snd_pcm_writei(pcmHandle_, mixBuffer_.data(), PERIOD_FRAMES);
+
+        lock.lock();
+        if (ret == -EPIPE) {
+            ++stats_.deviceUnderruns;
+            snd_pcm_prepare(pcmHandle_);
+        } else if (ret < 0) {
+            LOG(ERROR, __FUNCTION__, " write error: ", snd_strerror(ret));
+        }
+    }
+}
+
+}  // end of namespace audio
+}  // end of namespace telux
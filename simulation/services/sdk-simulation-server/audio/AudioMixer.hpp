@@ -0,0 +1,156 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#ifndef AUDIOMIXER_HPP
+#define AUDIOMIXER_HPP
+
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+extern "C" {
+    #include <alsa/asoundlib.h>
+}
+
+#include <telux/common/CommonDefines.hpp>
+
+namespace telux {
+namespace audio {
+
+/*
+ * Statistics maintained by the mixer.
+ */
+struct MixerStats {
+    /* Number of playback streams currently mixed */
+    uint32_t activeInputs = 0;
+    /* Number of periods mixed and written to the device */
+    uint64_t periodsMixed = 0;
+    /* Number of times an active input had less than a period of data queued */
+    uint64_t inputUnderruns = 0;
+    /* Number of times the device ran out of data (EPIPE) */
+    uint64_t deviceUnderruns = 0;
+    /* Average and maximum time spent mixing one period, in nano seconds */
+    uint64_t avgMixLatencyNs = 0;
+    uint64_t maxMixLatencyNs = 0;
+    /* Audio queued in the deepest input when the last period was mixed, in micro seconds */
+    uint64_t queuedLatencyUs = 0;
+};
+
+/*
+ * Software mixer for the playback streams.
+ *
+ * Every playback stream is an input of the mixer. Samples written to an input are
+ * converted to the mixer's format (16-bit stereo at mixer's sample rate) and queued.
+ * A mixer thread takes one period from each input, applies the stream's gain, sums
+ * all inputs with saturating adds and writes the result to the only ALSA handle
+ * opened for playback. The device is opened when the first input is added and
+ * closed when the last input is removed.
+ *
+ * An input with less than a period queued is given a short jitter allowance to
+ * catch up before it is padded with silence, unless it is being drained.
+ *
+ * Writing to an input blocks while its queue is full, therefore the mixer thread
+ * paces all playback streams in real time similar to snd_pcm_writei().
+ */
+class AudioMixer {
+
+ public:
+    AudioMixer(std::string pcmDevice, uint32_t sampleRate);
+    ~AudioMixer();
+
+    telux::common::ErrorCode addInput(uint32_t inputId, uint32_t sampleRate, int channels,
+        uint32_t &periodFrames);
+
+    /* Drops the data still queued in the input, drain() it first to play it out */
+    telux::common::ErrorCode removeInput(uint32_t inputId);
+
+    telux::common::ErrorCode write(uint32_t inputId, const uint8_t *data, uint32_t length);
+
+    telux::common::ErrorCode flush(uint32_t inputId);
+
+    /* Blocks until the data queued in the input has been mixed and written to the device */
+    telux::common::ErrorCode drain(uint32_t inputId);
+
+    telux::common::ErrorCode setGain(uint32_t inputId, float leftGain, float rightGain);
+
+    telux::common::ErrorCode getGain(uint32_t inputId, float &leftGain, float &rightGain);
+
+    uint32_t getSampleRate();
+
+    MixerStats getStats();
+
+ private:
+    /* Number of frames mixed in one go */
+    static const uint32_t PERIOD_FRAMES = 1024;
+    /* Queue size of an input, in periods */
+    static const uint32_t QUEUE_PERIODS = 4;
+    /* Mixer output is always stereo */
+    static const uint32_t MIXER_CHANNELS = 2;
+    /* Q15 representation of unity gain, mixing is skipped for such input */
+    static const int32_t UNITY_GAIN = 32768;
+    /* Time an input short of a period is waited for before it is padded with silence */
+    static const uint32_t JITTER_ALLOWANCE_US = 10000;
+
+    /*
+     * Linear interpolation based sample rate converter. Phase is a Q16 fixed point
+     * position between the previous and the current input frame.
+     */
+    struct Resampler {
+        uint32_t step = 0;
+        uint32_t phase = 0;
+        int16_t prev[MIXER_CHANNELS] = {0, 0};
+    };
+
+    struct MixerInput {
+        uint32_t sampleRate = 0;
+        int channels = 0;
+        /* Q15 gain per channel */
+        int32_t gain[MIXER_CHANNELS] = {UNITY_GAIN, UNITY_GAIN};
+        /* Ring of interleaved stereo frames at mixer's sample rate */
+        std::vector<int16_t> queue;
+        uint32_t readPos = 0;
+        uint32_t queuedFrames = 0;
+        bool removed = false;
+        /* Set while drain() waits, the last partial period is mixed without waiting */
+        bool draining = false;
+        Resampler resampler;
+        /* Converted samples, reused between writes */
+        std::vector<int16_t> converted;
+    };
+
+    std::string pcmDevice_;
+    uint32_t sampleRate_;
+    snd_pcm_t *pcmHandle_ = nullptr;
+    /* Serializes opening and closing of the device */
+    std::mutex deviceMutex_;
+    std::mutex mixerMutex_;
+    std::condition_variable inputCv_;
+    std::condition_variable spaceCv_;
+    std::map<uint32_t, std::shared_ptr<MixerInput>> inputs_;
+    std::thread mixThread_;
+    bool runMixer_ = false;
+    MixerStats stats_{};
+    uint64_t totalMixLatencyNs_ = 0;
+    std::vector<int16_t> mixBuffer_;
+    std::vector<int16_t> inputBuffer_;
+
+    telux::common::ErrorCode openDevice();
+    void closeDevice();
+    void mixLoop();
+    bool areInputsReady();
+    void convert(MixerInput &input, const int16_t *samples, uint32_t frames);
+    void pull(MixerInput &input, int16_t *dest, uint32_t frames);
+    static void applyGain(int16_t *samples, uint32_t frames, const int32_t gain[]);
+    static void saturatingAdd(int16_t *dest, const int16_t *src, uint32_t samples);
+};
+
+}  // end of namespace audio
+}  // end of namespace telux
+
+#endif  // AUDIOMIXER_HPP
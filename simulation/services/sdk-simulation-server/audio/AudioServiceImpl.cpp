@@ -587,7 +587,7 @@ void AudioServiceImpl::getMuteState(std::shared_ptr<AudioRequest> audioReq,
 }
 
 void AudioServiceImpl::write(std::shared_ptr<AudioRequest> audioReq,
-        uint32_t streamId, uint8_t *data, uint32_t writeLengthRequested,
+        uint32_t streamId, const uint8_t *data, uint32_t writeLengthRequested,
         uint32_t offset, int64_t timeStamp, bool isLastBuffer) {
     std::shared_ptr<Stream> stream = streamCache_->retrieveStream(streamId);
     if (stream) {
@@ -74,7 +74,7 @@ class AudioServiceImpl : public IAudioMsgListener,
             StreamDirection direction) override;
 
     void write(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
-            uint8_t *data, uint32_t writeLengthRequested, uint32_t offset,
+            const uint8_t *data, uint32_t writeLengthRequested, uint32_t offset,
             int64_t timeStamp, bool isLastBuffer) override;
 
     void read(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
@@ -0,0 +1,220 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "DtmfDetector.hpp"
+
+/* Block length in micro seconds, 205 samples at 8 kHz as commonly used for DTMF */
+#define BLOCK_LENGTH_US 25625
+/* Minimum mean square level of a block (normalized samples), about -40 dBFS */
+#define MIN_BLOCK_LEVEL 1.0e-4f
+/* Part of the block energy that the two tones must carry */
+#define MIN_TONE_RATIO 0.6f
+/* Maximum allowed twist (power ratio) between the high and the low tone, 8 dB */
+#define MAX_TWIST 6.3f
+/* Other frequencies of a group must be at least 6 dB below the strongest one */
+#define MAX_GROUP_RATIO 0.25f
+
+namespace telux {
+namespace audio {
+
+const uint32_t DtmfDetector::LOW_FREQS[4] = {697, 770, 852, 941};
+const uint32_t DtmfDetector::HIGH_FREQS[4] = {1209, 1336, 1477, 1633};
+
+DtmfDetector::DtmfDetector(uint32_t sampleRate, DigitListener listener)
+    : listener_(listener) {
+
+    blockSize_ = std::max(static_cast<uint32_t>(
+        (static_cast<uint64_t>(sampleRate) * BLOCK_LENGTH_US) / 1000000), 1u);
+    scratch_.resize(blockSize_);
+
+    /* Coefficients are computed once, the filters only multiply and add */
+    for (uint32_t x = 0; x < NUM_FREQS; x++) {
+        uint32_t freq = (x < 4) ? LOW_FREQS[x] : HIGH_FREQS[x - 4];
+        coeff_[x] = static_cast<float>(2.0 * std::cos(2.0 * M_PI * freq / sampleRate));
+    }
+
+    reset();
+}
+
+void DtmfDetector::reset() {
+
+    std::fill(s1_, s1_ + NUM_FREQS, 0.0f);
+    std::fill(s2_, s2_ + NUM_FREQS, 0.0f);
+    energy_ = 0;
+    blockPos_ = 0;
+    lastDigit_ = -1;
+    reportedDigit_ = -1;
+}
+
+/*
+ * Runs all 8 Goertzel filters over the given samples,
+ * s0 = x + coeff * s1 - s2, s2 = s1, s1 = s0.
+ */
+void DtmfDetector::filter(const float *samples, uint32_t count) {
+
+#if defined(__SSE__)
+    __m128 c0 = _mm_load_ps(coeff_), c1 = _mm_load_ps(coeff_ + 4);
+    __m128 a1 = _mm_load_ps(s1_), b1 = _mm_load_ps(s1_ + 4);
+    __m128 a2 = _mm_load_ps(s2_), b2 = _mm_load_ps(s2_ + 4);
+    __m128 x, a0, b0;
+
+    for (uint32_t n = 0; n < count; n++) {
+        x = _mm_set1_ps(samples[n]);
+        a0 = _mm_sub_ps(_mm_add_ps(x, _mm_mul_ps(c0, a1)), a2);
+        b0 = _mm_sub_ps(_mm_add_ps(x, _mm_mul_ps(c1, b1)), b2);
+        a2 = a1;
+        b2 = b1;
+        a1 = a0;
+        b1 = b0;
+    }
+
+    _mm_store_ps(s1_, a1);
+    _mm_store_ps(s1_ + 4, b1);
+    _mm_store_ps(s2_, a2);
+    _mm_store_ps(s2_ + 4, b2);
+#elif defined(__ARM_NEON)
+    float32x4_t c0 = vld1q_f32(coeff_), c1 = vld1q_f32(coeff_ + 4);
+    float32x4_t a1 = vld1q_f32(s1_), b1 = vld1q_f32(s1_ + 4);
+    float32x4_t a2 = vld1q_f32(s2_), b2 = vld1q_f32(s2_ + 4);
+    float32x4_t x, a0, b0;
+
+    for (uint32_t n = 0; n < count; n++) {
+        x = vdupq_n_f32(samples[n]);
+        a0 = vsubq_f32(vmlaq_f32(x, c0, a1), a2);
+        b0 = vsubq_f32(vmlaq_f32(x, c1, b1), b2);
+        a2 = a1;
+        b2 = b1;
+        a1 = a0;
+        b1 = b0;
+    }
+
+    vst1q_f32(s1_, a1);
+    vst1q_f32(s1_ + 4, b1);
+    vst1q_f32(s2_, a2);
+    vst1q_f32(s2_ + 4, b2);
+#else
+    float s0;
+
+    for (uint32_t n = 0; n < count; n++) {
+        for (uint32_t k = 0; k < NUM_FREQS; k++) {
+            s0 = samples[n] + coeff_[k] * s1_[k] - s2_[k];
+            s2_[k] = s1_[k];
+            s1_[k] = s0;
+        }
+    }
+#endif
+
+    for (uint32_t n = 0; n < count; n++) {
+        energy_ += samples[n] * samples[n];
+    }
+}
+
+/*
+ * Returns the digit (low index * 4 + high index) found in the block just
+ * completed, -1 if there is none.
+ */
+int DtmfDetector::evaluateBlock() {
+
+    float power[NUM_FREQS];
+    uint32_t low = 0, high = 4;
+
+    for (uint32_t k = 0; k < NUM_FREQS; k++) {
+        power[k] = s1_[k] * s1_[k] + s2_[k] * s2_[k] - coeff_[k] * s1_[k] * s2_[k];
+    }
+
+    for (uint32_t k = 1; k < 4; k++) {
+        if (power[k] > power[low]) {
+            low = k;
+        }
+        if (power[k + 4] > power[high]) {
+            high = k + 4;
+        }
+    }
+
+    if (energy_ < MIN_BLOCK_LEVEL * blockSize_) {
+        return -1;
+    }
+
+    /* For a pure tone, Goertzel power is blockSize/2 times the tone's energy */
+    if ((power[low] + power[high]) < MIN_TONE_RATIO * energy_ * blockSize_ / 2) {
+        return -1;
+    }
+
+    if ((power[high] > power[low] * MAX_TWIST) || (power[low] > power[high] * MAX_TWIST)) {
+        return -1;
+    }
+
+    for (uint32_t k = 0; k < 4; k++) {
+        if ((k != low) && (power[k] > power[low] * MAX_GROUP_RATIO)) {
+            return -1;
+        }
+        if ((k + 4 != high) && (power[k + 4] > power[high] * MAX_GROUP_RATIO)) {
+            return -1;
+        }
+    }
+
+    return static_cast<int>(low * 4 + (high - 4));
+}
+
+void DtmfDetector::process(const int16_t *samples, uint32_t frames, int channels) {
+
+    uint32_t count, frame = 0;
+    int32_t sum;
+    int digit;
+
+    if (channels <= 0) {
+        return;
+    }
+
+    while (frame < frames) {
+        count = std::min(frames - frame, blockSize_ - blockPos_);
+
+        for (uint32_t n = 0; n < count; n++) {
+            sum = 0;
+            for (int ch = 0; ch < channels; ch++) {
+                sum += samples[(frame + n) * channels + ch];
+            }
+            scratch_[n] = static_cast<float>(sum) / (32768.0f * channels);
+        }
+
+        filter(scratch_.data(), count);
+        frame += count;
+        blockPos_ += count;
+
+        if (blockPos_ < blockSize_) {
+            break;
+        }
+
+        digit = evaluateBlock();
+
+        /* Report a digit once it is stable for two blocks */
+        if ((digit >= 0) && (digit == lastDigit_) && (digit != reportedDigit_)) {
+            reportedDigit_ = digit;
+            if (listener_) {
+                listener_(LOW_FREQS[digit / 4], HIGH_FREQS[digit % 4]);
+            }
+        } else if (digit < 0) {
+            reportedDigit_ = -1;
+        }
+        lastDigit_ = digit;
+
+        std::fill(s1_, s1_ + NUM_FREQS, 0.0f);
+        std::fill(s2_, s2_ + NUM_FREQS, 0.0f);
+        energy_ = 0;
+        blockPos_ = 0;
+    }
+}
+
+}  // end of namespace audio
+}  // end of namespace telux
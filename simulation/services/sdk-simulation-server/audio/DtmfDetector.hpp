@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#ifndef DTMFDETECTOR_HPP
+#define DTMFDETECTOR_HPP
+
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+namespace telux {
+namespace audio {
+
+/*
+ * Detects DTMF digits in 16-bit PCM samples.
+ *
+ * A bank of 8 Goertzel filters (4 low and 4 high DTMF frequencies) runs over blocks
+ * of about 25 ms. All filters are updated together for every sample using SSE/NEON
+ * when available. At the end of a block, the strongest low and high frequencies form
+ * a digit if they carry most of the block's energy, their relative level (twist) is
+ * acceptable and the other frequencies of their group are clearly weaker. A digit is
+ * reported once, when it is seen in two consecutive blocks.
+ *
+ * One detector must be used per stream as it keeps filter state across calls.
+ */
+class DtmfDetector {
+
+ public:
+    using DigitListener = std::function<void(uint32_t lowFreq, uint32_t highFreq)>;
+
+    DtmfDetector(uint32_t sampleRate, DigitListener listener);
+
+    /*
+     * Processes interleaved samples, channels are averaged. Invokes the listener
+     * for every new digit found.
+     */
+    void process(const int16_t *samples, uint32_t frames, int channels);
+
+    void reset();
+
+ private:
+    static const uint32_t NUM_FREQS = 8;
+    static const uint32_t LOW_FREQS[4];
+    static const uint32_t HIGH_FREQS[4];
+
+    uint32_t blockSize_;
+    uint32_t blockPos_ = 0;
+    DigitListener listener_;
+    /* Goertzel state, low group in [0..3] and high group in [4..7] */
+    alignas(16) float coeff_[NUM_FREQS];
+    alignas(16) float s1_[NUM_FREQS];
+    alignas(16) float s2_[NUM_FREQS];
+    float energy_ = 0;
+    /* Samples of the current block converted to float */
+    std::vector<float> scratch_;
+    /* Digit found in the last block and the digit last reported, -1 for none */
+    int lastDigit_ = -1;
+    int reportedDigit_ = -1;
+
+    void filter(const float *samples, uint32_t count);
+    int evaluateBlock();
+};
+
+}  // end of namespace audio
+}  // end of namespace telux
+
+#endif  // DTMFDETECTOR_HPP
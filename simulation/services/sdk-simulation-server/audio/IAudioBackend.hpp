@@ -69,7 +69,7 @@ class IAudioBackend {
         int64_t &actualLengthWritten) = 0;
 
     virtual telux::common::ErrorCode read(StreamHandle &streamHandle,
-        std::shared_ptr<std::vector<uint8_t>> data, uint32_t readLengthRequested,
+        uint8_t *data, uint32_t readLengthRequested,
         int64_t &actualReadLength) = 0;
 
     virtual telux::common::ErrorCode drain(StreamHandle streamHandle) = 0;
@@ -64,7 +64,7 @@ public:
         uint32_t streamId, StreamDirection direction) = 0;
 
     virtual void write(std::shared_ptr<AudioRequest> audioRequest,
-        uint32_t streamId, uint8_t *data, uint32_t dataLength,
+        uint32_t streamId, const uint8_t *data, uint32_t dataLength,
         uint32_t offset, int64_t timeStamp, bool isLastBuffer) = 0;
 
     virtual void read(std::shared_ptr<AudioRequest> audioRequest,
@@ -98,14 +98,12 @@ telux::common::ErrorCode Stream::setupStream(StreamConfiguration config,
             }
         case StreamType::CAPTURE:
             /*
-             * Pre-allocate memory used for read to minimize memory allocation
-             * during capture operations.
+             * Pre-allocate memory used for write/read to avoid memory allocation
+             * during playback and capture operations.
              */
-            try {
-                buffer_ = std::make_shared<std::vector<uint8_t>>(MAX_BUFFER_SIZE);
-            } catch (const std::exception& e) {
-                LOG(ERROR, __FUNCTION__, " can't allocate memory for stream");
-                return telux::common::ErrorCode::NO_MEMORY;
+            ec = createBufferPools();
+            if (ec != telux::common::ErrorCode::SUCCESS) {
+                return ec;
             }
             chlVol.channelType = ChannelType::LEFT;
             chlVol.vol = 1.0f;
@@ -143,7 +141,8 @@ telux::common::ErrorCode Stream::setupStream(StreamConfiguration config,
     if(!isIncallStream && !isBtStream && !isHpcmStream) {
         ec = audioBackend_->createStream(streamHandle_, streamParams_, readMinSize, writeMinSize);
         if (ec != telux::common::ErrorCode::SUCCESS) {
-            buffer_ = nullptr;
+            writePool_ = nullptr;
+            readPool_ = nullptr;
         }
     }
 
@@ -166,11 +165,9 @@ telux::common::ErrorCode Stream::setupInTranscodeStream(TranscodingFormatInfo in
 
     streamHandle_.type = StreamType::PLAY;
 
-    try {
-        buffer_ = std::make_shared<std::vector<uint8_t>>(MAX_BUFFER_SIZE);
-    } catch (const std::exception& e) {
-        LOG(ERROR, __FUNCTION__, " can't allocate memory for stream");
-        return telux::common::ErrorCode::NO_MEMORY;
+    ec = createBufferPools();
+    if (ec != telux::common::ErrorCode::SUCCESS) {
+        return ec;
     }
 
     ec = audioBackend_->setupInTranscodeStream(streamHandle_,
@@ -178,9 +175,13 @@ telux::common::ErrorCode Stream::setupInTranscodeStream(TranscodingFormatInfo in
             shared_from_this(), createdTranscoderInfo->writeMinSize);
 
     if (ec != telux::common::ErrorCode::SUCCESS) {
-        buffer_ = nullptr;
+        writePool_ = nullptr;
+        readPool_ = nullptr;
+        return ec;
     }
 
+    createdTranscoderInfo->transcoder = streamHandle_.transcoder;
+
     return ec;
 }
 
@@ -190,28 +191,77 @@ telux::common::ErrorCode Stream::setupOutTranscodeStream(TranscodingFormatInfo o
     telux::common::ErrorCode ec;
 
     streamHandle_.type = StreamType::CAPTURE;
+    /* Output stream of the transcoder the input stream was set up with */
+    streamHandle_.transcoder = createdTranscoderInfo->transcoder;
 
-    try {
-        buffer_ = std::make_shared<std::vector<uint8_t>>(MAX_BUFFER_SIZE);
-    } catch (const std::exception& e) {
-        LOG(ERROR, __FUNCTION__, " can't allocate memory for stream");
-        return telux::common::ErrorCode::NO_MEMORY;
+    ec = createBufferPools();
+    if (ec != telux::common::ErrorCode::SUCCESS) {
+        return ec;
     }
 
     ec = audioBackend_->setupOutTranscodeStream(streamHandle_,
             createdTranscoderInfo->outStreamId, outInfo,
             shared_from_this(), createdTranscoderInfo->readMinSize);
     if (ec != telux::common::ErrorCode::SUCCESS) {
-        buffer_ = nullptr;
+        writePool_ = nullptr;
+        readPool_ = nullptr;
     }
 
     return ec;
 }
 
+/*
+ * Creates buffer pools used on the data path. Buffer size matches the maximum
+ * buffer size (writeMaxSize/readMaxSize) advertised to the client when the stream
+ * is created, therefore any buffer sent by the client fits in a pooled buffer.
+ */
+telux::common::ErrorCode Stream::createBufferPools() {
+
+    try {
+        if (streamHandle_.type == StreamType::PLAY) {
+            writePool_ = std::unique_ptr<AudioBufferPool>(
+                new AudioBufferPool(MAX_BUFFER_SIZE, POOLED_BUFFERS_PER_STREAM));
+        } else {
+            readPool_ = std::unique_ptr<AudioBufferPool>(
+                new AudioBufferPool(MAX_BUFFER_SIZE, POOLED_BUFFERS_PER_STREAM));
+        }
+    } catch (const std::exception& e) {
+        LOG(ERROR, __FUNCTION__, " can't allocate memory for stream");
+        return telux::common::ErrorCode::NO_MEMORY;
+    }
+
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+StreamStats Stream::getStats() {
+
+    StreamStats stats{};
+
+    if (writePool_) {
+        stats.writePool = writePool_->getStats();
+    }
+
+    if (readPool_) {
+        stats.readPool = readPool_->getStats();
+    }
+
+    return stats;
+}
+
 telux::common::ErrorCode Stream::cleanupStream(std::vector<int>& voiceCallList) {
     telux::common::ErrorCode ec = telux::common::ErrorCode::SUCCESS;
+    StreamStats stats{};
 
     streamTaskExecutor_->shutdown();
+
+    stats = getStats();
+    LOG(INFO, __FUNCTION__, " strmid: ", streamParams_.streamId,
+        " write pool exhausted: ", stats.writePool.exhaustionCount,
+        " allocations: ", stats.writePool.allocationCount,
+        " peak: ", stats.writePool.peakInUse,
+        ", read pool exhausted: ", stats.readPool.exhaustionCount,
+        " allocations: ", stats.readPool.allocationCount,
+        " peak: ", stats.readPool.peakInUse);
     if(!isIncallStream && !isBtStream && !isHpcmStream) {
         ec = audioBackend_->deleteStream(streamHandle_);
         if (ec != telux::common::ErrorCode::SUCCESS) {
@@ -810,6 +860,13 @@ void Stream::doStartDtmf(std::shared_ptr<AudioRequest> audioReq, uint32_t stream
             goto result;
     }
 
+    ec = audioBackend_->startDtmf(streamHandle_, gain, duration, dtmfTone);
+    if (ec != telux::common::ErrorCode::SUCCESS) {
+        goto result;
+    }
+
+    streamHandle_.dtmfStarted = true;
+
     LOG(DEBUG, __FUNCTION__, " dtmf started, strmid: ", streamId);
 
 result:
@@ -833,6 +890,10 @@ void Stream::doStopDtmf(std::shared_ptr<AudioRequest> audioReq, uint32_t streamI
         return;
     }
 
+    ec = audioBackend_->stopDtmf(streamHandle_, direction);
+    if (ec == telux::common::ErrorCode::SUCCESS) {
+        streamHandle_.dtmfStarted = false;
+    }
 
     LOG(DEBUG, __FUNCTION__, " dtmf stopped, strmid: ", streamId);
 
@@ -850,9 +911,19 @@ void Stream::doRead(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
 
     int64_t actualReadLength = 0;
     telux::common::ErrorCode ec = telux::common::ErrorCode::SUCCESS;
+    uint8_t *data = nullptr;
 
-    if(!isIncallStream && !isBtStream && !isHpcmStream) {
-        ec = audioBackend_->read(streamHandle_, buffer_, readLengthRequested, actualReadLength);
+    if (readPool_) {
+        data = readPool_->acquire();
+    }
+
+    if (!data) {
+        ec = telux::common::ErrorCode::NO_MEMORY;
+    } else if (readLengthRequested > readPool_->getBufferSize()) {
+        ec = telux::common::ErrorCode::INVALID_ARG;
+        LOG(ERROR, __FUNCTION__, " read length more than max size ", readLengthRequested);
+    } else if(!isIncallStream && !isBtStream && !isHpcmStream) {
+        ec = audioBackend_->read(streamHandle_, data, readLengthRequested, actualReadLength);
     } else {
         if(!voiceCallList[streamParams_.config.streamConfig.slotId] && isIncallStream) {
             ec = telux::common::ErrorCode::SYSTEM_ERR;
@@ -865,13 +936,19 @@ void Stream::doRead(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
     LOG(DEBUG, __FUNCTION__,
           " stream data read, strmid: ", streamId, " length ", actualReadLength);
 
+    if (ec != telux::common::ErrorCode::SUCCESS) {
+        actualReadLength = 0;
+    }
+
     auto audioMsgDispatcher = audioReq->getAudioMsgDispatcher().lock();
-    if (!audioMsgDispatcher) {
-        return;
+    if (audioMsgDispatcher) {
+        audioMsgDispatcher->sendReadResponse(audioReq, ec, streamId, data,
+            actualReadLength, 0, 0, isIncallStream, isHpcmStream);
     }
 
-    audioMsgDispatcher->sendReadResponse(audioReq, ec, streamId, buffer_,
-        actualReadLength, 0, 0, isIncallStream, isHpcmStream);
+    if (readPool_) {
+        readPool_->release(data);
+    }
 }
 
 void Stream::read(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
@@ -924,10 +1001,27 @@ void Stream::doWrite(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
     int64_t actualLengthWritten = 0;
     telux::common::ErrorCode ec = telux::common::ErrorCode::SUCCESS;
 
+    if (writePool_ && (writeLengthRequested > writePool_->getBufferSize())) {
+        auto audioMsgDispatcher = audioReq->getAudioMsgDispatcher().lock();
+        if (!audioMsgDispatcher) {
+            return;
+        }
+
+        audioMsgDispatcher->sendWriteResponse(audioReq,
+            telux::common::ErrorCode::INVALID_ARG, streamId, actualLengthWritten,
+            isIncallStream, isHpcmStream);
+        return;
+    }
+
     if(streamHandle_.isAMR) {
         pipelineLength += 1;
         sendPipelineFull += 1;
         if(sendPipelineFull%maxPipeLineLen == 0 && (!isLastBuffer) && (pipelineLength>0)){
+            /* Buffer is not consumed, client resends it after write ready */
+            if (writePool_) {
+                writePool_->release(data);
+            }
+
             auto audioMsgDispatcher = audioReq->getAudioMsgDispatcher().lock();
             if (!audioMsgDispatcher) {
                 return;
@@ -945,7 +1039,9 @@ void Stream::doWrite(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
         }
     }
 
-    if(!isIncallStream && !isBtStream && !isHpcmStream) {
+    if (!data) {
+        ec = telux::common::ErrorCode::NO_MEMORY;
+    } else if(!isIncallStream && !isBtStream && !isHpcmStream) {
         ec = audioBackend_->write(streamHandle_, data, writeLengthRequested, offset,
             timeStamp, isLastBuffer, actualLengthWritten);
     } else {
@@ -956,6 +1052,11 @@ void Stream::doWrite(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
         }
     }
 
+    /* Backend is done with the data, recycle the buffer */
+    if (writePool_) {
+        writePool_->release(data);
+    }
+
     /* Don't log on data path */
     /* LOG(DEBUG, __FUNCTION__,
         " data written, strmid: ", streamId, " length ", actualLengthWritten); */
@@ -980,12 +1081,30 @@ void Stream::doWrite(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
     }
 }
 
+/*
+ * Given data is valid only for the duration of this call. It is copied into a
+ * pooled buffer which is recycled once the write completes.
+ */
 void Stream::write(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
-        uint8_t *data, uint32_t writeLengthRequested, uint32_t offset,
+        const uint8_t *data, uint32_t writeLengthRequested, uint32_t offset,
         int64_t timeStamp, bool isLastBuffer, std::vector<int> &voiceCallList) {
 
+    uint8_t *buffer = nullptr;
+
+    if (writePool_) {
+        if (writeLengthRequested > writePool_->getBufferSize()) {
+            /* Rejected in doWrite, in order with the other writes of this stream */
+            LOG(ERROR, __FUNCTION__, " write length more than max size ", writeLengthRequested);
+        } else {
+            buffer = writePool_->acquire();
+            if (buffer) {
+                std::memcpy(buffer, data, writeLengthRequested);
+            }
+        }
+    }
+
     streamTaskExecutor_->submitTask( [=]{ doWrite(audioReq, streamId, writeLengthRequested,
-        offset, timeStamp, isLastBuffer, data, voiceCallList); });
+        offset, timeStamp, isLastBuffer, buffer, voiceCallList); });
 }
 
 /*
@@ -15,10 +15,19 @@
 #include "ClientCache.hpp"
 #include "IAudioBackend.hpp"
 #include "IAudioMsgDispatcher.hpp"
+#include "AudioBufferPool.hpp"
 
 namespace telux {
 namespace audio {
 
+/*
+ * Data path statistics of a stream.
+ */
+struct StreamStats {
+    BufferPoolStats writePool;
+    BufferPoolStats readPool;
+};
+
 /*
  * Represents an audio stream from audio service's point of view.
  */
@@ -69,7 +78,7 @@ class Stream : public IStreamEventListener,
             StreamDirection direction);
 
     void write(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
-            uint8_t *data, uint32_t dataLength, uint32_t offset, int64_t timeStamp,
+            const uint8_t *data, uint32_t dataLength, uint32_t offset, int64_t timeStamp,
             bool isLastBuffer, std::vector<int> &voiceCallList);
 
     void read(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
@@ -84,6 +93,8 @@ class Stream : public IStreamEventListener,
 
     void drain(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId);
 
+    StreamStats getStats();
+
     /* IStreamEventListener overrides */
 
     void onWriteReadyEvent(uint32_t streamId) override;
@@ -104,7 +115,12 @@ class Stream : public IStreamEventListener,
     /* Max no. of bufffers after which pipeline full notification is sent. */
     int maxPipeLineLen = 0;
     bool isBtStream = false;
-    std::shared_ptr<std::vector<uint8_t>> buffer_;
+    /* Number of buffers kept in each data path buffer pool. */
+    static const uint32_t POOLED_BUFFERS_PER_STREAM = 4;
+    /* Buffers recycled between write requests, sized as per CreatedStreamInfo::writeMaxSize. */
+    std::unique_ptr<AudioBufferPool> writePool_;
+    /* Buffers recycled between read requests, sized as per CreatedStreamInfo::readMaxSize. */
+    std::unique_ptr<AudioBufferPool> readPool_;
     StreamHandle streamHandle_;
     StreamParams streamParams_;
     std::shared_ptr<IAudioBackend> audioBackend_;
@@ -139,6 +155,8 @@ class Stream : public IStreamEventListener,
             uint32_t dataLength, uint32_t offset, int64_t timeStamp, bool isLastBuffer,
             uint8_t *data, std::vector<int> voiceCallList);
 
+    telux::common::ErrorCode createBufferPools();
+
     void doStartDtmf(std::shared_ptr<AudioRequest> audioReq, uint32_t streamId,
             uint16_t gain, uint16_t duration, DtmfTone dtmfTone);
 
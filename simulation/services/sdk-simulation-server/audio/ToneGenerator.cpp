@@ -0,0 +1,82 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "ToneGenerator.hpp"
+
+namespace telux {
+namespace audio {
+
+const uint16_t ToneGenerator::MAX_GAIN;
+const uint32_t ToneGenerator::MAX_TONES;
+
+ToneGenerator::ToneGenerator(uint32_t sampleRate, int channels)
+    : sampleRate_(sampleRate),
+      channels_(channels) {
+}
+
+/*
+ * One cycle of a Q15 sine, an extra entry at the end equal to the first one lets
+ * interpolation read entry index + 1 without wrapping.
+ */
+const std::vector<int16_t> &ToneGenerator::getSineTable() {
+
+    static const std::vector<int16_t> table = [] {
+        uint32_t size = 1u << TABLE_BITS;
+        std::vector<int16_t> t(size + 1);
+        for (uint32_t x = 0; x < size; x++) {
+            t[x] = static_cast<int16_t>(std::lround(32767.0 * std::sin(2.0 * M_PI * x / size)));
+        }
+        t[size] = t[0];
+        return t;
+    }();
+
+    return table;
+}
+
+void ToneGenerator::configure(const std::vector<uint16_t> &frequencies, uint16_t gain) {
+
+    numTones_ = std::min(static_cast<uint32_t>(frequencies.size()), MAX_TONES);
+
+    for (uint32_t x = 0; x < numTones_; x++) {
+        phase_[x] = 0;
+        /* Phase increment per sample, one cycle is 2^32 */
+        phaseInc_[x] = sampleRate_ ? static_cast<uint32_t>(
+            (static_cast<uint64_t>(frequencies[x]) << 32) / sampleRate_) : 0;
+    }
+
+    /* Share the full scale between the tones so that the sum never clips */
+    amplitude_ = numTones_ ? (static_cast<int32_t>(std::min(gain, MAX_GAIN)) * 32767) /
+        (MAX_GAIN * static_cast<int32_t>(numTones_)) : 0;
+}
+
+void ToneGenerator::generate(int16_t *samples, uint32_t frames) {
+
+    const int16_t *table = getSineTable().data();
+    const uint32_t fracBits = 32 - TABLE_BITS;
+    uint32_t index, frac;
+    int32_t value, sample;
+
+    for (uint32_t x = 0; x < frames; x++) {
+        sample = 0;
+        for (uint32_t t = 0; t < numTones_; t++) {
+            index = phase_[t] >> fracBits;
+            /* Use the top 15 bits of the fraction for the interpolation */
+            frac = (phase_[t] >> (fracBits - 15)) & 0x7FFF;
+            value = table[index] + (((table[index + 1] - table[index]) *
+                static_cast<int32_t>(frac)) >> 15);
+            sample += (value * amplitude_) >> 15;
+            phase_[t] += phaseInc_[t];
+        }
+        for (int ch = 0; ch < channels_; ch++) {
+            *samples++ = static_cast<int16_t>(sample);
+        }
+    }
+}
+
+}  // end of namespace audio
+}  // end of namespace telux
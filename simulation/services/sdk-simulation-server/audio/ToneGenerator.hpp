@@ -0,0 +1,61 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#ifndef TONEGENERATOR_HPP
+#define TONEGENERATOR_HPP
+
+#include <vector>
+#include <cstdint>
+
+namespace telux {
+namespace audio {
+
+/*
+ * Generates single, dual (DTMF) tone as 16-bit interleaved PCM samples.
+ *
+ * Samples are looked up from a sine table shared by all generators and interpolated
+ * linearly. Every frequency has its own 32-bit phase accumulator which is carried over
+ * between generate() calls, so a tone produced in several buffers has no discontinuity
+ * at the buffer boundaries.
+ */
+class ToneGenerator {
+
+ public:
+    /* Maximum gain accepted, maps to full scale */
+    static const uint16_t MAX_GAIN = 4000;
+
+    ToneGenerator(uint32_t sampleRate, int channels);
+
+    /*
+     * Sets the frequencies (one or two) and the gain (0 to MAX_GAIN) of the tone.
+     * Phase is reset so that the tone starts from zero crossing.
+     */
+    void configure(const std::vector<uint16_t> &frequencies, uint16_t gain);
+
+    /*
+     * Fills given number of frames continuing from the last generated frame.
+     */
+    void generate(int16_t *samples, uint32_t frames);
+
+ private:
+    /* Sine table has 2^TABLE_BITS entries covering one cycle */
+    static const uint32_t TABLE_BITS = 10;
+    static const uint32_t MAX_TONES = 2;
+
+    uint32_t sampleRate_;
+    int channels_;
+    uint32_t numTones_ = 0;
+    uint32_t phase_[MAX_TONES] = {0, 0};
+    uint32_t phaseInc_[MAX_TONES] = {0, 0};
+    /* Q15 amplitude of every tone */
+    int32_t amplitude_ = 0;
+
+    static const std::vector<int16_t> &getSineTable();
+};
+
+}  // end of namespace audio
+}  // end of namespace telux
+
+#endif  // TONEGENERATOR_HPP
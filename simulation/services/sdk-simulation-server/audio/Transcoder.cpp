@@ -0,0 +1,511 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+
+#include "libs/common/Logger.hpp"
+#include "TransportDefines.hpp"
+#include "Transcoder.hpp"
+
+/* Maximum time a write waits for space in the pipeline, in milli seconds */
+#define WRITE_TIMEOUT_MS 500
+/* Maximum time a read waits for transcoded data, in milli seconds */
+#define READ_TIMEOUT_MS 500
+
+/* Magic number at the beginning of an AMR-WB file */
+static const char AMRWB_MAGIC[] = "#!AMR-WB\n";
+#define AMRWB_MAGIC_LENGTH (sizeof(AMRWB_MAGIC) - 1)
+
+namespace telux {
+namespace audio {
+
+void Transcoder::ByteQueue::push(const uint8_t *data, uint32_t length) {
+
+    if (head_ && (head_ >= bytes_.size() / 2)) {
+        bytes_.erase(bytes_.begin(), bytes_.begin() + head_);
+        head_ = 0;
+    }
+
+    bytes_.insert(bytes_.end(), data, data + length);
+}
+
+void Transcoder::ByteQueue::pop(uint32_t length) {
+
+    head_ += std::min(length, size());
+    if (head_ == bytes_.size()) {
+        clear();
+    }
+}
+
+const uint8_t *Transcoder::ByteQueue::data() const {
+    return bytes_.data() + head_;
+}
+
+uint32_t Transcoder::ByteQueue::size() const {
+    return bytes_.size() - head_;
+}
+
+void Transcoder::ByteQueue::clear() {
+    bytes_.clear();
+    head_ = 0;
+}
+
+void Transcoder::Resampler::configure(uint32_t inRate, uint32_t outRate) {
+
+    isBypassed_ = (inRate == outRate);
+    step_ = (static_cast<uint64_t>(inRate) << 16) / outRate;
+    phase_ = 0;
+    last_ = 0;
+}
+
+/*
+ * Output sample n is taken at input position n * inRate / outRate (Q16). The last
+ * input sample of the previous call is kept to interpolate across calls.
+ */
+void Transcoder::Resampler::process(const int16_t *in, uint32_t count,
+        std::vector<int16_t> &out) {
+
+    uint64_t limit = static_cast<uint64_t>(count) << 16;
+    uint32_t idx;
+    int64_t a, b;
+
+    if (isBypassed_) {
+        out.insert(out.end(), in, in + count);
+        return;
+    }
+
+    if (!count) {
+        return;
+    }
+
+    /* Position 0 is last_, position k is in[k - 1] */
+    while (phase_ < limit) {
+        idx = static_cast<uint32_t>(phase_ >> 16);
+        a = idx ? in[idx - 1] : last_;
+        b = in[idx];
+        out.push_back(static_cast<int16_t>(a + (((b - a) * (phase_ & 0xFFFF)) >> 16)));
+        phase_ += step_;
+    }
+
+    phase_ -= limit;
+    last_ = in[count - 1];
+}
+
+Transcoder::Transcoder(TranscodingFormatInfo inInfo, std::unique_ptr<ISpeechCodec> codec,
+        EventCallback onWriteReady, EventCallback onDrainDone)
+    : inInfo_(inInfo),
+      codec_(std::move(codec)),
+      onWriteReady_(onWriteReady),
+      onDrainDone_(onDrainDone) {
+
+    outInfo_ = {};
+}
+
+Transcoder::~Transcoder() {
+    stop();
+}
+
+bool Transcoder::isCompressed(AudioFormat format) {
+    return ((format == AudioFormat::AMRWB) || (format == AudioFormat::AMRWB_PLUS));
+}
+
+int Transcoder::getChannels(ChannelTypeMask mask) {
+    return (mask == (ChannelType::LEFT | ChannelType::RIGHT)) ? 2 : 1;
+}
+
+/*
+ * Size of one codec frame's duration of PCM at the given rate.
+ */
+uint32_t Transcoder::getPcmFrameBytes(uint32_t sampleRate, int channels) {
+
+    if (!codec_ || !codec_->getSampleRate()) {
+        return 0;
+    }
+
+    return ((static_cast<uint64_t>(sampleRate) * codec_->getFrameSamples()) /
+        codec_->getSampleRate()) * channels * sizeof(int16_t);
+}
+
+uint32_t Transcoder::getWriteMinSize() {
+
+    uint32_t size;
+
+    if (isCompressed(inInfo_.format)) {
+        return 0;
+    }
+
+    size = getPcmFrameBytes(inInfo_.sampleRate, getChannels(inInfo_.mask));
+    return (size <= MAX_BUFFER_SIZE) ? size : 0;
+}
+
+uint32_t Transcoder::getReadMinSize() {
+
+    uint32_t size;
+
+    if (isCompressed(outInfo_.format)) {
+        return 0;
+    }
+
+    size = getPcmFrameBytes(outInfo_.sampleRate, getChannels(outInfo_.mask));
+    return (size <= MAX_BUFFER_SIZE) ? size : 0;
+}
+
+telux::common::ErrorCode Transcoder::start(TranscodingFormatInfo outInfo) {
+
+    uint32_t pcmFrameBytes;
+    std::lock_guard<std::mutex> lock(transcoderMtx_);
+
+    if (isRunning_ || !codec_) {
+        return telux::common::ErrorCode::INVALID_STATE;
+    }
+
+    if (isCompressed(inInfo_.format) && (outInfo.format == AudioFormat::PCM_16BIT_SIGNED)) {
+        isEncoding_ = false;
+        pcmRate_ = outInfo.sampleRate;
+        pcmChannels_ = getChannels(outInfo.mask);
+    } else if ((inInfo_.format == AudioFormat::PCM_16BIT_SIGNED) &&
+            isCompressed(outInfo.format)) {
+        isEncoding_ = true;
+        pcmRate_ = inInfo_.sampleRate;
+        pcmChannels_ = getChannels(inInfo_.mask);
+    } else {
+        LOG(ERROR, __FUNCTION__, " unsupported formats ", static_cast<int>(inInfo_.format),
+            " to ", static_cast<int>(outInfo.format));
+        return telux::common::ErrorCode::NOT_SUPPORTED;
+    }
+
+    if (!pcmRate_) {
+        LOG(ERROR, __FUNCTION__, " invalid sample rate");
+        return telux::common::ErrorCode::INVALID_ARGUMENTS;
+    }
+
+    outInfo_ = outInfo;
+    pcmFrameBytes = getPcmFrameBytes(pcmRate_, pcmChannels_);
+    frame_.resize(codec_->getFrameSamples());
+
+    if (isEncoding_) {
+        resampler_.configure(pcmRate_, codec_->getSampleRate());
+        inputCapacity_ = PIPELINE_BATCHES * BATCH_FRAMES * pcmFrameBytes;
+        outputCapacity_ = PIPELINE_BATCHES * BATCH_FRAMES * codec_->getMaxFrameLength();
+    } else {
+        resampler_.configure(codec_->getSampleRate(), pcmRate_);
+        inputCapacity_ = PIPELINE_BATCHES * BATCH_FRAMES * codec_->getMaxFrameLength();
+        /* Resampling may give one extra sample per frame */
+        outputCapacity_ = PIPELINE_BATCHES * BATCH_FRAMES *
+            (pcmFrameBytes + pcmChannels_ * sizeof(int16_t));
+    }
+
+    /* Any buffer the client sends must fit */
+    inputCapacity_ = std::max(inputCapacity_, 2 * MAX_BUFFER_SIZE);
+    outputCapacity_ = std::max(outputCapacity_, 2 * MAX_BUFFER_SIZE);
+
+    isRunning_ = true;
+    worker_ = std::thread(&Transcoder::transcodeLoop, this);
+
+    LOG(INFO, __FUNCTION__, (isEncoding_ ? " encoding" : " decoding"), " pcm rate ", pcmRate_,
+        " channels ", pcmChannels_);
+    return telux::common::ErrorCode::SUCCESS;
+}
+
+void Transcoder::stop() {
+
+    {
+        std::lock_guard<std::mutex> lock(transcoderMtx_);
+        isRunning_ = false;
+        inputCv_.notify_all();
+        outputCv_.notify_all();
+    }
+
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+uint32_t Transcoder::write(const uint8_t *data, uint32_t length, bool isLastBuffer) {
+
+    uint32_t accepted;
+    std::unique_lock<std::mutex> lock(transcoderMtx_);
+
+    if (!isRunning_ || inputEnded_) {
+        LOG(ERROR, __FUNCTION__, " not accepting data");
+        return 0;
+    }
+
+    inputCv_.wait_for(lock, std::chrono::milliseconds(WRITE_TIMEOUT_MS), [=] {
+        return (!isRunning_ || (input_.size() + length <= inputCapacity_));
+    });
+
+    if (!isRunning_) {
+        return 0;
+    }
+
+    accepted = std::min(length, inputCapacity_ - std::min(input_.size(), inputCapacity_));
+    input_.push(data, accepted);
+
+    if (accepted < length) {
+        /* Client resends the rest after the write ready event */
+        isWriteBlocked_ = true;
+        ++stats_.writeStalls;
+    } else if (isLastBuffer) {
+        inputEnded_ = true;
+    }
+
+    inputCv_.notify_all();
+    return accepted;
+}
+
+uint32_t Transcoder::read(uint8_t *data, uint32_t length) {
+
+    uint32_t count;
+    bool isDrained = false;
+    std::unique_lock<std::mutex> lock(transcoderMtx_);
+
+    outputCv_.wait_for(lock, std::chrono::milliseconds(READ_TIMEOUT_MS), [=] {
+        return (!isRunning_ || outputEnded_ || (output_.size() >= length));
+    });
+
+    count = std::min(length, output_.size());
+    std::memcpy(data, output_.data(), count);
+    output_.pop(count);
+
+    if ((count < length) && isRunning_ && !outputEnded_) {
+        ++stats_.readShortfalls;
+    }
+
+    if (outputEnded_ && !output_.size() && !isDrainReported_) {
+        isDrainReported_ = true;
+        isDrained = true;
+    }
+
+    /* Worker may be waiting for space */
+    inputCv_.notify_all();
+    lock.unlock();
+
+    if (isDrained && onDrainDone_) {
+        onDrainDone_();
+    }
+
+    return count;
+}
+
+/*
+ * Moves the next frames to transcode from the input queue to batchIn_. For encoding
+ * this is PCM worth BATCH_FRAMES frames, for decoding up to BATCH_FRAMES complete
+ * compressed frames. Called with transcoderMtx_ held. Returns false if there isn't
+ * enough input yet.
+ */
+bool Transcoder::takeBatch() {
+
+    uint32_t length = 0, frameLength, frames = 0;
+    uint32_t sampleFrameBytes = pcmChannels_ * sizeof(int16_t);
+    const uint8_t *data;
+
+    batchIn_.clear();
+
+    if (isEncoding_) {
+        /* Samples not making a complete frame are kept by encodeBatch() */
+        length = std::min(input_.size(), BATCH_FRAMES * getPcmFrameBytes(pcmRate_,
+            pcmChannels_));
+        length -= length % sampleFrameBytes;
+        if (!length) {
+            if (inputEnded_) {
+                /* Incomplete sample at the end */
+                input_.clear();
+            }
+            return false;
+        }
+        batchIn_.assign(input_.data(), input_.data() + length);
+        input_.pop(length);
+        return true;
+    }
+
+    if (!isHeaderChecked_) {
+        if ((input_.size() < AMRWB_MAGIC_LENGTH) && !inputEnded_ &&
+                !std::memcmp(input_.data(), AMRWB_MAGIC, input_.size())) {
+            return false;
+        }
+        if ((input_.size() >= AMRWB_MAGIC_LENGTH) &&
+                !std::memcmp(input_.data(), AMRWB_MAGIC, AMRWB_MAGIC_LENGTH)) {
+            input_.pop(AMRWB_MAGIC_LENGTH);
+        }
+        isHeaderChecked_ = true;
+    }
+
+    data = input_.data();
+    while ((frames < BATCH_FRAMES) && (length < input_.size())) {
+        frameLength = codec_->getFrameLength(data[length]);
+        if (!frameLength && length) {
+            /* Handled with the next batch */
+            break;
+        }
+        if (!frameLength) {
+            /* Reserved frame type, skip the header and resynchronize */
+            input_.pop(1);
+            ++stats_.invalidFrames;
+            data = input_.data();
+            continue;
+        }
+        if (length + frameLength > input_.size()) {
+            break;
+        }
+        length += frameLength;
+        ++frames;
+    }
+
+    if (inputEnded_ && (frames < BATCH_FRAMES) && (length < input_.size()) &&
+            (length + codec_->getFrameLength(data[length]) > input_.size())) {
+        /* Truncated frame at the end */
+        ++stats_.invalidFrames;
+        batchIn_.assign(data, data + length);
+        input_.clear();
+        return (length > 0);
+    }
+
+    if (!length) {
+        return false;
+    }
+
+    batchIn_.assign(data, data + length);
+    input_.pop(length);
+    return true;
+}
+
+void Transcoder::decodeBatch() {
+
+    uint32_t pos = 0, frameLength;
+    int16_t sample, *out;
+
+    mono_.clear();
+    while (pos < batchIn_.size()) {
+        frameLength = codec_->getFrameLength(batchIn_[pos]);
+        codec_->decode(&batchIn_[pos], frame_.data());
+        resampler_.process(frame_.data(), frame_.size(), mono_);
+        pos += frameLength;
+        ++stats_.framesTranscoded;
+    }
+
+    batchOut_.resize(mono_.size() * pcmChannels_ * sizeof(int16_t));
+    out = reinterpret_cast<int16_t *>(batchOut_.data());
+    for (uint32_t x = 0; x < mono_.size(); x++) {
+        sample = mono_[x];
+        for (int ch = 0; ch < pcmChannels_; ch++) {
+            *out++ = sample;
+        }
+    }
+}
+
+void Transcoder::encodeBatch(bool isLastBatch) {
+
+    const int16_t *in = reinterpret_cast<const int16_t *>(batchIn_.data());
+    uint32_t frames = batchIn_.size() / (pcmChannels_ * sizeof(int16_t));
+    uint32_t frameSamples = codec_->getFrameSamples();
+    uint32_t pos = 0, length = 0;
+    int32_t sum;
+
+    mono_.resize(frames);
+    for (uint32_t x = 0; x < frames; x++) {
+        sum = 0;
+        for (int ch = 0; ch < pcmChannels_; ch++) {
+            sum += in[x * pcmChannels_ + ch];
+        }
+        mono_[x] = static_cast<int16_t>(sum / pcmChannels_);
+    }
+
+    resampler_.process(mono_.data(), frames, pending_);
+
+    if (isLastBatch && (pending_.size() % frameSamples)) {
+        /* Complete the last frame with silence */
+        pending_.resize(pending_.size() + frameSamples - (pending_.size() % frameSamples), 0);
+    }
+
+    batchOut_.resize((pending_.size() / frameSamples) * codec_->getMaxFrameLength());
+    while (pending_.size() - pos >= frameSamples) {
+        length += codec_->encode(&pending_[pos], &batchOut_[length]);
+        pos += frameSamples;
+        ++stats_.framesTranscoded;
+    }
+
+    batchOut_.resize(length);
+    pending_.erase(pending_.begin(), pending_.begin() + pos);
+}
+
+/*
+ * Worker thread, takes a batch of frames from the input queue, transcodes it while
+ * the client keeps writing and reading, then queues the result for reading.
+ */
+void Transcoder::transcodeLoop() {
+
+    uint32_t batchOutMax, queued;
+    uint64_t batchTimeNs;
+    bool hasBatch, isLastBatch, isWriteReady;
+    std::chrono::steady_clock::time_point startTime;
+    std::unique_lock<std::mutex> lock(transcoderMtx_);
+
+    if (isEncoding_) {
+        batchOutMax = (BATCH_FRAMES + 1) * codec_->getMaxFrameLength();
+    } else {
+        batchOutMax = BATCH_FRAMES * (getPcmFrameBytes(pcmRate_, pcmChannels_) +
+            pcmChannels_ * sizeof(int16_t));
+    }
+
+    while (isRunning_) {
+        if (output_.size() + batchOutMax > outputCapacity_) {
+            /* Reader is behind */
+            inputCv_.wait(lock, [=] {
+                return (!isRunning_ || (output_.size() + batchOutMax <= outputCapacity_));
+            });
+            continue;
+        }
+
+        queued = input_.size();
+        hasBatch = takeBatch();
+        isLastBatch = inputEnded_ && !input_.size();
+
+        if (!hasBatch && !isLastBatch) {
+            inputCv_.wait(lock, [=] {
+                return (!isRunning_ || inputEnded_ || (input_.size() != queued));
+            });
+            continue;
+        }
+
+        isWriteReady = isWriteBlocked_;
+        isWriteBlocked_ = false;
+        lock.unlock();
+
+        if (isWriteReady && onWriteReady_) {
+            onWriteReady_();
+        }
+
+        startTime = std::chrono::steady_clock::now();
+        if (isEncoding_) {
+            encodeBatch(isLastBatch);
+        } else {
+            decodeBatch();
+        }
+        batchTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+
+        lock.lock();
+        output_.push(batchOut_.data(), batchOut_.size());
+        stats_.codecTimeNs += batchTimeNs;
+        stats_.maxBatchTimeNs = std::max(stats_.maxBatchTimeNs, batchTimeNs);
+        outputCv_.notify_all();
+
+        if (isLastBatch) {
+            outputEnded_ = true;
+            break;
+        }
+    }
+}
+
+TranscoderStats Transcoder::getStats() {
+    std::lock_guard<std::mutex> lock(transcoderMtx_);
+    return stats_;
+}
+
+}  // end of namespace audio
+}  // end of namespace telux
@@ -0,0 +1,163 @@
+/*
+ *  Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ *  SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#ifndef TRANSCODER_HPP
+#define TRANSCODER_HPP
+
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include <telux/common/CommonDefines.hpp>
+
+#include "AudioDefinesInternal.hpp"
+#include "AmrwbCodec.hpp"
+
+namespace telux {
+namespace audio {
+
+struct TranscoderStats {
+    uint64_t framesTranscoded;
+    /* Frames dropped because their header is invalid */
+    uint64_t invalidFrames;
+    /* Time spent in the codec in nano seconds, in total and for the slowest batch */
+    uint64_t codecTimeNs;
+    uint64_t maxBatchTimeNs;
+    /* Writes which could not be accepted completely as the pipeline was full */
+    uint32_t writeStalls;
+    /* Reads which returned less than requested before the end of the data */
+    uint32_t readShortfalls;
+};
+
+/*
+ * Transcodes between 16-bit PCM and a compressed format using an ISpeechCodec.
+ *
+ * The transcoder input stream write()s into a bounded input queue, a worker thread
+ * takes all complete frames queued (up to BATCH_FRAMES) and transcodes them into a
+ * bounded output queue which the transcoder output stream read()s. Writing, coding
+ * and reading therefore overlap, and a full pipeline slows down the writer, so that
+ * the client sees the codec's real throughput.
+ *
+ * PCM may have any sample rate and 1 or 2 channels, it is converted to/from the
+ * codec's mono rate.
+ */
+class Transcoder {
+
+ public:
+    using EventCallback = std::function<void()>;
+
+    /*
+     * onWriteReady is invoked when a write() that couldn't be accepted completely
+     * may be sent again, onDrainDone when the last transcoded data has been read.
+     */
+    Transcoder(TranscodingFormatInfo inInfo, std::unique_ptr<ISpeechCodec> codec,
+        EventCallback onWriteReady, EventCallback onDrainDone);
+    ~Transcoder();
+
+    /*
+     * Validates the formats and starts the worker thread.
+     */
+    telux::common::ErrorCode start(TranscodingFormatInfo outInfo);
+
+    void stop();
+
+    /*
+     * Queues data to transcode, waits a bounded time for space in the pipeline.
+     * Returns number of bytes accepted.
+     */
+    uint32_t write(const uint8_t *data, uint32_t length, bool isLastBuffer);
+
+    /*
+     * Copies transcoded data, waits a bounded time for it to be available.
+     * Returns number of bytes copied.
+     */
+    uint32_t read(uint8_t *data, uint32_t length);
+
+    /* Preferred write/read sizes, 0 if there is none */
+    uint32_t getWriteMinSize();
+    uint32_t getReadMinSize();
+
+    TranscoderStats getStats();
+
+ private:
+    /* Bytes queued between two stages of the pipeline */
+    class ByteQueue {
+     public:
+        void push(const uint8_t *data, uint32_t length);
+        void pop(uint32_t length);
+        const uint8_t *data() const;
+        uint32_t size() const;
+        void clear();
+
+     private:
+        std::vector<uint8_t> bytes_;
+        uint32_t head_ = 0;
+    };
+
+    /* Streaming linear interpolation of mono samples between two rates */
+    class Resampler {
+     public:
+        void configure(uint32_t inRate, uint32_t outRate);
+        void process(const int16_t *in, uint32_t count, std::vector<int16_t> &out);
+
+     private:
+        bool isBypassed_ = true;
+        uint64_t step_ = 0;
+        uint64_t phase_ = 0;
+        int16_t last_ = 0;
+    };
+
+    static const uint32_t BATCH_FRAMES = 8;
+    static const uint32_t PIPELINE_BATCHES = 4;
+
+    TranscodingFormatInfo inInfo_;
+    TranscodingFormatInfo outInfo_;
+    std::unique_ptr<ISpeechCodec> codec_;
+    EventCallback onWriteReady_;
+    EventCallback onDrainDone_;
+    bool isEncoding_ = false;
+    uint32_t pcmRate_ = 0;
+    int pcmChannels_ = 1;
+
+    std::mutex transcoderMtx_;
+    std::condition_variable inputCv_;
+    std::condition_variable outputCv_;
+    std::thread worker_;
+    ByteQueue input_;
+    ByteQueue output_;
+    uint32_t inputCapacity_ = 0;
+    uint32_t outputCapacity_ = 0;
+    bool isRunning_ = false;
+    bool inputEnded_ = false;
+    bool outputEnded_ = false;
+    bool isWriteBlocked_ = false;
+    bool isDrainReported_ = false;
+    bool isHeaderChecked_ = false;
+    TranscoderStats stats_{};
+
+    /* Owned by the worker thread */
+    Resampler resampler_;
+    std::vector<uint8_t> batchIn_;
+    std::vector<uint8_t> batchOut_;
+    std::vector<int16_t> frame_;
+    std::vector<int16_t> mono_;
+    std::vector<int16_t> pending_;
+
+    static bool isCompressed(AudioFormat format);
+    static int getChannels(ChannelTypeMask mask);
+    uint32_t getPcmFrameBytes(uint32_t sampleRate, int channels);
+    bool takeBatch();
+    void decodeBatch();
+    void encodeBatch(bool isLastBatch);
+    void transcodeLoop();
+};
+
+}  // end of namespace audio
+}  // end of namespace telux
+
+#endif  // TRANSCODER_HPP
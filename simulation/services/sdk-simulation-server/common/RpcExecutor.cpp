@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "RpcExecutor.hpp"
+
+#include <exception>
+
+#include "libs/common/Logger.hpp"
+
+RpcExecutor &RpcExecutor::getInstance() {
+    static RpcExecutor instance;
+    return instance;
+}
+
+RpcExecutor::RpcExecutor()
+   : threadCount_(DEFAULT_THREAD_COUNT) {
+    LOG(DEBUG, __FUNCTION__);
+}
+
+RpcExecutor::~RpcExecutor() {
+    LOG(DEBUG, __FUNCTION__);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (dispatcher_) {
+        dispatcher_->shutdown();
+    }
+}
+
+void RpcExecutor::setThreadCount(int threadCount) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (dispatcher_) {
+        LOG(ERROR, __FUNCTION__, " Executor already started with ", threadCount_, " threads");
+        return;
+    }
+    if (threadCount < 1) {
+        LOG(ERROR, __FUNCTION__, " Invalid thread count ", threadCount);
+        return;
+    }
+    threadCount_ = threadCount;
+}
+
+grpc::ServerUnaryReactor *RpcExecutor::execute(grpc::CallbackServerContext *context,
+    std::function<grpc::Status()> handler) {
+    grpc::ServerUnaryReactor *reactor = context->DefaultReactor();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!dispatcher_) {
+        LOG(INFO, __FUNCTION__, " Starting executor with ", threadCount_, " threads");
+        dispatcher_.reset(new telux::common::TaskDispatcher(threadCount_));
+    }
+    if (dispatcher_->isShutdown()) {
+        reactor->Finish(grpc::Status(grpc::StatusCode::UNAVAILABLE, "Server shutting down"));
+        return reactor;
+    }
+    dispatcher_->submitTask([reactor, handler]() {
+        /* The reactor must be finished on every path, or the call never completes */
+        try {
+            reactor->Finish(handler());
+        } catch (const std::exception &e) {
+            LOG(ERROR, "RpcExecutor", " Handler failed: ", e.what());
+            reactor->Finish(grpc::Status(grpc::StatusCode::INTERNAL, e.what()));
+        } catch (...) {
+            LOG(ERROR, "RpcExecutor", " Handler failed with an unknown exception");
+            reactor->Finish(grpc::Status(grpc::StatusCode::INTERNAL, "Unknown exception"));
+        }
+    });
+    return reactor;
+}
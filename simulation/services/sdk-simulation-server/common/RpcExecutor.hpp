@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       RpcExecutor.hpp
+ *
+ * @brief      RpcExecutor completes unary RPCs of callback services on an internal thread
+ *             pool, so that handlers doing file I/O or waiting don't hold a gRPC polling
+ *             thread for the duration of the call.
+ */
+
+#ifndef RPC_EXECUTOR_HPP
+#define RPC_EXECUTOR_HPP
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <grpcpp/grpcpp.h>
+
+#include "libs/common/TaskDispatcher.hpp"
+
+class RpcExecutor {
+ public:
+    static const int DEFAULT_THREAD_COUNT = 8;
+
+    static RpcExecutor &getInstance();
+
+    /**
+     * Sets the number of executor threads, only effective before the first RPC is executed.
+     */
+    void setThreadCount(int threadCount);
+
+    /**
+     * Runs the handler on the executor and finishes the RPC with the status it returns.
+     *
+     * @returns reactor of the RPC, to be returned from the callback service method
+     */
+    grpc::ServerUnaryReactor *execute(grpc::CallbackServerContext *context,
+        std::function<grpc::Status()> handler);
+
+    ~RpcExecutor();
+
+ private:
+    RpcExecutor();
+    RpcExecutor(const RpcExecutor &) = delete;
+    RpcExecutor &operator=(const RpcExecutor &) = delete;
+
+    std::mutex mutex_;
+    int threadCount_;
+    std::unique_ptr<telux::common::TaskDispatcher> dispatcher_;
+};
+
+#endif  // RPC_EXECUTOR_HPP
@@ -17,6 +17,7 @@
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/Logger.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 
 static const std::string CV2X_CFG_API_JSON = "api/cv2x/ICv2xConfig.json";
 static const std::string CV2X_CFG_ROOT = "ICv2xConfig";
@@ -26,10 +27,8 @@ Cv2xConfigServerImpl::Cv2xConfigServerImpl() { LOG(DEBUG, __FUNCTION__); }
 
 Cv2xConfigServerImpl::~Cv2xConfigServerImpl() { LOG(DEBUG, __FUNCTION__); }
 
-grpc::Status
-Cv2xConfigServerImpl::initService(ServerContext *context,
-                                  const google::protobuf::Empty *request,
-                                  cv2xStub::GetServiceStatusReply *res) {
+grpc::Status Cv2xConfigServerImpl::initService(const google::protobuf::Empty *request,
+    cv2xStub::GetServiceStatusReply *res) {
     LOG(DEBUG, __FUNCTION__);
     int cbDelay = 0;
     telux::common::ServiceStatus serviceStatus =
@@ -50,8 +49,7 @@ Cv2xConfigServerImpl::initService(ServerContext *context,
     return grpc::Status::OK;
 }
 
-grpc::Status Cv2xConfigServerImpl::updateConfiguration(
-    ServerContext *context, const cv2xStub::Cv2xConfigPath *request,
+grpc::Status Cv2xConfigServerImpl::updateConfiguration(const cv2xStub::Cv2xConfigPath *request,
     ::cv2xStub::Cv2xCommandReply *res) {
     LOG(DEBUG, __FUNCTION__, " cv2x config path: ", request->path());
 
@@ -80,8 +78,7 @@ grpc::Status Cv2xConfigServerImpl::updateConfiguration(
     return grpc::Status::OK;
 }
 
-grpc::Status Cv2xConfigServerImpl::retrieveConfiguration(
-    ServerContext *context, const cv2xStub::Cv2xConfigPath *request,
+grpc::Status Cv2xConfigServerImpl::retrieveConfiguration(const cv2xStub::Cv2xConfigPath *request,
     ::cv2xStub::Cv2xCommandReply *res) {
     LOG(DEBUG, __FUNCTION__, " cv2x config path: ", request->path());
 
@@ -90,3 +87,23 @@ grpc::Status Cv2xConfigServerImpl::retrieveConfiguration(
 
     return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* Cv2xConfigServerImpl::initService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, cv2xStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return initService(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xConfigServerImpl::updateConfiguration(
+    grpc::CallbackServerContext* context, const cv2xStub::Cv2xConfigPath* request,
+    ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return updateConfiguration(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xConfigServerImpl::retrieveConfiguration(
+    grpc::CallbackServerContext* context, const cv2xStub::Cv2xConfigPath* request,
+    ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return retrieveConfiguration(request, response); });
+}
@@ -33,21 +33,26 @@ using grpc::Status;
 
 using cv2xStub::Cv2xConfigService;
 
-class Cv2xConfigServerImpl final : public cv2xStub::Cv2xConfigService::Service {
+class Cv2xConfigServerImpl final : public cv2xStub::Cv2xConfigService::CallbackService {
 public:
   Cv2xConfigServerImpl();
   ~Cv2xConfigServerImpl();
-  grpc::Status initService(ServerContext *context,
-                           const google::protobuf::Empty *request,
-                           cv2xStub::GetServiceStatusReply *res);
-  grpc::Status updateConfiguration(ServerContext *context,
-                                   const cv2xStub::Cv2xConfigPath *request,
-                                   ::cv2xStub::Cv2xCommandReply *res);
-  grpc::Status retrieveConfiguration(ServerContext *context,
-                                     const cv2xStub::Cv2xConfigPath *request,
-                                     ::cv2xStub::Cv2xCommandReply *res);
+  grpc::ServerUnaryReactor* initService(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, cv2xStub::GetServiceStatusReply* response) override;
+  grpc::ServerUnaryReactor* updateConfiguration(grpc::CallbackServerContext* context,
+      const cv2xStub::Cv2xConfigPath* request, ::cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* retrieveConfiguration(grpc::CallbackServerContext* context,
+      const cv2xStub::Cv2xConfigPath* request, ::cv2xStub::Cv2xCommandReply* response) override;
 
 private:
+  /* Handlers of the RPCs, run on the RPC executor */
+  grpc::Status initService(const google::protobuf::Empty* request,
+      cv2xStub::GetServiceStatusReply* res);
+  grpc::Status updateConfiguration(const cv2xStub::Cv2xConfigPath* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+  grpc::Status retrieveConfiguration(const cv2xStub::Cv2xConfigPath* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+
   std::string path_;
   telux::common::AsyncTaskQueue<void> taskQ_;
 };
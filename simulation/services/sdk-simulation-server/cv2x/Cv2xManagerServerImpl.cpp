@@ -17,6 +17,7 @@
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/Logger.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define SET_MEMBER(st,member,type,token) st.member(static_cast<type>(token))
 
@@ -399,10 +400,8 @@ Cv2xManagerServerImpl::~Cv2xManagerServerImpl() {
   }
 }
 
-grpc::Status
-Cv2xManagerServerImpl::initService(ServerContext *context,
-                                   const google::protobuf::Empty *request,
-                                   cv2xStub::GetServiceStatusReply *res) {
+grpc::Status Cv2xManagerServerImpl::initService(const google::protobuf::Empty *request,
+    cv2xStub::GetServiceStatusReply *res) {
   LOG(DEBUG, __FUNCTION__);
   int cbDelay = 100;
   telux::common::ServiceStatus serviceStatus =
@@ -423,10 +422,8 @@ Cv2xManagerServerImpl::initService(ServerContext *context,
   return grpc::Status::OK;
 }
 
-grpc::Status
-Cv2xManagerServerImpl::startCv2x(ServerContext *context,
-                                 const google::protobuf::Empty *request,
-                                 cv2xStub::Cv2xCommandReply *res) {
+grpc::Status Cv2xManagerServerImpl::startCv2x(const google::protobuf::Empty *request,
+    cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(CV2X_MGR_API_JSON, CV2X_MGR_NODE, "startCv2x",
                                 res);
@@ -434,10 +431,8 @@ Cv2xManagerServerImpl::startCv2x(ServerContext *context,
   return grpc::Status::OK;
 }
 
-grpc::Status
-Cv2xManagerServerImpl::stopCv2x(ServerContext *context,
-                                const google::protobuf::Empty *request,
-                                cv2xStub::Cv2xCommandReply *res) {
+grpc::Status Cv2xManagerServerImpl::stopCv2x(const google::protobuf::Empty *request,
+    cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(CV2X_MGR_API_JSON, CV2X_MGR_NODE, "stopCv2x",
                                 res);
@@ -446,18 +441,15 @@ Cv2xManagerServerImpl::stopCv2x(ServerContext *context,
   return grpc::Status::OK;
 }
 
-grpc::Status
-Cv2xManagerServerImpl::setPeakTxPower(ServerContext *context,
-                                      const cv2xStub::Cv2xPeakTxPower *request,
-                                      ::cv2xStub::Cv2xCommandReply *res) {
+grpc::Status Cv2xManagerServerImpl::setPeakTxPower(const cv2xStub::Cv2xPeakTxPower *request,
+    ::cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(CV2X_MGR_API_JSON, CV2X_MGR_NODE,
                                 "setPeakTxPower", res);
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xManagerServerImpl::injectCoarseUtcTime(
-    ServerContext *context, const ::cv2xStub::CoarseUtcTime *request,
+grpc::Status Cv2xManagerServerImpl::injectCoarseUtcTime(const ::cv2xStub::CoarseUtcTime *request,
     ::cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__, " utc: ", request->utc());
   Cv2xServerUtil::apiJsonReader(CV2X_MGR_API_JSON, CV2X_MGR_NODE,
@@ -465,8 +457,7 @@ grpc::Status Cv2xManagerServerImpl::injectCoarseUtcTime(
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xManagerServerImpl::requestCv2xStatus(
-    ServerContext *context, const google::protobuf::Empty *request,
+grpc::Status Cv2xManagerServerImpl::requestCv2xStatus(const google::protobuf::Empty *request,
     ::cv2xStub::Cv2xRequestStatusReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(CV2X_MGR_API_JSON, CV2X_MGR_NODE,
@@ -480,10 +471,8 @@ grpc::Status Cv2xManagerServerImpl::requestCv2xStatus(
   return grpc::Status::OK;
 }
 
-grpc::Status
-Cv2xManagerServerImpl::getSlssRxInfo(ServerContext *context,
-                                     const google::protobuf::Empty *request,
-                                     ::cv2xStub::SlssRxInfoReply *res) {
+grpc::Status Cv2xManagerServerImpl::getSlssRxInfo(const google::protobuf::Empty *request,
+    ::cv2xStub::SlssRxInfoReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(CV2X_MGR_API_JSON, CV2X_MGR_NODE,
                                 "getSlssRxInfo", res);
@@ -510,22 +499,76 @@ Cv2xManagerServerImpl::getSlssRxInfo(ServerContext *context,
   return grpc::Status::OK;
 }
 
-grpc::Status
-Cv2xManagerServerImpl::setL2Filters(ServerContext *context,
-                                    const ::cv2xStub::L2FilterInfos *request,
-                                    ::cv2xStub::Cv2xCommandReply *res) {
+grpc::Status Cv2xManagerServerImpl::setL2Filters(const ::cv2xStub::L2FilterInfos *request,
+    ::cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(CV2X_MGR_API_JSON, CV2X_MGR_NODE,
                                 "setL2Filters", res);
   return grpc::Status::OK;
 }
 
-grpc::Status
-Cv2xManagerServerImpl::removeL2Filters(ServerContext *context,
-                                       const ::cv2xStub::L2Ids *request,
-                                       ::cv2xStub::Cv2xCommandReply *res) {
+grpc::Status Cv2xManagerServerImpl::removeL2Filters(const ::cv2xStub::L2Ids *request,
+    ::cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(CV2X_MGR_API_JSON, CV2X_MGR_NODE,
                                 "removeL2Filters", res);
   return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* Cv2xManagerServerImpl::initService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, cv2xStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return initService(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xManagerServerImpl::startCv2x(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return startCv2x(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xManagerServerImpl::stopCv2x(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return stopCv2x(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xManagerServerImpl::setPeakTxPower(
+    grpc::CallbackServerContext* context, const cv2xStub::Cv2xPeakTxPower* request,
+    ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setPeakTxPower(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xManagerServerImpl::requestCv2xStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    ::cv2xStub::Cv2xRequestStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return requestCv2xStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xManagerServerImpl::injectCoarseUtcTime(
+    grpc::CallbackServerContext* context, const ::cv2xStub::CoarseUtcTime* request,
+    ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return injectCoarseUtcTime(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xManagerServerImpl::getSlssRxInfo(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, ::cv2xStub::SlssRxInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return getSlssRxInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xManagerServerImpl::setL2Filters(grpc::CallbackServerContext* context,
+    const ::cv2xStub::L2FilterInfos* request, ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setL2Filters(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xManagerServerImpl::removeL2Filters(
+    grpc::CallbackServerContext* context, const ::cv2xStub::L2Ids* request,
+    ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return removeL2Filters(request, response); });
+}
@@ -33,39 +33,49 @@ using grpc::Status;
 using cv2xStub::Cv2xManagerService;
 
 class Cv2xManagerServerImpl final
-    : public cv2xStub::Cv2xManagerService::Service {
+    : public cv2xStub::Cv2xManagerService::CallbackService {
 public:
   Cv2xManagerServerImpl();
   ~Cv2xManagerServerImpl();
-  grpc::Status initService(ServerContext *context,
-                           const google::protobuf::Empty *request,
-                           cv2xStub::GetServiceStatusReply *res);
-  grpc::Status startCv2x(ServerContext *context,
-                         const google::protobuf::Empty *request,
-                         cv2xStub::Cv2xCommandReply *res);
-  grpc::Status stopCv2x(ServerContext *context,
-                        const google::protobuf::Empty *request,
-                        cv2xStub::Cv2xCommandReply *res);
-  grpc::Status setPeakTxPower(ServerContext *context,
-                              const cv2xStub::Cv2xPeakTxPower *request,
-                              ::cv2xStub::Cv2xCommandReply *res);
-  grpc::Status requestCv2xStatus(ServerContext *context,
-                                 const google::protobuf::Empty *request,
-                                 ::cv2xStub::Cv2xRequestStatusReply *res);
-  grpc::Status injectCoarseUtcTime(ServerContext *context,
-                                   const ::cv2xStub::CoarseUtcTime *request,
-                                   ::cv2xStub::Cv2xCommandReply *res);
-  grpc::Status getSlssRxInfo(ServerContext *context,
-                             const google::protobuf::Empty *request,
-                             ::cv2xStub::SlssRxInfoReply *res);
-  grpc::Status setL2Filters(ServerContext *context,
-                            const ::cv2xStub::L2FilterInfos *request,
-                            ::cv2xStub::Cv2xCommandReply *res);
-  grpc::Status removeL2Filters(ServerContext *context,
-                               const ::cv2xStub::L2Ids *request,
-                               ::cv2xStub::Cv2xCommandReply *res);
+  grpc::ServerUnaryReactor* initService(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, cv2xStub::GetServiceStatusReply* response) override;
+  grpc::ServerUnaryReactor* startCv2x(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* stopCv2x(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* setPeakTxPower(grpc::CallbackServerContext* context,
+      const cv2xStub::Cv2xPeakTxPower* request, ::cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* requestCv2xStatus(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request,
+      ::cv2xStub::Cv2xRequestStatusReply* response) override;
+  grpc::ServerUnaryReactor* injectCoarseUtcTime(grpc::CallbackServerContext* context,
+      const ::cv2xStub::CoarseUtcTime* request, ::cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* getSlssRxInfo(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, ::cv2xStub::SlssRxInfoReply* response) override;
+  grpc::ServerUnaryReactor* setL2Filters(grpc::CallbackServerContext* context,
+      const ::cv2xStub::L2FilterInfos* request, ::cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* removeL2Filters(grpc::CallbackServerContext* context,
+      const ::cv2xStub::L2Ids* request, ::cv2xStub::Cv2xCommandReply* response) override;
 
 private:
+  /* Handlers of the RPCs, run on the RPC executor */
+  grpc::Status initService(const google::protobuf::Empty* request,
+      cv2xStub::GetServiceStatusReply* res);
+  grpc::Status startCv2x(const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* res);
+  grpc::Status stopCv2x(const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* res);
+  grpc::Status setPeakTxPower(const cv2xStub::Cv2xPeakTxPower* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+  grpc::Status requestCv2xStatus(const google::protobuf::Empty* request,
+      ::cv2xStub::Cv2xRequestStatusReply* res);
+  grpc::Status injectCoarseUtcTime(const ::cv2xStub::CoarseUtcTime* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+  grpc::Status getSlssRxInfo(const google::protobuf::Empty* request,
+      ::cv2xStub::SlssRxInfoReply* res);
+  grpc::Status setL2Filters(const ::cv2xStub::L2FilterInfos* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+  grpc::Status removeL2Filters(const ::cv2xStub::L2Ids* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+
   std::shared_ptr<Cv2xServerEvtListener> evtListener_ = nullptr;
 };
 
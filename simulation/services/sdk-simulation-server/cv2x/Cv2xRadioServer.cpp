@@ -11,6 +11,7 @@
 #include "libs/common/CommonUtils.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/Logger.hpp"
+#include "common/RpcExecutor.hpp"
 
 Cv2xRadioServer::Cv2xRadioServer() {
   LOG(DEBUG, __FUNCTION__);
@@ -53,8 +54,7 @@ void Cv2xRadioServer::onStatusChanged(
   }
 }
 
-grpc::Status Cv2xRadioServer::requestCv2xStatus(
-    ServerContext *context, const google::protobuf::Empty *request,
+grpc::Status Cv2xRadioServer::requestCv2xStatus(const google::protobuf::Empty *request,
     ::cv2xStub::Cv2xRequestStatusReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(RADIO_API_JSON, RADIO_ROOT, "requestCv2xStatus",
@@ -66,8 +66,7 @@ grpc::Status Cv2xRadioServer::requestCv2xStatus(
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::addRxSubscription(
-    ServerContext *context, const cv2xStub::RxSubscription *request,
+grpc::Status Cv2xRadioServer::addRxSubscription(const cv2xStub::RxSubscription *request,
     cv2xStub::Cv2xCommandReply *res) {
   bool conflict = false;
 
@@ -140,8 +139,7 @@ grpc::Status Cv2xRadioServer::addRxSubscription(
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::delRxSubscription(
-    ServerContext *context, const cv2xStub::RxSubscription *request,
+grpc::Status Cv2xRadioServer::delRxSubscription(const cv2xStub::RxSubscription *request,
     cv2xStub::Cv2xCommandReply *res) {
   LOG(ERROR, __FUNCTION__);
   bool success = false;
@@ -185,8 +183,7 @@ grpc::Status Cv2xRadioServer::delRxSubscription(
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::enableRxMetaDataReport(
-    ServerContext *context, const cv2xStub::RxSubscription *request,
+grpc::Status Cv2xRadioServer::enableRxMetaDataReport(const cv2xStub::RxSubscription *request,
     cv2xStub::Cv2xCommandReply *res) {
   Cv2xServerUtil::apiJsonReader(RADIO_API_JSON, RADIO_ROOT,
                                 "enableRxMetaDataReport", res);
@@ -221,10 +218,8 @@ grpc::Status Cv2xRadioServer::enableRxMetaDataReport(
   return ::commonStub::Status::FAILED;
 }
 
-grpc::Status
-Cv2xRadioServer::registerFlow(ServerContext *context,
-                                        const cv2xStub::FlowInfo *request,
-                                        cv2xStub::Cv2xRadioFlowReply *res) {
+grpc::Status Cv2xRadioServer::registerFlow(const cv2xStub::FlowInfo *request,
+    cv2xStub::Cv2xRadioFlowReply *res) {
   int32_t id = -1;
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(RADIO_API_JSON, RADIO_ROOT, "registerFlow",
@@ -256,10 +251,8 @@ Cv2xRadioServer::registerFlow(ServerContext *context,
   return grpc::Status::OK;
 }
 
-grpc::Status
-Cv2xRadioServer::deregisterFlow(ServerContext *context,
-                                          const cv2xStub::FlowInfo *request,
-                                          cv2xStub::Cv2xRadioFlowReply *res) {
+grpc::Status Cv2xRadioServer::deregisterFlow(const cv2xStub::FlowInfo *request,
+    cv2xStub::Cv2xRadioFlowReply *res) {
   int32_t id = request->flowid();
   LOG(DEBUG, __FUNCTION__, " with flow id ", id);
   Cv2xServerUtil::apiJsonReader(RADIO_API_JSON, RADIO_ROOT, "deregisterFlow",
@@ -286,8 +279,7 @@ Cv2xRadioServer::deregisterFlow(ServerContext *context,
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::updateSrcL2Info(
-    ServerContext *context, const google::protobuf::Empty *request,
+grpc::Status Cv2xRadioServer::updateSrcL2Info(const google::protobuf::Empty *request,
     cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(RADIO_API_JSON, RADIO_ROOT, "updateSrcL2Info",
@@ -306,8 +298,7 @@ grpc::Status Cv2xRadioServer::updateSrcL2Info(
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::updateTrustedUEList(
-    ServerContext *context, const google::protobuf::Empty *request,
+grpc::Status Cv2xRadioServer::updateTrustedUEList(const google::protobuf::Empty *request,
     cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__);
   Cv2xServerUtil::apiJsonReader(RADIO_API_JSON, RADIO_ROOT,
@@ -316,8 +307,7 @@ grpc::Status Cv2xRadioServer::updateTrustedUEList(
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::getIfaceNameFromIpType(
-    ServerContext *context, const cv2xStub::IpType *request,
+grpc::Status Cv2xRadioServer::getIfaceNameFromIpType(const cv2xStub::IpType *request,
     cv2xStub::IfaceNameReply *res) {
   LOG(DEBUG, __FUNCTION__);
 
@@ -337,8 +327,7 @@ grpc::Status Cv2xRadioServer::getIfaceNameFromIpType(
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::enableTxStatusReport(
-    ServerContext *context, const cv2xStub::UintNum *request,
+grpc::Status Cv2xRadioServer::enableTxStatusReport(const cv2xStub::UintNum *request,
     cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__);
 
@@ -362,8 +351,7 @@ grpc::Status Cv2xRadioServer::enableTxStatusReport(
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::disableTxStatusReport(
-    ServerContext *context, const cv2xStub::UintNum *request,
+grpc::Status Cv2xRadioServer::disableTxStatusReport(const cv2xStub::UintNum *request,
     cv2xStub::Cv2xCommandReply *res) {
 
   auto port = request->num();
@@ -387,8 +375,8 @@ grpc::Status Cv2xRadioServer::disableTxStatusReport(
   return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::setGlobalIPInfo(ServerContext *context,
-    const google::protobuf::Empty *request, ::cv2xStub::Cv2xCommandReply *res) {
+grpc::Status Cv2xRadioServer::setGlobalIPInfo(const google::protobuf::Empty *request,
+    ::cv2xStub::Cv2xCommandReply *res) {
     LOG(DEBUG, __FUNCTION__);
     Cv2xServerUtil::apiJsonReader(RADIO_API_JSON, RADIO_ROOT, "setGlobalIPInfo",
         res);
@@ -396,8 +384,8 @@ grpc::Status Cv2xRadioServer::setGlobalIPInfo(ServerContext *context,
     return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::setGlobalIPUnicastRoutingInfo(ServerContext *context,
-    const google::protobuf::Empty *request, ::cv2xStub::Cv2xCommandReply *res) {
+grpc::Status Cv2xRadioServer::setGlobalIPUnicastRoutingInfo(const google::protobuf::Empty *request,
+    ::cv2xStub::Cv2xCommandReply *res) {
     LOG(DEBUG, __FUNCTION__);
     Cv2xServerUtil::apiJsonReader(RADIO_API_JSON, RADIO_ROOT, "setGlobalIPUnicastRoutingInfo",
         res);
@@ -405,8 +393,8 @@ grpc::Status Cv2xRadioServer::setGlobalIPUnicastRoutingInfo(ServerContext *conte
     return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::requestDataSessionSettings(ServerContext *context,
-    const google::protobuf::Empty *request, ::cv2xStub::Cv2xCommandReply *res) {
+grpc::Status Cv2xRadioServer::requestDataSessionSettings(const google::protobuf::Empty *request,
+    ::cv2xStub::Cv2xCommandReply *res) {
     LOG(DEBUG, __FUNCTION__);
     Cv2xServerUtil::apiJsonReader(RADIO_API_JSON, RADIO_ROOT, "requestDataSessionSettings",
         res);
@@ -414,8 +402,7 @@ grpc::Status Cv2xRadioServer::requestDataSessionSettings(ServerContext *context,
     return grpc::Status::OK;
 }
 
-grpc::Status Cv2xRadioServer::injectVehicleSpeed(ServerContext *context,
-    const cv2xStub::UintNum *request,
+grpc::Status Cv2xRadioServer::injectVehicleSpeed(const cv2xStub::UintNum *request,
     cv2xStub::Cv2xCommandReply *res) {
     uint32_t speed = request->num();
     LOG(DEBUG, __FUNCTION__, " speed ", speed);
@@ -425,3 +412,99 @@ grpc::Status Cv2xRadioServer::injectVehicleSpeed(ServerContext *context,
 
     return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::requestCv2xStatus(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, ::cv2xStub::Cv2xRequestStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return requestCv2xStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::addRxSubscription(grpc::CallbackServerContext* context,
+    const cv2xStub::RxSubscription* request, cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return addRxSubscription(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::delRxSubscription(grpc::CallbackServerContext* context,
+    const cv2xStub::RxSubscription* request, cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return delRxSubscription(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::enableRxMetaDataReport(
+    grpc::CallbackServerContext* context, const cv2xStub::RxSubscription* request,
+    cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return enableRxMetaDataReport(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::registerFlow(grpc::CallbackServerContext* context,
+    const cv2xStub::FlowInfo* request, cv2xStub::Cv2xRadioFlowReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return registerFlow(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::deregisterFlow(grpc::CallbackServerContext* context,
+    const cv2xStub::FlowInfo* request, cv2xStub::Cv2xRadioFlowReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return deregisterFlow(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::updateSrcL2Info(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return updateSrcL2Info(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::updateTrustedUEList(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return updateTrustedUEList(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::getIfaceNameFromIpType(
+    grpc::CallbackServerContext* context, const cv2xStub::IpType* request,
+    cv2xStub::IfaceNameReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return getIfaceNameFromIpType(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::enableTxStatusReport(
+    grpc::CallbackServerContext* context, const cv2xStub::UintNum* request,
+    cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return enableTxStatusReport(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::disableTxStatusReport(
+    grpc::CallbackServerContext* context, const cv2xStub::UintNum* request,
+    cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return disableTxStatusReport(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::setGlobalIPInfo(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setGlobalIPInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::setGlobalIPUnicastRoutingInfo(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setGlobalIPUnicastRoutingInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::requestDataSessionSettings(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return requestDataSessionSettings(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xRadioServer::injectVehicleSpeed(grpc::CallbackServerContext* context,
+    const cv2xStub::UintNum* request, cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return injectVehicleSpeed(request, response); });
+}
@@ -39,60 +39,77 @@ using grpc::Status;
 using cv2xStub::Cv2xRadioService;
 
 class Cv2xRadioServer final
-    : public cv2xStub::Cv2xRadioService::Service,
+    : public cv2xStub::Cv2xRadioService::CallbackService,
       public telux::cv2x::ICv2xListener {
 public:
   Cv2xRadioServer();
   ~Cv2xRadioServer();
   void init(std::weak_ptr<telux::cv2x::ICv2xListener> self);
-  grpc::Status requestCv2xStatus(ServerContext *context,
-                                 const google::protobuf::Empty *request,
-                                 ::cv2xStub::Cv2xRequestStatusReply *res);
-  grpc::Status addRxSubscription(ServerContext *context,
-                                 const cv2xStub::RxSubscription *request,
-                                 cv2xStub::Cv2xCommandReply *res);
-  grpc::Status delRxSubscription(ServerContext *context,
-                                 const cv2xStub::RxSubscription *request,
-                                 cv2xStub::Cv2xCommandReply *res);
-  grpc::Status enableRxMetaDataReport(ServerContext *context,
-                                      const cv2xStub::RxSubscription *request,
-                                      cv2xStub::Cv2xCommandReply *res);
-  grpc::Status registerFlow(ServerContext *context,
-                            const cv2xStub::FlowInfo *request,
-                            cv2xStub::Cv2xRadioFlowReply *res);
-  grpc::Status deregisterFlow(ServerContext *context,
-                              const cv2xStub::FlowInfo *request,
-                              cv2xStub::Cv2xRadioFlowReply *res);
-  grpc::Status updateSrcL2Info(ServerContext *context,
-                               const google::protobuf::Empty *request,
-                               cv2xStub::Cv2xCommandReply *res);
-  grpc::Status updateTrustedUEList(ServerContext *context,
-                                   const google::protobuf::Empty *request,
-                                   cv2xStub::Cv2xCommandReply *res);
-  grpc::Status getIfaceNameFromIpType(ServerContext *context,
-                                      const cv2xStub::IpType *request,
-                                      cv2xStub::IfaceNameReply *res);
-  grpc::Status enableTxStatusReport(ServerContext *context,
-                                    const cv2xStub::UintNum *request,
-                                    cv2xStub::Cv2xCommandReply *res);
-  grpc::Status disableTxStatusReport(ServerContext *context,
-                                     const cv2xStub::UintNum *request,
-                                     cv2xStub::Cv2xCommandReply *res);
-  grpc::Status setGlobalIPInfo(ServerContext *context,
-                               const google::protobuf::Empty *request,
-                               ::cv2xStub::Cv2xCommandReply *res);
-  grpc::Status setGlobalIPUnicastRoutingInfo(ServerContext *context,
-                                             const google::protobuf::Empty *request,
-                                             ::cv2xStub::Cv2xCommandReply *res);
-  grpc::Status requestDataSessionSettings(ServerContext *context,
-                                          const google::protobuf::Empty *request,
-                                          ::cv2xStub::Cv2xCommandReply *res);
-  grpc::Status injectVehicleSpeed(ServerContext *context,
-                                  const cv2xStub::UintNum *request,
-                                  cv2xStub::Cv2xCommandReply *res);
+  grpc::ServerUnaryReactor* requestCv2xStatus(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request,
+      ::cv2xStub::Cv2xRequestStatusReply* response) override;
+  grpc::ServerUnaryReactor* addRxSubscription(grpc::CallbackServerContext* context,
+      const cv2xStub::RxSubscription* request, cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* delRxSubscription(grpc::CallbackServerContext* context,
+      const cv2xStub::RxSubscription* request, cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* enableRxMetaDataReport(grpc::CallbackServerContext* context,
+      const cv2xStub::RxSubscription* request, cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* registerFlow(grpc::CallbackServerContext* context,
+      const cv2xStub::FlowInfo* request, cv2xStub::Cv2xRadioFlowReply* response) override;
+  grpc::ServerUnaryReactor* deregisterFlow(grpc::CallbackServerContext* context,
+      const cv2xStub::FlowInfo* request, cv2xStub::Cv2xRadioFlowReply* response) override;
+  grpc::ServerUnaryReactor* updateSrcL2Info(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* updateTrustedUEList(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* getIfaceNameFromIpType(grpc::CallbackServerContext* context,
+      const cv2xStub::IpType* request, cv2xStub::IfaceNameReply* response) override;
+  grpc::ServerUnaryReactor* enableTxStatusReport(grpc::CallbackServerContext* context,
+      const cv2xStub::UintNum* request, cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* disableTxStatusReport(grpc::CallbackServerContext* context,
+      const cv2xStub::UintNum* request, cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* setGlobalIPInfo(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, ::cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* setGlobalIPUnicastRoutingInfo(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, ::cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* requestDataSessionSettings(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, ::cv2xStub::Cv2xCommandReply* response) override;
+  grpc::ServerUnaryReactor* injectVehicleSpeed(grpc::CallbackServerContext* context,
+      const cv2xStub::UintNum* request, cv2xStub::Cv2xCommandReply* response) override;
 
 
 private:
+  /* Handlers of the RPCs, run on the RPC executor */
+  grpc::Status requestCv2xStatus(const google::protobuf::Empty* request,
+      ::cv2xStub::Cv2xRequestStatusReply* res);
+  grpc::Status addRxSubscription(const cv2xStub::RxSubscription* request,
+      cv2xStub::Cv2xCommandReply* res);
+  grpc::Status delRxSubscription(const cv2xStub::RxSubscription* request,
+      cv2xStub::Cv2xCommandReply* res);
+  grpc::Status enableRxMetaDataReport(const cv2xStub::RxSubscription* request,
+      cv2xStub::Cv2xCommandReply* res);
+  grpc::Status registerFlow(const cv2xStub::FlowInfo* request, cv2xStub::Cv2xRadioFlowReply* res);
+  grpc::Status deregisterFlow(const cv2xStub::FlowInfo* request,
+      cv2xStub::Cv2xRadioFlowReply* res);
+  grpc::Status updateSrcL2Info(const google::protobuf::Empty* request,
+      cv2xStub::Cv2xCommandReply* res);
+  grpc::Status updateTrustedUEList(const google::protobuf::Empty* request,
+      cv2xStub::Cv2xCommandReply* res);
+  grpc::Status getIfaceNameFromIpType(const cv2xStub::IpType* request,
+      cv2xStub::IfaceNameReply* res);
+  grpc::Status enableTxStatusReport(const cv2xStub::UintNum* request,
+      cv2xStub::Cv2xCommandReply* res);
+  grpc::Status disableTxStatusReport(const cv2xStub::UintNum* request,
+      cv2xStub::Cv2xCommandReply* res);
+  grpc::Status setGlobalIPInfo(const google::protobuf::Empty* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+  grpc::Status setGlobalIPUnicastRoutingInfo(const google::protobuf::Empty* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+  grpc::Status requestDataSessionSettings(const google::protobuf::Empty* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+  grpc::Status injectVehicleSpeed(const cv2xStub::UintNum* request,
+      cv2xStub::Cv2xCommandReply* res);
+
   void onStatusChanged(telux::cv2x::Cv2xStatus status) override;
   inline ::commonStub::Status
   saveFlowInfo(std::map<uint32_t, cv2xStub::FlowInfo> &flows,
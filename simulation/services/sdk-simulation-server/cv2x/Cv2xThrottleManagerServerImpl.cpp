@@ -18,6 +18,7 @@
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/Logger.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define DEFAULT_DELIMITER " "
 
@@ -36,10 +37,8 @@ Cv2xThrottleManagerServerImpl::~Cv2xThrottleManagerServerImpl() {
   LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status
-Cv2xThrottleManagerServerImpl::initService(ServerContext *context,
-                                           const google::protobuf::Empty *request,
-                                           cv2xStub::GetServiceStatusReply *res) {
+grpc::Status Cv2xThrottleManagerServerImpl::initService(const google::protobuf::Empty *request,
+    cv2xStub::GetServiceStatusReply *res) {
   LOG(DEBUG, __FUNCTION__);
   int cbDelay = 100;
   Json::Value rootNode;
@@ -64,10 +63,8 @@ Cv2xThrottleManagerServerImpl::initService(ServerContext *context,
   return grpc::Status::OK;
 }
 
-grpc::Status
-Cv2xThrottleManagerServerImpl::getServiceStatus(ServerContext *context,
-                                                const google::protobuf::Empty *request,
-                                                cv2xStub::GetServiceStatusReply *res) {
+grpc::Status Cv2xThrottleManagerServerImpl::getServiceStatus(const google::protobuf::Empty *request,
+    cv2xStub::GetServiceStatusReply *res) {
   LOG(DEBUG, __FUNCTION__);
   int cbDelay = 100;
 
@@ -76,10 +73,8 @@ Cv2xThrottleManagerServerImpl::getServiceStatus(ServerContext *context,
   return grpc::Status::OK;
 }
 
-grpc::Status
-Cv2xThrottleManagerServerImpl::setVerificationLoad(ServerContext *context,
-                                                   const cv2xStub::UintNum *request,
-                                                   cv2xStub::Cv2xCommandReply *res) {
+grpc::Status Cv2xThrottleManagerServerImpl::setVerificationLoad(const cv2xStub::UintNum *request,
+    cv2xStub::Cv2xCommandReply *res) {
   LOG(DEBUG, __FUNCTION__);
 
   Cv2xServerUtil::apiJsonReader(CV2X_THROTTLE_MGR_API_JSON,
@@ -146,3 +141,24 @@ void Cv2xThrottleManagerServerImpl::handleSanityUpdateEvent(std::string event){
     }).share();
     taskQ_->add(f);
 }
+
+grpc::ServerUnaryReactor* Cv2xThrottleManagerServerImpl::initService(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    cv2xStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return initService(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xThrottleManagerServerImpl::getServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    cv2xStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return getServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* Cv2xThrottleManagerServerImpl::setVerificationLoad(
+    grpc::CallbackServerContext* context, const cv2xStub::UintNum* request,
+    ::cv2xStub::Cv2xCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setVerificationLoad(request, response); });
+}
@@ -35,26 +35,31 @@ using grpc::Status;
 using cv2xStub::Cv2xThrottleManagerService;
 
 class Cv2xThrottleManagerServerImpl final
-    : public cv2xStub::Cv2xThrottleManagerService::Service,
+    : public cv2xStub::Cv2xThrottleManagerService::CallbackService,
       public IServerEventListener,
       public std::enable_shared_from_this<Cv2xThrottleManagerServerImpl> {
 public:
   Cv2xThrottleManagerServerImpl();
   ~Cv2xThrottleManagerServerImpl();
-  grpc::Status initService(ServerContext *context,
-                           const google::protobuf::Empty *request,
-                           cv2xStub::GetServiceStatusReply *res);
+  grpc::ServerUnaryReactor* initService(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, cv2xStub::GetServiceStatusReply* response) override;
 
-  grpc::Status getServiceStatus(ServerContext *context,
-                                const google::protobuf::Empty *request,
-                                cv2xStub::GetServiceStatusReply *res);
+  grpc::ServerUnaryReactor* getServiceStatus(grpc::CallbackServerContext* context,
+      const google::protobuf::Empty* request, cv2xStub::GetServiceStatusReply* response) override;
 
-  grpc::Status setVerificationLoad(ServerContext *context,
-                                   const cv2xStub::UintNum *request,
-                                   ::cv2xStub::Cv2xCommandReply *res);
+  grpc::ServerUnaryReactor* setVerificationLoad(grpc::CallbackServerContext* context,
+      const cv2xStub::UintNum* request, ::cv2xStub::Cv2xCommandReply* response) override;
   void onEventUpdate(::eventService::UnsolicitedEvent event) override;
 
 private:
+  /* Handlers of the RPCs, run on the RPC executor */
+  grpc::Status initService(const google::protobuf::Empty* request,
+      cv2xStub::GetServiceStatusReply* res);
+  grpc::Status getServiceStatus(const google::protobuf::Empty* request,
+      cv2xStub::GetServiceStatusReply* res);
+  grpc::Status setVerificationLoad(const cv2xStub::UintNum* request,
+      ::cv2xStub::Cv2xCommandReply* res);
+
   void onEventUpdate(std::string event);
   void handleEvent(std::string token, std::string event);
   void handleFilterUpdateEvent(std::string event);
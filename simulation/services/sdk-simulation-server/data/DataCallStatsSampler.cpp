@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "DataCallStatsSampler.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include "libs/common/Logger.hpp"
+#include "libs/common/SimulationConfigParser.hpp"
+
+#define PROC_NET_DEV "/proc/net/dev"
+#define PROC_NET_DEV_HEADER_LINES 2
+
+using telux::common::ErrorCode;
+
+DataCallStatsSampler::DataCallStatsSampler()
+   : periodMs_(DEFAULT_PERIOD_MS)
+   , timerService_(telux::common::TimerService::getInstance())
+   , timerId_(telux::common::TimerService::INVALID_TIMER_ID) {
+    LOG(DEBUG, __FUNCTION__);
+    SimulationConfigParser config;
+    std::string period = config.getValue("sim.data.stats_sampling_period_ms");
+    if (!period.empty()) {
+        try {
+            periodMs_ = std::stoi(period);
+        } catch (const std::exception &e) {
+            LOG(ERROR, __FUNCTION__, " Invalid sampling period ", period);
+        }
+    }
+    if (periodMs_ <= 0) {
+        periodMs_ = DEFAULT_PERIOD_MS;
+    }
+}
+
+DataCallStatsSampler::~DataCallStatsSampler() {
+    LOG(DEBUG, __FUNCTION__);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (timerId_ != telux::common::TimerService::INVALID_TIMER_ID) {
+        timerService_->cancel(timerId_);
+    }
+}
+
+bool DataCallStatsSampler::readCounters(std::unordered_map<std::string, Counters> &counters) {
+    std::ifstream ifs(PROC_NET_DEV);
+    if (!ifs.is_open()) {
+        LOG(ERROR, __FUNCTION__, " failed to open ", PROC_NET_DEV);
+        return false;
+    }
+    std::string line;
+    for (int idx = 0; idx < PROC_NET_DEV_HEADER_LINES; idx++) {
+        std::getline(ifs, line);
+    }
+    // <iface>: rx bytes packets errs drop fifo frame compressed multicast
+    //          tx bytes packets errs drop ...
+    while (std::getline(ifs, line)) {
+        size_t pos = line.find(':');
+        if (pos == std::string::npos) {
+            continue;
+        }
+        std::string name = line.substr(0, pos);
+        name.erase(0, name.find_first_not_of(' '));
+        std::istringstream iss(line.substr(pos + 1));
+        uint64_t values[12];
+        int count = 0;
+        while ((count < 12) && (iss >> values[count])) {
+            count++;
+        }
+        if (count < 12) {
+            continue;
+        }
+        Counters &ifaceCounters = counters[name];
+        ifaceCounters.bytesRx = values[0];
+        ifaceCounters.packetsRx = values[1];
+        ifaceCounters.packetsDroppedRx = values[3];
+        ifaceCounters.bytesTx = values[8];
+        ifaceCounters.packetsTx = values[9];
+        ifaceCounters.packetsDroppedTx = values[11];
+    }
+    return true;
+}
+
+bool DataCallStatsSampler::readCounters(const std::string &ifaceName, Counters &counters) {
+    std::unordered_map<std::string, Counters> all;
+    if (!readCounters(all)) {
+        return false;
+    }
+    auto it = all.find(ifaceName);
+    if (it == all.end()) {
+        LOG(ERROR, __FUNCTION__, " no counters for ", ifaceName);
+        return false;
+    }
+    counters = it->second;
+    return true;
+}
+
+uint64_t DataCallStatsSampler::getDelta(uint64_t current, uint64_t baseline) {
+    // The counters restart from zero when the interface is recreated
+    return (current >= baseline) ? (current - baseline) : current;
+}
+
+void DataCallStatsSampler::addCall(int slotId, int profileId, const std::string &ifaceName) {
+    LOG(DEBUG, __FUNCTION__, " slotId::", slotId, " profileId::", profileId, " iface::",
+        ifaceName);
+    Call call;
+    call.ifaceName = ifaceName;
+    readCounters(ifaceName, call.baseline);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    calls_[CallKey(slotId, profileId)] = call;
+    Sample &sample = samples_[ifaceName];
+    if (!sample.isValid) {
+        sample.counters = call.baseline;
+        sample.time = std::chrono::steady_clock::now();
+        sample.isValid = true;
+    }
+    scheduleSampleLocked();
+}
+
+void DataCallStatsSampler::removeCall(int slotId, int profileId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = calls_.find(CallKey(slotId, profileId));
+    if (it == calls_.end()) {
+        return;
+    }
+    LOG(DEBUG, __FUNCTION__, " slotId::", slotId, " profileId::", profileId);
+    std::string ifaceName = it->second.ifaceName;
+    calls_.erase(it);
+    for (auto &call : calls_) {
+        if (call.second.ifaceName == ifaceName) {
+            return;
+        }
+    }
+    samples_.erase(ifaceName);
+    // Sampling stops by itself once no call is left
+}
+
+ErrorCode DataCallStatsSampler::getStats(int slotId, int profileId, Stats &stats) {
+    std::string ifaceName;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = calls_.find(CallKey(slotId, profileId));
+        if (it == calls_.end()) {
+            LOG(ERROR, __FUNCTION__, " no data call for slotId::", slotId, " profileId::",
+                profileId);
+            return ErrorCode::INVALID_ARGUMENTS;
+        }
+        ifaceName = it->second.ifaceName;
+    }
+    Counters current;
+    if (!readCounters(ifaceName, current)) {
+        return ErrorCode::INTERNAL;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = calls_.find(CallKey(slotId, profileId));
+    if (it == calls_.end()) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    const Counters &baseline = it->second.baseline;
+    stats.counters.bytesRx = getDelta(current.bytesRx, baseline.bytesRx);
+    stats.counters.packetsRx = getDelta(current.packetsRx, baseline.packetsRx);
+    stats.counters.packetsDroppedRx =
+        getDelta(current.packetsDroppedRx, baseline.packetsDroppedRx);
+    stats.counters.bytesTx = getDelta(current.bytesTx, baseline.bytesTx);
+    stats.counters.packetsTx = getDelta(current.packetsTx, baseline.packetsTx);
+    stats.counters.packetsDroppedTx =
+        getDelta(current.packetsDroppedTx, baseline.packetsDroppedTx);
+    auto sample = samples_.find(ifaceName);
+    if (sample != samples_.end()) {
+        stats.txRate = sample->second.txRate;
+        stats.rxRate = sample->second.rxRate;
+    }
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode DataCallStatsSampler::reset(int slotId, int profileId) {
+    std::string ifaceName;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = calls_.find(CallKey(slotId, profileId));
+        if (it == calls_.end()) {
+            return ErrorCode::INVALID_ARGUMENTS;
+        }
+        ifaceName = it->second.ifaceName;
+    }
+    Counters current;
+    if (!readCounters(ifaceName, current)) {
+        return ErrorCode::INTERNAL;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = calls_.find(CallKey(slotId, profileId));
+    if (it == calls_.end()) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    LOG(DEBUG, __FUNCTION__, " slotId::", slotId, " profileId::", profileId);
+    it->second.baseline = current;
+    return ErrorCode::SUCCESS;
+}
+
+void DataCallStatsSampler::sample() {
+    std::unordered_map<std::string, Counters> counters;
+    bool isRead = readCounters(counters);
+    auto now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    timerId_ = telux::common::TimerService::INVALID_TIMER_ID;
+    if (isRead) {
+        for (auto &entry : samples_) {
+            auto current = counters.find(entry.first);
+            if (current == counters.end()) {
+                continue;
+            }
+            Sample &sample = entry.second;
+            uint64_t elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                now - sample.time).count();
+            if (elapsedMs == 0) {
+                continue;
+            }
+            sample.txRate = getDelta(current->second.bytesTx, sample.counters.bytesTx)
+                * 8 * 1000 / elapsedMs;
+            sample.rxRate = getDelta(current->second.bytesRx, sample.counters.bytesRx)
+                * 8 * 1000 / elapsedMs;
+            sample.counters = current->second;
+            sample.time = now;
+        }
+    }
+    scheduleSampleLocked();
+}
+
+void DataCallStatsSampler::scheduleSampleLocked() {
+    if (calls_.empty() || (timerId_ != telux::common::TimerService::INVALID_TIMER_ID)) {
+        return;
+    }
+    std::weak_ptr<DataCallStatsSampler> weakSelf = shared_from_this();
+    timerService_->runAfter(periodMs_, [weakSelf]() {
+        if (auto self = weakSelf.lock()) {
+            self->sample();
+        }
+    }, &timerId_);
+}
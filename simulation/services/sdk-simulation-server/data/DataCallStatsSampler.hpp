@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       DataCallStatsSampler.hpp
+ *
+ * @brief      DataCallStatsSampler reports the traffic statistics of the simulated data
+ *             calls from the counters of the host interface each call is mapped to.
+ *             The counters are read from /proc/net/dev. A baseline is kept per call so
+ *             that statistics start at zero when the call is brought up or reset.
+ *             While calls are up, the counters are sampled periodically to compute the
+ *             transmit and receive rates.
+ */
+
+#ifndef DATA_CALL_STATS_SAMPLER_HPP
+#define DATA_CALL_STATS_SAMPLER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <telux/common/CommonDefines.hpp>
+
+#include "libs/common/TimerService.hpp"
+
+class DataCallStatsSampler : public std::enable_shared_from_this<DataCallStatsSampler> {
+ public:
+    struct Counters {
+        uint64_t bytesRx = 0;
+        uint64_t packetsRx = 0;
+        uint64_t packetsDroppedRx = 0;
+        uint64_t bytesTx = 0;
+        uint64_t packetsTx = 0;
+        uint64_t packetsDroppedTx = 0;
+    };
+
+    struct Stats {
+        Counters counters;
+        /* Rates over the last sampling period in bits/sec */
+        uint64_t txRate = 0;
+        uint64_t rxRate = 0;
+    };
+
+    DataCallStatsSampler();
+    ~DataCallStatsSampler();
+
+    /**
+     * Starts reporting the statistics of a call, they are counted from now on.
+     */
+    void addCall(int slotId, int profileId, const std::string &ifaceName);
+
+    void removeCall(int slotId, int profileId);
+
+    /**
+     * Gets the statistics of a call since it was added or last reset.
+     *
+     * @returns INVALID_ARGUMENTS if the call isn't known, INTERNAL if the interface counters
+     *          can't be read
+     */
+    telux::common::ErrorCode getStats(int slotId, int profileId, Stats &stats);
+
+    telux::common::ErrorCode reset(int slotId, int profileId);
+
+ private:
+    static const int DEFAULT_PERIOD_MS = 1000;
+
+    using CallKey = std::pair<int, int>;
+
+    struct Call {
+        std::string ifaceName;
+        Counters baseline;
+    };
+
+    struct Sample {
+        Counters counters;
+        std::chrono::steady_clock::time_point time;
+        bool isValid = false;
+        uint64_t txRate = 0;
+        uint64_t rxRate = 0;
+    };
+
+    static bool readCounters(std::unordered_map<std::string, Counters> &counters);
+    static bool readCounters(const std::string &ifaceName, Counters &counters);
+    static uint64_t getDelta(uint64_t current, uint64_t baseline);
+
+    void sample();
+    void scheduleSampleLocked();
+
+    std::mutex mutex_;
+    std::map<CallKey, Call> calls_;
+    /* Last sample of each interface mapped to a call */
+    std::unordered_map<std::string, Sample> samples_;
+    int periodMs_;
+    std::shared_ptr<telux::common::TimerService> timerService_;
+    telux::common::TimerService::TimerId timerId_;
+};
+
+#endif  // DATA_CALL_STATS_SAMPLER_HPP
@@ -3,7 +3,6 @@
  *  SPDX-License-Identifier: BSD-3-Clause-Clear
  */
 
-#include <ifaddrs.h>
 #include <sys/types.h>
 #include <arpa/inet.h>
 #include <resolv.h>
@@ -13,9 +12,11 @@
 #include "SimulationServer.hpp"
 
 #include "libs/common/SimulationConfigParser.hpp"
+#include "libs/common/TimerService.hpp"
 #include "libs/data/DataUtilsStub.hpp"
 #include "event/EventService.hpp"
 #include "common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 
 
 #define DATA_CONNECTION_API_SLOT1_JSON "api/data/IDataConnectionManagerSlot1.json"
@@ -37,10 +38,17 @@ DataConnectionServerImpl::DataConnectionServerImpl() {
     LOG(DEBUG, __FUNCTION__);
     timerStarted_ = false;
     taskQ_ = std::make_shared<telux::common::AsyncTaskQueue<void>>();
+    statsSampler_ = std::make_shared<DataCallStatsSampler>();
+    ifaceAddrCache_ = std::unique_ptr<InterfaceAddressCache>(new InterfaceAddressCache(
+        [this](const std::set<std::string> &ifaceNames) {
+            onInterfaceAddressChange(ifaceNames);
+        }));
 }
 
 DataConnectionServerImpl::~DataConnectionServerImpl() {
     LOG(DEBUG, __FUNCTION__);
+    // Stops the address notifications before the datacalls go away
+    ifaceAddrCache_ = nullptr;
     taskQ_ = nullptr;
     timerStarted_ = false; // Stop the timer incase it is running
     if (timerFuture_.valid()) {
@@ -146,8 +154,8 @@ void DataConnectionServerImpl::handleThrottleApnEvent(std::string event) {
     }
 }
 
-grpc::Status DataConnectionServerImpl::InitService(ServerContext* context,
-    const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status DataConnectionServerImpl::InitService(const dataStub::SlotInfo* request,
+    dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootObj;
@@ -178,7 +186,7 @@ grpc::Status DataConnectionServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataConnectionServerImpl::SetDefaultProfile(ServerContext* context,
+grpc::Status DataConnectionServerImpl::SetDefaultProfile(
     const dataStub::SetDefaultProfileRequest* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -211,9 +219,8 @@ grpc::Status DataConnectionServerImpl::SetDefaultProfile(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataConnectionServerImpl::GetDefaultProfile(ServerContext* context,
-    const dataStub::GetDefaultProfileRequest* request,
-    dataStub::GetDefaultProfileReply* response) {
+grpc::Status DataConnectionServerImpl::GetDefaultProfile(
+    const dataStub::GetDefaultProfileRequest* request, dataStub::GetDefaultProfileReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_CONNECTION_API_SLOT2_JSON
@@ -250,9 +257,8 @@ grpc::Status DataConnectionServerImpl::GetDefaultProfile(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataConnectionServerImpl::SetRoamingMode(ServerContext* context,
-    const dataStub::SetRoamingModeRequest* request,
-    dataStub::DefaultReply* response) {
+grpc::Status DataConnectionServerImpl::SetRoamingMode(
+    const dataStub::SetRoamingModeRequest* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_CONNECTION_API_SLOT2_JSON
@@ -286,7 +292,7 @@ grpc::Status DataConnectionServerImpl::SetRoamingMode(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataConnectionServerImpl::RequestRoamingMode(ServerContext* context,
+grpc::Status DataConnectionServerImpl::RequestRoamingMode(
     const dataStub::RequestRoamingModeRequest* request,
     dataStub::RequestRoamingModeReply* response) {
 
@@ -347,152 +353,93 @@ bool DataConnectionServerImpl::getIpv4Address(const std::string &ifaceName,
     std::string &ipAddress, std::string &gatewayAddress,
     std::string &dnsPrimaryAddress, std::string &dnsSecondaryAddress) {
     LOG(DEBUG, __FUNCTION__);
-    bool ifaceFound = false;
-    struct ifaddrs *ifaceAddresses;
 
-    if(getifaddrs(&ifaceAddresses) < 0) {
-        LOG(DEBUG, __FUNCTION__, " failure in fetching n/w interfaces");
-        return ifaceFound;
+    if (!ifaceAddrCache_->getAddress(ifaceName, AF_INET, ipAddress)) {
+        LOG(DEBUG, __FUNCTION__, " no IPv4 address on interface:", ifaceName);
+        return false;
     }
-    struct ifaddrs *ifaddr;
-    //traversing thru all the available interfaces
-    for (ifaddr = ifaceAddresses; ifaddr != NULL; ifaddr=ifaddr->ifa_next) {
-        if ((ifaddr->ifa_addr != NULL) &&
-            (ifaddr->ifa_addr->sa_family == AF_INET)) {
-
-            std::string ifName(ifaddr->ifa_name);
-            //if type is v4 & iface name matches with user provided name
-            if (ifaceName == ifName) {
-                LOG(DEBUG, __FUNCTION__, " found interface:", ifaceName);
-
-                //fetching ip address
-                struct sockaddr_in* ipAddr =
-                    (struct sockaddr_in*)ifaddr->ifa_addr;
-                char ipAddrStr[INET_ADDRSTRLEN];
-                inet_ntop(AF_INET, &ipAddr->sin_addr,
-                    ipAddrStr, INET_ADDRSTRLEN);
-                ipAddress = ipAddrStr;
-
-                //fetching gw address
-                char gwAddrStr[INET_ADDRSTRLEN];
-                std::string command = "route -n | grep 'UG[ \t]' | awk '{print $2}'";
-                FILE* fp = popen(command.c_str(), "r");
-
-                if(fgets(gwAddrStr, INET_ADDRSTRLEN, fp) != NULL) {
-                    gatewayAddress = gwAddrStr;
-                    if(gatewayAddress.back() == '\n') {
-                        gatewayAddress.pop_back();
-                    }
-                }
-                pclose(fp);
-
-                //fetching dns address
-                struct __res_state addr;
-                res_ninit(&addr);
-                char addressStr[INET_ADDRSTRLEN];
-                for (auto idx=0; idx < addr.nscount; idx++) {
-                    if (addr.nsaddr_list[idx].sin_family == AF_INET) {
-                        inet_ntop(AF_INET, &addr.nsaddr_list[idx].sin_addr.s_addr,
-                        addressStr, INET_ADDRSTRLEN);
-                        if (dnsPrimaryAddress.size() == 0) {
-                            dnsPrimaryAddress = addressStr;
-                        } else if (dnsSecondaryAddress.size() == 0) {
-                            dnsSecondaryAddress = addressStr;
-                        }
-                    }
-                }
-                ifaceFound = true;
+    LOG(DEBUG, __FUNCTION__, " found interface:", ifaceName);
+
+    //fetching gw address
+    char gwAddrStr[INET_ADDRSTRLEN];
+    std::string command = "route -n | grep 'UG[ \t]' | awk '{print $2}'";
+    FILE* fp = popen(command.c_str(), "r");
+
+    if(fgets(gwAddrStr, INET_ADDRSTRLEN, fp) != NULL) {
+        gatewayAddress = gwAddrStr;
+        if(gatewayAddress.back() == '\n') {
+            gatewayAddress.pop_back();
+        }
+    }
+    pclose(fp);
+
+    //fetching dns address
+    struct __res_state addr;
+    res_ninit(&addr);
+    char addressStr[INET_ADDRSTRLEN];
+    for (auto idx=0; idx < addr.nscount; idx++) {
+        if (addr.nsaddr_list[idx].sin_family == AF_INET) {
+            inet_ntop(AF_INET, &addr.nsaddr_list[idx].sin_addr.s_addr,
+            addressStr, INET_ADDRSTRLEN);
+            if (dnsPrimaryAddress.size() == 0) {
+                dnsPrimaryAddress = addressStr;
+            } else if (dnsSecondaryAddress.size() == 0) {
+                dnsSecondaryAddress = addressStr;
             }
         }
     }
-    freeifaddrs(ifaceAddresses);
-    return ifaceFound;
+    return true;
 }
 
 bool DataConnectionServerImpl::getIpv6Address(const std::string &ifaceName,
     std::string &ipAddress, std::string &gatewayAddress,
     std::string &dnsPrimaryAddress, std::string &dnsSecondaryAddress) {
     LOG(DEBUG, __FUNCTION__);
-    bool ifaceFound = false;
-    struct ifaddrs *ifaceAddresses;
 
-    if(getifaddrs(&ifaceAddresses) < 0) {
-        LOG(DEBUG, __FUNCTION__, " failure in fetching n/w interfaces");
-        return ifaceFound;
+    //link local addresses are not global unicast addresses and aren't cached
+    if (!ifaceAddrCache_->getAddress(ifaceName, AF_INET6, ipAddress)) {
+        LOG(DEBUG, __FUNCTION__, " no IPv6 address on interface:", ifaceName);
+        return false;
     }
-    struct ifaddrs *ifaddr;
-    //traversing thru all the available interfaces
-    for (ifaddr = ifaceAddresses; ifaddr != NULL; ifaddr=ifaddr->ifa_next) {
-        if ((ifaddr->ifa_addr != NULL) &&
-        (ifaddr->ifa_addr->sa_family == AF_INET6)) {
-            std::string ifName(ifaddr->ifa_name);
-            //if type is v6 & iface name matches with user provided name
-            if (ifaceName == ifName) {
-                LOG(DEBUG, __FUNCTION__, " found interface:", ifaceName);
-
-                //fetching ip address
-                struct sockaddr_in6* ipAddr =
-                    (struct sockaddr_in6*)ifaddr->ifa_addr;
-
-                //if it is link local address not global unicast
-                //address then we skip
-                if (IN6_IS_ADDR_LINKLOCAL(&ipAddr->sin6_addr)) {
-                    if (ifaddr->ifa_next != NULL) {
-                        ifaddr = ifaddr->ifa_next;
-                    }
-                    continue;
-                }
-                char ipAddrStr[INET6_ADDRSTRLEN];
-                inet_ntop(AF_INET6, &ipAddr->sin6_addr,
-                    ipAddrStr, INET6_ADDRSTRLEN);
-                ipAddress = ipAddrStr;
-
-                //fetching gw address
-                char gwAddrStr[INET6_ADDRSTRLEN];
-                std::string command =
-                    "ip -6 route | grep 'default[ \t]' | awk '{print $3}'";
-                FILE* fp = popen(command.c_str(), "r");
-
-                if(fgets(gwAddrStr, INET6_ADDRSTRLEN, fp) != NULL) {
-                    gatewayAddress = gwAddrStr;
-                    if(gatewayAddress.back() == '\n') {
-                        gatewayAddress.pop_back();
-                    }
-                }
-                pclose(fp);
+    LOG(DEBUG, __FUNCTION__, " found interface:", ifaceName);
+
+    //fetching gw address
+    char gwAddrStr[INET6_ADDRSTRLEN];
+    std::string command =
+        "ip -6 route | grep 'default[ \t]' | awk '{print $3}'";
+    FILE* fp = popen(command.c_str(), "r");
+
+    if(fgets(gwAddrStr, INET6_ADDRSTRLEN, fp) != NULL) {
+        gatewayAddress = gwAddrStr;
+        if(gatewayAddress.back() == '\n') {
+            gatewayAddress.pop_back();
+        }
+    }
+    pclose(fp);
 
-                //fetching dns address
-                std::ifstream ifs("/etc/resolv.conf");
-                std::string line;
-                if(!ifs.is_open()) {
-                    LOG(DEBUG, __FUNCTION__, " failed to open file /etc/resolv.conf");
-                    continue;
-                }
+    //fetching dns address
+    std::ifstream ifs("/etc/resolv.conf");
+    std::string line;
+    if(!ifs.is_open()) {
+        LOG(DEBUG, __FUNCTION__, " failed to open file /etc/resolv.conf");
+        return false;
+    }
 
-                if(ifs.good()) {
-                    while(std::getline(ifs, line)) {
-                        if((line.size() != 0) && (line.substr(0,11) == "nameserver ")) {
-                            //entries in "/etc/resolv.conf" are usually nameserver <dns_address>,
-                            //so taking the <dns_address> into addrStr.
-                            std::string addrStr = line.substr(11);
-                            if (DataUtilsStub::isValidIpv6Address(addrStr)) {
-                                if (dnsPrimaryAddress.size() == 0) {
-                                    dnsPrimaryAddress = addrStr;
-                                } else if (dnsSecondaryAddress.size() == 0) {
-                                    dnsSecondaryAddress = addrStr;
-                                    continue;
-                                }
-                            }
-                        }
-                    }
+    while(std::getline(ifs, line)) {
+        if((line.size() != 0) && (line.substr(0,11) == "nameserver ")) {
+            //entries in "/etc/resolv.conf" are usually nameserver <dns_address>,
+            //so taking the <dns_address> into addrStr.
+            std::string addrStr = line.substr(11);
+            if (DataUtilsStub::isValidIpv6Address(addrStr)) {
+                if (dnsPrimaryAddress.size() == 0) {
+                    dnsPrimaryAddress = addrStr;
+                } else if (dnsSecondaryAddress.size() == 0) {
+                    dnsSecondaryAddress = addrStr;
                 }
-
-                ifaceFound = true;
             }
         }
     }
-    freeifaddrs(ifaceAddresses);
-    return ifaceFound;
+    return true;
 }
 
 void DataConnectionServerImpl::triggerStartDataCallEvent(int profileId, int slotId,
@@ -559,6 +506,29 @@ void DataConnectionServerImpl::triggerStartDataCallEvent(int profileId, int slot
     bool ipv4Supported = (call->v4IpAddress.length() == 0)? false : true;
     bool ipv6Supported = (call->v6IpAddress.length() == 0)? false : true;
 
+    sendStartDataCallEvent(profileId, slotId, call);
+
+    //keeping local copy of data call params in server
+    if ((!dataCallExist) && (ipv4Supported || ipv6Supported)) {
+        LOG(DEBUG, __FUNCTION__, " caching data call params in server for ", call->ifaceName);
+        auto it = std::find(inactiveNwIfaces_.begin(), inactiveNwIfaces_.end(), call->ifaceName);
+        if (it != inactiveNwIfaces_.end()) {
+            inactiveNwIfaces_.erase(it);
+        }
+
+        activeNwIfaces_.push_back(call->ifaceName);
+
+        if (slotId == SLOT_ID_1) {
+            dataCallsSlot1_[profileId] = call;
+        } else {
+            dataCallsSlot2_[profileId] = call;
+        }
+        statsSampler_->addCall(slotId, profileId, call->ifaceName);
+    }
+}
+
+void DataConnectionServerImpl::sendStartDataCallEvent(int profileId, int slotId,
+    const std::shared_ptr<DataCallParams> &call) {
     ::dataStub::StartDataCallEvent startDataCallEvent;
     ::eventService::EventResponse anyResponse;
 
@@ -580,21 +550,46 @@ void DataConnectionServerImpl::triggerStartDataCallEvent(int profileId, int slot
     //posting the event to EventService event queue
     auto& eventImpl = EventService::getInstance();
     eventImpl.updateEventQueue(anyResponse);
+}
 
-    //keeping local copy of data call params in server
-    if ((!dataCallExist) && (ipv4Supported || ipv6Supported)) {
-        LOG(DEBUG, __FUNCTION__, " caching data call params in server for ", call->ifaceName);
-        auto it = std::find(inactiveNwIfaces_.begin(), inactiveNwIfaces_.end(), call->ifaceName);
-        if (it != inactiveNwIfaces_.end()) {
-            inactiveNwIfaces_.erase(it);
-        }
-
-        activeNwIfaces_.push_back(call->ifaceName);
-
-        if (slotId == SLOT_ID_1) {
-            dataCallsSlot1_[profileId] = call;
-        } else {
-            dataCallsSlot2_[profileId] = call;
+void DataConnectionServerImpl::onInterfaceAddressChange(
+    const std::set<std::string> &ifaceNames) {
+    std::lock_guard<std::mutex> lck(mtx_);
+    std::string ipv4 =
+        DataUtilsStub::convertIpFamilyEnumToString(::dataStub::IpFamilyType::IPV4);
+    std::string ipv6 =
+        DataUtilsStub::convertIpFamilyEnumToString(::dataStub::IpFamilyType::IPV6);
+    std::string ipv4v6 =
+        DataUtilsStub::convertIpFamilyEnumToString(::dataStub::IpFamilyType::IPV4V6);
+
+    for (auto calls : {&dataCallsSlot1_, &dataCallsSlot2_}) {
+        for (auto &entry : *calls) {
+            std::shared_ptr<DataCallParams> call = entry.second;
+            if (ifaceNames.find(call->ifaceName) == ifaceNames.end()) {
+                continue;
+            }
+            std::string v4IpAddress;
+            std::string v6IpAddress;
+            if ((call->ipFamilyType == ipv4) || (call->ipFamilyType == ipv4v6)) {
+                ifaceAddrCache_->getAddress(call->ifaceName, AF_INET, v4IpAddress);
+            }
+            if ((call->ipFamilyType == ipv6) || (call->ipFamilyType == ipv4v6)) {
+                ifaceAddrCache_->getAddress(call->ifaceName, AF_INET6, v6IpAddress);
+            }
+            if ((v4IpAddress == call->v4IpAddress) && (v6IpAddress == call->v6IpAddress)) {
+                continue;
+            }
+            // A call left without any address is torn down by the client on this event,
+            // keep reporting its last addresses until it is stopped
+            if (v4IpAddress.empty() && v6IpAddress.empty()) {
+                LOG(INFO, __FUNCTION__, " all addresses removed from ", call->ifaceName);
+                continue;
+            }
+            LOG(INFO, __FUNCTION__, " addresses changed for ", call->ifaceName, " v4::",
+                v4IpAddress, " v6::", v6IpAddress);
+            call->v4IpAddress = v4IpAddress;
+            call->v6IpAddress = v6IpAddress;
+            sendStartDataCallEvent(entry.first, call->slotId, call);
         }
     }
 }
@@ -626,8 +621,8 @@ bool DataConnectionServerImpl::isWwanConnectivityAllowed(int slotId) {
     return isAllowed;
 }
 
-grpc::Status DataConnectionServerImpl::StartDatacall(ServerContext* context,
-    const dataStub::DataCallInputParams* request, dataStub::DefaultReply* response) {
+grpc::Status DataConnectionServerImpl::StartDatacall(const dataStub::DataCallInputParams* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_CONNECTION_API_SLOT2_JSON
@@ -757,8 +752,8 @@ void DataConnectionServerImpl::triggerStopDataCallEvent(int profileId, int slotI
     }
 }
 
-grpc::Status DataConnectionServerImpl::StopDatacall(ServerContext* context,
-    const dataStub::DataCallInputParams* request, dataStub::DefaultReply* response) {
+grpc::Status DataConnectionServerImpl::StopDatacall(const dataStub::DataCallInputParams* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_CONNECTION_API_SLOT2_JSON
@@ -811,14 +806,15 @@ grpc::Status DataConnectionServerImpl::StopDatacall(ServerContext* context,
                 } else {
                     dataCallsSlot2_.erase(profileId);
                 }
+                statsSampler_->removeCall(slotId, profileId);
             }
 
             std::string ifaceName = dataCall->ifaceName;
-            auto f = std::async(std::launch::async, [this, profileId, slotId,
+            auto f = telux::common::TimerService::getInstance()->runAfter(data.cbDelay,
+                [this, profileId, slotId,
                 ipFamilyType, ifaceName, data]() {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(data.cbDelay));
                     this->triggerStopDataCallEvent(profileId, slotId, ipFamilyType, ifaceName);
-                }).share();
+                });
             taskQ_->add(f);
         }
     }
@@ -830,7 +826,7 @@ grpc::Status DataConnectionServerImpl::StopDatacall(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataConnectionServerImpl::RequestDatacallList(ServerContext* context,
+grpc::Status DataConnectionServerImpl::RequestDatacallList(
     const dataStub::DataCallInputParams* request, dataStub::RequestDataCallListReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -854,6 +850,106 @@ grpc::Status DataConnectionServerImpl::RequestDatacallList(ServerContext* contex
     return grpc::Status::OK;
 }
 
+grpc::Status DataConnectionServerImpl::RequestDatacallStatistics(
+    const dataStub::DataCallStatisticsRequest* request,
+    dataStub::RequestDataCallStatisticsReply* response) {
+
+    LOG(DEBUG, __FUNCTION__);
+    std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_CONNECTION_API_SLOT2_JSON
+        : DATA_CONNECTION_API_SLOT1_JSON;
+    std::string stateJsonPath = DATA_CONNECTION_STATE_JSON;
+    std::string subsystem = "IDataConnectionManager";
+    std::string method = "requestDataCallStatistics";
+    JsonData data;
+    telux::common::ErrorCode error =
+        CommonUtils::readJsonData(apiJsonPath, stateJsonPath, subsystem, method, data);
+
+    if (error != ErrorCode::SUCCESS) {
+        return grpc::Status(grpc::StatusCode::INTERNAL, "Json read failed");
+    }
+
+    if (data.status == telux::common::Status::SUCCESS &&
+        data.error == telux::common::ErrorCode::SUCCESS) {
+        DataCallStatsSampler::Stats stats;
+        data.error = statsSampler_->getStats(request->slot_id(), request->profile_id(), stats);
+        response->set_packets_tx(stats.counters.packetsTx);
+        response->set_packets_rx(stats.counters.packetsRx);
+        response->set_bytes_tx(stats.counters.bytesTx);
+        response->set_bytes_rx(stats.counters.bytesRx);
+        response->set_packets_dropped_tx(stats.counters.packetsDroppedTx);
+        response->set_packets_dropped_rx(stats.counters.packetsDroppedRx);
+    }
+
+    response->mutable_reply()->set_status(static_cast<commonStub::Status>(data.status));
+    response->mutable_reply()->set_error(static_cast<commonStub::ErrorCode>(data.error));
+    response->mutable_reply()->set_delay(data.cbDelay);
+
+    return grpc::Status::OK;
+}
+
+grpc::Status DataConnectionServerImpl::ResetDatacallStatistics(
+    const dataStub::DataCallStatisticsRequest* request, dataStub::DefaultReply* response) {
+
+    LOG(DEBUG, __FUNCTION__);
+    std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_CONNECTION_API_SLOT2_JSON
+        : DATA_CONNECTION_API_SLOT1_JSON;
+    std::string stateJsonPath = DATA_CONNECTION_STATE_JSON;
+    std::string subsystem = "IDataConnectionManager";
+    std::string method = "resetDataCallStatistics";
+    JsonData data;
+    telux::common::ErrorCode error =
+        CommonUtils::readJsonData(apiJsonPath, stateJsonPath, subsystem, method, data);
+
+    if (error != ErrorCode::SUCCESS) {
+        return grpc::Status(grpc::StatusCode::INTERNAL, "Json read failed");
+    }
+
+    if (data.status == telux::common::Status::SUCCESS &&
+        data.error == telux::common::ErrorCode::SUCCESS) {
+        data.error = statsSampler_->reset(request->slot_id(), request->profile_id());
+    }
+
+    response->set_status(static_cast<commonStub::Status>(data.status));
+    response->set_error(static_cast<commonStub::ErrorCode>(data.error));
+    response->set_delay(data.cbDelay);
+
+    return grpc::Status::OK;
+}
+
+grpc::Status DataConnectionServerImpl::RequestDataCallBitRate(
+    const dataStub::DataCallBitRateRequest* request,
+    dataStub::RequestDataCallBitRateReply* response) {
+
+    LOG(DEBUG, __FUNCTION__);
+    int slotId = request->bit_rate().slot_id();
+    std::string apiJsonPath = (slotId == SLOT_2)? DATA_CONNECTION_API_SLOT2_JSON
+        : DATA_CONNECTION_API_SLOT1_JSON;
+    std::string stateJsonPath = DATA_CONNECTION_STATE_JSON;
+    std::string subsystem = "IDataConnectionManager";
+    std::string method = "requestDataCallBitRate";
+    JsonData data;
+    telux::common::ErrorCode error =
+        CommonUtils::readJsonData(apiJsonPath, stateJsonPath, subsystem, method, data);
+
+    if (error != ErrorCode::SUCCESS) {
+        return grpc::Status(grpc::StatusCode::INTERNAL, "Json read failed");
+    }
+
+    if (data.status == telux::common::Status::SUCCESS &&
+        data.error == telux::common::ErrorCode::SUCCESS) {
+        DataCallStatsSampler::Stats stats;
+        data.error = statsSampler_->getStats(slotId, request->bit_rate().profile_id(), stats);
+        response->set_tx_rate(stats.txRate);
+        response->set_rx_rate(stats.rxRate);
+    }
+
+    response->mutable_reply()->set_status(static_cast<commonStub::Status>(data.status));
+    response->mutable_reply()->set_error(static_cast<commonStub::ErrorCode>(data.error));
+    response->mutable_reply()->set_delay(data.cbDelay);
+
+    return grpc::Status::OK;
+}
+
 void DataConnectionServerImpl::stopActiveDataCalls(SlotId slotId) {
     if (slotId == SLOT_ID_1) {
         clearCachedDataCall(dataCallsSlot1_, true);
@@ -875,6 +971,7 @@ void DataConnectionServerImpl::clearCachedDataCall(
         if (stopAllCalls) {
             this->triggerStopDataCallEvent(profileId, callObj->slotId,
                 callObj->ipFamilyType, callObj->ifaceName);
+            statsSampler_->removeCall(callObj->slotId, profileId);
             ++itr;
         } else {
             if (owners.find(client_id) != owners.end()) {
@@ -885,6 +982,7 @@ void DataConnectionServerImpl::clearCachedDataCall(
                 if (owners.size() == 0) {
                     this->triggerStopDataCallEvent(profileId, callObj->slotId,
                         callObj->ipFamilyType, callObj->ifaceName);
+                    statsSampler_->removeCall(callObj->slotId, profileId);
                     itr = dataCallsMap.erase(itr);
                     continue;
                 }
@@ -900,8 +998,8 @@ void DataConnectionServerImpl::clearCachedDataCall(
     }
 }
 
-grpc::Status DataConnectionServerImpl::CleanUpService(ServerContext* context,
-    const ::dataStub::ClientInfo* request, ::google::protobuf::Empty* response) {
+grpc::Status DataConnectionServerImpl::CleanUpService(const ::dataStub::ClientInfo* request,
+    ::google::protobuf::Empty* response) {
 
     LOG(DEBUG, __FUNCTION__, " clearing cached datacalls from server");
     unsigned int client_id = request->client_id();
@@ -911,7 +1009,7 @@ grpc::Status DataConnectionServerImpl::CleanUpService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataConnectionServerImpl::requestConnectedDataCallLists(ServerContext* context,
+grpc::Status DataConnectionServerImpl::requestConnectedDataCallLists(
     const dataStub::CachedDataCallsRequest* request, dataStub::CachedDataCalls* response) {
     LOG(DEBUG, __FUNCTION__);
 
@@ -993,8 +1091,8 @@ bool DataConnectionServerImpl::updateThrottleApnInfo(){
     return true;
 }
 
-grpc::Status DataConnectionServerImpl::RequestThrottledApnInfo(ServerContext* context,
-        const dataStub::SlotInfo* request,dataStub::ThrottleInfoReply* response) {
+grpc::Status DataConnectionServerImpl::RequestThrottledApnInfo(const dataStub::SlotInfo* request,
+    dataStub::ThrottleInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_CONNECTION_API_SLOT2_JSON
         : DATA_CONNECTION_API_SLOT1_JSON;
@@ -1104,3 +1202,101 @@ bool DataConnectionServerImpl::isAnyDataCallActive(SlotId slotId) {
 
     return callActive;
 }
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::InitService(
+    grpc::CallbackServerContext* context, const dataStub::SlotInfo* request,
+    dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::SetDefaultProfile(
+    grpc::CallbackServerContext* context, const dataStub::SetDefaultProfileRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetDefaultProfile(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::GetDefaultProfile(
+    grpc::CallbackServerContext* context, const dataStub::GetDefaultProfileRequest* request,
+    dataStub::GetDefaultProfileReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetDefaultProfile(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::SetRoamingMode(
+    grpc::CallbackServerContext* context, const dataStub::SetRoamingModeRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetRoamingMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::RequestRoamingMode(
+    grpc::CallbackServerContext* context, const dataStub::RequestRoamingModeRequest* request,
+    dataStub::RequestRoamingModeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestRoamingMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::StartDatacall(
+    grpc::CallbackServerContext* context, const dataStub::DataCallInputParams* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StartDatacall(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::StopDatacall(
+    grpc::CallbackServerContext* context, const dataStub::DataCallInputParams* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StopDatacall(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::RequestDatacallList(
+    grpc::CallbackServerContext* context, const dataStub::DataCallInputParams* request,
+    dataStub::RequestDataCallListReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestDatacallList(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::RequestDatacallStatistics(
+    grpc::CallbackServerContext* context, const dataStub::DataCallStatisticsRequest* request,
+    dataStub::RequestDataCallStatisticsReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestDatacallStatistics(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::ResetDatacallStatistics(
+    grpc::CallbackServerContext* context, const dataStub::DataCallStatisticsRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ResetDatacallStatistics(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::RequestDataCallBitRate(
+    grpc::CallbackServerContext* context, const dataStub::DataCallBitRateRequest* request,
+    dataStub::RequestDataCallBitRateReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestDataCallBitRate(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::RequestThrottledApnInfo(
+    grpc::CallbackServerContext* context, const dataStub::SlotInfo* request,
+    dataStub::ThrottleInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestThrottledApnInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::CleanUpService(
+    grpc::CallbackServerContext* context, const ::dataStub::ClientInfo* request,
+    ::google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CleanUpService(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataConnectionServerImpl::requestConnectedDataCallLists(
+    grpc::CallbackServerContext* context, const dataStub::CachedDataCallsRequest* request,
+    dataStub::CachedDataCalls* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return requestConnectedDataCallLists(request, response); });
+}
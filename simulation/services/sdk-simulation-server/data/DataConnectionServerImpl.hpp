@@ -23,6 +23,8 @@
 #include "libs/common/AsyncTaskQueue.hpp"
 
 #include "event/ServerEventManager.hpp"
+#include "DataCallStatsSampler.hpp"
+#include "InterfaceAddressCache.hpp"
 
 #include "protos/proto-src/data_simulation.grpc.pb.h"
 
@@ -63,54 +65,60 @@ struct DataCallParams {
 };
 
 class DataConnectionServerImpl final:
-    public dataStub::DataConnectionManager::Service,
+    public dataStub::DataConnectionManager::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<DataConnectionServerImpl> {
 public:
     DataConnectionServerImpl();
     ~DataConnectionServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::SlotInfo* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status SetDefaultProfile(ServerContext* context,
+    grpc::ServerUnaryReactor* SetDefaultProfile(grpc::CallbackServerContext* context,
         const dataStub::SetDefaultProfileRequest* request,
         dataStub::DefaultReply* response) override;
 
-    grpc::Status GetDefaultProfile(ServerContext* context,
+    grpc::ServerUnaryReactor* GetDefaultProfile(grpc::CallbackServerContext* context,
         const dataStub::GetDefaultProfileRequest* request,
         dataStub::GetDefaultProfileReply* response) override;
 
-    grpc::Status SetRoamingMode(ServerContext* context,
-        const dataStub::SetRoamingModeRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* SetRoamingMode(grpc::CallbackServerContext* context,
+        const dataStub::SetRoamingModeRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestRoamingMode(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestRoamingMode(grpc::CallbackServerContext* context,
         const dataStub::RequestRoamingModeRequest* request,
         dataStub::RequestRoamingModeReply* response) override;
 
-    grpc::Status StartDatacall(ServerContext* context,
-        const dataStub::DataCallInputParams* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* StartDatacall(grpc::CallbackServerContext* context,
+        const dataStub::DataCallInputParams* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status StopDatacall(ServerContext* context,
-        const dataStub::DataCallInputParams* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* StopDatacall(grpc::CallbackServerContext* context,
+        const dataStub::DataCallInputParams* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestDatacallList(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestDatacallList(grpc::CallbackServerContext* context,
         const dataStub::DataCallInputParams* request,
         dataStub::RequestDataCallListReply* response) override;
 
-    grpc::Status RequestThrottledApnInfo(ServerContext* context,
-        const dataStub::SlotInfo* request,
-        dataStub::ThrottleInfoReply* response) override;
+    grpc::ServerUnaryReactor* RequestDatacallStatistics(grpc::CallbackServerContext* context,
+        const dataStub::DataCallStatisticsRequest* request,
+        dataStub::RequestDataCallStatisticsReply* response) override;
 
-    grpc::Status CleanUpService(ServerContext* context,
-        const ::dataStub::ClientInfo* request,
-        ::google::protobuf::Empty* response) override;
+    grpc::ServerUnaryReactor* ResetDatacallStatistics(grpc::CallbackServerContext* context,
+        const dataStub::DataCallStatisticsRequest* request,
+        dataStub::DefaultReply* response) override;
+
+    grpc::ServerUnaryReactor* RequestDataCallBitRate(grpc::CallbackServerContext* context,
+        const dataStub::DataCallBitRateRequest* request,
+        dataStub::RequestDataCallBitRateReply* response) override;
+
+    grpc::ServerUnaryReactor* RequestThrottledApnInfo(grpc::CallbackServerContext* context,
+        const dataStub::SlotInfo* request, dataStub::ThrottleInfoReply* response) override;
 
-    grpc::Status requestConnectedDataCallLists(ServerContext* context,
+    grpc::ServerUnaryReactor* CleanUpService(grpc::CallbackServerContext* context,
+        const ::dataStub::ClientInfo* request, ::google::protobuf::Empty* response) override;
+
+    grpc::ServerUnaryReactor* requestConnectedDataCallLists(grpc::CallbackServerContext* context,
         const dataStub::CachedDataCallsRequest* request,
         dataStub::CachedDataCalls* response) override;
 
@@ -128,6 +136,36 @@ public:
     void onEventUpdate(::eventService::UnsolicitedEvent message);
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::SlotInfo* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status SetDefaultProfile(const dataStub::SetDefaultProfileRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status GetDefaultProfile(const dataStub::GetDefaultProfileRequest* request,
+        dataStub::GetDefaultProfileReply* response);
+    grpc::Status SetRoamingMode(const dataStub::SetRoamingModeRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestRoamingMode(const dataStub::RequestRoamingModeRequest* request,
+        dataStub::RequestRoamingModeReply* response);
+    grpc::Status StartDatacall(const dataStub::DataCallInputParams* request,
+        dataStub::DefaultReply* response);
+    grpc::Status StopDatacall(const dataStub::DataCallInputParams* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestDatacallList(const dataStub::DataCallInputParams* request,
+        dataStub::RequestDataCallListReply* response);
+    grpc::Status RequestDatacallStatistics(const dataStub::DataCallStatisticsRequest* request,
+        dataStub::RequestDataCallStatisticsReply* response);
+    grpc::Status ResetDatacallStatistics(const dataStub::DataCallStatisticsRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestDataCallBitRate(const dataStub::DataCallBitRateRequest* request,
+        dataStub::RequestDataCallBitRateReply* response);
+    grpc::Status RequestThrottledApnInfo(const dataStub::SlotInfo* request,
+        dataStub::ThrottleInfoReply* response);
+    grpc::Status CleanUpService(const ::dataStub::ClientInfo* request,
+        ::google::protobuf::Empty* response);
+    grpc::Status requestConnectedDataCallLists(const dataStub::CachedDataCallsRequest* request,
+        dataStub::CachedDataCalls* response);
+
     bool getIpv4Address(const std::string &ifaceName,
         std::string &ipAddress, std::string &gatewayAddress,
         std::string &dnsPrimaryAddress, std::string &dnsSecondaryAddress);
@@ -140,6 +178,9 @@ private:
     void triggerStopDataCallEvent(int profileId, int slotId, std::string ipFamilyType,
         std::string ifaceName);
     void triggerThrottledApnInfoChangedEvent(dataStub::APNThrottleInfoList* response);
+    void sendStartDataCallEvent(int profileId, int slotId,
+        const std::shared_ptr<DataCallParams> &call);
+    void onInterfaceAddressChange(const std::set<std::string> &ifaceNames);
 
 
     void getInactiveInterfaces();
@@ -165,6 +206,10 @@ private:
      */
     std::list<std::string> activeNwIfaces_;
     std::list<std::string> inactiveNwIfaces_;
+    /* Traffic statistics of the cached datacalls */
+    std::shared_ptr<DataCallStatsSampler> statsSampler_;
+    /* Addresses of the host interfaces the datacalls are mapped to */
+    std::unique_ptr<InterfaceAddressCache> ifaceAddrCache_;
     std::vector<APNThrottleInfo> apnThrottleInfo_;
     std::mutex apnThrottleInfoMtx_;
     std::atomic<bool> timerStarted_;
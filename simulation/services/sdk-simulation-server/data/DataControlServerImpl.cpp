@@ -11,6 +11,7 @@
 #include "libs/common/CommonUtils.hpp"
 #include "common/event-manager/EventParserUtil.hpp"
 #include "event/EventService.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define DATA_CONTROL_MANAGER_API_JSON "api/data/IDataControlManagerSlot.json"
 
@@ -132,8 +133,8 @@ void DataControlServerImpl::handleSSREvent(std::string eventParams) {
     setServiceStatus(srvcStatus);
 }
 
-grpc::Status DataControlServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty *request, commonStub::GetServiceStatusReply* response) {
+grpc::Status DataControlServerImpl::InitService(const google::protobuf::Empty *request,
+    commonStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
 
@@ -166,9 +167,8 @@ grpc::Status DataControlServerImpl::InitService(ServerContext* context,
     return setResponse(srvcStatus,response);
 }
 
-grpc::Status DataControlServerImpl::GetServiceStatus(ServerContext* context,
-        const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response) {
+grpc::Status DataControlServerImpl::GetServiceStatus(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     telux::common::ServiceStatus srvStatus = getServiceStatus();
@@ -203,8 +203,9 @@ grpc::Status DataControlServerImpl::setResponse(telux::common::ServiceStatus srv
     return grpc::Status::OK;
 }
 
-grpc::Status DataControlServerImpl::SetDataStallParams(ServerContext* context,
-    const dataStub::SetDataStallParamsRequest *request, dataStub::SetDataStallParamsReply* response) {
+grpc::Status DataControlServerImpl::SetDataStallParams(
+    const dataStub::SetDataStallParamsRequest *request,
+    dataStub::SetDataStallParamsReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
 
@@ -228,3 +229,23 @@ grpc::Status DataControlServerImpl::SetDataStallParams(ServerContext* context,
 
     return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* DataControlServerImpl::InitService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataControlServerImpl::SetDataStallParams(
+    grpc::CallbackServerContext* context, const dataStub::SetDataStallParamsRequest* request,
+    dataStub::SetDataStallParamsReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetDataStallParams(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataControlServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
@@ -24,7 +24,7 @@ using commonStub::ServiceStatus;
 using commonStub::GetServiceStatusReply;
 
 class DataControlServerImpl final:
-    public dataStub::DataControlManager::Service,
+    public dataStub::DataControlManager::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<DataControlServerImpl> {
 
@@ -32,20 +32,29 @@ public:
     DataControlServerImpl();
     ~DataControlServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const google::protobuf::Empty *request,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
 
-    grpc::Status SetDataStallParams(ServerContext* context,
-            const dataStub::SetDataStallParamsRequest *request,
-            dataStub::SetDataStallParamsReply* response) override;
+    grpc::ServerUnaryReactor* SetDataStallParams(grpc::CallbackServerContext* context,
+        const dataStub::SetDataStallParamsRequest* request,
+        dataStub::SetDataStallParamsReply* response) override;
 
-    grpc::Status GetServiceStatus(ServerContext* context, const google::protobuf::Empty* request,
-            commonStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response) override;
 
     void onEventUpdate(::eventService::UnsolicitedEvent event);
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status SetDataStallParams(const dataStub::SetDataStallParamsRequest* request,
+        dataStub::SetDataStallParamsReply* response);
+    grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
     ServerEventManager &serverEvent_;
     EventService &clientEvent_;
@@ -10,6 +10,7 @@
 #include "libs/common/CommonUtils.hpp"
 #include "event/ServerEventManager.hpp"
 #include "event/EventService.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define DATA_FILTER_API_SLOT1_JSON "api/data/IDataFilterManagerSlot1.json"
 #define DATA_FILTER_API_SLOT2_JSON "api/data/IDataFilterManagerSlot2.json"
@@ -29,8 +30,7 @@ DataFilterServerImpl::~DataFilterServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status DataFilterServerImpl::InitService(ServerContext* context,
-    const dataStub::SlotInfo* request,
+grpc::Status DataFilterServerImpl::InitService(const dataStub::SlotInfo* request,
     dataStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
@@ -60,9 +60,8 @@ grpc::Status DataFilterServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataFilterServerImpl::SetDataRestrictMode(ServerContext* context,
-    const dataStub::SetDataRestrictModeRequest* request,
-    dataStub::DefaultReply* response) {
+grpc::Status DataFilterServerImpl::SetDataRestrictMode(
+    const dataStub::SetDataRestrictModeRequest* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->slot_id() == SLOT_2)?
@@ -105,7 +104,7 @@ grpc::Status DataFilterServerImpl::SetDataRestrictMode(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataFilterServerImpl::GetDataRestrictMode(ServerContext* context,
+grpc::Status DataFilterServerImpl::GetDataRestrictMode(
     const dataStub::GetDataRestrictModeRequest* request,
     dataStub::GetDataRestrictModeReply* response) {
 
@@ -142,9 +141,8 @@ grpc::Status DataFilterServerImpl::GetDataRestrictMode(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataFilterServerImpl::AddDataRestrictFilter(ServerContext* context,
-    const dataStub::AddDataRestrictFilterRequest* request,
-    dataStub::DefaultReply* response) {
+grpc::Status DataFilterServerImpl::AddDataRestrictFilter(
+    const dataStub::AddDataRestrictFilterRequest* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->slot_id() == SLOT_2)?
@@ -173,9 +171,8 @@ grpc::Status DataFilterServerImpl::AddDataRestrictFilter(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataFilterServerImpl::RemoveAllDataRestrictFilter(ServerContext* context,
-    const dataStub::RemoveDataRestrictFilterRequest* request,
-    dataStub::DefaultReply* response) {
+grpc::Status DataFilterServerImpl::RemoveAllDataRestrictFilter(
+    const dataStub::RemoveDataRestrictFilterRequest* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->slot_id() == SLOT_2)?
@@ -273,4 +270,38 @@ void DataFilterServerImpl::sendDataRestrictModeEvent(int slot_id, std::string fi
     //posting the event to EventService event queue
     auto& eventImpl = EventService::getInstance();
     eventImpl.updateEventQueue(anyResponse);
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* DataFilterServerImpl::InitService(grpc::CallbackServerContext* context,
+    const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataFilterServerImpl::SetDataRestrictMode(
+    grpc::CallbackServerContext* context, const dataStub::SetDataRestrictModeRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetDataRestrictMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataFilterServerImpl::GetDataRestrictMode(
+    grpc::CallbackServerContext* context, const dataStub::GetDataRestrictModeRequest* request,
+    dataStub::GetDataRestrictModeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetDataRestrictMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataFilterServerImpl::AddDataRestrictFilter(
+    grpc::CallbackServerContext* context, const dataStub::AddDataRestrictFilterRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return AddDataRestrictFilter(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataFilterServerImpl::RemoveAllDataRestrictFilter(
+    grpc::CallbackServerContext* context, const dataStub::RemoveDataRestrictFilterRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RemoveAllDataRestrictFilter(request, response); });
+}
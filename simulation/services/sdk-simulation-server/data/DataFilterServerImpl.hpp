@@ -19,7 +19,7 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class DataFilterServerImpl final:
-    public dataStub::DataFilterManager::Service,
+    public dataStub::DataFilterManager::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<DataFilterServerImpl> {
 
@@ -27,29 +27,40 @@ public:
     DataFilterServerImpl(std::shared_ptr<DataConnectionServerImpl> dcmServerImpl);
     ~DataFilterServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::SlotInfo* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status SetDataRestrictMode(ServerContext* context,
+    grpc::ServerUnaryReactor* SetDataRestrictMode(grpc::CallbackServerContext* context,
         const dataStub::SetDataRestrictModeRequest* request,
         dataStub::DefaultReply* response) override;
 
-    grpc::Status GetDataRestrictMode(ServerContext* context,
+    grpc::ServerUnaryReactor* GetDataRestrictMode(grpc::CallbackServerContext* context,
         const dataStub::GetDataRestrictModeRequest* request,
         dataStub::GetDataRestrictModeReply* response) override;
 
-    grpc::Status AddDataRestrictFilter(ServerContext* context,
+    grpc::ServerUnaryReactor* AddDataRestrictFilter(grpc::CallbackServerContext* context,
         const dataStub::AddDataRestrictFilterRequest* request,
         dataStub::DefaultReply* response) override;
 
-    grpc::Status RemoveAllDataRestrictFilter(ServerContext* context,
+    grpc::ServerUnaryReactor* RemoveAllDataRestrictFilter(grpc::CallbackServerContext* context,
         const dataStub::RemoveDataRestrictFilterRequest* request,
         dataStub::DefaultReply* response) override;
 
     void onServerEvent(google::protobuf::Any event) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::SlotInfo* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status SetDataRestrictMode(const dataStub::SetDataRestrictModeRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status GetDataRestrictMode(const dataStub::GetDataRestrictModeRequest* request,
+        dataStub::GetDataRestrictModeReply* response);
+    grpc::Status AddDataRestrictFilter(const dataStub::AddDataRestrictFilterRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RemoveAllDataRestrictFilter(
+        const dataStub::RemoveDataRestrictFilterRequest* request, dataStub::DefaultReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
     std::shared_ptr<DataConnectionServerImpl> dcmServerImpl_;
 
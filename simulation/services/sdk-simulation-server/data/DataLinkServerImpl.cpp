@@ -11,6 +11,7 @@
 #include "libs/common/CommonUtils.hpp"
 #include "common/event-manager/EventParserUtil.hpp"
 #include "event/EventService.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define DATA_LINK_MANAGER_API_JSON "api/data/IDataLinkManager.json"
 #define DATA_LINK_MANAGER_STATE_JSON "system-state/data/IDataLinkManagerState.json"
@@ -134,8 +135,8 @@ void DataLinkServerImpl::handleSSREvent(std::string eventParams) {
     setServiceStatus(srvcStatus);
 }
 
-grpc::Status DataLinkServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty *request, commonStub::GetServiceStatusReply* response) {
+grpc::Status DataLinkServerImpl::InitService(const google::protobuf::Empty *request,
+    commonStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
 
@@ -168,9 +169,8 @@ grpc::Status DataLinkServerImpl::InitService(ServerContext* context,
     return setResponse(srvcStatus,response);
 }
 
-grpc::Status DataLinkServerImpl::GetServiceStatus(ServerContext* context,
-        const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response) {
+grpc::Status DataLinkServerImpl::GetServiceStatus(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     telux::common::ServiceStatus srvStatus = getServiceStatus();
@@ -205,7 +205,7 @@ grpc::Status DataLinkServerImpl::setResponse(telux::common::ServiceStatus srvSta
     return grpc::Status::OK;
 }
 
-grpc::Status DataLinkServerImpl::SetEthDataLinkState(ServerContext* context,
+grpc::Status DataLinkServerImpl::SetEthDataLinkState(
     const dataStub::SetEthDatalinkStateRequest *request,
     dataStub::SetEthDatalinkStateReply* response) {
 
@@ -268,3 +268,22 @@ grpc::Status DataLinkServerImpl::SetEthDataLinkState(ServerContext* context,
 
     return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* DataLinkServerImpl::InitService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataLinkServerImpl::SetEthDataLinkState(
+    grpc::CallbackServerContext* context, const dataStub::SetEthDatalinkStateRequest* request,
+    dataStub::SetEthDatalinkStateReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetEthDataLinkState(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataLinkServerImpl::GetServiceStatus(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
@@ -24,7 +24,7 @@ using commonStub::ServiceStatus;
 using commonStub::GetServiceStatusReply;
 
 class DataLinkServerImpl final:
-    public dataStub::DataLinkManager::Service,
+    public dataStub::DataLinkManager::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<DataLinkServerImpl> {
 
@@ -32,20 +32,29 @@ public:
     DataLinkServerImpl();
     ~DataLinkServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const google::protobuf::Empty *request,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
 
-    grpc::Status SetEthDataLinkState(ServerContext* context,
-            const dataStub::SetEthDatalinkStateRequest *request,
-            dataStub::SetEthDatalinkStateReply* response) override;
+    grpc::ServerUnaryReactor* SetEthDataLinkState(grpc::CallbackServerContext* context,
+        const dataStub::SetEthDatalinkStateRequest* request,
+        dataStub::SetEthDatalinkStateReply* response) override;
 
-    grpc::Status GetServiceStatus(ServerContext* context, const google::protobuf::Empty* request,
-            commonStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response) override;
 
     void onEventUpdate(::eventService::UnsolicitedEvent event);
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status SetEthDataLinkState(const dataStub::SetEthDatalinkStateRequest* request,
+        dataStub::SetEthDatalinkStateReply* response);
+    grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
     ServerEventManager &serverEvent_;
     EventService &clientEvent_;
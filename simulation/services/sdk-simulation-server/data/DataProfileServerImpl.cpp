@@ -8,6 +8,7 @@
 
 #include "DataProfileServerImpl.hpp"
 #include "libs/data/DataUtilsStub.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define DATA_PROFILE_API_SLOT1_JSON "api/data/IDataProfileManagerSlot1.json"
 #define DATA_PROFILE_API_SLOT2_JSON "api/data/IDataProfileManagerSlot2.json"
@@ -23,8 +24,8 @@ DataProfileServerImpl::~DataProfileServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status DataProfileServerImpl::InitService(ServerContext* context,
-    const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status DataProfileServerImpl::InitService(const dataStub::SlotInfo* request,
+    dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string filePath = (request->slot_id() == SLOT_2)? DATA_PROFILE_API_SLOT2_JSON
@@ -49,8 +50,8 @@ grpc::Status DataProfileServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataProfileServerImpl::CreateProfile(ServerContext* context,
-    const dataStub::CreateProfileRequest* request, dataStub::CreateProfileReply* response) {
+grpc::Status DataProfileServerImpl::CreateProfile(const dataStub::CreateProfileRequest* request,
+    dataStub::CreateProfileReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_PROFILE_API_SLOT2_JSON
@@ -134,8 +135,8 @@ grpc::Status DataProfileServerImpl::CreateProfile(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataProfileServerImpl::DeleteProfile(ServerContext* context,
-    const dataStub::DeleteProfileRequest* request, dataStub::DefaultReply* response) {
+grpc::Status DataProfileServerImpl::DeleteProfile(const dataStub::DeleteProfileRequest* request,
+    dataStub::DefaultReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::string apiJsonPath = (request->profile().slot_id() == SLOT_2)?
@@ -196,8 +197,8 @@ grpc::Status DataProfileServerImpl::DeleteProfile(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataProfileServerImpl::ModifyProfile(ServerContext* context,
-    const dataStub::ModifyProfileRequest* request, dataStub::DefaultReply* response) {
+grpc::Status DataProfileServerImpl::ModifyProfile(const dataStub::ModifyProfileRequest* request,
+    dataStub::DefaultReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_PROFILE_API_SLOT2_JSON
@@ -288,7 +289,7 @@ grpc::Status DataProfileServerImpl::ModifyProfile(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataProfileServerImpl::RequestProfileById(ServerContext* context,
+grpc::Status DataProfileServerImpl::RequestProfileById(
     const dataStub::RequestProfileByIdRequest* request,
     dataStub::RequestProfileByIdReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -373,7 +374,7 @@ grpc::Status DataProfileServerImpl::RequestProfileById(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataProfileServerImpl::RequestProfileList(ServerContext* context,
+grpc::Status DataProfileServerImpl::RequestProfileList(
     const dataStub::RequestProfileListRequest* request,
     dataStub::RequestProfileListReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -432,8 +433,8 @@ grpc::Status DataProfileServerImpl::RequestProfileList(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataProfileServerImpl::QueryProfile(ServerContext* context,
-    const dataStub::QueryProfileRequest* request, dataStub::QueryProfileReply* response) {
+grpc::Status DataProfileServerImpl::QueryProfile(const dataStub::QueryProfileRequest* request,
+    dataStub::QueryProfileReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::string apiJsonPath = (request->slot_id() == SLOT_2)? DATA_PROFILE_API_SLOT2_JSON
@@ -551,3 +552,47 @@ grpc::Status DataProfileServerImpl::QueryProfile(ServerContext* context,
 
     return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* DataProfileServerImpl::InitService(grpc::CallbackServerContext* context,
+    const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataProfileServerImpl::RequestProfileById(
+    grpc::CallbackServerContext* context, const dataStub::RequestProfileByIdRequest* request,
+    dataStub::RequestProfileByIdReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestProfileById(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataProfileServerImpl::CreateProfile(grpc::CallbackServerContext* context,
+    const dataStub::CreateProfileRequest* request, dataStub::CreateProfileReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CreateProfile(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataProfileServerImpl::DeleteProfile(grpc::CallbackServerContext* context,
+    const dataStub::DeleteProfileRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DeleteProfile(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataProfileServerImpl::ModifyProfile(grpc::CallbackServerContext* context,
+    const dataStub::ModifyProfileRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ModifyProfile(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataProfileServerImpl::RequestProfileList(
+    grpc::CallbackServerContext* context, const dataStub::RequestProfileListRequest* request,
+    dataStub::RequestProfileListReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestProfileList(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataProfileServerImpl::QueryProfile(grpc::CallbackServerContext* context,
+    const dataStub::QueryProfileRequest* request, dataStub::QueryProfileReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return QueryProfile(request, response); });
+}
@@ -30,38 +30,52 @@ using grpc::Status;
 using dataStub::DataProfileManager;
 
 class DataProfileServerImpl final:
-    public dataStub::DataProfileManager::Service {
+    public dataStub::DataProfileManager::CallbackService {
 public:
     DataProfileServerImpl();
     ~DataProfileServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::SlotInfo* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status RequestProfileById(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestProfileById(grpc::CallbackServerContext* context,
         const dataStub::RequestProfileByIdRequest* request,
         dataStub::RequestProfileByIdReply* response) override;
 
-    grpc::Status CreateProfile(ServerContext* context,
+    grpc::ServerUnaryReactor* CreateProfile(grpc::CallbackServerContext* context,
         const dataStub::CreateProfileRequest* request,
         dataStub::CreateProfileReply* response) override;
 
-    grpc::Status DeleteProfile(ServerContext* context,
-        const dataStub::DeleteProfileRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* DeleteProfile(grpc::CallbackServerContext* context,
+        const dataStub::DeleteProfileRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status ModifyProfile(ServerContext* context,
-        const dataStub::ModifyProfileRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* ModifyProfile(grpc::CallbackServerContext* context,
+        const dataStub::ModifyProfileRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestProfileList(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestProfileList(grpc::CallbackServerContext* context,
         const dataStub::RequestProfileListRequest* request,
         dataStub::RequestProfileListReply* response) override;
 
-    grpc::Status QueryProfile(ServerContext* context,
+    grpc::ServerUnaryReactor* QueryProfile(grpc::CallbackServerContext* context,
         const dataStub::QueryProfileRequest* request,
         dataStub::QueryProfileReply* response) override;
+
+private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::SlotInfo* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status RequestProfileById(const dataStub::RequestProfileByIdRequest* request,
+        dataStub::RequestProfileByIdReply* response);
+    grpc::Status CreateProfile(const dataStub::CreateProfileRequest* request,
+        dataStub::CreateProfileReply* response);
+    grpc::Status DeleteProfile(const dataStub::DeleteProfileRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status ModifyProfile(const dataStub::ModifyProfileRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestProfileList(const dataStub::RequestProfileListRequest* request,
+        dataStub::RequestProfileListReply* response);
+    grpc::Status QueryProfile(const dataStub::QueryProfileRequest* request,
+        dataStub::QueryProfileReply* response);
 };
 
 #endif //DATA_PROFILE_SERVER_HPP
\ No newline at end of file
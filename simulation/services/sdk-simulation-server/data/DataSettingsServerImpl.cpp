@@ -10,7 +10,9 @@
 #include "libs/common/Logger.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
+#include "libs/common/TimerService.hpp"
 #include "libs/data/DataUtilsStub.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define DATA_SETTINGS_API_LOCAL_JSON "api/data/IDataSettingsManagerLocal.json"
 #define DATA_SETTINGS_STATE_JSON "system-state/data/IDataSettingsManagerState.json"
@@ -33,8 +35,8 @@ DataSettingsServerImpl::~DataSettingsServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status DataSettingsServerImpl::InitService(ServerContext* context,
-    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status DataSettingsServerImpl::InitService(const dataStub::InitRequest* request,
+    dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootObj;
@@ -79,8 +81,8 @@ void DataSettingsServerImpl::updateDdsInfo() {
         data.stateRootObj[subsystem][method]["SlotId"].asInt());
 }
 
-grpc::Status DataSettingsServerImpl::SetDdsSwitch(ServerContext* context,
-    const dataStub::SetDdsSwitchRequest* request, dataStub::DefaultReply* response) {
+grpc::Status DataSettingsServerImpl::SetDdsSwitch(const dataStub::SetDdsSwitchRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
@@ -133,7 +135,7 @@ grpc::Status DataSettingsServerImpl::SetDdsSwitch(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::RequestCurrentDdsSwitch(ServerContext* context,
+grpc::Status DataSettingsServerImpl::RequestCurrentDdsSwitch(
     const dataStub::CurrentDdsSwitchRequest* request,
     dataStub::CurrentDdsSwitchResponse* response) {
 
@@ -167,7 +169,7 @@ grpc::Status DataSettingsServerImpl::RequestCurrentDdsSwitch(ServerContext* cont
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::setBandInterferenceConfig(ServerContext* context,
+grpc::Status DataSettingsServerImpl::setBandInterferenceConfig(
     const dataStub::BandInterferenceConfig* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -209,9 +211,8 @@ grpc::Status DataSettingsServerImpl::setBandInterferenceConfig(ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::requestBandInterferenceConfig(ServerContext* context,
-    const dataStub::BandInterferenceRequest* request,
-    dataStub::BandInterferenceReply* response) {
+grpc::Status DataSettingsServerImpl::requestBandInterferenceConfig(
+    const dataStub::BandInterferenceRequest* request, dataStub::BandInterferenceReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
@@ -252,9 +253,8 @@ grpc::Status DataSettingsServerImpl::requestBandInterferenceConfig(ServerContext
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::SetWwanConnectivityConfig(ServerContext* context,
-    const dataStub::SetWwanConnectivityConfigRequest* request,
-    dataStub::DefaultReply* response) {
+grpc::Status DataSettingsServerImpl::SetWwanConnectivityConfig(
+    const dataStub::SetWwanConnectivityConfigRequest* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
@@ -282,15 +282,14 @@ grpc::Status DataSettingsServerImpl::SetWwanConnectivityConfig(ServerContext* co
         bool isAllowed = request->is_wwan_connectivity_allowed();
         data.stateRootObj[subsystem][stateMethod]["isAllowed"][slotIdx] = isAllowed;
 
-        auto f = std::async(std::launch::async,
+        auto f = telux::common::TimerService::getInstance()->runAfter(data.cbDelay + 100,
             [this, slotId, isAllowed, data]() {
-                std::this_thread::sleep_for(std::chrono::milliseconds(data.cbDelay + 100));
                 //stopping active datacalls on the requested slot_id
                 if ((!isAllowed) && (this->dcmServerImpl_)) {
                     this->dcmServerImpl_->stopActiveDataCalls(
                         static_cast<SlotId>(slotId));
                 }
-            }).share();
+            });
         taskQ_->add(f);
 
         JsonParser::writeToJsonFile(data.stateRootObj, stateJsonPath);
@@ -303,7 +302,7 @@ grpc::Status DataSettingsServerImpl::SetWwanConnectivityConfig(ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::RequestWwanConnectivityConfig(ServerContext* context,
+grpc::Status DataSettingsServerImpl::RequestWwanConnectivityConfig(
     const dataStub::WwanConnectivityConfigRequest* request,
     dataStub::WwanConnectivityConfigReply* response) {
 
@@ -340,8 +339,7 @@ grpc::Status DataSettingsServerImpl::RequestWwanConnectivityConfig(ServerContext
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::SetMacSecState(ServerContext* context,
-    const dataStub::SetMacSecStateRequest* request,
+grpc::Status DataSettingsServerImpl::SetMacSecState(const dataStub::SetMacSecStateRequest* request,
     dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -374,8 +372,7 @@ grpc::Status DataSettingsServerImpl::SetMacSecState(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::RequestMacSecState(ServerContext* context,
-    const dataStub::MacSecStateRequest* request,
+grpc::Status DataSettingsServerImpl::RequestMacSecState(const dataStub::MacSecStateRequest* request,
     dataStub::MacSecStateReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -408,9 +405,8 @@ grpc::Status DataSettingsServerImpl::RequestMacSecState(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::setBackhaulPreference(ServerContext* context,
-    const dataStub::setBackhaulPreferenceRequest* request,
-    dataStub::DefaultReply* response) {
+grpc::Status DataSettingsServerImpl::setBackhaulPreference(
+    const dataStub::setBackhaulPreferenceRequest* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
@@ -447,7 +443,7 @@ grpc::Status DataSettingsServerImpl::setBackhaulPreference(ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::requestBackhaulPreference(ServerContext* context,
+grpc::Status DataSettingsServerImpl::requestBackhaulPreference(
     const dataStub::RequestBackhaulPreference* request,
     dataStub::BackhaulPreferenceReply* response) {
 
@@ -484,8 +480,7 @@ grpc::Status DataSettingsServerImpl::requestBackhaulPreference(ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::switchBackHaul(ServerContext* context,
-    const dataStub::switchBackHaulRequest* request,
+grpc::Status DataSettingsServerImpl::switchBackHaul(const dataStub::switchBackHaulRequest* request,
     dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -522,8 +517,8 @@ grpc::Status DataSettingsServerImpl::switchBackHaul(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::setIpPassThroughConfig(ServerContext* context,
-        const dataStub::setIpptConfigRequest* request, dataStub::setIpptConfigReply* response) {
+grpc::Status DataSettingsServerImpl::setIpPassThroughConfig(
+    const dataStub::setIpptConfigRequest* request, dataStub::setIpptConfigReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
@@ -610,9 +605,8 @@ grpc::Status DataSettingsServerImpl::setIpPassThroughConfig(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::getIpPassThroughConfig(ServerContext* context,
-        const dataStub::getIpptConfigRequest* request,
-        dataStub::getIpptConfigReply* response) {
+grpc::Status DataSettingsServerImpl::getIpPassThroughConfig(
+    const dataStub::getIpptConfigRequest* request, dataStub::getIpptConfigReply* response) {
 
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
     std::string stateJsonPath = DATA_SETTINGS_STATE_JSON;
@@ -663,8 +657,8 @@ grpc::Status DataSettingsServerImpl::getIpPassThroughConfig(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::GetIpPassThroughNatConfig(ServerContext* context,
-        const google::protobuf::Empty *request, dataStub::getIpptNatConfigReply* response) {
+grpc::Status DataSettingsServerImpl::GetIpPassThroughNatConfig(
+    const google::protobuf::Empty *request, dataStub::getIpptNatConfigReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
@@ -693,9 +687,8 @@ grpc::Status DataSettingsServerImpl::GetIpPassThroughNatConfig(ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::SetIpPassThroughNatConfig(ServerContext* context,
-        const dataStub::setIpptNatConfigRequest* request,
-        dataStub::setIpptNatConfigReply* response) {
+grpc::Status DataSettingsServerImpl::SetIpPassThroughNatConfig(
+    const dataStub::setIpptNatConfigRequest* request, dataStub::setIpptNatConfigReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
@@ -733,8 +726,8 @@ grpc::Status DataSettingsServerImpl::SetIpPassThroughNatConfig(ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status DataSettingsServerImpl::getIpConfig(ServerContext* context,
-        const dataStub::getIpConfigRequest* request, dataStub::getIpConfigReply* response) {
+grpc::Status DataSettingsServerImpl::getIpConfig(const dataStub::getIpConfigRequest* request,
+    dataStub::getIpConfigReply* response) {
 
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
     std::string stateJsonPath = DATA_SETTINGS_STATE_JSON;
@@ -927,8 +920,8 @@ telux::common::ErrorCode DataSettingsServerImpl::modifyIpConfig(IpConfigStruct &
     }
 }
 
-grpc::Status DataSettingsServerImpl::setIpConfig(ServerContext* context,
-        const dataStub::setIpConfigRequest* request, dataStub::setIpConfigReply* response) {
+grpc::Status DataSettingsServerImpl::setIpConfig(const dataStub::setIpConfigRequest* request,
+    dataStub::setIpConfigReply* response) {
     std::string apiJsonPath = DATA_SETTINGS_API_LOCAL_JSON;
     std::string stateJsonPath = DATA_SETTINGS_STATE_JSON;
     std::string subsystem = "IDataSettingsManager";
@@ -1159,3 +1152,125 @@ bool DataSettingsServerImpl::isIpConfigSame(const telux::data::IpAddrInfo &newIp
     }
     return true;
 }
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::InitService(grpc::CallbackServerContext* context,
+    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::SetDdsSwitch(grpc::CallbackServerContext* context,
+    const dataStub::SetDdsSwitchRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetDdsSwitch(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::RequestCurrentDdsSwitch(
+    grpc::CallbackServerContext* context, const dataStub::CurrentDdsSwitchRequest* request,
+    dataStub::CurrentDdsSwitchResponse* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestCurrentDdsSwitch(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::setBandInterferenceConfig(
+    grpc::CallbackServerContext* context, const dataStub::BandInterferenceConfig* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setBandInterferenceConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::requestBandInterferenceConfig(
+    grpc::CallbackServerContext* context, const dataStub::BandInterferenceRequest* request,
+    dataStub::BandInterferenceReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return requestBandInterferenceConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::SetWwanConnectivityConfig(
+    grpc::CallbackServerContext* context, const dataStub::SetWwanConnectivityConfigRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetWwanConnectivityConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::RequestWwanConnectivityConfig(
+    grpc::CallbackServerContext* context, const dataStub::WwanConnectivityConfigRequest* request,
+    dataStub::WwanConnectivityConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestWwanConnectivityConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::SetMacSecState(
+    grpc::CallbackServerContext* context, const dataStub::SetMacSecStateRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetMacSecState(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::RequestMacSecState(
+    grpc::CallbackServerContext* context, const dataStub::MacSecStateRequest* request,
+    dataStub::MacSecStateReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestMacSecState(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::setBackhaulPreference(
+    grpc::CallbackServerContext* context, const dataStub::setBackhaulPreferenceRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setBackhaulPreference(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::requestBackhaulPreference(
+    grpc::CallbackServerContext* context, const dataStub::RequestBackhaulPreference* request,
+    dataStub::BackhaulPreferenceReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return requestBackhaulPreference(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::switchBackHaul(
+    grpc::CallbackServerContext* context, const dataStub::switchBackHaulRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return switchBackHaul(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::setIpPassThroughConfig(
+    grpc::CallbackServerContext* context, const dataStub::setIpptConfigRequest* request,
+    dataStub::setIpptConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setIpPassThroughConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::getIpPassThroughConfig(
+    grpc::CallbackServerContext* context, const dataStub::getIpptConfigRequest* request,
+    dataStub::getIpptConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return getIpPassThroughConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::getIpConfig(grpc::CallbackServerContext* context,
+    const dataStub::getIpConfigRequest* request, dataStub::getIpConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return getIpConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::setIpConfig(grpc::CallbackServerContext* context,
+    const dataStub::setIpConfigRequest* request, dataStub::setIpConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setIpConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::GetIpPassThroughNatConfig(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    dataStub::getIpptNatConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetIpPassThroughNatConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* DataSettingsServerImpl::SetIpPassThroughNatConfig(
+    grpc::CallbackServerContext* context, const dataStub::setIpptNatConfigRequest* request,
+    dataStub::setIpptNatConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetIpPassThroughNatConfig(request, response); });
+}
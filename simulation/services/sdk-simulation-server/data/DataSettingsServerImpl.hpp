@@ -18,82 +18,115 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class DataSettingsServerImpl final:
-    public dataStub::DataSettingsManager::Service {
+    public dataStub::DataSettingsManager::CallbackService {
 public:
     DataSettingsServerImpl(
         std::shared_ptr<DataConnectionServerImpl> dcmServerImpl);
     ~DataSettingsServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::InitRequest* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status SetDdsSwitch(ServerContext* context,
-        const dataStub::SetDdsSwitchRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* SetDdsSwitch(grpc::CallbackServerContext* context,
+        const dataStub::SetDdsSwitchRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestCurrentDdsSwitch(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestCurrentDdsSwitch(grpc::CallbackServerContext* context,
         const dataStub::CurrentDdsSwitchRequest* request,
         dataStub::CurrentDdsSwitchResponse* response) override;
 
-    grpc::Status setBandInterferenceConfig(ServerContext* context,
-        const dataStub::BandInterferenceConfig* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* setBandInterferenceConfig(grpc::CallbackServerContext* context,
+        const dataStub::BandInterferenceConfig* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status requestBandInterferenceConfig(ServerContext* context,
+    grpc::ServerUnaryReactor* requestBandInterferenceConfig(grpc::CallbackServerContext* context,
         const dataStub::BandInterferenceRequest* request,
         dataStub::BandInterferenceReply* response) override;
 
-    grpc::Status SetWwanConnectivityConfig(ServerContext* context,
+    grpc::ServerUnaryReactor* SetWwanConnectivityConfig(grpc::CallbackServerContext* context,
         const dataStub::SetWwanConnectivityConfigRequest* request,
         dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestWwanConnectivityConfig(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestWwanConnectivityConfig(grpc::CallbackServerContext* context,
         const dataStub::WwanConnectivityConfigRequest* request,
         dataStub::WwanConnectivityConfigReply* response) override;
 
-    grpc::Status SetMacSecState(ServerContext* context,
-        const dataStub::SetMacSecStateRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* SetMacSecState(grpc::CallbackServerContext* context,
+        const dataStub::SetMacSecStateRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestMacSecState(ServerContext* context,
-        const dataStub::MacSecStateRequest* request,
-        dataStub::MacSecStateReply* response) override;
+    grpc::ServerUnaryReactor* RequestMacSecState(grpc::CallbackServerContext* context,
+        const dataStub::MacSecStateRequest* request, dataStub::MacSecStateReply* response) override;
 
-    grpc::Status setBackhaulPreference(ServerContext* context,
+    grpc::ServerUnaryReactor* setBackhaulPreference(grpc::CallbackServerContext* context,
         const dataStub::setBackhaulPreferenceRequest* request,
         dataStub::DefaultReply* response) override;
 
-    grpc::Status requestBackhaulPreference(ServerContext* context,
+    grpc::ServerUnaryReactor* requestBackhaulPreference(grpc::CallbackServerContext* context,
         const dataStub::RequestBackhaulPreference* request,
         dataStub::BackhaulPreferenceReply* response) override;
 
-    grpc::Status switchBackHaul(ServerContext* context,
-        const dataStub::switchBackHaulRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* switchBackHaul(grpc::CallbackServerContext* context,
+        const dataStub::switchBackHaulRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status setIpPassThroughConfig(ServerContext* context,
-        const dataStub::setIpptConfigRequest* request, dataStub::setIpptConfigReply* response)
-        override;
+    grpc::ServerUnaryReactor* setIpPassThroughConfig(grpc::CallbackServerContext* context,
+        const dataStub::setIpptConfigRequest* request,
+        dataStub::setIpptConfigReply* response) override;
 
-    grpc::Status getIpPassThroughConfig(ServerContext* context,
+    grpc::ServerUnaryReactor* getIpPassThroughConfig(grpc::CallbackServerContext* context,
         const dataStub::getIpptConfigRequest* request,
         dataStub::getIpptConfigReply* response) override;
 
-    grpc::Status getIpConfig(ServerContext* context, const dataStub::getIpConfigRequest* request,
-            dataStub::getIpConfigReply* response) override;
+    grpc::ServerUnaryReactor* getIpConfig(grpc::CallbackServerContext* context,
+        const dataStub::getIpConfigRequest* request, dataStub::getIpConfigReply* response) override;
 
-    grpc::Status setIpConfig(ServerContext* context, const dataStub::setIpConfigRequest* request,
-            dataStub::setIpConfigReply* response) override;
+    grpc::ServerUnaryReactor* setIpConfig(grpc::CallbackServerContext* context,
+        const dataStub::setIpConfigRequest* request, dataStub::setIpConfigReply* response) override;
 
-    grpc::Status GetIpPassThroughNatConfig(ServerContext* context,
-            const google::protobuf::Empty *request,
-            dataStub::getIpptNatConfigReply* response) override;
+    grpc::ServerUnaryReactor* GetIpPassThroughNatConfig(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, dataStub::getIpptNatConfigReply* response) override;
 
-    grpc::Status SetIpPassThroughNatConfig(ServerContext* context,
-            const dataStub::setIpptNatConfigRequest* request,
-            dataStub::setIpptNatConfigReply* response) override;
+    grpc::ServerUnaryReactor* SetIpPassThroughNatConfig(grpc::CallbackServerContext* context,
+        const dataStub::setIpptNatConfigRequest* request,
+        dataStub::setIpptNatConfigReply* response) override;
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::InitRequest* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status SetDdsSwitch(const dataStub::SetDdsSwitchRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestCurrentDdsSwitch(const dataStub::CurrentDdsSwitchRequest* request,
+        dataStub::CurrentDdsSwitchResponse* response);
+    grpc::Status setBandInterferenceConfig(const dataStub::BandInterferenceConfig* request,
+        dataStub::DefaultReply* response);
+    grpc::Status requestBandInterferenceConfig(const dataStub::BandInterferenceRequest* request,
+        dataStub::BandInterferenceReply* response);
+    grpc::Status SetWwanConnectivityConfig(
+        const dataStub::SetWwanConnectivityConfigRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestWwanConnectivityConfig(
+        const dataStub::WwanConnectivityConfigRequest* request,
+        dataStub::WwanConnectivityConfigReply* response);
+    grpc::Status SetMacSecState(const dataStub::SetMacSecStateRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestMacSecState(const dataStub::MacSecStateRequest* request,
+        dataStub::MacSecStateReply* response);
+    grpc::Status setBackhaulPreference(const dataStub::setBackhaulPreferenceRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status requestBackhaulPreference(const dataStub::RequestBackhaulPreference* request,
+        dataStub::BackhaulPreferenceReply* response);
+    grpc::Status switchBackHaul(const dataStub::switchBackHaulRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status setIpPassThroughConfig(const dataStub::setIpptConfigRequest* request,
+        dataStub::setIpptConfigReply* response);
+    grpc::Status getIpPassThroughConfig(const dataStub::getIpptConfigRequest* request,
+        dataStub::getIpptConfigReply* response);
+    grpc::Status getIpConfig(const dataStub::getIpConfigRequest* request,
+        dataStub::getIpConfigReply* response);
+    grpc::Status setIpConfig(const dataStub::setIpConfigRequest* request,
+        dataStub::setIpConfigReply* response);
+    grpc::Status GetIpPassThroughNatConfig(const google::protobuf::Empty* request,
+        dataStub::getIpptNatConfigReply* response);
+    grpc::Status SetIpPassThroughNatConfig(const dataStub::setIpptNatConfigRequest* request,
+        dataStub::setIpptNatConfigReply* response);
+
 
     struct IpConfigStruct {
         uint32_t vlanId = -1;
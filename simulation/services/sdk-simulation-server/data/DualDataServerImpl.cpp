@@ -11,6 +11,7 @@
 #include "libs/common/CommonUtils.hpp"
 #include "common/event-manager/EventParserUtil.hpp"
 #include "event/EventService.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define DUAL_DATA_MANAGER_API_JSON "api/data/IDualDataManager.json"
 #define DUAL_DATA_MANAGER_STATE_JSON "system-state/data/IDualDataManagerState.json"
@@ -29,8 +30,8 @@ DualDataServerImpl::~DualDataServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status DualDataServerImpl::InitService(ServerContext* context,
-    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status DualDataServerImpl::InitService(const dataStub::InitRequest* request,
+    dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootObj;
@@ -60,8 +61,8 @@ grpc::Status DualDataServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DualDataServerImpl::GetDualDataCapability(ServerContext* context,
-    const ::google::protobuf::Empty* request, dataStub::GetDualDataCapabilityReply* response) {
+grpc::Status DualDataServerImpl::GetDualDataCapability(const ::google::protobuf::Empty* request,
+    dataStub::GetDualDataCapabilityReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = DUAL_DATA_MANAGER_API_JSON;
@@ -85,7 +86,7 @@ grpc::Status DualDataServerImpl::GetDualDataCapability(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status DualDataServerImpl::GetDualDataUsageRecommendation(ServerContext* context,
+grpc::Status DualDataServerImpl::GetDualDataUsageRecommendation(
     const ::google::protobuf::Empty* request,
     dataStub::GetDualDataUsageRecommendationReply* response) {
 
@@ -209,4 +210,24 @@ void DualDataServerImpl::handleRecommendationChnageRequest(std::string event) {
     //posting the event to EventService event queue
     auto& eventImpl = EventService::getInstance();
     eventImpl.updateEventQueue(anyResponse);
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* DualDataServerImpl::InitService(grpc::CallbackServerContext* context,
+    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* DualDataServerImpl::GetDualDataCapability(
+    grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request,
+    dataStub::GetDualDataCapabilityReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetDualDataCapability(request, response); });
+}
+
+grpc::ServerUnaryReactor* DualDataServerImpl::GetDualDataUsageRecommendation(
+    grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request,
+    dataStub::GetDualDataUsageRecommendationReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetDualDataUsageRecommendation(request, response); });
+}
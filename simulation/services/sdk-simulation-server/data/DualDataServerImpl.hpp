@@ -18,28 +18,35 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class DualDataServerImpl final:
-    public dataStub::DualDataManager::Service,
+    public dataStub::DualDataManager::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<DualDataServerImpl> {
 public:
     DualDataServerImpl();
     ~DualDataServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::InitRequest* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status GetDualDataCapability(ServerContext* context,
+    grpc::ServerUnaryReactor* GetDualDataCapability(grpc::CallbackServerContext* context,
         const ::google::protobuf::Empty* request,
         dataStub::GetDualDataCapabilityReply* response) override;
 
-    grpc::Status GetDualDataUsageRecommendation(ServerContext* context,
+    grpc::ServerUnaryReactor* GetDualDataUsageRecommendation(grpc::CallbackServerContext* context,
         const ::google::protobuf::Empty* request,
         dataStub::GetDualDataUsageRecommendationReply* response) override;
 
     void onEventUpdate(::eventService::UnsolicitedEvent event) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::InitRequest* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status GetDualDataCapability(const ::google::protobuf::Empty* request,
+        dataStub::GetDualDataCapabilityReply* response);
+    grpc::Status GetDualDataUsageRecommendation(const ::google::protobuf::Empty* request,
+        dataStub::GetDualDataUsageRecommendationReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
 
     ::dataStub::UsageRecommendation::Recommendation
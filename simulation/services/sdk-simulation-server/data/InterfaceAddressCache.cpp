@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "InterfaceAddressCache.hpp"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <ifaddrs.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "libs/common/Logger.hpp"
+
+InterfaceAddressCache::InterfaceAddressCache(ChangeCallback onChange)
+   : onChange_(onChange) {
+    LOG(DEBUG, __FUNCTION__);
+    std::set<std::string> changed;
+    if (!open() || !dump(changed) || (pipe2(wakeFds_, O_CLOEXEC) < 0)) {
+        LOG(ERROR, __FUNCTION__, " netlink unavailable, addresses are read on each lookup");
+        if (nlFd_ >= 0) {
+            close(nlFd_);
+            nlFd_ = -1;
+        }
+        return;
+    }
+    isRunning_ = true;
+    listener_ = std::thread(&InterfaceAddressCache::listen, this);
+}
+
+InterfaceAddressCache::~InterfaceAddressCache() {
+    LOG(DEBUG, __FUNCTION__);
+    isRunning_ = false;
+    if (wakeFds_[1] >= 0) {
+        char wake = 0;
+        ssize_t written = write(wakeFds_[1], &wake, sizeof(wake));
+        (void)written;
+    }
+    if (listener_.joinable()) {
+        listener_.join();
+    }
+    for (int fd : {nlFd_, wakeFds_[0], wakeFds_[1]}) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+bool InterfaceAddressCache::open() {
+    nlFd_ = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (nlFd_ < 0) {
+        LOG(ERROR, __FUNCTION__, " socket failed, errno ", errno);
+        return false;
+    }
+    struct sockaddr_nl local;
+    memset(&local, 0, sizeof(local));
+    local.nl_family = AF_NETLINK;
+    local.nl_groups = RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+    if (bind(nlFd_, reinterpret_cast<struct sockaddr *>(&local), sizeof(local)) < 0) {
+        LOG(ERROR, __FUNCTION__, " bind failed, errno ", errno);
+        return false;
+    }
+    return true;
+}
+
+bool InterfaceAddressCache::requestDump() {
+    struct {
+        struct nlmsghdr header;
+        struct ifaddrmsg msg;
+    } request;
+    memset(&request, 0, sizeof(request));
+    request.header.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifaddrmsg));
+    request.header.nlmsg_type = RTM_GETADDR;
+    request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.header.nlmsg_seq = ++dumpSeq_;
+    request.msg.ifa_family = AF_UNSPEC;
+
+    struct sockaddr_nl kernel;
+    memset(&kernel, 0, sizeof(kernel));
+    kernel.nl_family = AF_NETLINK;
+    if (sendto(nlFd_, &request, request.header.nlmsg_len, 0,
+        reinterpret_cast<struct sockaddr *>(&kernel), sizeof(kernel)) < 0) {
+        LOG(ERROR, __FUNCTION__, " sendto failed, errno ", errno);
+        return false;
+    }
+    return true;
+}
+
+bool InterfaceAddressCache::dump(std::set<std::string> &changed) {
+    if (!requestDump()) {
+        return false;
+    }
+    // The addresses are read aside so the lookups meanwhile still find the current ones.
+    // The notifications received meanwhile are applied to the new content as well.
+    AddressMap dumped;
+    std::set<std::string> ignored;
+    bool isDumpDone = false;
+    while (!isDumpDone) {
+        int error = receive(dumped, ignored, isDumpDone);
+        if ((error != 0) && (error != EINTR)) {
+            LOG(ERROR, __FUNCTION__, " address dump failed, errno ", error);
+            return false;
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    diff(addresses_, dumped, changed);
+    addresses_.swap(dumped);
+    LOG(DEBUG, __FUNCTION__, " interfaces with addresses: ", addresses_.size());
+    return true;
+}
+
+int InterfaceAddressCache::receive(AddressMap &addresses, std::set<std::string> &changed,
+    bool &isDumpDone) {
+    std::vector<char> buffer(RECV_BUFFER_SIZE);
+    ssize_t length = recv(nlFd_, buffer.data(), buffer.size(), 0);
+    if (length < 0) {
+        return errno;
+    }
+    int remaining = static_cast<int>(length);
+    for (struct nlmsghdr *msg = reinterpret_cast<struct nlmsghdr *>(buffer.data());
+        NLMSG_OK(msg, static_cast<uint32_t>(remaining)); msg = NLMSG_NEXT(msg, remaining)) {
+        switch (msg->nlmsg_type) {
+            case NLMSG_DONE:
+                if (msg->nlmsg_seq == dumpSeq_) {
+                    isDumpDone = true;
+                }
+                break;
+            case NLMSG_ERROR:
+                if (msg->nlmsg_seq == dumpSeq_) {
+                    LOG(ERROR, __FUNCTION__, " address dump rejected");
+                    isDumpDone = true;
+                }
+                break;
+            case RTM_NEWADDR:
+            case RTM_DELADDR:
+                handleAddressMessage(msg, addresses, changed);
+                break;
+            default:
+                break;
+        }
+    }
+    return 0;
+}
+
+void InterfaceAddressCache::handleAddressMessage(struct nlmsghdr *msg,
+    AddressMap &addresses, std::set<std::string> &changed) {
+    struct ifaddrmsg *ifa = static_cast<struct ifaddrmsg *>(NLMSG_DATA(msg));
+    if ((ifa->ifa_family != AF_INET) && (ifa->ifa_family != AF_INET6)) {
+        return;
+    }
+    void *local = nullptr;
+    void *address = nullptr;
+    int length = IFA_PAYLOAD(msg);
+    for (struct rtattr *attr = IFA_RTA(ifa); RTA_OK(attr, length);
+        attr = RTA_NEXT(attr, length)) {
+        if (attr->rta_type == IFA_LOCAL) {
+            local = RTA_DATA(attr);
+        } else if (attr->rta_type == IFA_ADDRESS) {
+            address = RTA_DATA(attr);
+        }
+    }
+    // On point to point links IFA_ADDRESS is the peer, IFA_LOCAL the interface address
+    void *addr = local ? local : address;
+    if (!addr) {
+        return;
+    }
+    if ((ifa->ifa_family == AF_INET6)
+        && IN6_IS_ADDR_LINKLOCAL(static_cast<struct in6_addr *>(addr))) {
+        return;
+    }
+    char text[INET6_ADDRSTRLEN];
+    if (!inet_ntop(ifa->ifa_family, addr, text, sizeof(text))) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string name;
+    char ifName[IF_NAMESIZE];
+    int index = static_cast<int>(ifa->ifa_index);
+    if (if_indextoname(ifa->ifa_index, ifName)) {
+        name = ifName;
+        indexNames_[index] = name;
+    } else {
+        auto known = indexNames_.find(index);
+        if (known == indexNames_.end()) {
+            return;
+        }
+        name = known->second;
+    }
+
+    Addresses &entry = addresses[name];
+    std::vector<std::string> &list = (ifa->ifa_family == AF_INET) ? entry.ipv4 : entry.ipv6;
+    auto it = std::find(list.begin(), list.end(), text);
+    if (msg->nlmsg_type == RTM_NEWADDR) {
+        if (it == list.end()) {
+            list.push_back(text);
+            changed.insert(name);
+        }
+    } else if (it != list.end()) {
+        list.erase(it);
+        changed.insert(name);
+    }
+    if (entry.ipv4.empty() && entry.ipv6.empty()) {
+        addresses.erase(name);
+    }
+}
+
+void InterfaceAddressCache::listen() {
+    LOG(DEBUG, __FUNCTION__);
+    while (isRunning_) {
+        struct pollfd fds[2];
+        fds[0].fd = nlFd_;
+        fds[0].events = POLLIN;
+        fds[1].fd = wakeFds_[0];
+        fds[1].events = POLLIN;
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOG(ERROR, __FUNCTION__, " poll failed, errno ", errno);
+            break;
+        }
+        if (fds[1].revents) {
+            break;
+        }
+        std::set<std::string> changed;
+        bool isDumpDone = false;
+        int error = receive(addresses_, changed, isDumpDone);
+        if (error == ENOBUFS) {
+            // Notifications were dropped, read all the addresses again
+            LOG(INFO, __FUNCTION__, " netlink overrun, resyncing addresses");
+            changed.clear();
+            if (!dump(changed)) {
+                break;
+            }
+        } else if ((error != 0) && (error != EINTR) && (error != EAGAIN)) {
+            LOG(ERROR, __FUNCTION__, " recv failed, errno ", error);
+            break;
+        }
+        if (!changed.empty() && onChange_) {
+            onChange_(changed);
+        }
+    }
+
+    if (isRunning_) {
+        // The cache can't be kept up to date anymore
+        LOG(ERROR, __FUNCTION__, " netlink lost, addresses are read on each lookup");
+        std::lock_guard<std::mutex> lock(mutex_);
+        close(nlFd_);
+        nlFd_ = -1;
+        addresses_.clear();
+    }
+}
+
+bool InterfaceAddressCache::readAddresses(AddressMap &addresses) {
+    struct ifaddrs *ifaceAddresses;
+    if (getifaddrs(&ifaceAddresses) < 0) {
+        LOG(ERROR, __FUNCTION__, " failure in fetching n/w interfaces");
+        return false;
+    }
+    for (struct ifaddrs *ifaddr = ifaceAddresses; ifaddr; ifaddr = ifaddr->ifa_next) {
+        if (!ifaddr->ifa_addr) {
+            continue;
+        }
+        int family = ifaddr->ifa_addr->sa_family;
+        char text[INET6_ADDRSTRLEN];
+        if (family == AF_INET) {
+            auto ipAddr = reinterpret_cast<struct sockaddr_in *>(ifaddr->ifa_addr);
+            inet_ntop(AF_INET, &ipAddr->sin_addr, text, sizeof(text));
+            addresses[ifaddr->ifa_name].ipv4.push_back(text);
+        } else if (family == AF_INET6) {
+            auto ipAddr = reinterpret_cast<struct sockaddr_in6 *>(ifaddr->ifa_addr);
+            if (IN6_IS_ADDR_LINKLOCAL(&ipAddr->sin6_addr)) {
+                continue;
+            }
+            inet_ntop(AF_INET6, &ipAddr->sin6_addr, text, sizeof(text));
+            addresses[ifaddr->ifa_name].ipv6.push_back(text);
+        }
+    }
+    freeifaddrs(ifaceAddresses);
+    return true;
+}
+
+void InterfaceAddressCache::diff(const AddressMap &before, const AddressMap &after,
+    std::set<std::string> &changed) {
+    for (auto &entry : before) {
+        auto current = after.find(entry.first);
+        if ((current == after.end()) || (current->second.ipv4 != entry.second.ipv4)
+            || (current->second.ipv6 != entry.second.ipv6)) {
+            changed.insert(entry.first);
+        }
+    }
+    for (auto &entry : after) {
+        if (before.find(entry.first) == before.end()) {
+            changed.insert(entry.first);
+        }
+    }
+}
+
+bool InterfaceAddressCache::getAddress(const std::string &ifaceName, int family,
+    std::string &address) {
+    AddressMap enumerated;
+    const AddressMap *addresses = &addresses_;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (nlFd_ < 0) {
+        lock.unlock();
+        if (!readAddresses(enumerated)) {
+            return false;
+        }
+        addresses = &enumerated;
+    }
+    auto it = addresses->find(ifaceName);
+    if (it == addresses->end()) {
+        return false;
+    }
+    const std::vector<std::string> &list =
+        (family == AF_INET) ? it->second.ipv4 : it->second.ipv6;
+    if (list.empty()) {
+        return false;
+    }
+    address = list.front();
+    return true;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       InterfaceAddressCache.hpp
+ *
+ * @brief      InterfaceAddressCache keeps the IP addresses of the host interfaces by
+ *             interface name. It is filled once from a netlink address dump and then kept
+ *             up to date from the RTNLGRP_IPV4_IFADDR and RTNLGRP_IPV6_IFADDR groups, so
+ *             looking up the address of a data call doesn't enumerate all the interfaces.
+ *             If netlink can't be used, the addresses are enumerated on every lookup.
+ */
+
+#ifndef INTERFACE_ADDRESS_CACHE_HPP
+#define INTERFACE_ADDRESS_CACHE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class InterfaceAddressCache {
+ public:
+    /* Invoked from the netlink thread with the interfaces whose addresses changed */
+    using ChangeCallback = std::function<void(const std::set<std::string> &ifaceNames)>;
+
+    InterfaceAddressCache(ChangeCallback onChange);
+    ~InterfaceAddressCache();
+
+    /**
+     * Gets the first address of the interface for the family. IPv6 link local addresses
+     * aren't kept.
+     *
+     * @param [in] family  AF_INET or AF_INET6
+     *
+     * @returns false if the interface has no such address
+     */
+    bool getAddress(const std::string &ifaceName, int family, std::string &address);
+
+ private:
+    static const size_t RECV_BUFFER_SIZE = 32 * 1024;
+
+    struct Addresses {
+        /* In the order they were assigned */
+        std::vector<std::string> ipv4;
+        std::vector<std::string> ipv6;
+    };
+
+    using AddressMap = std::unordered_map<std::string, Addresses>;
+
+    bool open();
+    /* Reads all the addresses again and reports the interfaces whose addresses changed */
+    bool dump(std::set<std::string> &changed);
+    bool requestDump();
+    void listen();
+    /* Applies the received messages to addresses, returns 0 or the errno of the failed
+     * receive */
+    int receive(AddressMap &addresses, std::set<std::string> &changed, bool &isDumpDone);
+    void handleAddressMessage(struct nlmsghdr *msg, AddressMap &addresses,
+        std::set<std::string> &changed);
+    static bool readAddresses(AddressMap &addresses);
+    static void diff(const AddressMap &before, const AddressMap &after,
+        std::set<std::string> &changed);
+
+    ChangeCallback onChange_;
+    /* Only used by the netlink thread once started, set to -1 under mutex_ when netlink
+     * fails so the lookups fall back to enumerating the addresses */
+    int nlFd_ = -1;
+    /* Written to wake the netlink thread up when the cache is destroyed */
+    int wakeFds_[2] = {-1, -1};
+    uint32_t dumpSeq_ = 0;
+    std::thread listener_;
+    std::atomic<bool> isRunning_{false};
+
+    std::mutex mutex_;
+    AddressMap addresses_;
+    /* Names of the interfaces seen, an interface is gone by the time its addresses are
+     * deleted when it is removed */
+    std::map<int, std::string> indexNames_;
+};
+
+#endif  // INTERFACE_ADDRESS_CACHE_HPP
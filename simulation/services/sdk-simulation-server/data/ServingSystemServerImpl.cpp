@@ -7,6 +7,7 @@
 #include "libs/common/Logger.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define SERVING_SYSTEM_API_SLOT1_JSON "api/data/IServingSystemManagerSlot1.json"
 #define SERVING_SYSTEM_API_SLOT2_JSON "api/data/IServingSystemManagerSlot2.json"
@@ -23,8 +24,8 @@ ServingSystemServerImpl::~ServingSystemServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status ServingSystemServerImpl::InitService(ServerContext* context,
-    const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status ServingSystemServerImpl::InitService(const dataStub::SlotInfo* request,
+    dataStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     Json::Value rootObj;
@@ -49,8 +50,7 @@ grpc::Status ServingSystemServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ServingSystemServerImpl::GetDrbStatus(ServerContext* context,
-    const dataStub::GetDrbStatusRequest* request,
+grpc::Status ServingSystemServerImpl::GetDrbStatus(const dataStub::GetDrbStatusRequest* request,
     dataStub::GetDrbStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -77,9 +77,8 @@ grpc::Status ServingSystemServerImpl::GetDrbStatus(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ServingSystemServerImpl::RequestServiceStatus(ServerContext* context,
-    const dataStub::ServingStatusRequest* request,
-    dataStub::ServiceStatusReply* response) {
+grpc::Status ServingSystemServerImpl::RequestServiceStatus(
+    const dataStub::ServingStatusRequest* request, dataStub::ServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->serving_status().slot_id() == SLOT_2)?
@@ -112,9 +111,8 @@ grpc::Status ServingSystemServerImpl::RequestServiceStatus(ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status ServingSystemServerImpl::RequestRoamingStatus(ServerContext* context,
-    const dataStub::RoamingStatusRequest* request,
-    dataStub::RomingStatusReply* response) {
+grpc::Status ServingSystemServerImpl::RequestRoamingStatus(
+    const dataStub::RoamingStatusRequest* request, dataStub::RomingStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->roaming_status().slot_id() == SLOT_2)?
@@ -145,8 +143,7 @@ grpc::Status ServingSystemServerImpl::RequestRoamingStatus(ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status ServingSystemServerImpl::RequestNrIconType(ServerContext* context,
-    const dataStub::NrIconTypeRequest* request,
+grpc::Status ServingSystemServerImpl::RequestNrIconType(const dataStub::NrIconTypeRequest* request,
     dataStub::NrIconTypeReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -177,8 +174,7 @@ grpc::Status ServingSystemServerImpl::RequestNrIconType(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ServingSystemServerImpl::MakeDormant(ServerContext* context,
-    const dataStub::MakeDormantStatusRequest* request,
+grpc::Status ServingSystemServerImpl::MakeDormant(const dataStub::MakeDormantStatusRequest* request,
     dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -279,4 +275,44 @@ dataStub::NrIconType::Type ServingSystemServerImpl::convertNrIconTypeStringToEnu
     }
 
     return ::dataStub::NrIconType::NONE;
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* ServingSystemServerImpl::InitService(grpc::CallbackServerContext* context,
+    const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingSystemServerImpl::GetDrbStatus(
+    grpc::CallbackServerContext* context, const dataStub::GetDrbStatusRequest* request,
+    dataStub::GetDrbStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetDrbStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingSystemServerImpl::RequestServiceStatus(
+    grpc::CallbackServerContext* context, const dataStub::ServingStatusRequest* request,
+    dataStub::ServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingSystemServerImpl::RequestRoamingStatus(
+    grpc::CallbackServerContext* context, const dataStub::RoamingStatusRequest* request,
+    dataStub::RomingStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestRoamingStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingSystemServerImpl::RequestNrIconType(
+    grpc::CallbackServerContext* context, const dataStub::NrIconTypeRequest* request,
+    dataStub::NrIconTypeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestNrIconType(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingSystemServerImpl::MakeDormant(grpc::CallbackServerContext* context,
+    const dataStub::MakeDormantStatusRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return MakeDormant(request, response); });
+}
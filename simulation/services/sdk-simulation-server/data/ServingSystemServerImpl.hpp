@@ -17,36 +17,48 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class ServingSystemServerImpl final:
-    public dataStub::DataServingSystemManager::Service {
+    public dataStub::DataServingSystemManager::CallbackService {
 public:
     ServingSystemServerImpl();
     ~ServingSystemServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::SlotInfo* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::SlotInfo* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status GetDrbStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* GetDrbStatus(grpc::CallbackServerContext* context,
         const dataStub::GetDrbStatusRequest* request,
         dataStub::GetDrbStatusReply* response) override;
 
-    grpc::Status RequestServiceStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestServiceStatus(grpc::CallbackServerContext* context,
         const dataStub::ServingStatusRequest* request,
         dataStub::ServiceStatusReply* response) override;
 
-    grpc::Status RequestRoamingStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestRoamingStatus(grpc::CallbackServerContext* context,
         const dataStub::RoamingStatusRequest* request,
         dataStub::RomingStatusReply* response) override;
 
-    grpc::Status RequestNrIconType(ServerContext* context,
-        const dataStub::NrIconTypeRequest* request,
-        dataStub::NrIconTypeReply* response) override;
+    grpc::ServerUnaryReactor* RequestNrIconType(grpc::CallbackServerContext* context,
+        const dataStub::NrIconTypeRequest* request, dataStub::NrIconTypeReply* response) override;
 
-    grpc::Status MakeDormant(ServerContext* context,
+    grpc::ServerUnaryReactor* MakeDormant(grpc::CallbackServerContext* context,
         const dataStub::MakeDormantStatusRequest* request,
         dataStub::DefaultReply* response) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::SlotInfo* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status GetDrbStatus(const dataStub::GetDrbStatusRequest* request,
+        dataStub::GetDrbStatusReply* response);
+    grpc::Status RequestServiceStatus(const dataStub::ServingStatusRequest* request,
+        dataStub::ServiceStatusReply* response);
+    grpc::Status RequestRoamingStatus(const dataStub::RoamingStatusRequest* request,
+        dataStub::RomingStatusReply* response);
+    grpc::Status RequestNrIconType(const dataStub::NrIconTypeRequest* request,
+        dataStub::NrIconTypeReply* response);
+    grpc::Status MakeDormant(const dataStub::MakeDormantStatusRequest* request,
+        dataStub::DefaultReply* response);
+
     dataStub::DrbStatus::Status convertDrbStatusStringToEnum(std::string status);
     dataStub::DataServiceState::ServiceState convertServiceStateStringToEnum(
         std::string ServiceState);
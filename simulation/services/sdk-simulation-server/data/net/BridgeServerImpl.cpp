@@ -9,6 +9,7 @@
 #include "libs/common/Logger.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define BRIDGE_MANAGER_API_LOCAL_JSON "api/data/IBridgeManager.json"
 #define BRIDGE_MANAGER_STATE_JSON "system-state/data/IBridgeManagerState.json"
@@ -22,8 +23,7 @@ BridgeServerImpl::~BridgeServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status BridgeServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request,
+grpc::Status BridgeServerImpl::InitService(const google::protobuf::Empty* request,
     dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -48,7 +48,7 @@ grpc::Status BridgeServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status BridgeServerImpl::SetInterfaceBridge(ServerContext* context,
+grpc::Status BridgeServerImpl::SetInterfaceBridge(
     const dataStub::SetInterfaceBridgeRequest* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -91,7 +91,7 @@ grpc::Status BridgeServerImpl::SetInterfaceBridge(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status BridgeServerImpl::GetInterfaceBridge(ServerContext* context,
+grpc::Status BridgeServerImpl::GetInterfaceBridge(
     const dataStub::GetInterfaceBridgeRequest* request,
     dataStub::GetInterfaceBridgeReply* response) {
 
@@ -122,4 +122,23 @@ grpc::Status BridgeServerImpl::GetInterfaceBridge(ServerContext* context,
     response->mutable_reply()->set_error(static_cast<commonStub::ErrorCode>(data.error));
 
     return grpc::Status::OK;
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* BridgeServerImpl::InitService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* BridgeServerImpl::SetInterfaceBridge(grpc::CallbackServerContext* context,
+    const dataStub::SetInterfaceBridgeRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetInterfaceBridge(request, response); });
+}
+
+grpc::ServerUnaryReactor* BridgeServerImpl::GetInterfaceBridge(grpc::CallbackServerContext* context,
+    const dataStub::GetInterfaceBridgeRequest* request,
+    dataStub::GetInterfaceBridgeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetInterfaceBridge(request, response); });
+}
@@ -18,24 +18,31 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class BridgeServerImpl final:
-    public dataStub::BridgeManager::Service {
+    public dataStub::BridgeManager::CallbackService {
 public:
     BridgeServerImpl();
     ~BridgeServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const google::protobuf::Empty* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status SetInterfaceBridge(ServerContext* context,
+    grpc::ServerUnaryReactor* SetInterfaceBridge(grpc::CallbackServerContext* context,
         const dataStub::SetInterfaceBridgeRequest* request,
         dataStub::DefaultReply* response) override;
 
-    grpc::Status GetInterfaceBridge(ServerContext* context,
+    grpc::ServerUnaryReactor* GetInterfaceBridge(grpc::CallbackServerContext* context,
         const dataStub::GetInterfaceBridgeRequest* request,
         dataStub::GetInterfaceBridgeReply* response) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status SetInterfaceBridge(const dataStub::SetInterfaceBridgeRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status GetInterfaceBridge(const dataStub::GetInterfaceBridgeRequest* request,
+        dataStub::GetInterfaceBridgeReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
 
     template <typename T>
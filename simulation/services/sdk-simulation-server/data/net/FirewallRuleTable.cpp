@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "FirewallRuleTable.hpp"
+
+#include <algorithm>
+
+#include <arpa/inet.h>
+
+#include "libs/common/JsonParser.hpp"
+#include "libs/common/Logger.hpp"
+
+#define FIREWALL_MANAGER "IFirewallManager"
+#define FIREWALL_ENTRY "firewallEntry"
+#define FIREWALL_CONFIG "firewallConfig"
+#define IPV4_FAMILY 4
+#define IPV6_FAMILY 6
+#define MAX_HANDLE 0x7FFFFFFF
+#define MAX_PORT 65535
+
+using telux::common::ErrorCode;
+
+FirewallRuleTable::PrefixTrie::PrefixTrie()
+   : nodes_(1)
+   , count_(0) {
+    nodes_[0].child[0] = nodes_[0].child[1] = 0;
+}
+
+void FirewallRuleTable::PrefixTrie::insert(const Prefix &prefix, uint64_t seq) {
+    int node = 0;
+    for (int bit = 0; bit < prefix.length; bit++) {
+        int value = (prefix.bytes[bit / 8] >> (7 - (bit % 8))) & 1;
+        if (nodes_[node].child[value] == 0) {
+            Node child;
+            child.child[0] = child.child[1] = 0;
+            nodes_.push_back(child);
+            nodes_[node].child[value] = static_cast<int>(nodes_.size() - 1);
+        }
+        node = nodes_[node].child[value];
+    }
+    nodes_[node].seqs.push_back(seq);
+    count_++;
+}
+
+void FirewallRuleTable::PrefixTrie::erase(const Prefix &prefix, uint64_t seq) {
+    int node = 0;
+    for (int bit = 0; bit < prefix.length; bit++) {
+        node = nodes_[node].child[(prefix.bytes[bit / 8] >> (7 - (bit % 8))) & 1];
+        if (node == 0) {
+            return;
+        }
+    }
+    auto &seqs = nodes_[node].seqs;
+    auto it = std::find(seqs.begin(), seqs.end(), seq);
+    if (it != seqs.end()) {
+        seqs.erase(it);
+        count_--;
+    }
+}
+
+void FirewallRuleTable::PrefixTrie::match(const std::array<uint8_t, 16> &address, int bits,
+    std::set<uint64_t> &seqs) const {
+    int node = 0;
+    for (int bit = 0; ; bit++) {
+        seqs.insert(nodes_[node].seqs.begin(), nodes_[node].seqs.end());
+        if (bit == bits) {
+            break;
+        }
+        node = nodes_[node].child[(address[bit / 8] >> (7 - (bit % 8))) & 1];
+        if (node == 0) {
+            break;
+        }
+    }
+}
+
+bool FirewallRuleTable::PrefixTrie::empty() const {
+    return count_ == 0;
+}
+
+FirewallRuleTable::FirewallRuleTable(const std::string &stateJsonPath)
+   : stateJsonPath_(stateJsonPath)
+   , nextSeq_(0)
+   , random_(std::random_device()())
+   , dirty_(false)
+   , timerService_(telux::common::TimerService::getInstance())
+   , flushTimerId_(telux::common::TimerService::INVALID_TIMER_ID) {
+    LOG(DEBUG, __FUNCTION__);
+    load();
+}
+
+FirewallRuleTable::~FirewallRuleTable() {
+    LOG(DEBUG, __FUNCTION__);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (flushTimerId_ != telux::common::TimerService::INVALID_TIMER_ID) {
+        timerService_->cancel(flushTimerId_);
+    }
+    flushLocked();
+}
+
+std::string FirewallRuleTable::getScope(const std::string &backhaul, int slotId,
+    int profileId) {
+    return backhaul + "/" + std::to_string(slotId) + "/" + std::to_string(profileId);
+}
+
+std::string FirewallRuleTable::getClassifierKey(const std::string &scope, int direction,
+    const std::string &protocol, int family) {
+    return scope + "/" + std::to_string(direction) + "/" + protocol + "/"
+        + std::to_string(family);
+}
+
+int FirewallRuleTable::getFamily(const std::string &ipFamily) {
+    if (ipFamily == "IPV4") {
+        return IPV4_FAMILY;
+    } else if (ipFamily == "IPV6") {
+        return IPV6_FAMILY;
+    }
+    return 0;
+}
+
+bool FirewallRuleTable::parseAddress(const std::string &address,
+    std::array<uint8_t, 16> &bytes, int &family) {
+    bytes.fill(0);
+    if (inet_pton(AF_INET, address.c_str(), bytes.data()) == 1) {
+        family = IPV4_FAMILY;
+        return true;
+    }
+    if (inet_pton(AF_INET6, address.c_str(), bytes.data()) == 1) {
+        family = IPV6_FAMILY;
+        return true;
+    }
+    return false;
+}
+
+FirewallRuleTable::Prefix FirewallRuleTable::getPrefix(const std::string &address,
+    const std::string &subnetMask) {
+    Prefix prefix;
+    int family = 0;
+    prefix.length = 0;
+    // An entry without an address matches any address
+    if (address.empty() || !parseAddress(address, prefix.bytes, family)) {
+        prefix.bytes.fill(0);
+        return prefix;
+    }
+    prefix.length = 32;
+    std::array<uint8_t, 16> mask;
+    if (!subnetMask.empty() && parseAddress(subnetMask, mask, family)) {
+        uint32_t bits = (static_cast<uint32_t>(mask[0]) << 24) | (mask[1] << 16)
+            | (mask[2] << 8) | mask[3];
+        prefix.length = 0;
+        while ((prefix.length < 32) && (bits & (0x80000000u >> prefix.length))) {
+            prefix.length++;
+        }
+    }
+    return prefix;
+}
+
+FirewallRuleTable::Prefix FirewallRuleTable::getPrefix(const std::string &address,
+    int prefixLength) {
+    Prefix prefix;
+    int family = 0;
+    prefix.length = 0;
+    if (address.empty() || !parseAddress(address, prefix.bytes, family)) {
+        prefix.bytes.fill(0);
+        return prefix;
+    }
+    prefix.length = ((prefixLength <= 0) || (prefixLength > 128)) ? 128 : prefixLength;
+    return prefix;
+}
+
+std::string FirewallRuleTable::getCanonicalPrefix(const Prefix &prefix, int family) {
+    // A prefix without length matches any address whatever its bytes are
+    if ((prefix.length == 0) || (family == 0)) {
+        return "*";
+    }
+    // Only the bits within the prefix length are matched, drop the host bits
+    std::array<uint8_t, 16> bytes;
+    bytes.fill(0);
+    for (int bit = 0; bit < prefix.length; bit++) {
+        bytes[bit / 8] |= prefix.bytes[bit / 8] & (0x80 >> (bit % 8));
+    }
+    char buf[INET6_ADDRSTRLEN];
+    if (inet_ntop((family == IPV4_FAMILY) ? AF_INET : AF_INET6, bytes.data(), buf,
+        sizeof(buf)) == nullptr) {
+        return "*";
+    }
+    return std::string(buf) + "/" + std::to_string(prefix.length);
+}
+
+void FirewallRuleTable::getPortRange(int port, int range, uint16_t &min, uint16_t &max) {
+    // Port 0 matches any port
+    if (port <= 0) {
+        min = 0;
+        max = MAX_PORT;
+        return;
+    }
+    min = static_cast<uint16_t>(std::min(port, MAX_PORT));
+    max = static_cast<uint16_t>(std::min(port + std::max(range, 0), MAX_PORT));
+}
+
+FirewallRuleTable::Entry FirewallRuleTable::makeEntry(const Json::Value &value) {
+    Entry entry;
+    entry.value = value;
+    entry.seq = 0;
+    entry.scope = getScope(value["backhaul"].asString(), value["slotId"].asInt(),
+        value["profileId"].asInt());
+    std::string ipFamily = value["ip_family_type"].asString();
+    int direction = value["fw_direction"].asInt();
+    std::string protocol = value["protocol"].asString();
+
+    if (ipFamily == "IPV4") {
+        entry.src = getPrefix(value["ipv4_srcAddr"].asString(),
+            value["ipv4_srcSubnetMask"].asString());
+        entry.dest = getPrefix(value["ipv4_destAddr"].asString(),
+            value["ipv4_destSubnetMask"].asString());
+    } else if (ipFamily == "IPV6") {
+        entry.src = getPrefix(value["ipv6_srcAddr"].asString(),
+            value["ipv6_srcPrefixLen"].asInt());
+        entry.dest = getPrefix(value["ipv6_destAddr"].asString(),
+            value["ipv6_dstPrefixLen"].asInt());
+    } else {
+        entry.src = getPrefix("", 0);
+        entry.dest = getPrefix("", 0);
+    }
+
+    if (ipFamily == "IPV4V6") {
+        entry.classifierKeys.push_back(
+            getClassifierKey(entry.scope, direction, protocol, IPV4_FAMILY));
+        entry.classifierKeys.push_back(
+            getClassifierKey(entry.scope, direction, protocol, IPV6_FAMILY));
+    } else if (getFamily(ipFamily) != 0) {
+        entry.classifierKeys.push_back(
+            getClassifierKey(entry.scope, direction, protocol, getFamily(ipFamily)));
+    }
+
+    getPortRange(value["source_port"].asInt(), value["source_port_range"].asInt(),
+        entry.srcPortMin, entry.srcPortMax);
+    getPortRange(value["dest_port"].asInt(), value["dest_port_range"].asInt(),
+        entry.destPortMin, entry.destPortMax);
+
+    // Entries matching the same packets are duplicates, however their addresses are written
+    int family = getFamily(ipFamily);
+    entry.dedupeKey = entry.scope + "/" + std::to_string(direction) + "/" + protocol + "/"
+        + ipFamily + "/" + getCanonicalPrefix(entry.src, family) + "/"
+        + getCanonicalPrefix(entry.dest, family) + "/" + std::to_string(entry.srcPortMin)
+        + "-" + std::to_string(entry.srcPortMax) + "/" + std::to_string(entry.destPortMin)
+        + "-" + std::to_string(entry.destPortMax);
+    return entry;
+}
+
+uint32_t FirewallRuleTable::newHandleLocked() {
+    std::uniform_int_distribution<uint32_t> distribution(1, MAX_HANDLE);
+    uint32_t handle;
+    do {
+        handle = distribution(random_);
+    } while (entries_.count(handle));
+    return handle;
+}
+
+void FirewallRuleTable::insertLocked(uint32_t handle, Entry entry) {
+    entry.seq = nextSeq_++;
+    entry.value["handle"] = handle;
+    order_[entry.seq] = handle;
+    dedupe_.emplace(entry.dedupeKey, handle);
+    scopes_[entry.scope].insert(entry.seq);
+    for (auto &key : entry.classifierKeys) {
+        Classifier &classifier = classifiers_[key];
+        classifier.src.insert(entry.src, entry.seq);
+        classifier.dest.insert(entry.dest, entry.seq);
+    }
+    entries_[handle] = std::move(entry);
+}
+
+void FirewallRuleTable::load() {
+    Json::Value rootObj;
+    if (JsonParser::readFromJsonFile(rootObj, stateJsonPath_) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Reading JSON File failed! ", stateJsonPath_);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Json::Value &entries = rootObj[FIREWALL_MANAGER][FIREWALL_ENTRY];
+    for (Json::ArrayIndex idx = 0; idx < entries.size(); idx++) {
+        uint32_t handle = entries[idx]["handle"].asUInt();
+        if ((handle == 0) || (handle > MAX_HANDLE) || entries_.count(handle)) {
+            handle = newHandleLocked();
+            dirty_ = true;
+        }
+        insertLocked(handle, makeEntry(entries[idx]));
+    }
+    const Json::Value &configs = rootObj[FIREWALL_MANAGER][FIREWALL_CONFIG];
+    for (Json::ArrayIndex idx = 0; idx < configs.size(); idx++) {
+        FirewallConfig config;
+        config.enable = configs[idx]["enable"].asBool();
+        config.allowPackets = configs[idx]["allowPackets"].asBool();
+        configs_[getScope(configs[idx]["backhaul"].asString(), configs[idx]["slotId"].asInt(),
+            configs[idx]["profileId"].asInt())] = config;
+    }
+    LOG(DEBUG, __FUNCTION__, " Loaded ", entries_.size(), " firewall entries");
+}
+
+ErrorCode FirewallRuleTable::add(std::vector<Json::Value> &entries, uint32_t &handle) {
+    std::vector<Entry> newEntries;
+    for (auto &value : entries) {
+        newEntries.push_back(makeEntry(value));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &entry : newEntries) {
+        if (dedupe_.count(entry.dedupeKey)) {
+            LOG(DEBUG, __FUNCTION__, " fw entry already exist.");
+            return ErrorCode::NO_EFFECT;
+        }
+    }
+    for (size_t idx = 0; idx < newEntries.size(); idx++) {
+        handle = newHandleLocked();
+        entries[idx]["handle"] = handle;
+        LOG(DEBUG, __FUNCTION__, " adding fw entry for handle::", handle);
+        insertLocked(handle, std::move(newEntries[idx]));
+    }
+    dirty_ = true;
+    scheduleFlushLocked();
+    return ErrorCode::SUCCESS;
+}
+
+ErrorCode FirewallRuleTable::remove(uint32_t handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(handle);
+    if (it == entries_.end()) {
+        return ErrorCode::INTERNAL;
+    }
+    LOG(DEBUG, __FUNCTION__, " removing fw entry for handle::", handle);
+    Entry &entry = it->second;
+    for (auto &key : entry.classifierKeys) {
+        auto classifier = classifiers_.find(key);
+        if (classifier == classifiers_.end()) {
+            continue;
+        }
+        classifier->second.src.erase(entry.src, entry.seq);
+        classifier->second.dest.erase(entry.dest, entry.seq);
+        if (classifier->second.src.empty()) {
+            classifiers_.erase(classifier);
+        }
+    }
+    auto scope = scopes_.find(entry.scope);
+    if (scope != scopes_.end()) {
+        scope->second.erase(entry.seq);
+        if (scope->second.empty()) {
+            scopes_.erase(scope);
+        }
+    }
+    auto dedupe = dedupe_.find(entry.dedupeKey);
+    if ((dedupe != dedupe_.end()) && (dedupe->second == handle)) {
+        dedupe_.erase(dedupe);
+    }
+    order_.erase(entry.seq);
+    entries_.erase(it);
+    dirty_ = true;
+    scheduleFlushLocked();
+    return ErrorCode::SUCCESS;
+}
+
+void FirewallRuleTable::getEntries(const std::string &backhaul, int slotId, int profileId,
+    bool isHwAccelerated, std::vector<Json::Value> &entries) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto scope = scopes_.find(getScope(backhaul, slotId, profileId));
+    if (scope == scopes_.end()) {
+        return;
+    }
+    for (auto seq : scope->second) {
+        const Json::Value &value = entries_[order_[seq]].value;
+        if (value["isHwAccelerated"].asBool() == isHwAccelerated) {
+            entries.push_back(value);
+        }
+    }
+}
+
+void FirewallRuleTable::setFirewallConfig(const std::string &backhaul, int slotId,
+    int profileId, bool enable, bool allowPackets) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    FirewallConfig &config = configs_[getScope(backhaul, slotId, profileId)];
+    config.enable = enable;
+    config.allowPackets = allowPackets;
+}
+
+ErrorCode FirewallRuleTable::classify(const Packet &packet, bool &isMatched, uint32_t &handle,
+    bool &isAllowed) {
+    std::array<uint8_t, 16> src;
+    std::array<uint8_t, 16> dest;
+    int srcFamily = 0;
+    int destFamily = 0;
+    if (!parseAddress(packet.srcAddr, src, srcFamily) ||
+        !parseAddress(packet.destAddr, dest, destFamily) || (srcFamily != destFamily)) {
+        LOG(ERROR, __FUNCTION__, " Invalid addresses ", packet.srcAddr, ", ",
+            packet.destAddr);
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    int bits = (srcFamily == IPV4_FAMILY) ? 32 : 128;
+    std::string scope = getScope(packet.backhaul, packet.slotId, packet.profileId);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    isMatched = false;
+    handle = 0;
+    auto classifier = classifiers_.find(
+        getClassifierKey(scope, packet.direction, packet.protocol, srcFamily));
+    if (classifier != classifiers_.end()) {
+        std::set<uint64_t> srcMatches;
+        std::set<uint64_t> destMatches;
+        classifier->second.src.match(src, bits, srcMatches);
+        if (!srcMatches.empty()) {
+            classifier->second.dest.match(dest, bits, destMatches);
+        }
+        // Both sets are ordered, the first common entry within the port ranges wins
+        for (auto seq : srcMatches) {
+            if (!destMatches.count(seq)) {
+                continue;
+            }
+            const Entry &entry = entries_[order_[seq]];
+            if ((packet.srcPort < entry.srcPortMin) || (packet.srcPort > entry.srcPortMax) ||
+                (packet.destPort < entry.destPortMin) ||
+                (packet.destPort > entry.destPortMax)) {
+                continue;
+            }
+            isMatched = true;
+            handle = order_[seq];
+            break;
+        }
+    }
+
+    isAllowed = true;
+    auto config = configs_.find(scope);
+    if ((config != configs_.end()) && config->second.enable) {
+        isAllowed = config->second.allowPackets ? isMatched : !isMatched;
+    }
+    LOG(DEBUG, __FUNCTION__, " matched::", isMatched, " handle::", handle,
+        " allowed::", isAllowed);
+    return ErrorCode::SUCCESS;
+}
+
+void FirewallRuleTable::scheduleFlushLocked() {
+    if (flushTimerId_ != telux::common::TimerService::INVALID_TIMER_ID) {
+        return;
+    }
+    std::weak_ptr<FirewallRuleTable> weakSelf = shared_from_this();
+    timerService_->runAfter(FLUSH_INTERVAL_MS, [weakSelf]() {
+        if (auto self = weakSelf.lock()) {
+            std::lock_guard<std::mutex> lock(self->mutex_);
+            self->flushTimerId_ = telux::common::TimerService::INVALID_TIMER_ID;
+            self->flushLocked();
+        }
+    }, &flushTimerId_);
+}
+
+void FirewallRuleTable::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (flushTimerId_ != telux::common::TimerService::INVALID_TIMER_ID) {
+        timerService_->cancel(flushTimerId_);
+        flushTimerId_ = telux::common::TimerService::INVALID_TIMER_ID;
+    }
+    flushLocked();
+}
+
+void FirewallRuleTable::flushLocked() {
+    if (!dirty_) {
+        return;
+    }
+    Json::Value rootObj;
+    if (JsonParser::readFromJsonFile(rootObj, stateJsonPath_) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Reading JSON File failed! ", stateJsonPath_);
+        return;
+    }
+    // Only the entries are owned by the table, the rest of the file is left as is
+    Json::Value entries(Json::arrayValue);
+    for (auto &seq : order_) {
+        entries.append(entries_[seq.second].value);
+    }
+    rootObj[FIREWALL_MANAGER][FIREWALL_ENTRY] = entries;
+    if (JsonParser::writeToJsonFile(rootObj, stateJsonPath_) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Writing JSON File failed! ", stateJsonPath_);
+        return;
+    }
+    LOG(DEBUG, __FUNCTION__, " Wrote ", entries.size(), " firewall entries");
+    dirty_ = false;
+}
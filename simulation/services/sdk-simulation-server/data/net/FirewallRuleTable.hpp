@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       FirewallRuleTable.hpp
+ *
+ * @brief      FirewallRuleTable keeps the firewall entries of the system-state file in memory.
+ *             Entries are hashed by handle and by their direction, protocol and source
+ *             address so that duplicates are found without scanning. Packets are classified
+ *             with per scope source and destination prefix tries, the entry with the lowest
+ *             insertion order whose port ranges contain the packet ports wins.
+ *             Updates are written back to the system-state file asynchronously.
+ */
+
+#ifndef FIREWALL_RULE_TABLE_HPP
+#define FIREWALL_RULE_TABLE_HPP
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <jsoncpp/json/json.h>
+#include <telux/common/CommonDefines.hpp>
+
+#include "libs/common/TimerService.hpp"
+
+class FirewallRuleTable : public std::enable_shared_from_this<FirewallRuleTable> {
+ public:
+    /* Packet to classify, addresses are textual IPv4 or IPv6 addresses */
+    struct Packet {
+        std::string backhaul;
+        int slotId;
+        int profileId;
+        int direction;
+        std::string protocol;
+        std::string srcAddr;
+        std::string destAddr;
+        uint16_t srcPort;
+        uint16_t destPort;
+    };
+
+    FirewallRuleTable(const std::string &stateJsonPath);
+    ~FirewallRuleTable();
+
+    /**
+     * Installs the entries of one request, built with the keys of the system-state file.
+     * Nothing is installed if any of them duplicates an installed entry.
+     *
+     * @param [in]  entries     Entries, their handle is assigned by the table
+     * @param [out] handle      Handle of the last entry
+     *
+     * @returns NO_EFFECT for duplicates
+     */
+    telux::common::ErrorCode add(std::vector<Json::Value> &entries, uint32_t &handle);
+
+    telux::common::ErrorCode remove(uint32_t handle);
+
+    /**
+     * Gets the entries of a backhaul in insertion order.
+     */
+    void getEntries(const std::string &backhaul, int slotId, int profileId,
+        bool isHwAccelerated, std::vector<Json::Value> &entries);
+
+    /**
+     * Updates the firewall configuration of a backhaul, used to tell whether classified
+     * packets are allowed.
+     */
+    void setFirewallConfig(const std::string &backhaul, int slotId, int profileId,
+        bool enable, bool allowPackets);
+
+    /**
+     * Finds the first entry matching the packet.
+     *
+     * @param [in]  packet      Packet to classify
+     * @param [out] isMatched   Whether an entry matched
+     * @param [out] handle      Handle of the matching entry
+     * @param [out] isAllowed   Whether the firewall configuration lets the packet through
+     *
+     * @returns INVALID_ARG if an address can't be parsed or the families differ
+     */
+    telux::common::ErrorCode classify(const Packet &packet, bool &isMatched, uint32_t &handle,
+        bool &isAllowed);
+
+    /**
+     * Writes pending updates to the system-state file.
+     */
+    void flush();
+
+ private:
+    static const int FLUSH_INTERVAL_MS = 500;
+
+    struct Prefix {
+        std::array<uint8_t, 16> bytes;
+        int length;
+    };
+
+    /* Binary trie over the address bits, a node holds the entries whose prefix ends there */
+    class PrefixTrie {
+     public:
+        PrefixTrie();
+        void insert(const Prefix &prefix, uint64_t seq);
+        void erase(const Prefix &prefix, uint64_t seq);
+        void match(const std::array<uint8_t, 16> &address, int bits,
+            std::set<uint64_t> &seqs) const;
+        bool empty() const;
+
+     private:
+        struct Node {
+            int child[2];
+            std::vector<uint64_t> seqs;
+        };
+        std::vector<Node> nodes_;
+        size_t count_;
+    };
+
+    struct Classifier {
+        PrefixTrie src;
+        PrefixTrie dest;
+    };
+
+    struct Entry {
+        Json::Value value;
+        uint64_t seq;
+        std::string scope;
+        std::string dedupeKey;
+        /* Classifier keys, two for IPV4V6 entries */
+        std::vector<std::string> classifierKeys;
+        Prefix src;
+        Prefix dest;
+        uint16_t srcPortMin;
+        uint16_t srcPortMax;
+        uint16_t destPortMin;
+        uint16_t destPortMax;
+    };
+
+    struct FirewallConfig {
+        bool enable;
+        bool allowPackets;
+    };
+
+    static std::string getScope(const std::string &backhaul, int slotId, int profileId);
+    static std::string getClassifierKey(const std::string &scope, int direction,
+        const std::string &protocol, int family);
+    static int getFamily(const std::string &ipFamily);
+    static bool parseAddress(const std::string &address, std::array<uint8_t, 16> &bytes,
+        int &family);
+    static Prefix getPrefix(const std::string &address, const std::string &subnetMask);
+    static Prefix getPrefix(const std::string &address, int prefixLength);
+    static std::string getCanonicalPrefix(const Prefix &prefix, int family);
+    static void getPortRange(int port, int range, uint16_t &min, uint16_t &max);
+
+    void load();
+    Entry makeEntry(const Json::Value &value);
+    void insertLocked(uint32_t handle, Entry entry);
+    uint32_t newHandleLocked();
+    void scheduleFlushLocked();
+    void flushLocked();
+
+    std::mutex mutex_;
+    std::string stateJsonPath_;
+    std::unordered_map<uint32_t, Entry> entries_;
+    /* Insertion order */
+    std::map<uint64_t, uint32_t> order_;
+    std::unordered_map<std::string, uint32_t> dedupe_;
+    std::unordered_map<std::string, std::set<uint64_t>> scopes_;
+    std::unordered_map<std::string, Classifier> classifiers_;
+    std::unordered_map<std::string, FirewallConfig> configs_;
+    uint64_t nextSeq_;
+    std::mt19937 random_;
+    bool dirty_;
+    std::shared_ptr<telux::common::TimerService> timerService_;
+    telux::common::TimerService::TimerId flushTimerId_;
+};
+
+#endif  // FIREWALL_RULE_TABLE_HPP
@@ -5,10 +5,9 @@
 
 #include <telux/common/DeviceConfig.hpp>
 
-#include <sys/time.h>
-
 #include "FirewallServerImpl.hpp"
 #include "libs/common/Logger.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define FIREWALL_MANAGER_API_LOCAL_JSON "api/data/IFirewallManagerLocal.json"
 #define FIREWALL_MANAGER_STATE_JSON "system-state/data/IFirewallManagerState.json"
@@ -16,14 +15,16 @@
 FirewallServerImpl::FirewallServerImpl() {
     LOG(DEBUG, __FUNCTION__);
     taskQ_ = std::make_shared<telux::common::AsyncTaskQueue<void>>();
+    ruleTable_ = std::make_shared<FirewallRuleTable>(FIREWALL_MANAGER_STATE_JSON);
 }
 
 FirewallServerImpl::~FirewallServerImpl() {
     LOG(DEBUG, __FUNCTION__);
+    ruleTable_->flush();
 }
 
-grpc::Status FirewallServerImpl::InitService(ServerContext* context,
-    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status FirewallServerImpl::InitService(const dataStub::InitRequest* request,
+    dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootObj;
@@ -47,8 +48,8 @@ grpc::Status FirewallServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FirewallServerImpl::SetFirewall(ServerContext* context,
-    const dataStub::SetFirewallRequest* request, dataStub::DefaultReply* response) {
+grpc::Status FirewallServerImpl::SetFirewall(const dataStub::SetFirewallRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = FIREWALL_MANAGER_API_LOCAL_JSON;
@@ -56,6 +57,8 @@ grpc::Status FirewallServerImpl::SetFirewall(ServerContext* context,
     std::string subsystem = "IFirewallManager";
     std::string method = "setFirewallConfig";
     JsonData data;
+    // The whole file is written back, the pending firewall entries must be in it
+    ruleTable_->flush();
     telux::common::ErrorCode error =
         CommonUtils::readJsonData(apiJsonPath, stateJsonPath, subsystem, method, data);
 
@@ -89,6 +92,13 @@ grpc::Status FirewallServerImpl::SetFirewall(ServerContext* context,
             JsonParser::writeToJsonFile(data.stateRootObj, stateJsonPath);
         }
     }
+    if (data.status == telux::common::Status::SUCCESS &&
+        data.error == telux::common::ErrorCode::SUCCESS) {
+        ruleTable_->setFirewallConfig(
+            DataUtilsStub::convertEnumToBackhaulPrefString(request->backhaul_type()),
+            request->slot_id(), request->profile_id(), request->fw_enable(),
+            request->allow_packets());
+    }
     LOG(DEBUG, __FUNCTION__, " enable::", request->fw_enable(),
         " allowPackets::", request->allow_packets());
     response->set_status(static_cast<commonStub::Status>(data.status));
@@ -98,7 +108,7 @@ grpc::Status FirewallServerImpl::SetFirewall(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FirewallServerImpl::RequestFirewallStatus(ServerContext* context,
+grpc::Status FirewallServerImpl::RequestFirewallStatus(
     const dataStub::FirewallStatusRequest* request,
     dataStub::RequestFirewallStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -138,97 +148,94 @@ grpc::Status FirewallServerImpl::RequestFirewallStatus(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FirewallServerImpl::AddFirewallEntry(ServerContext* context,
-    const dataStub::AddFirewallEntryRequest* request, dataStub::AddFirewallEntryReply* response) {
-
-    LOG(DEBUG, __FUNCTION__);
+grpc::Status FirewallServerImpl::getApiResponse(const std::string &method, JsonData &data) {
     std::string apiJsonPath = FIREWALL_MANAGER_API_LOCAL_JSON;
-    std::string stateJsonPath = FIREWALL_MANAGER_STATE_JSON;
-    std::string subsystem = "IFirewallManager";
-    std::string method = "addFirewallEntry";
-    JsonData data;
-    telux::common::ErrorCode error =
-        CommonUtils::readJsonData(apiJsonPath, stateJsonPath, subsystem, method, data);
-
+    telux::common::ErrorCode error = JsonParser::readFromJsonFile(data.apiRootObj, apiJsonPath);
     if (error != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Reading JSON File failed! ");
         return grpc::Status(grpc::StatusCode::INTERNAL, "Json read failed");
     }
+    CommonUtils::getValues(data.apiRootObj, "IFirewallManager", method, data.status,
+        data.error, data.cbDelay);
+    return grpc::Status::OK;
+}
+
+grpc::Status FirewallServerImpl::AddFirewallEntry(const dataStub::AddFirewallEntryRequest* request,
+    dataStub::AddFirewallEntryReply* response) {
+
+    LOG(DEBUG, __FUNCTION__);
+    JsonData data;
+    grpc::Status status = getApiResponse("addFirewallEntry", data);
+    if (!status.ok()) {
+        return status;
+    }
 
     if (data.status == telux::common::Status::SUCCESS &&
         data.error == telux::common::ErrorCode::SUCCESS) {
-        int idx = 0;
-        bool isFound = isFirewallEntryAvailable(subsystem, "firewallEntry", data, request, idx);
-
-        if (isFound) {
-            LOG(DEBUG, __FUNCTION__, " fw entry already exist.");
-            data.error = telux::common::ErrorCode::NO_EFFECT;
+        std::vector<std::string> protocols;
+        if ("PROTO_TCP_UDP" == request->protocol()) {
+            protocols.push_back("TCP");
+            protocols.push_back("UDP");
         } else {
-            std::vector<std::string> protocols;
-            if ("PROTO_TCP_UDP" == request->protocol()) {
-                protocols.push_back("TCP");
-                protocols.push_back("UDP");
-            } else {
-                protocols.push_back(request->protocol());
-            }
-
-            for (const auto& protocol: protocols) {
-                const Json::Value& config = data.stateRootObj[subsystem]["firewallEntry"];
-                int count = config.size();
-                Json::Value newConfig;
-                newConfig["backhaul"] =
-                    DataUtilsStub::convertEnumToBackhaulPrefString(
-                        static_cast<::dataStub::BackhaulPreference>(request->backhaul_type()));
-                newConfig["slotId"] = request->slot_id();
-                newConfig["profileId"] = request->profile_id();
+            protocols.push_back(request->protocol());
+        }
 
-                newConfig["fw_direction"] = request->fw_direction().fw_direction();
-                newConfig["isHwAccelerated"] = request->is_hw_accelerated();
-                newConfig["protocol"] = protocol;
-                std::string ipFamily = DataUtilsStub::convertIpFamilyEnumToString(
-                    request->ip_family_type().ip_family_type());
-                newConfig["ip_family_type"] = ipFamily;
-
-                if (ipFamily ==  "IPV4") {
-                    newConfig["ipv4_srcAddr"] = request->ipv4_params().ipv4_src_address();
-                    newConfig["ipv4_srcSubnetMask"] =
-                        request->ipv4_params().ipv4_src_subnet_mask();
-                    newConfig["ipv4_destAddr"] = request->ipv4_params().ipv4_dest_address();
-                    newConfig["ipv4_destSubnetMask"] =
-                        request->ipv4_params().ipv4_dest_subnet_mask();
-
-                    newConfig["ipv4_value"] = request->ipv4_params().ipv4_tos_val();
-                    newConfig["ipv4_mask"] = request->ipv4_params().ipv4_tos_mask();
-                }
+        std::vector<Json::Value> entries;
+        for (const auto& protocol: protocols) {
+            Json::Value newConfig;
+            newConfig["backhaul"] =
+                DataUtilsStub::convertEnumToBackhaulPrefString(
+                    static_cast<::dataStub::BackhaulPreference>(request->backhaul_type()));
+            newConfig["slotId"] = request->slot_id();
+            newConfig["profileId"] = request->profile_id();
 
-                if (ipFamily ==  "IPV6") {
-                    newConfig["ipv6_srcAddr"] = request->ipv6_params().ipv6_src_address();
-                    newConfig["ipv6_srcPrefixLen"] =
-                        request->ipv6_params().ipv6_src_prefix_len();
-                    newConfig["ipv6_destAddr"] = request->ipv6_params().ipv6_dest_address();
-                    newConfig["ipv6_dstPrefixLen"] =
-                        request->ipv6_params().ipv6_dest_prefix_len();
-
-                    newConfig["ipv6_val"] = request->ipv6_params().trf_value();
-                    newConfig["ipv6_mask"] = request->ipv6_params().trf_mask();
-                    newConfig["ipv6_flowLabel"] = request->ipv6_params().flow_label();
-                    newConfig["ipv6_natEnabled"] = request->ipv6_params().nat_enabled();
-                }
+            newConfig["fw_direction"] = request->fw_direction().fw_direction();
+            newConfig["isHwAccelerated"] = request->is_hw_accelerated();
+            newConfig["protocol"] = protocol;
+            std::string ipFamily = DataUtilsStub::convertIpFamilyEnumToString(
+                request->ip_family_type().ip_family_type());
+            newConfig["ip_family_type"] = ipFamily;
+
+            if (ipFamily ==  "IPV4") {
+                newConfig["ipv4_srcAddr"] = request->ipv4_params().ipv4_src_address();
+                newConfig["ipv4_srcSubnetMask"] =
+                    request->ipv4_params().ipv4_src_subnet_mask();
+                newConfig["ipv4_destAddr"] = request->ipv4_params().ipv4_dest_address();
+                newConfig["ipv4_destSubnetMask"] =
+                    request->ipv4_params().ipv4_dest_subnet_mask();
+
+                newConfig["ipv4_value"] = request->ipv4_params().ipv4_tos_val();
+                newConfig["ipv4_mask"] = request->ipv4_params().ipv4_tos_mask();
+            }
 
-                newConfig["source_port"] = request->protocol_params().source_port();
-                newConfig["source_port_range"] = request->protocol_params().source_port_range();
-                newConfig["dest_port"] = request->protocol_params().dest_port();
-                newConfig["dest_port_range"] = request->protocol_params().dest_port_range();
-                newConfig["esp_spi"] = request->protocol_params().esp_spi();
-                newConfig["icmp_type"] = request->protocol_params().icmp_type();
-                newConfig["icmp_code"] = request->protocol_params().icmp_code();
-
-                uint32_t handle = getHandle();
-                newConfig["handle"] = handle;
-                response->set_handle(handle);
-                LOG(DEBUG, __FUNCTION__, " adding fw entry for handle::", handle);
-                data.stateRootObj[subsystem]["firewallEntry"][count] = newConfig;
-                JsonParser::writeToJsonFile(data.stateRootObj, stateJsonPath);
+            if (ipFamily ==  "IPV6") {
+                newConfig["ipv6_srcAddr"] = request->ipv6_params().ipv6_src_address();
+                newConfig["ipv6_srcPrefixLen"] =
+                    request->ipv6_params().ipv6_src_prefix_len();
+                newConfig["ipv6_destAddr"] = request->ipv6_params().ipv6_dest_address();
+                newConfig["ipv6_dstPrefixLen"] =
+                    request->ipv6_params().ipv6_dest_prefix_len();
+
+                newConfig["ipv6_val"] = request->ipv6_params().trf_value();
+                newConfig["ipv6_mask"] = request->ipv6_params().trf_mask();
+                newConfig["ipv6_flowLabel"] = request->ipv6_params().flow_label();
+                newConfig["ipv6_natEnabled"] = request->ipv6_params().nat_enabled();
             }
+
+            newConfig["source_port"] = request->protocol_params().source_port();
+            newConfig["source_port_range"] = request->protocol_params().source_port_range();
+            newConfig["dest_port"] = request->protocol_params().dest_port();
+            newConfig["dest_port_range"] = request->protocol_params().dest_port_range();
+            newConfig["esp_spi"] = request->protocol_params().esp_spi();
+            newConfig["icmp_type"] = request->protocol_params().icmp_type();
+            newConfig["icmp_code"] = request->protocol_params().icmp_code();
+            entries.push_back(newConfig);
+        }
+
+        uint32_t handle = 0;
+        data.error = ruleTable_->add(entries, handle);
+        if (data.error == telux::common::ErrorCode::SUCCESS) {
+            response->set_handle(handle);
         }
     }
 
@@ -239,59 +246,19 @@ grpc::Status FirewallServerImpl::AddFirewallEntry(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FirewallServerImpl::RemoveFirewallEntry(ServerContext* context,
+grpc::Status FirewallServerImpl::RemoveFirewallEntry(
     const dataStub::RemoveFirewallEntryRequest* request, dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
-    std::string apiJsonPath = FIREWALL_MANAGER_API_LOCAL_JSON;
-    std::string stateJsonPath = FIREWALL_MANAGER_STATE_JSON;
-    std::string subsystem = "IFirewallManager";
-    std::string method = "removeFirewallEntry";
     JsonData data;
-    telux::common::ErrorCode error =
-        CommonUtils::readJsonData(apiJsonPath, stateJsonPath, subsystem, method, data);
-
-    if (error != ErrorCode::SUCCESS) {
-        return grpc::Status(grpc::StatusCode::INTERNAL, "Json read failed");
+    grpc::Status status = getApiResponse("removeFirewallEntry", data);
+    if (!status.ok()) {
+        return status;
     }
 
     if (data.status == telux::common::Status::SUCCESS &&
         data.error == telux::common::ErrorCode::SUCCESS) {
-        const Json::Value& config = data.stateRootObj[subsystem]["firewallEntry"];
-        int count = config.size();
-        bool isFound = false;
-        int idx = 0;
-        for (idx=0; idx < count; idx++) {
-            if (config[idx]["handle"].asInt() != request->entry_handle()) {
-                continue;
-            }
-            isFound = true;
-            break;
-        }
-
-        if (isFound) {
-            LOG(DEBUG, __FUNCTION__, " removing fw entry for handle::",
-                request->entry_handle());
-            int currentCount =
-                data.stateRootObj[subsystem]["firewallEntry"].size();
-            int newCount = 0;
-            int index = 0;
-            Json::Value newRoot;
-            for (; index < currentCount; index++) {
-                //skipping to add entry in new array for the matched index.
-                if (idx == index ) {
-                    continue;
-                }
-                newRoot[subsystem]["firewallEntry"][newCount]
-                    = data.stateRootObj[subsystem]["firewallEntry"][index];
-                newCount++;
-            }
-            data.stateRootObj[subsystem]["firewallEntry"]
-                = newRoot[subsystem]["firewallEntry"];
-            JsonParser::writeToJsonFile(data.stateRootObj, stateJsonPath);
-        } else {
-            data.error = telux::common::ErrorCode::INTERNAL;
-        }
+        data.error = ruleTable_->remove(request->entry_handle());
     }
 
     response->set_status(static_cast<commonStub::Status>(data.status));
@@ -301,122 +268,89 @@ grpc::Status FirewallServerImpl::RemoveFirewallEntry(ServerContext* context,
     return grpc::Status::OK;
 }
 
-uint32_t FirewallServerImpl::getHandle() {
-    struct timespec ts;
-    clock_gettime(CLOCK_REALTIME, &ts);
-    srand(ts.tv_sec * 1000000000LL + ts.tv_nsec);
-    return rand();
-}
-
-grpc::Status FirewallServerImpl::RequestFirewallEntries(ServerContext* context,
+grpc::Status FirewallServerImpl::RequestFirewallEntries(
     const dataStub::FirewallEntriesRequest* request,
     dataStub::RequestFirewallEntriesReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
-    std::string apiJsonPath = FIREWALL_MANAGER_API_LOCAL_JSON;
-    std::string stateJsonPath = FIREWALL_MANAGER_STATE_JSON;
-    std::string subsystem = "IFirewallManager";
-    std::string method = "requestFirewallEntries";
     JsonData data;
-    telux::common::ErrorCode error =
-        CommonUtils::readJsonData(apiJsonPath, stateJsonPath, subsystem, method, data);
-
-    if (error != ErrorCode::SUCCESS) {
-        return grpc::Status(grpc::StatusCode::INTERNAL, "Json read failed");
+    grpc::Status status = getApiResponse("requestFirewallEntries", data);
+    if (!status.ok()) {
+        return status;
     }
 
     if (data.status == telux::common::Status::SUCCESS &&
         data.error == telux::common::ErrorCode::SUCCESS) {
-        int idx = 0;
-        auto profile_id = request->profile_id();
-        auto slot_id = request->slot_id();
-        auto backhaulType = DataUtilsStub::convertEnumToBackhaulPrefString(
-            request->backhaul_type());
-        auto isHwAccelerated = request->is_hw_accelerated();
-        bool isFound = isConfigAvailable(subsystem, "firewallEntry", data, request, idx);
-        if (isFound) {
-            int count =
-                data.stateRootObj[subsystem]["firewallEntry"].size();
-            int index = 0;
-            for (; index < count; index++) {
-                Json::Value requestedFirewallEntry =
-                    data.stateRootObj[subsystem]["firewallEntry"][index];
-
-                if ((requestedFirewallEntry["profileId"].asInt() == profile_id) &&
-                    (requestedFirewallEntry["slotId"].asInt() == slot_id) &&
-                    (requestedFirewallEntry["backhaul"].asString() == backhaulType) &&
-                    (requestedFirewallEntry["isHwAccelerated"].asBool() == isHwAccelerated)) {
-
-                    dataStub::FirewallEntry *fw_entry = response->add_firewall_entries();
-                    fw_entry->mutable_fw_direction()->set_fw_direction(
-                        (dataStub::Direction::Fw_Direction)
-                        requestedFirewallEntry["fw_direction"].asInt());
-                    fw_entry->set_protocol(requestedFirewallEntry["protocol"].asString());
-                    fw_entry->mutable_ip_family_type()->set_ip_family_type(
-                        (DataUtilsStub::convertIpFamilyStringToEnum(
-                        requestedFirewallEntry["ip_family_type"].asString())));
-
-                    if (requestedFirewallEntry["ip_family_type"].asString() == "IPV4") {
-                        fw_entry->mutable_ipv4_params()->set_ipv4_src_address(
-                            requestedFirewallEntry["ipv4_srcAddr"].asString());
-                        fw_entry->mutable_ipv4_params()->set_ipv4_src_subnet_mask(
-                            requestedFirewallEntry["ipv4_srcSubnetMask"].asString());
-                        fw_entry->mutable_ipv4_params()->set_ipv4_dest_address(
-                            requestedFirewallEntry["ipv4_destAddr"].asString());
-                        fw_entry->mutable_ipv4_params()->set_ipv4_dest_subnet_mask(
-                            requestedFirewallEntry["ipv4_destSubnetMask"].asString());
-                        fw_entry->mutable_ipv4_params()->set_ipv4_tos_val(
-                            requestedFirewallEntry["ipv4_value"].asInt());
-                        fw_entry->mutable_ipv4_params()->set_ipv4_tos_mask(
-                            requestedFirewallEntry["ipv4_mask"].asInt());
-                    }
-
-                    if (requestedFirewallEntry["ip_family_type"].asString() == "IPV6") {
-                        fw_entry->mutable_ipv6_params()->set_ipv6_src_address(
-                            requestedFirewallEntry["ipv6_srcAddr"].asString());
-                        fw_entry->mutable_ipv6_params()->set_ipv6_dest_address(
-                            requestedFirewallEntry["ipv6_destAddr"].asString());
-                        fw_entry->mutable_ipv6_params()->set_ipv6_src_prefix_len(
-                            requestedFirewallEntry["ipv6_srcPrefixLen"].asInt());
-                        fw_entry->mutable_ipv6_params()->set_ipv6_dest_prefix_len(
-                            requestedFirewallEntry["ipv6_dstPrefixLen"].asInt());
-                        fw_entry->mutable_ipv6_params()->set_trf_value(
-                            requestedFirewallEntry["ipv6_val"].asInt());
-                        fw_entry->mutable_ipv6_params()->set_trf_mask(
-                            requestedFirewallEntry["ipv6_mask"].asInt());
-                        fw_entry->mutable_ipv6_params()->set_flow_label(
-                            requestedFirewallEntry["ipv6_flowLabel"].asInt());
-                        fw_entry->mutable_ipv6_params()->set_nat_enabled(
-                            requestedFirewallEntry["ipv6_natEnabled"].asInt());
-                    }
+        std::vector<Json::Value> entries;
+        ruleTable_->getEntries(
+            DataUtilsStub::convertEnumToBackhaulPrefString(request->backhaul_type()),
+            request->slot_id(), request->profile_id(), request->is_hw_accelerated(), entries);
+        if (entries.empty()) {
+            LOG(DEBUG, __FUNCTION__, " fw entry doesn't exist");
+        }
+        for (const auto& requestedFirewallEntry : entries) {
+            dataStub::FirewallEntry *fw_entry = response->add_firewall_entries();
+            fw_entry->mutable_fw_direction()->set_fw_direction(
+                (dataStub::Direction::Fw_Direction)
+                requestedFirewallEntry["fw_direction"].asInt());
+            fw_entry->set_protocol(requestedFirewallEntry["protocol"].asString());
+            fw_entry->mutable_ip_family_type()->set_ip_family_type(
+                (DataUtilsStub::convertIpFamilyStringToEnum(
+                requestedFirewallEntry["ip_family_type"].asString())));
+
+            if (requestedFirewallEntry["ip_family_type"].asString() == "IPV4") {
+                fw_entry->mutable_ipv4_params()->set_ipv4_src_address(
+                    requestedFirewallEntry["ipv4_srcAddr"].asString());
+                fw_entry->mutable_ipv4_params()->set_ipv4_src_subnet_mask(
+                    requestedFirewallEntry["ipv4_srcSubnetMask"].asString());
+                fw_entry->mutable_ipv4_params()->set_ipv4_dest_address(
+                    requestedFirewallEntry["ipv4_destAddr"].asString());
+                fw_entry->mutable_ipv4_params()->set_ipv4_dest_subnet_mask(
+                    requestedFirewallEntry["ipv4_destSubnetMask"].asString());
+                fw_entry->mutable_ipv4_params()->set_ipv4_tos_val(
+                    requestedFirewallEntry["ipv4_value"].asInt());
+                fw_entry->mutable_ipv4_params()->set_ipv4_tos_mask(
+                    requestedFirewallEntry["ipv4_mask"].asInt());
+            }
 
-                    fw_entry->mutable_protocol_params()->set_source_port(
-                        requestedFirewallEntry["source_port"].asInt());
-                    fw_entry->mutable_protocol_params()->set_source_port_range(
-                        requestedFirewallEntry["source_port_range"].asInt());
-                    fw_entry->mutable_protocol_params()->set_dest_port(
-                        requestedFirewallEntry["dest_port"].asInt());
-                    fw_entry->mutable_protocol_params()->set_dest_port_range(
-                        requestedFirewallEntry["dest_port_range"].asInt());
-                    fw_entry->mutable_protocol_params()->set_esp_spi(
-                        requestedFirewallEntry["esp_spi"].asInt());
-                    fw_entry->mutable_protocol_params()->set_icmp_type(
-                        requestedFirewallEntry["icmp_type"].asInt());
-                    fw_entry->mutable_protocol_params()->set_icmp_code(
-                        requestedFirewallEntry["icmp_code"].asInt());
-
-                    fw_entry->set_firewall_handle(
-                        requestedFirewallEntry["handle"].asInt());
-                    LOG(DEBUG, __FUNCTION__, " found fw entry for handle::",
-                        requestedFirewallEntry["handle"].asInt());
-                } else {
-                    LOG(DEBUG, __FUNCTION__, " fw entry doesn't exist");
-                    data.error = telux::common::ErrorCode::SUCCESS;
-                }
+            if (requestedFirewallEntry["ip_family_type"].asString() == "IPV6") {
+                fw_entry->mutable_ipv6_params()->set_ipv6_src_address(
+                    requestedFirewallEntry["ipv6_srcAddr"].asString());
+                fw_entry->mutable_ipv6_params()->set_ipv6_dest_address(
+                    requestedFirewallEntry["ipv6_destAddr"].asString());
+                fw_entry->mutable_ipv6_params()->set_ipv6_src_prefix_len(
+                    requestedFirewallEntry["ipv6_srcPrefixLen"].asInt());
+                fw_entry->mutable_ipv6_params()->set_ipv6_dest_prefix_len(
+                    requestedFirewallEntry["ipv6_dstPrefixLen"].asInt());
+                fw_entry->mutable_ipv6_params()->set_trf_value(
+                    requestedFirewallEntry["ipv6_val"].asInt());
+                fw_entry->mutable_ipv6_params()->set_trf_mask(
+                    requestedFirewallEntry["ipv6_mask"].asInt());
+                fw_entry->mutable_ipv6_params()->set_flow_label(
+                    requestedFirewallEntry["ipv6_flowLabel"].asInt());
+                fw_entry->mutable_ipv6_params()->set_nat_enabled(
+                    requestedFirewallEntry["ipv6_natEnabled"].asInt());
             }
-        } else {
-            LOG(DEBUG, __FUNCTION__, " fw entry doesn't exist");
-            data.error = telux::common::ErrorCode::SUCCESS;
+
+            fw_entry->mutable_protocol_params()->set_source_port(
+                requestedFirewallEntry["source_port"].asInt());
+            fw_entry->mutable_protocol_params()->set_source_port_range(
+                requestedFirewallEntry["source_port_range"].asInt());
+            fw_entry->mutable_protocol_params()->set_dest_port(
+                requestedFirewallEntry["dest_port"].asInt());
+            fw_entry->mutable_protocol_params()->set_dest_port_range(
+                requestedFirewallEntry["dest_port_range"].asInt());
+            fw_entry->mutable_protocol_params()->set_esp_spi(
+                requestedFirewallEntry["esp_spi"].asInt());
+            fw_entry->mutable_protocol_params()->set_icmp_type(
+                requestedFirewallEntry["icmp_type"].asInt());
+            fw_entry->mutable_protocol_params()->set_icmp_code(
+                requestedFirewallEntry["icmp_code"].asInt());
+
+            fw_entry->set_firewall_handle(
+                requestedFirewallEntry["handle"].asInt());
+            LOG(DEBUG, __FUNCTION__, " found fw entry for handle::",
+                requestedFirewallEntry["handle"].asInt());
         }
     }
 
@@ -427,8 +361,48 @@ grpc::Status FirewallServerImpl::RequestFirewallEntries(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FirewallServerImpl::EnableDMZ(ServerContext* context,
-    const dataStub::EnableDMZRequest* request, dataStub::DefaultReply* response) {
+grpc::Status FirewallServerImpl::ClassifyPacket(const dataStub::ClassifyPacketRequest* request,
+    dataStub::ClassifyPacketReply* response) {
+
+    LOG(DEBUG, __FUNCTION__);
+    JsonData data;
+    grpc::Status status = getApiResponse("classifyPacket", data);
+    if (!status.ok()) {
+        return status;
+    }
+
+    if (data.status == telux::common::Status::SUCCESS &&
+        data.error == telux::common::ErrorCode::SUCCESS) {
+        FirewallRuleTable::Packet packet;
+        packet.backhaul = DataUtilsStub::convertEnumToBackhaulPrefString(
+            request->backhaul_type());
+        packet.slotId = request->slot_id();
+        packet.profileId = request->profile_id();
+        packet.direction = request->fw_direction().fw_direction();
+        packet.protocol = request->protocol();
+        packet.srcAddr = request->src_address();
+        packet.destAddr = request->dest_address();
+        packet.srcPort = static_cast<uint16_t>(request->source_port());
+        packet.destPort = static_cast<uint16_t>(request->dest_port());
+
+        bool isMatched = false;
+        bool isAllowed = true;
+        uint32_t handle = 0;
+        data.error = ruleTable_->classify(packet, isMatched, handle, isAllowed);
+        response->set_is_matched(isMatched);
+        response->set_firewall_handle(handle);
+        response->set_is_allowed(isAllowed);
+    }
+
+    response->mutable_reply()->set_status(static_cast<commonStub::Status>(data.status));
+    response->mutable_reply()->set_error(static_cast<commonStub::ErrorCode>(data.error));
+    response->mutable_reply()->set_delay(data.cbDelay);
+
+    return grpc::Status::OK;
+}
+
+grpc::Status FirewallServerImpl::EnableDMZ(const dataStub::EnableDMZRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = FIREWALL_MANAGER_API_LOCAL_JSON;
@@ -436,6 +410,7 @@ grpc::Status FirewallServerImpl::EnableDMZ(ServerContext* context,
     std::string subsystem = "IFirewallManager";
     std::string method = "enableDmz";
     JsonData data;
+    ruleTable_->flush();
     telux::common::ErrorCode error =
         CommonUtils::readJsonData(apiJsonPath, stateJsonPath, subsystem, method, data);
 
@@ -486,8 +461,8 @@ grpc::Status FirewallServerImpl::EnableDMZ(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FirewallServerImpl::DisableDMZ(ServerContext* context,
-    const dataStub::DisableDmzRequest* request, dataStub::DefaultReply* response) {
+grpc::Status FirewallServerImpl::DisableDMZ(const dataStub::DisableDmzRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = FIREWALL_MANAGER_API_LOCAL_JSON;
@@ -495,6 +470,7 @@ grpc::Status FirewallServerImpl::DisableDMZ(ServerContext* context,
     std::string subsystem = "IFirewallManager";
     std::string method = "disableDmz";
     JsonData data;
+    ruleTable_->flush();
     telux::common::ErrorCode error =
         CommonUtils::readJsonData(apiJsonPath, stateJsonPath, subsystem, method, data);
 
@@ -544,8 +520,7 @@ grpc::Status FirewallServerImpl::DisableDMZ(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FirewallServerImpl::RequestDMZEntry(ServerContext* context,
-    const dataStub::DMZEntryRequest* request,
+grpc::Status FirewallServerImpl::RequestDMZEntry(const dataStub::DMZEntryRequest* request,
     dataStub::RequestDMZEntryReply* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = FIREWALL_MANAGER_API_LOCAL_JSON;
@@ -578,3 +553,66 @@ grpc::Status FirewallServerImpl::RequestDMZEntry(ServerContext* context,
 
     return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* FirewallServerImpl::InitService(grpc::CallbackServerContext* context,
+    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* FirewallServerImpl::SetFirewall(grpc::CallbackServerContext* context,
+    const dataStub::SetFirewallRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetFirewall(request, response); });
+}
+
+grpc::ServerUnaryReactor* FirewallServerImpl::RequestFirewallStatus(
+    grpc::CallbackServerContext* context, const dataStub::FirewallStatusRequest* request,
+    dataStub::RequestFirewallStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestFirewallStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* FirewallServerImpl::AddFirewallEntry(grpc::CallbackServerContext* context,
+    const dataStub::AddFirewallEntryRequest* request, dataStub::AddFirewallEntryReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return AddFirewallEntry(request, response); });
+}
+
+grpc::ServerUnaryReactor* FirewallServerImpl::RemoveFirewallEntry(
+    grpc::CallbackServerContext* context, const dataStub::RemoveFirewallEntryRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RemoveFirewallEntry(request, response); });
+}
+
+grpc::ServerUnaryReactor* FirewallServerImpl::RequestFirewallEntries(
+    grpc::CallbackServerContext* context, const dataStub::FirewallEntriesRequest* request,
+    dataStub::RequestFirewallEntriesReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestFirewallEntries(request, response); });
+}
+
+grpc::ServerUnaryReactor* FirewallServerImpl::EnableDMZ(grpc::CallbackServerContext* context,
+    const dataStub::EnableDMZRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return EnableDMZ(request, response); });
+}
+
+grpc::ServerUnaryReactor* FirewallServerImpl::DisableDMZ(grpc::CallbackServerContext* context,
+    const dataStub::DisableDmzRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DisableDMZ(request, response); });
+}
+
+grpc::ServerUnaryReactor* FirewallServerImpl::RequestDMZEntry(grpc::CallbackServerContext* context,
+    const dataStub::DMZEntryRequest* request, dataStub::RequestDMZEntryReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestDMZEntry(request, response); });
+}
+
+grpc::ServerUnaryReactor* FirewallServerImpl::ClassifyPacket(grpc::CallbackServerContext* context,
+    const dataStub::ClassifyPacketRequest* request, dataStub::ClassifyPacketReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ClassifyPacket(request, response); });
+}
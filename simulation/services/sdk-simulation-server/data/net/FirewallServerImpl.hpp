@@ -13,6 +13,7 @@
 #include "libs/data/DataUtilsStub.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
+#include "FirewallRuleTable.hpp"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -20,51 +21,75 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class FirewallServerImpl final:
-    public dataStub::FirewallManager::Service {
+    public dataStub::FirewallManager::CallbackService {
 public:
     FirewallServerImpl();
     ~FirewallServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::InitRequest* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status SetFirewall(ServerContext* context,
-        const dataStub::SetFirewallRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* SetFirewall(grpc::CallbackServerContext* context,
+        const dataStub::SetFirewallRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestFirewallStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestFirewallStatus(grpc::CallbackServerContext* context,
         const dataStub::FirewallStatusRequest* request,
         dataStub::RequestFirewallStatusReply* response) override;
 
-    grpc::Status AddFirewallEntry(ServerContext* context,
+    grpc::ServerUnaryReactor* AddFirewallEntry(grpc::CallbackServerContext* context,
         const dataStub::AddFirewallEntryRequest* request,
         dataStub::AddFirewallEntryReply* response) override;
 
-    grpc::Status RemoveFirewallEntry(ServerContext* context,
+    grpc::ServerUnaryReactor* RemoveFirewallEntry(grpc::CallbackServerContext* context,
         const dataStub::RemoveFirewallEntryRequest* request,
         dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestFirewallEntries(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestFirewallEntries(grpc::CallbackServerContext* context,
         const dataStub::FirewallEntriesRequest* request,
         dataStub::RequestFirewallEntriesReply* response) override;
 
-    grpc::Status EnableDMZ(ServerContext* context,
-        const dataStub::EnableDMZRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* EnableDMZ(grpc::CallbackServerContext* context,
+        const dataStub::EnableDMZRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status DisableDMZ(ServerContext* context,
-        const dataStub::DisableDmzRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* DisableDMZ(grpc::CallbackServerContext* context,
+        const dataStub::DisableDmzRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestDMZEntry(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestDMZEntry(grpc::CallbackServerContext* context,
         const dataStub::DMZEntryRequest* request,
         dataStub::RequestDMZEntryReply* response) override;
 
+    grpc::ServerUnaryReactor* ClassifyPacket(grpc::CallbackServerContext* context,
+        const dataStub::ClassifyPacketRequest* request,
+        dataStub::ClassifyPacketReply* response) override;
+
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::InitRequest* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status SetFirewall(const dataStub::SetFirewallRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestFirewallStatus(const dataStub::FirewallStatusRequest* request,
+        dataStub::RequestFirewallStatusReply* response);
+    grpc::Status AddFirewallEntry(const dataStub::AddFirewallEntryRequest* request,
+        dataStub::AddFirewallEntryReply* response);
+    grpc::Status RemoveFirewallEntry(const dataStub::RemoveFirewallEntryRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestFirewallEntries(const dataStub::FirewallEntriesRequest* request,
+        dataStub::RequestFirewallEntriesReply* response);
+    grpc::Status EnableDMZ(const dataStub::EnableDMZRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status DisableDMZ(const dataStub::DisableDmzRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestDMZEntry(const dataStub::DMZEntryRequest* request,
+        dataStub::RequestDMZEntryReply* response);
+    grpc::Status ClassifyPacket(const dataStub::ClassifyPacketRequest* request,
+        dataStub::ClassifyPacketReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
+    std::shared_ptr<FirewallRuleTable> ruleTable_;
+
+    grpc::Status getApiResponse(const std::string &method, JsonData &data);
 
-    uint32_t getHandle();
     template <typename T>
     bool isConfigAvailable(std::string subsystem, std::string method, const JsonData& data,
         const T* request, int& configIdx = 0) {
@@ -124,56 +149,6 @@ private:
         }
         return isFound;
     }
-
-    template <typename T>
-    bool isFirewallEntryAvailable(std::string subsystem, std::string method, const JsonData& data,
-        const T* request, int& configIdx = 0) {
-        const Json::Value& config = data.stateRootObj[subsystem][method];
-        int count = config.size();
-        bool isFound = false;
-        int idx = 0;
-        for (idx=0; idx < count; idx++) {
-            if (config[idx]["backhaul"].asString() !=
-                DataUtilsStub::convertEnumToBackhaulPrefString(request->backhaul_type())) {
-                continue;
-            }
-            if (config[idx]["slotId"].asInt() != request->slot_id()) {
-                continue;
-            }
-            if (config[idx]["profileId"].asInt() != request->profile_id()) {
-                continue;
-            }
-            if (config[idx]["fw_direction"].asInt() !=
-                request->fw_direction().fw_direction()) {
-                continue;
-            }
-            if (config[idx]["protocol"].asString() != request->protocol()) {
-                continue;
-            }
-
-            std::string ipFamily = DataUtilsStub::convertIpFamilyEnumToString(
-                request->ip_family_type().ip_family_type());
-
-            if (ipFamily ==  "IPV4") {
-                if (request->ipv4_params().ipv4_src_address() !=
-                    config[idx]["ipv4_srcAddr"].asString()) {
-                        continue;
-                }
-            }
-            if (ipFamily == "IPV6") {
-                if (request->ipv6_params().ipv6_src_address() !=
-                    config[idx]["ipv6_srcAddr"].asString()) {
-                        continue;
-                }
-            }
-            isFound = true;
-            break;
-        }
-        if (isFound) {
-            configIdx = idx;
-        }
-        return isFound;
-    }
 };
 
 #endif //FIREWALL_MANAGER_SERVER_HPP
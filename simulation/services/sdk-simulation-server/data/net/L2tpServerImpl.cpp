@@ -8,6 +8,7 @@
 #include "L2tpServerImpl.hpp"
 #include "libs/common/Logger.hpp"
 #include "libs/data/DataUtilsStub.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define L2TP_MANAGER_API_JSON "api/data/IL2tpManager.json"
 #define L2TP_MANAGER_STATE_JSON "system-state/data/IL2tpManagerState.json"
@@ -24,8 +25,8 @@ L2tpServerImpl::~L2tpServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status L2tpServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status L2tpServerImpl::InitService(const google::protobuf::Empty* request,
+    dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootObj;
@@ -49,8 +50,8 @@ grpc::Status L2tpServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status L2tpServerImpl::SetConfig(ServerContext* context,
-    const dataStub::SetConfigRequest* request, dataStub::DefaultReply* response) {
+grpc::Status L2tpServerImpl::SetConfig(const dataStub::SetConfigRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = L2TP_MANAGER_API_JSON;
@@ -87,8 +88,7 @@ grpc::Status L2tpServerImpl::SetConfig(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status L2tpServerImpl::RequestConfig(ServerContext* context,
-    const google::protobuf::Empty* request,
+grpc::Status L2tpServerImpl::RequestConfig(const google::protobuf::Empty* request,
     dataStub::RequestConfigReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -161,8 +161,8 @@ grpc::Status L2tpServerImpl::RequestConfig(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status L2tpServerImpl::AddTunnel(ServerContext* context,
-    const ::dataStub::AddTunnelRequest* request, dataStub::DefaultReply* response) {
+grpc::Status L2tpServerImpl::AddTunnel(const ::dataStub::AddTunnelRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = L2TP_MANAGER_API_JSON;
@@ -285,8 +285,8 @@ grpc::Status L2tpServerImpl::AddTunnel(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status L2tpServerImpl::RemoveTunnel(ServerContext* context,
-    const ::dataStub::RemoveTunnelRequest* request, ::dataStub::DefaultReply* response) {
+grpc::Status L2tpServerImpl::RemoveTunnel(const ::dataStub::RemoveTunnelRequest* request,
+    ::dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = L2TP_MANAGER_API_JSON;
@@ -341,8 +341,8 @@ grpc::Status L2tpServerImpl::RemoveTunnel(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status L2tpServerImpl::AddSession(ServerContext* context,
-    const ::dataStub::AddSessionRequest* request, ::dataStub::DefaultReply* response) {
+grpc::Status L2tpServerImpl::AddSession(const ::dataStub::AddSessionRequest* request,
+    ::dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = L2TP_MANAGER_API_JSON;
@@ -402,8 +402,8 @@ grpc::Status L2tpServerImpl::AddSession(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status L2tpServerImpl::RemoveSession(ServerContext* context,
-    const ::dataStub::RemoveSessionRequest* request, ::dataStub::DefaultReply* response) {
+grpc::Status L2tpServerImpl::RemoveSession(const ::dataStub::RemoveSessionRequest* request,
+    ::dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = L2TP_MANAGER_API_JSON;
@@ -468,8 +468,8 @@ grpc::Status L2tpServerImpl::RemoveSession(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status L2tpServerImpl::BindSessionToBackhaul(ServerContext* context,
-    const dataStub::SessionConfigRequest* request, dataStub::DefaultReply* response) {
+grpc::Status L2tpServerImpl::BindSessionToBackhaul(const dataStub::SessionConfigRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = L2TP_MANAGER_API_JSON;
@@ -528,8 +528,8 @@ grpc::Status L2tpServerImpl::BindSessionToBackhaul(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status L2tpServerImpl::UnBindSessionToBackhaul(ServerContext* context,
-    const dataStub::SessionConfigRequest* request, dataStub::DefaultReply* response) {
+grpc::Status L2tpServerImpl::UnBindSessionToBackhaul(const dataStub::SessionConfigRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = L2TP_MANAGER_API_JSON;
@@ -593,9 +593,8 @@ grpc::Status L2tpServerImpl::UnBindSessionToBackhaul(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status L2tpServerImpl::QueryBindSessionToBackhaul(ServerContext* context,
-        const dataStub::QueryBindSessionRequest* request,
-        dataStub::QueryBindSessionReply* response) {
+grpc::Status L2tpServerImpl::QueryBindSessionToBackhaul(
+    const dataStub::QueryBindSessionRequest* request, dataStub::QueryBindSessionReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = L2TP_MANAGER_API_JSON;
@@ -693,4 +692,67 @@ bool L2tpServerImpl::bindingExists(const Json::Value& bindings,
     }
 
     return isFound;
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::InitService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::SetConfig(grpc::CallbackServerContext* context,
+    const dataStub::SetConfigRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::RequestConfig(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, dataStub::RequestConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::AddTunnel(grpc::CallbackServerContext* context,
+    const ::dataStub::AddTunnelRequest* request, ::dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return AddTunnel(request, response); });
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::RemoveTunnel(grpc::CallbackServerContext* context,
+    const ::dataStub::RemoveTunnelRequest* request, ::dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RemoveTunnel(request, response); });
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::AddSession(grpc::CallbackServerContext* context,
+    const ::dataStub::AddSessionRequest* request, ::dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return AddSession(request, response); });
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::RemoveSession(grpc::CallbackServerContext* context,
+    const ::dataStub::RemoveSessionRequest* request, ::dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RemoveSession(request, response); });
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::BindSessionToBackhaul(
+    grpc::CallbackServerContext* context, const dataStub::SessionConfigRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return BindSessionToBackhaul(request, response); });
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::UnBindSessionToBackhaul(
+    grpc::CallbackServerContext* context, const dataStub::SessionConfigRequest* request,
+    dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return UnBindSessionToBackhaul(request, response); });
+}
+
+grpc::ServerUnaryReactor* L2tpServerImpl::QueryBindSessionToBackhaul(
+    grpc::CallbackServerContext* context, const dataStub::QueryBindSessionRequest* request,
+    dataStub::QueryBindSessionReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return QueryBindSessionToBackhaul(request, response); });
+}
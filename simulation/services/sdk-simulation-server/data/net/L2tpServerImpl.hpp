@@ -19,52 +19,67 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class L2tpServerImpl final:
-    public dataStub::L2tpManager::Service {
+    public dataStub::L2tpManager::CallbackService {
 public:
     L2tpServerImpl();
     ~L2tpServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const google::protobuf::Empty* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status SetConfig(ServerContext* context,
-        const dataStub::SetConfigRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* SetConfig(grpc::CallbackServerContext* context,
+        const dataStub::SetConfigRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestConfig(ServerContext* context,
-        const google::protobuf::Empty* request,
-        dataStub::RequestConfigReply* response) override;
+    grpc::ServerUnaryReactor* RequestConfig(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, dataStub::RequestConfigReply* response) override;
 
-    grpc::Status AddTunnel(ServerContext* context,
-        const ::dataStub::AddTunnelRequest* request,
-        ::dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* AddTunnel(grpc::CallbackServerContext* context,
+        const ::dataStub::AddTunnelRequest* request, ::dataStub::DefaultReply* response) override;
 
-    grpc::Status RemoveTunnel(ServerContext* context,
+    grpc::ServerUnaryReactor* RemoveTunnel(grpc::CallbackServerContext* context,
         const ::dataStub::RemoveTunnelRequest* request,
         ::dataStub::DefaultReply* response) override;
 
-    grpc::Status AddSession(ServerContext* context,
-        const ::dataStub::AddSessionRequest* request,
-        ::dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* AddSession(grpc::CallbackServerContext* context,
+        const ::dataStub::AddSessionRequest* request, ::dataStub::DefaultReply* response) override;
 
-    grpc::Status RemoveSession(ServerContext* context,
+    grpc::ServerUnaryReactor* RemoveSession(grpc::CallbackServerContext* context,
         const ::dataStub::RemoveSessionRequest* request,
         ::dataStub::DefaultReply* response) override;
 
-    grpc::Status BindSessionToBackhaul(ServerContext* context,
-        const dataStub::SessionConfigRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* BindSessionToBackhaul(grpc::CallbackServerContext* context,
+        const dataStub::SessionConfigRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status UnBindSessionToBackhaul(ServerContext* context,
-        const dataStub::SessionConfigRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* UnBindSessionToBackhaul(grpc::CallbackServerContext* context,
+        const dataStub::SessionConfigRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status QueryBindSessionToBackhaul(ServerContext* context,
+    grpc::ServerUnaryReactor* QueryBindSessionToBackhaul(grpc::CallbackServerContext* context,
         const dataStub::QueryBindSessionRequest* request,
         dataStub::QueryBindSessionReply* response) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status SetConfig(const dataStub::SetConfigRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestConfig(const google::protobuf::Empty* request,
+        dataStub::RequestConfigReply* response);
+    grpc::Status AddTunnel(const ::dataStub::AddTunnelRequest* request,
+        ::dataStub::DefaultReply* response);
+    grpc::Status RemoveTunnel(const ::dataStub::RemoveTunnelRequest* request,
+        ::dataStub::DefaultReply* response);
+    grpc::Status AddSession(const ::dataStub::AddSessionRequest* request,
+        ::dataStub::DefaultReply* response);
+    grpc::Status RemoveSession(const ::dataStub::RemoveSessionRequest* request,
+        ::dataStub::DefaultReply* response);
+    grpc::Status BindSessionToBackhaul(const dataStub::SessionConfigRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status UnBindSessionToBackhaul(const dataStub::SessionConfigRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status QueryBindSessionToBackhaul(const dataStub::QueryBindSessionRequest* request,
+        dataStub::QueryBindSessionReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
 
     bool configExists(const Json::Value& config, int configID, int &idx);
@@ -10,6 +10,7 @@
 #include "libs/common/JsonParser.hpp"
 #include "libs/data/DataUtilsStub.hpp"
 #include "libs/data/DataHelper.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define NAT_MANAGER_API_LOCAL_JSON "api/data/INatManagerLocal.json"
 #define NAT_MANAGER_STATE_JSON "system-state/data/INatManagerState.json"
@@ -25,8 +26,8 @@ NatServerImpl::~NatServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status NatServerImpl::InitService(ServerContext* context,
-    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status NatServerImpl::InitService(const dataStub::InitRequest* request,
+    dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootObj;
@@ -50,8 +51,7 @@ grpc::Status NatServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status NatServerImpl::AddStaticNatEntry(ServerContext* context,
-    const dataStub::StaticNatRequest* request,
+grpc::Status NatServerImpl::AddStaticNatEntry(const dataStub::StaticNatRequest* request,
     dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -127,8 +127,7 @@ grpc::Status NatServerImpl::AddStaticNatEntry(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status NatServerImpl::RemoveStaticNatEntry(ServerContext* context,
-    const dataStub::StaticNatRequest* request,
+grpc::Status NatServerImpl::RemoveStaticNatEntry(const dataStub::StaticNatRequest* request,
     dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -204,7 +203,7 @@ grpc::Status NatServerImpl::RemoveStaticNatEntry(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status NatServerImpl::RequestStaticNatEntries(ServerContext* context,
+grpc::Status NatServerImpl::RequestStaticNatEntries(
     const dataStub::RequestStaticNatEntriesRequest* request,
     dataStub::RequestStaticNatEntriesReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -275,3 +274,28 @@ grpc::Status NatServerImpl::RequestStaticNatEntries(ServerContext* context,
 
     return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* NatServerImpl::InitService(grpc::CallbackServerContext* context,
+    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* NatServerImpl::AddStaticNatEntry(grpc::CallbackServerContext* context,
+    const dataStub::StaticNatRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return AddStaticNatEntry(request, response); });
+}
+
+grpc::ServerUnaryReactor* NatServerImpl::RemoveStaticNatEntry(grpc::CallbackServerContext* context,
+    const dataStub::StaticNatRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RemoveStaticNatEntry(request, response); });
+}
+
+grpc::ServerUnaryReactor* NatServerImpl::RequestStaticNatEntries(
+    grpc::CallbackServerContext* context, const dataStub::RequestStaticNatEntriesRequest* request,
+    dataStub::RequestStaticNatEntriesReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestStaticNatEntries(request, response); });
+}
@@ -21,28 +21,35 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class NatServerImpl final:
-    public dataStub::SnatManager::Service {
+    public dataStub::SnatManager::CallbackService {
 public:
     NatServerImpl();
     ~NatServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::InitRequest* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status AddStaticNatEntry(ServerContext* context,
-        const dataStub::StaticNatRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* AddStaticNatEntry(grpc::CallbackServerContext* context,
+        const dataStub::StaticNatRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RemoveStaticNatEntry(ServerContext* context,
-        const dataStub::StaticNatRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* RemoveStaticNatEntry(grpc::CallbackServerContext* context,
+        const dataStub::StaticNatRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status RequestStaticNatEntries(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestStaticNatEntries(grpc::CallbackServerContext* context,
         const dataStub::RequestStaticNatEntriesRequest* request,
         dataStub::RequestStaticNatEntriesReply* response) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::InitRequest* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status AddStaticNatEntry(const dataStub::StaticNatRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RemoveStaticNatEntry(const dataStub::StaticNatRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status RequestStaticNatEntries(const dataStub::RequestStaticNatEntriesRequest* request,
+        dataStub::RequestStaticNatEntriesReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
 
     template <typename T>
@@ -9,6 +9,7 @@
 #include "libs/common/Logger.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define SOCKS_MANAGER_API_LOCAL_JSON "api/data/ISocksManagerLocal.json"
 #define SOCKS_MANAGER_STATE_JSON "system-state/data/ISocksManagerState.json"
@@ -24,8 +25,8 @@ SocksServerImpl::~SocksServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status SocksServerImpl::InitService(ServerContext* context,
-    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status SocksServerImpl::InitService(const dataStub::InitRequest* request,
+    dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootObj;
@@ -49,8 +50,8 @@ grpc::Status SocksServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status SocksServerImpl::enableSocks(ServerContext* context,
-    const dataStub::EnableSocksRequest* request, dataStub::DefaultReply* response) {
+grpc::Status SocksServerImpl::enableSocks(const dataStub::EnableSocksRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = SOCKS_MANAGER_API_LOCAL_JSON;
@@ -87,4 +88,16 @@ grpc::Status SocksServerImpl::enableSocks(ServerContext* context,
     response->set_delay(data.cbDelay);
 
     return grpc::Status::OK;
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* SocksServerImpl::InitService(grpc::CallbackServerContext* context,
+    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* SocksServerImpl::enableSocks(grpc::CallbackServerContext* context,
+    const dataStub::EnableSocksRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return enableSocks(request, response); });
+}
@@ -17,20 +17,24 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class SocksServerImpl final:
-    public dataStub::SocksManager::Service {
+    public dataStub::SocksManager::CallbackService {
 public:
     SocksServerImpl();
     ~SocksServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::InitRequest* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status enableSocks(ServerContext* context,
-        const dataStub::EnableSocksRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* enableSocks(grpc::CallbackServerContext* context,
+        const dataStub::EnableSocksRequest* request, dataStub::DefaultReply* response) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::InitRequest* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status enableSocks(const dataStub::EnableSocksRequest* request,
+        dataStub::DefaultReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
 };
 
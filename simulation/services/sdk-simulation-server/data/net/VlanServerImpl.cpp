@@ -9,6 +9,7 @@
 #include "libs/common/Logger.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/data/DataUtilsStub.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define VLAN_MANAGER_API_LOCAL_JSON "api/data/IVlanManagerLocal.json"
 #define VLAN_MANAGER_STATE_JSON "system-state/data/IVlanManagerState.json"
@@ -24,8 +25,8 @@ VlanServerImpl::~VlanServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status VlanServerImpl::InitService(ServerContext* context,
-    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+grpc::Status VlanServerImpl::InitService(const dataStub::InitRequest* request,
+    dataStub::GetServiceStatusReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootObj;
@@ -49,8 +50,8 @@ grpc::Status VlanServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status VlanServerImpl::CreateVlan(ServerContext* context,
-    const dataStub::CreateVlanRequest* request, dataStub::CreateVlanReply* response) {
+grpc::Status VlanServerImpl::CreateVlan(const dataStub::CreateVlanRequest* request,
+    dataStub::CreateVlanReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = VLAN_MANAGER_API_LOCAL_JSON;
@@ -114,8 +115,8 @@ grpc::Status VlanServerImpl::CreateVlan(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status VlanServerImpl::RemoveVlan(ServerContext* context,
-    const dataStub::RemoveVlanRequest* request, dataStub::DefaultReply* response) {
+grpc::Status VlanServerImpl::RemoveVlan(const dataStub::RemoveVlanRequest* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = VLAN_MANAGER_API_LOCAL_JSON;
@@ -170,8 +171,7 @@ grpc::Status VlanServerImpl::RemoveVlan(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status VlanServerImpl::QueryVlanInfo(ServerContext* context,
-    const dataStub::QueryVlanInfoRequest* request,
+grpc::Status VlanServerImpl::QueryVlanInfo(const dataStub::QueryVlanInfoRequest* request,
     dataStub::QueryVlanInfoReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -219,8 +219,8 @@ grpc::Status VlanServerImpl::QueryVlanInfo(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status VlanServerImpl::BindToBackhaul(ServerContext* context,
-    const dataStub::BindToBackhaulConfig* request, dataStub::DefaultReply* response) {
+grpc::Status VlanServerImpl::BindToBackhaul(const dataStub::BindToBackhaulConfig* request,
+    dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = VLAN_MANAGER_API_LOCAL_JSON;
@@ -270,8 +270,7 @@ grpc::Status VlanServerImpl::BindToBackhaul(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status VlanServerImpl::UnbindFromBackhaul(ServerContext* context,
-    const dataStub::BindToBackhaulConfig* request,
+grpc::Status VlanServerImpl::UnbindFromBackhaul(const dataStub::BindToBackhaulConfig* request,
     dataStub::DefaultReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
@@ -328,7 +327,7 @@ grpc::Status VlanServerImpl::UnbindFromBackhaul(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status VlanServerImpl::QueryVlanMappingList(ServerContext* context,
+grpc::Status VlanServerImpl::QueryVlanMappingList(
     const dataStub::QueryVlanMappingListRequest* request,
     dataStub::QueryVlanMappingListReply* response) {
 
@@ -377,3 +376,46 @@ grpc::Status VlanServerImpl::QueryVlanMappingList(ServerContext* context,
 
     return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* VlanServerImpl::InitService(grpc::CallbackServerContext* context,
+    const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* VlanServerImpl::CreateVlan(grpc::CallbackServerContext* context,
+    const dataStub::CreateVlanRequest* request, dataStub::CreateVlanReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CreateVlan(request, response); });
+}
+
+grpc::ServerUnaryReactor* VlanServerImpl::RemoveVlan(grpc::CallbackServerContext* context,
+    const dataStub::RemoveVlanRequest* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RemoveVlan(request, response); });
+}
+
+grpc::ServerUnaryReactor* VlanServerImpl::QueryVlanInfo(grpc::CallbackServerContext* context,
+    const dataStub::QueryVlanInfoRequest* request, dataStub::QueryVlanInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return QueryVlanInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* VlanServerImpl::BindToBackhaul(grpc::CallbackServerContext* context,
+    const dataStub::BindToBackhaulConfig* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return BindToBackhaul(request, response); });
+}
+
+grpc::ServerUnaryReactor* VlanServerImpl::UnbindFromBackhaul(grpc::CallbackServerContext* context,
+    const dataStub::BindToBackhaulConfig* request, dataStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return UnbindFromBackhaul(request, response); });
+}
+
+grpc::ServerUnaryReactor* VlanServerImpl::QueryVlanMappingList(grpc::CallbackServerContext* context,
+    const dataStub::QueryVlanMappingListRequest* request,
+    dataStub::QueryVlanMappingListReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return QueryVlanMappingList(request, response); });
+}
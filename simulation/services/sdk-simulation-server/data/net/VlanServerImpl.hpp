@@ -20,40 +20,51 @@ using grpc::ServerContext;
 using grpc::Status;
 
 class VlanServerImpl final:
-    public dataStub::VlanManager::Service {
+    public dataStub::VlanManager::CallbackService {
 public:
     VlanServerImpl();
     ~VlanServerImpl();
 
-    grpc::Status InitService(ServerContext* context,
-        const dataStub::InitRequest* request,
-        dataStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const dataStub::InitRequest* request, dataStub::GetServiceStatusReply* response) override;
 
-    grpc::Status CreateVlan(ServerContext* context,
-        const dataStub::CreateVlanRequest* request,
-        dataStub::CreateVlanReply* response) override;
+    grpc::ServerUnaryReactor* CreateVlan(grpc::CallbackServerContext* context,
+        const dataStub::CreateVlanRequest* request, dataStub::CreateVlanReply* response) override;
 
-    grpc::Status RemoveVlan(ServerContext* context,
-        const dataStub::RemoveVlanRequest* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* RemoveVlan(grpc::CallbackServerContext* context,
+        const dataStub::RemoveVlanRequest* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status QueryVlanInfo(ServerContext* context,
+    grpc::ServerUnaryReactor* QueryVlanInfo(grpc::CallbackServerContext* context,
         const dataStub::QueryVlanInfoRequest* request,
         dataStub::QueryVlanInfoReply* response) override;
 
-    grpc::Status BindToBackhaul(ServerContext* context,
-        const dataStub::BindToBackhaulConfig* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* BindToBackhaul(grpc::CallbackServerContext* context,
+        const dataStub::BindToBackhaulConfig* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status UnbindFromBackhaul(ServerContext* context,
-        const dataStub::BindToBackhaulConfig* request,
-        dataStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* UnbindFromBackhaul(grpc::CallbackServerContext* context,
+        const dataStub::BindToBackhaulConfig* request, dataStub::DefaultReply* response) override;
 
-    grpc::Status QueryVlanMappingList(ServerContext* context,
+    grpc::ServerUnaryReactor* QueryVlanMappingList(grpc::CallbackServerContext* context,
         const dataStub::QueryVlanMappingListRequest* request,
         dataStub::QueryVlanMappingListReply* response) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const dataStub::InitRequest* request,
+        dataStub::GetServiceStatusReply* response);
+    grpc::Status CreateVlan(const dataStub::CreateVlanRequest* request,
+        dataStub::CreateVlanReply* response);
+    grpc::Status RemoveVlan(const dataStub::RemoveVlanRequest* request,
+        dataStub::DefaultReply* response);
+    grpc::Status QueryVlanInfo(const dataStub::QueryVlanInfoRequest* request,
+        dataStub::QueryVlanInfoReply* response);
+    grpc::Status BindToBackhaul(const dataStub::BindToBackhaulConfig* request,
+        dataStub::DefaultReply* response);
+    grpc::Status UnbindFromBackhaul(const dataStub::BindToBackhaulConfig* request,
+        dataStub::DefaultReply* response);
+    grpc::Status QueryVlanMappingList(const dataStub::QueryVlanMappingListRequest* request,
+        dataStub::QueryVlanMappingListReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
 
     template <typename T>
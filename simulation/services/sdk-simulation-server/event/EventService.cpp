@@ -18,4 +18,28 @@ EventService &EventService::getInstance() {
     LOG(DEBUG, __FUNCTION__);
     static EventService instance;
     return instance;
-}
\ No newline at end of file
+}
+
+grpc::Status EventService::InjectEvents(ServerContext* context,
+    grpc::ServerReader<eventService::UnsolicitedEvent>* reader,
+    eventService::InjectEventsReply* response) {
+    LOG(DEBUG, __FUNCTION__);
+
+    uint32_t received = 0;
+    uint32_t rejected = 0;
+    eventService::UnsolicitedEvent msg;
+    auto &serverEventManager = ServerEventManager::getInstance();
+    while (reader->Read(&msg)) {
+        ++received;
+        if (msg.filter().empty() || msg.event().empty()) {
+            LOG(ERROR, __FUNCTION__, " rejecting event ", received, " without filter or event");
+            ++rejected;
+            continue;
+        }
+        serverEventManager.handleEventNotifications(msg);
+    }
+    LOG(DEBUG, __FUNCTION__, " received ", received, " events, rejected ", rejected);
+    response->set_received(received);
+    response->set_rejected(rejected);
+    return grpc::Status::OK;
+}
@@ -22,6 +22,15 @@ class EventService final:
 public:
     static EventService &getInstance();
 
+    /**
+     * @brief This is a gRPC RPC call invoked by event_injector to replay a scenario.
+     * The events of the stream are dispatched in order as they are read and are
+     * acknowledged together once the stream is closed.
+     */
+    grpc::Status InjectEvents(ServerContext* context,
+        grpc::ServerReader<eventService::UnsolicitedEvent>* reader,
+        eventService::InjectEventsReply* response) override;
+
 private:
     EventService();
     ~EventService();
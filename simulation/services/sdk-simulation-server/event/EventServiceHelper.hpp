@@ -11,12 +11,14 @@
 #include <mutex>
 #include <queue>
 #include <vector>
+#include <utility>
 #include <algorithm>
 #include <condition_variable>
 #include <grpcpp/grpcpp.h>
 
 #include "libs/common/Logger.hpp"
 #include "libs/common/AsyncTaskQueue.hpp"
+#include "libs/common/ShmEventRing.hpp"
 #include "ServerEventManager.hpp"
 #include "protos/proto-src/event_simulation.grpc.pb.h"
 
@@ -69,6 +71,7 @@ private:
     void eventDispatcher() {
         LOG(DEBUG, __FUNCTION__);
         typename eventService::EventResponse eventResponse;
+        std::vector<int> skippedClients;
 
         while(true) {
             {
@@ -77,12 +80,13 @@ private:
                     qCv_.wait(lck, [this] {return !(eventQ_.empty());});
                 }
 
-                eventResponse = eventQ_.front();
+                eventResponse = std::move(eventQ_.front().first);
+                skippedClients = std::move(eventQ_.front().second);
                 eventQ_.pop();
             }
 
-            auto f = std::async(std::launch::deferred, [this, eventResponse]() {
-                    eventWriter(eventResponse);}).share();
+            auto f = std::async(std::launch::deferred, [this, eventResponse, skippedClients]() {
+                    eventWriter(eventResponse, skippedClients);}).share();
             taskQ_.add(f);
         }
     }
@@ -100,18 +104,39 @@ private:
      * @brief This API writes the event to the stream based on the filters
      * set by the client.
      */
-    void eventWriter(typename eventService::EventResponse eventResponse) {
+    void eventWriter(typename eventService::EventResponse eventResponse,
+        const std::vector<int> &skippedClients) {
         std::lock_guard<std::mutex> lck(clientMtx_);
         {
+            std::string record;
             for(auto& client : clients_) {
-                const auto& clientObj = client.second;
+                auto& clientObj = client.second;
+                if(find(skippedClients.begin(), skippedClients.end(), clientObj.clientId)
+                    != skippedClients.end()) {
+                    continue;
+                }
                 if(find(clientObj.filters.begin(), clientObj.filters.end(),
                 eventResponse.filter()) != clientObj.filters.end()) {
+                    // Events that overflow the ring go to the stream while the earlier ones
+                    // are still in the ring, the client restores the order from seq
+                    eventResponse.set_seq(clientObj.nextSeq);
+                    if (clientObj.ring) {
+                        if (!eventResponse.SerializeToString(&record)) {
+                            LOG(ERROR, __FUNCTION__, " Failed to serialize event");
+                        } else if (clientObj.ring->push(record)) {
+                            ++clientObj.nextSeq;
+                            continue;
+                        } else {
+                            LOG(DEBUG, __FUNCTION__, ":: ring full, clientId: ",
+                                clientObj.clientId);
+                        }
+                    }
                     if (clientObj.clientWriter) {
                         LOG(DEBUG, __FUNCTION__, ":: writing for filter:",
                             eventResponse.filter(), ", clientId: ",
                             clientObj.clientId);
                         clientObj.clientWriter->Write(eventResponse);
+                        ++clientObj.nextSeq;
                     }
                 }
             }
@@ -142,6 +167,16 @@ public:
             */
             client.clientId = request->client_id();
             client.clientWriter = writer;
+            // Only a ring named after the client is accepted, events that don't fit in it
+            // are still written to the stream
+            if (!request->shm_ring().empty()) {
+                if (telux::common::ShmEventRing::isNameOf(request->shm_ring(),
+                    request->client_id())) {
+                    client.ring = telux::common::ShmEventRing::open(request->shm_ring());
+                } else {
+                    LOG(ERROR, __FUNCTION__, " Unexpected ring ", request->shm_ring());
+                }
+            }
             clients_[request->client_id()] = client;
         }
 
@@ -206,11 +241,19 @@ public:
     }
 
     void updateEventQueue(const typename eventService::EventResponse& event) {
+        updateEventQueue(event, std::vector<int>());
+    }
+
+    /**
+     * @brief Queues an event for the clients of its filter except the skipped ones.
+     */
+    void updateEventQueue(const typename eventService::EventResponse& event,
+        std::vector<int> skippedClients) {
         LOG(DEBUG, __FUNCTION__);
         {
             std::lock_guard<std::mutex> lck(qMtx_);
             LOG(DEBUG, __FUNCTION__, " pushing event in queue for filter::", event.filter());
-            eventQ_.push(event);
+            eventQ_.emplace(event, std::move(skippedClients));
             qCv_.notify_all();
         }
     }
@@ -233,6 +276,9 @@ private:
         int clientId;
         std::vector<std::string> filters;
         ServerWriter<typename eventService::EventResponse>* clientWriter;
+        std::shared_ptr<telux::common::ShmEventRing> ring;
+        /* Sequence number of the next event sent to the client */
+        uint64_t nextSeq = 1;
 
         bool operator ==(Client &rHl) {
             if (clientId == rHl.clientId) {
@@ -251,7 +297,7 @@ private:
 
     std::mutex qMtx_;
     std::condition_variable qCv_;
-    std::queue<typename eventService::EventResponse> eventQ_;
+    std::queue<std::pair<typename eventService::EventResponse, std::vector<int>>> eventQ_;
 
     telux::common::AsyncTaskQueue<void> taskQ_;
 };
@@ -16,6 +16,7 @@
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
 #include "event/EventService.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define LOC_CONFIG_API_JSON "api/loc/ILocationConfigurator.json"
 #define DEFAULT_DELIMITER " "
@@ -28,8 +29,8 @@ LocationConfiguratorServerImpl::~LocationConfiguratorServerImpl() {
     LOG(DEBUG, __FUNCTION__, " Destructing");
 }
 
-grpc::Status LocationConfiguratorServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, locStub::GetServiceStatusReply* response) {
+grpc::Status LocationConfiguratorServerImpl::InitService(const google::protobuf::Empty* request,
+    locStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int cbDelay = 100;
     telux::common::ServiceStatus serviceStatus = telux::common::ServiceStatus::SERVICE_FAILED;
@@ -182,7 +183,7 @@ void LocationConfiguratorServerImpl::triggerGnssConstellationUpdateEvent() {
 
 }
 
-grpc::Status LocationConfiguratorServerImpl::RegisterListener (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::RegisterListener(
     const locStub::RegisterListenerRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     if(request->xtra_indication() == true){
@@ -200,7 +201,7 @@ grpc::Status LocationConfiguratorServerImpl::RegisterListener (ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureCTUNC (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureCTUNC(
     const locStub::ConfigureCTUNCRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     bool enable = request->enable();
@@ -218,7 +219,7 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureCTUNC (ServerContext* cont
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigurePACE (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigurePACE(
     const locStub::ConfigurePACERequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     bool enable = request->enable();
@@ -230,14 +231,14 @@ grpc::Status LocationConfiguratorServerImpl::ConfigurePACE (ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::DeleteAllAidingData (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::DeleteAllAidingData(
     const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("deleteAllAidingData", response);
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureLeverArm (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureLeverArm(
     const locStub::ConfigureLeverArmRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("configureLeverArm", response);
@@ -281,9 +282,9 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureLeverArm (ServerContext* c
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureConstellations (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureConstellations(
     const locStub::ConfigureConstellationsRequest* request,
-        locStub::LocManagerCommandReply* response) {
+    locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("configureConstellations", response);
     if (response->error() == ::commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
@@ -305,9 +306,8 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureConstellations (ServerCont
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureMinGpsWeek (ServerContext* context,
-    const locStub::ConfigureMinGpsWeekRequest* request,
-        locStub::LocManagerCommandReply* response) {
+grpc::Status LocationConfiguratorServerImpl::ConfigureMinGpsWeek(
+    const locStub::ConfigureMinGpsWeekRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     uint16_t minGpsWeek = request->min_gps_week();
     apiJsonReader("configureMinGpsWeek", response);
@@ -318,7 +318,7 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureMinGpsWeek (ServerContext*
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::RequestMinGpsWeek(ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::RequestMinGpsWeek(
     const google::protobuf::Empty* request, locStub::RequestMinGpsWeekReply* response) {
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootNode;
@@ -340,9 +340,9 @@ grpc::Status LocationConfiguratorServerImpl::RequestMinGpsWeek(ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureMinSVElevation (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureMinSVElevation(
     const locStub::ConfigureMinSVElevationRequest* request,
-        locStub::LocManagerCommandReply* response) {
+    locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     uint16_t minSVElevation = request->min_sv_elevation();
     apiJsonReader("configureMinSVElevation", response);
@@ -354,8 +354,8 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureMinSVElevation (ServerCont
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::RequestMinSVElevation (ServerContext* context,
-        const google::protobuf::Empty* request, locStub::RequestMinSVElevationReply* response) {
+grpc::Status LocationConfiguratorServerImpl::RequestMinSVElevation(
+    const google::protobuf::Empty* request, locStub::RequestMinSVElevationReply* response) {
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootNode;
     JsonParser::readFromJsonFile(rootNode, LOC_CONFIG_API_JSON);
@@ -376,9 +376,9 @@ grpc::Status LocationConfiguratorServerImpl::RequestMinSVElevation (ServerContex
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureRobustLocation (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureRobustLocation(
     const locStub::ConfigureRobustLocationRequest* request,
-        locStub::LocManagerCommandReply* response) {
+    locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     bool enable = request->enable();
     bool enableForE911 = request->enable_for_e911();
@@ -393,8 +393,8 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureRobustLocation (ServerCont
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::RequestRobustLocation (ServerContext* context,
-        const google::protobuf::Empty* request, locStub::RequestRobustLocationReply* response) {
+grpc::Status LocationConfiguratorServerImpl::RequestRobustLocation(
+    const google::protobuf::Empty* request, locStub::RequestRobustLocationReply* response) {
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootNode;
     JsonParser::readFromJsonFile(rootNode, LOC_CONFIG_API_JSON);
@@ -425,9 +425,9 @@ grpc::Status LocationConfiguratorServerImpl::RequestRobustLocation (ServerContex
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureSecondaryBand (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureSecondaryBand(
     const locStub::ConfigureSecondaryBandRequest* request,
-        locStub::LocManagerCommandReply* response) {
+    locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("configureSecondaryBand", response);
     if (response->error() == ::commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
@@ -447,7 +447,7 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureSecondaryBand (ServerConte
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::RequestSecondaryBandConfig (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::RequestSecondaryBandConfig(
     const google::protobuf::Empty* request, locStub::RequestSecondaryBandConfigReply* response) {
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootNode;
@@ -471,7 +471,7 @@ grpc::Status LocationConfiguratorServerImpl::RequestSecondaryBandConfig (ServerC
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::DeleteAidingData (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::DeleteAidingData(
     const locStub::DeleteAidingDataRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     uint16_t aidingDataMask = request->aiding_data_mask();
@@ -484,8 +484,8 @@ grpc::Status LocationConfiguratorServerImpl::DeleteAidingData (ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureDR (ServerContext* context,
-    const locStub::ConfigureDRRequest* request, locStub::LocManagerCommandReply* response) {
+grpc::Status LocationConfiguratorServerImpl::ConfigureDR(const locStub::ConfigureDRRequest* request,
+    locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("configureDR", response);
     if (response->error() == ::commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
@@ -520,9 +520,9 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureDR (ServerContext* context
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureEngineState (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureEngineState(
     const locStub::ConfigureEngineStateRequest* request,
-        locStub::LocManagerCommandReply* response) {
+    locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     uint16_t engineType = request->engine_type();
     uint16_t engineState = request->engine_state();
@@ -538,9 +538,9 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureEngineState (ServerContext
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ProvideConsentForTerrestrialPositioning (
-    ServerContext* context, const locStub::ProvideConsentForTerrestrialPositioningRequest* request,
-        locStub::LocManagerCommandReply* response) {
+grpc::Status LocationConfiguratorServerImpl::ProvideConsentForTerrestrialPositioning(
+    const locStub::ProvideConsentForTerrestrialPositioningRequest* request,
+    locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     bool consent = request->user_consent();
     apiJsonReader("provideConsentForTerrestrialPositioning", response);
@@ -552,7 +552,7 @@ grpc::Status LocationConfiguratorServerImpl::ProvideConsentForTerrestrialPositio
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureNmeaTypes (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureNmeaTypes(
     const locStub::ConfigureNmeaTypesRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     uint16_t nmeaType = request->nmea_type();
@@ -565,7 +565,7 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureNmeaTypes (ServerContext*
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureNmea(ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureNmea(
     const locStub::ConfigureNmeaRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     uint16_t nmeaType = request->nmea_type();
@@ -588,9 +588,9 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureNmea(ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureEngineIntegrityRisk (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureEngineIntegrityRisk(
     const locStub::ConfigureEngineIntegrityRiskRequest* request,
-        locStub::LocManagerCommandReply* response) {
+    locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     uint16_t integRisk = request->integrity_risk();
     uint16_t engineType = request->engine_type();
@@ -606,9 +606,8 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureEngineIntegrityRisk (Serve
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureXtraParams (ServerContext* context,
-    const locStub::ConfigureXtraParamsRequest* request,
-        locStub::LocManagerCommandReply* response) {
+grpc::Status LocationConfiguratorServerImpl::ConfigureXtraParams(
+    const locStub::ConfigureXtraParamsRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("configureXtraParams", response);
     if (response->error() == ::commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
@@ -658,9 +657,8 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureXtraParams (ServerContext*
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::RequestXtraStatus (ServerContext* context,
-    const google::protobuf::Empty* request,
-        locStub::RequestXtraStatusReply* response) {
+grpc::Status LocationConfiguratorServerImpl::RequestXtraStatus(
+    const google::protobuf::Empty* request, locStub::RequestXtraStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootNode;
     JsonParser::readFromJsonFile(rootNode, LOC_CONFIG_API_JSON);
@@ -689,14 +687,14 @@ grpc::Status LocationConfiguratorServerImpl::RequestXtraStatus (ServerContext* c
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::InjectMerkleTree (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::InjectMerkleTree(
     const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("injectMerkleTreeInformation", response);
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ConfigureOsnma (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ConfigureOsnma(
     const locStub::ConfigureOsnmaRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("configureOsnma", response);
@@ -709,7 +707,7 @@ grpc::Status LocationConfiguratorServerImpl::ConfigureOsnma (ServerContext* cont
     return grpc::Status::OK;
 }
 
-grpc::Status LocationConfiguratorServerImpl::ProvideXtraConsent (ServerContext* context,
+grpc::Status LocationConfiguratorServerImpl::ProvideXtraConsent(
     const locStub::XtraConsentRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("provideConsentForXtra", response);
@@ -736,3 +734,196 @@ void LocationConfiguratorServerImpl::apiJsonReader(
     response->set_error(static_cast<::commonStub::ErrorCode>(errorCode));
     response->set_delay(cbDelay);
 }
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::InitService(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureCTUNC(
+    grpc::CallbackServerContext* context, const locStub::ConfigureCTUNCRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureCTUNC(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigurePACE(
+    grpc::CallbackServerContext* context, const locStub::ConfigurePACERequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigurePACE(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::DeleteAllAidingData(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DeleteAllAidingData(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureLeverArm(
+    grpc::CallbackServerContext* context, const locStub::ConfigureLeverArmRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureLeverArm(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureConstellations(
+    grpc::CallbackServerContext* context, const locStub::ConfigureConstellationsRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureConstellations(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureMinGpsWeek(
+    grpc::CallbackServerContext* context, const locStub::ConfigureMinGpsWeekRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureMinGpsWeek(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::RequestMinGpsWeek(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::RequestMinGpsWeekReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestMinGpsWeek(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureMinSVElevation(
+    grpc::CallbackServerContext* context, const locStub::ConfigureMinSVElevationRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureMinSVElevation(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::RequestMinSVElevation(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::RequestMinSVElevationReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestMinSVElevation(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureRobustLocation(
+    grpc::CallbackServerContext* context, const locStub::ConfigureRobustLocationRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureRobustLocation(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::RequestRobustLocation(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::RequestRobustLocationReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestRobustLocation(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureSecondaryBand(
+    grpc::CallbackServerContext* context, const locStub::ConfigureSecondaryBandRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureSecondaryBand(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::RequestSecondaryBandConfig(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::RequestSecondaryBandConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestSecondaryBandConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::DeleteAidingData(
+    grpc::CallbackServerContext* context, const locStub::DeleteAidingDataRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DeleteAidingData(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureDR(
+    grpc::CallbackServerContext* context, const locStub::ConfigureDRRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureDR(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureEngineState(
+    grpc::CallbackServerContext* context, const locStub::ConfigureEngineStateRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureEngineState(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ProvideConsentForTerrestrialPositioning(
+    grpc::CallbackServerContext* context,
+    const locStub::ProvideConsentForTerrestrialPositioningRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() {
+            return ProvideConsentForTerrestrialPositioning(request, response);
+        });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureNmeaTypes(
+    grpc::CallbackServerContext* context, const locStub::ConfigureNmeaTypesRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureNmeaTypes(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureNmea(
+    grpc::CallbackServerContext* context, const locStub::ConfigureNmeaRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureNmea(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureEngineIntegrityRisk(
+    grpc::CallbackServerContext* context,
+    const locStub::ConfigureEngineIntegrityRiskRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureEngineIntegrityRisk(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureXtraParams(
+    grpc::CallbackServerContext* context, const locStub::ConfigureXtraParamsRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureXtraParams(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::RequestXtraStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::RequestXtraStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestXtraStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::InjectMerkleTree(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InjectMerkleTree(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ConfigureOsnma(
+    grpc::CallbackServerContext* context, const locStub::ConfigureOsnmaRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureOsnma(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::RegisterListener(
+    grpc::CallbackServerContext* context, const locStub::RegisterListenerRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RegisterListener(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationConfiguratorServerImpl::ProvideXtraConsent(
+    grpc::CallbackServerContext* context, const locStub::XtraConsentRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ProvideXtraConsent(request, response); });
+}
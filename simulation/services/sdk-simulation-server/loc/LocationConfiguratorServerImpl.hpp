@@ -36,81 +36,151 @@ using grpc::Status;
 
 using locStub::LocationConfiguratorService;
 
-class LocationConfiguratorServerImpl final : public locStub::LocationConfiguratorService::Service,
+class LocationConfiguratorServerImpl final
+    : public locStub::LocationConfiguratorService::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<LocationConfiguratorServerImpl> {
  public:
     LocationConfiguratorServerImpl();
     ~LocationConfiguratorServerImpl();
-    grpc::Status InitService(ServerContext* context, const google::protobuf::Empty* request,
-        locStub::GetServiceStatusReply* response);
-    grpc::Status ConfigureCTUNC (ServerContext* context,
-        const locStub::ConfigureCTUNCRequest* request, locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigurePACE (ServerContext* context,
-        const locStub::ConfigurePACERequest* request, locStub::LocManagerCommandReply* response);
-    grpc::Status DeleteAllAidingData (ServerContext* context,
-        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureLeverArm (ServerContext* context,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureCTUNC(grpc::CallbackServerContext* context,
+        const locStub::ConfigureCTUNCRequest* request,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigurePACE(grpc::CallbackServerContext* context,
+        const locStub::ConfigurePACERequest* request,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* DeleteAllAidingData(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureLeverArm(grpc::CallbackServerContext* context,
         const locStub::ConfigureLeverArmRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureConstellations (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureConstellations(grpc::CallbackServerContext* context,
         const locStub::ConfigureConstellationsRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureMinGpsWeek (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureMinGpsWeek(grpc::CallbackServerContext* context,
         const locStub::ConfigureMinGpsWeekRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status RequestMinGpsWeek (ServerContext* context, const google::protobuf::Empty* request,
-        locStub::RequestMinGpsWeekReply* response);
-    grpc::Status ConfigureMinSVElevation (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* RequestMinGpsWeek(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::RequestMinGpsWeekReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureMinSVElevation(grpc::CallbackServerContext* context,
         const locStub::ConfigureMinSVElevationRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status RequestMinSVElevation (ServerContext* context,
-        const google::protobuf::Empty* request, locStub::RequestMinSVElevationReply* response);
-    grpc::Status ConfigureRobustLocation (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* RequestMinSVElevation(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        locStub::RequestMinSVElevationReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureRobustLocation(grpc::CallbackServerContext* context,
         const locStub::ConfigureRobustLocationRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status RequestRobustLocation (ServerContext* context,
-        const google::protobuf::Empty* request, locStub::RequestRobustLocationReply* response);
-    grpc::Status ConfigureSecondaryBand (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* RequestRobustLocation(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        locStub::RequestRobustLocationReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureSecondaryBand(grpc::CallbackServerContext* context,
         const locStub::ConfigureSecondaryBandRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status RequestSecondaryBandConfig (ServerContext* context,
-        const google::protobuf::Empty* request, locStub::RequestSecondaryBandConfigReply* response);
-    grpc::Status DeleteAidingData (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* RequestSecondaryBandConfig(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        locStub::RequestSecondaryBandConfigReply* response) override;
+    grpc::ServerUnaryReactor* DeleteAidingData(grpc::CallbackServerContext* context,
         const locStub::DeleteAidingDataRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureDR (ServerContext* context,
-        const locStub::ConfigureDRRequest* request, locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureEngineState (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureDR(grpc::CallbackServerContext* context,
+        const locStub::ConfigureDRRequest* request,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureEngineState(grpc::CallbackServerContext* context,
         const locStub::ConfigureEngineStateRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status ProvideConsentForTerrestrialPositioning (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ProvideConsentForTerrestrialPositioning(
+        grpc::CallbackServerContext* context,
         const locStub::ProvideConsentForTerrestrialPositioningRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureNmeaTypes (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureNmeaTypes(grpc::CallbackServerContext* context,
         const locStub::ConfigureNmeaTypesRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureNmea (ServerContext* context,
-        const locStub::ConfigureNmeaRequest* request, locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureEngineIntegrityRisk (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureNmea(grpc::CallbackServerContext* context,
+        const locStub::ConfigureNmeaRequest* request,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureEngineIntegrityRisk(grpc::CallbackServerContext* context,
         const locStub::ConfigureEngineIntegrityRiskRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureXtraParams (ServerContext* context,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureXtraParams(grpc::CallbackServerContext* context,
         const locStub::ConfigureXtraParamsRequest* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status RequestXtraStatus (ServerContext* context, const google::protobuf::Empty* request,
-            locStub::RequestXtraStatusReply* response);
-    grpc::Status InjectMerkleTree (ServerContext* context, const google::protobuf::Empty* request,
-            locStub::LocManagerCommandReply* response);
-    grpc::Status ConfigureOsnma (ServerContext* context,
-        const locStub::ConfigureOsnmaRequest* request, locStub::LocManagerCommandReply* response);
-    grpc::Status RegisterListener (ServerContext* context,
-        const locStub::RegisterListenerRequest* request, locStub::LocManagerCommandReply* response);
-    grpc::Status ProvideXtraConsent (ServerContext* context,
-        const locStub::XtraConsentRequest* request, locStub::LocManagerCommandReply* response);
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* RequestXtraStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::RequestXtraStatusReply* response) override;
+    grpc::ServerUnaryReactor* InjectMerkleTree(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ConfigureOsnma(grpc::CallbackServerContext* context,
+        const locStub::ConfigureOsnmaRequest* request,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* RegisterListener(grpc::CallbackServerContext* context,
+        const locStub::RegisterListenerRequest* request,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* ProvideXtraConsent(grpc::CallbackServerContext* context,
+        const locStub::XtraConsentRequest* request,
+        locStub::LocManagerCommandReply* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent event) override;
 
  private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        locStub::GetServiceStatusReply* response);
+    grpc::Status ConfigureCTUNC(const locStub::ConfigureCTUNCRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigurePACE(const locStub::ConfigurePACERequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status DeleteAllAidingData(const google::protobuf::Empty* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureLeverArm(const locStub::ConfigureLeverArmRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureConstellations(const locStub::ConfigureConstellationsRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureMinGpsWeek(const locStub::ConfigureMinGpsWeekRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status RequestMinGpsWeek(const google::protobuf::Empty* request,
+        locStub::RequestMinGpsWeekReply* response);
+    grpc::Status ConfigureMinSVElevation(const locStub::ConfigureMinSVElevationRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status RequestMinSVElevation(const google::protobuf::Empty* request,
+        locStub::RequestMinSVElevationReply* response);
+    grpc::Status ConfigureRobustLocation(const locStub::ConfigureRobustLocationRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status RequestRobustLocation(const google::protobuf::Empty* request,
+        locStub::RequestRobustLocationReply* response);
+    grpc::Status ConfigureSecondaryBand(const locStub::ConfigureSecondaryBandRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status RequestSecondaryBandConfig(const google::protobuf::Empty* request,
+        locStub::RequestSecondaryBandConfigReply* response);
+    grpc::Status DeleteAidingData(const locStub::DeleteAidingDataRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureDR(const locStub::ConfigureDRRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureEngineState(const locStub::ConfigureEngineStateRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ProvideConsentForTerrestrialPositioning(
+        const locStub::ProvideConsentForTerrestrialPositioningRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureNmeaTypes(const locStub::ConfigureNmeaTypesRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureNmea(const locStub::ConfigureNmeaRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureEngineIntegrityRisk(
+        const locStub::ConfigureEngineIntegrityRiskRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureXtraParams(const locStub::ConfigureXtraParamsRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status RequestXtraStatus(const google::protobuf::Empty* request,
+        locStub::RequestXtraStatusReply* response);
+    grpc::Status InjectMerkleTree(const google::protobuf::Empty* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ConfigureOsnma(const locStub::ConfigureOsnmaRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status RegisterListener(const locStub::RegisterListenerRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status ProvideXtraConsent(const locStub::XtraConsentRequest* request,
+        locStub::LocManagerCommandReply* response);
+
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
     bool xtraEnabled_;
     bool xtraConsent_ = true;
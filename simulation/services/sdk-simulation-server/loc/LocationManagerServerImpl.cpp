@@ -18,9 +18,11 @@
 #include "LocationReportService.hpp"
 #include "event/EventService.hpp"
 #include "FileInfo.hpp"
+#include "common/RpcExecutor.hpp"
 #include <telux/loc/LocationDefines.hpp>
 #include <thread>
 #include <chrono>
+#include <cstdlib>
 
 #include <fstream>
 #include <sstream>
@@ -31,6 +33,10 @@
 #define CSV_BATCH_COUNT 1000
 #define DEFAULT_DELIMITER " "
 #define DEFAULT_CAPABILITIES 0x12D
+// Fields of a location report used to decimate it
+#define LOC_REPORT_TIMESTAMP_INDEX 2
+#define LOC_REPORT_ENGINE_INDEX 3
+#define LOC_REPORT_VALIDITY_INDEX 14
 
 LocationManagerServerImpl::LocationManagerServerImpl() {
     LOG(DEBUG, __FUNCTION__);
@@ -66,6 +72,27 @@ bool LocationManagerServerImpl::init() {
     return true;
 }
 
+void LocationManagerServerImpl::getLocationReportWindow(const std::string &report,
+    uint64_t &timestamp, uint32_t &engineType) {
+    // Only the fields needed for the decimation are parsed
+    std::size_t fieldStart[LOC_REPORT_VALIDITY_INDEX + 1];
+    fieldStart[0] = 0;
+    for(int i = 1; i <= LOC_REPORT_VALIDITY_INDEX; ++i) {
+        std::size_t pos = report.find(',', fieldStart[i - 1]);
+        if(pos == std::string::npos) {
+            return;
+        }
+        fieldStart[i] = pos + 1;
+    }
+    engineType = std::strtoul(report.c_str() + fieldStart[LOC_REPORT_ENGINE_INDEX], nullptr, 10);
+    telux::loc::LocationInfoValidity validity =
+        std::strtoul(report.c_str() + fieldStart[LOC_REPORT_VALIDITY_INDEX], nullptr, 10);
+    if(validity & telux::loc::HAS_TIMESTAMP_BIT) {
+        timestamp = std::strtoull(
+            report.c_str() + fieldStart[LOC_REPORT_TIMESTAMP_INDEX], nullptr, 10);
+    }
+}
+
 void LocationManagerServerImpl::startStreaming() {
     LOG(DEBUG, __FUNCTION__);
     while(true) {
@@ -79,11 +106,20 @@ void LocationManagerServerImpl::startStreaming() {
                 anyResponse.mutable_any()->PackFrom(startReportsEvent);
                 //posting the event to EventService event queue
                 auto &locationReportService = LocationReportService::getInstance();
-                locationReportService.updateEventQueue(anyResponse);
+                std::size_t pos = requestBuffer_[0].find(',');
+                uint32_t opt = std::strtoul(requestBuffer_[0].c_str() + pos + 1, nullptr, 10);
+                if(opt == telux::loc::GnssReportType::LOCATION) {
+                    // Location reports are decimated per client
+                    uint64_t timestamp = telux::loc::UNKNOWN_TIMESTAMP;
+                    uint32_t engineType = 0;
+                    getLocationReportWindow(requestBuffer_[0], timestamp, engineType);
+                    locationReportService.postLocationReport(anyResponse, timestamp, engineType);
+                } else {
+                    locationReportService.updateEventQueue(anyResponse);
+                }
 
                 // Sleep to match the frequency by extracting the current timestamp
                 // and subtracting from the previous.
-                std::size_t pos = requestBuffer_[0].find(',');
                 uint64_t currentTimestamp = std::stoull(requestBuffer_[0].substr(0, pos));
                 if(previousTimestamp_ != 0) {
                     std::this_thread::sleep_for(
@@ -92,8 +128,6 @@ void LocationManagerServerImpl::startStreaming() {
                 previousTimestamp_ = currentTimestamp;
 
                 // Store last location for fetching terrestrial position.
-                std::size_t pos2 = requestBuffer_[0].find(',', pos);
-                uint32_t opt = std::stoul(requestBuffer_[0].substr(pos + 1, pos2));
                 if(opt == telux::loc::GnssReportType::LOCATION) {
                     lastLocInfo_ = requestBuffer_[0];
                 }
@@ -110,6 +144,7 @@ void LocationManagerServerImpl::startStreaming() {
             previousTimestamp_ = 0;
             if(replayCsv_) {
                 LOG(INFO, " Last batch streamed. Replaying CSV.");
+                LocationReportService::getInstance().resetWindows();
                 triggerResetWindowEvent();
                 //Restart buffering
                 fileBuffer_->startBuffering();
@@ -151,8 +186,8 @@ LocationManagerServerImpl::~LocationManagerServerImpl() {
     }
 }
 
-grpc::Status LocationManagerServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, locStub::GetServiceStatusReply* response) {
+grpc::Status LocationManagerServerImpl::InitService(const google::protobuf::Empty* request,
+    locStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int cbDelay = 100;
     telux::common::ServiceStatus serviceStatus = telux::common::ServiceStatus::SERVICE_FAILED;
@@ -203,39 +238,46 @@ void LocationManagerServerImpl::updateStreamRequest() {
     }
 }
 
-grpc::Status LocationManagerServerImpl::StartBasicReports(ServerContext* context,
-    const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) {
+grpc::Status LocationManagerServerImpl::StartBasicReports(
+    const locStub::StartReportsRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("startBasicReports", response);
     if (response->error() == ::commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
+        LocationReportService::getInstance().startSession(
+            request->client_id(), request->interval(), request->engine_mask());
         updateStreamRequest();
     }
     return grpc::Status::OK;
 }
 
-grpc::Status LocationManagerServerImpl::StartDetailedReports(ServerContext* context,
-    const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) {
+grpc::Status LocationManagerServerImpl::StartDetailedReports(
+    const locStub::StartReportsRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("startDetailedReports", response);
     if (response->error() == ::commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
+        LocationReportService::getInstance().startSession(
+            request->client_id(), request->interval(), request->engine_mask());
         updateStreamRequest();
     }
     return grpc::Status::OK;
 }
 
-grpc::Status LocationManagerServerImpl::StartDetailedEngineReports(ServerContext* context,
-    const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) {
+grpc::Status LocationManagerServerImpl::StartDetailedEngineReports(
+    const locStub::StartReportsRequest* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("startDetailedEngineReports", response);
     if (response->error() == ::commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
+        LocationReportService::getInstance().startSession(
+            request->client_id(), request->interval(), request->engine_mask());
         updateStreamRequest();
     }
     return grpc::Status::OK;
 }
 
-grpc::Status LocationManagerServerImpl::StopReports(ServerContext* context,
-    const google::protobuf::Empty* request, google::protobuf::Empty* response) {
+grpc::Status LocationManagerServerImpl::StopReports(const locStub::StopReportsRequest* request,
+    google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
+    LocationReportService::getInstance().stopSession(request->client_id());
     if(bufferingInitialized_) {
         auto &locationReportService = LocationReportService::getInstance();
         size_t clientSize = locationReportService.getClientsForFilter("LOC_REPORTS");
@@ -252,8 +294,8 @@ grpc::Status LocationManagerServerImpl::StopReports(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status LocationManagerServerImpl::RegisterLocationSystemInfo(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response){
+grpc::Status LocationManagerServerImpl::RegisterLocationSystemInfo(
+    const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("registerForSystemInfoUpdates", response);
     auto f = std::async(std::launch::async, [this](){
@@ -263,22 +305,22 @@ grpc::Status LocationManagerServerImpl::RegisterLocationSystemInfo(ServerContext
     return grpc::Status::OK;
 }
 
-grpc::Status LocationManagerServerImpl::DeregisterLocationSystemInfo(ServerContext* context,
-      const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response){
+grpc::Status LocationManagerServerImpl::DeregisterLocationSystemInfo(
+    const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("deRegisterForSystemInfoUpdates", response);
     return grpc::Status::OK;
 }
 
-grpc::Status LocationManagerServerImpl::GetTerrestrialPosition(ServerContext* context,
-      const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response){
+grpc::Status LocationManagerServerImpl::GetTerrestrialPosition(
+    const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("getTerrestrialPosition", response);
     return grpc::Status::OK;
 }
 
-grpc::Status LocationManagerServerImpl::CancelTerrestrialPosition(ServerContext* context,
-      const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response){
+grpc::Status LocationManagerServerImpl::CancelTerrestrialPosition(
+    const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("cancelTerrestrialPositionRequest", response);
     return grpc::Status::OK;
@@ -298,7 +340,7 @@ void LocationManagerServerImpl::apiJsonReader(
     response->set_delay(cbDelay);
 }
 
-grpc::Status LocationManagerServerImpl::RequestEnergyConsumedInfo(ServerContext* context,
+grpc::Status LocationManagerServerImpl::RequestEnergyConsumedInfo(
     const google::protobuf::Empty* request, locStub::RequestEnergyConsumedInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootNode;
@@ -333,8 +375,8 @@ grpc::Status LocationManagerServerImpl::RequestEnergyConsumedInfo(ServerContext*
     return grpc::Status::OK;
 }
 
-grpc::Status LocationManagerServerImpl::GetYearOfHw(ServerContext* context,
-    const google::protobuf::Empty* request, locStub::GetYearOfHwReply* response) {
+grpc::Status LocationManagerServerImpl::GetYearOfHw(const google::protobuf::Empty* request,
+    locStub::GetYearOfHwReply* response) {
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootNode;
     JsonParser::readFromJsonFile(rootNode, LOC_MGR_API_JSON);
@@ -359,8 +401,8 @@ grpc::Status LocationManagerServerImpl::GetYearOfHw(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status LocationManagerServerImpl::GetCapabilities(ServerContext* context,
-    const google::protobuf::Empty* request, locStub::GetCapabilitiesReply* response) {
+grpc::Status LocationManagerServerImpl::GetCapabilities(const google::protobuf::Empty* request,
+    locStub::GetCapabilitiesReply* response) {
     LOG(DEBUG, __FUNCTION__);
     response->set_loc_capability(capabilityMask_);
     return grpc::Status::OK;
@@ -579,9 +621,100 @@ void LocationManagerServerImpl::triggerSysinfoUpdateEvent() {
     eventImpl.updateEventQueue(anyResponse);
 }
 
-grpc::Status LocationManagerServerImpl::GetLastLocation(ServerContext* context,
-    const google::protobuf::Empty* request, locStub::LastLocationInfo* response) {
+grpc::Status LocationManagerServerImpl::GetLastLocation(const google::protobuf::Empty* request,
+    locStub::LastLocationInfo* response) {
     LOG(DEBUG, __FUNCTION__);
     response->set_loc_report(lastLocInfo_);
     return grpc::Status::OK;
 }
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::StartBasicReports(
+    grpc::CallbackServerContext* context, const locStub::StartReportsRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StartBasicReports(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::StartDetailedReports(
+    grpc::CallbackServerContext* context, const locStub::StartReportsRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StartDetailedReports(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::StartDetailedEngineReports(
+    grpc::CallbackServerContext* context, const locStub::StartReportsRequest* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StartDetailedEngineReports(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::StopReports(
+    grpc::CallbackServerContext* context, const locStub::StopReportsRequest* request,
+    google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StopReports(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::RegisterLocationSystemInfo(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RegisterLocationSystemInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::DeregisterLocationSystemInfo(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DeregisterLocationSystemInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::RequestEnergyConsumedInfo(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::RequestEnergyConsumedInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestEnergyConsumedInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::GetYearOfHw(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::GetYearOfHwReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetYearOfHw(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::GetCapabilities(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::GetCapabilitiesReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetCapabilities(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::GetTerrestrialPosition(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetTerrestrialPosition(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::CancelTerrestrialPosition(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::LocManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CancelTerrestrialPosition(request, response); });
+}
+
+grpc::ServerUnaryReactor* LocationManagerServerImpl::GetLastLocation(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    locStub::LastLocationInfo* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetLastLocation(request, response); });
+}
@@ -36,44 +36,78 @@ using grpc::Status;
 
 using locStub::LocationManagerService;
 
-class LocationManagerServerImpl final : public locStub::LocationManagerService::Service,
+class LocationManagerServerImpl final : public locStub::LocationManagerService::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<LocationManagerServerImpl> {
  public:
     LocationManagerServerImpl();
     ~LocationManagerServerImpl();
-    grpc::Status InitService(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* StartBasicReports(grpc::CallbackServerContext* context,
+        const locStub::StartReportsRequest* request,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* StartDetailedReports(grpc::CallbackServerContext* context,
+        const locStub::StartReportsRequest* request,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* StartDetailedEngineReports(grpc::CallbackServerContext* context,
+        const locStub::StartReportsRequest* request,
+        locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* StopReports(grpc::CallbackServerContext* context,
+        const locStub::StopReportsRequest* request, google::protobuf::Empty* response) override;
+    grpc::ServerUnaryReactor* RegisterLocationSystemInfo(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* DeregisterLocationSystemInfo(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* RequestEnergyConsumedInfo(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        locStub::RequestEnergyConsumedInfoReply* response) override;
+    grpc::ServerUnaryReactor* GetYearOfHw(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::GetYearOfHwReply* response) override;
+    grpc::ServerUnaryReactor* GetCapabilities(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::GetCapabilitiesReply* response) override;
+    grpc::ServerUnaryReactor* GetTerrestrialPosition(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* CancelTerrestrialPosition(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* GetLastLocation(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, locStub::LastLocationInfo* response) override;
+    void onEventUpdate(::eventService::UnsolicitedEvent event) override;
+
+ private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
         locStub::GetServiceStatusReply* response);
-    grpc::Status StartBasicReports(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::Status StartBasicReports(const locStub::StartReportsRequest* request,
         locStub::LocManagerCommandReply* response);
-    grpc::Status StartDetailedReports(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response);
-    grpc::Status StartDetailedEngineReports(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response);
-    grpc::Status StopReports(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::Status StartDetailedReports(const locStub::StartReportsRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status StartDetailedEngineReports(const locStub::StartReportsRequest* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status StopReports(const locStub::StopReportsRequest* request,
         google::protobuf::Empty* response);
-    grpc::Status RegisterLocationSystemInfo(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response);
-    grpc::Status DeregisterLocationSystemInfo(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response);
-    grpc::Status RequestEnergyConsumedInfo(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::RequestEnergyConsumedInfoReply* response);
-    grpc::Status GetYearOfHw(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::GetYearOfHwReply* response);
-    grpc::Status GetCapabilities(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::GetCapabilitiesReply* response);
-    grpc::Status GetTerrestrialPosition(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response);
-    grpc::Status CancelTerrestrialPosition(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::LocManagerCommandReply* response);
-    grpc::Status GetLastLocation(ServerContext* context,
-        const google::protobuf::Empty* request, locStub::LastLocationInfo* response);
-    void onEventUpdate(::eventService::UnsolicitedEvent event) override;
+    grpc::Status RegisterLocationSystemInfo(const google::protobuf::Empty* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status DeregisterLocationSystemInfo(const google::protobuf::Empty* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status RequestEnergyConsumedInfo(const google::protobuf::Empty* request,
+        locStub::RequestEnergyConsumedInfoReply* response);
+    grpc::Status GetYearOfHw(const google::protobuf::Empty* request,
+        locStub::GetYearOfHwReply* response);
+    grpc::Status GetCapabilities(const google::protobuf::Empty* request,
+        locStub::GetCapabilitiesReply* response);
+    grpc::Status GetTerrestrialPosition(const google::protobuf::Empty* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status CancelTerrestrialPosition(const google::protobuf::Empty* request,
+        locStub::LocManagerCommandReply* response);
+    grpc::Status GetLastLocation(const google::protobuf::Empty* request,
+        locStub::LastLocationInfo* response);
 
- private:
     void apiJsonReader(std::string apiName, locStub::LocManagerCommandReply* response);
     bool init();
     void startStreaming();
+    static void getLocationReportWindow(const std::string &report, uint64_t &timestamp,
+        uint32_t &engineType);
     void updateStreamRequest();
     void onEventUpdate(std::string event);
     void handleEvent(std::string token, std::string event);
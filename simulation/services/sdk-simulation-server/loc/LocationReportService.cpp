@@ -3,9 +3,14 @@
  *  SPDX-License-Identifier: BSD-3-Clause-Clear
  */
 
+#include <telux/loc/LocationDefines.hpp>
+
 #include "LocationReportService.hpp"
 #include "libs/common/Logger.hpp"
 
+// Same tolerance as the window of the clients
+#define GRACE_TIME_MS 50
+
 LocationReportService::LocationReportService() {
     LOG(DEBUG, __FUNCTION__);
 }
@@ -16,4 +21,72 @@ LocationReportService &LocationReportService::getInstance() {
     LOG(DEBUG, __FUNCTION__);
     static LocationReportService instance;
     return instance;
-}
\ No newline at end of file
+}
+
+void LocationReportService::startSession(int clientId, uint32_t interval,
+    uint32_t engineMask) {
+    LOG(DEBUG, __FUNCTION__, " clientId: ", clientId, " interval: ", interval,
+        " engineMask: ", engineMask);
+    Session session;
+    session.interval = interval;
+    session.engineMask = engineMask;
+    session.previousTimestamps.fill(telux::loc::UNKNOWN_TIMESTAMP);
+    std::lock_guard<std::mutex> lck(sessionMtx_);
+    sessions_[clientId] = session;
+}
+
+void LocationReportService::stopSession(int clientId) {
+    LOG(DEBUG, __FUNCTION__, " clientId: ", clientId);
+    std::lock_guard<std::mutex> lck(sessionMtx_);
+    sessions_.erase(clientId);
+}
+
+void LocationReportService::resetWindows() {
+    LOG(DEBUG, __FUNCTION__);
+    std::lock_guard<std::mutex> lck(sessionMtx_);
+    for (auto &entry : sessions_) {
+        entry.second.previousTimestamps.fill(telux::loc::UNKNOWN_TIMESTAMP);
+    }
+}
+
+bool LocationReportService::isInWindow(Session &session, uint32_t engineType,
+    uint64_t timestamp) {
+    if ((session.interval == 0) || (timestamp == telux::loc::UNKNOWN_TIMESTAMP)) {
+        return true;
+    }
+    uint64_t &previousTimestamp = session.previousTimestamps[engineType];
+    if (previousTimestamp != telux::loc::UNKNOWN_TIMESTAMP) {
+        uint64_t timeDifference = timestamp - previousTimestamp;
+        uint64_t lowerBound = session.interval - GRACE_TIME_MS;
+        uint64_t upperBound = session.interval + GRACE_TIME_MS;
+        if (!((timeDifference > lowerBound) && (timeDifference < upperBound))
+            && !(timeDifference > upperBound)) {
+            return false;
+        }
+    }
+    previousTimestamp = timestamp;
+    return true;
+}
+
+void LocationReportService::postLocationReport(const ::eventService::EventResponse &event,
+    uint64_t timestamp, uint32_t engineType) {
+    std::vector<int> skippedClients;
+    {
+        std::lock_guard<std::mutex> lck(sessionMtx_);
+        for (auto &entry : sessions_) {
+            Session &session = entry.second;
+            if ((engineType >= ENGINE_COUNT) || !(session.engineMask & (1u << engineType))
+                || !isInWindow(session, engineType, timestamp)) {
+                skippedClients.push_back(entry.first);
+            }
+        }
+    }
+    updateEventQueue(event, std::move(skippedClients));
+}
+
+grpc::Status LocationReportService::cleanup(ServerContext* context,
+    const ::eventService::CleanupRequest* request, google::protobuf::Empty* response) {
+    stopSession(request->client_id());
+    return EventServiceHelper<::locStub::EventDispatcherService>::cleanup(
+        context, request, response);
+}
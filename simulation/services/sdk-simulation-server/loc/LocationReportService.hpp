@@ -6,6 +6,11 @@
 #ifndef LOC_REPORT_SERVER_HPP
 #define LOC_REPORT_SERVER_HPP
 
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
 #include "event/EventServiceHelper.hpp"
 #include "protos/proto-src/loc_simulation.grpc.pb.h"
 
@@ -15,13 +20,58 @@ class LocationReportService final:
     * @brief This class acts as the report event service for the location framework
     *        on the server side & is responsible for forwarding the reports
     *        to the eventManager on the client side via writing to the stream.
+    *        Location reports are decimated to the interval each client requested, so a
+    *        client only receives the reports it keeps.
     */
 public:
     static LocationReportService &getInstance();
 
+    /**
+     * @brief Starts decimating the location reports streamed to a client.
+     *
+     * @param [in] clientId    Client id of the report stream
+     * @param [in] interval    Interval in milliseconds, 0 to stream all the reports
+     * @param [in] engineMask  LocReqEngine of the location reports to stream
+     */
+    void startSession(int clientId, uint32_t interval, uint32_t engineMask);
+
+    void stopSession(int clientId);
+
+    /**
+     * @brief Restarts the decimation of all the clients, the timestamps start over when
+     *        the reports are replayed.
+     */
+    void resetWindows();
+
+    /**
+     * @brief Streams a location report to the clients it is due for.
+     *
+     * @param [in] timestamp   UTC timestamp of the report, UNKNOWN_TIMESTAMP if not valid
+     * @param [in] engineType  LocationAggregationType of the report
+     */
+    void postLocationReport(const ::eventService::EventResponse &event, uint64_t timestamp,
+        uint32_t engineType);
+
+    grpc::Status cleanup(ServerContext* context, const ::eventService::CleanupRequest* request,
+        google::protobuf::Empty* response) override;
+
 private:
+    static const int ENGINE_COUNT = 4;
+
+    struct Session {
+        uint32_t interval = 0;
+        uint32_t engineMask = 0;
+        /* Timestamp of the last report streamed, per engine */
+        std::array<uint64_t, ENGINE_COUNT> previousTimestamps;
+    };
+
     LocationReportService();
     ~LocationReportService();
+
+    static bool isInWindow(Session &session, uint32_t engineType, uint64_t timestamp);
+
+    std::mutex sessionMtx_;
+    std::unordered_map<int, Session> sessions_;
 };
 
-#endif // LOC_REPORT_SERVER_HPP
\ No newline at end of file
+#endif // LOC_REPORT_SERVER_HPP
@@ -9,6 +9,7 @@
 #include "libs/common/Logger.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define ANTENNA_MANAGER_API_JSON "api/platform/IAntennaManager.json"
 #define ANTENNA_MANAGER_FILTER "antenna_manager"
@@ -157,8 +158,8 @@ void AntennaManagerServerImpl::onSSREvent(telux::common::ServiceStatus srvStatus
     clientEvent_.updateEventQueue(anyResponse);
 }
 
-grpc::Status AntennaManagerServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+grpc::Status AntennaManagerServerImpl::InitService(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
     telux::common::Status status = telux::common::Status::SUCCESS;
@@ -189,9 +190,8 @@ grpc::Status AntennaManagerServerImpl::InitService(ServerContext* context,
     return setResponse(srvStatus,response);
 }
 
-grpc::Status AntennaManagerServerImpl::GetServiceStatus(ServerContext* context,
-        const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response) {
+grpc::Status AntennaManagerServerImpl::GetServiceStatus(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     telux::common::ServiceStatus srvStatus = getServiceStatus();
@@ -200,16 +200,16 @@ grpc::Status AntennaManagerServerImpl::GetServiceStatus(ServerContext* context,
     return setResponse(srvStatus,response);
 }
 
-grpc::Status AntennaManagerServerImpl::SetActiveAntenna(ServerContext* context,
-    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+grpc::Status AntennaManagerServerImpl::SetActiveAntenna(const google::protobuf::Empty* request,
+    platformStub::DefaultReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
     apiJsonReader("SetActiveAntenna", response);
     return grpc::Status::OK;
 }
 
-grpc::Status AntennaManagerServerImpl::GetActiveAntenna(ServerContext* context,
-    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+grpc::Status AntennaManagerServerImpl::GetActiveAntenna(const google::protobuf::Empty* request,
+    platformStub::DefaultReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
     apiJsonReader("GetActiveAntenna", response);
@@ -231,4 +231,32 @@ void AntennaManagerServerImpl::apiJsonReader(
     response->set_status(static_cast<::commonStub::Status>(status));
     response->set_error(static_cast<::commonStub::ErrorCode>(errorCode));
     response->set_delay(cbDelay);
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* AntennaManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* AntennaManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* AntennaManagerServerImpl::GetActiveAntenna(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    platformStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetActiveAntenna(request, response); });
+}
+
+grpc::ServerUnaryReactor* AntennaManagerServerImpl::SetActiveAntenna(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    platformStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetActiveAntenna(request, response); });
+}
@@ -24,25 +24,37 @@ using platformStub::AntennaManagerService;
 
 class AntennaManagerServerImpl final :
     public IServerEventListener,
-    public platformStub::AntennaManagerService::Service,
+    public platformStub::AntennaManagerService::CallbackService,
     public std::enable_shared_from_this<AntennaManagerServerImpl> {
  public:
     AntennaManagerServerImpl();
     ~AntennaManagerServerImpl();
 
-    grpc::Status InitService(ServerContext* context, const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response);
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response) override;
 
-    grpc::Status GetServiceStatus(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
 
-    grpc::Status GetActiveAntenna(ServerContext* context, const google::protobuf::Empty* request,
-        platformStub::DefaultReply* response);
+    grpc::ServerUnaryReactor* GetActiveAntenna(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, platformStub::DefaultReply* response) override;
 
-    grpc::Status SetActiveAntenna(ServerContext* context, const google::protobuf::Empty* request,
-        platformStub::DefaultReply* response);
+    grpc::ServerUnaryReactor* SetActiveAntenna(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, platformStub::DefaultReply* response) override;
 
  private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetActiveAntenna(const google::protobuf::Empty* request,
+        platformStub::DefaultReply* response);
+    grpc::Status SetActiveAntenna(const google::protobuf::Empty* request,
+        platformStub::DefaultReply* response);
+
     void apiJsonReader(std::string apiName, platformStub::DefaultReply* response);
     void onSSREvent(telux::common::ServiceStatus srvStatus);
     grpc::Status setResponse(telux::common::ServiceStatus srvStatus,
@@ -9,6 +9,7 @@
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
 #include "common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define DEVICE_INFO_MANAGER_API_JSON "api/platform/IDeviceInfoManager.json"
 #define DEVICE_INFO_MANAGER_SYSTEM_INFO_JSON "system-info/platform/IDeviceInfoManager.json"
@@ -249,8 +250,8 @@ void DeviceInfoManagerServerImpl::onSSREvent(telux::common::ServiceStatus srvSta
     clientEvent_.updateEventQueue(anyResponse);
 }
 
-grpc::Status DeviceInfoManagerServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+grpc::Status DeviceInfoManagerServerImpl::InitService(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
     telux::common::Status status = telux::common::Status::SUCCESS;
@@ -281,9 +282,8 @@ grpc::Status DeviceInfoManagerServerImpl::InitService(ServerContext* context,
     return setResponse(srvStatus, response);
 }
 
-grpc::Status DeviceInfoManagerServerImpl::GetServiceStatus(ServerContext* context,
-        const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response) {
+grpc::Status DeviceInfoManagerServerImpl::GetServiceStatus(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     telux::common::ServiceStatus srvStatus = getServiceStatus();
@@ -292,8 +292,8 @@ grpc::Status DeviceInfoManagerServerImpl::GetServiceStatus(ServerContext* contex
     return setResponse(srvStatus,response);
 }
 
-grpc::Status DeviceInfoManagerServerImpl::GetPlatformVersion(ServerContext* context,
-const google::protobuf::Empty* request, platformStub::PlatformVersionInfo* response){
+grpc::Status DeviceInfoManagerServerImpl::GetPlatformVersion(const google::protobuf::Empty* request,
+    platformStub::PlatformVersionInfo* response) {
     LOG(DEBUG,__FUNCTION__);
 
     std::string apiJsonPath = DEVICE_INFO_MANAGER_API_JSON;
@@ -332,8 +332,8 @@ const google::protobuf::Empty* request, platformStub::PlatformVersionInfo* respo
     return grpc::Status::OK;
 }
 
-grpc::Status DeviceInfoManagerServerImpl::GetIMEI(ServerContext* context,
-const google::protobuf::Empty* request, platformStub::PlatformImeiInfo* response){
+grpc::Status DeviceInfoManagerServerImpl::GetIMEI(const google::protobuf::Empty* request,
+    platformStub::PlatformImeiInfo* response) {
     LOG(DEBUG,__FUNCTION__);
 
     std::string apiJsonPath = DEVICE_INFO_MANAGER_API_JSON;
@@ -360,4 +360,31 @@ const google::protobuf::Empty* request, platformStub::PlatformImeiInfo* response
     response->set_imei_info(imei);
 
     return grpc::Status::OK;
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* DeviceInfoManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* DeviceInfoManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* DeviceInfoManagerServerImpl::GetPlatformVersion(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    platformStub::PlatformVersionInfo* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetPlatformVersion(request, response); });
+}
+
+grpc::ServerUnaryReactor* DeviceInfoManagerServerImpl::GetIMEI(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, platformStub::PlatformImeiInfo* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetIMEI(request, response); });
+}
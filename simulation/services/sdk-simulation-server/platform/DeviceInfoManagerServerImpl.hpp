@@ -25,25 +25,38 @@ using platformStub::DeviceInfoManagerService;
 
 class DeviceInfoManagerServerImpl final :
     public IServerEventListener,
-    public platformStub::DeviceInfoManagerService::Service,
+    public platformStub::DeviceInfoManagerService::CallbackService,
     public std::enable_shared_from_this<DeviceInfoManagerServerImpl> {
  public:
     DeviceInfoManagerServerImpl();
     ~DeviceInfoManagerServerImpl();
 
-    grpc::Status InitService(ServerContext* context, const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response);
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response) override;
 
-    grpc::Status GetServiceStatus(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
 
-    grpc::Status GetPlatformVersion(ServerContext* context, const google::protobuf::Empty* request,
-        platformStub::PlatformVersionInfo* response);
+    grpc::ServerUnaryReactor* GetPlatformVersion(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        platformStub::PlatformVersionInfo* response) override;
 
-    grpc::Status GetIMEI(ServerContext* context, const google::protobuf::Empty* request,
-        platformStub::PlatformImeiInfo* response);
+    grpc::ServerUnaryReactor* GetIMEI(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, platformStub::PlatformImeiInfo* response) override;
 
  private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetPlatformVersion(const google::protobuf::Empty* request,
+        platformStub::PlatformVersionInfo* response);
+    grpc::Status GetIMEI(const google::protobuf::Empty* request,
+        platformStub::PlatformImeiInfo* response);
+
     void onSSREvent(telux::common::ServiceStatus srvStatus);
     grpc::Status setResponse(telux::common::ServiceStatus srvStatus,
         commonStub::GetServiceStatusReply* response);
@@ -10,6 +10,7 @@
 #include "libs/common/CommonUtils.hpp"
 #include "event/EventService.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define FS_MANAGER_API_JSON "api/platform/IFsManager.json"
 #define FS_EVENT_INFO_JSON "system-state/platform/FsManagerState.json"
@@ -91,8 +92,8 @@ void FsManagerServerImpl::updateSystemStateJson() {
     JsonParser::writeToJsonFile(root, FS_EVENT_INFO_JSON);
 }
 
-grpc::Status FsManagerServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+grpc::Status FsManagerServerImpl::InitService(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
     telux::common::Status status = telux::common::Status::SUCCESS;
@@ -144,9 +145,8 @@ grpc::Status FsManagerServerImpl::InitService(ServerContext* context,
     return setResponse(srvStatus,response);
 }
 
-grpc::Status FsManagerServerImpl::GetServiceStatus(ServerContext* context,
-        const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response) {
+grpc::Status FsManagerServerImpl::GetServiceStatus(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     telux::common::ServiceStatus srvStatus = getServiceStatus();
@@ -547,8 +547,8 @@ void FsManagerServerImpl::triggerFsEvent(std::string fsEventName,
     clientEvent_.updateEventQueue(anyResponse);
 }
 
-grpc::Status FsManagerServerImpl::StartEfsBackup(ServerContext* context,
-    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+grpc::Status FsManagerServerImpl::StartEfsBackup(const google::protobuf::Empty* request,
+    platformStub::DefaultReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
     apiJsonReader("startEfsBackup", response);
@@ -558,24 +558,23 @@ grpc::Status FsManagerServerImpl::StartEfsBackup(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FsManagerServerImpl::PrepareForEcall(ServerContext* context,
-    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+grpc::Status FsManagerServerImpl::PrepareForEcall(const google::protobuf::Empty* request,
+    platformStub::DefaultReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
     apiJsonReader("prepareForEcall", response);
     return grpc::Status::OK;
 }
 
-grpc::Status FsManagerServerImpl::ECallCompleted(ServerContext* context,
-    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+grpc::Status FsManagerServerImpl::ECallCompleted(const google::protobuf::Empty* request,
+    platformStub::DefaultReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
     apiJsonReader("eCallCompleted", response);
     return grpc::Status::OK;
 }
 
-grpc::Status FsManagerServerImpl::PrepareForOta(ServerContext* context,
-    const ::platformStub::FsEventName* request,
+grpc::Status FsManagerServerImpl::PrepareForOta(const ::platformStub::FsEventName* request,
     platformStub::DefaultReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
@@ -604,8 +603,7 @@ grpc::Status FsManagerServerImpl::PrepareForOta(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FsManagerServerImpl::OtaCompleted(ServerContext* context,
-    const google::protobuf::Empty* request,
+grpc::Status FsManagerServerImpl::OtaCompleted(const google::protobuf::Empty* request,
     platformStub::DefaultReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
@@ -622,8 +620,8 @@ grpc::Status FsManagerServerImpl::OtaCompleted(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status FsManagerServerImpl::StartAbSync(ServerContext* context,
-const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+grpc::Status FsManagerServerImpl::StartAbSync(const google::protobuf::Empty* request,
+    platformStub::DefaultReply* response) {
     LOG(DEBUG,__FUNCTION__);
 
     apiJsonReader("startAbSync", response);
@@ -652,4 +650,53 @@ void FsManagerServerImpl::apiJsonReader(
     response->set_status(static_cast<::commonStub::Status>(status));
     response->set_error(static_cast<::commonStub::ErrorCode>(errorCode));
     response->set_delay(cbDelay);
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* FsManagerServerImpl::InitService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* FsManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* FsManagerServerImpl::StartEfsBackup(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StartEfsBackup(request, response); });
+}
+
+grpc::ServerUnaryReactor* FsManagerServerImpl::PrepareForEcall(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return PrepareForEcall(request, response); });
+}
+
+grpc::ServerUnaryReactor* FsManagerServerImpl::ECallCompleted(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ECallCompleted(request, response); });
+}
+
+grpc::ServerUnaryReactor* FsManagerServerImpl::PrepareForOta(grpc::CallbackServerContext* context,
+    const ::platformStub::FsEventName* request, platformStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return PrepareForOta(request, response); });
+}
+
+grpc::ServerUnaryReactor* FsManagerServerImpl::OtaCompleted(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return OtaCompleted(request, response); });
+}
+
+grpc::ServerUnaryReactor* FsManagerServerImpl::StartAbSync(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, platformStub::DefaultReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return StartAbSync(request, response); });
+}
@@ -24,34 +24,52 @@ using grpc::Status;
 using platformStub::FsManagerService;
 
 class FsManagerServerImpl final :
-    public platformStub::FsManagerService::Service,
+    public platformStub::FsManagerService::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<FsManagerServerImpl> {
  public:
     FsManagerServerImpl();
     ~FsManagerServerImpl();
 
-    grpc::Status InitService(ServerContext* context, const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response);
-    grpc::Status GetServiceStatus(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status StartEfsBackup(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* StartEfsBackup(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, platformStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* PrepareForEcall(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, platformStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* ECallCompleted(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, platformStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* PrepareForOta(grpc::CallbackServerContext* context,
+        const ::platformStub::FsEventName* request, platformStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* OtaCompleted(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, platformStub::DefaultReply* response) override;
+    grpc::ServerUnaryReactor* StartAbSync(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, platformStub::DefaultReply* response) override;
+    void onEventUpdate(::eventService::UnsolicitedEvent event) override;
+
+ private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status StartEfsBackup(const google::protobuf::Empty* request,
         platformStub::DefaultReply* response);
-    grpc::Status PrepareForEcall(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::Status PrepareForEcall(const google::protobuf::Empty* request,
         platformStub::DefaultReply* response);
-    grpc::Status ECallCompleted(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::Status ECallCompleted(const google::protobuf::Empty* request,
         platformStub::DefaultReply* response);
-    grpc::Status PrepareForOta(ServerContext* context,
-        const ::platformStub::FsEventName* request,
+    grpc::Status PrepareForOta(const ::platformStub::FsEventName* request,
         platformStub::DefaultReply* response);
-    grpc::Status OtaCompleted(ServerContext* context,
-        const google::protobuf::Empty* request,
+    grpc::Status OtaCompleted(const google::protobuf::Empty* request,
         platformStub::DefaultReply* response);
-    grpc::Status StartAbSync(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::Status StartAbSync(const google::protobuf::Empty* request,
         platformStub::DefaultReply* response);
-    void onEventUpdate(::eventService::UnsolicitedEvent event) override;
 
- private:
     void apiJsonReader(std::string apiName, platformStub::DefaultReply* response);
     void onEventUpdate(std::string event);
     void handleEvent(std::string token, std::string event);
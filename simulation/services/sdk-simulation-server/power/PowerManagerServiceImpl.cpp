@@ -5,6 +5,7 @@
 
 #include "PowerManagerServiceImpl.hpp"
 #include "libs/common/SimulationConfigParser.hpp"
+#include "common/RpcExecutor.hpp"
 #include <thread>
 #include "libs/common/Logger.hpp"
 #include "libs/common/JsonParser.hpp"
@@ -13,6 +14,8 @@
 
 #define POWER_API_JSON "api/power/ITcuActivityManager.json"
 #define DEFAULT_DELIMITER " "
+#define DEFAULT_SUSPEND_ACK_TIMEOUT_MS 2000
+#define DEFAULT_SUSPEND_RESUME_TIMEOUT_MS 10000
 
 PowerManagerServiceImpl::PowerManagerServiceImpl() {
     LOG(DEBUG, __FUNCTION__);
@@ -22,8 +25,8 @@ PowerManagerServiceImpl::~PowerManagerServiceImpl() {
     LOG(DEBUG, __FUNCTION__, " Destructing");
 }
 
-grpc::Status PowerManagerServiceImpl::InitService(ServerContext* context,
-    const powerStub::PowerClientConnect* request, powerStub::GetServiceStatusReply* response) {
+grpc::Status PowerManagerServiceImpl::InitService(const powerStub::PowerClientConnect* request,
+    powerStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int cbDelay = 100;
     telux::common::ServiceStatus serviceStatus = telux::common::ServiceStatus::SERVICE_FAILED;
@@ -62,17 +65,12 @@ grpc::Status PowerManagerServiceImpl::InitService(ServerContext* context,
                 serviceStatus = telux::common::ServiceStatus::SERVICE_FAILED;
             }
         } else {
-            ClientInfo slaveInfo {};
-            slaveInfo.clientType_ = clientType;
-            slaveInfo.clientName_ = clientName;
             if(machineName == ::powerStub::MachineName::MACH_LOCAL) {
-                slaveInfo.machineName_ = telux::power::LOCAL_MACHINE;
+                ackAggregator_.addSlave(telux::power::LOCAL_MACHINE, clientName);
             } else {
-                slaveInfo.machineName_ = telux::power::ALL_MACHINES;
+                ackAggregator_.addSlave(telux::power::ALL_MACHINES, clientName);
             }
-
-            slaves_.push_back(slaveInfo);
-            LOG(ERROR, __FUNCTION__, " Adding Slave client- ", slaveInfo.clientName_);
+            LOG(ERROR, __FUNCTION__, " Adding Slave client- ", clientName);
         }
     } else {
         LOG(ERROR, "Unable to read PowerManager JSON");
@@ -89,7 +87,7 @@ grpc::Status PowerManagerServiceImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PowerManagerServiceImpl::DeregisterFromServer(ServerContext* context,
+grpc::Status PowerManagerServiceImpl::DeregisterFromServer(
     const powerStub::PowerClientConnect* request, google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
     telux::power::ClientType clientType =
@@ -102,13 +100,8 @@ grpc::Status PowerManagerServiceImpl::DeregisterFromServer(ServerContext* contex
         master_.clientName_ = "";
         master_.machineName_ = "";
     } else {
-        for(size_t slave = 0; slave < slaves_.size(); slave++) {
-            if(slaves_[slave].clientName_ == clientName) {
-                LOG(DEBUG, __FUNCTION__, " Deregistering slave");
-                slaves_.erase(slaves_.begin() + slave);
-                break;
-            }
-        }
+        LOG(DEBUG, __FUNCTION__, " Deregistering slave");
+        ackAggregator_.removeSlave(clientName);
     }
     return grpc::Status::OK;
 }
@@ -126,7 +119,7 @@ void PowerManagerServiceImpl::convertToGrpcState(telux::power::TcuActivityState
     }
 }
 
-grpc::Status PowerManagerServiceImpl::RegisterTcuStateEvent(ServerContext* context,
+grpc::Status PowerManagerServiceImpl::RegisterTcuStateEvent(
     const powerStub::MachineTcuState* request, powerStub::TcuStateEventReply* response) {
     LOG(DEBUG, __FUNCTION__);
     ::powerStub::MachineName machineName = request->mach_name();
@@ -140,8 +133,8 @@ grpc::Status PowerManagerServiceImpl::RegisterTcuStateEvent(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status PowerManagerServiceImpl::SendActivityState(ServerContext* context,
-    const powerStub::SetActivityState* request, powerStub::PowerManagerCommandReply* response) {
+grpc::Status PowerManagerServiceImpl::SendActivityState(const powerStub::SetActivityState* request,
+    powerStub::PowerManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     ::powerStub::TcuState tcuState = request->powerstate();
     ::powerStub::MachineName machineName = request->mach_name();
@@ -183,24 +176,25 @@ grpc::Status PowerManagerServiceImpl::SendActivityState(ServerContext* context,
             //withinSuspendTimeout_ is set to TRUE/FALSE by the suspend thread.
             if(withinSuspendTimeout_) {
                 resumeReceivedWithinTimeout_ = true;
+                //Wake the suspend thread up rather than letting it wait until timeout t2.
+                cv_.notify_all();
                 doResume(machineName);
                 ::commonStub::ErrorCode errorCode = ::commonStub::ErrorCode::ERROR_CODE_SUCCESS;
                 response->set_error(errorCode);
                 return grpc::Status::OK;
             }
-            cv_.notify_all();
         }
         ::commonStub::ErrorCode errorCode = ::commonStub::ErrorCode::INCOMPATIBLE_STATE;
         response->set_error(errorCode);
     } else {
         if (response->error() == ::commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
             if(state != telux::power::TcuActivityState::RESUME) {
-                //Resetting the Ack state for next cycle.
-                considerAck_ = true;
-                //Clear the stale lists from the previous cycle.
-                ackClients_.clear();
-                nackClients_.clear();
-                noackClients_.clear();
+                /**
+                 * The cycle starts before the slaves are notified so that acks sent
+                 * right away are considered.
+                 */
+                ackAggregator_.startCycle((machineName == ::powerStub::MachineName::MACH_ALL)
+                    ? telux::power::ALL_MACHINES : telux::power::LOCAL_MACHINE);
                 notifySlavesOnStateUpdate(tcuState, machineName);
                 auto f = std::async(std::launch::deferred,
                     [=]() {
@@ -219,7 +213,8 @@ grpc::Status PowerManagerServiceImpl::SendActivityState(ServerContext* context,
     return grpc::Status::OK;
 }
 /**
- * This suspend thread waits for a timeout t to receive ACKs/NACKS from all clients.
+ * This suspend thread waits for a timeout t1 to receive ACKs/NACKS from all clients, it
+ * stops waiting as soon as every expected client has answered.
  * Post receiving all the ACKs, the nack and noack lists are sent to the master.
  * The thread waits for a second timeout t2 ONLY IF there's a nack or noack from any slave.
  * If within t2 the master sends a resume, suspend/shutdown halts else system goes
@@ -228,78 +223,77 @@ grpc::Status PowerManagerServiceImpl::SendActivityState(ServerContext* context,
 void PowerManagerServiceImpl::initiateSuspend(telux::power::TcuActivityState state,
     ::powerStub::MachineName machineName) {
     LOG(DEBUG, __FUNCTION__);
-    std::this_thread::sleep_for(std::chrono::milliseconds(2000));
-    {
-        //Critical section
-        std::unique_lock<std::mutex> lock(ackMutex_);
+    int ackTimeoutMs = DEFAULT_SUSPEND_ACK_TIMEOUT_MS;
+    int resumeTimeoutMs = DEFAULT_SUSPEND_RESUME_TIMEOUT_MS;
+    readSuspendTimeouts(ackTimeoutMs, resumeTimeoutMs);
+
+    /**
+     * In case trigger comes for LOCAL machines, we don't expect ack from slaves
+     * registered for all machines. Acks coming after t1 are not considered.
+     */
+    std::vector<std::string> nackClients;
+    std::vector<std::string> noackClients;
+    ackAggregator_.waitForAnswers(std::chrono::milliseconds(ackTimeoutMs), nackClients,
+        noackClients);
+    notifyMasterOnSlaveAck(machineName, nackClients, noackClients);
+    /**
+     * ONLY if nack/noack list is non-empty wait for RESUME within
+     * timeout t2 and then perform suspend.
+     */
+    if(!noackClients.empty() || !nackClients.empty()) {
+        std::unique_lock<std::mutex> lock(susMutex_);
         /**
-         * When this variable is set to true, incoming slave acks within the
-         * timeout will be considered. Post the timeout, all incoming acks will be rejected
-         * by setting this variable as false.
+         * If this variable is set to true and resume is received then
+         * ongoing suspend will be halted.
+         * This thread waits until timeout t2 to check if RESUME is received.
          */
-        considerAck_ = false;
-        //Populate No-ack list.
-        for(auto slave: slaves_) {
-            if(std::find(ackClients_.begin(), ackClients_.end(), slave.clientName_)
-                == ackClients_.end()) {
-                if(std::find(nackClients_.begin(), nackClients_.end(), slave.clientName_)
-                    == nackClients_.end()) {
-                    /**
-                     * In case trigger comes for LOCAL machines,
-                     * we don't expect ack from slaves registered for all machines.
-                     */
-                    if((machineName == ::powerStub::MachineName::MACH_LOCAL) &&
-                        (slave.machineName_ == telux::power::ALL_MACHINES)) {
-                        continue;
-                    }
-                    noackClients_.push_back(slave.clientName_);
-                }
-            }
-        }
-        notifyMasterOnSlaveAck(machineName);
+        withinSuspendTimeout_ = true;
+        auto waitStart = std::chrono::steady_clock::now();
+        cv_.wait_for(lock, std::chrono::milliseconds(resumeTimeoutMs), [this] {
+            return resumeReceivedWithinTimeout_; // Check if resume is received.
+        });
+        withinSuspendTimeout_ = false;
+        LOG(INFO, __FUNCTION__, " waited for resume ",
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - waitStart).count(), " ms");
         /**
-         * ONLY if nack/noack list is non-empty wait for RESUME within
-         * timeout t2 and then perform suspend.
+         * If resume is received within the timeout, suspend/shutdown is halted and
+         * system stays in resume. This variable is set by the resume thread.
          */
-        if(!noackClients_.empty() || !nackClients_.empty()) {
-            /**
-             * If this variable is set to true and resume is received then
-             * ongoing suspend will be halted.
-             * This thread waits until timeout t2 to check if RESUME is received.
-             */
-            withinSuspendTimeout_ = true;
-            std::unique_lock<std::mutex> lock(susMutex_);
-            cv_.wait_until(lock,
-                std::chrono::system_clock::now() + std::chrono::milliseconds(10000), [this] {
-                    return resumeReceivedWithinTimeout_; // Check if resume is received.
-            });
-            /**
-             * If resume is received within the timeout, suspend/shutdown is halted and
-             * system stays in resume. This variable is set by the resume thread.
-             */
-            if(resumeReceivedWithinTimeout_) {
-                LOG(DEBUG, __FUNCTION__, " Resume received, halting suspend/shutdown.");
-                //Reset for next suspend/shutdown.
-                resumeReceivedWithinTimeout_ = false;
-                withinSuspendTimeout_ = false;
-                return;
-            } else {
-                //Timeout t2 completed. Resume is not received. So only resetting suspend timeout.
-                withinSuspendTimeout_ = false;
-            }
+        if(resumeReceivedWithinTimeout_) {
+            LOG(DEBUG, __FUNCTION__, " Resume received, halting suspend/shutdown.");
+            //Reset for next suspend/shutdown.
+            resumeReceivedWithinTimeout_ = false;
+            return;
         }
-        /**
-         * If the local state is set to SUSPEND, the initial state of any new slave
-         * registering with ALL_MACHINES should be RESUME and local machine will be SUSPEND.
-         * However, if the all machine state is set to SUSPEND,
-         * any new slave's initial state will be SUSPEND regardless of the machine type.
-        */
-        localMachState_ = state;
-        if(machineName == ::powerStub::MachineName::MACH_ALL) {
-            allMachState_ = state;
-        }
-        //TBD may be replaced with actual logic to suspend host machine.
     }
+    /**
+     * If the local state is set to SUSPEND, the initial state of any new slave
+     * registering with ALL_MACHINES should be RESUME and local machine will be SUSPEND.
+     * However, if the all machine state is set to SUSPEND,
+     * any new slave's initial state will be SUSPEND regardless of the machine type.
+    */
+    localMachState_ = state;
+    if(machineName == ::powerStub::MachineName::MACH_ALL) {
+        allMachState_ = state;
+    }
+    //TBD may be replaced with actual logic to suspend host machine.
+}
+
+void PowerManagerServiceImpl::readSuspendTimeouts(int &ackTimeoutMs, int &resumeTimeoutMs) {
+    Json::Value rootNode;
+    if (JsonParser::readFromJsonFile(rootNode, POWER_API_JSON) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Unable to read PowerManager JSON, using default timeouts");
+        return;
+    }
+    Json::Value &api = rootNode["ITcuActivityManager"];
+    if (api.isMember("SuspendAckTimeout")) {
+        ackTimeoutMs = api["SuspendAckTimeout"].asInt();
+    }
+    if (api.isMember("SuspendResumeTimeout")) {
+        resumeTimeoutMs = api["SuspendResumeTimeout"].asInt();
+    }
+    LOG(DEBUG, __FUNCTION__, " t1: ", ackTimeoutMs, " ms, t2: ", resumeTimeoutMs, " ms");
 }
 
 void PowerManagerServiceImpl::doResume(::powerStub::MachineName machineName) {
@@ -312,34 +306,29 @@ void PowerManagerServiceImpl::doResume(::powerStub::MachineName machineName) {
     //TBD may be replaced with actual logic to resume host machine.
 }
 
-grpc::Status PowerManagerServiceImpl::SendActivityStateAck(ServerContext* context,
-    const powerStub::SlaveAck* request, google::protobuf::Empty* response) {
+grpc::Status PowerManagerServiceImpl::SendActivityStateAck(const powerStub::SlaveAck* request,
+    google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string clientName = request->clientname();
     ::powerStub::AckType ackType = request->ack_type();
-    {
-        std::unique_lock<std::mutex> lock(ackMutex_);
-        //If Ack comes after timeout of 2 seconds, it will not be considered.
-        if(considerAck_) {
-            if(ackType == ::powerStub::AckType::ACK_SUSPEND) {
-                LOG(DEBUG, __FUNCTION__, " Received ACK_SUSPEND from ", clientName);
-                ackClients_.push_back(clientName);
-            } else if(ackType == ::powerStub::AckType::ACK_SHUTDOWN) {
-                LOG(DEBUG, __FUNCTION__, " Received ACK_SHUTDOWN from ", clientName);
-                ackClients_.push_back(clientName);
-            } else if(ackType == ::powerStub::AckType::NACK_SUSPEND) {
-                LOG(DEBUG, __FUNCTION__, " Received NACK_SUSPEND from ", clientName);
-                nackClients_.push_back(clientName);
-            } else if(ackType == ::powerStub::AckType::NACK_SHUTDOWN) {
-                LOG(DEBUG, __FUNCTION__, " Received NACK_SHUTDOWN from ", clientName);
-                nackClients_.push_back(clientName);
-            }
-        }
+    //If Ack comes after timeout t1, it will not be considered.
+    if(ackType == ::powerStub::AckType::ACK_SUSPEND) {
+        LOG(DEBUG, __FUNCTION__, " Received ACK_SUSPEND from ", clientName);
+        ackAggregator_.addAnswer(clientName, true);
+    } else if(ackType == ::powerStub::AckType::ACK_SHUTDOWN) {
+        LOG(DEBUG, __FUNCTION__, " Received ACK_SHUTDOWN from ", clientName);
+        ackAggregator_.addAnswer(clientName, true);
+    } else if(ackType == ::powerStub::AckType::NACK_SUSPEND) {
+        LOG(DEBUG, __FUNCTION__, " Received NACK_SUSPEND from ", clientName);
+        ackAggregator_.addAnswer(clientName, false);
+    } else if(ackType == ::powerStub::AckType::NACK_SHUTDOWN) {
+        LOG(DEBUG, __FUNCTION__, " Received NACK_SHUTDOWN from ", clientName);
+        ackAggregator_.addAnswer(clientName, false);
     }
     return grpc::Status::OK;
 }
 
-grpc::Status PowerManagerServiceImpl::SendModemActivityState(ServerContext* context,
+grpc::Status PowerManagerServiceImpl::SendModemActivityState(
     const powerStub::SetActivityState* request, powerStub::PowerManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("setModemActivityState", response);
@@ -449,16 +438,17 @@ void PowerManagerServiceImpl::notifySlavesOnStateUpdate(::powerStub::TcuState po
     }
 }
 
-void PowerManagerServiceImpl::notifyMasterOnSlaveAck(::powerStub::MachineName machineName) {
+void PowerManagerServiceImpl::notifyMasterOnSlaveAck(::powerStub::MachineName machineName,
+    const std::vector<std::string> &nackClients, const std::vector<std::string> &noackClients) {
     LOG(DEBUG, __FUNCTION__);
     ::powerStub::ConsolidatedAcksEvent consolidatedAcksEvent;
     ::eventService::EventResponse anyResponse;
     consolidatedAcksEvent.set_mach_name(machineName);
-    for(size_t i = 0; i < nackClients_.size(); i++) {
-        consolidatedAcksEvent.add_nack_client_list(nackClients_[i]);
+    for(size_t i = 0; i < nackClients.size(); i++) {
+        consolidatedAcksEvent.add_nack_client_list(nackClients[i]);
     }
-    for(size_t i = 0; i < noackClients_.size(); i++) {
-        consolidatedAcksEvent.add_noack_client_list(noackClients_[i]);
+    for(size_t i = 0; i < noackClients.size(); i++) {
+        consolidatedAcksEvent.add_noack_client_list(noackClients[i]);
     }
     anyResponse.set_filter("PWR_MASTER_UPDATE");
     anyResponse.mutable_any()->PackFrom(consolidatedAcksEvent);
@@ -466,3 +456,44 @@ void PowerManagerServiceImpl::notifyMasterOnSlaveAck(::powerStub::MachineName ma
     auto& eventImpl = EventService::getInstance();
     eventImpl.updateEventQueue(anyResponse);
 }
+
+grpc::ServerUnaryReactor* PowerManagerServiceImpl::InitService(grpc::CallbackServerContext* context,
+    const powerStub::PowerClientConnect* request, powerStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* PowerManagerServiceImpl::RegisterTcuStateEvent(
+    grpc::CallbackServerContext* context, const powerStub::MachineTcuState* request,
+    powerStub::TcuStateEventReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RegisterTcuStateEvent(request, response); });
+}
+
+grpc::ServerUnaryReactor* PowerManagerServiceImpl::SendActivityState(
+    grpc::CallbackServerContext* context, const powerStub::SetActivityState* request,
+    powerStub::PowerManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SendActivityState(request, response); });
+}
+
+grpc::ServerUnaryReactor* PowerManagerServiceImpl::SendActivityStateAck(
+    grpc::CallbackServerContext* context, const powerStub::SlaveAck* request,
+    google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SendActivityStateAck(request, response); });
+}
+
+grpc::ServerUnaryReactor* PowerManagerServiceImpl::SendModemActivityState(
+    grpc::CallbackServerContext* context, const powerStub::SetActivityState* request,
+    powerStub::PowerManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SendModemActivityState(request, response); });
+}
+
+grpc::ServerUnaryReactor* PowerManagerServiceImpl::DeregisterFromServer(
+    grpc::CallbackServerContext* context, const powerStub::PowerClientConnect* request,
+    google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DeregisterFromServer(request, response); });
+}
@@ -26,6 +26,7 @@
 #include "libs/common/event-manager/EventParserUtil.hpp"
 
 #include "protos/proto-src/power_simulation.grpc.pb.h"
+#include "SuspendAckAggregator.hpp"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -40,28 +41,46 @@ struct ClientInfo {
     std::string machineName_;
 };
 
-class PowerManagerServiceImpl final : public powerStub::PowerManagerService::Service,
+class PowerManagerServiceImpl final : public powerStub::PowerManagerService::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<PowerManagerServiceImpl> {
  public:
     PowerManagerServiceImpl();
     ~PowerManagerServiceImpl();
-    grpc::Status InitService(ServerContext* context, const powerStub::PowerClientConnect* request,
-        powerStub::GetServiceStatusReply* response);
-    grpc::Status RegisterTcuStateEvent(ServerContext* context,
-        const powerStub::MachineTcuState* request, powerStub::TcuStateEventReply* response);
-    grpc::Status SendActivityState(ServerContext* context,
-        const powerStub::SetActivityState* request, powerStub::PowerManagerCommandReply* response);
-    grpc::Status SendActivityStateAck(ServerContext* context, const powerStub::SlaveAck* request,
-        google::protobuf::Empty* response);
-    grpc::Status SendModemActivityState(ServerContext* context,
-        const powerStub::SetActivityState* request, powerStub::PowerManagerCommandReply* response);
-    grpc::Status DeregisterFromServer(ServerContext* context,
-        const powerStub::PowerClientConnect* request, google::protobuf::Empty* response);
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const powerStub::PowerClientConnect* request,
+        powerStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* RegisterTcuStateEvent(grpc::CallbackServerContext* context,
+        const powerStub::MachineTcuState* request,
+        powerStub::TcuStateEventReply* response) override;
+    grpc::ServerUnaryReactor* SendActivityState(grpc::CallbackServerContext* context,
+        const powerStub::SetActivityState* request,
+        powerStub::PowerManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* SendActivityStateAck(grpc::CallbackServerContext* context,
+        const powerStub::SlaveAck* request, google::protobuf::Empty* response) override;
+    grpc::ServerUnaryReactor* SendModemActivityState(grpc::CallbackServerContext* context,
+        const powerStub::SetActivityState* request,
+        powerStub::PowerManagerCommandReply* response) override;
+    grpc::ServerUnaryReactor* DeregisterFromServer(grpc::CallbackServerContext* context,
+        const powerStub::PowerClientConnect* request, google::protobuf::Empty* response) override;
 
     void onEventUpdate(::eventService::UnsolicitedEvent event) override;
 
  private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const powerStub::PowerClientConnect* request,
+        powerStub::GetServiceStatusReply* response);
+    grpc::Status RegisterTcuStateEvent(const powerStub::MachineTcuState* request,
+        powerStub::TcuStateEventReply* response);
+    grpc::Status SendActivityState(const powerStub::SetActivityState* request,
+        powerStub::PowerManagerCommandReply* response);
+    grpc::Status SendActivityStateAck(const powerStub::SlaveAck* request,
+        google::protobuf::Empty* response);
+    grpc::Status SendModemActivityState(const powerStub::SetActivityState* request,
+        powerStub::PowerManagerCommandReply* response);
+    grpc::Status DeregisterFromServer(const powerStub::PowerClientConnect* request,
+        google::protobuf::Empty* response);
+
     void apiJsonReader(std::string apiName, powerStub::PowerManagerCommandReply* response);
     void convertToGrpcState(telux::power::TcuActivityState currState, ::powerStub::TcuState &state);
     void onEventUpdate(std::string event);
@@ -70,24 +89,18 @@ class PowerManagerServiceImpl final : public powerStub::PowerManagerService::Ser
         ::powerStub::MachineName machineName);
     void notifySlavesOnStateUpdate(::powerStub::TcuState powerState,
         ::powerStub::MachineName machineName);
-    void notifyMasterOnSlaveAck(::powerStub::MachineName machineName);
+    void notifyMasterOnSlaveAck(::powerStub::MachineName machineName,
+        const std::vector<std::string> &nackClients,
+        const std::vector<std::string> &noackClients);
+    void readSuspendTimeouts(int &ackTimeoutMs, int &resumeTimeoutMs);
     void doResume(::powerStub::MachineName machineName);
     void handleMachineUpdateEvent(std::string event);
     void triggerMachineUpdateEvent(::powerStub::MachineState machineState);
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
     //Maintain master info and slaves list.
     ClientInfo master_;
-    std::vector<ClientInfo> slaves_;
-    //List of clients with the corresponding acknowledgements.
-    std::vector<std::string> ackClients_;
-    std::vector<std::string> nackClients_;
-    std::vector<std::string> noackClients_;
-    /**
-     * ackMutex is to protect the critical section between
-     * the suspend thread and incoming slave ack threads.
-     */
-    std::mutex ackMutex_;
-    bool considerAck_ = true;
+    //Slaves and their acknowledgements to the ongoing suspend/shutdown.
+    SuspendAckAggregator ackAggregator_;
     /**
      * susMutex_ or suspend mutex is used to protect the critical section between
      * the suspend thread and the resume thread during the suspend timeout.
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "SuspendAckAggregator.hpp"
+
+#include <algorithm>
+
+#include <telux/power/TcuActivityDefines.hpp>
+
+#include "libs/common/Logger.hpp"
+
+const uint32_t SuspendAckAggregator::LATENCY_BOUNDS_MS[] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+const size_t SuspendAckAggregator::LATENCY_BUCKETS =
+    sizeof(LATENCY_BOUNDS_MS) / sizeof(LATENCY_BOUNDS_MS[0]) + 1;
+
+void SuspendAckAggregator::addSlave(const std::string &machineName,
+    const std::string &clientName) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    slaves_[machineName].insert(clientName);
+}
+
+void SuspendAckAggregator::removeSlave(const std::string &clientName) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &machine : slaves_) {
+        machine.second.erase(clientName);
+    }
+    // A slave leaving during a cycle is not waited for anymore
+    if (isCollecting_ && (pendingClients_.erase(clientName) > 0)) {
+        expectedCount_--;
+        if (pendingClients_.empty()) {
+            cv_.notify_all();
+        }
+    }
+}
+
+void SuspendAckAggregator::startCycle(const std::string &machineName) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pendingClients_.clear();
+    ackClients_.clear();
+    nackClients_.clear();
+    latencyCounts_.assign(LATENCY_BUCKETS, 0);
+    for (auto &machine : slaves_) {
+        if ((machineName == telux::power::ALL_MACHINES) || (machine.first == machineName)) {
+            pendingClients_.insert(machine.second.begin(), machine.second.end());
+        }
+    }
+    expectedCount_ = pendingClients_.size();
+    cycleStart_ = std::chrono::steady_clock::now();
+    isCollecting_ = true;
+    LOG(DEBUG, __FUNCTION__, " machine: ", machineName, ", expected answers: ", expectedCount_);
+}
+
+void SuspendAckAggregator::addAnswer(const std::string &clientName, bool isAck) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!isCollecting_) {
+        LOG(DEBUG, __FUNCTION__, " Ignoring answer out of suspend cycle from ", clientName);
+        return;
+    }
+    if (isAck) {
+        ackClients_.insert(clientName);
+    } else {
+        nackClients_.insert(clientName);
+    }
+    recordLatency(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - cycleStart_).count());
+    if ((pendingClients_.erase(clientName) > 0) && pendingClients_.empty()) {
+        cv_.notify_all();
+    }
+}
+
+void SuspendAckAggregator::waitForAnswers(std::chrono::milliseconds timeout,
+    std::vector<std::string> &nackClients, std::vector<std::string> &noackClients) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait_until(lock, cycleStart_ + timeout, [this] {
+        return pendingClients_.empty();
+    });
+    isCollecting_ = false;
+    nackClients.assign(nackClients_.begin(), nackClients_.end());
+    noackClients.assign(pendingClients_.begin(), pendingClients_.end());
+    std::sort(nackClients.begin(), nackClients.end());
+    std::sort(noackClients.begin(), noackClients.end());
+
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - cycleStart_).count();
+    LOG(INFO, __FUNCTION__, " answered: ", expectedCount_ - pendingClients_.size(), "/",
+        expectedCount_, " in ", elapsedMs, " ms, acks: ", ackClients_.size(), ", nacks: ",
+        nackClients_.size(), ", answer latency: ", getHistogram());
+}
+
+void SuspendAckAggregator::recordLatency(uint64_t latencyMs) {
+    size_t bucket = 0;
+    while ((bucket < LATENCY_BUCKETS - 1) && (latencyMs > LATENCY_BOUNDS_MS[bucket])) {
+        bucket++;
+    }
+    latencyCounts_[bucket]++;
+}
+
+std::string SuspendAckAggregator::getHistogram() {
+    std::string histogram;
+    for (size_t bucket = 0; bucket < latencyCounts_.size(); bucket++) {
+        if (latencyCounts_[bucket] == 0) {
+            continue;
+        }
+        histogram += (bucket < LATENCY_BUCKETS - 1)
+            ? ("<=" + std::to_string(LATENCY_BOUNDS_MS[bucket]))
+            : (">" + std::to_string(LATENCY_BOUNDS_MS[LATENCY_BUCKETS - 2]));
+        histogram += "ms:" + std::to_string(latencyCounts_[bucket]) + " ";
+    }
+    return histogram.empty() ? "none" : histogram;
+}
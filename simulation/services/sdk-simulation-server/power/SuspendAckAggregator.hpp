@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       SuspendAckAggregator.hpp
+ *
+ * @brief      SuspendAckAggregator collects the answers of the slaves to a suspend or
+ *             shutdown trigger. The slaves are kept in a hash set per machine they
+ *             registered for, and a cycle tracks the slaves yet to answer, so an answer
+ *             is accounted in constant time and the wait ends as soon as the last
+ *             expected slave answers rather than when the timeout expires.
+ *             The delay of each answer is logged as a histogram at the end of the cycle.
+ */
+
+#ifndef SUSPEND_ACK_AGGREGATOR_HPP
+#define SUSPEND_ACK_AGGREGATOR_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class SuspendAckAggregator {
+ public:
+    void addSlave(const std::string &machineName, const std::string &clientName);
+    void removeSlave(const std::string &clientName);
+
+    /**
+     * Starts a cycle expecting an answer from the slaves registered for the machine, or
+     * from all the slaves for telux::power::ALL_MACHINES. The answers of the previous
+     * cycle are dropped.
+     */
+    void startCycle(const std::string &machineName);
+
+    /**
+     * Answers received out of a cycle are ignored.
+     */
+    void addAnswer(const std::string &clientName, bool isAck);
+
+    /**
+     * Waits until every expected slave answered or the timeout expires, then ends the
+     * cycle. Slaves answering afterwards are not considered.
+     *
+     * @param [out] nackClients   Slaves that answered with a nack
+     * @param [out] noackClients  Expected slaves that didn't answer
+     */
+    void waitForAnswers(std::chrono::milliseconds timeout, std::vector<std::string> &nackClients,
+        std::vector<std::string> &noackClients);
+
+ private:
+    /* Upper bounds of the histogram buckets, the last bucket has no bound */
+    static const uint32_t LATENCY_BOUNDS_MS[];
+    static const size_t LATENCY_BUCKETS;
+
+    void recordLatency(uint64_t latencyMs);
+    std::string getHistogram();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    /* Slaves by the machine name they registered for */
+    std::unordered_map<std::string, std::unordered_set<std::string>> slaves_;
+    bool isCollecting_ = false;
+    std::chrono::steady_clock::time_point cycleStart_;
+    size_t expectedCount_ = 0;
+    std::unordered_set<std::string> pendingClients_;
+    std::unordered_set<std::string> ackClients_;
+    std::unordered_set<std::string> nackClients_;
+    std::vector<uint32_t> latencyCounts_;
+};
+
+#endif  // SUSPEND_ACK_AGGREGATOR_HPP
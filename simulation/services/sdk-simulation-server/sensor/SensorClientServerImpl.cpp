@@ -10,8 +10,12 @@
  */
 
 
+#include <algorithm>
 #include <thread>
 #include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
 #include <sys/sysinfo.h>
 
 #include "SensorClientServerImpl.hpp"
@@ -23,8 +27,14 @@
 #include "event/EventService.hpp"
 #include "SensorReportService.hpp"
 #include "FileInfo.hpp"
+#include "common/RpcExecutor.hpp"
 
 #define CSV_BATCH_COUNT 1000
+// Rate of the pre-recorded reports, a stream at a lower rate skips some of them
+#define SOURCE_SAMPLING_RATE 104
+#define SAMPLE_ROTATED_INDEX 1
+#define SAMPLE_SOURCE_TIMESTAMP_INDEX 2
+#define SAMPLE_TIMESTAMP_INDEX 3
 #define SENSOR_CLIENT_API_JSON "api/sensor/ISensorClient.json"
 #define SUPPORTED_SENSOR_JSON "api/sensor/SupportedSensors.json"
 
@@ -94,8 +104,8 @@ void SensorClientServerImpl::updateSensorInfo(){
     }
 }
 
-grpc::Status SensorClientServerImpl::GetSensorList(ServerContext* context,
-    const google::protobuf::Empty* request, sensorStub::SensorInfoResponse* response) {
+grpc::Status SensorClientServerImpl::GetSensorList(const google::protobuf::Empty* request,
+    sensorStub::SensorInfoResponse* response) {
     LOG(DEBUG, __FUNCTION__);
     updateSensorInfo();
     for (const auto& dataStruct : sensorInfo_) {
@@ -119,8 +129,8 @@ grpc::Status SensorClientServerImpl::GetSensorList(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status SensorClientServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, sensorStub::GetServiceStatusReply* response) {
+grpc::Status SensorClientServerImpl::InitService(const google::protobuf::Empty* request,
+    sensorStub::GetServiceStatusReply* response) {
     LOG(DEBUG,__FUNCTION__);
     int cbDelay = 100;
     telux::common::ServiceStatus serviceStatus = telux::common::ServiceStatus::SERVICE_FAILED;
@@ -199,14 +209,123 @@ void SensorClientServerImpl::updateStreamRequest() {
 }
 
 
+bool SensorClientServerImpl::getField(const std::string &sample, size_t index,
+    size_t &begin, size_t &end) {
+    begin = 0;
+    for (size_t i = 0; i < index; ++i) {
+        begin = sample.find(',', begin);
+        if (begin == std::string::npos) {
+            return false;
+        }
+        ++begin;
+    }
+    end = sample.find(',', begin);
+    if (end == std::string::npos) {
+        end = sample.size();
+    }
+    return true;
+}
+
+void SensorClientServerImpl::patchTimestamp(std::string &sample) {
+    size_t begin, end;
+    if (!getField(sample, SAMPLE_TIMESTAMP_INDEX, begin, end)) {
+        return;
+    }
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t sampleTimestamp = (uint64_t)ts.tv_sec * SEC_TO_NANOS + (uint64_t)ts.tv_nsec;
+    char timestamp[24];
+    int length = snprintf(timestamp, sizeof(timestamp), "%" PRIu64, sampleTimestamp);
+    sample.replace(begin, end - begin, timestamp, length);
+}
+
+void SensorClientServerImpl::addStream(const ::sensorStub::SensorStreamConfig &config) {
+    StreamKey key = std::make_tuple(config.report_type(), config.is_rotated(),
+        config.sampling_rate(), config.batch_count());
+    std::lock_guard<std::mutex> lock(streamMtx_);
+    SensorStream &stream = streams_[key];
+    if (stream.clients++ == 0) {
+        stream.config = config;
+        if (config.sampling_rate() > 0) {
+            stream.skip = std::max<uint64_t>(1,
+                static_cast<uint64_t>(SOURCE_SAMPLING_RATE / config.sampling_rate()));
+        }
+        stream.batch.reserve(std::max<uint32_t>(1, config.batch_count()));
+    }
+    LOG(DEBUG, __FUNCTION__, " type: ", config.report_type(), " rate: ",
+        config.sampling_rate(), " batch: ", config.batch_count(), " clients: ", stream.clients);
+}
+
+void SensorClientServerImpl::removeStream(const ::sensorStub::SensorStreamConfig &config) {
+    StreamKey key = std::make_tuple(config.report_type(), config.is_rotated(),
+        config.sampling_rate(), config.batch_count());
+    std::lock_guard<std::mutex> lock(streamMtx_);
+    auto it = streams_.find(key);
+    if ((it != streams_.end()) && (--it->second.clients <= 0)) {
+        streams_.erase(it);
+    }
+}
+
+void SensorClientServerImpl::dispatchSample(std::string &sample) {
+    size_t begin, end;
+    if (!getField(sample, SAMPLE_ROTATED_INDEX, begin, end)) {
+        return;
+    }
+    // The report type is the first field
+    uint32_t reportType = static_cast<uint32_t>(std::strtoul(sample.c_str(), nullptr, 10));
+    bool isRotated = (std::strtoul(sample.c_str() + begin, nullptr, 10) != 0);
+    bool isPatched = false;
+
+    std::lock_guard<std::mutex> lock(streamMtx_);
+    for (auto &entry : streams_) {
+        SensorStream &stream = entry.second;
+        if ((stream.config.report_type() != reportType)
+            || (stream.config.is_rotated() != isRotated)
+            || ((stream.samples++ % stream.skip) != 0)) {
+            continue;
+        }
+        //Updating timestamp of sample going out
+        if (!isPatched) {
+            patchTimestamp(sample);
+            isPatched = true;
+        }
+        stream.batch.push_back(sample);
+        if (stream.batch.size() < stream.config.batch_count()) {
+            continue;
+        }
+        //Send the batch to clients via streams.
+        ::sensorStub::StartReportsEvent startReportsEvent;
+        ::eventService::EventResponse anyResponse;
+        *startReportsEvent.mutable_stream_config() = stream.config;
+        for (auto &report : stream.batch) {
+            startReportsEvent.add_sensor_reports(std::move(report));
+        }
+        stream.batch.clear();
+        anyResponse.set_filter("SENSOR_REPORTS");
+        anyResponse.mutable_any()->PackFrom(startReportsEvent);
+        //posting the event to EventService event queue
+        auto &SensorReportService = SensorReportService::getInstance();
+        SensorReportService.updateEventQueue(anyResponse);
+    }
+}
+
 void SensorClientServerImpl::startStreaming() {
     LOG(DEBUG, __FUNCTION__);
     while(true) {
+        if(requestCursor_ == requestBuffer_.size()) {
+            //An empty buffer is swapped with the next batch of the file.
+            requestBuffer_.clear();
+            requestCursor_ = 0;
+        }
         if(fileBuffer_->getNextBuffer(requestBuffer_)) {
-            while(!requestBuffer_.empty()) {
-                //Send requestBuffer_[0] to clients via streams.
-                std::vector<std::string> message = CommonUtils::splitString(requestBuffer_[0]);
-                uint64_t currentTimestamp = std::stoull(message[2]);
+            while(requestCursor_ < requestBuffer_.size()) {
+                std::string &sample = requestBuffer_[requestCursor_++];
+                size_t begin, end;
+                if(!getField(sample, SAMPLE_SOURCE_TIMESTAMP_INDEX, begin, end)) {
+                    LOG(ERROR, __FUNCTION__, " Malformed sample: ", sample);
+                    continue;
+                }
+                uint64_t currentTimestamp = std::strtoull(sample.c_str() + begin, nullptr, 10);
                 if(lastBatchStreamed_) {
                     /**
                      * During replay, we may reach EOF in between the sample processing for a batch.
@@ -223,28 +342,7 @@ void SensorClientServerImpl::startStreaming() {
                     }
                 }
                 previousTimestamp_ = currentTimestamp;
-                //Updating timestamp of sample going out
-                timespec ts;
-                clock_gettime(CLOCK_MONOTONIC, &ts);
-                uint64_t sampleTimestamp = (uint64_t)ts.tv_sec * SEC_TO_NANOS + (uint64_t)ts.tv_nsec;
-                message[3] = std::to_string(sampleTimestamp);
-                std::string temp = "";
-                for(auto s: message) {
-                    temp += s;
-                    temp += ",";
-                }
-                temp.pop_back();
-                requestBuffer_[0] = temp;
-                //Send requestBuffer_[0] to clients via streams.
-                ::sensorStub::StartReportsEvent startReportsEvent;
-                ::eventService::EventResponse anyResponse;
-                startReportsEvent.set_sensor_report(requestBuffer_[0]);
-                anyResponse.set_filter("SENSOR_REPORTS");
-                anyResponse.mutable_any()->PackFrom(startReportsEvent);
-                //posting the event to EventService event queue
-                auto &SensorReportService = SensorReportService::getInstance();
-                SensorReportService.updateEventQueue(anyResponse);
-                requestBuffer_.erase(requestBuffer_.begin());
+                dispatchSample(sample);
                 // Stop Stream on Request as per config.
                 // Will be checked for last client on stop reports.
                 if(stopStreamingData_) {
@@ -280,33 +378,29 @@ void SensorClientServerImpl::triggerStreamingStoppedEvent() {
     SensorReportService.updateEventQueue(anyResponse);
 }
 
-grpc::Status SensorClientServerImpl::Configure(ServerContext* context,
-    const google::protobuf::Empty* request,
+grpc::Status SensorClientServerImpl::Configure(const google::protobuf::Empty* request,
     sensorStub::SensorClientCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("configure", response);
     return grpc::Status::OK;
 }
 
-grpc::Status SensorClientServerImpl::GetConfiguration(ServerContext* context,
-    const google::protobuf::Empty* request,
+grpc::Status SensorClientServerImpl::GetConfiguration(const google::protobuf::Empty* request,
     sensorStub::SensorClientCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("getConfiguration", response);
     return grpc::Status::OK;
 }
 
-grpc::Status SensorClientServerImpl::GetSensorInfo(ServerContext* context,
-    const google::protobuf::Empty* request,
+grpc::Status SensorClientServerImpl::GetSensorInfo(const google::protobuf::Empty* request,
     sensorStub::SensorClientCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("getSensorInfo", response);
     return grpc::Status::OK;
 }
 
-grpc::Status SensorClientServerImpl::Activate(ServerContext* context,
-    const sensorStub::ActivateRequest* request,
-    sensorStub::SensorClientCommandReply* response){
+grpc::Status SensorClientServerImpl::Activate(const sensorStub::ActivateRequest* request,
+    sensorStub::SensorClientCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("activate", response);
     if (response->status() == ::commonStub::Status::SUCCESS) {
@@ -316,17 +410,22 @@ grpc::Status SensorClientServerImpl::Activate(ServerContext* context,
         } else {
             activeGyroCount_++;
         }
+        if(request->has_stream_config()) {
+            addStream(request->stream_config());
+        }
         updateStreamRequest();
     }
     return grpc::Status::OK;
 }
 
-grpc::Status SensorClientServerImpl::Deactivate(ServerContext* context,
-    const sensorStub::DeactivateRequest* request,
-    sensorStub::SensorClientCommandReply* response){
+grpc::Status SensorClientServerImpl::Deactivate(const sensorStub::DeactivateRequest* request,
+    sensorStub::SensorClientCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("deactivate", response);
     if (response->status() == ::commonStub::Status::SUCCESS) {
+        if(request->has_stream_config()) {
+            removeStream(request->stream_config());
+        }
         if(bufferingInitialized_) {
             auto &SensorReportService = SensorReportService::getInstance();
             size_t clientSize = SensorReportService.getClientsForFilter("SENSOR_REPORTS");
@@ -350,16 +449,15 @@ grpc::Status SensorClientServerImpl::Deactivate(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status SensorClientServerImpl::SensorUpdateRotationMatrix(ServerContext* context,
-    const ::google::protobuf::Empty* request,
-    sensorStub::SensorClientCommandReply* response) {
+grpc::Status SensorClientServerImpl::SensorUpdateRotationMatrix(
+    const ::google::protobuf::Empty* request, sensorStub::SensorClientCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("sensorUpdateRotationMatrix", response);
     return grpc::Status::OK;
 }
 
-grpc::Status SensorClientServerImpl::SelfTest (ServerContext* context,
-    const sensorStub::SelfTestRequest* request, sensorStub::SelfTestResponse* response) {
+grpc::Status SensorClientServerImpl::SelfTest(const sensorStub::SelfTestRequest* request,
+    sensorStub::SelfTestResponse* response) {
     LOG(DEBUG, __FUNCTION__);
     ::sensorStub::SelfTestType selfTestType = request->selftest_type();
     telux::sensor::SelfTestType selfTest_Type;
@@ -485,4 +583,62 @@ void SensorClientServerImpl::triggerSelfTestFailedEvent(std::string event) {
     //posting the event to EventService event queue
     auto& eventImpl = EventService::getInstance();
     eventImpl.updateEventQueue(anyResponse);
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* SensorClientServerImpl::InitService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, sensorStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorClientServerImpl::GetSensorList(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    sensorStub::SensorInfoResponse* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetSensorList(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorClientServerImpl::Configure(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, sensorStub::SensorClientCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Configure(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorClientServerImpl::GetConfiguration(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    sensorStub::SensorClientCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetConfiguration(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorClientServerImpl::GetSensorInfo(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    sensorStub::SensorClientCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetSensorInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorClientServerImpl::Activate(grpc::CallbackServerContext* context,
+    const sensorStub::ActivateRequest* request, sensorStub::SensorClientCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Activate(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorClientServerImpl::Deactivate(grpc::CallbackServerContext* context,
+    const sensorStub::DeactivateRequest* request, sensorStub::SensorClientCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Deactivate(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorClientServerImpl::SensorUpdateRotationMatrix(
+    grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request,
+    sensorStub::SensorClientCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SensorUpdateRotationMatrix(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorClientServerImpl::SelfTest(grpc::CallbackServerContext* context,
+    const sensorStub::SelfTestRequest* request, sensorStub::SelfTestResponse* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SelfTest(request, response); });
+}
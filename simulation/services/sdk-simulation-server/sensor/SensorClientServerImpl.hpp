@@ -16,6 +16,8 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <mutex>
+#include <tuple>
 
 #include <grpcpp/ext/proto_server_reflection_plugin.h>
 #include <grpcpp/grpcpp.h>
@@ -37,48 +39,80 @@ using grpc::Status;
 using sensorStub::SensorClientService;
 
 class SensorClientServerImpl final :
-    public sensorStub::SensorClientService::Service,
+    public sensorStub::SensorClientService::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<SensorClientServerImpl> {
  public:
     SensorClientServerImpl();
     ~SensorClientServerImpl();
-    grpc::Status InitService(ServerContext* context, const google::protobuf::Empty* request,
-        sensorStub::GetServiceStatusReply* response);
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        sensorStub::GetServiceStatusReply* response) override;
 
-    grpc::Status GetSensorList(ServerContext* context, const google::protobuf::Empty* request,
-        sensorStub::SensorInfoResponse* response);
+    grpc::ServerUnaryReactor* GetSensorList(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, sensorStub::SensorInfoResponse* response) override;
 
-    grpc::Status Configure(ServerContext* context, const google::protobuf::Empty* request,
-        sensorStub::SensorClientCommandReply* response);
+    grpc::ServerUnaryReactor* Configure(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        sensorStub::SensorClientCommandReply* response) override;
 
-    grpc::Status GetConfiguration(ServerContext* context, const google::protobuf::Empty* request,
-        sensorStub::SensorClientCommandReply* response);
+    grpc::ServerUnaryReactor* GetConfiguration(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        sensorStub::SensorClientCommandReply* response) override;
 
-    grpc::Status GetSensorInfo(ServerContext* context, const google::protobuf::Empty* request,
-        sensorStub::SensorClientCommandReply* response);
+    grpc::ServerUnaryReactor* GetSensorInfo(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        sensorStub::SensorClientCommandReply* response) override;
 
-    grpc::Status Activate(ServerContext* context, const sensorStub::ActivateRequest* request,
-        sensorStub::SensorClientCommandReply* response);
+    grpc::ServerUnaryReactor* Activate(grpc::CallbackServerContext* context,
+        const sensorStub::ActivateRequest* request,
+        sensorStub::SensorClientCommandReply* response) override;
 
-    grpc::Status Deactivate(ServerContext* context, const sensorStub::DeactivateRequest* request,
-        sensorStub::SensorClientCommandReply* response);
+    grpc::ServerUnaryReactor* Deactivate(grpc::CallbackServerContext* context,
+        const sensorStub::DeactivateRequest* request,
+        sensorStub::SensorClientCommandReply* response) override;
 
-    grpc::Status SensorUpdateRotationMatrix(ServerContext* context,
+    grpc::ServerUnaryReactor* SensorUpdateRotationMatrix(grpc::CallbackServerContext* context,
         const ::google::protobuf::Empty* request,
-        sensorStub::SensorClientCommandReply* response);
+        sensorStub::SensorClientCommandReply* response) override;
 
-    grpc::Status SelfTest (ServerContext* context,
-        const sensorStub::SelfTestRequest* request, sensorStub::SelfTestResponse* response);
+    grpc::ServerUnaryReactor* SelfTest(grpc::CallbackServerContext* context,
+        const sensorStub::SelfTestRequest* request,
+        sensorStub::SelfTestResponse* response) override;
 
     void onEventUpdate(::eventService::UnsolicitedEvent event) override;
 
  private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        sensorStub::GetServiceStatusReply* response);
+    grpc::Status GetSensorList(const google::protobuf::Empty* request,
+        sensorStub::SensorInfoResponse* response);
+    grpc::Status Configure(const google::protobuf::Empty* request,
+        sensorStub::SensorClientCommandReply* response);
+    grpc::Status GetConfiguration(const google::protobuf::Empty* request,
+        sensorStub::SensorClientCommandReply* response);
+    grpc::Status GetSensorInfo(const google::protobuf::Empty* request,
+        sensorStub::SensorClientCommandReply* response);
+    grpc::Status Activate(const sensorStub::ActivateRequest* request,
+        sensorStub::SensorClientCommandReply* response);
+    grpc::Status Deactivate(const sensorStub::DeactivateRequest* request,
+        sensorStub::SensorClientCommandReply* response);
+    grpc::Status SensorUpdateRotationMatrix(const ::google::protobuf::Empty* request,
+        sensorStub::SensorClientCommandReply* response);
+    grpc::Status SelfTest(const sensorStub::SelfTestRequest* request,
+        sensorStub::SelfTestResponse* response);
+
     void apiJsonReader(std::string apiName, sensorStub::SensorClientCommandReply* response);
     bool init();
     void updateSensorInfo();
     telux::sensor::SensorType getSensorType(std::string sensorType);
     void startStreaming();
+    void addStream(const ::sensorStub::SensorStreamConfig &config);
+    void removeStream(const ::sensorStub::SensorStreamConfig &config);
+    void dispatchSample(std::string &sample);
+    static bool getField(const std::string &sample, size_t index, size_t &begin, size_t &end);
+    static void patchTimestamp(std::string &sample);
     void updateStreamRequest();
     void triggerStreamingStoppedEvent();
     void handleEvent(std::string token , std::string event);
@@ -86,6 +120,8 @@ class SensorClientServerImpl final :
     std::vector<telux::sensor::SensorInfo> sensorInfo_;
     std::shared_ptr<FileBuffer> fileBuffer_ = nullptr;
     std::vector<std::string> requestBuffer_;
+    /* Next sample of requestBuffer_ to stream */
+    size_t requestCursor_ = 0;
     telux::common::AsyncTaskQueue<void> taskQ_;
     bool bufferingInitialized_ = false;
     bool stopStreamingData_ = false;
@@ -96,5 +132,19 @@ class SensorClientServerImpl final :
     int activeGyroCount_ = 0;
     std::unordered_map<telux::sensor::SelfTestType, uint64_t> accelSelfTestCache_;
     std::unordered_map<telux::sensor::SelfTestType, uint64_t> gyroSelfTestCache_;
+
+    /* Report type, rotation, sampling rate and batch count of a stream */
+    using StreamKey = std::tuple<uint32_t, bool, float, uint32_t>;
+    struct SensorStream {
+        ::sensorStub::SensorStreamConfig config;
+        /* Clients activated with the configuration of the stream */
+        int clients = 0;
+        /* One of every skip samples of the report type is part of the stream */
+        uint64_t skip = 1;
+        uint64_t samples = 0;
+        std::vector<std::string> batch;
+    };
+    std::mutex streamMtx_;
+    std::map<StreamKey, SensorStream> streams_;
 };
 #endif  // SENSOR_FEATURE_MANAGER_SERVER_HPP
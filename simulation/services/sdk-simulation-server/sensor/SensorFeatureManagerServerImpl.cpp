@@ -16,6 +16,7 @@
 #include "libs/common/Logger.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
+#include "common/RpcExecutor.hpp"
 #include <telux/common/CommonDefines.hpp>
 #include "event/EventService.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
@@ -35,8 +36,8 @@ SensorFeatureManagerServerImpl::~SensorFeatureManagerServerImpl() {
     LOG(DEBUG, __FUNCTION__ , " Destructing");
 }
 
-grpc::Status SensorFeatureManagerServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, sensorStub::GetServiceStatusReply* response) {
+grpc::Status SensorFeatureManagerServerImpl::InitService(const google::protobuf::Empty* request,
+    sensorStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int cbDelay = 100;
     telux::common::ServiceStatus serviceStatus = telux::common::ServiceStatus::SERVICE_FAILED;
@@ -211,9 +212,9 @@ std::string SensorFeatureManagerServerImpl::readBufferedEventStringFromFile(std:
     return line;
 }
 
-grpc::Status SensorFeatureManagerServerImpl::EnableFeature(ServerContext* context,
+grpc::Status SensorFeatureManagerServerImpl::EnableFeature(
     const sensorStub::SensorEnableFeature* request,
-    sensorStub::SensorFeatureManagerCommandReply* response){
+    sensorStub::SensorFeatureManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("enableFeature", response);
     if (response->status() == ::commonStub::Status::SUCCESS) {
@@ -225,9 +226,9 @@ grpc::Status SensorFeatureManagerServerImpl::EnableFeature(ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status SensorFeatureManagerServerImpl::DisableFeature(ServerContext* context,
+grpc::Status SensorFeatureManagerServerImpl::DisableFeature(
     const sensorStub::SensorEnableFeature* request,
-    sensorStub::SensorFeatureManagerCommandReply* response){
+    sensorStub::SensorFeatureManagerCommandReply* response) {
     LOG(DEBUG, __FUNCTION__);
     apiJsonReader("disableFeature", response);
     if (response->status() == ::commonStub::Status::SUCCESS) {
@@ -239,8 +240,8 @@ grpc::Status SensorFeatureManagerServerImpl::DisableFeature(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status SensorFeatureManagerServerImpl::GetFeatureList(ServerContext* context,
-    const google::protobuf::Empty* request, sensorStub::GetFeatureListReply* response){
+grpc::Status SensorFeatureManagerServerImpl::GetFeatureList(const google::protobuf::Empty* request,
+    sensorStub::GetFeatureListReply* response) {
     LOG(DEBUG, __FUNCTION__);
     Json::Value rootNode;
     telux::common::Status status;
@@ -279,3 +280,31 @@ void SensorFeatureManagerServerImpl::apiJsonReader(
     response->set_status(static_cast<::commonStub::Status>(status));
     response->set_delay(cbDelay);
 }
+
+grpc::ServerUnaryReactor* SensorFeatureManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    sensorStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorFeatureManagerServerImpl::GetFeatureList(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    sensorStub::GetFeatureListReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetFeatureList(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorFeatureManagerServerImpl::EnableFeature(
+    grpc::CallbackServerContext* context, const sensorStub::SensorEnableFeature* request,
+    sensorStub::SensorFeatureManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return EnableFeature(request, response); });
+}
+
+grpc::ServerUnaryReactor* SensorFeatureManagerServerImpl::DisableFeature(
+    grpc::CallbackServerContext* context, const sensorStub::SensorEnableFeature* request,
+    sensorStub::SensorFeatureManagerCommandReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DisableFeature(request, response); });
+}
@@ -29,29 +29,40 @@ using grpc::Status;
 using sensorStub::SensorFeatureManagerService;
 
 class SensorFeatureManagerServerImpl final :
-    public sensorStub::SensorFeatureManagerService::Service,
+    public sensorStub::SensorFeatureManagerService::CallbackService,
     public IServerEventListener,
     public std::enable_shared_from_this<SensorFeatureManagerServerImpl> {
  public:
     SensorFeatureManagerServerImpl();
     ~SensorFeatureManagerServerImpl();
-    grpc::Status InitService(ServerContext* context, const google::protobuf::Empty* request,
-        sensorStub::GetServiceStatusReply* response);
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        sensorStub::GetServiceStatusReply* response) override;
 
-    grpc::Status GetFeatureList(ServerContext* context, const google::protobuf::Empty* request,
-        sensorStub::GetFeatureListReply* response);
+    grpc::ServerUnaryReactor* GetFeatureList(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, sensorStub::GetFeatureListReply* response) override;
 
-    grpc::Status EnableFeature(ServerContext* context,
+    grpc::ServerUnaryReactor* EnableFeature(grpc::CallbackServerContext* context,
         const sensorStub::SensorEnableFeature* request,
-        sensorStub::SensorFeatureManagerCommandReply* response);
+        sensorStub::SensorFeatureManagerCommandReply* response) override;
 
-    grpc::Status DisableFeature(ServerContext* context,
+    grpc::ServerUnaryReactor* DisableFeature(grpc::CallbackServerContext* context,
         const sensorStub::SensorEnableFeature* request,
-        sensorStub::SensorFeatureManagerCommandReply* response);
+        sensorStub::SensorFeatureManagerCommandReply* response) override;
 
     void onEventUpdate(::eventService::UnsolicitedEvent event) override;
 
  private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        sensorStub::GetServiceStatusReply* response);
+    grpc::Status GetFeatureList(const google::protobuf::Empty* request,
+        sensorStub::GetFeatureListReply* response);
+    grpc::Status EnableFeature(const sensorStub::SensorEnableFeature* request,
+        sensorStub::SensorFeatureManagerCommandReply* response);
+    grpc::Status DisableFeature(const sensorStub::SensorEnableFeature* request,
+        sensorStub::SensorFeatureManagerCommandReply* response);
+
     void apiJsonReader(std::string apiName, sensorStub::SensorFeatureManagerCommandReply* response);
     void handleEvent(std::string token , std::string event);
     void handleFeatureEvent(std::string eventParams);
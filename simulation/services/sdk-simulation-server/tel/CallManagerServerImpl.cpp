@@ -35,6 +35,8 @@
 #include "CallManagerServerImpl.hpp"
 #include "../../../libs/tel/TelDefinesStub.hpp"
 #include "SimulationServer.hpp"
+#include "libs/common/TimerService.hpp"
+#include "common/RpcExecutor.hpp"
 #include <telux/common/DeviceConfig.hpp>
 #include <thread>
 #define CALL_MANAGER "ICallManager"
@@ -76,12 +78,13 @@ CallManagerServerImpl::~CallManagerServerImpl() {
     }
 }
 
-grpc::Status CallManagerServerImpl::CleanUpService(ServerContext* context,
-    const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) {
+grpc::Status CallManagerServerImpl::CleanUpService(const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
     if(ecallStateMachine_) {
         ecallStateMachine_ = nullptr;
     }
+    cancelHlapTimers();
     calls_.clear();
     return grpc::Status::OK;
 }
@@ -134,8 +137,8 @@ void CallManagerServerImpl::getJsonForApiResponseSlot(int phoneId, std::string&
     rootObj = jsonObjApiResponseSlot_[phoneId];
 }
 
-grpc::Status CallManagerServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+grpc::Status CallManagerServerImpl::InitService(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     Json::Value rootObj;
     grpc::Status readStatus = readJson();
     if(readStatus.ok()) {
@@ -158,8 +161,8 @@ grpc::Status CallManagerServerImpl::InitService(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::GetServiceStatus(ServerContext* context,
-    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+grpc::Status CallManagerServerImpl::GetServiceStatus(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     Json::Value rootObj;
     grpc::Status readStatus = readJson();
     if(readStatus.ok()) {
@@ -175,8 +178,8 @@ grpc::Status CallManagerServerImpl::GetServiceStatus(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::MakeCall(ServerContext* context,
-    const telStub::MakeCallRequest* request, telStub::MakeCallReply* response) {
+grpc::Status CallManagerServerImpl::MakeCall(const telStub::MakeCallRequest* request,
+    telStub::MakeCallReply* response) {
     LOG(DEBUG, __FUNCTION__);
     telux::common::ErrorCode error;
     telux::common::Status status;
@@ -240,8 +243,8 @@ void CallManagerServerImpl::handleCallMachine() {
     }
 }
 
-grpc::Status CallManagerServerImpl::Answer(ServerContext* context,
-    const telStub::AnswerRequest* request, telStub::AnswerReply* response) {
+grpc::Status CallManagerServerImpl::Answer(const telStub::AnswerRequest* request,
+    telStub::AnswerReply* response) {
     std::string jsonObjApiResponseFileName = "";
     Json::Value jsonObjApiResponse;
     int phoneId = request->phone_id();
@@ -314,8 +317,8 @@ int CallManagerServerImpl::setCallIndexForNewCall() {
     return index;
 }
 
-grpc::Status CallManagerServerImpl::MakeECall(ServerContext* context,
-    const telStub::MakeECallRequest* request, telStub::MakeECallReply* response) {
+grpc::Status CallManagerServerImpl::MakeECall(const telStub::MakeECallRequest* request,
+    telStub::MakeECallReply* response) {
     telux::common::ErrorCode error;
     telux::common::Status status;
     std::string jsonObjApiResponseFileName = "";
@@ -381,8 +384,8 @@ grpc::Status CallManagerServerImpl::MakeECall(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::SetConfig(ServerContext* context,
-    const telStub::SetConfigRequest* request,  telStub::SetConfigReply* response) {
+grpc::Status CallManagerServerImpl::SetConfig(const telStub::SetConfigRequest* request,
+    telStub::SetConfigReply* response) {
     EcallConfig config = {};
     telux::common::ErrorCode error;
     telux::common::Status status;
@@ -475,8 +478,8 @@ grpc::Status CallManagerServerImpl::SetConfig(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::GetConfig(ServerContext* context,
-    const google::protobuf::Empty* request, telStub::GetConfigResponse* response) {
+grpc::Status CallManagerServerImpl::GetConfig(const google::protobuf::Empty* request,
+    telStub::GetConfigResponse* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string jsonObjApiResponseFileName = "";
     Json::Value jsonObjApiResponse;
@@ -524,7 +527,7 @@ grpc::Status CallManagerServerImpl::GetConfig(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::UpdateEcallHlapTimer(ServerContext* context,
+grpc::Status CallManagerServerImpl::UpdateEcallHlapTimer(
     const telStub::UpdateEcallHlapTimerRequest* request,
     telStub::UpdateEcallHlapTimerResponse* response) {
 
@@ -563,7 +566,7 @@ grpc::Status CallManagerServerImpl::UpdateEcallHlapTimer(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::RequestEcallHlapTimer(ServerContext* context,
+grpc::Status CallManagerServerImpl::RequestEcallHlapTimer(
     const telStub::RequestEcallHlapTimerRequest* request,
     telStub::RequestEcallHlapTimerReply* response) {
     std::string jsonObjApiResponseFileName = "";
@@ -594,7 +597,7 @@ grpc::Status CallManagerServerImpl::RequestEcallHlapTimer(ServerContext* context
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::RequestECallHlapTimerStatus(ServerContext* context,
+grpc::Status CallManagerServerImpl::RequestECallHlapTimerStatus(
     const telStub::RequestECallHlapTimerStatusRequest* request,
     telStub::RequestECallHlapTimerStatusReply* response) {
     std::string jsonObjApiResponseFileName = "";
@@ -630,6 +633,27 @@ grpc::Status CallManagerServerImpl::RequestECallHlapTimerStatus(ServerContext* c
         hlapTimerStatus.set_t10(static_cast<telStub::HlapTimerStatus_Status>
             ((rootObj[CALL_MANAGER]["ecallHlapTimerStatus"]["T10Timer"].asInt())));
         *response->mutable_hlap_timer_status() = hlapTimerStatus;
+        {
+            std::lock_guard<std::mutex> lock(hlapTimerMutex_);
+            auto now = std::chrono::steady_clock::now();
+            for(auto &run : hlapTimers_[phoneId]) {
+                telStub::HlapTimerAccuracy *accuracy = response->add_timer_accuracy();
+                int elapsedMs = run.second.elapsedMs;
+                if(run.second.isRunning) {
+                    elapsedMs = static_cast<int>(
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                        now - run.second.startTime).count());
+                }
+                accuracy->set_timer(run.first);
+                accuracy->set_duration_ms(run.second.durationMs);
+                accuracy->set_elapsed_ms(elapsedMs);
+                accuracy->set_is_running(run.second.isRunning);
+                accuracy->set_is_expired(run.second.isExpired);
+                if(run.second.isExpired) {
+                    accuracy->set_expiry_deviation_ms(elapsedMs - run.second.durationMs);
+                }
+            }
+        }
 
         response->set_status(static_cast<commonStub::Status>(status));
         response->set_iscallback(isCallback);
@@ -639,8 +663,7 @@ grpc::Status CallManagerServerImpl::RequestECallHlapTimerStatus(ServerContext* c
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::ExitEcbm(ServerContext* context,
-    const telStub::RequestEcbmRequest* request,
+grpc::Status CallManagerServerImpl::ExitEcbm(const telStub::RequestEcbmRequest* request,
     telStub::RequestEcbmReply* response) {
     grpc::Status readStatus = readJson();
     telux::common::ErrorCode error;
@@ -672,8 +695,7 @@ grpc::Status CallManagerServerImpl::ExitEcbm(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::RequestEcbm(ServerContext* context,
-    const telStub::RequestEcbmRequest* request,
+grpc::Status CallManagerServerImpl::RequestEcbm(const telStub::RequestEcbmRequest* request,
     telStub::RequestEcbmReply* response) {
     grpc::Status readStatus = readJson();
     telux::common::ErrorCode error;
@@ -812,7 +834,7 @@ void CallManagerServerImpl::resumeBackgroundCalls(int phoneId) {
 
 }
 
-grpc::Status CallManagerServerImpl::HangupForegroundResumeBackground(ServerContext* context,
+grpc::Status CallManagerServerImpl::HangupForegroundResumeBackground(
     const telStub::HangupForegroundResumeBackgroundRequest* request,
     telStub::HangupForegroundResumeBackgroundReply* response) {
     std::string jsonObjApiResponseFileName = "";
@@ -854,8 +876,7 @@ int CallManagerServerImpl::getCallIndexOfActiveCall(int phoneId) {
     return index;
 }
 
-grpc::Status CallManagerServerImpl::Resume(ServerContext* context,
-    const telStub::ResumeRequest* request,
+grpc::Status CallManagerServerImpl::Resume(const telStub::ResumeRequest* request,
     telStub::ResumeReply* response) {
     std::string jsonObjApiResponseFileName = "";
     Json::Value jsonObjApiResponse;
@@ -883,8 +904,7 @@ grpc::Status CallManagerServerImpl::Resume(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::Hold(ServerContext* context,
-    const telStub::HoldRequest* request,
+grpc::Status CallManagerServerImpl::Hold(const telStub::HoldRequest* request,
     telStub::HoldReply* response) {
     std::string jsonObjApiResponseFileName = "";
     Json::Value jsonObjApiResponse;
@@ -946,8 +966,7 @@ void CallManagerServerImpl::swapCalls(int callHoldIndex, int phoneIndex,
     }
 }
 
-grpc::Status CallManagerServerImpl::Swap(ServerContext* context,
-    const telStub::SwapRequest* request,
+grpc::Status CallManagerServerImpl::Swap(const telStub::SwapRequest* request,
     telStub::SwapReply* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string jsonObjApiResponseFileName = "";
@@ -976,7 +995,7 @@ grpc::Status CallManagerServerImpl::Swap(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::HangupWaitingOrBackground(ServerContext* context,
+grpc::Status CallManagerServerImpl::HangupWaitingOrBackground(
     const telStub::HangupWaitingOrBackgroundRequest* request,
     telStub::HangupWaitingOrBackgroundReply* response) {
     int phoneId = request->phone_id();
@@ -1003,8 +1022,8 @@ grpc::Status CallManagerServerImpl::HangupWaitingOrBackground(ServerContext* con
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::Hangup(ServerContext* context,
-    const telStub::HangupRequest* request, telStub::HangupReply* response) {
+grpc::Status CallManagerServerImpl::Hangup(const telStub::HangupRequest* request,
+    telStub::HangupReply* response) {
     std::string jsonObjApiResponseFileName = "";
     Json::Value jsonObjApiResponse;
     telux::common::ErrorCode error;
@@ -1046,8 +1065,8 @@ grpc::Status CallManagerServerImpl::Hangup(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::Reject(ServerContext* context,
-    const telStub::RejectRequest* request, telStub::RejectReply* response) {
+grpc::Status CallManagerServerImpl::Reject(const telStub::RejectRequest* request,
+    telStub::RejectReply* response) {
     std::string jsonObjApiResponseFileName = "";
     Json::Value jsonObjApiResponse;
     int phoneId = request->phone_id();
@@ -1076,8 +1095,8 @@ grpc::Status CallManagerServerImpl::Reject(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::RejectWithSMS(ServerContext* context,
-    const telStub::RejectWithSMSRequest* request, telStub::RejectWithSMSReply* response) {
+grpc::Status CallManagerServerImpl::RejectWithSMS(const telStub::RejectWithSMSRequest* request,
+    telStub::RejectWithSMSReply* response) {
     std::string jsonObjApiResponseFileName = "";
     Json::Value jsonObjApiResponse;
     int phoneId = request->phone_id();
@@ -1165,8 +1184,8 @@ void CallManagerServerImpl::handleHangupRequest(std::string eventParams) {
     }
 }
 
-grpc::Status CallManagerServerImpl::UpdateECallMsd(ServerContext* context,
-    const telStub::UpdateECallMsdRequest* request, telStub::UpdateECallMsdResponse* response) {
+grpc::Status CallManagerServerImpl::UpdateECallMsd(const telStub::UpdateECallMsdRequest* request,
+    telStub::UpdateECallMsdResponse* response) {
     LOG(DEBUG, __FUNCTION__);
     telux::common::ErrorCode error;
     telux::common::Status status;
@@ -1240,7 +1259,7 @@ grpc::Status CallManagerServerImpl::UpdateECallMsd(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::ModifyOrRespondToModifyCall(ServerContext* context,
+grpc::Status CallManagerServerImpl::ModifyOrRespondToModifyCall(
     const telStub::ModifyOrRespondToModifyCallRequest* request,
     telStub::ModifyOrRespondToModifyCallReply* response) {
     std::string jsonObjApiResponseFileName = "";
@@ -1290,7 +1309,7 @@ grpc::Status CallManagerServerImpl::ModifyOrRespondToModifyCall(ServerContext* c
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::RequestNetworkDeregistration(ServerContext* context,
+grpc::Status CallManagerServerImpl::RequestNetworkDeregistration(
     const telStub::RequestNetworkDeregistrationRequest* request,
     telStub::RequestNetworkDeregistrationReply* response) {
     telux::common::ErrorCode error;
@@ -1331,8 +1350,8 @@ grpc::Status CallManagerServerImpl::RequestNetworkDeregistration(ServerContext*
     return readStatus;
 }
 
-grpc::Status CallManagerServerImpl::SendRtt(ServerContext* context,
-    const telStub::SendRttRequest* request, telStub::SendRttReply* response) {
+grpc::Status CallManagerServerImpl::SendRtt(const telStub::SendRttRequest* request,
+    telStub::SendRttReply* response) {
     telux::common::ErrorCode error;
     telux::common::Status status;
     int cbDelay;
@@ -1811,6 +1830,9 @@ void CallManagerServerImpl::updateEcallHlapTimer(std::string timer,
         LOG(ERROR, __FUNCTION__, " Reading JSON File failed!");
         return;
     }
+    if(status == HlapTimerStatus::INACTIVE) {
+        cancelHlapTimer(callInfo_.phoneId, timer);
+    }
     getJsonForSystemData(callInfo_.phoneId, jsonObjApiResponseFileName, rootObj);
     rootObj[CALL_MANAGER]["ecallHlapTimerStatus"][timer] = static_cast<int>(status);
     JsonParser::writeToJsonFile(rootObj, jsonObjApiResponseFileName);
@@ -1833,10 +1855,9 @@ void CallManagerServerImpl::startTimer(std::string timer) {
 }
 
 void CallManagerServerImpl::msdTransmissionStatus(std::string msdtransmision ) {
-    auto f = std::async(std::launch::async, [this, msdtransmision ]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    auto f = telux::common::TimerService::getInstance()->runAfter(1000, [this, msdtransmision ]() {
             this->triggerECallInfoChangeEvent(msdtransmision, HlapTimerEvent::UNCHANGED);
-        }).share();
+        });
     taskQ_->add(f);
 }
 
@@ -1847,27 +1868,34 @@ void CallManagerServerImpl::startTimers(std::string timer) {
     if(readStatus.ok()) {
         updateEcallHlapTimer(timer, HlapTimerStatus::ACTIVE);
         getJsonForSystemData(callInfo_.phoneId, jsonfilename, rootObj);
-        LOG(DEBUG, __FUNCTION__,"Timer is ", timer, " Phone id is ", callInfo_.phoneId);
+        int phoneId = callInfo_.phoneId;
+        LOG(DEBUG, __FUNCTION__,"Timer is ", timer, " Phone id is ", phoneId);
         int delay;
         if((timer == "T5Timer") || (timer == "T6Timer")) {
             delay = 5000; //timer expiry is set as per eCall specification to 5 secs
         } else {
             delay = rootObj[CALL_MANAGER]["eCallConfig"][timer].asInt();
         }
-        auto f = std::async(std::launch::async, [this, delay, timer]() {
-            LOG(DEBUG, __FUNCTION__,"Delay is", delay);
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
-            Json::Value obj;
-            std::string filename = "";
-            getJsonForSystemData(callInfo_.phoneId, filename, obj);
-            HlapTimerStatus status = static_cast<HlapTimerStatus>(
-                obj[CALL_MANAGER]["ecallHlapTimerStatus"][timer].asInt());
-            if(status == HlapTimerStatus::ACTIVE) {
-                LOG(DEBUG, __FUNCTION__," Timer is active", timer);
-                this->triggerTimerExpiry(timer, callInfo_.phoneId);
+        {
+            std::lock_guard<std::mutex> lock(hlapTimerMutex_);
+            HlapTimerRun &run = hlapTimers_[phoneId][timer];
+            /* Restarting a running timer starts it afresh */
+            if(run.isRunning) {
+                telux::common::TimerService::getInstance()->cancel(run.id);
             }
-        }).share();
-        taskQ_->add(f);
+            run.seq = ++hlapTimerSeq_;
+            run.startTime = std::chrono::steady_clock::now();
+            run.durationMs = delay;
+            run.elapsedMs = 0;
+            run.isRunning = true;
+            run.isExpired = false;
+            uint64_t seq = run.seq;
+            auto f = telux::common::TimerService::getInstance()->runAfter(delay,
+                [this, phoneId, timer, seq]() {
+                this->onHlapTimerExpiry(phoneId, timer, seq);
+            }, &run.id);
+            taskQ_->add(f);
+        }
         /* Reset T9 timer and T10 timer when a new eCall is triggered
          * (and T2 starts with call setup) before T9 expiry.
          */
@@ -1879,11 +1907,11 @@ void CallManagerServerImpl::startTimers(std::string timer) {
                 if(status == HlapTimerStatus::ACTIVE) {
                     LOG(DEBUG, __FUNCTION__, "Timer", timer[i], "is active");
                     updateEcallHlapTimer(timer[i], HlapTimerStatus::INACTIVE);
-                    auto f = std::async(std::launch::async, [this, timer, i, status]() {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+                    auto f = telux::common::TimerService::getInstance()->runAfter(1000,
+                        [this, timer, i, status]() {
                         this->triggerECallInfoChangeEvent(timer[i],
                             HlapTimerEvent::STOPPED);
-                    }).share();
+                    });
                     taskQ_->add(f);
                 }
             }
@@ -1891,13 +1919,66 @@ void CallManagerServerImpl::startTimers(std::string timer) {
     }
 }
 
+void CallManagerServerImpl::onHlapTimerExpiry(int phoneId, std::string timer, uint64_t seq) {
+    {
+        std::lock_guard<std::mutex> lock(hlapTimerMutex_);
+        auto slot = hlapTimers_.find(phoneId);
+        if((slot == hlapTimers_.end()) || (slot->second.count(timer) == 0)) {
+            return;
+        }
+        HlapTimerRun &run = slot->second[timer];
+        /* Stopped or restarted after this run was scheduled */
+        if((!run.isRunning) || (run.seq != seq)) {
+            return;
+        }
+        run.elapsedMs = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - run.startTime).count());
+        run.isRunning = false;
+        run.isExpired = true;
+        LOG(DEBUG, __FUNCTION__, " Timer ", timer, " expired after ", run.elapsedMs,
+            " ms, duration ", run.durationMs, " ms");
+    }
+    triggerTimerExpiry(timer, phoneId);
+}
+
+void CallManagerServerImpl::cancelHlapTimer(int phoneId, std::string timer) {
+    std::lock_guard<std::mutex> lock(hlapTimerMutex_);
+    auto slot = hlapTimers_.find(phoneId);
+    if(slot == hlapTimers_.end()) {
+        return;
+    }
+    auto run = slot->second.find(timer);
+    if((run == slot->second.end()) || (!run->second.isRunning)) {
+        return;
+    }
+    telux::common::TimerService::getInstance()->cancel(run->second.id);
+    run->second.elapsedMs = static_cast<int>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - run->second.startTime).count());
+    run->second.isRunning = false;
+    LOG(DEBUG, __FUNCTION__, " Timer ", timer, " stopped after ", run->second.elapsedMs, " ms");
+}
+
+void CallManagerServerImpl::cancelHlapTimers() {
+    std::lock_guard<std::mutex> lock(hlapTimerMutex_);
+    for(auto &slot : hlapTimers_) {
+        for(auto &run : slot.second) {
+            if(run.second.isRunning) {
+                telux::common::TimerService::getInstance()->cancel(run.second.id);
+            }
+        }
+    }
+    hlapTimers_.clear();
+}
+
 void CallManagerServerImpl::triggerTimerExpiry(std::string timer, int phoneId) {
     LOG(DEBUG, __FUNCTION__);
     if((timer == "T2Timer") || (timer == "T5Timer") || (timer == "T6Timer") || (timer == "T7Timer")
         || (timer == "T10Timer") || (timer == "T9Timer")) {
         updateEcallHlapTimer(timer, HlapTimerStatus::INACTIVE);
-        if(ecallStateMachine_) {
-            ecallStateMachine_->onEvent(ecallStateMachine_->createTelEvent(
+        std::shared_ptr<EcallStateMachine> ecallStateMachine = ecallStateMachine_;
+        if(ecallStateMachine) {
+            ecallStateMachine->onEvent(ecallStateMachine->createTelEvent(
                 EcallStateMachine::EventID::ON_TIMER_EXPIRY, timer, phoneId));
         }
     } else {
@@ -1919,17 +2000,17 @@ void CallManagerServerImpl::sendEvent(std::string timer, std::string status ) {
     std::string value = timer + status;
     if(status == "start") {
         updateEcallHlapTimer(timer, HlapTimerStatus::ACTIVE);
-        auto f = std::async(std::launch::async, [this, timer, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+        auto f = telux::common::TimerService::getInstance()->runAfter(1000,
+            [this, timer, status]() {
             this->triggerECallInfoChangeEvent(timer, HlapTimerEvent::STARTED);
-        }).share();
+        });
         taskQ_->add(f);
     } else if (status == "stop" ) {
         updateEcallHlapTimer(timer, HlapTimerStatus::INACTIVE);
-        auto f = std::async(std::launch::async, [this, timer, status]() {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+        auto f = telux::common::TimerService::getInstance()->runAfter(1000,
+            [this, timer, status]() {
             this->triggerECallInfoChangeEvent(timer, HlapTimerEvent::STOPPED);
-        }).share();
+        });
         taskQ_->add(f);
     } else {
         LOG(ERROR, __FUNCTION__, "Invalid event");
@@ -1958,14 +2039,14 @@ void CallManagerServerImpl::triggerCallInfoChangeEvent(int phoneId,
     triggerCallInfoChange(phoneId);
     if(call->callState == CallState::CALL_ENDED ) {
         //Clear call cache in server
-        auto f = std::async(std::launch::async, [this, callIndex, phoneId]() {
-         std::this_thread::sleep_for(std::chrono::milliseconds(3000));
+        auto f = telux::common::TimerService::getInstance()->runAfter(3000,
+            [this, callIndex, phoneId]() {
             bool isCallRemoved = findAndRemoveMatchingCall(callIndex);
             if(isCallRemoved) {
                 // Event to update the call cache for clients.
                 triggerCallListAfterCallEnd(phoneId);
             }
-        }).share();
+        });
         taskQ_->add(f);
     }
 }
@@ -1995,7 +2076,7 @@ void CallManagerServerImpl::onECallRedial(int phoneId, bool willECallRedial,
     }
 }
 
-grpc::Status CallManagerServerImpl::ConfigureECallRedial(ServerContext* context,
+grpc::Status CallManagerServerImpl::ConfigureECallRedial(
     const telStub::ConfigureECallRedialRequest* request,
     telStub::ConfigureECallRedialResponse* response) {
     telux::common::ErrorCode error;
@@ -2090,8 +2171,8 @@ std::vector<std::shared_ptr<CallInfo>>
     return calls;
 }
 
-grpc::Status CallManagerServerImpl::updateCalls(ServerContext* context,
-    const telStub::UpdateCurrentCallsRequest* request, ::google::protobuf::Empty* response) {
+grpc::Status CallManagerServerImpl::updateCalls(const telStub::UpdateCurrentCallsRequest* request,
+    ::google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
     triggerCallInfoChange(phoneId);
@@ -2282,3 +2363,176 @@ bool CallManagerServerImpl::findAndRemoveMatchingCall(int callIndex) {
         return false;
     }
 }
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::InitService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::MakeECall(grpc::CallbackServerContext* context,
+    const telStub::MakeECallRequest* request, telStub::MakeECallReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return MakeECall(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::Hangup(grpc::CallbackServerContext* context,
+    const telStub::HangupRequest* request, telStub::HangupReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Hangup(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::UpdateECallMsd(
+    grpc::CallbackServerContext* context, const telStub::UpdateECallMsdRequest* request,
+    telStub::UpdateECallMsdResponse* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return UpdateECallMsd(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::RequestECallHlapTimerStatus(
+    grpc::CallbackServerContext* context,
+    const telStub::RequestECallHlapTimerStatusRequest* request,
+    telStub::RequestECallHlapTimerStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestECallHlapTimerStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::CleanUpService(
+    grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CleanUpService(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::SetConfig(grpc::CallbackServerContext* context,
+    const telStub::SetConfigRequest* request, telStub::SetConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::GetConfig(grpc::CallbackServerContext* context,
+    const ::google::protobuf::Empty* request, telStub::GetConfigResponse* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::UpdateEcallHlapTimer(
+    grpc::CallbackServerContext* context, const telStub::UpdateEcallHlapTimerRequest* request,
+    telStub::UpdateEcallHlapTimerResponse* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return UpdateEcallHlapTimer(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::RequestEcallHlapTimer(
+    grpc::CallbackServerContext* context, const telStub::RequestEcallHlapTimerRequest* request,
+    telStub::RequestEcallHlapTimerReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestEcallHlapTimer(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::RequestEcbm(grpc::CallbackServerContext* context,
+    const telStub::RequestEcbmRequest* request, telStub::RequestEcbmReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestEcbm(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::MakeCall(grpc::CallbackServerContext* context,
+    const telStub::MakeCallRequest* request, telStub::MakeCallReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return MakeCall(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::Reject(grpc::CallbackServerContext* context,
+    const telStub::RejectRequest* request, telStub::RejectReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Reject(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::RejectWithSMS(grpc::CallbackServerContext* context,
+    const telStub::RejectWithSMSRequest* request, telStub::RejectWithSMSReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RejectWithSMS(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::Answer(grpc::CallbackServerContext* context,
+    const telStub::AnswerRequest* request, telStub::AnswerReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Answer(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::HangupForegroundResumeBackground(
+    grpc::CallbackServerContext* context,
+    const telStub::HangupForegroundResumeBackgroundRequest* request,
+    telStub::HangupForegroundResumeBackgroundReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() {
+            return HangupForegroundResumeBackground(request, response);
+        });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::HangupWaitingOrBackground(
+    grpc::CallbackServerContext* context, const telStub::HangupWaitingOrBackgroundRequest* request,
+    telStub::HangupWaitingOrBackgroundReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return HangupWaitingOrBackground(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::Hold(grpc::CallbackServerContext* context,
+    const telStub::HoldRequest* request, telStub::HoldReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Hold(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::Resume(grpc::CallbackServerContext* context,
+    const telStub::ResumeRequest* request, telStub::ResumeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Resume(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::Swap(grpc::CallbackServerContext* context,
+    const telStub::SwapRequest* request, telStub::SwapReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return Swap(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::RequestNetworkDeregistration(
+    grpc::CallbackServerContext* context,
+    const telStub::RequestNetworkDeregistrationRequest* request,
+    telStub::RequestNetworkDeregistrationReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestNetworkDeregistration(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::ModifyOrRespondToModifyCall(
+    grpc::CallbackServerContext* context,
+    const telStub::ModifyOrRespondToModifyCallRequest* request,
+    telStub::ModifyOrRespondToModifyCallReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ModifyOrRespondToModifyCall(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::SendRtt(grpc::CallbackServerContext* context,
+    const telStub::SendRttRequest* request, telStub::SendRttReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SendRtt(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::updateCalls(grpc::CallbackServerContext* context,
+    const telStub::UpdateCurrentCallsRequest* request, ::google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return updateCalls(request, response); });
+}
+
+grpc::ServerUnaryReactor* CallManagerServerImpl::ConfigureECallRedial(
+    grpc::CallbackServerContext* context, const telStub::ConfigureECallRedialRequest* request,
+    telStub::ConfigureECallRedialResponse* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureECallRedial(request, response); });
+}
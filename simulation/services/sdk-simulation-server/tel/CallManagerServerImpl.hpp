@@ -53,6 +53,9 @@
 #include "../event/EventService.hpp"
 #include "../../../libs/tel/Helper.hpp"
 #include "TelUtil.hpp"
+#include "libs/common/TimerService.hpp"
+#include <chrono>
+#include <map>
 #include <mutex>
 #include <condition_variable>
 
@@ -86,75 +89,78 @@ struct CallInfo {
 };
 
 
-class CallManagerServerImpl final : public telStub::DialerService::Service,
+class CallManagerServerImpl final : public telStub::DialerService::CallbackService,
                                     public IServerEventListener,
                                     public std::enable_shared_from_this<CallManagerServerImpl> {
 
 public:
     CallManagerServerImpl();
     ~CallManagerServerImpl();
-    grpc::Status InitService(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status GetServiceStatus(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status MakeECall(ServerContext* context, const telStub::MakeECallRequest*
-        request, telStub::MakeECallReply* response) override;
-    grpc::Status Hangup(ServerContext* context, const telStub::HangupRequest* request,
-        telStub::HangupReply* response);
-    grpc::Status UpdateECallMsd(ServerContext* context,
-        const telStub::UpdateECallMsdRequest* request, telStub::UpdateECallMsdResponse* response);
-    grpc::Status RequestECallHlapTimerStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* MakeECall(grpc::CallbackServerContext* context,
+        const telStub::MakeECallRequest* request, telStub::MakeECallReply* response) override;
+    grpc::ServerUnaryReactor* Hangup(grpc::CallbackServerContext* context,
+        const telStub::HangupRequest* request, telStub::HangupReply* response) override;
+    grpc::ServerUnaryReactor* UpdateECallMsd(grpc::CallbackServerContext* context,
+        const telStub::UpdateECallMsdRequest* request,
+        telStub::UpdateECallMsdResponse* response) override;
+    grpc::ServerUnaryReactor* RequestECallHlapTimerStatus(grpc::CallbackServerContext* context,
         const telStub::RequestECallHlapTimerStatusRequest* request,
-        telStub::RequestECallHlapTimerStatusReply* response);
-    grpc::Status CleanUpService(ServerContext* context,
-        const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response);
-    grpc::Status SetConfig(ServerContext* context,
-        const telStub::SetConfigRequest* request,  telStub::SetConfigReply* response);
-    grpc::Status GetConfig(ServerContext* context,
-        const ::google::protobuf::Empty* request,  telStub::GetConfigResponse* response);
-    grpc::Status UpdateEcallHlapTimer(ServerContext* context,
+        telStub::RequestECallHlapTimerStatusReply* response) override;
+    grpc::ServerUnaryReactor* CleanUpService(grpc::CallbackServerContext* context,
+        const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) override;
+    grpc::ServerUnaryReactor* SetConfig(grpc::CallbackServerContext* context,
+        const telStub::SetConfigRequest* request, telStub::SetConfigReply* response) override;
+    grpc::ServerUnaryReactor* GetConfig(grpc::CallbackServerContext* context,
+        const ::google::protobuf::Empty* request, telStub::GetConfigResponse* response) override;
+    grpc::ServerUnaryReactor* UpdateEcallHlapTimer(grpc::CallbackServerContext* context,
         const telStub::UpdateEcallHlapTimerRequest* request,
-        telStub::UpdateEcallHlapTimerResponse* response);
-    grpc::Status RequestEcallHlapTimer(ServerContext* context,
+        telStub::UpdateEcallHlapTimerResponse* response) override;
+    grpc::ServerUnaryReactor* RequestEcallHlapTimer(grpc::CallbackServerContext* context,
         const telStub::RequestEcallHlapTimerRequest* request,
-        telStub::RequestEcallHlapTimerReply* response);
-    grpc::Status ExitEcbm(ServerContext* context, const telStub::RequestEcbmRequest* request,
-        telStub::RequestEcbmReply* response);
-    grpc::Status RequestEcbm(ServerContext* context,
-        const telStub::RequestEcbmRequest* request, telStub::RequestEcbmReply* response);
-    grpc::Status MakeCall(ServerContext* context,
-        const telStub::MakeCallRequest* request, telStub::MakeCallReply* response);
-    grpc::Status Reject(ServerContext* context,
-        const telStub::RejectRequest* request, telStub::RejectReply* response);
-    grpc::Status RejectWithSMS(ServerContext* context,
-        const telStub::RejectWithSMSRequest* request, telStub::RejectWithSMSReply* response);
-    grpc::Status Answer(ServerContext* context,
-        const telStub::AnswerRequest* request, telStub::AnswerReply* response);
-    grpc::Status HangupForegroundResumeBackground(ServerContext* context,
+        telStub::RequestEcallHlapTimerReply* response) override;
+    grpc::ServerUnaryReactor* RequestEcbm(grpc::CallbackServerContext* context,
+        const telStub::RequestEcbmRequest* request, telStub::RequestEcbmReply* response) override;
+    grpc::ServerUnaryReactor* MakeCall(grpc::CallbackServerContext* context,
+        const telStub::MakeCallRequest* request, telStub::MakeCallReply* response) override;
+    grpc::ServerUnaryReactor* Reject(grpc::CallbackServerContext* context,
+        const telStub::RejectRequest* request, telStub::RejectReply* response) override;
+    grpc::ServerUnaryReactor* RejectWithSMS(grpc::CallbackServerContext* context,
+        const telStub::RejectWithSMSRequest* request,
+        telStub::RejectWithSMSReply* response) override;
+    grpc::ServerUnaryReactor* Answer(grpc::CallbackServerContext* context,
+        const telStub::AnswerRequest* request, telStub::AnswerReply* response) override;
+    grpc::ServerUnaryReactor* HangupForegroundResumeBackground(grpc::CallbackServerContext* context,
         const telStub::HangupForegroundResumeBackgroundRequest* request,
-        telStub::HangupForegroundResumeBackgroundReply* response);
-    grpc::Status HangupWaitingOrBackground(ServerContext* context,
+        telStub::HangupForegroundResumeBackgroundReply* response) override;
+    grpc::ServerUnaryReactor* HangupWaitingOrBackground(grpc::CallbackServerContext* context,
         const telStub::HangupWaitingOrBackgroundRequest* request,
-        telStub::HangupWaitingOrBackgroundReply* response);
-    grpc::Status Hold(ServerContext* context, const telStub::HoldRequest* request,
-        telStub::HoldReply* response);
-    grpc::Status Resume(ServerContext* context, const telStub::ResumeRequest* request,
-        telStub::ResumeReply* response);
-    grpc::Status Swap(ServerContext* context, const telStub::SwapRequest* request,
-        telStub::SwapReply* response);
-    grpc::Status RequestNetworkDeregistration(ServerContext* context,
+        telStub::HangupWaitingOrBackgroundReply* response) override;
+    grpc::ServerUnaryReactor* Hold(grpc::CallbackServerContext* context,
+        const telStub::HoldRequest* request, telStub::HoldReply* response) override;
+    grpc::ServerUnaryReactor* Resume(grpc::CallbackServerContext* context,
+        const telStub::ResumeRequest* request, telStub::ResumeReply* response) override;
+    grpc::ServerUnaryReactor* Swap(grpc::CallbackServerContext* context,
+        const telStub::SwapRequest* request, telStub::SwapReply* response) override;
+    grpc::ServerUnaryReactor* RequestNetworkDeregistration(grpc::CallbackServerContext* context,
         const telStub::RequestNetworkDeregistrationRequest* request,
-        telStub::RequestNetworkDeregistrationReply* response);
-    grpc::Status ModifyOrRespondToModifyCall(ServerContext* context,
+        telStub::RequestNetworkDeregistrationReply* response) override;
+    grpc::ServerUnaryReactor* ModifyOrRespondToModifyCall(grpc::CallbackServerContext* context,
         const telStub::ModifyOrRespondToModifyCallRequest* request,
-        telStub::ModifyOrRespondToModifyCallReply* response);
-    grpc::Status SendRtt(ServerContext* context,
-        const telStub::SendRttRequest* request, telStub::SendRttReply* response);
-    grpc::Status updateCalls(ServerContext* context,
-        const telStub::UpdateCurrentCallsRequest* request, ::google::protobuf::Empty* response);
-    grpc::Status ConfigureECallRedial(ServerContext* context,
+        telStub::ModifyOrRespondToModifyCallReply* response) override;
+    grpc::ServerUnaryReactor* SendRtt(grpc::CallbackServerContext* context,
+        const telStub::SendRttRequest* request, telStub::SendRttReply* response) override;
+    grpc::ServerUnaryReactor* updateCalls(grpc::CallbackServerContext* context,
+        const telStub::UpdateCurrentCallsRequest* request,
+        ::google::protobuf::Empty* response) override;
+    grpc::ServerUnaryReactor* ConfigureECallRedial(grpc::CallbackServerContext* context,
         const telStub::ConfigureECallRedialRequest* request,
-        telStub::ConfigureECallRedialResponse* response);
+        telStub::ConfigureECallRedialResponse* response) override;
     void startTimer(std::string timer);
     void msdTransmissionStatus(std::string msdtransmision );
     void changeCallState(int phoneId, std::string callstate, int index);
@@ -164,6 +170,59 @@ public:
     void onECallRedial(int phoneId, bool willECallRedial, telux::tel::ReasonType reason);
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status MakeECall(const telStub::MakeECallRequest* request,
+        telStub::MakeECallReply* response);
+    grpc::Status Hangup(const telStub::HangupRequest* request, telStub::HangupReply* response);
+    grpc::Status UpdateECallMsd(const telStub::UpdateECallMsdRequest* request,
+        telStub::UpdateECallMsdResponse* response);
+    grpc::Status RequestECallHlapTimerStatus(
+        const telStub::RequestECallHlapTimerStatusRequest* request,
+        telStub::RequestECallHlapTimerStatusReply* response);
+    grpc::Status CleanUpService(const ::google::protobuf::Empty* request,
+        ::google::protobuf::Empty* response);
+    grpc::Status SetConfig(const telStub::SetConfigRequest* request,
+        telStub::SetConfigReply* response);
+    grpc::Status GetConfig(const ::google::protobuf::Empty* request,
+        telStub::GetConfigResponse* response);
+    grpc::Status UpdateEcallHlapTimer(const telStub::UpdateEcallHlapTimerRequest* request,
+        telStub::UpdateEcallHlapTimerResponse* response);
+    grpc::Status RequestEcallHlapTimer(const telStub::RequestEcallHlapTimerRequest* request,
+        telStub::RequestEcallHlapTimerReply* response);
+    grpc::Status ExitEcbm(const telStub::RequestEcbmRequest* request,
+        telStub::RequestEcbmReply* response);
+    grpc::Status RequestEcbm(const telStub::RequestEcbmRequest* request,
+        telStub::RequestEcbmReply* response);
+    grpc::Status MakeCall(const telStub::MakeCallRequest* request,
+        telStub::MakeCallReply* response);
+    grpc::Status Reject(const telStub::RejectRequest* request, telStub::RejectReply* response);
+    grpc::Status RejectWithSMS(const telStub::RejectWithSMSRequest* request,
+        telStub::RejectWithSMSReply* response);
+    grpc::Status Answer(const telStub::AnswerRequest* request, telStub::AnswerReply* response);
+    grpc::Status HangupForegroundResumeBackground(
+        const telStub::HangupForegroundResumeBackgroundRequest* request,
+        telStub::HangupForegroundResumeBackgroundReply* response);
+    grpc::Status HangupWaitingOrBackground(const telStub::HangupWaitingOrBackgroundRequest* request,
+        telStub::HangupWaitingOrBackgroundReply* response);
+    grpc::Status Hold(const telStub::HoldRequest* request, telStub::HoldReply* response);
+    grpc::Status Resume(const telStub::ResumeRequest* request, telStub::ResumeReply* response);
+    grpc::Status Swap(const telStub::SwapRequest* request, telStub::SwapReply* response);
+    grpc::Status RequestNetworkDeregistration(
+        const telStub::RequestNetworkDeregistrationRequest* request,
+        telStub::RequestNetworkDeregistrationReply* response);
+    grpc::Status ModifyOrRespondToModifyCall(
+        const telStub::ModifyOrRespondToModifyCallRequest* request,
+        telStub::ModifyOrRespondToModifyCallReply* response);
+    grpc::Status SendRtt(const telStub::SendRttRequest* request, telStub::SendRttReply* response);
+    grpc::Status updateCalls(const telStub::UpdateCurrentCallsRequest* request,
+        ::google::protobuf::Empty* response);
+    grpc::Status ConfigureECallRedial(const telStub::ConfigureECallRedialRequest* request,
+        telStub::ConfigureECallRedialResponse* response);
+
     Json::Value rootObjSystemStateSlot1_;
     Json::Value rootObjSystemStateSlot2_;
     Json::Value rootObjApiResponseSlot1_;
@@ -174,6 +233,20 @@ private:
     std::map <int, std::string> jsonObjApiResponseFileName_;
     std::mutex callManagerMutex_;
     std::shared_ptr<EcallStateMachine> ecallStateMachine_;
+    /* Run of a regulatory (HLAP) timer of an eCall */
+    struct HlapTimerRun {
+        uint64_t seq = 0;
+        telux::common::TimerService::TimerId id = telux::common::TimerService::INVALID_TIMER_ID;
+        std::chrono::steady_clock::time_point startTime;
+        int durationMs = 0;
+        int elapsedMs = 0;
+        bool isRunning = false;
+        bool isExpired = false;
+    };
+    /* Protects hlapTimers_, the last run of each timer is kept per slot */
+    std::mutex hlapTimerMutex_;
+    std::map<int, std::map<std::string, HlapTimerRun>> hlapTimers_;
+    uint64_t hlapTimerSeq_ = 0;
     bool iseCallNumTypeOverridden_ = false;
     grpc::Status readJson();
     void getJsonForSystemData (int phoneId, std::string& jsonfilename, Json::Value& rootObj );
@@ -187,6 +260,9 @@ private:
     telux::common::Status handleStateMachine(int phoneId, int callIndex);
     void startTimers(std::string timer);
     void triggerTimerExpiry(std::string timer, int phoneId);
+    void onHlapTimerExpiry(int phoneId, std::string timer, uint64_t seq);
+    void cancelHlapTimer(int phoneId, std::string timer);
+    void cancelHlapTimers();
     void triggerECallInfoChangeEvent(std::string timer, telux::tel::HlapTimerEvent action);
     void triggerCallInfoChangeEvent(int phoneId, std::shared_ptr<CallInfo> call);
     void triggerCallInfoChange(int phoneId);
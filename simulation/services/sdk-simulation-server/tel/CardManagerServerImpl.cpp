@@ -34,6 +34,7 @@
 
 #include "CardManagerServerImpl.hpp"
 #include "libs/tel/TelDefinesStub.hpp"
+#include "common/RpcExecutor.hpp"
 #include <telux/common/DeviceConfig.hpp>
 #include <telux/tel/CardDefines.hpp>
 
@@ -65,7 +66,8 @@ do { \
    } \
 } while (0);
 
-CardManagerServerImpl::CardManagerServerImpl() {
+CardManagerServerImpl::CardManagerServerImpl()
+   : uiccModel_(std::make_shared<telux::tel::UiccModel>()) {
     LOG(DEBUG, __FUNCTION__);
     readJson();
 }
@@ -79,6 +81,8 @@ CardManagerServerImpl::~CardManagerServerImpl() {
 
 grpc::Status CardManagerServerImpl::readJson() {
     LOG(DEBUG, __FUNCTION__);
+    // Write back pending card updates first, they would be lost on the next write otherwise
+    uiccModel_->flush();
     telux::common::ErrorCode error =
         JsonParser::readFromJsonFile(rootObjSystemStateSlot1_, JSON_PATH1);
     if (error != ErrorCode::SUCCESS) {
@@ -144,28 +148,7 @@ bool CardManagerServerImpl::isCallbackNeeded(Json::Value rootObj, std::string ap
     return isCallback;
 }
 
-bool CardManagerServerImpl::findAppId(Json::Value rootObj, const char* appid, int& index) {
-    int sizeofADF = rootObj["ICardManager"]["EFs"]["ADF"].size();
-    LOG(DEBUG, __FUNCTION__,"Size of ADF is", sizeofADF);
-    bool foundAppId = false;
-    for (index =0 ; index < sizeofADF ; index++) {
-        const char* tmp = (rootObj["ICardManager"]["EFs"]["ADF"]\
-            [index]["AppId"].asString()).c_str();
-        std::string val = rootObj["ICardManager"]["EFs"]["ADF"]\
-            [index]["AppId"].asString();
-        LOG(DEBUG, __FUNCTION__,"appid is orignal from json  ", val);
-        if(strcmp(tmp, appid) == 0) {
-            foundAppId = true;
-            std::string t = rootObj["ICardManager"]["EFs"]["ADF"][index]["AppId"].asString();
-            LOG(DEBUG, __FUNCTION__,"appid is ", t);
-            break;
-        }
-    }
-    return foundAppId;
-}
-
-grpc::Status CardManagerServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request,
+grpc::Status CardManagerServerImpl::InitService(const google::protobuf::Empty* request,
     commonStub::GetServiceStatusReply* response) {
 
     Json::Value rootObj;
@@ -189,8 +172,7 @@ grpc::Status CardManagerServerImpl::InitService(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::GetServiceStatus(ServerContext* context,
-    const google::protobuf::Empty* request,
+grpc::Status CardManagerServerImpl::GetServiceStatus(const google::protobuf::Empty* request,
     commonStub::GetServiceStatusReply* response) {
 
     Json::Value rootObj;
@@ -204,8 +186,7 @@ grpc::Status CardManagerServerImpl::GetServiceStatus(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::IsSubsystemReady(ServerContext* context,
-    const google::protobuf::Empty* request,
+grpc::Status CardManagerServerImpl::IsSubsystemReady(const google::protobuf::Empty* request,
     commonStub::IsSubsystemReadyReply* response) {
 
     bool status = false;
@@ -223,8 +204,7 @@ grpc::Status CardManagerServerImpl::IsSubsystemReady(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::GetCardState(ServerContext* context,
-    const ::telStub::GetCardStateRequest* request,
+grpc::Status CardManagerServerImpl::GetCardState(const ::telStub::GetCardStateRequest* request,
     telStub::GetCardStateReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
@@ -258,1111 +238,330 @@ grpc::Status CardManagerServerImpl::GetCardState(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::ReadEFLinearFixed(ServerContext* context,
-    const ::telStub::ReadEFLinearFixedRequest* request,
-    telStub::ReadEFLinearFixedReply* response) {
-    LOG(DEBUG, __FUNCTION__);
+grpc::Status CardManagerServerImpl::getApiResponse(int slotId, const std::string &apiname,
+    Json::Value &rootObj, telux::common::Status &status, telux::common::ErrorCode &error,
+    int &cbDelay) {
+    if (uiccModel_->getApiResponse(slotId, apiname, rootObj) != ErrorCode::SUCCESS) {
+        return grpc::Status(grpc::StatusCode::NOT_FOUND, "Json not found");
+    }
+    CommonUtils::getValues(rootObj, "ICardManager", apiname, status, error, cbDelay);
+    return grpc::Status::OK;
+}
+
+static void setIccResult(const telux::tel::IccResult &result, telStub::IccResult *record) {
+    record->set_sw1(result.sw1);
+    record->set_sw2(result.sw2);
+    record->set_pay_load(result.payload);
+    for (auto &it : result.data) {
+        record->add_data(it);
+    }
+}
+
+static std::vector<uint8_t> getRequestData(
+    const google::protobuf::RepeatedField<int32_t> &requestData) {
+    std::vector<uint8_t> data;
+    for (int d : requestData) {
+        data.emplace_back(d);
+    }
+    return data;
+}
 
+grpc::Status CardManagerServerImpl::ReadEFLinearFixed(
+    const ::telStub::ReadEFLinearFixedRequest* request, telStub::ReadEFLinearFixedReply* response) {
+    LOG(DEBUG, __FUNCTION__);
     int slotId = request->slot_id();
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(slotId, jsonfilename, rootObj);
-        //Api response
-        std::string jsonObjApiResponseFileName = "";
-        Json::Value jsonObjApiResponse;
-        getJsonForApiResponseSlot(slotId, jsonObjApiResponseFileName, jsonObjApiResponse);
-
-        std::string filepath = request->file_path();
-        uint16_t fileId  = request->file_id();
-        int recordNum = request->record_number();
-        std::string aid = request->aid();
-        const char* appid = aid.c_str();
+    std::string apiname = "readEFLinearFixed";
+    Json::Value jsonObjApiResponse;
+    telux::common::Status status;
+    telux::common::ErrorCode error;
+    int cbDelay;
+    grpc::Status readStatus = getApiResponse(slotId, apiname, jsonObjApiResponse, status, error,
+        cbDelay);
+    if (readStatus.ok()) {
         telux::tel::IccResult result;
-        telux::common::ErrorCode error;
-        telux::common::Status status;
-        commonStub::ErrorCode tmp;
-        int cbDelay;
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", "readEFLinearFixed", status,
-            error, cbDelay );
-        int index;
-        int i =0;
-        if(status == telux::common::Status::SUCCESS) {
-            bool foundAppId = findAppId(rootObj, appid, index);
-            if(foundAppId) {
-                int size = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                    ["LinearFixedEFFiles"].size();
-                LOG(DEBUG, __FUNCTION__,"LinearFixedEFfiles size ", size);
-                tmp = findmatchingrecordADF<telStub::ReadEFLinearFixedReply*>(rootObj, response,
-                    size, index, recordNum, fileId, i);
-                if(tmp == commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
-                    result.sw1 = rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"]\
-                                [i+recordNum]["sw1"].asInt();
-                    result.sw2 = rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"]\
-                                [i+recordNum]["sw2"].asInt();
-                    result.payload = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["LinearFixedEFFiles"][i+recordNum]["payload"].asString();
-                    std::string input = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["LinearFixedEFFiles"][i+recordNum]["data"].asString();
-                    result.data = CommonUtils::convertStringToVector(input);
-                } else {
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            } else {
-                int size = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"].size();
-                tmp = findmatchingrecordDF(rootObj, size, recordNum , fileId, i);
-                if (tmp == commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
-                    result.sw1 = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"]\
-                                [i+recordNum]["sw1"].asInt();
-                    result.sw2 = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"]\
-                                [i+recordNum]["sw2"].asInt();
-                    result.payload = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"]\
-                                [i+recordNum]["payload"].asString();
-                    std::string input = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"]\
-                                [i+recordNum]["data"].asString();
-                    result.data = CommonUtils::convertStringToVector(input);
-                } else {
-                    LOG(DEBUG, __FUNCTION__, "Valid AppId not found");
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            }
+        if (status == telux::common::Status::SUCCESS) {
+            error = uiccModel_->readRecord(slotId, request->aid(), request->file_id(),
+                request->record_number(), result);
         }
         // Create response
-        telStub::IccResult requestedRecord;
-        std::string apiname = "readEFLinearFixed";
         response->set_error(static_cast<commonStub::ErrorCode>(error));
         response->set_delay(cbDelay);
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, apiname);
-        response->set_iscallback(iscallback);
+        response->set_iscallback(isCallbackNeeded(jsonObjApiResponse, apiname));
         response->set_status(static_cast<commonStub::Status>(status));
-        if(error == telux::common::ErrorCode::SUCCESS) {
-            requestedRecord.set_sw1(result.sw1);
-            requestedRecord.set_sw2(result.sw2);
-            requestedRecord.set_pay_load(result.payload);
-            for(auto &it : result.data) {
-                requestedRecord.add_data(it);
-            }
-        } else {
-            std::string s = "";
-            requestedRecord.set_sw1(0);
-            requestedRecord.set_sw2(0);
-            requestedRecord.set_pay_load(s);
-            for(auto &it : result.data) {
-                requestedRecord.add_data(it);
-            }
+        if (error != telux::common::ErrorCode::SUCCESS) {
+            result = telux::tel::IccResult();
         }
-        *response->mutable_result() = requestedRecord;
+        setIccResult(result, response->mutable_result());
     }
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::WriteEFLinearFixed(ServerContext* context,
+grpc::Status CardManagerServerImpl::WriteEFLinearFixed(
     const ::telStub::WriteEFLinearFixedRequest* request,
     telStub::WriteEFLinearFixedReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int slotId = request->slot_id();
-    std::string jsonfilename = "";
-    std::string jsonObjApiResponseFileName = "";
-    Json::Value rootObj;
+    std::string apiname = "writeEFLinearFixed";
     Json::Value jsonObjApiResponse;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(slotId, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(slotId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        std::string filepath = request->file_path();
-        uint16_t fileId  = request->file_id();
-        std::string aid = request->aid();
-        const char* appid = aid.c_str();
+    telux::common::Status status;
+    telux::common::ErrorCode error;
+    int cbDelay;
+    grpc::Status readStatus = getApiResponse(slotId, apiname, jsonObjApiResponse, status, error,
+        cbDelay);
+    if (readStatus.ok()) {
         telux::tel::IccResult result;
-        int recordsize = request->record_number();
-        std::vector<uint8_t> data;
-        telux::common::Status status;
-        int cbDelay;
-        commonStub::ErrorCode tmp;
-        telux::common::ErrorCode error;
-        for(int d : request->data()) {
-            data.emplace_back(d);
-        }
-        int s = data.size();
-        for (int i = 0; i < s; i++) {
-            LOG(DEBUG, __FUNCTION__,"data recieved from request", static_cast<int>(data.at(i)));
-        }
-        std::string str1 = "";
-        int i = 0;
-        int index =0;
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", "writeEFLinearFixed", status,
-            error, cbDelay );
-        if(status == telux::common::Status::SUCCESS) {
-            bool foundAppId = findAppId(rootObj, appid, index);
-            if(foundAppId) {
-                int size = rootObj["ICardManager"]["EFs"]["ADF"]\
-                    [index]["LinearFixedEFFiles"].size();
-                LOG(DEBUG, __FUNCTION__,"LinearFixedEFfiles size ", size);
-                tmp = findmatchingrecordADF<telStub::WriteEFLinearFixedReply*>(rootObj,
-                    response, size, index, recordsize, fileId, i);
-                if(tmp == commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
-                    str1 = CommonUtils::convertVectorToString(data, false);
-                    LOG(DEBUG, __FUNCTION__,"String value is", str1);
-                    rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"][i+recordsize]\
-                        ["data"] = str1;
-                    LOG(DEBUG, __FUNCTION__,"String is data  ", str1);
-                    str1 = CommonUtils::convertVectorToString(data, true);
-                    LOG(DEBUG, __FUNCTION__,"String is payload ", str1);
-                    rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"][i+recordsize]\
-                        ["payload"] = str1;
-                    JsonParser::writeToJsonFile(rootObj, jsonfilename);
-                    jsonObjSystemStateSlot_[slotId] = rootObj;
-                    result.sw1 = rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"]\
-                        [i+recordsize]["sw1"].asInt();
-                    LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw1);
-                    result.sw2 = rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"]\
-                        [i+recordsize]["sw2"].asInt();
-                    LOG(DEBUG, __FUNCTION__,"sw2 ", result.sw2);
-                } else {
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            } else {
-                int i = 0;
-                int size = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"].size();
-                tmp = findmatchingrecordDF(rootObj, size, recordsize , fileId, i);
-                if (tmp == commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
-                    str1 = CommonUtils::convertVectorToString(data, false);
-                    rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"][i+recordsize]\
-                        ["data"] = str1;
-                    LOG(DEBUG, __FUNCTION__,"String is  ", str1);
-                    str1 = CommonUtils::convertVectorToString(data, true);
-                    rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"][i+recordsize]\
-                        ["payload"] = str1;
-                    JsonParser::writeToJsonFile(rootObj, jsonfilename);
-                    jsonObjSystemStateSlot_[slotId] = rootObj;
-                    result.sw1 = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"]\
-                        [i+recordsize]["sw1"].asInt();
-                    result.sw2 = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"]\
-                        [i+recordsize]["sw2"].asInt();
-                } else {
-                    LOG(DEBUG, __FUNCTION__, "Valid AppId not found");
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            }
+        if (status == telux::common::Status::SUCCESS) {
+            error = uiccModel_->writeRecord(slotId, request->aid(), request->file_id(),
+                request->record_number(), getRequestData(request->data()), result);
         }
-        //Create response
-        std::string apiname = "writeEFLinearFixed";
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, apiname);
-        response->set_iscallback(iscallback);
+        // Create response
+        response->set_iscallback(isCallbackNeeded(jsonObjApiResponse, apiname));
         response->set_error(static_cast<commonStub::ErrorCode>(error));
-        LOG(DEBUG, __FUNCTION__, "STatus is", static_cast<int>(status));
         response->set_status(static_cast<commonStub::Status>(status));
-
-        telStub::IccResult requestedRecord;
-
-        if(error == telux::common::ErrorCode::SUCCESS) {
-            std::string s = "";
-            requestedRecord.set_sw1(result.sw1);
-            requestedRecord.set_sw2(result.sw2);
-            requestedRecord.set_pay_load(s);
-        } else {
-            std::string s = "";
-            requestedRecord.set_sw1(0);
-            requestedRecord.set_sw2(0);
-            requestedRecord.set_pay_load(s);
+        if (error != telux::common::ErrorCode::SUCCESS) {
+            result = telux::tel::IccResult();
         }
-        *response->mutable_result() = requestedRecord;
+        setIccResult(result, response->mutable_result());
     }
     return readStatus;
-    }
+}
 
-    grpc::Status CardManagerServerImpl::ReadEFLinearFixedAll(ServerContext* context,
+grpc::Status CardManagerServerImpl::ReadEFLinearFixedAll(
     const ::telStub::ReadEFLinearFixedAllRequest* request,
     telStub::ReadEFLinearFixedAllReply* response) {
     LOG(DEBUG, __FUNCTION__);
-
     int slotId = request->slot_id();
-    std::string jsonfilename = "";
     std::string apiname = "readEFLinearFixedAll";
-    Json::Value rootObj;
     Json::Value jsonObjApiResponse;
-    std::string jsonObjApiResponseFileName = "";
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(slotId, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(slotId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        std::string filepath = request->file_path();
-        uint16_t fileId  = request->file_id();
-        std::string aid = request->aid();
-        const char* appid = aid.c_str();
+    telux::common::Status status;
+    telux::common::ErrorCode error;
+    int cbDelay;
+    grpc::Status readStatus = getApiResponse(slotId, apiname, jsonObjApiResponse, status, error,
+        cbDelay);
+    if (readStatus.ok()) {
         std::vector<telux::tel::IccResult> records;
-        commonStub::ErrorCode tmp;
-        int cbDelay;
-        telux::common::Status status;
-        telux::common::ErrorCode error;
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", apiname, status,
-            error, cbDelay );
-
-        int index;
-        if(status == telux::common::Status::SUCCESS) {
-            bool foundAppId = findAppId(rootObj, appid, index);
-            if(foundAppId) {
-                int i = 0;
-                int size = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                    ["LinearFixedEFFiles"].size();
-                LOG(DEBUG, __FUNCTION__,"LinearFixedEFfiles size ", size);
-                while (i < size ) {
-                    uint16_t tmpfileId = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                        ["LinearFixedEFFiles"][i]["fileId"].asInt();
-                    if (tmpfileId == fileId) {
-                        int num = rootObj["ICardManager"]["EFs"]["ADF"]\
-                            [index]["LinearFixedEFFiles"][i]["numberOfRecords"].asInt();
-                        LOG(DEBUG, __FUNCTION__,"NumberOfRecords ", num);
-                        for(int j = 1; j <= num ; j++) {
-                            telux::tel::IccResult result;
-                            result.sw1 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["LinearFixedEFFiles"][i+j]["sw1"].asInt();
-                            LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw1);
-                            result.sw2 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["LinearFixedEFFiles"][i+j]["sw2"].asInt();
-                            LOG(DEBUG, __FUNCTION__,"sw2 ", result.sw2);
-                            result.payload = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["LinearFixedEFFiles"][i+j]["payload"].asString();
-                            LOG(DEBUG, __FUNCTION__,"payload ", result.payload);
-                            std::string input = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["LinearFixedEFFiles"][i+j]["data"].asString();
-                            result.data = CommonUtils::convertStringToVector(input);
-                            records.emplace_back(result);
-                        }
-                        break;
-                    } else {
-                        LOG(DEBUG, __FUNCTION__,"FileId not found ", i );
-                        int num = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["LinearFixedEFFiles"][i]["numberOfRecords"].asInt();
-                        i = i + num + 1;
-                        LOG(DEBUG, __FUNCTION__,"Incremented value is ", i );
-                    }
-                }
-                if(i == size) {
-                    LOG(DEBUG, __FUNCTION__,"Valid record not found ", i );
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            } else {
-                int size = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"].size();
-                int i =0;
-                int recordnum = 0;
-                tmp = findmatchingrecordDF(rootObj, size, recordnum , fileId, i);
-                if (tmp == commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
-                    int num = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"][i]\
-                        ["numberOfRecords"].asInt();
-                    LOG(DEBUG, __FUNCTION__,"NumberOfRecords ", num);
-                    for(int j = 1; j <= num ; j++) {
-                        telux::tel::IccResult result;
-                        result.sw1 = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"]\
-                            [j]["sw1"].asInt();
-                        result.sw2 = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"][j]\
-                            ["sw2"].asInt();
-                        result.payload = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"]\
-                            [j]["payload"].asString();
-                        std::string input = rootObj["ICardManager"]["EFs"]\
-                            ["DFLinearFixedEFRecords"][j]["data"].asString();
-                        result.data = CommonUtils::convertStringToVector(input);
-                        records.emplace_back(result);
-                    }
-                } else {
-                    LOG(DEBUG, __FUNCTION__,"Valid fileId not found ");
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            }
+        if (status == telux::common::Status::SUCCESS) {
+            error = uiccModel_->readAllRecords(slotId, request->aid(), request->file_id(),
+                records);
         }
-
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, apiname);
+        // Create response
         response->set_error(static_cast<commonStub::ErrorCode>(error));
-        response->set_iscallback(iscallback);
+        response->set_iscallback(isCallbackNeeded(jsonObjApiResponse, apiname));
         response->set_delay(cbDelay);
         response->set_status(static_cast<commonStub::Status>(status));
-
-        for(auto &it : records) {
-            telStub::IccResult *result = response->add_records();
-            if(error == telux::common::ErrorCode::SUCCESS) {
-                result->set_sw1(it.sw1);
-                result->set_sw2(it.sw2);
-                result->set_pay_load(it.payload);
-                for (auto &r : it.data) {
-                    result->add_data(r);
-                }
-            } else {
-                std::string s = "";
-                result->set_sw1(0);
-                result->set_sw2(0);
-                result->set_pay_load(s);
-                for (auto &r : it.data) {
-                    result->add_data(r);
-                }
+        if (error == telux::common::ErrorCode::SUCCESS) {
+            for (auto &it : records) {
+                setIccResult(it, response->add_records());
             }
         }
     }
     return readStatus;
 }
-grpc::Status CardManagerServerImpl::ReadEFTransparent(ServerContext* context,
-    const ::telStub::ReadEFTransparentRequest* request,
-    telStub::ReadEFTransparentReply* response) {
+
+grpc::Status CardManagerServerImpl::ReadEFTransparent(
+    const ::telStub::ReadEFTransparentRequest* request, telStub::ReadEFTransparentReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int slotId = request->slot_id();
-    std::string jsonfilename = "";
-    std::string jsonObjApiResponseFileName = "";
+    std::string apiname = "readEFTransparent";
     Json::Value jsonObjApiResponse;
-    Json::Value rootObj;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(slotId, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(slotId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        std::string filepath = request->file_path();
-        uint16_t fileId  = request->file_id();
-        int recordsize = request->size();
-        std::string aid = request->aid();
-        const char* appid = aid.c_str();
+    telux::common::Status status;
+    telux::common::ErrorCode error;
+    int cbDelay;
+    grpc::Status readStatus = getApiResponse(slotId, apiname, jsonObjApiResponse, status, error,
+        cbDelay);
+    if (readStatus.ok()) {
         telux::tel::IccResult result;
-        telux::common::ErrorCode error;
-        telux::common::Status status;
-        int cbDelay;
-        std::string apiname = "readEFTransparent";
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", apiname, status,
-            error, cbDelay );
-
-        int sizeofADF = rootObj["ICardManager"]["EFs"]["ADF"].size();
-        LOG(DEBUG, __FUNCTION__,"Size of ADF is", sizeofADF);
-        int index;
-        if(status == telux::common::Status::SUCCESS) {
-            bool foundAppId = findAppId(rootObj, appid, index);
-            if(foundAppId) {
-                int i = 0;
-                int size = rootObj["ICardManager"]["EFs"]["ADF"]\
-                    [index]["TransparentEFFiles"].size();
-                LOG(DEBUG, __FUNCTION__,"TransparentEFfiles size ", size);
-                while (i < size ) {
-                    uint16_t tmpfileId = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                        ["TransparentEFFiles"][i]["fileId"].asInt();
-                    if (tmpfileId == fileId) {
-                        if (recordsize >= 0)  {
-                            result.sw1 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["TransparentEFFiles"][i]["sw1"].asInt();
-                            LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw1);
-                            result.sw2 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["TransparentEFFiles"][i]["sw2"].asInt();
-                            LOG(DEBUG, __FUNCTION__,"sw2 ", result.sw2);
-                            result.payload = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["TransparentEFFiles"][i]["payload"].asString();
-                            LOG(DEBUG, __FUNCTION__,"payload ", result.payload);
-                            std::string input = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                                ["TransparentEFFiles"][i]["data"].asString();
-                            result.data = CommonUtils::convertStringToVector(input);
-                            break;
-                        } else {
-                            LOG(DEBUG, __FUNCTION__,"Request failed ");
-                            error = telux::common::ErrorCode::GENERIC_FAILURE;
-                        }
-                    }
-                    i++;
-                }
-                if (i == size) {
-                    LOG(DEBUG, __FUNCTION__,"FileId not found ");
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
+        if (status == telux::common::Status::SUCCESS) {
+            if (request->size() >= 0) {
+                error = uiccModel_->readTransparent(slotId, request->aid(), request->file_id(),
+                    result);
             } else {
-                int i = 0;
-                int size = rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"].size();
-                LOG(DEBUG, __FUNCTION__,"TransparentEFfiles size ", size);
-                while (i < size ) {
-                    uint16_t tmpfileId = rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"]\
-                        [i]["fileId"].asInt();
-                    if (tmpfileId == fileId) {
-                        if (recordsize >= 0)  {
-                            result.sw1 = rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"]\
-                                [i]["sw1"].asInt();
-                            LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw1);
-                            result.sw2 = rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"]\
-                                [i]["sw2"].asInt();
-                            LOG(DEBUG, __FUNCTION__,"sw2 ", result.sw2);
-                            result.payload = rootObj["ICardManager"]["EFs"]\
-                                ["DFTransparentEFRecords"][i]["payload"].asString();
-                            LOG(DEBUG, __FUNCTION__,"payload ", result.payload);
-                            std::string input = rootObj["ICardManager"]["EFs"]\
-                                ["DFTransparentEFRecords"][i]["data"].asString();
-                            result.data = CommonUtils::convertStringToVector(input);
-                            break;
-                        } else {
-                            LOG(DEBUG, __FUNCTION__,"Request failed ");
-                            error = telux::common::ErrorCode::GENERIC_FAILURE;
-                        }
-                    }
-                    i++;
-                }
-                if (i == size) {
-                    LOG(DEBUG, __FUNCTION__,"FileId not found ");
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
+                LOG(DEBUG, __FUNCTION__, "Request failed ");
+                error = telux::common::ErrorCode::GENERIC_FAILURE;
             }
         }
-        //Create response
-        telStub::IccResult requestedRecord;
+        // Create response
         response->set_error(static_cast<commonStub::ErrorCode>(error));
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, apiname);
-        response->set_iscallback(iscallback);
+        response->set_iscallback(isCallbackNeeded(jsonObjApiResponse, apiname));
         response->set_delay(cbDelay);
         response->set_status(static_cast<commonStub::Status>(status));
-        if(error == telux::common::ErrorCode::SUCCESS) {
-            requestedRecord.set_sw1(result.sw1);
-            requestedRecord.set_sw2(result.sw2);
-            requestedRecord.set_pay_load(result.payload);
-            for(auto &it : result.data) {
-                requestedRecord.add_data(it);
-            }
-        } else {
-            std::string s = "";
-            requestedRecord.set_sw1(0);
-            requestedRecord.set_sw2(0);
-            requestedRecord.set_pay_load(s);
-            for(auto &it : result.data) {
-                requestedRecord.add_data(it);
-            }
+        if (error != telux::common::ErrorCode::SUCCESS) {
+            result = telux::tel::IccResult();
         }
-        *response->mutable_result() = requestedRecord;
+        setIccResult(result, response->mutable_result());
     }
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::WriteEFTransparent(ServerContext* context,
+grpc::Status CardManagerServerImpl::WriteEFTransparent(
     const ::telStub::WriteEFTransparentRequest* request,
     telStub::WriteEFTransparentReply* response) {
     LOG(DEBUG, __FUNCTION__);
-
     int slotId = request->slot_id();
-    std::string jsonfilename = "";
     std::string apiname = "writeEFTransparent";
-    Json::Value rootObj;
-    std::string jsonObjApiResponseFileName = "";
     Json::Value jsonObjApiResponse;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(slotId, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(slotId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        std::string filepath = request->file_path();
-        uint16_t fileId  = request->file_id();
-        std::string aid = request->aid();
-        const char* appid = aid.c_str();
+    telux::common::Status status;
+    telux::common::ErrorCode error;
+    int cbDelay;
+    grpc::Status readStatus = getApiResponse(slotId, apiname, jsonObjApiResponse, status, error,
+        cbDelay);
+    if (readStatus.ok()) {
         telux::tel::IccResult result;
-        std::vector<uint8_t> data;
-        for(int d : request->data()) {
-            data.emplace_back(d);
+        if (status == telux::common::Status::SUCCESS) {
+            error = uiccModel_->writeTransparent(slotId, request->aid(), request->file_id(),
+                getRequestData(request->data()), result);
         }
-        std::string str1 = "";
-        std::string str2 = "";
-        int cbDelay;
-        telux::common::Status status;
-        telux::common::ErrorCode error;
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", apiname, status,
-            error, cbDelay );
-        int i = 0;
-
-        int sizeofADF = rootObj["ICardManager"]["EFs"]["ADF"].size();
-        LOG(DEBUG, __FUNCTION__,"Size of ADF is", sizeofADF);
-        int index;
-        if(status == telux::common::Status::SUCCESS) {
-            bool foundAppId = findAppId(rootObj, appid, index);
-            if(foundAppId) {
-                int size = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                    ["TransparentEFFiles"].size();
-                LOG(DEBUG, __FUNCTION__,"TransparentEFfiles size ", size );
-                LOG(DEBUG, __FUNCTION__,"TransparentEFfiles index ", index );
-                while (i < size ) {
-                    uint16_t tmpfileId = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                        ["TransparentEFFiles"][i]["fileId"].asInt();
-                    LOG(DEBUG, __FUNCTION__,"FileId is  ", tmpfileId);
-                    if (tmpfileId == fileId) {
-                        str1 = CommonUtils::convertVectorToString(data, false);
-                        rootObj["ICardManager"]["EFs"]["ADF"][index]["TransparentEFFiles"][i]\
-                            ["data"] = str1;
-                        LOG(DEBUG, __FUNCTION__,"String is  ", str1);
-                        str1 = CommonUtils::convertVectorToString(data, true);
-                        rootObj["ICardManager"]["EFs"]["ADF"][index]["TransparentEFFiles"][i]\
-                            ["payload"] = str1;
-                        JsonParser::writeToJsonFile(rootObj, jsonfilename);
-                        jsonObjSystemStateSlot_[slotId] = rootObj;
-                        result.sw1 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["TransparentEFFiles"][i]["sw1"].asInt();
-                        LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw1);
-                        result.sw2 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["TransparentEFFiles"][i]["sw2"].asInt();
-                        LOG(DEBUG, __FUNCTION__,"sw2 ", result.sw2);
-                        break;
-                    }
-                    i++;
-                }
-                if (i == size) {
-                    LOG(DEBUG, __FUNCTION__,"FileId not found ");
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            } else {
-                int i = 0;
-                int size = rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"].size();
-                LOG(DEBUG, __FUNCTION__,"TransparentEFfiles size ", size);
-                while (i < size ) {
-                    uint16_t tmpfileId = rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"]\
-                        [i]["fileId"].asInt();
-                    if (tmpfileId == fileId) {
-                        str1 = CommonUtils::convertVectorToString(data, false);
-                        rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"][i]["data"] = str1;
-                        LOG(DEBUG, __FUNCTION__,"String is  ", str1);
-                        str1 = CommonUtils::convertVectorToString(data, true);
-                        rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"][i]["payload"]
-                            = str1;
-                        JsonParser::writeToJsonFile(rootObj, jsonfilename);
-                        jsonObjSystemStateSlot_[slotId] = rootObj;
-                        result.sw1 = rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"][i]\
-                            ["sw1"].asInt();
-                        LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw1);
-                        result.sw2 = rootObj["ICardManager"]["EFs"]["DFTransparentEFRecords"][i]\
-                            ["sw2"].asInt();
-                        LOG(DEBUG, __FUNCTION__,"sw2 ", result.sw2);
-                        break;
-                    } else {
-                        LOG(DEBUG, __FUNCTION__,"Request failed ");
-                        error = telux::common::ErrorCode::GENERIC_FAILURE;
-                    }
-                    i++;
-                }
-                if (i == size) {
-                    LOG(DEBUG, __FUNCTION__,"FileId not found ");
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            }
-        }
-        //Create response
+        // Create response
         response->set_error(static_cast<commonStub::ErrorCode>(error));
-        telStub::IccResult requestedRecord;
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, apiname);
-        response->set_iscallback(iscallback);
+        response->set_iscallback(isCallbackNeeded(jsonObjApiResponse, apiname));
         response->set_delay(cbDelay);
         response->set_status(static_cast<commonStub::Status>(status));
-
-        if(error == telux::common::ErrorCode::SUCCESS) {
-            std::string s = "";
-            requestedRecord.set_sw1(result.sw1);
-            requestedRecord.set_sw2(result.sw2);
-            requestedRecord.set_pay_load(s);
-        } else {
-            std::string s = "";
-            requestedRecord.set_sw1(0);
-            requestedRecord.set_sw2(0);
-            requestedRecord.set_pay_load(s);
+        if (error != telux::common::ErrorCode::SUCCESS) {
+            result = telux::tel::IccResult();
         }
-        *response->mutable_result() = requestedRecord;
+        setIccResult(result, response->mutable_result());
     }
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::RequestEFAttributes(ServerContext* context,
-    const ::telStub::EFAttributesRequest* request,
-    ::telStub::RequestEFAttributesReply* response) {
-
+grpc::Status CardManagerServerImpl::RequestEFAttributes(
+    const ::telStub::EFAttributesRequest* request, ::telStub::RequestEFAttributesReply* response) {
+    LOG(DEBUG, __FUNCTION__);
     int slotId = request->slot_id();
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    std::string jsonObjApiResponseFileName = "";
+    std::string apiname = "requestEFAttributes";
     Json::Value jsonObjApiResponse;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(slotId, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(slotId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        std::string filepath = request->file_path();
-        ::telStub::EfType eftype = request->ef_type();
-        telux::tel::EfType ef_type= static_cast<telux::tel::EfType>(eftype);
-        uint16_t fileId  = request->file_id();
-        std::string aid = request->aid();
-        const char* appid = aid.c_str();
-
+    telux::common::Status status;
+    telux::common::ErrorCode error;
+    int cbDelay;
+    grpc::Status readStatus = getApiResponse(slotId, apiname, jsonObjApiResponse, status, error,
+        cbDelay);
+    if (readStatus.ok()) {
         telux::tel::IccResult result;
-        telux::tel::FileAttributes attributes;
-        commonStub::ErrorCode tmp;
-        telux::common::ErrorCode error;
-        std::string apiname = "requestEFAttributes";
-        int cbDelay;
-        int index;
-        int i = 0;
-        telux::common::Status status;
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", apiname, status,
-            error, cbDelay );
-
-        int sizeofADF = rootObj["ICardManager"]["EFs"]["ADF"].size();
-        LOG(DEBUG, __FUNCTION__,"Size of ADF is", sizeofADF);
-
-        if(status == telux::common::Status::SUCCESS) {
-            bool foundAppId = findAppId(rootObj, appid, index);
-            if(foundAppId) {
-                if (ef_type == telux::tel::EfType::TRANSPARENT ) {
-                    tmp = getTransparentFileAttributes(rootObj, i, fileId, attributes, index);
-                    if(tmp == commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
-                        std::string data = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["TransparentEFFiles"][i]["data"].asString();
-                        std::vector<int> tmp = CommonUtils::convertStringToVector(data);
-                        result.sw1 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["LinearFixedEFFiles"][i]["sw1"].asInt();
-                        LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw1);
-                        result.sw2 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["LinearFixedEFFiles"][i]["sw2"].asInt();
-                        LOG(DEBUG, __FUNCTION__,"sw2 ", result.sw2);
-                        result.payload = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["LinearFixedEFFiles"][i]["payload"].asString();
-                        LOG(DEBUG, __FUNCTION__,"payload ", result.payload);
-                    } else {
-                        error = telux::common::ErrorCode::GENERIC_FAILURE;
-                    }
-                } else if (ef_type == telux::tel::EfType::LINEAR_FIXED) {
-                    tmp = getLinearfixedFileAttributes(rootObj, i, fileId, attributes, index);
-                    if(tmp == commonStub::ErrorCode::ERROR_CODE_SUCCESS) {
-                        result.sw1 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["LinearFixedEFFiles"][i+1]["sw1"].asInt();
-                        LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw1);
-                        result.sw2 = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["LinearFixedEFFiles"][i+1]["sw2"].asInt();
-                        LOG(DEBUG, __FUNCTION__,"sw2 ", result.sw2);
-                        result.payload = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["LinearFixedEFFiles"][i+1]["payload"].asString();
-                        LOG(DEBUG, __FUNCTION__,"payload ", result.payload);
-                        std::string input = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                            ["LinearFixedEFFiles"][i+1]["data"].asString();
-                        result.data = CommonUtils::convertStringToVector(input);
-                    } else {
-                        error = telux::common::ErrorCode::GENERIC_FAILURE;
-                    }
-                } else {
-                    LOG(DEBUG, __FUNCTION__,"Unknown EFType ");
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            } else {
-                LOG(DEBUG, __FUNCTION__, "Valid AppId not found");
-                error = telux::common::ErrorCode::GENERIC_FAILURE;
-            }
+        telux::tel::FileAttributes attributes = {};
+        if (status == telux::common::Status::SUCCESS) {
+            error = uiccModel_->getFileAttributes(slotId, request->aid(), request->file_id(),
+                static_cast<telux::tel::EfType>(request->ef_type()), attributes, result);
         }
-
-        //Create response
-        telStub::IccResult requestedRecord;
-
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, apiname);
-        response->set_iscallback(iscallback);
+        // Create response
+        response->set_iscallback(isCallbackNeeded(jsonObjApiResponse, apiname));
         response->set_error(static_cast<commonStub::ErrorCode>(error));
         response->set_status(static_cast<commonStub::Status>(status));
         response->set_delay(cbDelay);
-        if(error == telux::common::ErrorCode::SUCCESS) {
-            requestedRecord.set_sw1(result.sw1);
-            requestedRecord.set_sw2(result.sw2);
-            requestedRecord.set_pay_load(result.payload);
-            for(auto &it : result.data) {
-                requestedRecord.add_data(it);
-            }
-            *response->mutable_result() = requestedRecord;
-            telStub::FileAttributes requestedAttributes;
-            requestedAttributes.set_file_size(attributes.fileSize);
-            requestedAttributes.set_record_size(attributes.recordSize);
-            requestedAttributes.set_record_count(attributes.recordCount);
-            *response->mutable_file_attributes() = requestedAttributes;
-        } else {
-            std::string payload = "";
-            requestedRecord.set_sw1(0);
-            requestedRecord.set_sw2(0);
-            requestedRecord.set_pay_load(payload);
-            for(auto &it : result.data) {
-                requestedRecord.add_data(it);
-            }
-            *response->mutable_result() = requestedRecord;
-            telStub::FileAttributes requestedAttributes;
-            requestedAttributes.set_file_size(0);
-            requestedAttributes.set_record_size(0);
-            requestedAttributes.set_record_count(0);
-            *response->mutable_file_attributes() = requestedAttributes;
+        if (error != telux::common::ErrorCode::SUCCESS) {
+            result = telux::tel::IccResult();
+            attributes = {};
         }
+        setIccResult(result, response->mutable_result());
+        telStub::FileAttributes *requestedAttributes = response->mutable_file_attributes();
+        requestedAttributes->set_file_size(attributes.fileSize);
+        requestedAttributes->set_record_size(attributes.recordSize);
+        requestedAttributes->set_record_count(attributes.recordCount);
     }
     return readStatus;
 }
 
-commonStub::ErrorCode CardManagerServerImpl::getTransparentFileAttributes(Json::Value rootObj,
-    int& i, uint16_t fileId, telux::tel::FileAttributes& attributes, int& index) {
-    int size = rootObj["ICardManager"]["EFs"]["ADF"][index]["TransparentEFFiles"].size();
-    LOG(DEBUG, __FUNCTION__,"TransparentEFfiles size ", size);
-    commonStub::ErrorCode error = commonStub::ErrorCode::ERROR_CODE_SUCCESS;
-    while (i < size ) {
-        uint16_t tmpfileId = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-            ["TransparentEFFiles"][i]["fileId"].asInt();
-        if (tmpfileId == fileId) {
-            std::string data = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                ["TransparentEFFiles"][i]["data"].asString();
-            std::vector<int> tmp = CommonUtils::convertStringToVector(data);
-            attributes.recordSize = tmp.size();
-            attributes.fileSize = attributes.recordSize;
-            break;
-        } else {
-            LOG(DEBUG, __FUNCTION__,"FileId not found ");
-            i++;
-        }
-    }
-    if(i == size) {
-        LOG(DEBUG, __FUNCTION__,"FileId not found ", i );
-        error = commonStub::ErrorCode::GENERIC_FAILURE;
-    }
-return error;
-}
-
-commonStub::ErrorCode CardManagerServerImpl::getLinearfixedFileAttributes(Json::Value rootObj,
-    int& i, uint16_t fileId, telux::tel::FileAttributes& attributes, int& index ) {
-    int size = rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"].size();
-    LOG(DEBUG, __FUNCTION__,"LinearFixedEFfiles size ", size);
-    commonStub::ErrorCode error = commonStub::ErrorCode::ERROR_CODE_SUCCESS;
-    while (i < size ) {
-        uint16_t tmpfileId = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-            ["LinearFixedEFFiles"][i]["fileId"].asInt();
-        if (tmpfileId == fileId) {
-            attributes.recordCount = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                ["LinearFixedEFFiles"][i]["numberOfRecords"].asInt(); //
-            std::string data = rootObj["ICardManager"]["EFs"]["ADF"][index]\
-                ["LinearFixedEFFiles"][i+1]["data"].asString();
-            std::vector<int> tmp = CommonUtils::convertStringToVector(data);
-            attributes.recordSize = tmp.size();
-            attributes.fileSize = (attributes.recordCount)*(attributes.recordSize);
-            error = commonStub::ErrorCode::ERROR_CODE_SUCCESS;
-            break;
-        } else {
-            LOG(DEBUG, __FUNCTION__,"FileId not found ", i );
-            int num = rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"]\
-                [i]["numberOfRecords"].asInt();
-            i = i + num + 1;
-            LOG(DEBUG, __FUNCTION__,"Incremented value is ", i );
-        }
-    }
-    if(i == size) {
-        LOG(DEBUG, __FUNCTION__,"FileId not found ", i );
-        error = commonStub::ErrorCode::GENERIC_FAILURE;
-    }
-    return error;
-}
-
-grpc::Status CardManagerServerImpl::OpenLogicalChannel(ServerContext* context,
+grpc::Status CardManagerServerImpl::OpenLogicalChannel(
     const ::telStub::OpenLogicalChannelRequest* request,
     telStub::OpenLogicalChannelReply* response) {
-
     LOG(DEBUG, __FUNCTION__);
-    int phoneid = request->phone_id();
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    std::string jsonObjApiResponseFileName = "";
+    int phoneId = request->phone_id();
+    std::string apiname = "openLogicalChannel";
     Json::Value jsonObjApiResponse;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(phoneid, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(phoneid, jsonObjApiResponseFileName, jsonObjApiResponse);
-        telux::common::ErrorCode error;
-        telux::common::Status status;
-        int cbDelay;
+    telux::common::Status status;
+    telux::common::ErrorCode error;
+    int cbDelay;
+    grpc::Status readStatus = getApiResponse(phoneId, apiname, jsonObjApiResponse, status, error,
+        cbDelay);
+    if (readStatus.ok()) {
         telux::tel::IccResult result;
-        int channelId;
-
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", "openLogicalChannel", status,
-            error, cbDelay );
-
-        if(status == telux::common::Status::SUCCESS) {
-            bool isChannelOpen = rootObj["ICardManager"]["openLogicalChannel"]["isOpen"].asBool();
-            if (isChannelOpen) {
-                LOG(DEBUG, __FUNCTION__, "already open");
-                error = telux::common::ErrorCode::GENERIC_FAILURE;
-            } else {
-                rootObj["ICardManager"]["openLogicalChannel"]["isOpen"] = true;
-                JsonParser::writeToJsonFile(rootObj, jsonfilename);
-                jsonObjSystemStateSlot_[phoneid] = rootObj;
-                result.sw1 = rootObj["ICardManager"]["transmitApduLogicalChannel"]\
-                    ["onChannelResponseSw1"].asInt();
-                LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw1);
-                result.sw2 = rootObj["ICardManager"]["transmitApduLogicalChannel"]\
-                    ["onChannelResponseSw2"].asInt();
-                LOG(DEBUG, __FUNCTION__,"sw1 ", result.sw2);
-                result.payload = rootObj["ICardManager"]["transmitApduLogicalChannel"]\
-                    ["onChannelResponsePayload"].asString();
-                LOG(DEBUG, __FUNCTION__,"payload ", result.payload);
-                std::string tmp = rootObj["ICardManager"]["transmitApduLogicalChannel"]\
-                    ["onChannelResponseData"].asString();
-                std::vector<int> data = CommonUtils::convertStringToVector(tmp);
-                result.data = data;
-                channelId = rootObj["ICardManager"]["openLogicalChannel"]\
-                    ["onChannelResponseChannel"].asInt();
-                LOG(DEBUG, __FUNCTION__,"channelId ", channelId);
-            }
+        int channelId = 0;
+        if (status == telux::common::Status::SUCCESS) {
+            error = uiccModel_->openLogicalChannel(phoneId, channelId, result);
+            LOG(DEBUG, __FUNCTION__, "channelId ", channelId);
         }
-        //Create response
+        // Create response
         response->set_error(static_cast<commonStub::ErrorCode>(error));
         response->set_status(static_cast<commonStub::Status>(status));
         response->set_delay(cbDelay);
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, "openLogicalChannel");
-        response->set_iscallback(iscallback);
-        telStub::IccResult requestedRecord;
-        requestedRecord.set_sw1(result.sw1);
-        requestedRecord.set_sw2(result.sw2);
-        requestedRecord.set_pay_load(result.payload);
-        for(auto &it : result.data) {
-            requestedRecord.add_data(it);
-        }
-        *response->mutable_result() = requestedRecord;
+        response->set_iscallback(isCallbackNeeded(jsonObjApiResponse, apiname));
+        setIccResult(result, response->mutable_result());
         response->set_channel_id(channelId);
     }
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::CloseLogicalChannel(ServerContext* context,
+grpc::Status CardManagerServerImpl::CloseLogicalChannel(
     const ::telStub::CloseLogicalChannelRequest* request,
     telStub::CloseLogicalChannelReply* response) {
-
+    LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    std::string jsonObjApiResponseFileName = "";
+    std::string apiname = "closeLogicalChannel";
     Json::Value jsonObjApiResponse;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(phoneId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        int channel = request->channel_id();
-        telux::common::Status status;
-        telux::common::ErrorCode error;
-        int cbDelay;
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", "closeLogicalChannel", status,
-            error, cbDelay );
-
-        if(status == telux::common::Status::SUCCESS) {
-            int inputchannel = rootObj["ICardManager"]["openLogicalChannel"]\
-                ["onChannelResponseChannel"].asInt();
-            if (inputchannel == channel) {
-                bool isChannelOpen = rootObj["ICardManager"]["openLogicalChannel"]\
-                    ["isOpen"].asBool();
-                if (isChannelOpen) {
-                    rootObj["ICardManager"]["openLogicalChannel"]["isOpen"] = false;
-                    JsonParser::writeToJsonFile(rootObj, jsonfilename);
-                    jsonObjSystemStateSlot_[phoneId] = rootObj;
-                } else {
-                    LOG(DEBUG, __FUNCTION__, "already closed");
-                    error = telux::common::ErrorCode::GENERIC_FAILURE;
-                }
-            } else {
-                LOG(DEBUG, __FUNCTION__, "Invalid channel");
-                error = telux::common::ErrorCode::GENERIC_FAILURE;
-            }
+    telux::common::Status status;
+    telux::common::ErrorCode error;
+    int cbDelay;
+    grpc::Status readStatus = getApiResponse(phoneId, apiname, jsonObjApiResponse, status, error,
+        cbDelay);
+    if (readStatus.ok()) {
+        if (status == telux::common::Status::SUCCESS) {
+            error = uiccModel_->closeLogicalChannel(phoneId, request->channel_id());
         }
         response->set_error(static_cast<commonStub::ErrorCode>(error));
         response->set_status(static_cast<commonStub::Status>(status));
         response->set_delay(cbDelay);
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, "closeLogicalChannel");
-        response->set_iscallback(iscallback);
+        response->set_iscallback(isCallbackNeeded(jsonObjApiResponse, apiname));
     }
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::TransmitAPDU(ServerContext* context,
-    const ::telStub::TransmitAPDURequest* request,
-    telStub::TransmitAPDUReply* response) {
-
+template <typename T, typename R>
+grpc::Status CardManagerServerImpl::transmit(const T* request, R* response,
+    const std::string &apiname, telux::tel::UiccModel::ApduChannel channel) {
     int phoneId = request->phone_id();
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    std::string jsonObjApiResponseFileName = "";
     Json::Value jsonObjApiResponse;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(phoneId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        std::vector<uint8_t> data;
-        telux::common::Status status;
-        telux::common::ErrorCode error;
-        int cbDelay;
-        for(int d : request->data()) {
-            data.emplace_back(d);
-        }
-        std::string str1 = "";
+    telux::common::Status status;
+    telux::common::ErrorCode error;
+    int cbDelay;
+    grpc::Status readStatus = getApiResponse(phoneId, apiname, jsonObjApiResponse, status, error,
+        cbDelay);
+    if (readStatus.ok()) {
         telux::tel::IccResult result;
-        CommonUtils::getValues
-            (jsonObjApiResponse,"ICardManager", "transmitApduLogicalChannel", status,
-            error, cbDelay );
-
-        if(status == telux::common::Status::SUCCESS) {
-            str1 = CommonUtils::convertVectorToString(data, false);
-            rootObj["ICardManager"]["transmitApduLogicalChannel"]["onChannelResponseData"] = str1;
-            LOG(DEBUG, __FUNCTION__,"String is  ", str1);
-            JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
-            str1 = CommonUtils::convertVectorToString(data, true);
-            rootObj["ICardManager"]["transmitApduLogicalChannel"]["onChannelResponsePayload"]
-                = str1;
-            JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
-
-            result.sw1 = rootObj["ICardManager"]["transmitApduLogicalChannel"]\
-                ["onChannelResponseSw1"].asInt();
-            result.sw2 = rootObj["ICardManager"]["transmitApduLogicalChannel"]\
-                ["onChannelResponseSw2"].asInt();
-            result.payload = rootObj["ICardManager"]["transmitApduLogicalChannel"]\
-                ["onChannelResponsePayload"].asString();
-            std::string tmp = rootObj["ICardManager"]["transmitApduLogicalChannel"]\
-                ["onChannelResponseData"].asString();
-            result.data = CommonUtils::convertStringToVector(tmp);
+        if (status == telux::common::Status::SUCCESS) {
+            error = uiccModel_->transmit(phoneId, channel, getRequestData(request->data()),
+                result);
         }
-
-        //Create response
-
-        telStub::IccResult requestedRecord;
+        // Create response
         response->set_error(static_cast<commonStub::ErrorCode>(error));
         response->set_status(static_cast<commonStub::Status>(status));
         response->set_delay(cbDelay);
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, "transmitApduLogicalChannel");
-        response->set_iscallback(iscallback);
-        requestedRecord.set_sw1(result.sw1);
-        requestedRecord.set_sw2(result.sw2);
-        requestedRecord.set_pay_load(result.payload);
-        for(auto &it : result.data) {
-            requestedRecord.add_data(it);
-        }
-        *response->mutable_result() = requestedRecord;
+        response->set_iscallback(isCallbackNeeded(jsonObjApiResponse, apiname));
+        setIccResult(result, response->mutable_result());
     }
     return readStatus;
+}
 
+grpc::Status CardManagerServerImpl::TransmitAPDU(const ::telStub::TransmitAPDURequest* request,
+    telStub::TransmitAPDUReply* response) {
+    LOG(DEBUG, __FUNCTION__);
+    return transmit(request, response, "transmitApduLogicalChannel",
+        telux::tel::UiccModel::ApduChannel::LOGICAL);
 }
 
-grpc::Status CardManagerServerImpl::exchangeSimIO(ServerContext* context,
-    const ::telStub::exchangeSimIORequest* request,
+grpc::Status CardManagerServerImpl::exchangeSimIO(const ::telStub::exchangeSimIORequest* request,
     telStub::exchangeSimIOReply* response) {
-
-    int phoneId = request->phone_id();
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    std::string jsonObjApiResponseFileName = "";
-    Json::Value jsonObjApiResponse;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(phoneId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        std::vector<uint8_t> data;
-        for(int d : request->data()) {
-            data.emplace_back(d);
-        }
-        std::string str1 = "";
-        telux::common::Status status;
-        telux::common::ErrorCode error;
-        int cbDelay;
-        std::string apiname = "exchangeSimIO";
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", apiname, status,
-            error, cbDelay );
-        telux::tel::IccResult result;
-
-        if(status == telux::common::Status::SUCCESS) {
-            str1 = CommonUtils::convertVectorToString(data, false);
-            rootObj["ICardManager"]["exchangeSimIO"]["onChannelResponseData"] = str1;
-            LOG(DEBUG, __FUNCTION__,"String is  ", str1);
-            JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
-
-            str1 = CommonUtils::convertVectorToString(data, true);
-            rootObj["ICardManager"]["exchangeSimIO"]["onChannelResponsePayload"] = str1;
-            JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
-            result.sw1 = rootObj["ICardManager"]["exchangeSimIO"]\
-                ["onChannelResponseSw1"].asInt();
-            result.sw2 = rootObj["ICardManager"]["exchangeSimIO"]\
-                ["onChannelResponseSw2"].asInt();
-            result.payload = rootObj["ICardManager"]["exchangeSimIO"]\
-                ["onChannelResponsePayload"].asString();
-            std::string tmp = rootObj["ICardManager"]["exchangeSimIO"]\
-                ["onChannelResponseData"].asString();
-            result.data = CommonUtils::convertStringToVector(tmp);
-        }
-
-        //Create response
-        telStub::IccResult requestedRecord;
-        response->set_error(static_cast<commonStub::ErrorCode>(error));
-        response->set_status(static_cast<commonStub::Status>(status));
-        response->set_delay(cbDelay);
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, apiname);
-        response->set_iscallback(iscallback);
-        requestedRecord.set_sw1(result.sw1);
-        requestedRecord.set_sw2(result.sw2);
-        requestedRecord.set_pay_load(result.payload);
-        for(auto &it : result.data) {
-            requestedRecord.add_data(it);
-        }
-        *response->mutable_result() = requestedRecord;
-    }
-    return readStatus;
+    LOG(DEBUG, __FUNCTION__);
+    return transmit(request, response, "exchangeSimIO",
+        telux::tel::UiccModel::ApduChannel::SIM_IO);
 }
 
-grpc::Status CardManagerServerImpl::TransmitBasicAPDU(ServerContext* context,
-    const ::telStub::TransmitBasicAPDURequest* request,
-    telStub::TransmitBasicAPDUReply* response) {
-
-    int phoneId = request->phone_id();
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    std::string jsonObjApiResponseFileName = "";
-    Json::Value jsonObjApiResponse;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
-        getJsonForApiResponseSlot(phoneId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        std::vector<uint8_t> data;
-        for(int d : request->data()) {
-            data.emplace_back(d);
-        }
-        std::string str1 = "";
-        telux::common::Status status;
-        telux::common::ErrorCode error;
-        int cbDelay;
-        telux::tel::IccResult result;
-        std::string apiname = "transmitApduBasicChannel";
-        CommonUtils::getValues(jsonObjApiResponse,"ICardManager", apiname, status,
-            error, cbDelay );
-
-        if(status == telux::common::Status::SUCCESS) {
-            str1 = CommonUtils::convertVectorToString(data, false);
-            rootObj["ICardManager"]["transmitApduBasicChannel"]["onChannelResponseData"] = str1;
-            LOG(DEBUG, __FUNCTION__,"String is  ", str1);
-            JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
-
-            str1 = CommonUtils::convertVectorToString(data, true);
-            rootObj["ICardManager"]["transmitApduBasicChannel"]["onChannelResponsePayload"] = str1;
-            JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
-            result.sw1 = rootObj["ICardManager"]["transmitApduBasicChannel"]\
-                ["onChannelResponseSw1"].asInt();
-            result.sw2 = rootObj["ICardManager"]["transmitApduBasicChannel"]\
-                ["onChannelResponseSw2"].asInt();
-            result.payload = rootObj["ICardManager"]["transmitApduBasicChannel"]\
-                ["onChannelResponsePayload"].asString();
-            std::string tmp = rootObj["ICardManager"]["transmitApduBasicChannel"]\
-                ["onChannelResponseData"].asString();
-            result.data = CommonUtils::convertStringToVector(tmp);
-        }
-
-        //Create response
-        telStub::IccResult requestedRecord;
-        bool iscallback = isCallbackNeeded(jsonObjApiResponse, apiname);
-        response->set_error(static_cast<commonStub::ErrorCode>(error));
-        response->set_status(static_cast<commonStub::Status>(status));
-        response->set_delay(cbDelay);
-        response->set_iscallback(iscallback);
-        requestedRecord.set_sw1(result.sw1);
-        requestedRecord.set_sw2(result.sw2);
-        requestedRecord.set_pay_load(result.payload);
-        for(auto &it : result.data) {
-            requestedRecord.add_data(it);
-        }
-        *response->mutable_result() = requestedRecord;
-    }
-    return readStatus;
-
+grpc::Status CardManagerServerImpl::TransmitBasicAPDU(
+    const ::telStub::TransmitBasicAPDURequest* request, telStub::TransmitBasicAPDUReply* response) {
+    LOG(DEBUG, __FUNCTION__);
+    return transmit(request, response, "transmitApduBasicChannel",
+        telux::tel::UiccModel::ApduChannel::BASIC);
 }
 
-grpc::Status CardManagerServerImpl::requestEid(ServerContext* context,
-    const ::telStub::requestEidRequest* request,
+grpc::Status CardManagerServerImpl::requestEid(const ::telStub::requestEidRequest* request,
     telStub::requestEidReply* response) {
 
     int phoneId = request->phone_id();
@@ -1395,9 +594,8 @@ grpc::Status CardManagerServerImpl::requestEid(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::updateSimStatus(ServerContext* context,
-    const ::telStub::updateSimStatusRequest* request,
-    telStub::updateSimStatusReply* response) {
+grpc::Status CardManagerServerImpl::updateSimStatus(
+    const ::telStub::updateSimStatusRequest* request, telStub::updateSimStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
     std::string jsonfilename = "";
@@ -1427,8 +625,8 @@ grpc::Status CardManagerServerImpl::updateSimStatus(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::ChangePinLock(ServerContext* context,
-    const ::telStub::ChangePinLockRequest* request, telStub::ChangePinLockReply* response) {
+grpc::Status CardManagerServerImpl::ChangePinLock(const ::telStub::ChangePinLockRequest* request,
+    telStub::ChangePinLockReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     int phoneId = request->phone_id();
@@ -1546,8 +744,7 @@ grpc::Status CardManagerServerImpl::ChangePinLock(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::UnlockByPin(ServerContext* context,
-    const ::telStub::UnlockByPinRequest* request,
+grpc::Status CardManagerServerImpl::UnlockByPin(const ::telStub::UnlockByPinRequest* request,
     telStub::UnlockByPinReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
@@ -1656,8 +853,7 @@ grpc::Status CardManagerServerImpl::UnlockByPin(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::UnlockByPuk(ServerContext* context,
-    const ::telStub::UnlockByPukRequest* request,
+grpc::Status CardManagerServerImpl::UnlockByPuk(const ::telStub::UnlockByPukRequest* request,
     telStub::UnlockByPukReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
@@ -1778,8 +974,8 @@ grpc::Status CardManagerServerImpl::UnlockByPuk(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::SetCardLock(ServerContext* context,
-    const ::telStub::SetCardLockRequest* request, ::telStub::SetCardLockReply* response) {
+grpc::Status CardManagerServerImpl::SetCardLock(const ::telStub::SetCardLockRequest* request,
+    ::telStub::SetCardLockReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
     std::string jsonfilename = "";
@@ -1894,8 +1090,8 @@ grpc::Status CardManagerServerImpl::SetCardLock(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::QueryPin1Lock(ServerContext* context,
-    const ::telStub::QueryPin1LockRequest* request, telStub::QueryPin1LockReply* response) {
+grpc::Status CardManagerServerImpl::QueryPin1Lock(const ::telStub::QueryPin1LockRequest* request,
+    telStub::QueryPin1LockReply* response) {
     LOG(DEBUG, __FUNCTION__);
         int phoneId = request->phone_id();
     std::string jsonfilename = "";
@@ -1926,8 +1122,8 @@ grpc::Status CardManagerServerImpl::QueryPin1Lock(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::QueryFdnLock(ServerContext* context,
-    const ::telStub::QueryFdnLockRequest* request, ::telStub::QueryFdnLockReply* response) {
+grpc::Status CardManagerServerImpl::QueryFdnLock(const ::telStub::QueryFdnLockRequest* request,
+    ::telStub::QueryFdnLockReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
     std::string jsonfilename = "";
@@ -1958,8 +1154,7 @@ grpc::Status CardManagerServerImpl::QueryFdnLock(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status CardManagerServerImpl::CardPower(ServerContext* context,
-    const ::telStub::CardPowerRequest* request,
+grpc::Status CardManagerServerImpl::CardPower(const ::telStub::CardPowerRequest* request,
     telStub::CardPowerResponse* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
@@ -2014,40 +1209,7 @@ grpc::Status CardManagerServerImpl::CardPower(ServerContext* context,
     return readStatus;
 }
 
-commonStub::ErrorCode CardManagerServerImpl::findmatchingrecordDF (Json::Value rootObj, int& size,
-    int& recordNum, uint16_t& fileId, int& i) {
-    commonStub::ErrorCode error = commonStub::ErrorCode::ERROR_CODE_SUCCESS;
-    while (i < size ) {
-        uint16_t tmpfileId = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"]\
-            [i]["fileId"].asInt();
-        if (tmpfileId == fileId) {
-            int num = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"][i]\
-                ["numberOfRecords"].asInt();
-            LOG(DEBUG, __FUNCTION__,"NumberOfRecords ", num);
-            if(recordNum <= num ) {
-                error = commonStub::ErrorCode::ERROR_CODE_SUCCESS;
-                break;
-            } else {
-                error = commonStub::ErrorCode::GENERIC_FAILURE;
-                LOG(DEBUG, __FUNCTION__, "Invalid Record");
-                break;
-            }
-        } else {
-            LOG(DEBUG, __FUNCTION__,"FileId not found ", i );
-            int num = rootObj["ICardManager"]["EFs"]["DFLinearFixedEFRecords"][i]\
-                ["numberOfRecords"].asInt();
-            i = i + num + 1;
-            LOG(DEBUG, __FUNCTION__,"Incremented value is ", i );
-        }
-    }
-    if(i == size) {
-        LOG(DEBUG, __FUNCTION__,"Valid record not found ", i );
-        error = commonStub::ErrorCode::GENERIC_FAILURE;
-    }
-    return error;
-}
-
-grpc::Status CardManagerServerImpl::IsNtnProfileActive(ServerContext* context,
+grpc::Status CardManagerServerImpl::IsNtnProfileActive(
     const ::telStub::IsNtnProfileActiveRequest* request,
     telStub::IsNtnProfileActiveReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -2144,6 +1306,12 @@ bool CardManagerServerImpl::handleCardInfoChanged(std::string eventParams,
         }
     }
     LOG(DEBUG, __FUNCTION__, " isNtnProfileActive : ", isNtnProfileActive);
+    // Flush the card updates and reload the state so they aren't overwritten below
+    grpc::Status readStatus = readJson();
+    if (!readStatus.ok()) {
+        LOG(ERROR, __FUNCTION__, " Reading the card state failed");
+        return false;
+    }
     getJsonForSystemData(slotId, jsonfilename, rootObj);
     bool cardpower = static_cast<bool>(input);
     LOG(DEBUG, __FUNCTION__, "The fetched card power state id is: ", cardpower);
@@ -2263,8 +1431,7 @@ bool CardManagerServerImpl::handleSimRefreshInjector(std::string eventParams,
     return true;
 }
 
-::grpc::Status CardManagerServerImpl::setupRefreshConfig(ServerContext* context,
-    const ::telStub::RefreshConfigReq* request,
+::grpc::Status CardManagerServerImpl::setupRefreshConfig(const ::telStub::RefreshConfigReq* request,
     telStub::TelCommonReply* response) {
     if (not request || not response) {
         LOG(ERROR, __FUNCTION__, " not request || not response.");
@@ -2318,9 +1485,8 @@ bool CardManagerServerImpl::handleSimRefreshInjector(std::string eventParams,
     return ::grpc::Status::OK;
 }
 
-::grpc::Status CardManagerServerImpl::allowCardRefresh(ServerContext* context,
-    const ::telStub::AllowCardRefreshReq* request,
-    telStub::TelCommonReply* response) {
+::grpc::Status CardManagerServerImpl::allowCardRefresh(
+    const ::telStub::AllowCardRefreshReq* request, telStub::TelCommonReply* response) {
     if (not request || not response) {
         LOG(ERROR, __FUNCTION__, " not request || not response.");
         return ::grpc::Status::CANCELLED;
@@ -2390,7 +1556,7 @@ bool CardManagerServerImpl::handleSimRefreshInjector(std::string eventParams,
     return ::grpc::Status::OK;
 }
 
-::grpc::Status CardManagerServerImpl::confirmRefreshHandlingCompleted(ServerContext* context,
+::grpc::Status CardManagerServerImpl::confirmRefreshHandlingCompleted(
     const ::telStub::ConfirmRefreshHandlingCompleteReq* request,
     telStub::TelCommonReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -2464,7 +1630,7 @@ bool CardManagerServerImpl::handleSimRefreshInjector(std::string eventParams,
     return ::grpc::Status::OK;
 }
 
-::grpc::Status CardManagerServerImpl::requestLastRefreshEvent(ServerContext* context,
+::grpc::Status CardManagerServerImpl::requestLastRefreshEvent(
     const ::telStub::RequestLastRefreshEventReq* request,
     telStub::RequestLastRefreshEventResp* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -2686,3 +1852,195 @@ void CardManagerServerImpl::getClientInfoFromRpc(const T* rpcMsg, clientSimRefre
         static_cast<uint32_t>(client.sessionAid.sessionType),
         ", aid ", client.sessionAid.aid);
 }
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::InitService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::IsSubsystemReady(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::IsSubsystemReadyReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return IsSubsystemReady(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::GetCardState(grpc::CallbackServerContext* context,
+    const telStub::GetCardStateRequest* request, telStub::GetCardStateReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetCardState(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::ReadEFLinearFixed(
+    grpc::CallbackServerContext* context, const telStub::ReadEFLinearFixedRequest* request,
+    telStub::ReadEFLinearFixedReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ReadEFLinearFixed(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::ReadEFLinearFixedAll(
+    grpc::CallbackServerContext* context, const telStub::ReadEFLinearFixedAllRequest* request,
+    telStub::ReadEFLinearFixedAllReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ReadEFLinearFixedAll(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::ReadEFTransparent(
+    grpc::CallbackServerContext* context, const telStub::ReadEFTransparentRequest* request,
+    telStub::ReadEFTransparentReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ReadEFTransparent(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::WriteEFLinearFixed(
+    grpc::CallbackServerContext* context, const telStub::WriteEFLinearFixedRequest* request,
+    telStub::WriteEFLinearFixedReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return WriteEFLinearFixed(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::WriteEFTransparent(
+    grpc::CallbackServerContext* context, const telStub::WriteEFTransparentRequest* request,
+    telStub::WriteEFTransparentReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return WriteEFTransparent(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::RequestEFAttributes(
+    grpc::CallbackServerContext* context, const telStub::EFAttributesRequest* request,
+    telStub::RequestEFAttributesReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestEFAttributes(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::OpenLogicalChannel(
+    grpc::CallbackServerContext* context, const telStub::OpenLogicalChannelRequest* request,
+    telStub::OpenLogicalChannelReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return OpenLogicalChannel(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::CloseLogicalChannel(
+    grpc::CallbackServerContext* context, const telStub::CloseLogicalChannelRequest* request,
+    telStub::CloseLogicalChannelReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CloseLogicalChannel(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::TransmitAPDU(grpc::CallbackServerContext* context,
+    const telStub::TransmitAPDURequest* request, telStub::TransmitAPDUReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return TransmitAPDU(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::TransmitBasicAPDU(
+    grpc::CallbackServerContext* context, const telStub::TransmitBasicAPDURequest* request,
+    telStub::TransmitBasicAPDUReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return TransmitBasicAPDU(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::exchangeSimIO(grpc::CallbackServerContext* context,
+    const ::telStub::exchangeSimIORequest* request, telStub::exchangeSimIOReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return exchangeSimIO(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::requestEid(grpc::CallbackServerContext* context,
+    const ::telStub::requestEidRequest* request, telStub::requestEidReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return requestEid(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::updateSimStatus(
+    grpc::CallbackServerContext* context, const ::telStub::updateSimStatusRequest* request,
+    telStub::updateSimStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return updateSimStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::SetCardLock(grpc::CallbackServerContext* context,
+    const telStub::SetCardLockRequest* request, telStub::SetCardLockReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetCardLock(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::QueryPin1Lock(grpc::CallbackServerContext* context,
+    const telStub::QueryPin1LockRequest* request, telStub::QueryPin1LockReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return QueryPin1Lock(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::ChangePinLock(grpc::CallbackServerContext* context,
+    const telStub::ChangePinLockRequest* request, telStub::ChangePinLockReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ChangePinLock(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::UnlockByPin(grpc::CallbackServerContext* context,
+    const telStub::UnlockByPinRequest* request, telStub::UnlockByPinReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return UnlockByPin(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::UnlockByPuk(grpc::CallbackServerContext* context,
+    const telStub::UnlockByPukRequest* request, telStub::UnlockByPukReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return UnlockByPuk(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::QueryFdnLock(grpc::CallbackServerContext* context,
+    const telStub::QueryFdnLockRequest* request, telStub::QueryFdnLockReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return QueryFdnLock(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::CardPower(grpc::CallbackServerContext* context,
+    const ::telStub::CardPowerRequest* request, telStub::CardPowerResponse* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CardPower(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::IsNtnProfileActive(
+    grpc::CallbackServerContext* context, const ::telStub::IsNtnProfileActiveRequest* request,
+    telStub::IsNtnProfileActiveReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return IsNtnProfileActive(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::setupRefreshConfig(
+    grpc::CallbackServerContext* context, const ::telStub::RefreshConfigReq* request,
+    telStub::TelCommonReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return setupRefreshConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::allowCardRefresh(
+    grpc::CallbackServerContext* context, const ::telStub::AllowCardRefreshReq* request,
+    telStub::TelCommonReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return allowCardRefresh(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::confirmRefreshHandlingCompleted(
+    grpc::CallbackServerContext* context,
+    const ::telStub::ConfirmRefreshHandlingCompleteReq* request,
+    telStub::TelCommonReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return confirmRefreshHandlingCompleted(request, response); });
+}
+
+grpc::ServerUnaryReactor* CardManagerServerImpl::requestLastRefreshEvent(
+    grpc::CallbackServerContext* context, const ::telStub::RequestLastRefreshEventReq* request,
+    telStub::RequestLastRefreshEventResp* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return requestLastRefreshEvent(request, response); });
+}
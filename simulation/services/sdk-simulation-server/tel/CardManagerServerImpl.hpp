@@ -30,6 +30,7 @@
 #include "libs/common/CommonUtils.hpp"
 #include "event/ServerEventManager.hpp"
 #include "event/EventService.hpp"
+#include "UiccModel.hpp"
 
 using grpc::Server;
 using grpc::ServerBuilder;
@@ -60,125 +61,153 @@ struct RefreshEventAndPending {
     uint32_t pendingComplete;
 };
 
-class CardManagerServerImpl final : public telStub::CardService::Service,
+class CardManagerServerImpl final : public telStub::CardService::CallbackService,
                                     public IServerEventListener,
                                     public std::enable_shared_from_this<CardManagerServerImpl> {
  public:
     CardManagerServerImpl();
     ~CardManagerServerImpl();
-    grpc::Status InitService(ServerContext *context, const google::protobuf::Empty *request,
-        commonStub::GetServiceStatusReply* response) override ;
-    grpc::Status GetServiceStatus(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status IsSubsystemReady(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* IsSubsystemReady(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::IsSubsystemReadyReply* response) override;
-    grpc::Status GetCardState(ServerContext *context, const telStub::GetCardStateRequest *request,
-        telStub::GetCardStateReply *reply) override;
-    grpc::Status ReadEFLinearFixed(ServerContext* context,
+    grpc::ServerUnaryReactor* GetCardState(grpc::CallbackServerContext* context,
+        const telStub::GetCardStateRequest* request, telStub::GetCardStateReply* response) override;
+    grpc::ServerUnaryReactor* ReadEFLinearFixed(grpc::CallbackServerContext* context,
         const telStub::ReadEFLinearFixedRequest* request,
         telStub::ReadEFLinearFixedReply* response) override;
-    grpc::Status ReadEFLinearFixedAll(ServerContext* context,
-        const telStub::ReadEFLinearFixedAllRequest*
-        request, telStub::ReadEFLinearFixedAllReply* response) override;
-    grpc::Status ReadEFTransparent(ServerContext* context,
-        const telStub::ReadEFTransparentRequest*
-        request, telStub::ReadEFTransparentReply* response) override;
-    grpc::Status WriteEFLinearFixed(ServerContext* context,
-        const telStub::WriteEFLinearFixedRequest*
-        request, telStub::WriteEFLinearFixedReply* response) override;
-    grpc::Status WriteEFTransparent(ServerContext* context,
-        const telStub::WriteEFTransparentRequest*
-        request, telStub::WriteEFTransparentReply* response) override;
-    grpc::Status RequestEFAttributes(ServerContext* context,
-        const telStub::EFAttributesRequest*
-        request, telStub::RequestEFAttributesReply* response) override;
-    grpc::Status OpenLogicalChannel(ServerContext* context,
-        const telStub::OpenLogicalChannelRequest*
-        request, telStub::OpenLogicalChannelReply* response) override;
-    grpc::Status CloseLogicalChannel(ServerContext* context,
-        const telStub::CloseLogicalChannelRequest*
-        request, telStub::CloseLogicalChannelReply* response) override;
-    grpc::Status TransmitAPDU(ServerContext* context,
-        const telStub::TransmitAPDURequest* request,
-        telStub::TransmitAPDUReply* response) override;
-    grpc::Status TransmitBasicAPDU(ServerContext* context,
+    grpc::ServerUnaryReactor* ReadEFLinearFixedAll(grpc::CallbackServerContext* context,
+        const telStub::ReadEFLinearFixedAllRequest* request,
+        telStub::ReadEFLinearFixedAllReply* response) override;
+    grpc::ServerUnaryReactor* ReadEFTransparent(grpc::CallbackServerContext* context,
+        const telStub::ReadEFTransparentRequest* request,
+        telStub::ReadEFTransparentReply* response) override;
+    grpc::ServerUnaryReactor* WriteEFLinearFixed(grpc::CallbackServerContext* context,
+        const telStub::WriteEFLinearFixedRequest* request,
+        telStub::WriteEFLinearFixedReply* response) override;
+    grpc::ServerUnaryReactor* WriteEFTransparent(grpc::CallbackServerContext* context,
+        const telStub::WriteEFTransparentRequest* request,
+        telStub::WriteEFTransparentReply* response) override;
+    grpc::ServerUnaryReactor* RequestEFAttributes(grpc::CallbackServerContext* context,
+        const telStub::EFAttributesRequest* request,
+        telStub::RequestEFAttributesReply* response) override;
+    grpc::ServerUnaryReactor* OpenLogicalChannel(grpc::CallbackServerContext* context,
+        const telStub::OpenLogicalChannelRequest* request,
+        telStub::OpenLogicalChannelReply* response) override;
+    grpc::ServerUnaryReactor* CloseLogicalChannel(grpc::CallbackServerContext* context,
+        const telStub::CloseLogicalChannelRequest* request,
+        telStub::CloseLogicalChannelReply* response) override;
+    grpc::ServerUnaryReactor* TransmitAPDU(grpc::CallbackServerContext* context,
+        const telStub::TransmitAPDURequest* request, telStub::TransmitAPDUReply* response) override;
+    grpc::ServerUnaryReactor* TransmitBasicAPDU(grpc::CallbackServerContext* context,
         const telStub::TransmitBasicAPDURequest* request,
         telStub::TransmitBasicAPDUReply* response) override;
-    grpc::Status exchangeSimIO(ServerContext* context,
+    grpc::ServerUnaryReactor* exchangeSimIO(grpc::CallbackServerContext* context,
         const ::telStub::exchangeSimIORequest* request,
         telStub::exchangeSimIOReply* response) override;
-    grpc::Status requestEid(ServerContext* context,
-        const ::telStub::requestEidRequest* request,
-        telStub::requestEidReply* response) override;
-    grpc::Status updateSimStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* requestEid(grpc::CallbackServerContext* context,
+        const ::telStub::requestEidRequest* request, telStub::requestEidReply* response) override;
+    grpc::ServerUnaryReactor* updateSimStatus(grpc::CallbackServerContext* context,
         const ::telStub::updateSimStatusRequest* request,
         telStub::updateSimStatusReply* response) override;
-    grpc::Status SetCardLock(ServerContext* context, const telStub::SetCardLockRequest* request,
-        telStub::SetCardLockReply* response) override;
-    grpc::Status QueryPin1Lock(ServerContext* context,
+    grpc::ServerUnaryReactor* SetCardLock(grpc::CallbackServerContext* context,
+        const telStub::SetCardLockRequest* request, telStub::SetCardLockReply* response) override;
+    grpc::ServerUnaryReactor* QueryPin1Lock(grpc::CallbackServerContext* context,
         const telStub::QueryPin1LockRequest* request,
         telStub::QueryPin1LockReply* response) override;
-    grpc::Status ChangePinLock(ServerContext* context,
+    grpc::ServerUnaryReactor* ChangePinLock(grpc::CallbackServerContext* context,
         const telStub::ChangePinLockRequest* request,
         telStub::ChangePinLockReply* response) override;
-    grpc::Status UnlockByPin(ServerContext* context, const telStub::UnlockByPinRequest* request,
-        telStub::UnlockByPinReply* response) override;
-    grpc::Status UnlockByPuk(ServerContext* context, const telStub::UnlockByPukRequest* request,
-        telStub::UnlockByPukReply* response) override;
-    grpc::Status QueryFdnLock(ServerContext* context, const telStub::QueryFdnLockRequest* request,
-        telStub::QueryFdnLockReply* response) override;
-    grpc::Status CardPower(ServerContext* context, const ::telStub::CardPowerRequest* request,
-        telStub::CardPowerResponse* response) override;
-    grpc::Status IsNtnProfileActive(ServerContext* context,
+    grpc::ServerUnaryReactor* UnlockByPin(grpc::CallbackServerContext* context,
+        const telStub::UnlockByPinRequest* request, telStub::UnlockByPinReply* response) override;
+    grpc::ServerUnaryReactor* UnlockByPuk(grpc::CallbackServerContext* context,
+        const telStub::UnlockByPukRequest* request, telStub::UnlockByPukReply* response) override;
+    grpc::ServerUnaryReactor* QueryFdnLock(grpc::CallbackServerContext* context,
+        const telStub::QueryFdnLockRequest* request, telStub::QueryFdnLockReply* response) override;
+    grpc::ServerUnaryReactor* CardPower(grpc::CallbackServerContext* context,
+        const ::telStub::CardPowerRequest* request, telStub::CardPowerResponse* response) override;
+    grpc::ServerUnaryReactor* IsNtnProfileActive(grpc::CallbackServerContext* context,
         const ::telStub::IsNtnProfileActiveRequest* request,
         telStub::IsNtnProfileActiveReply* response) override;
+    grpc::ServerUnaryReactor* setupRefreshConfig(grpc::CallbackServerContext* context,
+        const ::telStub::RefreshConfigReq* request, telStub::TelCommonReply* response) override;
+    grpc::ServerUnaryReactor* allowCardRefresh(grpc::CallbackServerContext* context,
+        const ::telStub::AllowCardRefreshReq* request, telStub::TelCommonReply* response) override;
+    grpc::ServerUnaryReactor* confirmRefreshHandlingCompleted(grpc::CallbackServerContext* context,
+        const ::telStub::ConfirmRefreshHandlingCompleteReq* request,
+        telStub::TelCommonReply* response) override;
+    grpc::ServerUnaryReactor* requestLastRefreshEvent(grpc::CallbackServerContext* context,
+        const ::telStub::RequestLastRefreshEventReq* request,
+        telStub::RequestLastRefreshEventResp* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent event) override;
 
-    ::grpc::Status setupRefreshConfig(ServerContext* context,
-        const ::telStub::RefreshConfigReq* request, telStub::TelCommonReply* response);
-    ::grpc::Status allowCardRefresh(ServerContext* context,
-        const ::telStub::AllowCardRefreshReq* request, telStub::TelCommonReply* response);
-    ::grpc::Status confirmRefreshHandlingCompleted(ServerContext* context,
+ private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status IsSubsystemReady(const google::protobuf::Empty* request,
+        commonStub::IsSubsystemReadyReply* response);
+    grpc::Status GetCardState(const telStub::GetCardStateRequest* request,
+        telStub::GetCardStateReply* reply);
+    grpc::Status ReadEFLinearFixed(const telStub::ReadEFLinearFixedRequest* request,
+        telStub::ReadEFLinearFixedReply* response);
+    grpc::Status ReadEFLinearFixedAll(const telStub::ReadEFLinearFixedAllRequest* request,
+        telStub::ReadEFLinearFixedAllReply* response);
+    grpc::Status ReadEFTransparent(const telStub::ReadEFTransparentRequest* request,
+        telStub::ReadEFTransparentReply* response);
+    grpc::Status WriteEFLinearFixed(const telStub::WriteEFLinearFixedRequest* request,
+        telStub::WriteEFLinearFixedReply* response);
+    grpc::Status WriteEFTransparent(const telStub::WriteEFTransparentRequest* request,
+        telStub::WriteEFTransparentReply* response);
+    grpc::Status RequestEFAttributes(const telStub::EFAttributesRequest* request,
+        telStub::RequestEFAttributesReply* response);
+    grpc::Status OpenLogicalChannel(const telStub::OpenLogicalChannelRequest* request,
+        telStub::OpenLogicalChannelReply* response);
+    grpc::Status CloseLogicalChannel(const telStub::CloseLogicalChannelRequest* request,
+        telStub::CloseLogicalChannelReply* response);
+    grpc::Status TransmitAPDU(const telStub::TransmitAPDURequest* request,
+        telStub::TransmitAPDUReply* response);
+    grpc::Status TransmitBasicAPDU(const telStub::TransmitBasicAPDURequest* request,
+        telStub::TransmitBasicAPDUReply* response);
+    grpc::Status exchangeSimIO(const ::telStub::exchangeSimIORequest* request,
+        telStub::exchangeSimIOReply* response);
+    grpc::Status requestEid(const ::telStub::requestEidRequest* request,
+        telStub::requestEidReply* response);
+    grpc::Status updateSimStatus(const ::telStub::updateSimStatusRequest* request,
+        telStub::updateSimStatusReply* response);
+    grpc::Status SetCardLock(const telStub::SetCardLockRequest* request,
+        telStub::SetCardLockReply* response);
+    grpc::Status QueryPin1Lock(const telStub::QueryPin1LockRequest* request,
+        telStub::QueryPin1LockReply* response);
+    grpc::Status ChangePinLock(const telStub::ChangePinLockRequest* request,
+        telStub::ChangePinLockReply* response);
+    grpc::Status UnlockByPin(const telStub::UnlockByPinRequest* request,
+        telStub::UnlockByPinReply* response);
+    grpc::Status UnlockByPuk(const telStub::UnlockByPukRequest* request,
+        telStub::UnlockByPukReply* response);
+    grpc::Status QueryFdnLock(const telStub::QueryFdnLockRequest* request,
+        telStub::QueryFdnLockReply* response);
+    grpc::Status CardPower(const ::telStub::CardPowerRequest* request,
+        telStub::CardPowerResponse* response);
+    grpc::Status IsNtnProfileActive(const ::telStub::IsNtnProfileActiveRequest* request,
+        telStub::IsNtnProfileActiveReply* response);
+    ::grpc::Status setupRefreshConfig(const ::telStub::RefreshConfigReq* request,
+        telStub::TelCommonReply* response);
+    ::grpc::Status allowCardRefresh(const ::telStub::AllowCardRefreshReq* request,
+        telStub::TelCommonReply* response);
+    ::grpc::Status confirmRefreshHandlingCompleted(
         const ::telStub::ConfirmRefreshHandlingCompleteReq* request,
         telStub::TelCommonReply* response);
-    ::grpc::Status requestLastRefreshEvent(ServerContext* context,
-        const ::telStub::RequestLastRefreshEventReq* request,
+    ::grpc::Status requestLastRefreshEvent(const ::telStub::RequestLastRefreshEventReq* request,
         telStub::RequestLastRefreshEventResp* response);
 
-    template <typename T>
-    commonStub::ErrorCode findmatchingrecordADF (Json::Value rootObj, T response,
-    int& size, int& index, int& recordNum, uint16_t& fileId, int& i) {
-        commonStub::ErrorCode error = commonStub::ErrorCode::ERROR_CODE_SUCCESS;
-        while (i < size ) {
-        uint16_t tmpfileId = rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"]\
-            [i]["fileId"].asInt();
-        if (tmpfileId == fileId) {
-            int num = rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"][i]\
-                ["numberOfRecords"].asInt();
-            LOG(DEBUG, __FUNCTION__,"NumberOfRecords ", num);
-            if(recordNum <= num ) {
-                error = commonStub::ErrorCode::ERROR_CODE_SUCCESS;
-                break;
-            } else {
-                error = commonStub::ErrorCode::GENERIC_FAILURE;
-                LOG(DEBUG, __FUNCTION__, "Invalid Record");
-                break;
-            }
-        } else {
-            LOG(DEBUG, __FUNCTION__,"FileId not found ", i );
-            int num = rootObj["ICardManager"]["EFs"]["ADF"][index]["LinearFixedEFFiles"][i]\
-                ["numberOfRecords"].asInt();
-            i = i + num + 1;
-            LOG(DEBUG, __FUNCTION__,"Incremented value is ", i );
-        }
-    }
-    if(i == size) {
-        LOG(DEBUG, __FUNCTION__,"Valid record not found ", i );
-        error = commonStub::ErrorCode::GENERIC_FAILURE;
-    }
-    return error;
-    }
- private:
     Json::Value rootObjSystemStateSlot1_;
     Json::Value rootObjSystemStateSlot2_;
     Json::Value rootObjApiResponseSlot1_;
@@ -194,18 +223,15 @@ class CardManagerServerImpl final : public telStub::CardService::Service,
     std::condition_variable cv_;
     std::mutex mutex_;
     bool exit_ = false;
+    std::shared_ptr<telux::tel::UiccModel> uiccModel_;
 
     grpc::Status readJson();
     bool isCallbackNeeded(Json::Value rootObj, std::string apiname);
-    bool findAppId(Json::Value rootObj, const char* appid, int& index);
-    commonStub::ErrorCode findmatchingrecordDF (Json::Value rootObj, int& size, int& recordNum,
-        uint16_t& fileId, int& i);
-    commonStub::ErrorCode getTransparentFileAttributes(Json::Value rootObj,
-        int& i, uint16_t fileId,
-        telux::tel::FileAttributes& attributes, int& index);
-    commonStub::ErrorCode getLinearfixedFileAttributes(Json::Value rootObj,
-        int& i, uint16_t fileId,
-        telux::tel::FileAttributes& attributes, int& index );
+    grpc::Status getApiResponse(int slotId, const std::string &apiname, Json::Value &rootObj,
+        telux::common::Status &status, telux::common::ErrorCode &error, int &cbDelay);
+    template <typename T, typename R>
+    grpc::Status transmit(const T* request, R* response, const std::string &apiname,
+        telux::tel::UiccModel::ApduChannel channel);
     void getJsonForSystemData (int phoneId, std::string& jsonfilename, Json::Value& rootObj );
     void getJsonForApiResponseSlot(int phoneId, std::string& jsonfilename,
         Json::Value& rootObj );
@@ -34,7 +34,6 @@
 
 #include "EcallStateMachine.hpp"
 #include <telux/tel/ECallDefines.hpp>
-#include <thread>
 namespace telux {
 namespace tel {
 
@@ -75,10 +74,15 @@ void CallConnect::onEnter() {
     std::string config = ecallStateMachine->getECallRedialConfig();
     (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
         "CALL_DIALING", ecallStateMachine->getCallIndex());
-    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
     if(config == "CALLORIG") {
-        changeState(std::make_shared<PSAPCallback>(parent_));
-    } else {
+        ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+            changeState(std::make_shared<PSAPCallback>(parent_));
+        });
+        return;
+    }
+    ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this, config]() {
+        std::shared_ptr<EcallStateMachine> ecallStateMachine
+            = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
         (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
             "CALL_ALERTING", ecallStateMachine->getCallIndex());
         if((config == "SUCCESS") || (config == "CALLDROP")) {
@@ -87,26 +91,42 @@ void CallConnect::onEnter() {
         } else {
             LOG(ERROR, __FUNCTION__, " Invalid config");
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    });
+    ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+        std::shared_ptr<EcallStateMachine> ecallStateMachine
+            = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
         (ecallStateMachine->getCallservice())->startTimer("T2Timer");
         changeState(std::make_shared<DecodeSendMSD>(parent_));
-    }
+    });
 }
 
 void CallConnect::onExit() {
     LOG(DEBUG, __FUNCTION__);
     std::shared_ptr<EcallStateMachine> ecallStateMachine
     = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+    if(!ecallStateMachine) {
+        return;
+    }
     std::string config = ecallStateMachine->getECallRedialConfig();
     if(!(ecallStateMachine->isNGeCall())) {
         if(ecallStateMachine->isMsdTransmitted() == true) {
-            if(!(ecallStateMachine->parseVectortoString("T5FAILED")) && (config != "CALLDROP")) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                (ecallStateMachine->getCallservice())->sendEvent("T5Timer", "start");
-            } else {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                (ecallStateMachine->getCallservice())->startTimer("T5Timer");
-            }
+            bool isT5Simulated =
+                !(ecallStateMachine->parseVectortoString("T5FAILED")) && (config != "CALLDROP");
+            /* This state is being left, the step must outlive it */
+            std::weak_ptr<BaseStateMachine> parent = parent_;
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS,
+                [parent, isT5Simulated]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent.lock());
+                if(!ecallStateMachine) {
+                    return;
+                }
+                if(isT5Simulated) {
+                    (ecallStateMachine->getCallservice())->sendEvent("T5Timer", "start");
+                } else {
+                    (ecallStateMachine->getCallservice())->startTimer("T5Timer");
+                }
+            }, false);
         }
     }
 }
@@ -150,44 +170,72 @@ void ModemRedial::onEnter() {
     int totalRedialAttempts = ecallStateMachine->getConfiguredRedialAttempts(config);
     std::vector<int> timeGap = ecallStateMachine->getConfiguredRedialParameters(config);
     int dialAttempts = 1;
+    /* All the redial attempts are queued upfront as steps, they are dropped if the
+     * state is left meanwhile (e.g. on T10 expiry).
+     */
     for (dialAttempts = 1 ; dialAttempts <= totalRedialAttempts; dialAttempts++) {
         // timeGap between successive redial
-        std::this_thread::sleep_for(std::chrono::milliseconds(timeGap[dialAttempts - 1]));
+        int gap = timeGap[dialAttempts - 1];
         if(dialAttempts < totalRedialAttempts) {
-            if((mode == telux::tel::ECallMode::ECALL_ONLY) && (config == "CALLORIG")) {
-                (ecallStateMachine->getCallservice())->sendEvent("T10Timer", "start");
-            }
-            (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
-                "CALL_DIALING", ecallStateMachine->getCallIndex());
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            if(config == "CALLORIG") {
-                (ecallStateMachine->getCallservice())->onECallRedial(
-                    ecallStateMachine->getPhoneId(), true,
-                    telux::tel::ReasonType::CALL_ORIG_FAILURE);
-                if(mode == telux::tel::ECallMode::ECALL_ONLY) {
-                    (ecallStateMachine->getCallservice())->sendEvent("T10Timer", "stop");
+            ecallStateMachine->runStep(gap, [this, mode, config]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                if((mode == telux::tel::ECallMode::ECALL_ONLY) && (config == "CALLORIG")) {
+                    (ecallStateMachine->getCallservice())->sendEvent("T10Timer", "start");
                 }
-            } else {
-                (ecallStateMachine->getCallservice())->onECallRedial(
-                    ecallStateMachine->getPhoneId(), true, telux::tel::ReasonType::CALL_DROP);
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
-                "CALL_ENDED", ecallStateMachine->getCallIndex());
+                (ecallStateMachine->getCallservice())->changeCallState(
+                    ecallStateMachine->getPhoneId(), "CALL_DIALING",
+                    ecallStateMachine->getCallIndex());
+            });
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS,
+                [this, mode, config]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                if(config == "CALLORIG") {
+                    (ecallStateMachine->getCallservice())->onECallRedial(
+                        ecallStateMachine->getPhoneId(), true,
+                        telux::tel::ReasonType::CALL_ORIG_FAILURE);
+                    if(mode == telux::tel::ECallMode::ECALL_ONLY) {
+                        (ecallStateMachine->getCallservice())->sendEvent("T10Timer", "stop");
+                    }
+                } else {
+                    (ecallStateMachine->getCallservice())->onECallRedial(
+                        ecallStateMachine->getPhoneId(), true, telux::tel::ReasonType::CALL_DROP);
+                }
+            });
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->changeCallState(
+                    ecallStateMachine->getPhoneId(), "CALL_ENDED",
+                    ecallStateMachine->getCallIndex());
+            });
         }
         if(dialAttempts == totalRedialAttempts) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
-                "CALL_DIALING", ecallStateMachine->getCallIndex());
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->onECallRedial(ecallStateMachine->getPhoneId(),
-                false, telux::tel::ReasonType::MAX_REDIAL_ATTEMPTED);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
-                "CALL_ENDED", ecallStateMachine->getCallIndex());
-            if(mode == telux::tel::ECallMode::ECALL_ONLY) {
-                (ecallStateMachine->getCallservice())->startTimer("T10Timer");
-            }
+            ecallStateMachine->runStep(gap + EcallStateMachine::STEP_DELAY_MS, [this]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->changeCallState(
+                    ecallStateMachine->getPhoneId(), "CALL_DIALING",
+                    ecallStateMachine->getCallIndex());
+            });
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->onECallRedial(
+                    ecallStateMachine->getPhoneId(), false,
+                    telux::tel::ReasonType::MAX_REDIAL_ATTEMPTED);
+            });
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this, mode]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->changeCallState(
+                    ecallStateMachine->getPhoneId(), "CALL_ENDED",
+                    ecallStateMachine->getCallIndex());
+                if(mode == telux::tel::ECallMode::ECALL_ONLY) {
+                    (ecallStateMachine->getCallservice())->startTimer("T10Timer");
+                }
+            });
         }
     }
 }
@@ -229,16 +277,22 @@ bool DecodeSendMSD::onEvent(std::shared_ptr<telux::common::Event> event) {
     {
         if(event->id_ == static_cast<int>(EcallStateMachine::EventID::ON_TIMER_EXPIRY)) {
             if(event->name_ == "T5Timer") {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                (ecallStateMachine->getCallservice())->expiryTimer("T5Timer");
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                (ecallStateMachine->getCallservice())->msdTransmissionStatus(
-                    "MSD_TRANSMISSION_FAILURE");
-                if(config == "CALLDROP") {
-                    changeState(std::make_shared<PSAPCallback>(parent_));
-                } else {
-                    changeState(std::make_shared<CallConversation>(parent_));
-                }
+                ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                    std::shared_ptr<EcallStateMachine> ecallStateMachine
+                        = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                    (ecallStateMachine->getCallservice())->expiryTimer("T5Timer");
+                });
+                ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this, config]() {
+                    std::shared_ptr<EcallStateMachine> ecallStateMachine
+                        = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                    (ecallStateMachine->getCallservice())->msdTransmissionStatus(
+                        "MSD_TRANSMISSION_FAILURE");
+                    if(config == "CALLDROP") {
+                        changeState(std::make_shared<PSAPCallback>(parent_));
+                    } else {
+                        changeState(std::make_shared<CallConversation>(parent_));
+                    }
+                });
             }
         }
     }
@@ -262,72 +316,99 @@ void DecodeSendMSD::onEnter() {
         if(ecallStateMachine->isMsdTransmitted() == true) {
             if(ecallStateMachine->eventId_ ==
                 static_cast<int>(EcallStateMachine::EventID::MSD_PULL_REQUEST_FROM_PSAP)) {
-                std::shared_ptr<EcallStateMachine> ecallStateMachine
-                = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
                 (ecallStateMachine->getCallservice())->msdTransmissionStatus("START_RECEIVED");
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                (ecallStateMachine->getCallservice())->msdTransmissionStatus(
-                    "MSD_TRANSMISSION_STARTED");
-                changeState(std::make_shared<CRCCheckonMSD>(parent_));
+                ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                    std::shared_ptr<EcallStateMachine> ecallStateMachine
+                        = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                    (ecallStateMachine->getCallservice())->msdTransmissionStatus(
+                        "MSD_TRANSMISSION_STARTED");
+                    changeState(std::make_shared<CRCCheckonMSD>(parent_));
+                });
             } else {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                (ecallStateMachine->getCallservice())->msdTransmissionStatus(
-                    "MSD_TRANSMISSION_STARTED");
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                (ecallStateMachine->getCallservice())->changeCallState(
-                    ecallStateMachine->getPhoneId(), "CALL_ACTIVE",
-                    ecallStateMachine->getCallIndex());
+                ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                    std::shared_ptr<EcallStateMachine> ecallStateMachine
+                        = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                    (ecallStateMachine->getCallservice())->msdTransmissionStatus(
+                        "MSD_TRANSMISSION_STARTED");
+                });
+                ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                    std::shared_ptr<EcallStateMachine> ecallStateMachine
+                        = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                    (ecallStateMachine->getCallservice())->changeCallState(
+                        ecallStateMachine->getPhoneId(), "CALL_ACTIVE",
+                        ecallStateMachine->getCallIndex());
+                });
                 if((!(ecallStateMachine->parseVectortoString("T5FAILED")))
                     && (config == "SUCCESS")) {
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                    (ecallStateMachine->getCallservice())->msdTransmissionStatus("START_RECEIVED");
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                    (ecallStateMachine->getCallservice())->sendEvent("T5Timer", "stop");
-                    changeState(std::make_shared<CRCCheckonMSD>(parent_));
+                    ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                        std::shared_ptr<EcallStateMachine> ecallStateMachine
+                            = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                        (ecallStateMachine->getCallservice())->msdTransmissionStatus(
+                            "START_RECEIVED");
+                    });
+                    ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                        std::shared_ptr<EcallStateMachine> ecallStateMachine
+                            = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                        (ecallStateMachine->getCallservice())->sendEvent("T5Timer", "stop");
+                        changeState(std::make_shared<CRCCheckonMSD>(parent_));
+                    });
                 }
             }
         } else {  //NG ecall
-            if((ecallStateMachine->isCustomNumberEcall()) != true) {
-                if(ecallStateMachine->eventId_ ==
-                    static_cast<int>(EcallStateMachine::EventID::MSD_PULL_REQUEST_FROM_PSAP)) {
+            if(((ecallStateMachine->isCustomNumberEcall()) != true) &&
+                (ecallStateMachine->eventId_ ==
+                static_cast<int>(EcallStateMachine::EventID::MSD_PULL_REQUEST_FROM_PSAP))) {
+                ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
                     std::shared_ptr<EcallStateMachine> ecallStateMachine
-                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
-                    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+                        = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
                     (ecallStateMachine->getCallservice())->msdTransmissionStatus(
                         "MSD_TRANSMISSION_STARTED");
                     changeState(std::make_shared<CRCCheckonMSD>(parent_));
-                }
+                });
+            } else {
+                ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                    std::shared_ptr<EcallStateMachine> ecallStateMachine
+                        = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                    (ecallStateMachine->getCallservice())->changeCallState(
+                        ecallStateMachine->getPhoneId(), "CALL_ACTIVE",
+                        ecallStateMachine->getCallIndex());
+                    changeState(std::make_shared<CallConversation>(parent_));
+                });
             }
-            std::shared_ptr<EcallStateMachine> ecallStateMachine
-                = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
-            "CALL_ACTIVE", ecallStateMachine->getCallIndex());
-            changeState(std::make_shared<CallConversation>(parent_));
         }
     } else { //NG eCall
         if(ecallStateMachine->isMsdTransmitted() == true) {
             if((ecallStateMachine->isCustomNumberEcall()) != true) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                (ecallStateMachine->getCallservice())->msdTransmissionStatus(
-                    "OUTBAND_MSD_TRANSMISSION_STARTED");
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
-            "CALL_ACTIVE", ecallStateMachine->getCallIndex());
-            if(config == "CALLDROP") {
-                (ecallStateMachine->getCallservice())->msdTransmissionStatus(
-                    "OUTBAND_MSD_TRANSMISSION_FAILURE");
-                changeState(std::make_shared<PSAPCallback>(parent_));
-            } else {
-                changeState(std::make_shared<DecodeMSD>(parent_));
+                ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                    std::shared_ptr<EcallStateMachine> ecallStateMachine
+                        = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                    (ecallStateMachine->getCallservice())->msdTransmissionStatus(
+                        "OUTBAND_MSD_TRANSMISSION_STARTED");
+                });
             }
-
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this, config]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->changeCallState(
+                    ecallStateMachine->getPhoneId(), "CALL_ACTIVE",
+                    ecallStateMachine->getCallIndex());
+                if(config == "CALLDROP") {
+                    (ecallStateMachine->getCallservice())->msdTransmissionStatus(
+                        "OUTBAND_MSD_TRANSMISSION_FAILURE");
+                    changeState(std::make_shared<PSAPCallback>(parent_));
+                } else {
+                    changeState(std::make_shared<DecodeMSD>(parent_));
+                }
+            });
         } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
-            "CALL_ACTIVE", ecallStateMachine->getCallIndex());
-            changeState(std::make_shared<CallConversation>(parent_));
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->changeCallState(
+                    ecallStateMachine->getPhoneId(), "CALL_ACTIVE",
+                    ecallStateMachine->getCallIndex());
+                changeState(std::make_shared<CallConversation>(parent_));
+            });
         }
     }
 }
@@ -381,15 +462,17 @@ void CRCCheckonMSD::onEnter() {
     if(!(ecallStateMachine->parseVectortoString("T7FAILED"))) {
         if(ecallStateMachine->eventId_ ==
             static_cast<int>(EcallStateMachine::EventID::MSD_PULL_REQUEST_FROM_PSAP)) {
-            std::shared_ptr<EcallStateMachine> ecallStateMachine
-                = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
             (ecallStateMachine->getCallservice())->sendEvent("T7Timer", "start");
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            changeState(std::make_shared<DecodeMSD>(parent_));
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                changeState(std::make_shared<DecodeMSD>(parent_));
+            });
         } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->sendEvent("T7Timer", "start");
-            changeState(std::make_shared<DecodeMSD>(parent_));
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->sendEvent("T7Timer", "start");
+                changeState(std::make_shared<DecodeMSD>(parent_));
+            });
         }
     } else {
         (ecallStateMachine->getCallservice())->startTimer("T7Timer");
@@ -400,11 +483,26 @@ void CRCCheckonMSD::onExit() {
     LOG(DEBUG, __FUNCTION__);
     std::shared_ptr<EcallStateMachine> ecallStateMachine
         = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+    if(!ecallStateMachine) {
+        return;
+    }
     if(!(ecallStateMachine->parseVectortoString("T7FAILED"))) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        (ecallStateMachine->getCallservice())->sendEvent("T7Timer", "stop");
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        (ecallStateMachine->getCallservice())->msdTransmissionStatus("LL_ACK_RECEIVED");
+        /* This state is being left, the steps must outlive it */
+        std::weak_ptr<BaseStateMachine> parent = parent_;
+        ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [parent]() {
+            std::shared_ptr<EcallStateMachine> ecallStateMachine
+                = std::dynamic_pointer_cast<EcallStateMachine>(parent.lock());
+            if(ecallStateMachine) {
+                (ecallStateMachine->getCallservice())->sendEvent("T7Timer", "stop");
+            }
+        }, false);
+        ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [parent]() {
+            std::shared_ptr<EcallStateMachine> ecallStateMachine
+                = std::dynamic_pointer_cast<EcallStateMachine>(parent.lock());
+            if(ecallStateMachine) {
+                (ecallStateMachine->getCallservice())->msdTransmissionStatus("LL_ACK_RECEIVED");
+            }
+        }, false);
     }
 }
 
@@ -456,13 +554,43 @@ void DecodeMSD::onEnter() {
         = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
     if(!(ecallStateMachine->isNGeCall())) {     //CS eCall
         if(!(ecallStateMachine->parseVectortoString("T6FAILED"))) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->sendEvent("T6Timer", "start");
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->sendEvent("T6Timer", "start");
+            });
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->msdTransmissionStatus
+                    ("MSD_TRANSMISSION_SUCCESS");
+            });
+            ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->sendEvent("T6Timer", "stop");
+                if(ecallStateMachine->eventId_ ==
+                    static_cast<int>(EcallStateMachine::EventID::MSD_PULL_REQUEST_FROM_PSAP)) {
+                    ecallStateMachine->updateInProgress_ = false;
+                } else {
+                    if(ecallStateMachine->getUserConfiguredALACKParameter() == true) {
+                        (ecallStateMachine->getCallservice())->msdTransmissionStatus
+                        ("MSD_AL_ACK_CLEARDOWN");
+                    }
+                }
+                changeState(std::make_shared<CallConversation>(parent_));
+            });
+        } else {
+            if((ecallStateMachine->isCustomNumberEcall()) != true) {
+                (ecallStateMachine->getCallservice())->startTimer("T6Timer");
+            }
+        }
+    } else { //NG eCall
+        ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+            std::shared_ptr<EcallStateMachine> ecallStateMachine
+                = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
             (ecallStateMachine->getCallservice())->msdTransmissionStatus
-                ("MSD_TRANSMISSION_SUCCESS");
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            (ecallStateMachine->getCallservice())->sendEvent("T6Timer", "stop");
+                ("OUTBAND_MSD_TRANSMISSION_SUCCESS");
             if(ecallStateMachine->eventId_ ==
                 static_cast<int>(EcallStateMachine::EventID::MSD_PULL_REQUEST_FROM_PSAP)) {
                 ecallStateMachine->updateInProgress_ = false;
@@ -473,25 +601,7 @@ void DecodeMSD::onEnter() {
                 }
             }
             changeState(std::make_shared<CallConversation>(parent_));
-        } else {
-            if((ecallStateMachine->isCustomNumberEcall()) != true) {
-                (ecallStateMachine->getCallservice())->startTimer("T6Timer");
-            }
-        }
-    } else { //NG eCall
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        (ecallStateMachine->getCallservice())->msdTransmissionStatus
-            ("OUTBAND_MSD_TRANSMISSION_SUCCESS");
-        if(ecallStateMachine->eventId_ ==
-            static_cast<int>(EcallStateMachine::EventID::MSD_PULL_REQUEST_FROM_PSAP)) {
-            ecallStateMachine->updateInProgress_ = false;
-        } else {
-            if(ecallStateMachine->getUserConfiguredALACKParameter() == true) {
-                (ecallStateMachine->getCallservice())->msdTransmissionStatus
-                ("MSD_AL_ACK_CLEARDOWN");
-            }
-        }
-        changeState(std::make_shared<CallConversation>(parent_));
+        });
     }
 }
 
@@ -572,12 +682,16 @@ void PSAPCallback::onEnter() {
                 true, telux::tel::ReasonType::CALL_DROP);
         }
     }
-    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-    (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
-        "CALL_ENDED", ecallStateMachine->getCallIndex());
-    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+        std::shared_ptr<EcallStateMachine> ecallStateMachine
+            = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+        (ecallStateMachine->getCallservice())->changeCallState(ecallStateMachine->getPhoneId(),
+            "CALL_ENDED", ecallStateMachine->getCallIndex());
+    });
     if(config != "SUCCESS") {
-        changeState(std::make_shared<ModemRedial>(parent_));
+        ecallStateMachine->runStep(EcallStateMachine::STEP_DELAY_MS, [this]() {
+            changeState(std::make_shared<ModemRedial>(parent_));
+        });
     }
 }
 
@@ -616,14 +730,19 @@ bool CallConversation::onEvent(std::shared_ptr<telux::common::Event> event) {
             changeState(std::make_shared<DecodeSendMSD>(parent_));
         } else {
             ecallStateMachine->updateInProgress_ = true;
+            int delay = 0;
             if((ecallStateMachine->isCustomNumberEcall()) != true) {
                 (ecallStateMachine->getCallservice())->msdTransmissionStatus
                     ("OUTBAND_MSD_TRANSMISSION_STARTED");
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+                delay = EcallStateMachine::STEP_DELAY_MS;
             }
-            (ecallStateMachine->getCallservice())->msdTransmissionStatus
-                ("OUTBAND_MSD_TRANSMISSION_SUCCESS");
-            ecallStateMachine->updateInProgress_ = false;
+            ecallStateMachine->runStep(delay, [this]() {
+                std::shared_ptr<EcallStateMachine> ecallStateMachine
+                    = std::dynamic_pointer_cast<EcallStateMachine>(parent_.lock());
+                (ecallStateMachine->getCallservice())->msdTransmissionStatus
+                    ("OUTBAND_MSD_TRANSMISSION_SUCCESS");
+                ecallStateMachine->updateInProgress_ = false;
+            });
         }
     }
     return true;
@@ -666,10 +785,117 @@ EcallStateMachine::EcallStateMachine(std::shared_ptr<CallManagerServerImpl> call
 
 bool EcallStateMachine::onEvent(std::shared_ptr<telux::common::Event> event) {
     LOG(DEBUG, "Received event: ", event->name_);
-    currentState_->onEvent(event);
+    post([this, event]() {
+        if(currentState_) {
+            currentState_->onEvent(event);
+        } else {
+            LOG(DEBUG, "Dropping event ", event->name_, ", state machine is stopped");
+        }
+    });
     return true;
 }
 
+void EcallStateMachine::post(std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(loopMtx_);
+    loopTasks_.push_back(task);
+    if(isLoopScheduled_) {
+        return;
+    }
+    /* The loop borrows a timer service worker only while it has work, so parallel
+     * eCalls don't need a thread each.
+     */
+    isLoopScheduled_ = true;
+    std::weak_ptr<EcallStateMachine> weakSelf = weak_from_this();
+    telux::common::TimerService::getInstance()->runAfter(0, [weakSelf]() {
+        std::shared_ptr<EcallStateMachine> self = weakSelf.lock();
+        if(self) {
+            self->runEventLoop();
+        }
+    });
+}
+
+void EcallStateMachine::runEventLoop() {
+    while(true) {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(loopMtx_);
+            if(loopTasks_.empty()) {
+                isLoopScheduled_ = false;
+                return;
+            }
+            task = loopTasks_.front();
+            loopTasks_.pop_front();
+        }
+        task();
+    }
+}
+
+void EcallStateMachine::runStep(int delayMs, std::function<void()> step, bool isStateBound) {
+    Step entry;
+    entry.delayMs = delayMs;
+    entry.task = step;
+    entry.isStateBound = isStateBound;
+    entry.state = currentState_;
+    steps_.push_back(entry);
+    if(!isStepArmed_) {
+        armNextStep();
+    } else if(!isStepValid(steps_.front())) {
+        /* The state that queued the pending step has been left, don't make the new
+         * state wait for its delay.
+         */
+        if(telux::common::TimerService::getInstance()->cancel(stepTimerId_)) {
+            isStepArmed_ = false;
+            armNextStep();
+        }
+    }
+}
+
+bool EcallStateMachine::isStepValid(const Step &step) {
+    if(!step.isStateBound) {
+        return true;
+    }
+    std::shared_ptr<telux::common::BaseState> state = step.state.lock();
+    return (state != nullptr) && (state == currentState_);
+}
+
+void EcallStateMachine::armNextStep() {
+    while((!steps_.empty()) && (!isStepValid(steps_.front()))) {
+        steps_.pop_front();
+    }
+    if(steps_.empty()) {
+        return;
+    }
+    isStepArmed_ = true;
+    uint64_t seq = ++stepSeq_;
+    std::weak_ptr<EcallStateMachine> weakSelf = weak_from_this();
+    telux::common::TimerService::getInstance()->runAfter(steps_.front().delayMs,
+        [weakSelf, seq]() {
+        std::shared_ptr<EcallStateMachine> self = weakSelf.lock();
+        if(self) {
+            EcallStateMachine *sm = self.get();
+            self->post([sm, seq]() {
+                sm->onStepTimerExpiry(seq);
+            });
+        }
+    }, &stepTimerId_);
+}
+
+void EcallStateMachine::onStepTimerExpiry(uint64_t seq) {
+    /* A step timer cancelled too late still expires, ignore it */
+    if((!isStepArmed_) || (seq != stepSeq_) || steps_.empty()) {
+        return;
+    }
+    isStepArmed_ = false;
+    Step step = steps_.front();
+    steps_.pop_front();
+    if(isStepValid(step)) {
+        step.task();
+    }
+    if(!isStepArmed_) {
+        armNextStep();
+    }
+}
+
 bool EcallStateMachine::isMsdTransmitted() {
     return isMsdTransmitted_;
 }
@@ -756,8 +982,10 @@ void EcallStateMachine::start() {
     // Call the base class method to get it running
     LOG(DEBUG, __FUNCTION__);
     BaseStateMachine::start();
-    // Move to CallConnect
-    changeState(std::make_shared<CallConnect>(shared_from_this()));
+    // Move to CallConnect, from the event loop like every other transition
+    post([this]() {
+        changeState(std::make_shared<CallConnect>(shared_from_this()));
+    });
 }
 
 void EcallStateMachine::stop() {
@@ -39,6 +39,9 @@
 #ifndef ECALLSTATEMACHINE_HPP
 #define ECALLSTATEMACHINE_HPP
 
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <set>
 
 #include "../../../libs/common/BaseState.hpp"
@@ -48,6 +51,7 @@
 #include "../../../libs/common/Event.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/CommonUtils.hpp"
+#include "libs/common/TimerService.hpp"
 
 class CallManagerServerImpl;
 
@@ -314,6 +318,32 @@ class EcallStateMachine : public telux::common::BaseStateMachine,
     int callIndex_;
     bool isCustomNumbereCall_;
     std::string eCallRedialConfig_;
+
+    /* Step of the simulated eCall procedure queued with runStep() */
+    struct Step {
+        int delayMs;
+        std::function<void()> task;
+        bool isStateBound;
+        std::weak_ptr<telux::common::BaseState> state;
+    };
+
+    /* Event loop, events and steps of this eCall are run one at a time, in order */
+    std::mutex loopMtx_;
+    std::deque<std::function<void()>> loopTasks_;
+    bool isLoopScheduled_ = false;
+
+    /* Accessed only from the event loop */
+    std::deque<Step> steps_;
+    telux::common::TimerService::TimerId stepTimerId_
+        = telux::common::TimerService::INVALID_TIMER_ID;
+    uint64_t stepSeq_ = 0;
+    bool isStepArmed_ = false;
+
+    void post(std::function<void()> task);
+    void runEventLoop();
+    bool isStepValid(const Step &step);
+    void armNextStep();
+    void onStepTimerExpiry(uint64_t seq);
  public:
     /**
      * Constructor for EcallStateMachine
@@ -342,13 +372,28 @@ class EcallStateMachine : public telux::common::BaseStateMachine,
 
     /**
      * Top-level event handler for the state-machine
-     * Handles the incoming events, identifies the event and passes on further
-     * to the current state for further handling
+     * Queues the incoming event on the state machine's event loop, from where it is
+     * passed on to the current state for further handling
      * @param [in] event - The TelEvent that needs to be handled
-     * @returns true if the event was handled
+     * @returns true if the event was queued
      */
     bool onEvent(std::shared_ptr<telux::common::Event> event) override;
 
+    /**
+     * Queues a step of the simulated eCall procedure. The step runs on the event loop
+     * once delayMs milliseconds have passed after the previously queued step ran, so
+     * the states don't block a thread between the steps.
+     * @param [in] delayMs - Delay in milliseconds after the previous step
+     * @param [in] step - The step to run
+     * @param [in] isStateBound - If true, the step is dropped when the current state
+     *                            has been left before it is due. Steps queued from
+     *                            onExit() should pass false.
+     */
+    void runStep(int delayMs, std::function<void()> step, bool isStateBound = true);
+
+    /* Gap between the simulated steps of the eCall procedure */
+    static const int STEP_DELAY_MS = 1000;
+
     enum EventID {
         NONE = EVENT_ID_INVALID,
         HANGUP_REQUEST_FROM_USER,
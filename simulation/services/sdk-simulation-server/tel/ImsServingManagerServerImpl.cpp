@@ -10,6 +10,7 @@
 
 #include "libs/tel/TelDefinesStub.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 
 #include <telux/tel/ImsServingSystemManager.hpp>
 #include <telux/tel/PhoneDefines.hpp>
@@ -39,13 +40,13 @@ ImsServingManagerServerImpl::~ImsServingManagerServerImpl() {
     }
 }
 
-grpc::Status ImsServingManagerServerImpl::CleanUpService(ServerContext* context,
-    const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) {
+grpc::Status ImsServingManagerServerImpl::CleanUpService(const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
     return grpc::Status::OK;
 }
 
-grpc::Status ImsServingManagerServerImpl::InitService(ServerContext* context,
+grpc::Status ImsServingManagerServerImpl::InitService(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -74,7 +75,7 @@ grpc::Status ImsServingManagerServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ImsServingManagerServerImpl::GetServiceStatus(ServerContext* context,
+grpc::Status ImsServingManagerServerImpl::GetServiceStatus(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     Json::Value rootObj;
@@ -91,7 +92,7 @@ grpc::Status ImsServingManagerServerImpl::GetServiceStatus(ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status ImsServingManagerServerImpl::RequestRegistrationInfo(ServerContext* context,
+grpc::Status ImsServingManagerServerImpl::RequestRegistrationInfo(
     const ::telStub::RequestRegistrationInfoRequest* request,
     telStub::RequestRegistrationInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -135,7 +136,7 @@ grpc::Status ImsServingManagerServerImpl::RequestRegistrationInfo(ServerContext*
     return grpc::Status::OK;
 }
 
-grpc::Status ImsServingManagerServerImpl::RequestServiceInfo(ServerContext* context,
+grpc::Status ImsServingManagerServerImpl::RequestServiceInfo(
     const ::telStub::RequestServiceInfoRequest* request,
     telStub::RequestServiceInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -174,9 +175,8 @@ grpc::Status ImsServingManagerServerImpl::RequestServiceInfo(ServerContext* cont
     return grpc::Status::OK;
 }
 
-grpc::Status ImsServingManagerServerImpl::RequestPdpStatus(ServerContext* context,
-    const ::telStub::RequestPdpStatusRequest* request,
-    telStub::RequestPdpStatusReply* response) {
+grpc::Status ImsServingManagerServerImpl::RequestPdpStatus(
+    const ::telStub::RequestPdpStatusRequest* request, telStub::RequestPdpStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->phone_id() == SLOT_1)? JSON_PATH1 : JSON_PATH2;
     std::string stateJsonPath = (request->phone_id() == SLOT_1)? JSON_PATH3 : JSON_PATH4;
@@ -480,4 +480,46 @@ void ImsServingManagerServerImpl::onEventUpdate(std::string event) {
     } else {
         LOG(ERROR, __FUNCTION__, " Event not supported");
     }
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* ImsServingManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsServingManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsServingManagerServerImpl::RequestRegistrationInfo(
+    grpc::CallbackServerContext* context, const ::telStub::RequestRegistrationInfoRequest* request,
+    telStub::RequestRegistrationInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestRegistrationInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsServingManagerServerImpl::RequestServiceInfo(
+    grpc::CallbackServerContext* context, const ::telStub::RequestServiceInfoRequest* request,
+    telStub::RequestServiceInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestServiceInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsServingManagerServerImpl::RequestPdpStatus(
+    grpc::CallbackServerContext* context, const ::telStub::RequestPdpStatusRequest* request,
+    telStub::RequestPdpStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestPdpStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsServingManagerServerImpl::CleanUpService(
+    grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CleanUpService(request, response); });
+}
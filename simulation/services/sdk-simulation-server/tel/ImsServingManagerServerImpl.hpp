@@ -22,7 +22,7 @@
 #include "event/EventService.hpp"
 #include <thread>
 
-class ImsServingManagerServerImpl final : public telStub::ImsServingSystem::Service,
+class ImsServingManagerServerImpl final : public telStub::ImsServingSystem::CallbackService,
                                           public IServerEventListener,
                                           public
                                     std::enable_shared_from_this<ImsServingManagerServerImpl> {
@@ -30,26 +30,40 @@ class ImsServingManagerServerImpl final : public telStub::ImsServingSystem::Serv
 public:
     ImsServingManagerServerImpl();
     ~ImsServingManagerServerImpl();
-    grpc::Status InitService(ServerContext* context,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status GetServiceStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status RequestRegistrationInfo(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestRegistrationInfo(grpc::CallbackServerContext* context,
         const ::telStub::RequestRegistrationInfoRequest* request,
         telStub::RequestRegistrationInfoReply* response) override;
-    grpc::Status RequestServiceInfo(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestServiceInfo(grpc::CallbackServerContext* context,
         const ::telStub::RequestServiceInfoRequest* request,
         telStub::RequestServiceInfoReply* response) override;
-    grpc::Status RequestPdpStatus(ServerContext* context,
-    const ::telStub::RequestPdpStatusRequest* request,
+    grpc::ServerUnaryReactor* RequestPdpStatus(grpc::CallbackServerContext* context,
+        const ::telStub::RequestPdpStatusRequest* request,
         telStub::RequestPdpStatusReply* response) override;
-    grpc::Status CleanUpService(ServerContext* context,
+    grpc::ServerUnaryReactor* CleanUpService(grpc::CallbackServerContext* context,
         const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent message) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status RequestRegistrationInfo(const ::telStub::RequestRegistrationInfoRequest* request,
+        telStub::RequestRegistrationInfoReply* response);
+    grpc::Status RequestServiceInfo(const ::telStub::RequestServiceInfoRequest* request,
+        telStub::RequestServiceInfoReply* response);
+    grpc::Status RequestPdpStatus(const ::telStub::RequestPdpStatusRequest* request,
+        telStub::RequestPdpStatusReply* response);
+    grpc::Status CleanUpService(const ::google::protobuf::Empty* request,
+        ::google::protobuf::Empty* response);
+
     void handleImsRegStatusChanged(std::string eventParams);
     void handleImsServiceInfoChanged(std::string eventParams);
     void handleImsPdpStatusInfoChanged(std::string eventParams);
@@ -8,6 +8,7 @@
 
 #include "libs/tel/TelDefinesStub.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 
 #include <telux/common/DeviceConfig.hpp>
 #include <telux/tel/ImsSettingsManager.hpp>
@@ -26,13 +27,13 @@ ImsSettingsManagerServerImpl::ImsSettingsManagerServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status ImsSettingsManagerServerImpl::CleanUpService(ServerContext* context,
-    const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) {
+grpc::Status ImsSettingsManagerServerImpl::CleanUpService(const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
     return grpc::Status::OK;
 }
 
-grpc::Status ImsSettingsManagerServerImpl::InitService(ServerContext* context,
+grpc::Status ImsSettingsManagerServerImpl::InitService(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -61,7 +62,7 @@ grpc::Status ImsSettingsManagerServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ImsSettingsManagerServerImpl::GetServiceStatus(ServerContext* context,
+grpc::Status ImsSettingsManagerServerImpl::GetServiceStatus(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -79,7 +80,7 @@ grpc::Status ImsSettingsManagerServerImpl::GetServiceStatus(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status ImsSettingsManagerServerImpl::RequestServiceConfig(ServerContext* context,
+grpc::Status ImsSettingsManagerServerImpl::RequestServiceConfig(
     const ::telStub::RequestServiceConfigRequest* request,
     telStub::RequestServiceConfigReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -128,9 +129,8 @@ grpc::Status ImsSettingsManagerServerImpl::RequestServiceConfig(ServerContext* c
     return grpc::Status::OK;
 }
 
-grpc::Status ImsSettingsManagerServerImpl::SetServiceConfig(ServerContext* context,
-    const ::telStub::SetServiceConfigRequest* request,
-    telStub::SetServiceConfigReply* response) {
+grpc::Status ImsSettingsManagerServerImpl::SetServiceConfig(
+    const ::telStub::SetServiceConfigRequest* request, telStub::SetServiceConfigReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int slotId = request->phone_id();
     std::string apiJsonPath = (slotId == SLOT_1)? JSON_PATH1 : JSON_PATH2;
@@ -195,7 +195,7 @@ grpc::Status ImsSettingsManagerServerImpl::SetServiceConfig(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status ImsSettingsManagerServerImpl::RequestSipUserAgent(ServerContext* context,
+grpc::Status ImsSettingsManagerServerImpl::RequestSipUserAgent(
     const ::telStub::RequestSipUserAgentRequest* request,
     telStub::RequestSipUserAgentReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -230,9 +230,8 @@ grpc::Status ImsSettingsManagerServerImpl::RequestSipUserAgent(ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status ImsSettingsManagerServerImpl::SetSipUserAgent(ServerContext* context,
-    const ::telStub::SetSipUserAgentRequest* request,
-    telStub::SetSipUserAgentReply* response) {
+grpc::Status ImsSettingsManagerServerImpl::SetSipUserAgent(
+    const ::telStub::SetSipUserAgentRequest* request, telStub::SetSipUserAgentReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int slotId = request->phone_id();
     std::string sipUserAgent = request->sip_user_agent();
@@ -315,8 +314,7 @@ void ImsSettingsManagerServerImpl::triggerImsServiceConfigsChange(int slotId,
     }
 }
 
-grpc::Status ImsSettingsManagerServerImpl::RequestVonr(ServerContext* context,
-    const ::telStub::RequestVonrRequest* request,
+grpc::Status ImsSettingsManagerServerImpl::RequestVonr(const ::telStub::RequestVonrRequest* request,
     telStub::RequestVonrReply* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->phone_id() == SLOT_1)? JSON_PATH1 : JSON_PATH2;
@@ -350,8 +348,7 @@ grpc::Status ImsSettingsManagerServerImpl::RequestVonr(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ImsSettingsManagerServerImpl::SetVonr(ServerContext* context,
-    const ::telStub::SetVonrRequest* request,
+grpc::Status ImsSettingsManagerServerImpl::SetVonr(const ::telStub::SetVonrRequest* request,
     telStub::SetVonrReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int slotId = request->phone_id();
@@ -564,3 +561,65 @@ void ImsSettingsManagerServerImpl::onEventUpdate(std::string event) {
     }
 }
 
+grpc::ServerUnaryReactor* ImsSettingsManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsSettingsManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsSettingsManagerServerImpl::RequestServiceConfig(
+    grpc::CallbackServerContext* context, const ::telStub::RequestServiceConfigRequest* request,
+    telStub::RequestServiceConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestServiceConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsSettingsManagerServerImpl::SetServiceConfig(
+    grpc::CallbackServerContext* context, const ::telStub::SetServiceConfigRequest* request,
+    telStub::SetServiceConfigReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetServiceConfig(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsSettingsManagerServerImpl::RequestSipUserAgent(
+    grpc::CallbackServerContext* context, const ::telStub::RequestSipUserAgentRequest* request,
+    telStub::RequestSipUserAgentReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestSipUserAgent(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsSettingsManagerServerImpl::SetSipUserAgent(
+    grpc::CallbackServerContext* context, const ::telStub::SetSipUserAgentRequest* request,
+    telStub::SetSipUserAgentReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetSipUserAgent(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsSettingsManagerServerImpl::RequestVonr(
+    grpc::CallbackServerContext* context, const ::telStub::RequestVonrRequest* request,
+    telStub::RequestVonrReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestVonr(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsSettingsManagerServerImpl::SetVonr(
+    grpc::CallbackServerContext* context, const ::telStub::SetVonrRequest* request,
+    telStub::SetVonrReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetVonr(request, response); });
+}
+
+grpc::ServerUnaryReactor* ImsSettingsManagerServerImpl::CleanUpService(
+    grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CleanUpService(request, response); });
+}
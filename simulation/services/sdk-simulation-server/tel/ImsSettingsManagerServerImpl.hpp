@@ -21,42 +21,59 @@
 #include "event/ServerEventManager.hpp"
 #include "event/EventService.hpp"
 
-class ImsSettingsManagerServerImpl final : public telStub::ImsService::Service,
+class ImsSettingsManagerServerImpl final : public telStub::ImsService::CallbackService,
                                      public IServerEventListener,
                                      public
                                      std::enable_shared_from_this<ImsSettingsManagerServerImpl> {
 
 public:
     ImsSettingsManagerServerImpl();
-    grpc::Status InitService(ServerContext* context,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status GetServiceStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status RequestServiceConfig(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestServiceConfig(grpc::CallbackServerContext* context,
         const ::telStub::RequestServiceConfigRequest* request,
         telStub::RequestServiceConfigReply* response) override;
-    grpc::Status SetServiceConfig(ServerContext* context,
+    grpc::ServerUnaryReactor* SetServiceConfig(grpc::CallbackServerContext* context,
         const ::telStub::SetServiceConfigRequest* request,
         telStub::SetServiceConfigReply* response) override;
-    grpc::Status RequestSipUserAgent(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestSipUserAgent(grpc::CallbackServerContext* context,
         const ::telStub::RequestSipUserAgentRequest* request,
         telStub::RequestSipUserAgentReply* response) override;
-    grpc::Status SetSipUserAgent(ServerContext* context,
+    grpc::ServerUnaryReactor* SetSipUserAgent(grpc::CallbackServerContext* context,
         const ::telStub::SetSipUserAgentRequest* request,
         telStub::SetSipUserAgentReply* response) override;
-    grpc::Status RequestVonr(ServerContext* context,
-        const ::telStub::RequestVonrRequest* request,
-        telStub::RequestVonrReply* response) override;
-    grpc::Status SetVonr(ServerContext* context,
-        const ::telStub::SetVonrRequest* request,
-        telStub::SetVonrReply* response) override;
-    grpc::Status CleanUpService(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestVonr(grpc::CallbackServerContext* context,
+        const ::telStub::RequestVonrRequest* request, telStub::RequestVonrReply* response) override;
+    grpc::ServerUnaryReactor* SetVonr(grpc::CallbackServerContext* context,
+        const ::telStub::SetVonrRequest* request, telStub::SetVonrReply* response) override;
+    grpc::ServerUnaryReactor* CleanUpService(grpc::CallbackServerContext* context,
         const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent message) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status RequestServiceConfig(const ::telStub::RequestServiceConfigRequest* request,
+        telStub::RequestServiceConfigReply* response);
+    grpc::Status SetServiceConfig(const ::telStub::SetServiceConfigRequest* request,
+        telStub::SetServiceConfigReply* response);
+    grpc::Status RequestSipUserAgent(const ::telStub::RequestSipUserAgentRequest* request,
+        telStub::RequestSipUserAgentReply* response);
+    grpc::Status SetSipUserAgent(const ::telStub::SetSipUserAgentRequest* request,
+        telStub::SetSipUserAgentReply* response);
+    grpc::Status RequestVonr(const ::telStub::RequestVonrRequest* request,
+        telStub::RequestVonrReply* response);
+    grpc::Status SetVonr(const ::telStub::SetVonrRequest* request, telStub::SetVonrReply* response);
+    grpc::Status CleanUpService(const ::google::protobuf::Empty* request,
+        ::google::protobuf::Empty* response);
+
     void handleImsServiceConfigsChange(std::string eventParams);
     void handleImsSipUserAgentChange(std::string eventParams);
     void onEventUpdate(std::string event);
@@ -10,6 +10,7 @@
 
 #include "libs/tel/TelDefinesStub.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 #include <telux/common/DeviceConfig.hpp>
 #include "TelUtil.hpp"
 
@@ -38,13 +39,13 @@ NetworkSelectionManagerServerImpl::~NetworkSelectionManagerServerImpl() {
     }
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::CleanUpService(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::CleanUpService(
     const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
     return grpc::Status::OK;
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::InitService(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::InitService(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -73,7 +74,7 @@ grpc::Status NetworkSelectionManagerServerImpl::InitService(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::GetServiceStatus(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::GetServiceStatus(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     Json::Value rootObj;
@@ -90,7 +91,7 @@ grpc::Status NetworkSelectionManagerServerImpl::GetServiceStatus(ServerContext*
     return grpc::Status::OK;
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::RequestNetworkSelectionMode(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::RequestNetworkSelectionMode(
     const ::telStub::RequestNetworkSelectionModeRequest* request,
     telStub::RequestNetworkSelectionModeReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -128,7 +129,7 @@ grpc::Status NetworkSelectionManagerServerImpl::RequestNetworkSelectionMode(Serv
     return grpc::Status::OK;
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::SetNetworkSelectionMode(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::SetNetworkSelectionMode(
     const ::telStub::SetNetworkSelectionModeRequest* request,
     telStub::SetNetworkSelectionModeReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -177,7 +178,7 @@ grpc::Status NetworkSelectionManagerServerImpl::SetNetworkSelectionMode(ServerCo
     return grpc::Status::OK;
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::SetPreferredNetworks(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::SetPreferredNetworks(
     const ::telStub::SetPreferredNetworksRequest* request,
     telStub::SetPreferredNetworksReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -298,7 +299,7 @@ void NetworkSelectionManagerServerImpl::sortDatabase(int phoneId, Json::Value ne
     JsonParser::writeToJsonFile(rootObj.stateRootObj, stateJsonPath);
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::RequestPreferredNetworks(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::RequestPreferredNetworks(
     const ::telStub::RequestPreferredNetworksRequest* request,
     telStub::RequestPreferredNetworksReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -429,7 +430,7 @@ void NetworkSelectionManagerServerImpl::createPreferredNetworkInfo(
     }
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::PerformNetworkScan(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::PerformNetworkScan(
     const ::telStub::PerformNetworkScanRequest* request,
     telStub::PerformNetworkScanReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -692,7 +693,7 @@ void NetworkSelectionManagerServerImpl::handleNetworkScanResultsChanged(std::str
     }
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::SetLteDubiousCell(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::SetLteDubiousCell(
     const ::telStub::SetLteDubiousCellRequest* request,
     ::telStub::SetLteDubiousCellReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -717,7 +718,7 @@ grpc::Status NetworkSelectionManagerServerImpl::SetLteDubiousCell(ServerContext*
     return grpc::Status::OK;
 }
 
-grpc::Status NetworkSelectionManagerServerImpl::SetNrDubiousCell(ServerContext* context,
+grpc::Status NetworkSelectionManagerServerImpl::SetNrDubiousCell(
     const ::telStub::SetNrDubiousCellRequest* request, ::telStub::SetNrDubiousCellReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
@@ -771,3 +772,74 @@ void NetworkSelectionManagerServerImpl::onEventUpdate(std::string event) {
         LOG(ERROR, __FUNCTION__, " Event not supported");
     }
 }
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::CleanUpService(
+    grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CleanUpService(request, response); });
+}
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::RequestNetworkSelectionMode(
+    grpc::CallbackServerContext* context,
+    const ::telStub::RequestNetworkSelectionModeRequest* request,
+    telStub::RequestNetworkSelectionModeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestNetworkSelectionMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::SetNetworkSelectionMode(
+    grpc::CallbackServerContext* context, const ::telStub::SetNetworkSelectionModeRequest* request,
+    telStub::SetNetworkSelectionModeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetNetworkSelectionMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::RequestPreferredNetworks(
+    grpc::CallbackServerContext* context, const ::telStub::RequestPreferredNetworksRequest* request,
+    telStub::RequestPreferredNetworksReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestPreferredNetworks(request, response); });
+}
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::PerformNetworkScan(
+    grpc::CallbackServerContext* context, const ::telStub::PerformNetworkScanRequest* request,
+    telStub::PerformNetworkScanReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return PerformNetworkScan(request, response); });
+}
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::SetPreferredNetworks(
+    grpc::CallbackServerContext* context, const ::telStub::SetPreferredNetworksRequest* request,
+    telStub::SetPreferredNetworksReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetPreferredNetworks(request, response); });
+}
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::SetLteDubiousCell(
+    grpc::CallbackServerContext* context, const ::telStub::SetLteDubiousCellRequest* request,
+    ::telStub::SetLteDubiousCellReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetLteDubiousCell(request, response); });
+}
+
+grpc::ServerUnaryReactor* NetworkSelectionManagerServerImpl::SetNrDubiousCell(
+    grpc::CallbackServerContext* context, const ::telStub::SetNrDubiousCellRequest* request,
+    ::telStub::SetNrDubiousCellReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetNrDubiousCell(request, response); });
+}
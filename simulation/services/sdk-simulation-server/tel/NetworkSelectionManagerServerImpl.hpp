@@ -23,46 +23,69 @@
 #include "event/EventService.hpp"
 
 
-class NetworkSelectionManagerServerImpl final : public telStub::NetworkSelectionService::Service,
-                                                public IServerEventListener,
-                                                public
-                                  std::enable_shared_from_this<NetworkSelectionManagerServerImpl> {
+class NetworkSelectionManagerServerImpl final
+    : public telStub::NetworkSelectionService::CallbackService,
+      public IServerEventListener,
+      public std::enable_shared_from_this<NetworkSelectionManagerServerImpl> {
 
 public:
     NetworkSelectionManagerServerImpl();
     ~NetworkSelectionManagerServerImpl();
-    grpc::Status InitService(ServerContext* context,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status GetServiceStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status CleanUpService(ServerContext* context,
+    grpc::ServerUnaryReactor* CleanUpService(grpc::CallbackServerContext* context,
         const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent message) override;
-    grpc::Status RequestNetworkSelectionMode(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestNetworkSelectionMode(grpc::CallbackServerContext* context,
         const ::telStub::RequestNetworkSelectionModeRequest* request,
         telStub::RequestNetworkSelectionModeReply* response) override;
-    grpc::Status SetNetworkSelectionMode(ServerContext* context,
+    grpc::ServerUnaryReactor* SetNetworkSelectionMode(grpc::CallbackServerContext* context,
         const ::telStub::SetNetworkSelectionModeRequest* request,
         telStub::SetNetworkSelectionModeReply* response) override;
-    grpc::Status RequestPreferredNetworks(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestPreferredNetworks(grpc::CallbackServerContext* context,
         const ::telStub::RequestPreferredNetworksRequest* request,
         telStub::RequestPreferredNetworksReply* response) override;
-    grpc::Status PerformNetworkScan(ServerContext* context,
+    grpc::ServerUnaryReactor* PerformNetworkScan(grpc::CallbackServerContext* context,
         const ::telStub::PerformNetworkScanRequest* request,
         telStub::PerformNetworkScanReply* response) override;
-    grpc::Status SetPreferredNetworks(ServerContext* context,
+    grpc::ServerUnaryReactor* SetPreferredNetworks(grpc::CallbackServerContext* context,
         const ::telStub::SetPreferredNetworksRequest* request,
         telStub::SetPreferredNetworksReply* response) override;
-    grpc::Status SetLteDubiousCell(ServerContext* context,
-            const ::telStub::SetLteDubiousCellRequest* request,
-            ::telStub::SetLteDubiousCellReply* response) override;
-    grpc::Status SetNrDubiousCell(ServerContext* context,
-            const ::telStub::SetNrDubiousCellRequest* request,
-            ::telStub::SetNrDubiousCellReply* response) override;
+    grpc::ServerUnaryReactor* SetLteDubiousCell(grpc::CallbackServerContext* context,
+        const ::telStub::SetLteDubiousCellRequest* request,
+        ::telStub::SetLteDubiousCellReply* response) override;
+    grpc::ServerUnaryReactor* SetNrDubiousCell(grpc::CallbackServerContext* context,
+        const ::telStub::SetNrDubiousCellRequest* request,
+        ::telStub::SetNrDubiousCellReply* response) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status CleanUpService(const ::google::protobuf::Empty* request,
+        ::google::protobuf::Empty* response);
+    grpc::Status RequestNetworkSelectionMode(
+        const ::telStub::RequestNetworkSelectionModeRequest* request,
+        telStub::RequestNetworkSelectionModeReply* response);
+    grpc::Status SetNetworkSelectionMode(const ::telStub::SetNetworkSelectionModeRequest* request,
+        telStub::SetNetworkSelectionModeReply* response);
+    grpc::Status RequestPreferredNetworks(const ::telStub::RequestPreferredNetworksRequest* request,
+        telStub::RequestPreferredNetworksReply* response);
+    grpc::Status PerformNetworkScan(const ::telStub::PerformNetworkScanRequest* request,
+        telStub::PerformNetworkScanReply* response);
+    grpc::Status SetPreferredNetworks(const ::telStub::SetPreferredNetworksRequest* request,
+        telStub::SetPreferredNetworksReply* response);
+    grpc::Status SetLteDubiousCell(const ::telStub::SetLteDubiousCellRequest* request,
+        ::telStub::SetLteDubiousCellReply* response);
+    grpc::Status SetNrDubiousCell(const ::telStub::SetNrDubiousCellRequest* request,
+        ::telStub::SetNrDubiousCellReply* response);
+
     void createPreferredNetworkInfo(telux::tel::PreferredNetworkInfo input,
         telStub::PreferredNetworkInfo* output);
     void requestPreferredNetworks(int phoneId,
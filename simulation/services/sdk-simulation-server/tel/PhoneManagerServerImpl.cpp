@@ -10,6 +10,7 @@
 #include "libs/common/Logger.hpp"
 #include "PhoneManagerServerImpl.hpp"
 #include "TelUtil.hpp"
+#include "common/RpcExecutor.hpp"
 #include <thread>
 
 #define JSON_PATH1 "api/tel/IPhoneManagerSlot1.json"
@@ -64,8 +65,8 @@ telux::common::ServiceStatus PhoneManagerServerImpl::readSubsystemStatus(int slo
     return status;
 }
 
-grpc::Status PhoneManagerServerImpl::InitService(ServerContext* context,
-    const ::google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+grpc::Status PhoneManagerServerImpl::InitService(const ::google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     int cbDelay = 0;
     telux::common::ServiceStatus status = readSubsystemStatus(DEFAULT_SLOT_ID, cbDelay);
     if (status == telux::common::ServiceStatus::SERVICE_AVAILABLE) {
@@ -83,8 +84,8 @@ grpc::Status PhoneManagerServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::GetServiceStatus(ServerContext* context,
-    const ::google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+grpc::Status PhoneManagerServerImpl::GetServiceStatus(const ::google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
     telux::common::ServiceStatus status = readSubsystemStatus(DEFAULT_SLOT_ID);
     if (status != telux::common::ServiceStatus::SERVICE_AVAILABLE) {
@@ -95,8 +96,8 @@ grpc::Status PhoneManagerServerImpl::GetServiceStatus(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::IsSubsystemReady(ServerContext* context,
-    const google::protobuf::Empty *request, commonStub::IsSubsystemReadyReply* response) {
+grpc::Status PhoneManagerServerImpl::IsSubsystemReady(const google::protobuf::Empty *request,
+    commonStub::IsSubsystemReadyReply* response) {
     LOG(DEBUG, __FUNCTION__);
     bool status = false;
     telux::common::ServiceStatus servstatus = readSubsystemStatus(DEFAULT_SLOT_ID);
@@ -110,8 +111,8 @@ grpc::Status PhoneManagerServerImpl::IsSubsystemReady(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::GetPhoneIds(ServerContext *context,
-    const google::protobuf::Empty *request, telStub::GetPhoneIdsReply* response) {
+grpc::Status PhoneManagerServerImpl::GetPhoneIds(const google::protobuf::Empty *request,
+    telStub::GetPhoneIdsReply* response) {
     LOG(DEBUG, __FUNCTION__);
     JsonData data = telux::tel::TelUtil::readGetPhoneIdsRespFromJsonFile(response);
     if (data.status != telux::common::Status::SUCCESS) {
@@ -120,8 +121,8 @@ grpc::Status PhoneManagerServerImpl::GetPhoneIds(ServerContext *context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::GetPhoneId(ServerContext *context,
-    const google::protobuf::Empty *request, telStub::GetPhoneIdReply* response) {
+grpc::Status PhoneManagerServerImpl::GetPhoneId(const google::protobuf::Empty *request,
+    telStub::GetPhoneIdReply* response) {
     LOG(DEBUG, __FUNCTION__);
     JsonData data = telux::tel::TelUtil::readGetPhoneIdRespFromJsonFile(response);
     if (data.status != telux::common::Status::SUCCESS) {
@@ -130,8 +131,8 @@ grpc::Status PhoneManagerServerImpl::GetPhoneId(ServerContext *context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::GetCellularCapabilities(ServerContext* context,
-    const google::protobuf::Empty *request, telStub::CellularCapabilityInfoReply* response) {
+grpc::Status PhoneManagerServerImpl::GetCellularCapabilities(const google::protobuf::Empty *request,
+    telStub::CellularCapabilityInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
     JsonData data = telux::tel::TelUtil::readCellularCapabilitiesRespFromJsonFile(response);
     if (data.status != telux::common::Status::SUCCESS) {
@@ -140,20 +141,20 @@ grpc::Status PhoneManagerServerImpl::GetCellularCapabilities(ServerContext* cont
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::SetOperatingMode(ServerContext* context,
+grpc::Status PhoneManagerServerImpl::SetOperatingMode(
     const ::telStub::SetOperatingModeRequest* request, telStub::SetOperatingModeReply* response) {
     LOG(DEBUG, __FUNCTION__);
     return modemMgr_->setOperatingMode(request, response);
 }
 
-grpc::Status PhoneManagerServerImpl::GetOperatingMode(ServerContext* context,
-    const google::protobuf::Empty* request, telStub::GetOperatingModeReply* response) {
+grpc::Status PhoneManagerServerImpl::GetOperatingMode(const google::protobuf::Empty* request,
+    telStub::GetOperatingModeReply* response) {
     LOG(DEBUG, __FUNCTION__);
     return modemMgr_->getOperatingMode(request, response);
 }
 
-grpc::Status PhoneManagerServerImpl::ResetWwan(ServerContext* context,
-    const google::protobuf::Empty* request, telStub::ResetWwanReply* response) {
+grpc::Status PhoneManagerServerImpl::ResetWwan(const google::protobuf::Empty* request,
+    telStub::ResetWwanReply* response) {
     LOG(DEBUG, __FUNCTION__);
     JsonData data = telux::tel::TelUtil::readResetWwanRespFromJsonFile(response);
     if (data.status != telux::common::Status::SUCCESS) {
@@ -162,7 +163,7 @@ grpc::Status PhoneManagerServerImpl::ResetWwan(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::RequestVoiceServiceState(ServerContext* context,
+grpc::Status PhoneManagerServerImpl::RequestVoiceServiceState(
     const telStub::RequestVoiceServiceStateRequest* request,
     telStub::RequestVoiceServiceStateReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -174,8 +175,8 @@ grpc::Status PhoneManagerServerImpl::RequestVoiceServiceState(ServerContext* con
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::SetRadioPower(ServerContext* context,
-    const telStub::SetRadioPowerRequest* request, telStub::SetRadioPowerReply* response) {
+grpc::Status PhoneManagerServerImpl::SetRadioPower(const telStub::SetRadioPowerRequest* request,
+    telStub::SetRadioPowerReply* response) {
     LOG(DEBUG, __FUNCTION__);
     telux::common::ErrorCode error =
         telux::tel::TelUtil::writeSetRadioPowerToJsonFileAndReply(request->phone_id(),
@@ -186,7 +187,7 @@ grpc::Status PhoneManagerServerImpl::SetRadioPower(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::RequestCellInfoList(ServerContext* context,
+grpc::Status PhoneManagerServerImpl::RequestCellInfoList(
     const telStub::RequestCellInfoListRequest* request,
     telStub::RequestCellInfoListReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -198,7 +199,7 @@ grpc::Status PhoneManagerServerImpl::RequestCellInfoList(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::SetCellInfoListRate(ServerContext* context,
+grpc::Status PhoneManagerServerImpl::SetCellInfoListRate(
     const telStub::SetCellInfoListRateRequest* request,
     telStub::SetCellInfoListRateReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -211,9 +212,8 @@ grpc::Status PhoneManagerServerImpl::SetCellInfoListRate(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::GetSignalStrength(ServerContext* context,
-    const telStub::GetSignalStrengthRequest* request,
-    telStub::GetSignalStrengthReply* response) {
+grpc::Status PhoneManagerServerImpl::GetSignalStrength(
+    const telStub::GetSignalStrengthRequest* request, telStub::GetSignalStrengthReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
     JsonData data = telux::tel::TelUtil::readSignalStrengthRespFromJsonFile(phoneId, response);
@@ -223,7 +223,7 @@ grpc::Status PhoneManagerServerImpl::GetSignalStrength(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::SetECallOperatingMode(ServerContext* context,
+grpc::Status PhoneManagerServerImpl::SetECallOperatingMode(
     const telStub::SetECallOperatingModeRequest* request,
     telStub::SetECallOperatingModeReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -255,7 +255,7 @@ grpc::Status PhoneManagerServerImpl::SetECallOperatingMode(ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::GetECallOperatingMode(ServerContext* context,
+grpc::Status PhoneManagerServerImpl::GetECallOperatingMode(
     const telStub::GetECallOperatingModeRequest* request,
     telStub::GetECallOperatingModeReply* response) {
 
@@ -267,7 +267,7 @@ grpc::Status PhoneManagerServerImpl::GetECallOperatingMode(ServerContext* contex
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::RequestOperatorInfo(ServerContext* context,
+grpc::Status PhoneManagerServerImpl::RequestOperatorInfo(
     const telStub::RequestOperatorInfoRequest* request,
     telStub::RequestOperatorInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -280,7 +280,7 @@ grpc::Status PhoneManagerServerImpl::RequestOperatorInfo(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::ConfigureSignalStrength(ServerContext* context,
+grpc::Status PhoneManagerServerImpl::ConfigureSignalStrength(
     const telStub::ConfigureSignalStrengthRequest* request,
     telStub::ConfigureSignalStrengthReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -299,7 +299,7 @@ grpc::Status PhoneManagerServerImpl::ConfigureSignalStrength(ServerContext* cont
     return grpc::Status::OK;
 }
 
-grpc::Status PhoneManagerServerImpl::ConfigureSignalStrengthEx(ServerContext* context,
+grpc::Status PhoneManagerServerImpl::ConfigureSignalStrengthEx(
     const telStub::ConfigureSignalStrengthExRequest* request,
     telStub::ConfigureSignalStrengthExReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -328,6 +328,16 @@ void PhoneManagerServerImpl::triggerChangeEvent(::eventService::EventResponse an
     eventImpl.updateEventQueue(anyResponse);
 }
 
+void PhoneManagerServerImpl::triggerOrderedChangeEvent(::eventService::EventResponse anyResponse,
+    std::chrono::steady_clock::time_point notifyTime) {
+    LOG(DEBUG, __FUNCTION__);
+    // Same delay as triggerChangeEvent, counted from when the event was raised so the
+    // events queued behind each other aren't delayed further
+    std::this_thread::sleep_until(notifyTime);
+    auto& eventImpl = EventService::getInstance();
+    eventImpl.updateEventQueue(anyResponse);
+}
+
 void PhoneManagerServerImpl::handleSignalStrengthChanged(std::string eventParams) {
     LOG(DEBUG, __FUNCTION__);
     // Split the event string into parameters( for phoneId, SignalStrength1, SignalStrength2 ...)
@@ -340,28 +350,25 @@ void PhoneManagerServerImpl::handleSignalStrengthChanged(std::string eventParams
 
     int phoneId;
     bool notify = false;
+    // The event only carries the RATs which changed since the last notification
+    ::telStub::SignalStrengthChangeEvent signalStrengthChangeEvent;
     telux::common::ErrorCode errorCode = telux::tel::TelUtil::writeSignalStrengthToJsonFile(params,
-        phoneId, notify);
+        phoneId, notify, signalStrengthChangeEvent);
     if (errorCode == telux::common::ErrorCode::SUCCESS) {
-        ::telStub::SignalStrengthChangeEvent signalStrengthChangeEvent;
-        errorCode = telux::tel::TelUtil::readSignalStrengthEventFromJsonFile(phoneId,
-            signalStrengthChangeEvent);
-
-        if (errorCode == telux::common::ErrorCode::SUCCESS) {
+        modemMgr_->updateSignalStrength(phoneId);
+        // notify signal strength only if any criteria is met
+        LOG(INFO, __FUNCTION__, " notification needed : ", notify);
+        if (notify) {
             ::eventService::EventResponse anyResponse;
             anyResponse.set_filter(telux::tel::TEL_PHONE_FILTER);
             anyResponse.mutable_any()->PackFrom(signalStrengthChangeEvent);
-            modemMgr_->updateSignalStrength(signalStrengthChangeEvent.phone_id());
-            // notify signal strength only if any criteria is met
-            LOG(INFO, __FUNCTION__, " notification needed : ", notify);
-            if (notify) {
-                auto f = std::async(std::launch::async, [this, anyResponse]() {
-                    this->triggerChangeEvent(anyResponse);
-                }).share();
-                taskQ_->add(f);
-            }
-        } else {
-            LOG(ERROR, __FUNCTION__, " Unable to read signal strength");
+            // The deltas only make sense applied in order, so they go through the ordered
+            // task thread of the queue
+            auto notifyTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(5000);
+            auto f = std::async(std::launch::deferred, [this, anyResponse, notifyTime]() {
+                this->triggerOrderedChangeEvent(anyResponse, notifyTime);
+            }).share();
+            taskQ_->add(f);
         }
     } else {
         LOG(ERROR, __FUNCTION__, " Unable to write signal strength");
@@ -384,9 +391,12 @@ void PhoneManagerServerImpl::handleCellInfoChanged(std::string eventParams) {
     }
 
     int phoneId;
+    bool changed = false;
     telux::common::ErrorCode errorCode = telux::tel::TelUtil::writeCellInfoListToJsonFile(params,
-        phoneId);
-    if (errorCode == telux::common::ErrorCode::SUCCESS) {
+        phoneId, changed);
+    if ((errorCode == telux::common::ErrorCode::SUCCESS) && (!changed)) {
+        LOG(DEBUG, __FUNCTION__, " Cell info list unchanged, not notified");
+    } else if (errorCode == telux::common::ErrorCode::SUCCESS) {
         ::telStub::CellInfoListEvent cellInfoListEvent;
         errorCode = telux::tel::TelUtil::readCellInfoListEventFromJsonFile(phoneId,
             cellInfoListEvent);
@@ -546,3 +556,132 @@ void PhoneManagerServerImpl::onEventUpdate(std::string event) {
         LOG(ERROR, __FUNCTION__, " Event not supported");
     }
 }
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::IsSubsystemReady(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::IsSubsystemReadyReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return IsSubsystemReady(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::GetPhoneIds(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, telStub::GetPhoneIdsReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetPhoneIds(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::GetPhoneId(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, telStub::GetPhoneIdReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetPhoneId(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::GetCellularCapabilities(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    telStub::CellularCapabilityInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetCellularCapabilities(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::SetOperatingMode(
+    grpc::CallbackServerContext* context, const telStub::SetOperatingModeRequest* request,
+    telStub::SetOperatingModeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetOperatingMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::GetOperatingMode(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    telStub::GetOperatingModeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetOperatingMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::ResetWwan(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, telStub::ResetWwanReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ResetWwan(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::RequestVoiceServiceState(
+    grpc::CallbackServerContext* context, const telStub::RequestVoiceServiceStateRequest* request,
+    telStub::RequestVoiceServiceStateReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestVoiceServiceState(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::SetRadioPower(
+    grpc::CallbackServerContext* context, const telStub::SetRadioPowerRequest* request,
+    telStub::SetRadioPowerReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetRadioPower(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::RequestCellInfoList(
+    grpc::CallbackServerContext* context, const telStub::RequestCellInfoListRequest* request,
+    telStub::RequestCellInfoListReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestCellInfoList(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::SetCellInfoListRate(
+    grpc::CallbackServerContext* context, const telStub::SetCellInfoListRateRequest* request,
+    telStub::SetCellInfoListRateReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetCellInfoListRate(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::GetSignalStrength(
+    grpc::CallbackServerContext* context, const telStub::GetSignalStrengthRequest* request,
+    telStub::GetSignalStrengthReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetSignalStrength(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::SetECallOperatingMode(
+    grpc::CallbackServerContext* context, const telStub::SetECallOperatingModeRequest* request,
+    telStub::SetECallOperatingModeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetECallOperatingMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::GetECallOperatingMode(
+    grpc::CallbackServerContext* context, const telStub::GetECallOperatingModeRequest* request,
+    telStub::GetECallOperatingModeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetECallOperatingMode(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::RequestOperatorInfo(
+    grpc::CallbackServerContext* context, const telStub::RequestOperatorInfoRequest* request,
+    telStub::RequestOperatorInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestOperatorInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::ConfigureSignalStrength(
+    grpc::CallbackServerContext* context, const telStub::ConfigureSignalStrengthRequest* request,
+    telStub::ConfigureSignalStrengthReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureSignalStrength(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::ConfigureSignalStrengthEx(
+    grpc::CallbackServerContext* context, const telStub::ConfigureSignalStrengthExRequest* request,
+    telStub::ConfigureSignalStrengthExReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ConfigureSignalStrengthEx(request, response); });
+}
+
+grpc::ServerUnaryReactor* PhoneManagerServerImpl::InitService(grpc::CallbackServerContext* context,
+    const ::google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
@@ -12,6 +12,7 @@
 #ifndef TELUX_TEL_PHONEMANAGERSERVERIMPL_HPP
 #define TELUX_TEL_PHONEMANAGERSERVERIMPL_HPP
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <telux/common/CommonDefines.hpp>
@@ -23,69 +24,108 @@
 
 using grpc::ServerContext;
 
-class PhoneManagerServerImpl final : public telStub::PhoneService::Service,
+class PhoneManagerServerImpl final : public telStub::PhoneService::CallbackService,
                                      public IServerEventListener,
                                      public std::enable_shared_from_this<PhoneManagerServerImpl> {
  public:
     PhoneManagerServerImpl();
     ~PhoneManagerServerImpl();
-    grpc::Status GetServiceStatus(ServerContext* context,
-        const google::protobuf::Empty *request,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status IsSubsystemReady(ServerContext* context,
-        const google::protobuf::Empty *request,
+    grpc::ServerUnaryReactor* IsSubsystemReady(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::IsSubsystemReadyReply* response) override;
-    grpc::Status GetPhoneIds(ServerContext *context,
-        const google::protobuf::Empty *request,
-        telStub::GetPhoneIdsReply* response) override;
-    grpc::Status GetPhoneId(ServerContext *context,
-        const google::protobuf::Empty *request,
-        telStub::GetPhoneIdReply* response) override;
-    grpc::Status GetCellularCapabilities(ServerContext *context,
-        const google::protobuf::Empty *request,
+    grpc::ServerUnaryReactor* GetPhoneIds(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, telStub::GetPhoneIdsReply* response) override;
+    grpc::ServerUnaryReactor* GetPhoneId(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, telStub::GetPhoneIdReply* response) override;
+    grpc::ServerUnaryReactor* GetCellularCapabilities(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         telStub::CellularCapabilityInfoReply* response) override;
-    grpc::Status SetOperatingMode(ServerContext* context,
+    grpc::ServerUnaryReactor* SetOperatingMode(grpc::CallbackServerContext* context,
         const telStub::SetOperatingModeRequest* request,
         telStub::SetOperatingModeReply* response) override;
-    grpc::Status GetOperatingMode(ServerContext* context, const google::protobuf::Empty* request,
-        telStub::GetOperatingModeReply* response) override;
-    grpc::Status ResetWwan(ServerContext* context,
+    grpc::ServerUnaryReactor* GetOperatingMode(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request, telStub::GetOperatingModeReply* response) override;
+    grpc::ServerUnaryReactor* ResetWwan(grpc::CallbackServerContext* context,
         const google::protobuf::Empty* request, telStub::ResetWwanReply* response) override;
-    grpc::Status RequestVoiceServiceState(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestVoiceServiceState(grpc::CallbackServerContext* context,
         const telStub::RequestVoiceServiceStateRequest* request,
         telStub::RequestVoiceServiceStateReply* response) override;
-    grpc::Status SetRadioPower(ServerContext* context,
+    grpc::ServerUnaryReactor* SetRadioPower(grpc::CallbackServerContext* context,
         const telStub::SetRadioPowerRequest* request,
         telStub::SetRadioPowerReply* response) override;
-    grpc::Status RequestCellInfoList(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestCellInfoList(grpc::CallbackServerContext* context,
         const telStub::RequestCellInfoListRequest* request,
         telStub::RequestCellInfoListReply* response) override;
-    grpc::Status SetCellInfoListRate(ServerContext* context,
+    grpc::ServerUnaryReactor* SetCellInfoListRate(grpc::CallbackServerContext* context,
         const telStub::SetCellInfoListRateRequest* request,
         telStub::SetCellInfoListRateReply* response) override;
-    grpc::Status GetSignalStrength(ServerContext* context,
+    grpc::ServerUnaryReactor* GetSignalStrength(grpc::CallbackServerContext* context,
         const telStub::GetSignalStrengthRequest* request,
         telStub::GetSignalStrengthReply* response) override;
-    grpc::Status SetECallOperatingMode(ServerContext* context,
+    grpc::ServerUnaryReactor* SetECallOperatingMode(grpc::CallbackServerContext* context,
         const telStub::SetECallOperatingModeRequest* request,
         telStub::SetECallOperatingModeReply* response) override;
-    grpc::Status GetECallOperatingMode(ServerContext* context,
+    grpc::ServerUnaryReactor* GetECallOperatingMode(grpc::CallbackServerContext* context,
         const telStub::GetECallOperatingModeRequest* request,
         telStub::GetECallOperatingModeReply* response) override;
-    grpc::Status RequestOperatorInfo(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestOperatorInfo(grpc::CallbackServerContext* context,
         const telStub::RequestOperatorInfoRequest* request,
         telStub::RequestOperatorInfoReply* response) override;
-    grpc::Status ConfigureSignalStrength(ServerContext* context,
+    grpc::ServerUnaryReactor* ConfigureSignalStrength(grpc::CallbackServerContext* context,
         const telStub::ConfigureSignalStrengthRequest* request,
         telStub::ConfigureSignalStrengthReply* response) override;
-    grpc::Status ConfigureSignalStrengthEx(ServerContext* context,
+    grpc::ServerUnaryReactor* ConfigureSignalStrengthEx(grpc::CallbackServerContext* context,
         const telStub::ConfigureSignalStrengthExRequest* request,
         telStub::ConfigureSignalStrengthExReply* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent message);
 
 private:
-    grpc::Status InitService(ServerContext *context, const ::google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response) override ;
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status IsSubsystemReady(const google::protobuf::Empty* request,
+        commonStub::IsSubsystemReadyReply* response);
+    grpc::Status GetPhoneIds(const google::protobuf::Empty* request,
+        telStub::GetPhoneIdsReply* response);
+    grpc::Status GetPhoneId(const google::protobuf::Empty* request,
+        telStub::GetPhoneIdReply* response);
+    grpc::Status GetCellularCapabilities(const google::protobuf::Empty* request,
+        telStub::CellularCapabilityInfoReply* response);
+    grpc::Status SetOperatingMode(const telStub::SetOperatingModeRequest* request,
+        telStub::SetOperatingModeReply* response);
+    grpc::Status GetOperatingMode(const google::protobuf::Empty* request,
+        telStub::GetOperatingModeReply* response);
+    grpc::Status ResetWwan(const google::protobuf::Empty* request,
+        telStub::ResetWwanReply* response);
+    grpc::Status RequestVoiceServiceState(const telStub::RequestVoiceServiceStateRequest* request,
+        telStub::RequestVoiceServiceStateReply* response);
+    grpc::Status SetRadioPower(const telStub::SetRadioPowerRequest* request,
+        telStub::SetRadioPowerReply* response);
+    grpc::Status RequestCellInfoList(const telStub::RequestCellInfoListRequest* request,
+        telStub::RequestCellInfoListReply* response);
+    grpc::Status SetCellInfoListRate(const telStub::SetCellInfoListRateRequest* request,
+        telStub::SetCellInfoListRateReply* response);
+    grpc::Status GetSignalStrength(const telStub::GetSignalStrengthRequest* request,
+        telStub::GetSignalStrengthReply* response);
+    grpc::Status SetECallOperatingMode(const telStub::SetECallOperatingModeRequest* request,
+        telStub::SetECallOperatingModeReply* response);
+    grpc::Status GetECallOperatingMode(const telStub::GetECallOperatingModeRequest* request,
+        telStub::GetECallOperatingModeReply* response);
+    grpc::Status RequestOperatorInfo(const telStub::RequestOperatorInfoRequest* request,
+        telStub::RequestOperatorInfoReply* response);
+    grpc::Status ConfigureSignalStrength(const telStub::ConfigureSignalStrengthRequest* request,
+        telStub::ConfigureSignalStrengthReply* response);
+    grpc::Status ConfigureSignalStrengthEx(const telStub::ConfigureSignalStrengthExRequest* request,
+        telStub::ConfigureSignalStrengthExReply* response);
+    grpc::Status InitService(const ::google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const ::google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response) override;
     //Read only API JSON Data
     telux::common::ServiceStatus readSubsystemStatus(int slotId);
     telux::common::ServiceStatus readSubsystemStatus(int slotId, int &cbDelay);
@@ -98,6 +138,8 @@ private:
     void handleECallOperatingModeChanged(std::string eventParams);
     void handleOperatorInfoChanged(std::string eventParams);
     void triggerChangeEvent(::eventService::EventResponse anyResponse);
+    void triggerOrderedChangeEvent(::eventService::EventResponse anyResponse,
+        std::chrono::steady_clock::time_point notifyTime);
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
     std::shared_ptr<telux::common::ModemManagerImpl> modemMgr_;
 };
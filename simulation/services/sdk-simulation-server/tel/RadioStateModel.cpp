@@ -0,0 +1,680 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "RadioStateModel.hpp"
+
+#include <cstdlib>
+#include <ctime>
+
+#include "TelUtil.hpp"
+#include "libs/common/CommonUtils.hpp"
+#include "libs/common/JsonParser.hpp"
+#include "libs/common/Logger.hpp"
+
+#define PHONE_JSON_API_PATH1 "api/tel/IPhoneManagerSlot1.json"
+#define PHONE_JSON_API_PATH2 "api/tel/IPhoneManagerSlot2.json"
+#define PHONE_JSON_STATE_PATH1 "system-state/tel/IPhoneManagerStateSlot1.json"
+#define PHONE_JSON_STATE_PATH2 "system-state/tel/IPhoneManagerStateSlot2.json"
+#define SERVING_JSON_STATE_PATH1 "system-state/tel/IServingSystemManagerStateSlot1.json"
+#define SERVING_JSON_STATE_PATH2 "system-state/tel/IServingSystemManagerStateSlot2.json"
+
+#define TEL_PHONE_MANAGER "IPhoneManager"
+#define INVALID_SIGNAL_STRENGTH_VALUE 0x7FFFFFFF
+#define MAX_THRESHOLD_LIST 10
+
+#define SLOT_1 1
+
+using telux::common::ErrorCode;
+
+namespace telux {
+namespace tel {
+
+/* RATs reported in a signal strength notification */
+static const int REPORTED_RATS[] = {
+    telStub::RadioTechnology::RADIO_TECH_GSM,
+    telStub::RadioTechnology::RADIO_TECH_UMTS,
+    telStub::RadioTechnology::RADIO_TECH_LTE,
+    telStub::RadioTechnology::RADIO_TECH_NR5G,
+    telStub::RadioTechnology::RADIO_TECH_NB1_NTN
+};
+
+static bool hasRatInfo(const telStub::SignalStrength &signalStrength, int rat) {
+    switch (rat) {
+        case telStub::RadioTechnology::RADIO_TECH_GSM:
+            return signalStrength.has_gsm_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_UMTS:
+            return signalStrength.has_wcdma_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_LTE:
+            return signalStrength.has_lte_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_NR5G:
+            return signalStrength.has_nr5g_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_NB1_NTN:
+            return signalStrength.has_nb1_ntn_signal_strength_info();
+        default:
+            return false;
+    }
+}
+
+static const google::protobuf::Message &getRatInfo(const telStub::SignalStrength &signalStrength,
+    int rat) {
+    switch (rat) {
+        case telStub::RadioTechnology::RADIO_TECH_GSM:
+            return signalStrength.gsm_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_UMTS:
+            return signalStrength.wcdma_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_LTE:
+            return signalStrength.lte_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_NR5G:
+            return signalStrength.nr5g_signal_strength_info();
+        default:
+            return signalStrength.nb1_ntn_signal_strength_info();
+    }
+}
+
+static google::protobuf::Message *getMutableRatInfo(telStub::SignalStrength &signalStrength,
+    int rat) {
+    switch (rat) {
+        case telStub::RadioTechnology::RADIO_TECH_GSM:
+            return signalStrength.mutable_gsm_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_UMTS:
+            return signalStrength.mutable_wcdma_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_LTE:
+            return signalStrength.mutable_lte_signal_strength_info();
+        case telStub::RadioTechnology::RADIO_TECH_NR5G:
+            return signalStrength.mutable_nr5g_signal_strength_info();
+        default:
+            return signalStrength.mutable_nb1_ntn_signal_strength_info();
+    }
+}
+
+static void setInvalid(telStub::SignalStrength &signalStrength, int rat) {
+    switch (rat) {
+        case telStub::RadioTechnology::RADIO_TECH_GSM: {
+            auto info = signalStrength.mutable_gsm_signal_strength_info();
+            info->set_gsm_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_gsm_bit_error_rate(INVALID_SIGNAL_STRENGTH_VALUE);
+            break;
+        }
+        case telStub::RadioTechnology::RADIO_TECH_UMTS: {
+            auto info = signalStrength.mutable_wcdma_signal_strength_info();
+            info->set_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_bit_error_rate(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_ecio(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_rscp(INVALID_SIGNAL_STRENGTH_VALUE);
+            break;
+        }
+        case telStub::RadioTechnology::RADIO_TECH_LTE: {
+            auto info = signalStrength.mutable_lte_signal_strength_info();
+            info->set_lte_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_lte_rsrp(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_lte_rsrq(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_lte_rssnr(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_lte_cqi(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_timing_advance(INVALID_SIGNAL_STRENGTH_VALUE);
+            break;
+        }
+        case telStub::RadioTechnology::RADIO_TECH_NR5G: {
+            auto info = signalStrength.mutable_nr5g_signal_strength_info();
+            info->set_rsrp(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_rsrq(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_rssnr(INVALID_SIGNAL_STRENGTH_VALUE);
+            break;
+        }
+        case telStub::RadioTechnology::RADIO_TECH_NB1_NTN: {
+            auto info = signalStrength.mutable_nb1_ntn_signal_strength_info();
+            info->set_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_rsrp(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_rsrq(INVALID_SIGNAL_STRENGTH_VALUE);
+            info->set_rssnr(INVALID_SIGNAL_STRENGTH_VALUE);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void fromJson(const Json::Value &info, telStub::SignalStrength &signalStrength) {
+    const Json::Value &gsm = info["gsmSignalStrengthInfo"];
+    signalStrength.mutable_gsm_signal_strength_info()->set_gsm_signal_strength(
+        gsm["gsmSignalStrength"].asInt());
+    signalStrength.mutable_gsm_signal_strength_info()->set_gsm_bit_error_rate(
+        gsm["gsmBitErrorRate"].asInt());
+    const Json::Value &wcdma = info["wcdmaSignalStrengthInfo"];
+    signalStrength.mutable_wcdma_signal_strength_info()->set_signal_strength(
+        wcdma["signalStrength"].asInt());
+    signalStrength.mutable_wcdma_signal_strength_info()->set_bit_error_rate(
+        wcdma["bitErrorRate"].asInt());
+    signalStrength.mutable_wcdma_signal_strength_info()->set_ecio(wcdma["ecio"].asInt());
+    signalStrength.mutable_wcdma_signal_strength_info()->set_rscp(wcdma["rscp"].asInt());
+    const Json::Value &lte = info["lteSignalStrengthInfo"];
+    signalStrength.mutable_lte_signal_strength_info()->set_lte_signal_strength(
+        lte["lteSignalStrength"].asInt());
+    signalStrength.mutable_lte_signal_strength_info()->set_lte_rsrp(lte["lteRsrp"].asInt());
+    signalStrength.mutable_lte_signal_strength_info()->set_lte_rsrq(lte["lteRsrq"].asInt());
+    signalStrength.mutable_lte_signal_strength_info()->set_lte_rssnr(lte["lteRssnr"].asInt());
+    signalStrength.mutable_lte_signal_strength_info()->set_lte_cqi(lte["lteCqi"].asInt());
+    signalStrength.mutable_lte_signal_strength_info()->set_timing_advance(
+        lte["timingAdvance"].asInt());
+    const Json::Value &nr5g = info["nr5gSignalStrengthInfo"];
+    signalStrength.mutable_nr5g_signal_strength_info()->set_rsrp(nr5g["rsrp"].asInt());
+    signalStrength.mutable_nr5g_signal_strength_info()->set_rsrq(nr5g["rsrq"].asInt());
+    signalStrength.mutable_nr5g_signal_strength_info()->set_rssnr(nr5g["rssnr"].asInt());
+    const Json::Value &nb1Ntn = info["nb1NtnSignalStrengthInfo"];
+    signalStrength.mutable_nb1_ntn_signal_strength_info()->set_signal_strength(
+        nb1Ntn["signalStrength"].asInt());
+    signalStrength.mutable_nb1_ntn_signal_strength_info()->set_rsrp(nb1Ntn["rsrp"].asInt());
+    signalStrength.mutable_nb1_ntn_signal_strength_info()->set_rsrq(nb1Ntn["rsrq"].asInt());
+    signalStrength.mutable_nb1_ntn_signal_strength_info()->set_rssnr(nb1Ntn["rssnr"].asInt());
+}
+
+static void toJson(const telStub::SignalStrength &signalStrength, Json::Value &info) {
+    const auto &gsm = signalStrength.gsm_signal_strength_info();
+    info["gsmSignalStrengthInfo"]["gsmSignalStrength"] = gsm.gsm_signal_strength();
+    info["gsmSignalStrengthInfo"]["gsmBitErrorRate"] = gsm.gsm_bit_error_rate();
+    const auto &wcdma = signalStrength.wcdma_signal_strength_info();
+    info["wcdmaSignalStrengthInfo"]["signalStrength"] = wcdma.signal_strength();
+    info["wcdmaSignalStrengthInfo"]["bitErrorRate"] = wcdma.bit_error_rate();
+    info["wcdmaSignalStrengthInfo"]["ecio"] = wcdma.ecio();
+    info["wcdmaSignalStrengthInfo"]["rscp"] = wcdma.rscp();
+    const auto &lte = signalStrength.lte_signal_strength_info();
+    info["lteSignalStrengthInfo"]["lteSignalStrength"] = lte.lte_signal_strength();
+    info["lteSignalStrengthInfo"]["lteRsrp"] = lte.lte_rsrp();
+    info["lteSignalStrengthInfo"]["lteRsrq"] = lte.lte_rsrq();
+    info["lteSignalStrengthInfo"]["lteRssnr"] = lte.lte_rssnr();
+    info["lteSignalStrengthInfo"]["lteCqi"] = lte.lte_cqi();
+    info["lteSignalStrengthInfo"]["timingAdvance"] = lte.timing_advance();
+    const auto &nr5g = signalStrength.nr5g_signal_strength_info();
+    info["nr5gSignalStrengthInfo"]["rsrp"] = nr5g.rsrp();
+    info["nr5gSignalStrengthInfo"]["rsrq"] = nr5g.rsrq();
+    info["nr5gSignalStrengthInfo"]["rssnr"] = nr5g.rssnr();
+    const auto &nb1Ntn = signalStrength.nb1_ntn_signal_strength_info();
+    info["nb1NtnSignalStrengthInfo"]["signalStrength"] = nb1Ntn.signal_strength();
+    info["nb1NtnSignalStrengthInfo"]["rsrp"] = nb1Ntn.rsrp();
+    info["nb1NtnSignalStrengthInfo"]["rsrq"] = nb1Ntn.rsrq();
+    info["nb1NtnSignalStrengthInfo"]["rssnr"] = nb1Ntn.rssnr();
+}
+
+RadioStateModel &RadioStateModel::getInstance() {
+    static RadioStateModel instance;
+    return instance;
+}
+
+RadioStateModel::RadioStateModel()
+   : timerService_(telux::common::TimerService::getInstance()) {
+    LOG(DEBUG, __FUNCTION__);
+}
+
+RadioStateModel::~RadioStateModel() {
+    LOG(DEBUG, __FUNCTION__);
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < NUM_SLOTS; i++) {
+        if (slots_[i].flushTimerId != telux::common::TimerService::INVALID_TIMER_ID) {
+            timerService_->cancel(slots_[i].flushTimerId);
+            slots_[i].flushTimerId = telux::common::TimerService::INVALID_TIMER_ID;
+        }
+        flushLocked(i + SLOT_1, slots_[i]);
+    }
+}
+
+RadioStateModel::SlotState *RadioStateModel::getSlot(int phoneId) {
+    if ((phoneId < SLOT_1) || (phoneId >= SLOT_1 + NUM_SLOTS)) {
+        LOG(ERROR, __FUNCTION__, " Invalid phone id ", phoneId);
+        return nullptr;
+    }
+    SlotState &slot = slots_[phoneId - SLOT_1];
+    if (!slot.isLoaded) {
+        loadLocked(phoneId, slot);
+    }
+    return &slot;
+}
+
+void RadioStateModel::loadLocked(int phoneId, SlotState &slot) {
+    LOG(DEBUG, __FUNCTION__, " Slot: ", phoneId);
+    Json::Value rootObj;
+    std::string jsonfilename = (phoneId == SLOT_1) ? PHONE_JSON_STATE_PATH1 :
+        PHONE_JSON_STATE_PATH2;
+    if (JsonParser::readFromJsonFile(rootObj, jsonfilename) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Reading JSON File failed! ", jsonfilename);
+    }
+    fromJson(rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"], slot.signalStrength);
+    slot.cellList = rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"];
+    /* Clients start without a valid signal strength until the first notification */
+    for (int rat : REPORTED_RATS) {
+        setInvalid(slot.notified, rat);
+    }
+    slot.isLoaded = true;
+}
+
+telux::common::ErrorCode RadioStateModel::readServingRatLocked(int phoneId, SlotState &slot) {
+    std::string jsonfilename = (phoneId == SLOT_1) ? SERVING_JSON_STATE_PATH1 :
+        SERVING_JSON_STATE_PATH2;
+    int64_t mtime = TelUtil::getJsonFileModifiedTime(jsonfilename);
+    if ((slot.servingRat >= 0) && (mtime == slot.servingFileMtime)) {
+        return ErrorCode::SUCCESS;
+    }
+    telStub::RadioTechnology servingRat;
+    telStub::ServiceDomainInfo_Domain servingDomain;
+    ErrorCode error = TelUtil::readSystemInfoFromJsonFile(phoneId, servingRat, servingDomain);
+    if (error != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Reading System Info failed");
+        return error;
+    }
+    slot.servingRat = servingRat;
+    slot.servingFileMtime = mtime;
+    LOG(DEBUG, __FUNCTION__, " Serving RAT is: ", slot.servingRat);
+    return error;
+}
+
+void RadioStateModel::compileCriteriaLocked(int phoneId, SlotState &slot) {
+    std::string apiJsonPath = (phoneId == SLOT_1) ? PHONE_JSON_API_PATH1 : PHONE_JSON_API_PATH2;
+    std::string stateJsonPath = (phoneId == SLOT_1) ? PHONE_JSON_STATE_PATH1 :
+        PHONE_JSON_STATE_PATH2;
+    int64_t mtime = TelUtil::getJsonFileModifiedTime(apiJsonPath);
+    if (slot.isCriteriaValid && (mtime == slot.criteriaFileMtime)) {
+        return;
+    }
+    LOG(DEBUG, __FUNCTION__, " Slot: ", phoneId);
+    for (auto &criteriaPerRat : slot.criteria) {
+        for (auto &criteria : criteriaPerRat) {
+            criteria.isSet = false;
+            criteria.configTypes.clear();
+            criteria.thresholds.clear();
+            criteria.delta = 0;
+            criteria.hysteresisDb = 0;
+        }
+    }
+    JsonData data;
+    ErrorCode error = telux::common::CommonUtils::readJsonData(apiJsonPath, stateJsonPath,
+        TEL_PHONE_MANAGER, "configureSignalStrength", data);
+    slot.isCriteriaValid = true;
+    slot.criteriaFileMtime = mtime;
+    slot.isCriteriaRead = (error == ErrorCode::SUCCESS);
+    slot.hysteresisMs = 0;
+    if (!slot.isCriteriaRead) {
+        LOG(ERROR, __FUNCTION__, " Unable to read from JSON");
+        return;
+    }
+    slot.isCriteriaEnabled = (data.status == telux::common::Status::SUCCESS);
+    const Json::Value &config = data.stateRootObj[TEL_PHONE_MANAGER]
+        ["configureSignalStrengthExInfo"];
+    slot.hysteresisMs = config["hysteresisMs"].asInt();
+    const Json::Value &configList = config["configureSignalStrengthExInfoList"];
+    for (const Json::Value &entry : configList) {
+        int rat = entry["radioTech"].asInt();
+        int sigMeasType = entry["sigMeasType"].asInt();
+        if ((rat < 0) || (rat >= telStub::RadioTechnology_ARRAYSIZE) || (sigMeasType < 0)
+            || (sigMeasType >= telStub::SignalStrengthMeasurementType_ARRAYSIZE)) {
+            LOG(ERROR, __FUNCTION__, " Ignoring criteria for RAT ", rat, " type ", sigMeasType);
+            continue;
+        }
+        Criteria &criteria = slot.criteria[rat][sigMeasType];
+        if (criteria.isSet) {
+            continue;
+        }
+        criteria.isSet = true;
+        for (const Json::Value &configType : entry["configExType"]) {
+            criteria.configTypes.push_back(configType.asInt());
+        }
+        criteria.delta = static_cast<uint16_t>(entry["delta"].asInt());
+        criteria.hysteresisDb = static_cast<uint16_t>(entry["hysteresisDb"].asInt());
+        const Json::Value &thresholdList = entry["thresholdList"];
+        if ((thresholdList.size() > 0) && (thresholdList.size() <= MAX_THRESHOLD_LIST)) {
+            for (const Json::Value &threshold : thresholdList) {
+                criteria.thresholds.push_back(threshold.asInt() / 10);
+            }
+        }
+    }
+    LOG(DEBUG, __FUNCTION__, " hysteresis timer : ", static_cast<int>(slot.hysteresisMs),
+        " criteria count : ", configList.size());
+}
+
+/*
+ * Checks the signal strength criteria which control the notification
+ * based on the criteria set on subscription.
+ * HysteresisMs is set, it is the highest priority and other criteria is ignored.
+ * Delta or thresholdList can be set as criteria on particular RAT(rat+sigMeasType),
+ * hysteresisDb can be applied only on top of thresholdList. If none of the criteria
+ * is specified, as per on-target behaviour default values(specified in the RIL) are
+ * set.
+ * For example: RSSI(50), ECIO(10), SNR(40), RSRQ(20), RSRP(60), RSCP(40)
+ */
+bool RadioStateModel::checkCriteriaLocked(SlotState &slot, int rat, int sigMeasType,
+    int oldValue, int newValue) {
+    if (!slot.isCriteriaRead) {
+        // notify if no signal strength config criteria is set
+        return true;
+    }
+    if (!slot.isCriteriaEnabled) {
+        return false;
+    }
+    // if hysteresis timer is set, skip other criteria check
+    if (slot.hysteresisMs > 0) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - slot.lastNotification);
+        return (elapsed.count() > slot.hysteresisMs);
+    }
+    const Criteria &criteria = slot.criteria[rat][sigMeasType];
+    int diff = 0;
+    if (!criteria.isSet) {
+        int defaultDelta = 0;
+        switch (sigMeasType) {
+            case telStub::SignalStrengthMeasurementType::RSSI:
+                defaultDelta = 50;
+                break;
+            case telStub::SignalStrengthMeasurementType::ECIO:
+                defaultDelta = 10;
+                break;
+            case telStub::SignalStrengthMeasurementType::SNR:
+            case telStub::SignalStrengthMeasurementType::RSCP:
+                defaultDelta = 40;
+                break;
+            case telStub::SignalStrengthMeasurementType::RSRP:
+                defaultDelta = 60;
+                break;
+            case telStub::SignalStrengthMeasurementType::RSRQ:
+                defaultDelta = 20;
+                break;
+            default:
+                break;
+        }
+        diff = std::abs(newValue - oldValue);
+        return (diff >= (defaultDelta / 10));
+    }
+
+    bool notify = false;
+    int diffSoFar = 0;
+    int thresholdValue = 0;
+    for (int configType : criteria.configTypes) {
+        if (configType == telStub::SignalStrengthConfigExType::EX_DELTA) {
+            diff = std::abs(newValue - oldValue);
+            if (diff >= (criteria.delta / 10)) {
+                notify = true;
+            }
+        } else if ((configType == telStub::SignalStrengthConfigExType::EX_THRESHOLD)
+            && (!criteria.thresholds.empty())) {
+            // signal strength(RSSI) and SNR is passed as positive integer, convert to negative
+            // to compare with threshold. SNR can be negative or positive(range -200 to 300)
+            if (((sigMeasType == telStub::SignalStrengthMeasurementType::RSSI)
+                || (sigMeasType == telStub::SignalStrengthMeasurementType::SNR))
+                && (oldValue > 0) && (newValue > 0)) {
+                oldValue = -oldValue;
+                newValue = -newValue;
+            }
+            for (int threshold : criteria.thresholds) {
+                if (((newValue < threshold) && (threshold <= oldValue))
+                    || ((oldValue < threshold) && (threshold <= newValue))) {
+                    notify = true;
+                    diff = std::abs(newValue - threshold);
+                    if (diff >= diffSoFar) {
+                        diffSoFar = diff;
+                        thresholdValue = threshold;
+                    }
+                }
+            }
+        }
+        if (configType == telStub::SignalStrengthConfigExType::EX_HYSTERESIS_DB) {
+            if (notify && (criteria.hysteresisDb > 0)) {
+                // threshold criteria is satisfied, check the distance from the threshold
+                diff = std::abs(newValue - thresholdValue);
+            }
+            if (diff > (criteria.hysteresisDb / 10)) {
+                notify = true;
+            }
+        }
+    }
+    return notify;
+}
+
+bool RadioStateModel::checkRatCriteriaLocked(SlotState &slot,
+    const telStub::SignalStrength &oldValue, const telStub::SignalStrength &newValue, int rat) {
+    // if any one field meets the criteria, need to notify, skip next field check
+    auto check = [this, &slot, rat](int sigMeasType, int oldField, int newField) {
+        return (oldField != newField)
+            && checkCriteriaLocked(slot, rat, sigMeasType, oldField, newField);
+    };
+    switch (rat) {
+        case telStub::RadioTechnology::RADIO_TECH_GSM: {
+            const auto &o = oldValue.gsm_signal_strength_info();
+            const auto &n = newValue.gsm_signal_strength_info();
+            return check(telStub::SignalStrengthMeasurementType::RSSI,
+                o.gsm_signal_strength(), n.gsm_signal_strength());
+        }
+        case telStub::RadioTechnology::RADIO_TECH_UMTS: {
+            const auto &o = oldValue.wcdma_signal_strength_info();
+            const auto &n = newValue.wcdma_signal_strength_info();
+            return check(telStub::SignalStrengthMeasurementType::RSSI,
+                    o.signal_strength(), n.signal_strength())
+                || check(telStub::SignalStrengthMeasurementType::ECIO, o.ecio(), n.ecio())
+                || check(telStub::SignalStrengthMeasurementType::RSCP, o.rscp(), n.rscp());
+        }
+        case telStub::RadioTechnology::RADIO_TECH_LTE: {
+            const auto &o = oldValue.lte_signal_strength_info();
+            const auto &n = newValue.lte_signal_strength_info();
+            return check(telStub::SignalStrengthMeasurementType::RSSI,
+                    o.lte_signal_strength(), n.lte_signal_strength())
+                || check(telStub::SignalStrengthMeasurementType::RSRP,
+                    o.lte_rsrp(), n.lte_rsrp())
+                || check(telStub::SignalStrengthMeasurementType::RSRQ,
+                    o.lte_rsrq(), n.lte_rsrq())
+                || check(telStub::SignalStrengthMeasurementType::SNR,
+                    o.lte_rssnr(), n.lte_rssnr());
+        }
+        case telStub::RadioTechnology::RADIO_TECH_NR5G: {
+            const auto &o = oldValue.nr5g_signal_strength_info();
+            const auto &n = newValue.nr5g_signal_strength_info();
+            return check(telStub::SignalStrengthMeasurementType::RSRP, o.rsrp(), n.rsrp())
+                || check(telStub::SignalStrengthMeasurementType::RSRQ, o.rsrq(), n.rsrq())
+                || check(telStub::SignalStrengthMeasurementType::SNR, o.rssnr(), n.rssnr());
+        }
+        case telStub::RadioTechnology::RADIO_TECH_NB1_NTN: {
+            const auto &o = oldValue.nb1_ntn_signal_strength_info();
+            const auto &n = newValue.nb1_ntn_signal_strength_info();
+            return check(telStub::SignalStrengthMeasurementType::RSSI,
+                    o.signal_strength(), n.signal_strength())
+                || check(telStub::SignalStrengthMeasurementType::RSRP, o.rsrp(), n.rsrp())
+                || check(telStub::SignalStrengthMeasurementType::RSRQ, o.rsrq(), n.rsrq())
+                || check(telStub::SignalStrengthMeasurementType::SNR, o.rssnr(), n.rssnr());
+        }
+        default:
+            return false;
+    }
+}
+
+void RadioStateModel::getReportedLocked(SlotState &slot, telStub::SignalStrength &reported) {
+    for (int rat : REPORTED_RATS) {
+        if (rat == slot.servingRat) {
+            getMutableRatInfo(reported, rat)->CopyFrom(getRatInfo(slot.signalStrength, rat));
+        } else {
+            setInvalid(reported, rat);
+        }
+    }
+}
+
+telux::common::ErrorCode RadioStateModel::updateSignalStrength(int phoneId,
+    const telStub::SignalStrength &update, bool &notify,
+    telStub::SignalStrengthChangeEvent &event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    notify = false;
+    SlotState *slot = getSlot(phoneId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    ErrorCode error = readServingRatLocked(phoneId, *slot);
+    if (error != ErrorCode::SUCCESS) {
+        return error;
+    }
+    compileCriteriaLocked(phoneId, *slot);
+
+    for (int rat : REPORTED_RATS) {
+        if (!hasRatInfo(update, rat)) {
+            continue;
+        }
+        // only the serving RAT is reported, so only its criteria are checked
+        if ((rat == slot->servingRat) && (!notify)) {
+            notify = checkRatCriteriaLocked(*slot, slot->signalStrength, update, rat);
+        }
+        getMutableRatInfo(slot->signalStrength, rat)->CopyFrom(getRatInfo(update, rat));
+    }
+    slot->isSignalStrengthDirty = true;
+    scheduleFlushLocked(phoneId, *slot);
+    LOG(DEBUG, __FUNCTION__, " need to notify : ", notify);
+    if (!notify) {
+        return ErrorCode::SUCCESS;
+    }
+
+    // The event carries the serving RAT, and the other RATs only if they changed since the
+    // last notification, e.g. the previous serving RAT which is now invalid
+    telStub::SignalStrength reported;
+    getReportedLocked(*slot, reported);
+    event.Clear();
+    event.set_phone_id(phoneId);
+    for (int rat : REPORTED_RATS) {
+        const google::protobuf::Message &info = getRatInfo(reported, rat);
+        if ((rat == slot->servingRat)
+            || (info.SerializeAsString()
+                != getRatInfo(slot->notified, rat).SerializeAsString())) {
+            getMutableRatInfo(*event.mutable_signal_strength(), rat)->CopyFrom(info);
+            getMutableRatInfo(slot->notified, rat)->CopyFrom(info);
+        }
+    }
+    // last notification time (this will be used if hysteresis timer criteria is set)
+    slot->lastNotification = std::chrono::steady_clock::now();
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode RadioStateModel::setSignalStrength(int phoneId,
+    const telStub::SignalStrength &signalStrength) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlot(phoneId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    for (int rat : REPORTED_RATS) {
+        getMutableRatInfo(slot->signalStrength, rat)->CopyFrom(getRatInfo(signalStrength, rat));
+        getMutableRatInfo(slot->notified, rat)->CopyFrom(getRatInfo(signalStrength, rat));
+    }
+    slot->isSignalStrengthDirty = true;
+    scheduleFlushLocked(phoneId, *slot);
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode RadioStateModel::getSignalStrength(int phoneId,
+    telStub::SignalStrength &signalStrength) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlot(phoneId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    ErrorCode error = readServingRatLocked(phoneId, *slot);
+    if (error != ErrorCode::SUCCESS) {
+        return error;
+    }
+    getReportedLocked(*slot, signalStrength);
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode RadioStateModel::updateCellInfoList(int phoneId,
+    const Json::Value &cellList, bool &changed) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    changed = false;
+    SlotState *slot = getSlot(phoneId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    if (slot->cellList == cellList) {
+        LOG(DEBUG, __FUNCTION__, " Cell info list unchanged");
+        return ErrorCode::SUCCESS;
+    }
+    slot->cellList = cellList;
+    changed = true;
+    slot->isCellInfoDirty = true;
+    scheduleFlushLocked(phoneId, *slot);
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode RadioStateModel::getCellInfoList(int phoneId, Json::Value &cellList) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlot(phoneId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    cellList = slot->cellList;
+    return ErrorCode::SUCCESS;
+}
+
+void RadioStateModel::invalidateCriteria(int phoneId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlot(phoneId);
+    if (slot) {
+        slot->isCriteriaValid = false;
+    }
+}
+
+void RadioStateModel::scheduleFlushLocked(int phoneId, SlotState &slot) {
+    if (slot.flushTimerId != telux::common::TimerService::INVALID_TIMER_ID) {
+        return;
+    }
+    timerService_->runAfter(FLUSH_INTERVAL_MS, [this, phoneId]() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        SlotState &slot = slots_[phoneId - SLOT_1];
+        slot.flushTimerId = telux::common::TimerService::INVALID_TIMER_ID;
+        flushLocked(phoneId, slot);
+    }, &slot.flushTimerId);
+}
+
+void RadioStateModel::flush(int phoneId) {
+    if ((phoneId < SLOT_1) || (phoneId >= SLOT_1 + NUM_SLOTS)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState &slot = slots_[phoneId - SLOT_1];
+    if (slot.flushTimerId != telux::common::TimerService::INVALID_TIMER_ID) {
+        timerService_->cancel(slot.flushTimerId);
+        slot.flushTimerId = telux::common::TimerService::INVALID_TIMER_ID;
+    }
+    flushLocked(phoneId, slot);
+}
+
+void RadioStateModel::flushLocked(int phoneId, SlotState &slot) {
+    if ((!slot.isSignalStrengthDirty) && (!slot.isCellInfoDirty)) {
+        return;
+    }
+    LOG(DEBUG, __FUNCTION__, " Slot: ", phoneId);
+    Json::Value rootObj;
+    std::string jsonfilename = (phoneId == SLOT_1) ? PHONE_JSON_STATE_PATH1 :
+        PHONE_JSON_STATE_PATH2;
+    if (JsonParser::readFromJsonFile(rootObj, jsonfilename) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Reading JSON File failed! ", jsonfilename);
+        return;
+    }
+    if (slot.isSignalStrengthDirty) {
+        toJson(slot.signalStrength, rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]);
+    }
+    if (slot.isSignalStrengthDirty
+        && (slot.lastNotification != std::chrono::steady_clock::time_point())) {
+        // wall clock time of the last notification, for reference only
+        std::time_t lastNotification = std::chrono::system_clock::to_time_t(
+            std::chrono::system_clock::now() - std::chrono::duration_cast<
+                std::chrono::system_clock::duration>(
+                    std::chrono::steady_clock::now() - slot.lastNotification));
+        char buffer[32];
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S",
+            std::localtime(&lastNotification));
+        rootObj[TEL_PHONE_MANAGER]["lastNotificationInfo"]["ssNotificationTimeStamp"] =
+            std::string(buffer);
+    }
+    if (slot.isCellInfoDirty) {
+        rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"] = slot.cellList;
+    }
+    if (JsonParser::writeToJsonFile(rootObj, jsonfilename) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Writing JSON File failed! ", jsonfilename);
+        return;
+    }
+    slot.isSignalStrengthDirty = false;
+    slot.isCellInfoDirty = false;
+}
+
+}  // end of namespace tel
+}  // end of namespace telux
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       RadioStateModel.hpp
+ *
+ * @brief      RadioStateModel keeps the signal strength, cell info list and serving RAT of
+ *             each slot in memory, so that radio events don't read and write the phone
+ *             system-state JSON file for every update. Signal strength notification criteria
+ *             are compiled into a table indexed by RAT and measurement type.
+ *             Changes are written to the system-state file at most once per flush interval,
+ *             or before the signal strength or cell info list is read from it.
+ */
+
+#ifndef RADIO_STATE_MODEL_HPP
+#define RADIO_STATE_MODEL_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <jsoncpp/json/json.h>
+#include <telux/common/CommonDefines.hpp>
+
+#include "libs/common/TimerService.hpp"
+#include "protos/proto-src/tel_simulation.grpc.pb.h"
+
+namespace telux {
+namespace tel {
+
+class RadioStateModel {
+ public:
+    static RadioStateModel &getInstance();
+
+    /**
+     * Applies the RATs present in the update on top of the current signal strength.
+     *
+     * @param [out] notify    true if the notification criteria of the serving RAT are met
+     * @param [out] event     Serving RAT and the RATs whose reported values changed since the
+     *                        last notification, valid when notify is true
+     */
+    telux::common::ErrorCode updateSignalStrength(int phoneId,
+        const telStub::SignalStrength &update, bool &notify,
+        telStub::SignalStrengthChangeEvent &event);
+
+    /**
+     * Replaces the signal strength of all RATs with a value that has already been notified.
+     */
+    telux::common::ErrorCode setSignalStrength(int phoneId,
+        const telStub::SignalStrength &signalStrength);
+
+    /**
+     * Gets the signal strength as reported to clients, only the serving RAT is valid.
+     */
+    telux::common::ErrorCode getSignalStrength(int phoneId,
+        telStub::SignalStrength &signalStrength);
+
+    /**
+     * @param [out] changed    false if the list is the same as the current one
+     */
+    telux::common::ErrorCode updateCellInfoList(int phoneId, const Json::Value &cellList,
+        bool &changed);
+    telux::common::ErrorCode getCellInfoList(int phoneId, Json::Value &cellList);
+
+    /**
+     * Recompiles the notification criteria on their next use, called when they are configured.
+     */
+    void invalidateCriteria(int phoneId);
+
+    /**
+     * Writes pending changes of the slot to its system-state file.
+     */
+    void flush(int phoneId);
+
+    ~RadioStateModel();
+
+ private:
+    static const int FLUSH_INTERVAL_MS = 1000;
+    static const int NUM_SLOTS = 2;
+
+    struct Criteria {
+        bool isSet;
+        /* Config types in the order they were configured, they are evaluated in that order */
+        std::vector<int> configTypes;
+        int delta;
+        std::vector<int> thresholds;
+        int hysteresisDb;
+    };
+
+    struct SlotState {
+        bool isLoaded = false;
+        /* Last values received for all RATs */
+        telStub::SignalStrength signalStrength;
+        /* Values of the last notification, only the serving RAT at that time is valid */
+        telStub::SignalStrength notified;
+        std::chrono::steady_clock::time_point lastNotification;
+        Json::Value cellList;
+        bool isSignalStrengthDirty = false;
+        bool isCellInfoDirty = false;
+        telux::common::TimerService::TimerId flushTimerId
+            = telux::common::TimerService::INVALID_TIMER_ID;
+
+        int servingRat = -1;
+        int64_t servingFileMtime = -1;
+
+        bool isCriteriaValid = false;
+        /* false if the criteria couldn't be read, every change is notified then */
+        bool isCriteriaRead = false;
+        /* false if the configureSignalStrength API is configured to fail */
+        bool isCriteriaEnabled = false;
+        int64_t criteriaFileMtime = -1;
+        uint16_t hysteresisMs = 0;
+        Criteria criteria[telStub::RadioTechnology_ARRAYSIZE]
+            [telStub::SignalStrengthMeasurementType_ARRAYSIZE];
+    };
+
+    RadioStateModel();
+    RadioStateModel(const RadioStateModel &) = delete;
+    RadioStateModel &operator=(const RadioStateModel &) = delete;
+
+    SlotState *getSlot(int phoneId);
+    void loadLocked(int phoneId, SlotState &slot);
+    telux::common::ErrorCode readServingRatLocked(int phoneId, SlotState &slot);
+    void compileCriteriaLocked(int phoneId, SlotState &slot);
+    bool checkCriteriaLocked(SlotState &slot, int rat, int sigMeasType, int oldValue,
+        int newValue);
+    bool checkRatCriteriaLocked(SlotState &slot, const telStub::SignalStrength &oldValue,
+        const telStub::SignalStrength &newValue, int rat);
+    void getReportedLocked(SlotState &slot, telStub::SignalStrength &reported);
+    void scheduleFlushLocked(int phoneId, SlotState &slot);
+    void flushLocked(int phoneId, SlotState &slot);
+
+    std::mutex mutex_;
+    std::shared_ptr<telux::common::TimerService> timerService_;
+    SlotState slots_[NUM_SLOTS];
+};
+
+}  // end of namespace tel
+}  // end of namespace telux
+
+#endif  // RADIO_STATE_MODEL_HPP
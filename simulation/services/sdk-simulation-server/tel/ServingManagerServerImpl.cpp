@@ -4,6 +4,7 @@
  */
 
 #include "ServingManagerServerImpl.hpp"
+#include "common/RpcExecutor.hpp"
 #include <thread>
 #include "libs/tel/TelDefinesStub.hpp"
 #include "libs/common/CommonUtils.hpp"
@@ -36,13 +37,13 @@ ServingManagerServerImpl::~ServingManagerServerImpl() {
     }
 }
 
-grpc::Status ServingManagerServerImpl::CleanUpService(ServerContext* context,
-    const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) {
+grpc::Status ServingManagerServerImpl::CleanUpService(const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::InitService(ServerContext* context,
+grpc::Status ServingManagerServerImpl::InitService(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -72,7 +73,7 @@ grpc::Status ServingManagerServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::GetServiceStatus(ServerContext* context,
+grpc::Status ServingManagerServerImpl::GetServiceStatus(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     Json::Value rootObj;
@@ -90,7 +91,7 @@ grpc::Status ServingManagerServerImpl::GetServiceStatus(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::RequestRATPreference(ServerContext* context,
+grpc::Status ServingManagerServerImpl::RequestRATPreference(
     const ::telStub::RequestRATPreferenceRequest* request,
     telStub::RequestRATPreferenceReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -128,9 +129,8 @@ grpc::Status ServingManagerServerImpl::RequestRATPreference(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::SetRATPreference(ServerContext* context,
-    const ::telStub::SetRATPreferenceRequest* request,
-    telStub::SetRATPreferenceReply* response) {
+grpc::Status ServingManagerServerImpl::SetRATPreference(
+    const ::telStub::SetRATPreferenceRequest* request, telStub::SetRATPreferenceReply* response) {
 
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->phone_id() == SLOT_1)? JSON_PATH1 : JSON_PATH2;
@@ -192,7 +192,7 @@ grpc::Status ServingManagerServerImpl::SetRATPreference(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::RequestServiceDomainPreference(ServerContext* context,
+grpc::Status ServingManagerServerImpl::RequestServiceDomainPreference(
     const ::telStub::RequestServiceDomainPreferenceRequest* request,
     telStub::RequestServiceDomainPreferenceReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -227,7 +227,7 @@ grpc::Status ServingManagerServerImpl::RequestServiceDomainPreference(ServerCont
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::SetServiceDomainPreference(ServerContext* context,
+grpc::Status ServingManagerServerImpl::SetServiceDomainPreference(
     const ::telStub::SetServiceDomainPreferenceRequest* request,
     telStub::SetServiceDomainPreferenceReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -328,8 +328,7 @@ void ServingManagerServerImpl::triggerSystemSelectionPreferenceEvent(int slotId,
     eventImpl.updateEventQueue(anyResponse);
 }
 
-grpc::Status ServingManagerServerImpl::GetDcStatus(ServerContext* context,
-    const ::telStub::GetDcStatusRequest* request,
+grpc::Status ServingManagerServerImpl::GetDcStatus(const ::telStub::GetDcStatusRequest* request,
     telStub::GetDcStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string stateJsonPath = (request->phone_id() == SLOT_1 ) ?
@@ -346,8 +345,7 @@ grpc::Status ServingManagerServerImpl::GetDcStatus(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::GetSystemInfo(ServerContext* context,
-    const ::telStub::GetSystemInfoRequest* request,
+grpc::Status ServingManagerServerImpl::GetSystemInfo(const ::telStub::GetSystemInfoRequest* request,
     telStub::GetSystemInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->phone_id() == SLOT_1)? JSON_PATH1 : JSON_PATH2;
@@ -379,7 +377,7 @@ grpc::Status ServingManagerServerImpl::GetSystemInfo(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::RequestNetworkTime(ServerContext* context,
+grpc::Status ServingManagerServerImpl::RequestNetworkTime(
     const ::telStub::RequestNetworkTimeRequest* request,
     telStub::RequestNetworkTimeReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -433,9 +431,8 @@ grpc::Status ServingManagerServerImpl::RequestNetworkTime(ServerContext* context
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::RequestRFBandInfo(ServerContext* context,
-    const ::telStub::RequestRFBandInfoRequest* request,
-    telStub::RequestRFBandInfoReply* response) {
+grpc::Status ServingManagerServerImpl::RequestRFBandInfo(
+    const ::telStub::RequestRFBandInfoRequest* request, telStub::RequestRFBandInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
     std::string apiJsonPath = (request->phone_id() == SLOT_1)? JSON_PATH1 : JSON_PATH2;
     std::string stateJsonPath = (request->phone_id() == SLOT_1)? JSON_PATH3 : JSON_PATH4;
@@ -469,7 +466,7 @@ grpc::Status ServingManagerServerImpl::RequestRFBandInfo(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::GetNetworkRejectInfo(ServerContext* context,
+grpc::Status ServingManagerServerImpl::GetNetworkRejectInfo(
     const ::telStub::GetNetworkRejectInfoRequest* request,
     telStub::GetNetworkRejectInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -509,7 +506,7 @@ grpc::Status ServingManagerServerImpl::GetNetworkRejectInfo(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::GetCallBarringInfo(ServerContext* context,
+grpc::Status ServingManagerServerImpl::GetCallBarringInfo(
     const ::telStub::GetCallBarringInfoRequest* request,
     telStub::GetCallBarringInfoReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -547,7 +544,7 @@ grpc::Status ServingManagerServerImpl::GetCallBarringInfo(ServerContext* context
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::GetSmsCapabilityOverNetwork(ServerContext* context,
+grpc::Status ServingManagerServerImpl::GetSmsCapabilityOverNetwork(
     const ::telStub::GetSmsCapabilityOverNetworkRequest* request,
     telStub::GetSmsCapabilityOverNetworkReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -577,7 +574,7 @@ grpc::Status ServingManagerServerImpl::GetSmsCapabilityOverNetwork(ServerContext
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::GetLteCsCapability(ServerContext* context,
+grpc::Status ServingManagerServerImpl::GetLteCsCapability(
     const ::telStub::GetLteCsCapabilityRequest* request,
     telStub::GetLteCsCapabilityReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -604,7 +601,7 @@ grpc::Status ServingManagerServerImpl::GetLteCsCapability(ServerContext* context
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::RequestRFBandPreferences(ServerContext* context,
+grpc::Status ServingManagerServerImpl::RequestRFBandPreferences(
     const ::telStub::RequestRFBandPreferencesRequest* request,
     telStub::RequestRFBandPreferencesReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -666,7 +663,7 @@ grpc::Status ServingManagerServerImpl::RequestRFBandPreferences(ServerContext* c
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::SetRFBandPreferences(ServerContext* context,
+grpc::Status ServingManagerServerImpl::SetRFBandPreferences(
     const ::telStub::SetRFBandPreferencesRequest* request,
     telStub::SetRFBandPreferencesReply* response) {
 
@@ -753,7 +750,7 @@ grpc::Status ServingManagerServerImpl::SetRFBandPreferences(ServerContext* conte
     return grpc::Status::OK;
 }
 
-grpc::Status ServingManagerServerImpl::RequestRFBandCapability(ServerContext* context,
+grpc::Status ServingManagerServerImpl::RequestRFBandCapability(
     const ::telStub::RequestRFBandCapabilityRequest* request,
     telStub::RequestRFBandCapabilityReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -1539,3 +1536,132 @@ void ServingManagerServerImpl::onServerEvent(google::protobuf::Any event) {
         LOG(DEBUG, __FUNCTION__, "Received Operating Mode Change Event");
     }
 }
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::RequestRATPreference(
+    grpc::CallbackServerContext* context, const ::telStub::RequestRATPreferenceRequest* request,
+    telStub::RequestRATPreferenceReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestRATPreference(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::SetRATPreference(
+    grpc::CallbackServerContext* context, const ::telStub::SetRATPreferenceRequest* request,
+    telStub::SetRATPreferenceReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetRATPreference(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::RequestServiceDomainPreference(
+    grpc::CallbackServerContext* context,
+    const ::telStub::RequestServiceDomainPreferenceRequest* request,
+    telStub::RequestServiceDomainPreferenceReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestServiceDomainPreference(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::SetServiceDomainPreference(
+    grpc::CallbackServerContext* context,
+    const ::telStub::SetServiceDomainPreferenceRequest* request,
+    telStub::SetServiceDomainPreferenceReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetServiceDomainPreference(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::GetSystemInfo(
+    grpc::CallbackServerContext* context, const ::telStub::GetSystemInfoRequest* request,
+    telStub::GetSystemInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetSystemInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::GetDcStatus(
+    grpc::CallbackServerContext* context, const ::telStub::GetDcStatusRequest* request,
+    telStub::GetDcStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetDcStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::RequestNetworkTime(
+    grpc::CallbackServerContext* context, const ::telStub::RequestNetworkTimeRequest* request,
+    telStub::RequestNetworkTimeReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestNetworkTime(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::RequestRFBandInfo(
+    grpc::CallbackServerContext* context, const ::telStub::RequestRFBandInfoRequest* request,
+    telStub::RequestRFBandInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestRFBandInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::GetNetworkRejectInfo(
+    grpc::CallbackServerContext* context, const ::telStub::GetNetworkRejectInfoRequest* request,
+    telStub::GetNetworkRejectInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetNetworkRejectInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::GetCallBarringInfo(
+    grpc::CallbackServerContext* context, const ::telStub::GetCallBarringInfoRequest* request,
+    telStub::GetCallBarringInfoReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetCallBarringInfo(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::GetSmsCapabilityOverNetwork(
+    grpc::CallbackServerContext* context,
+    const ::telStub::GetSmsCapabilityOverNetworkRequest* request,
+    telStub::GetSmsCapabilityOverNetworkReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetSmsCapabilityOverNetwork(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::GetLteCsCapability(
+    grpc::CallbackServerContext* context, const ::telStub::GetLteCsCapabilityRequest* request,
+    telStub::GetLteCsCapabilityReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetLteCsCapability(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::RequestRFBandPreferences(
+    grpc::CallbackServerContext* context, const ::telStub::RequestRFBandPreferencesRequest* request,
+    telStub::RequestRFBandPreferencesReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestRFBandPreferences(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::SetRFBandPreferences(
+    grpc::CallbackServerContext* context, const ::telStub::SetRFBandPreferencesRequest* request,
+    telStub::SetRFBandPreferencesReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetRFBandPreferences(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::RequestRFBandCapability(
+    grpc::CallbackServerContext* context, const ::telStub::RequestRFBandCapabilityRequest* request,
+    telStub::RequestRFBandCapabilityReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestRFBandCapability(request, response); });
+}
+
+grpc::ServerUnaryReactor* ServingManagerServerImpl::CleanUpService(
+    grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CleanUpService(request, response); });
+}
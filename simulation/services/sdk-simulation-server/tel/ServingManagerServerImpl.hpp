@@ -18,7 +18,7 @@
 
 #include <telux/tel/ServingSystemManager.hpp>
 
-class ServingManagerServerImpl final : public telStub::ServingSystemService::Service,
+class ServingManagerServerImpl final : public telStub::ServingSystemService::CallbackService,
                                        public IServerEventListener,
                                        public
                                        std::enable_shared_from_this<ServingManagerServerImpl> {
@@ -26,63 +26,103 @@ class ServingManagerServerImpl final : public telStub::ServingSystemService::Ser
 public:
     ServingManagerServerImpl();
     ~ServingManagerServerImpl();
-    grpc::Status InitService(ServerContext* context,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status GetServiceStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status RequestRATPreference(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestRATPreference(grpc::CallbackServerContext* context,
         const ::telStub::RequestRATPreferenceRequest* request,
         telStub::RequestRATPreferenceReply* response) override;
-    grpc::Status SetRATPreference(ServerContext* context,
+    grpc::ServerUnaryReactor* SetRATPreference(grpc::CallbackServerContext* context,
         const ::telStub::SetRATPreferenceRequest* request,
         telStub::SetRATPreferenceReply* response) override;
-    grpc::Status RequestServiceDomainPreference(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestServiceDomainPreference(grpc::CallbackServerContext* context,
         const ::telStub::RequestServiceDomainPreferenceRequest* request,
         telStub::RequestServiceDomainPreferenceReply* response) override;
-    grpc::Status SetServiceDomainPreference(ServerContext* context,
+    grpc::ServerUnaryReactor* SetServiceDomainPreference(grpc::CallbackServerContext* context,
         const ::telStub::SetServiceDomainPreferenceRequest* request,
         telStub::SetServiceDomainPreferenceReply* response) override;
-    grpc::Status GetSystemInfo(ServerContext* context,
+    grpc::ServerUnaryReactor* GetSystemInfo(grpc::CallbackServerContext* context,
         const ::telStub::GetSystemInfoRequest* request,
         telStub::GetSystemInfoReply* response) override;
-    grpc::Status GetDcStatus(ServerContext* context,
-        const ::telStub::GetDcStatusRequest* request,
-        telStub::GetDcStatusReply* response) override;
-    grpc::Status RequestNetworkTime(ServerContext* context,
+    grpc::ServerUnaryReactor* GetDcStatus(grpc::CallbackServerContext* context,
+        const ::telStub::GetDcStatusRequest* request, telStub::GetDcStatusReply* response) override;
+    grpc::ServerUnaryReactor* RequestNetworkTime(grpc::CallbackServerContext* context,
         const ::telStub::RequestNetworkTimeRequest* request,
         telStub::RequestNetworkTimeReply* response) override;
-    grpc::Status RequestRFBandInfo(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestRFBandInfo(grpc::CallbackServerContext* context,
         const ::telStub::RequestRFBandInfoRequest* request,
         telStub::RequestRFBandInfoReply* response) override;
-    grpc::Status GetNetworkRejectInfo(ServerContext* context,
+    grpc::ServerUnaryReactor* GetNetworkRejectInfo(grpc::CallbackServerContext* context,
         const ::telStub::GetNetworkRejectInfoRequest* request,
         telStub::GetNetworkRejectInfoReply* response) override;
-    grpc::Status GetCallBarringInfo(ServerContext* context,
+    grpc::ServerUnaryReactor* GetCallBarringInfo(grpc::CallbackServerContext* context,
         const ::telStub::GetCallBarringInfoRequest* request,
         telStub::GetCallBarringInfoReply* response) override;
-    grpc::Status GetSmsCapabilityOverNetwork(ServerContext* context,
+    grpc::ServerUnaryReactor* GetSmsCapabilityOverNetwork(grpc::CallbackServerContext* context,
         const ::telStub::GetSmsCapabilityOverNetworkRequest* request,
-        telStub::GetSmsCapabilityOverNetworkReply* response);
-    grpc::Status GetLteCsCapability(ServerContext* context,
+        telStub::GetSmsCapabilityOverNetworkReply* response) override;
+    grpc::ServerUnaryReactor* GetLteCsCapability(grpc::CallbackServerContext* context,
         const ::telStub::GetLteCsCapabilityRequest* request,
         telStub::GetLteCsCapabilityReply* response) override;
-    grpc::Status RequestRFBandPreferences(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestRFBandPreferences(grpc::CallbackServerContext* context,
         const ::telStub::RequestRFBandPreferencesRequest* request,
         telStub::RequestRFBandPreferencesReply* response) override;
-    grpc::Status SetRFBandPreferences(ServerContext* context,
+    grpc::ServerUnaryReactor* SetRFBandPreferences(grpc::CallbackServerContext* context,
         const ::telStub::SetRFBandPreferencesRequest* request,
         telStub::SetRFBandPreferencesReply* response) override;
-    grpc::Status RequestRFBandCapability(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestRFBandCapability(grpc::CallbackServerContext* context,
         const ::telStub::RequestRFBandCapabilityRequest* request,
         telStub::RequestRFBandCapabilityReply* response) override;
-    grpc::Status CleanUpService(ServerContext* context,
+    grpc::ServerUnaryReactor* CleanUpService(grpc::CallbackServerContext* context,
         const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent message) override;
     void onServerEvent(google::protobuf::Any event) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status RequestRATPreference(const ::telStub::RequestRATPreferenceRequest* request,
+        telStub::RequestRATPreferenceReply* response);
+    grpc::Status SetRATPreference(const ::telStub::SetRATPreferenceRequest* request,
+        telStub::SetRATPreferenceReply* response);
+    grpc::Status RequestServiceDomainPreference(
+        const ::telStub::RequestServiceDomainPreferenceRequest* request,
+        telStub::RequestServiceDomainPreferenceReply* response);
+    grpc::Status SetServiceDomainPreference(
+        const ::telStub::SetServiceDomainPreferenceRequest* request,
+        telStub::SetServiceDomainPreferenceReply* response);
+    grpc::Status GetSystemInfo(const ::telStub::GetSystemInfoRequest* request,
+        telStub::GetSystemInfoReply* response);
+    grpc::Status GetDcStatus(const ::telStub::GetDcStatusRequest* request,
+        telStub::GetDcStatusReply* response);
+    grpc::Status RequestNetworkTime(const ::telStub::RequestNetworkTimeRequest* request,
+        telStub::RequestNetworkTimeReply* response);
+    grpc::Status RequestRFBandInfo(const ::telStub::RequestRFBandInfoRequest* request,
+        telStub::RequestRFBandInfoReply* response);
+    grpc::Status GetNetworkRejectInfo(const ::telStub::GetNetworkRejectInfoRequest* request,
+        telStub::GetNetworkRejectInfoReply* response);
+    grpc::Status GetCallBarringInfo(const ::telStub::GetCallBarringInfoRequest* request,
+        telStub::GetCallBarringInfoReply* response);
+    grpc::Status GetSmsCapabilityOverNetwork(
+        const ::telStub::GetSmsCapabilityOverNetworkRequest* request,
+        telStub::GetSmsCapabilityOverNetworkReply* response);
+    grpc::Status GetLteCsCapability(const ::telStub::GetLteCsCapabilityRequest* request,
+        telStub::GetLteCsCapabilityReply* response);
+    grpc::Status RequestRFBandPreferences(const ::telStub::RequestRFBandPreferencesRequest* request,
+        telStub::RequestRFBandPreferencesReply* response);
+    grpc::Status SetRFBandPreferences(const ::telStub::SetRFBandPreferencesRequest* request,
+        telStub::SetRFBandPreferencesReply* response);
+    grpc::Status RequestRFBandCapability(const ::telStub::RequestRFBandCapabilityRequest* request,
+        telStub::RequestRFBandCapabilityReply* response);
+    grpc::Status CleanUpService(const ::google::protobuf::Empty* request,
+        ::google::protobuf::Empty* response);
+
     void triggerChangeEvent(::eventService::EventResponse anyResponse);
     void onEventUpdate(std::string event);
     void handleSystemSelectionPreferenceChanged(std::string eventParams);
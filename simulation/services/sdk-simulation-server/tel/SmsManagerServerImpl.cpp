@@ -37,6 +37,7 @@
 #include "libs/tel/TelDefinesStub.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
 #include "event/EventService.hpp"
+#include "common/RpcExecutor.hpp"
 #include <telux/common/DeviceConfig.hpp>
 
 #define JSON_PATH1 "system-state/tel/ISmsManagerStateSlot1.json"
@@ -56,6 +57,11 @@
 SmsManagerServerImpl::SmsManagerServerImpl() {
     LOG(DEBUG, __FUNCTION__);
     readJson();
+    smsStores_[SLOT_1] = std::make_shared<SmsStore>(JSON_PATH1, TEL_SMS_MANAGER);
+    smsStores_[SLOT_2] = std::make_shared<SmsStore>(JSON_PATH2, TEL_SMS_MANAGER);
+    for (auto &store : smsStores_) {
+        store.second->load();
+    }
 }
 
 grpc::Status SmsManagerServerImpl::readJson() {
@@ -105,8 +111,7 @@ bool SmsManagerServerImpl::isCallbackNeeded(Json::Value rootObj, std::string api
     return isCallback;
 }
 
-grpc::Status SmsManagerServerImpl::InitService(ServerContext* context,
-    const ::commonStub::GetServiceStatusRequest* request,
+grpc::Status SmsManagerServerImpl::InitService(const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     Json::Value rootObj;
     int phoneId = request->phone_id();
@@ -130,7 +135,7 @@ grpc::Status SmsManagerServerImpl::InitService(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::GetServiceStatus(ServerContext* context,
+grpc::Status SmsManagerServerImpl::GetServiceStatus(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
 
@@ -155,8 +160,27 @@ void SmsManagerServerImpl::getJsonForApiResponseSlot(int phoneId, std::string& j
     rootObj = jsonObjApiResponseSlot_[phoneId];
 }
 
-grpc::Status SmsManagerServerImpl::SetSmscAddress(ServerContext* context,
-    const ::telStub::SetSmscAddressRequest* request,
+std::shared_ptr<SmsStore> SmsManagerServerImpl::getSmsStore(int phoneId) {
+    auto it = smsStores_.find(phoneId);
+    if (it == smsStores_.end()) {
+        LOG(ERROR, __FUNCTION__, " No SMS storage for phoneId ", phoneId);
+        return nullptr;
+    }
+    return it->second;
+}
+
+void SmsManagerServerImpl::writeSystemData(int phoneId, std::string jsonfilename,
+    Json::Value rootObj) {
+    std::shared_ptr<SmsStore> store = getSmsStore(phoneId);
+    if (store) {
+        store->compact(rootObj);
+    } else {
+        JsonParser::writeToJsonFile(rootObj, jsonfilename);
+    }
+    jsonObjSystemStateSlot_[phoneId] = rootObj;
+}
+
+grpc::Status SmsManagerServerImpl::SetSmscAddress(const ::telStub::SetSmscAddressRequest* request,
     telStub::SetSmscAddressReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
@@ -176,8 +200,7 @@ grpc::Status SmsManagerServerImpl::SetSmscAddress(ServerContext* context,
         CommonUtils::getValues(jsonObjApiResponse, TEL_SMS_MANAGER, apiname, status, error, delay);
         if(status == telux::common::Status::SUCCESS) {
             rootObj[TEL_SMS_MANAGER]["setSmscAddress"]["smscAddress"] = smscAddress;
-            JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
+            writeSystemData(phoneId, jsonfilename, rootObj);
         }
 
         //Create response
@@ -190,8 +213,7 @@ grpc::Status SmsManagerServerImpl::SetSmscAddress(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::GetSmscAddress(ServerContext* context,
-    const ::telStub::GetSmscAddressRequest* request,
+grpc::Status SmsManagerServerImpl::GetSmscAddress(const ::telStub::GetSmscAddressRequest* request,
     telStub::GetSmscAddressReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
@@ -226,17 +248,14 @@ grpc::Status SmsManagerServerImpl::GetSmscAddress(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::RequestSmsMessageList(ServerContext* context,
+grpc::Status SmsManagerServerImpl::RequestSmsMessageList(
     const ::telStub::RequestSmsMessageListRequest* request,
     telStub::RequestSmsMessageListReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId = request->phone_id();
-    std::string jsonfilename = "";
     std::string apiname = "requestSmsMessageList";
-    Json::Value rootObj;
     grpc::Status readStatus = readJson();
     if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
         std::string jsonObjApiResponseFileName = "";
         Json::Value jsonObjApiResponse;
         getJsonForApiResponseSlot(phoneId, jsonObjApiResponseFileName, jsonObjApiResponse);
@@ -248,36 +267,15 @@ grpc::Status SmsManagerServerImpl::RequestSmsMessageList(ServerContext* context,
         int delay;
         CommonUtils::getValues(jsonObjApiResponse, TEL_SMS_MANAGER, apiname, status, error, delay);
 
-        if(status == telux::common::Status::SUCCESS) {
-            int size = getSMSStorage(phoneId);
-            for (int i = 0; i < size; i++) {
-                telux::tel::SmsTagType typeInput = type;
-                telux::tel::SmsMetaInfo Info;
-                if (type == telux::tel::SmsTagType::UNKNOWN) {
-                    Info.msgIndex =
-                    rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][i]\
-                        ["smsMetaInfo_msgIndex"].asInt();
-                    std::string tagType =
-                    rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][i]\
-                        ["smsMetaInfo_tagType"].asString();
-                    Info.tagType = Helper::getTagType(tagType);
-                    infos.push_back(Info);
-                } else if ((type == telux::tel::SmsTagType::MT_READ) ||
-                            (type == telux::tel::SmsTagType::MT_NOT_READ)) {
-                    std::string tag =
-                    rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][i]\
-                        ["smsMetaInfo_tagType"].asString();
-                    telux::tel::SmsTagType tagType = Helper::getTagType(tag);
-                    if(typeInput == tagType ) {
-                        Info.msgIndex =
-                        rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][i]\
-                            ["smsMetaInfo_msgIndex"].asInt();
-                        Info.tagType =  tagType;
-                        infos.push_back(Info);
-                    }
-                } else {
-                    status = telux::common::Status::NOTSUPPORTED;
-                }
+        std::shared_ptr<SmsStore> store = getSmsStore(phoneId);
+        if(status == telux::common::Status::SUCCESS && store) {
+            if (type == telux::tel::SmsTagType::UNKNOWN) {
+                infos = store->getMetaInfos();
+            } else if ((type == telux::tel::SmsTagType::MT_READ) ||
+                        (type == telux::tel::SmsTagType::MT_NOT_READ)) {
+                infos = store->getMetaInfos(type);
+            } else {
+                status = telux::common::Status::NOTSUPPORTED;
             }
         }
         //Create response
@@ -304,55 +302,28 @@ grpc::Status SmsManagerServerImpl::RequestSmsMessageList(ServerContext* context,
     return readStatus;
     }
 
-int SmsManagerServerImpl::getSMSStorage(int phoneId) {
-    LOG(DEBUG, __FUNCTION__);
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    getJsonForSystemData(phoneId, jsonfilename, rootObj);
-    int size = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"].size();
-    LOG(DEBUG, __FUNCTION__, "size of SmsDatabaseStorage is", size);
-    return size;
-}
-
-grpc::Status SmsManagerServerImpl::ReadMessage(ServerContext *context,
-    const telStub::ReadMessageRequest *request, telStub::ReadMessageReply *response) {
+grpc::Status SmsManagerServerImpl::ReadMessage(const telStub::ReadMessageRequest *request,
+    telStub::ReadMessageReply *response) {
 
     LOG(DEBUG, __FUNCTION__);
-    std::string jsonfilename = "";
     std::string apiname = "readMessage";
-    Json::Value rootObj;
     int phoneId = request->phone_id();
     uint32_t messageIndex = request->msg_index();
     LOG(ERROR, __FUNCTION__, " MsgIndex ", messageIndex );
     grpc::Status readStatus = readJson();
     if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
         std::string jsonObjApiResponseFileName = "";
         Json::Value jsonObjApiResponse;
         getJsonForApiResponseSlot(phoneId, jsonObjApiResponseFileName, jsonObjApiResponse);
-        uint32_t size = getSMSStorage(phoneId);
-        uint32_t index_for_db;
         SmsMsg msg;
         telux::common::Status status;
         telux::common::ErrorCode error;
         int delay;
-        bool found = false;
         CommonUtils::getValues(jsonObjApiResponse, TEL_SMS_MANAGER, apiname, status, error, delay);
 
         if(status == telux::common::Status::SUCCESS) {
-            for (index_for_db = 0; index_for_db < size; index_for_db++) {
-                uint32_t Id = -1;
-                Id = std::stoi(rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index_for_db]\
-                    ["smsMetaInfo_msgIndex"].asString());
-                LOG(DEBUG, __FUNCTION__, " MsgIndex ", Id);
-                if(Id == messageIndex ) {
-                    LOG(DEBUG, __FUNCTION__, " Fetching data at MsgIndex ", index_for_db);
-                    parseMessageAtIndex(phoneId, index_for_db, msg);
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
+            std::shared_ptr<SmsStore> store = getSmsStore(phoneId);
+            if (!store || !store->get(messageIndex, msg)) {
                 LOG(ERROR, __FUNCTION__, " MsgIndex ", messageIndex ," not found");
                 error = telux::common::ErrorCode::INVALID_INDEX;
             }
@@ -399,49 +370,11 @@ grpc::Status SmsManagerServerImpl::ReadMessage(ServerContext *context,
     return readStatus;
 }
 
-void SmsManagerServerImpl::parseMessageAtIndex(int phoneId, int index, SmsMsg& msg ) {
-    LOG(DEBUG, __FUNCTION__,"Index", index );
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
-        msg.text = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index]["text"].asString();
-        LOG(DEBUG, __FUNCTION__,"text_", msg.text );
-        msg.sender = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index]["sender"].asString();
-        msg.receiver = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index]\
-            ["receiver"].asString();
-        std::string encoding = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index]\
-            ["encoding"].asString();
-        msg.encoding = Helper::getencodingMethod(encoding);
-        msg.pdu = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index]["pdu"].asString();
-        msg.msgIndex = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index]\
-            ["smsMetaInfo_msgIndex"].asInt();
-        msg.messageInfoRefNumber = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"]\
-            [index]["messagePartInfo_refNumber"].asInt();
-        msg.messageInfoSegments = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"]\
-            [index]["messagePartInfo_numberOfSegments"].asInt();
-        msg.messageInfoSegmentNumber = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"]\
-            [index]["messagePartInfo_segmentNumber"].asInt();
-        LOG(DEBUG, __FUNCTION__,"messagePartInfo_refNumber", msg.messageInfoRefNumber );
-        LOG(DEBUG, __FUNCTION__,"messagePartInfo_numberOfSegments", msg.messageInfoSegments );
-        LOG(DEBUG, __FUNCTION__,"messagePartInfo_segmentNumber", msg.messageInfoSegmentNumber );
-        std::string tagType = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"]\
-            [index]["smsMetaInfo_tagType"].asString();
-        msg.tagType = Helper::getTagType(tagType );
-        msg.isMetaInfoValid = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"]\
-            [index]["isMetaInfoValid"].asBool();
-        msg.pduBuffer = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index]["rawPdu"].asString();
-    }
-}
-
-grpc::Status SmsManagerServerImpl::DeleteMessage(ServerContext *context,
-    const telStub::DeleteMessageRequest *request, telStub::DeleteMessageRequestReply *response) {
+grpc::Status SmsManagerServerImpl::DeleteMessage(const telStub::DeleteMessageRequest *request,
+    telStub::DeleteMessageRequestReply *response) {
 
     LOG(DEBUG, __FUNCTION__);
-    std::string jsonfilename = "";
     std::string apiname = "deleteMessage";
-    Json::Value rootObj;
     telux::common::ErrorCode error;
     telux::common::Status status;
     int delay;
@@ -451,7 +384,6 @@ grpc::Status SmsManagerServerImpl::DeleteMessage(ServerContext *context,
     telux::tel::SmsTagType tagType = static_cast<telux::tel::SmsTagType>(tag);
     grpc::Status readStatus = readJson();
     if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
         std::string jsonObjApiResponseFileName = "";
         Json::Value jsonObjApiResponse;
         getJsonForApiResponseSlot(phoneId, jsonObjApiResponseFileName, jsonObjApiResponse);
@@ -459,42 +391,19 @@ grpc::Status SmsManagerServerImpl::DeleteMessage(ServerContext *context,
         telux::tel::DeleteType deltype = static_cast<telux::tel::DeleteType>(deleteType);
         CommonUtils::getValues(jsonObjApiResponse, TEL_SMS_MANAGER, apiname, status, error, delay);
 
-        if(status == telux::common::Status::SUCCESS) {
-            uint32_t size = getSMSStorage(phoneId);
-            uint32_t index_for_db;
-            int adjust_index = 0;
-            bool delAtIndex = true;
-            std::vector<int> indexstodelete;
-            for (index_for_db = 0; index_for_db < size; index_for_db++) {
-                if(deltype == telux::tel::DeleteType::DELETE_MESSAGES_BY_TAG) {
-                    std::string tag =
-                    rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index_for_db]\
-                        ["smsMetaInfo_tagType"].asString().c_str();
-                    if (Helper::getTagType(tag) == tagType) {
-                        int tmp = index_for_db - adjust_index;
-                        indexstodelete.push_back(tmp);
-                        adjust_index++;
-                    }
-                } else if (deltype == telux::tel::DeleteType::DELETE_MSG_AT_INDEX) {
-                    uint32_t Id =
-                    rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index_for_db]\
-                        ["smsMetaInfo_msgIndex"].asInt();
-                    if(Id == messageIndex) {
-                        indexstodelete.push_back(index_for_db);
-                        break;
-                    }
-                } else if (deltype == telux::tel::DeleteType::DELETE_ALL) {
-                    Json::Value newRoot;
-                    rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"] = newRoot["SmsDatabaseStorage"];
-                    JsonParser::writeToJsonFile(rootObj, jsonfilename);
-                    jsonObjSystemStateSlot_[phoneId] = rootObj;
-                    delAtIndex = false;
-                } else {
-                    status = telux::common::Status::NOTSUPPORTED;
+        std::shared_ptr<SmsStore> store = getSmsStore(phoneId);
+        if(status == telux::common::Status::SUCCESS && store) {
+            if(deltype == telux::tel::DeleteType::DELETE_MESSAGES_BY_TAG) {
+                int count = store->removeByTag(tagType);
+                LOG(DEBUG, __FUNCTION__, " No of entries deleted are ", count);
+            } else if (deltype == telux::tel::DeleteType::DELETE_MSG_AT_INDEX) {
+                if (!store->remove(messageIndex)) {
+                    LOG(DEBUG, __FUNCTION__, " MsgIndex ", messageIndex, " not found");
                 }
-            }
-            if(delAtIndex) {
-                error = deletedSmsatIndex(phoneId, indexstodelete);
+            } else if (deltype == telux::tel::DeleteType::DELETE_ALL) {
+                store->clear();
+            } else {
+                status = telux::common::Status::NOTSUPPORTED;
             }
         }
         //Create respone
@@ -508,42 +417,7 @@ grpc::Status SmsManagerServerImpl::DeleteMessage(ServerContext *context,
     return readStatus;
 }
 
-telux::common::ErrorCode SmsManagerServerImpl::deletedSmsatIndex(int phoneId,
-    std::vector<int> index) {
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    ErrorCode error;
-    grpc::Status readStatus = readJson();
-    if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
-        LOG(DEBUG, __FUNCTION__, " No of entries to be deleted are  ", index.size());
-        for (auto itr = index.begin(); itr !=index.end(); itr++) {
-            Json::Value newRoot;
-            error = JsonParser::readFromJsonFile(rootObj, jsonfilename);
-            if (error != ErrorCode::SUCCESS) {
-                LOG(ERROR, __FUNCTION__, " Reading JSON File failed!");
-            }
-            int numprofiles = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"].size();
-            LOG(DEBUG, __FUNCTION__, numprofiles);
-
-            int newCount = 0;
-            for (int i=0; i < numprofiles; i++) {
-                if(i != *itr) {
-                    newRoot["SmsDatabaseStorage"][newCount] =
-                        rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][i];
-                    newCount++;
-                } else {
-                    LOG(DEBUG, __FUNCTION__, " The index deleting currently is  ", *itr);
-                }
-            }
-            rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"] = newRoot["SmsDatabaseStorage"];
-            error = JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
-        }
-    }
-    return error;
-}
-grpc::Status SmsManagerServerImpl::SetPreferredStorage(ServerContext *context,
+grpc::Status SmsManagerServerImpl::SetPreferredStorage(
     const telStub::SetPreferredStorageRequest *request,
     telStub::SetPreferredStorageReply *response) {
 
@@ -568,8 +442,7 @@ grpc::Status SmsManagerServerImpl::SetPreferredStorage(ServerContext *context,
         if(status == telux::common::Status::SUCCESS) {
             std::string storage = Helper::storageTypeToString(type);
             rootObj[TEL_SMS_MANAGER]["setPreferredStorage"]["storageType"] = storage;
-            JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
+            writeSystemData(phoneId, jsonfilename, rootObj);
         }
 
         //Create response
@@ -582,7 +455,7 @@ grpc::Status SmsManagerServerImpl::SetPreferredStorage(ServerContext *context,
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::RequestPreferredStorage(ServerContext *context,
+grpc::Status SmsManagerServerImpl::RequestPreferredStorage(
     const telStub::RequestPreferredStorageRequest *request,
     telStub::RequestPreferredStorageReply *response) {
 
@@ -622,21 +495,17 @@ grpc::Status SmsManagerServerImpl::RequestPreferredStorage(ServerContext *contex
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::SetTag(ServerContext *context,
-    const telStub::SetTagRequest *request, telStub::SetTagReply *response) {
+grpc::Status SmsManagerServerImpl::SetTag(const telStub::SetTagRequest *request,
+    telStub::SetTagReply *response) {
 
     LOG(DEBUG, __FUNCTION__);
-    std::string jsonfilename = "";
     std::string apiname = "setTag";
-    Json::Value rootObj;
     telux::common::ErrorCode error;
     telux::common::Status status;
     int delay;
-    bool foundMsgIndex = true;
     int phoneId = request->phone_id();
     grpc::Status readStatus = readJson();
     if(readStatus.ok()) {
-        getJsonForSystemData(phoneId, jsonfilename, rootObj);
         std::string jsonObjApiResponseFileName = "";
         Json::Value jsonObjApiResponse;
         getJsonForApiResponseSlot(phoneId, jsonObjApiResponseFileName, jsonObjApiResponse);
@@ -645,27 +514,12 @@ grpc::Status SmsManagerServerImpl::SetTag(ServerContext *context,
         telux::tel::SmsTagType tagType = static_cast<telux::tel::SmsTagType>(tag);
         CommonUtils::getValues(jsonObjApiResponse, TEL_SMS_MANAGER, apiname, status, error, delay);
 
-        if(status == telux::common::Status::SUCCESS) {
-            uint32_t size = getSMSStorage(phoneId);
-            uint32_t index_for_db;
-            if (messageIndex > size) {
+        std::shared_ptr<SmsStore> store = getSmsStore(phoneId);
+        if(status == telux::common::Status::SUCCESS && store) {
+            // The indexes are sparse, so look the message up rather than bounding it
+            if (!store->setTag(messageIndex, tagType)) {
                 LOG(ERROR, __FUNCTION__, " MsgIndex ", messageIndex ," not found");
                 status = telux::common::Status::INVALIDPARAM;
-                foundMsgIndex = false;
-            }
-            if (foundMsgIndex) {
-                for (index_for_db = 0; index_for_db < size; index_for_db++) {
-                    uint32_t Id = -1;
-                    Id = std::stoi(rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"]\
-                        [index_for_db]["smsMetaInfo_msgIndex"].asString());
-                    LOG(DEBUG, __FUNCTION__, " messageIndex ", Id);
-                    if(Id == messageIndex ) {
-                        rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index_for_db]\
-                            ["smsMetaInfo_tagType"] = Helper::tagTypeToString(tagType);
-                        JsonParser::writeToJsonFile(rootObj, jsonfilename);
-                        jsonObjSystemStateSlot_[phoneId] = rootObj;
-                    }
-                }
             }
         }
         //Create response
@@ -678,7 +532,7 @@ grpc::Status SmsManagerServerImpl::SetTag(ServerContext *context,
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::RequestStorageDetails(ServerContext *context,
+grpc::Status SmsManagerServerImpl::RequestStorageDetails(
     const telStub::RequestStorageDetailsRequest *request,
     telStub::RequestStorageDetailsReply *response) {
     LOG(DEBUG, __FUNCTION__);
@@ -698,8 +552,9 @@ grpc::Status SmsManagerServerImpl::RequestStorageDetails(ServerContext *context,
         bool isCallback = isCallbackNeeded(jsonObjApiResponse, apiname);
         CommonUtils::getValues(jsonObjApiResponse, TEL_SMS_MANAGER, apiname, status, error, delay);
 
-        if(status == telux::common::Status::SUCCESS) {
-            size = getSMSStorage(phoneId);
+        std::shared_ptr<SmsStore> store = getSmsStore(phoneId);
+        if(status == telux::common::Status::SUCCESS && store) {
+            size = store->size();
             maxCount =
             jsonObjApiResponse[TEL_SMS_MANAGER]["requestStorageDetails"]\
                 ["requestStorageDetailsCbMaxCount"].asInt();
@@ -717,7 +572,7 @@ grpc::Status SmsManagerServerImpl::RequestStorageDetails(ServerContext *context,
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::GetMessageAttributes(ServerContext *context,
+grpc::Status SmsManagerServerImpl::GetMessageAttributes(
     const telStub::GetMessageAttributesRequest *request,
     telStub::GetMessageAttributesReply *response) {
     LOG(DEBUG, __FUNCTION__);
@@ -752,9 +607,8 @@ grpc::Status SmsManagerServerImpl::GetMessageAttributes(ServerContext *context,
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::SendSmsWithoutSmsc(ServerContext *context,
-    const telStub::SendSmsWithoutSmscRequest *request,
-    telStub::SendSmsWithoutSmscReply *response) {
+grpc::Status SmsManagerServerImpl::SendSmsWithoutSmsc(
+    const telStub::SendSmsWithoutSmscRequest *request, telStub::SendSmsWithoutSmscReply *response) {
     LOG(DEBUG, __FUNCTION__);
     std::string jsonfilename = "";
     Json::Value rootObj;
@@ -798,8 +652,8 @@ grpc::Status SmsManagerServerImpl::SendSmsWithoutSmsc(ServerContext *context,
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::SendSms(ServerContext *context,
-    const telStub::SendSmsRequest *request, telStub::SendSmsReply *response) {
+grpc::Status SmsManagerServerImpl::SendSms(const telStub::SendSmsRequest *request,
+    telStub::SendSmsReply *response) {
     LOG(DEBUG, __FUNCTION__);
     std::string jsonfilename = "";
     Json::Value rootObj;
@@ -852,8 +706,8 @@ grpc::Status SmsManagerServerImpl::SendSms(ServerContext *context,
     return readStatus;
 }
 
-grpc::Status SmsManagerServerImpl::SendRawSms(ServerContext *context,
-    const telStub::SendRawSmsRequest *request, telStub::SendRawSmsReply *response) {
+grpc::Status SmsManagerServerImpl::SendRawSms(const telStub::SendRawSmsRequest *request,
+    telStub::SendRawSmsReply *response) {
     LOG(DEBUG, __FUNCTION__);
     std::string jsonfilename = "";
     Json::Value rootObj;
@@ -972,40 +826,6 @@ void SmsManagerServerImpl::handleMemoryFullEvent(std::string eventParams) {
 
 }
 
-int SmsManagerServerImpl::getNewSmsIndex(int phoneId) {
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    int currentIndex;
-    int nextIndex;
-    bool flag = false;
-    getJsonForSystemData(phoneId, jsonfilename, rootObj);
-    /* If sms message of index 0 is not present return index 0
-     * as it's the first missing element of database.
-     */
-    if(rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][0]["smsMetaInfo_msgIndex"].asInt() == 0) {
-        int size = getSMSStorage(phoneId);
-        for (int i = 0; i < size - 1; i++) {
-            currentIndex = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][i]\
-                ["smsMetaInfo_msgIndex"].asInt();
-            nextIndex = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][i+1]\
-                ["smsMetaInfo_msgIndex"].asInt();
-            if(nextIndex != currentIndex + 1) {
-                flag = true;
-                break;
-            }
-        }
-        if(flag != true) {
-            LOG(DEBUG, __FUNCTION__, "Return Current index is ", size);
-            return size;
-        } else {
-            LOG(DEBUG, __FUNCTION__, "Current index is ", currentIndex + 1 );
-            return currentIndex + 1;
-        }
-    } else {
-        return 0;
-    }
-}
-
 void SmsManagerServerImpl::handleIncomingSms(std::string eventParams) {
     LOG(DEBUG, __FUNCTION__);
     int phoneId;
@@ -1087,11 +907,6 @@ void SmsManagerServerImpl::handleIncomingSms(std::string eventParams) {
     LOG(DEBUG, __FUNCTION__, "The fetched segmentNumber is: ", segmentNumber);
     LOG(DEBUG, __FUNCTION__, "The leftover string is: ", eventParams);
 
-    /* Update msgIndex */
-
-    msgIndex = getNewSmsIndex(phoneId);
-    LOG(DEBUG, __FUNCTION__, "The fetched msgIndex is: ", msgIndex);
-
     /* Update tagType */
 
     tagType = "MT_NOT_READ";
@@ -1178,40 +993,43 @@ void SmsManagerServerImpl::handleIncomingSms(std::string eventParams) {
     Json::Value jsonObjApiResponse;
     getJsonForApiResponseSlot(phoneId, jsonObjApiResponseFileName, jsonObjApiResponse);
     getJsonForSystemData(phoneId, jsonfilename, rootObj);
+    std::shared_ptr<SmsStore> store = getSmsStore(phoneId);
+    if (!store) {
+        return;
+    }
+
+    /* Update msgIndex, the message is stored at the lowest free index */
+    msgIndex = store->getFreeIndex();
 
     std::string storage = rootObj[TEL_SMS_MANAGER]["setPreferredStorage"]\
         ["storageType"].asString();
     telux::tel::StorageType type = Helper::getstorageType(storage);
     if(type == telux::tel::StorageType::SIM) {
-        int size = getSMSStorage(phoneId);
+        int size = store->size();
         uint32_t maxCount =
         jsonObjApiResponse[TEL_SMS_MANAGER]["requestStorageDetails"]\
             ["requestStorageDetailsCbMaxCount"].asInt();
         uint32_t availableCount = maxCount - size;
         if(availableCount > 0) {
-            Json::Value newSms;
-            int currentSMSCount = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"].size();
-            LOG(DEBUG, __FUNCTION__,"Current SMS  Count is : ", currentSMSCount);
-            newSms["text"] = text;
-            newSms["sender"] = sender;
-            newSms["receiver"] = receiver;
-            newSms["encoding"] = encoding;
-            newSms["rawPdu"] = pdu;
-            newSms["pdu"] = pdu;
-            newSms["messagePartInfo_refNumber"] = refNumber;
-            newSms["messagePartInfo_segmentNumber"] = segmentNumber;
-            newSms["messagePartInfo_numberOfSegments"] = numberOfSegments;
-            newSms["isMetaInfoValid"] = isMetaInfoValid;
-            newSms["smsMetaInfo_msgIndex"] =  msgIndex;
-            newSms["smsMetaInfo_tagType"] = tagType;
-            rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][currentSMSCount] = newSms;
-            JsonParser::writeToJsonFile(rootObj, jsonfilename);
-            jsonObjSystemStateSlot_[phoneId] = rootObj;
-            sortDatabase(phoneId, newSms, msgIndex);
+            LOG(DEBUG, __FUNCTION__,"Current SMS  Count is : ", size);
+            SmsMsg newSms;
+            newSms.text = text;
+            newSms.sender = sender;
+            newSms.receiver = receiver;
+            newSms.encoding = Helper::getencodingMethod(encoding);
+            newSms.pduBuffer = pdu;
+            newSms.pdu = pdu;
+            newSms.messageInfoRefNumber = refNumber;
+            newSms.messageInfoSegmentNumber = segmentNumber;
+            newSms.messageInfoSegments = numberOfSegments;
+            newSms.isMetaInfoValid = isMetaInfoValid;
+            newSms.tagType = Helper::getTagType(tagType);
+            msgIndex = store->add(newSms);
         } else {
             LOG(DEBUG, __FUNCTION__, "Memory Full ");
         }
     }
+    LOG(DEBUG, __FUNCTION__, "The fetched msgIndex is: ", msgIndex);
     auto f = std::async(std::launch::async, [this, phoneId, numberOfSegments, refNumber,
         segmentNumber, msgIndex, tagType, encoding, isMetaInfoValid, pdu, receiver,
         sender, text ]() {
@@ -1221,28 +1039,6 @@ void SmsManagerServerImpl::handleIncomingSms(std::string eventParams) {
         taskQ_->add(f);
 }
 
-void SmsManagerServerImpl::sortDatabase(int phoneId, Json::Value newSms, int index) {
-    std::string jsonfilename = "";
-    Json::Value rootObj;
-    LOG(DEBUG, __FUNCTION__,"Index is : ", index);
-
-    getJsonForSystemData(phoneId, jsonfilename, rootObj);
-    int currentSMSCount = rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"].size();
-    LOG(DEBUG, __FUNCTION__,"Current SMS  Count is : ", currentSMSCount);
-    if(index > currentSMSCount - 1) {
-        return;
-    } else {
-        for (int i = currentSMSCount - 1; i > index ; --i ) {
-           rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][i] =
-            rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][i - 1];
-        }
-        rootObj[TEL_SMS_MANAGER]["SmsDatabaseStorage"][index] = newSms;
-    }
-    JsonParser::writeToJsonFile(rootObj, jsonfilename);
-    jsonObjSystemStateSlot_[phoneId] = rootObj;
-
-}
-
 void SmsManagerServerImpl::triggerIncomingSmsEvent(int phoneId, int numberOfSegments,
     int refNumber, int segmentNumber, int msgIndex, std::string tagType, std::string encoding,
     bool isMetaInfoValid, std::string pdu, std::string receiver, std::string sender,
@@ -1273,8 +1069,8 @@ void SmsManagerServerImpl::triggerIncomingSmsEvent(int phoneId, int numberOfSegm
     eventImpl.updateEventQueue(anyResponse);
 }
 
-grpc::Status SmsManagerServerImpl::IsMemoryFull(ServerContext *context,
-    const telStub::IsMemoryFullRequest *request, telStub::IsMemoryFullReply *response) {
+grpc::Status SmsManagerServerImpl::IsMemoryFull(const telStub::IsMemoryFullRequest *request,
+    telStub::IsMemoryFullReply *response) {
     LOG(DEBUG, __FUNCTION__);
     std::string jsonfilename = "";
     Json::Value rootObj;
@@ -1282,7 +1078,8 @@ grpc::Status SmsManagerServerImpl::IsMemoryFull(ServerContext *context,
     getJsonForApiResponseSlot(phoneId, jsonfilename, rootObj);
 
     bool isMemoryFull = false;
-    int size = getSMSStorage(phoneId);
+    std::shared_ptr<SmsStore> store = getSmsStore(phoneId);
+    int size = store ? store->size() : 0;
     uint32_t maxCount =
     rootObj[TEL_SMS_MANAGER]["requestStorageDetails"]
         ["requestStorageDetailsCbMaxCount"].asInt();
@@ -1293,4 +1090,108 @@ grpc::Status SmsManagerServerImpl::IsMemoryFull(ServerContext *context,
     //Create response
     response->set_ismemoryfull(isMemoryFull);
     return grpc::Status::OK;
-}
\ No newline at end of file
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::InitService(grpc::CallbackServerContext* context,
+    const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::SetSmscAddress(grpc::CallbackServerContext* context,
+    const telStub::SetSmscAddressRequest* request, telStub::SetSmscAddressReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetSmscAddress(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::GetSmscAddress(grpc::CallbackServerContext* context,
+    const telStub::GetSmscAddressRequest* request, telStub::GetSmscAddressReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetSmscAddress(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::RequestSmsMessageList(
+    grpc::CallbackServerContext* context, const ::telStub::RequestSmsMessageListRequest* request,
+    telStub::RequestSmsMessageListReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestSmsMessageList(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::ReadMessage(grpc::CallbackServerContext* context,
+    const telStub::ReadMessageRequest* request, telStub::ReadMessageReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return ReadMessage(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::DeleteMessage(grpc::CallbackServerContext* context,
+    const telStub::DeleteMessageRequest* request, telStub::DeleteMessageRequestReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DeleteMessage(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::SetPreferredStorage(
+    grpc::CallbackServerContext* context, const telStub::SetPreferredStorageRequest* request,
+    telStub::SetPreferredStorageReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetPreferredStorage(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::RequestPreferredStorage(
+    grpc::CallbackServerContext* context, const telStub::RequestPreferredStorageRequest* request,
+    telStub::RequestPreferredStorageReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestPreferredStorage(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::SetTag(grpc::CallbackServerContext* context,
+    const telStub::SetTagRequest* request, telStub::SetTagReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetTag(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::RequestStorageDetails(
+    grpc::CallbackServerContext* context, const telStub::RequestStorageDetailsRequest* request,
+    telStub::RequestStorageDetailsReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestStorageDetails(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::GetMessageAttributes(
+    grpc::CallbackServerContext* context, const telStub::GetMessageAttributesRequest* request,
+    telStub::GetMessageAttributesReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetMessageAttributes(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::IsMemoryFull(grpc::CallbackServerContext* context,
+    const telStub::IsMemoryFullRequest* request, telStub::IsMemoryFullReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return IsMemoryFull(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::SendSmsWithoutSmsc(
+    grpc::CallbackServerContext* context, const telStub::SendSmsWithoutSmscRequest* request,
+    telStub::SendSmsWithoutSmscReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SendSmsWithoutSmsc(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::SendSms(grpc::CallbackServerContext* context,
+    const telStub::SendSmsRequest* request, telStub::SendSmsReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SendSms(request, response); });
+}
+
+grpc::ServerUnaryReactor* SmsManagerServerImpl::SendRawSms(grpc::CallbackServerContext* context,
+    const telStub::SendRawSmsRequest* request, telStub::SendRawSmsReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SendRawSms(request, response); });
+}
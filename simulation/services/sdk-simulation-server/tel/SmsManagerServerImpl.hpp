@@ -36,7 +36,8 @@
  * @file       SmsManagerServerImpl.hpp
  *             It handles solicited request for sending the SMS text canned data.
  *             Supports read, delete message, set tags for messages and stores incoming
- *             messages in SMS JSON database.
+ *             messages in the SmsStore of the slot, which persists them to the SMS JSON
+ *             database.
  *
  */
 
@@ -59,6 +60,7 @@
 #include "event/ServerEventManager.hpp"
 #include <telux/tel/SmsManager.hpp>
 #include "event/EventService.hpp"
+#include "SmsStore.hpp"
 
 
 using grpc::Server;
@@ -70,79 +72,94 @@ using telStub::SmsService;
 using commonStub::ServiceStatus;
 using commonStub::GetServiceStatusReply;
 
-struct SmsMsg  {
-    std::string text;
-    std::string sender;
-    std::string receiver;
-    telux::tel::SmsEncoding encoding;
-    std::string pdu;
-    std::string pduBuffer;
-    int messageInfoRefNumber;
-    int messageInfoSegments;
-    int messageInfoSegmentNumber;
-    bool isMetaInfoValid;
-    int msgIndex;
-    telux::tel::SmsTagType tagType;
-};
-
 struct SmsDeliveryInfo {
     telux::common::ErrorCode errorCode;
     int cbDelay;
     int msgRef;
 };
 
-class SmsManagerServerImpl final : public telStub::SmsService::Service,
+class SmsManagerServerImpl final : public telStub::SmsService::CallbackService,
                                    public IServerEventListener,
                                    public std::enable_shared_from_this<SmsManagerServerImpl> {
 public:
     SmsManagerServerImpl();
-    grpc::Status InitService(ServerContext *context,
-        const ::commonStub::GetServiceStatusRequest* request ,
-        commonStub::GetServiceStatusReply* response) override ;
-    grpc::Status GetServiceStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status SetSmscAddress(ServerContext* context,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response) override;
+    grpc::ServerUnaryReactor* SetSmscAddress(grpc::CallbackServerContext* context,
         const telStub::SetSmscAddressRequest* request,
         telStub::SetSmscAddressReply* response) override;
-    grpc::Status GetSmscAddress(ServerContext* context,
+    grpc::ServerUnaryReactor* GetSmscAddress(grpc::CallbackServerContext* context,
         const telStub::GetSmscAddressRequest* request,
         telStub::GetSmscAddressReply* response) override;
-    grpc::Status RequestSmsMessageList(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestSmsMessageList(grpc::CallbackServerContext* context,
         const ::telStub::RequestSmsMessageListRequest* request,
         telStub::RequestSmsMessageListReply* response) override;
-    grpc::Status ReadMessage(ServerContext *context,
-        const telStub::ReadMessageRequest *request, telStub::ReadMessageReply *reply) override;
-    grpc::Status DeleteMessage(ServerContext *context,
-        const telStub::DeleteMessageRequest *request,
-        telStub::DeleteMessageRequestReply *response) override;
-    grpc::Status SetPreferredStorage(ServerContext *context,
-        const telStub::SetPreferredStorageRequest *request,
-        telStub::SetPreferredStorageReply *response) override;
-    grpc::Status RequestPreferredStorage(ServerContext *context,
-        const telStub::RequestPreferredStorageRequest *request,
-        telStub::RequestPreferredStorageReply *response) override;
-    grpc::Status SetTag(ServerContext *context, const telStub::SetTagRequest *request,
-        telStub::SetTagReply *response) override;
-    grpc::Status RequestStorageDetails(ServerContext *context,
-        const telStub::RequestStorageDetailsRequest *request,
-        telStub::RequestStorageDetailsReply *response) override;
-    grpc::Status GetMessageAttributes(ServerContext *context,
-        const telStub::GetMessageAttributesRequest *request,
-        telStub::GetMessageAttributesReply *response) override;
-    grpc::Status IsMemoryFull(ServerContext *context,
-        const telStub::IsMemoryFullRequest *request,
-        telStub::IsMemoryFullReply *response) override;
-    grpc::Status SendSmsWithoutSmsc(ServerContext *context,
-        const telStub::SendSmsWithoutSmscRequest *request,
-        telStub::SendSmsWithoutSmscReply *response)
-        override;
-    grpc::Status SendSms(ServerContext *context,
-        const telStub::SendSmsRequest *request, telStub::SendSmsReply *response) override;
-    grpc::Status SendRawSms(ServerContext *context,
-    const telStub::SendRawSmsRequest *request, telStub::SendRawSmsReply *response) override;
+    grpc::ServerUnaryReactor* ReadMessage(grpc::CallbackServerContext* context,
+        const telStub::ReadMessageRequest* request, telStub::ReadMessageReply* response) override;
+    grpc::ServerUnaryReactor* DeleteMessage(grpc::CallbackServerContext* context,
+        const telStub::DeleteMessageRequest* request,
+        telStub::DeleteMessageRequestReply* response) override;
+    grpc::ServerUnaryReactor* SetPreferredStorage(grpc::CallbackServerContext* context,
+        const telStub::SetPreferredStorageRequest* request,
+        telStub::SetPreferredStorageReply* response) override;
+    grpc::ServerUnaryReactor* RequestPreferredStorage(grpc::CallbackServerContext* context,
+        const telStub::RequestPreferredStorageRequest* request,
+        telStub::RequestPreferredStorageReply* response) override;
+    grpc::ServerUnaryReactor* SetTag(grpc::CallbackServerContext* context,
+        const telStub::SetTagRequest* request, telStub::SetTagReply* response) override;
+    grpc::ServerUnaryReactor* RequestStorageDetails(grpc::CallbackServerContext* context,
+        const telStub::RequestStorageDetailsRequest* request,
+        telStub::RequestStorageDetailsReply* response) override;
+    grpc::ServerUnaryReactor* GetMessageAttributes(grpc::CallbackServerContext* context,
+        const telStub::GetMessageAttributesRequest* request,
+        telStub::GetMessageAttributesReply* response) override;
+    grpc::ServerUnaryReactor* IsMemoryFull(grpc::CallbackServerContext* context,
+        const telStub::IsMemoryFullRequest* request, telStub::IsMemoryFullReply* response) override;
+    grpc::ServerUnaryReactor* SendSmsWithoutSmsc(grpc::CallbackServerContext* context,
+        const telStub::SendSmsWithoutSmscRequest* request,
+        telStub::SendSmsWithoutSmscReply* response) override;
+    grpc::ServerUnaryReactor* SendSms(grpc::CallbackServerContext* context,
+        const telStub::SendSmsRequest* request, telStub::SendSmsReply* response) override;
+    grpc::ServerUnaryReactor* SendRawSms(grpc::CallbackServerContext* context,
+        const telStub::SendRawSmsRequest* request, telStub::SendRawSmsReply* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent message);
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status SetSmscAddress(const telStub::SetSmscAddressRequest* request,
+        telStub::SetSmscAddressReply* response);
+    grpc::Status GetSmscAddress(const telStub::GetSmscAddressRequest* request,
+        telStub::GetSmscAddressReply* response);
+    grpc::Status RequestSmsMessageList(const ::telStub::RequestSmsMessageListRequest* request,
+        telStub::RequestSmsMessageListReply* response);
+    grpc::Status ReadMessage(const telStub::ReadMessageRequest* request,
+        telStub::ReadMessageReply* reply);
+    grpc::Status DeleteMessage(const telStub::DeleteMessageRequest* request,
+        telStub::DeleteMessageRequestReply* response);
+    grpc::Status SetPreferredStorage(const telStub::SetPreferredStorageRequest* request,
+        telStub::SetPreferredStorageReply* response);
+    grpc::Status RequestPreferredStorage(const telStub::RequestPreferredStorageRequest* request,
+        telStub::RequestPreferredStorageReply* response);
+    grpc::Status SetTag(const telStub::SetTagRequest* request, telStub::SetTagReply* response);
+    grpc::Status RequestStorageDetails(const telStub::RequestStorageDetailsRequest* request,
+        telStub::RequestStorageDetailsReply* response);
+    grpc::Status GetMessageAttributes(const telStub::GetMessageAttributesRequest* request,
+        telStub::GetMessageAttributesReply* response);
+    grpc::Status IsMemoryFull(const telStub::IsMemoryFullRequest* request,
+        telStub::IsMemoryFullReply* response);
+    grpc::Status SendSmsWithoutSmsc(const telStub::SendSmsWithoutSmscRequest* request,
+        telStub::SendSmsWithoutSmscReply* response);
+    grpc::Status SendSms(const telStub::SendSmsRequest* request, telStub::SendSmsReply* response);
+    grpc::Status SendRawSms(const telStub::SendRawSmsRequest* request,
+        telStub::SendRawSmsReply* response);
+
     Json::Value rootObjSystemStateSlot1_;
     Json::Value rootObjSystemStateSlot2_;
     Json::Value rootObjApiResponseSlot1_;
@@ -151,30 +168,22 @@ private:
     std::map <int, std::string> jsonObjSystemStateFileName_;
     std::map <int, Json::Value> jsonObjApiResponseSlot_;
     std::map <int, std::string> jsonObjApiResponseFileName_;
+    std::map <int, std::shared_ptr<SmsStore>> smsStores_;
     std::shared_ptr<telux::common::AsyncTaskQueue<void>> taskQ_;
     grpc::Status readJson();
     bool isCallbackNeeded(Json::Value rootObj, std::string apiname);
     void getJsonForSystemData(int phoneId, std::string& jsonfilename, Json::Value& rootObj );
     void getJsonForApiResponseSlot(int phoneId, std::string& jsonfilename,
         Json::Value& rootObj );
-    int getSMSStorage(int phoneId);
-    void parseMessageAtIndex(int phoneId, int index,SmsMsg& msg );
-    telux::common::ErrorCode deletedSmsatIndex(int phoneId, std::vector<int> index);
+    std::shared_ptr<SmsStore> getSmsStore(int phoneId);
+    /* Writes the system-state JSON of the slot, along with the messages of its SmsStore */
+    void writeSystemData(int phoneId, std::string jsonfilename, Json::Value rootObj);
     void handleIncomingSms(std::string eventParams);
     void handleMemoryFullEvent(std::string eventParams);
     void triggerIncomingSmsEvent(int phoneId, int numberOfSegments,
         int refNumber, int segmentNumber, int msgIndex, std::string tagType, std::string encoding,
         bool isMetaInfoValid, std::string pdu, std::string receiver, std::string sender,
         std::string text);
-    /* Sorts the database of SMS messages.
-     * Example: Current JSON datbase message Index elements are 1 , 3 , 4 , 2
-     * New JSON datbase message Index elements are 1 , 2 , 3 , 4
-     * It shifts all the elements of current database to right for indexes greater than new index
-     * and pushes the data of new message on corresponding index in database.
-     */
-    void sortDatabase(int phoneId, Json::Value newSms, int index);
     void onEventUpdate(std::string event);
-    /* Returns the message index of new MT SMS database, where the new MT SMS can be stored */
-    int getNewSmsIndex(int phoneId);
 };
 #endif // SMS_MANAGER_SERVER_HPP
\ No newline at end of file
@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "SmsStore.hpp"
+
+#include <memory>
+
+#include "FileInfo.hpp"
+#include "libs/common/Logger.hpp"
+#include "libs/common/JsonParser.hpp"
+#include "libs/tel/Helper.hpp"
+
+#define SMS_DATABASE_STORAGE "SmsDatabaseStorage"
+#define JOURNAL_SUFFIX ".journal"
+#define BITS_PER_WORD 64
+
+SmsStore::SmsStore(std::string jsonFileName, std::string section)
+   : jsonFileName_(jsonFileName),
+     section_(section) {
+    LOG(DEBUG, __FUNCTION__);
+    writerBuilder_["indentation"] = "";
+}
+
+SmsStore::~SmsStore() {
+    LOG(DEBUG, __FUNCTION__);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (journalEntries_ > 0) {
+        Json::Value rootObj;
+        JsonParser::readFromJsonFile(rootObj, jsonFileName_);
+        compactLocked(rootObj);
+    }
+}
+
+std::string SmsStore::getFilePath(std::string fileName) {
+    std::string filePath = std::string(DEFAULT_JSON_FILE_PATH) + fileName;
+    std::ifstream ifs(filePath);
+    if (!ifs.good()) {
+        std::string simFilePath = std::string(DEFAULT_SIM_FILE_PREFIX)
+            + std::string(DEFAULT_JSON_FILE_PATH) + fileName;
+        std::ifstream simIfs(simFilePath);
+        if (simIfs.good()) {
+            filePath = simFilePath;
+        }
+    }
+    return filePath;
+}
+
+void SmsStore::load() {
+    LOG(DEBUG, __FUNCTION__, " ", jsonFileName_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    Json::Value rootObj;
+    if (JsonParser::readFromJsonFile(rootObj, jsonFileName_)
+        != telux::common::ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Reading JSON File failed! ", jsonFileName_);
+    }
+    messages_.clear();
+    usedIndexes_.clear();
+    tagIndex_.clear();
+    const Json::Value &storage = rootObj[section_][SMS_DATABASE_STORAGE];
+    for (Json::ArrayIndex i = 0; i < storage.size(); i++) {
+        SmsMsg msg = fromJson(storage[i]);
+        if ((msg.msgIndex < 0) || (messages_.count(msg.msgIndex))) {
+            LOG(ERROR, __FUNCTION__, " Skipping message with invalid index ", msg.msgIndex);
+            continue;
+        }
+        insert(msg);
+    }
+
+    /* Replay the changes which weren't compacted into the file yet */
+    journal_.close();
+    journalPath_ = getFilePath(jsonFileName_) + JOURNAL_SUFFIX;
+    std::ifstream ifs(journalPath_);
+    Json::CharReaderBuilder readerBuilder;
+    std::unique_ptr<Json::CharReader> reader(readerBuilder.newCharReader());
+    std::string line;
+    int replayed = 0;
+    while (std::getline(ifs, line)) {
+        Json::Value entry;
+        std::string errors;
+        if (!reader->parse(line.data(), line.data() + line.size(), &entry, &errors)) {
+            /* A partly written last entry is expected after a crash */
+            LOG(ERROR, __FUNCTION__, " Skipping journal entry: ", errors);
+            continue;
+        }
+        applyJournalEntry(entry);
+        replayed++;
+    }
+    ifs.close();
+    LOG(DEBUG, __FUNCTION__, " Loaded ", messages_.size(), " messages, replayed ", replayed,
+        " journal entries");
+    if (replayed > 0) {
+        compactLocked(rootObj);
+    } else {
+        journal_.open(journalPath_, std::ios::out | std::ios::app);
+    }
+}
+
+int SmsStore::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return messages_.size();
+}
+
+int SmsStore::findFreeIndex() {
+    for (size_t word = 0; word < usedIndexes_.size(); word++) {
+        if (usedIndexes_[word] != ~0ULL) {
+            return word * BITS_PER_WORD + __builtin_ctzll(~usedIndexes_[word]);
+        }
+    }
+    return usedIndexes_.size() * BITS_PER_WORD;
+}
+
+int SmsStore::getFreeIndex() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return findFreeIndex();
+}
+
+int SmsStore::add(SmsMsg msg) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    msg.msgIndex = findFreeIndex();
+    insert(msg);
+    Json::Value entry;
+    entry["op"] = "add";
+    entry["sms"] = toJson(msg);
+    appendToJournal(entry);
+    return msg.msgIndex;
+}
+
+bool SmsStore::get(int msgIndex, SmsMsg &msg) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = messages_.find(msgIndex);
+    if (it == messages_.end()) {
+        return false;
+    }
+    msg = it->second;
+    return true;
+}
+
+std::vector<telux::tel::SmsMetaInfo> SmsStore::getMetaInfos() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<telux::tel::SmsMetaInfo> infos;
+    infos.reserve(messages_.size());
+    for (auto &it : messages_) {
+        telux::tel::SmsMetaInfo info;
+        info.msgIndex = it.first;
+        info.tagType = it.second.tagType;
+        infos.push_back(info);
+    }
+    return infos;
+}
+
+std::vector<telux::tel::SmsMetaInfo> SmsStore::getMetaInfos(telux::tel::SmsTagType tagType) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<telux::tel::SmsMetaInfo> infos;
+    auto tagIt = tagIndex_.find(tagType);
+    if (tagIt == tagIndex_.end()) {
+        return infos;
+    }
+    infos.reserve(tagIt->second.size());
+    for (auto msgIndex : tagIt->second) {
+        telux::tel::SmsMetaInfo info;
+        info.msgIndex = msgIndex;
+        info.tagType = tagType;
+        infos.push_back(info);
+    }
+    return infos;
+}
+
+bool SmsStore::setTag(int msgIndex, telux::tel::SmsTagType tagType) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = messages_.find(msgIndex);
+    if (it == messages_.end()) {
+        return false;
+    }
+    tagIndex_[it->second.tagType].erase(msgIndex);
+    it->second.tagType = tagType;
+    tagIndex_[tagType].insert(msgIndex);
+    Json::Value entry;
+    entry["op"] = "tag";
+    entry["index"] = msgIndex;
+    entry["tag"] = Helper::tagTypeToString(tagType);
+    appendToJournal(entry);
+    return true;
+}
+
+bool SmsStore::remove(int msgIndex) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = messages_.find(msgIndex);
+    if (it == messages_.end()) {
+        return false;
+    }
+    erase(it);
+    Json::Value entry;
+    entry["op"] = "remove";
+    entry["index"] = msgIndex;
+    appendToJournal(entry);
+    return true;
+}
+
+int SmsStore::removeByTag(telux::tel::SmsTagType tagType) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto tagIt = tagIndex_.find(tagType);
+    if ((tagIt == tagIndex_.end()) || tagIt->second.empty()) {
+        return 0;
+    }
+    /* Copied, as erase() updates the tag index */
+    std::set<int> msgIndexes = tagIt->second;
+    for (auto msgIndex : msgIndexes) {
+        erase(messages_.find(msgIndex));
+    }
+    Json::Value entry;
+    entry["op"] = "removeByTag";
+    entry["tag"] = Helper::tagTypeToString(tagType);
+    appendToJournal(entry);
+    return msgIndexes.size();
+}
+
+void SmsStore::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    messages_.clear();
+    usedIndexes_.clear();
+    tagIndex_.clear();
+    Json::Value entry;
+    entry["op"] = "clear";
+    appendToJournal(entry);
+}
+
+void SmsStore::compact(Json::Value rootObj) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    compactLocked(rootObj);
+}
+
+void SmsStore::insert(const SmsMsg &msg) {
+    messages_[msg.msgIndex] = msg;
+    size_t word = msg.msgIndex / BITS_PER_WORD;
+    if (word >= usedIndexes_.size()) {
+        usedIndexes_.resize(word + 1, 0);
+    }
+    usedIndexes_[word] |= (1ULL << (msg.msgIndex % BITS_PER_WORD));
+    tagIndex_[msg.tagType].insert(msg.msgIndex);
+}
+
+void SmsStore::erase(std::map<int, SmsMsg>::iterator it) {
+    int msgIndex = it->first;
+    usedIndexes_[msgIndex / BITS_PER_WORD] &= ~(1ULL << (msgIndex % BITS_PER_WORD));
+    tagIndex_[it->second.tagType].erase(msgIndex);
+    messages_.erase(it);
+}
+
+void SmsStore::applyJournalEntry(const Json::Value &entry) {
+    std::string op = entry["op"].asString();
+    if (op == "add") {
+        SmsMsg msg = fromJson(entry["sms"]);
+        auto it = messages_.find(msg.msgIndex);
+        if (it != messages_.end()) {
+            erase(it);
+        }
+        if (msg.msgIndex >= 0) {
+            insert(msg);
+        }
+    } else if (op == "tag") {
+        auto it = messages_.find(entry["index"].asInt());
+        if (it != messages_.end()) {
+            SmsMsg msg = it->second;
+            erase(it);
+            msg.tagType = Helper::getTagType(entry["tag"].asString());
+            insert(msg);
+        }
+    } else if (op == "remove") {
+        auto it = messages_.find(entry["index"].asInt());
+        if (it != messages_.end()) {
+            erase(it);
+        }
+    } else if (op == "removeByTag") {
+        std::set<int> msgIndexes = tagIndex_[Helper::getTagType(entry["tag"].asString())];
+        for (auto msgIndex : msgIndexes) {
+            erase(messages_.find(msgIndex));
+        }
+    } else if (op == "clear") {
+        messages_.clear();
+        usedIndexes_.clear();
+        tagIndex_.clear();
+    } else {
+        LOG(ERROR, __FUNCTION__, " Unknown journal entry ", op);
+    }
+}
+
+void SmsStore::appendToJournal(const Json::Value &entry) {
+    journal_ << Json::writeString(writerBuilder_, entry) << '\n';
+    journal_.flush();
+    if (!journal_.good()) {
+        LOG(ERROR, __FUNCTION__, " Writing journal failed ", journalPath_);
+    }
+    if (++journalEntries_ >= COMPACT_THRESHOLD) {
+        Json::Value rootObj;
+        JsonParser::readFromJsonFile(rootObj, jsonFileName_);
+        compactLocked(rootObj);
+    }
+}
+
+void SmsStore::compactLocked(Json::Value &rootObj) {
+    LOG(DEBUG, __FUNCTION__, " Writing ", messages_.size(), " messages after ",
+        journalEntries_, " journal entries");
+    Json::Value storage(Json::arrayValue);
+    for (auto &it : messages_) {
+        storage.append(toJson(it.second));
+    }
+    rootObj[section_][SMS_DATABASE_STORAGE] = storage;
+    JsonParser::writeToJsonFile(rootObj, jsonFileName_);
+    /* Every change so far is in the file now */
+    journal_.close();
+    journal_.clear();
+    journal_.open(journalPath_, std::ios::out | std::ios::trunc);
+    journalEntries_ = 0;
+}
+
+Json::Value SmsStore::toJson(const SmsMsg &msg) {
+    Json::Value value;
+    value["text"] = msg.text;
+    value["sender"] = msg.sender;
+    value["receiver"] = msg.receiver;
+    value["encoding"] = Helper::encodingToString(msg.encoding);
+    value["rawPdu"] = msg.pduBuffer;
+    value["pdu"] = msg.pdu;
+    value["messagePartInfo_refNumber"] = msg.messageInfoRefNumber;
+    value["messagePartInfo_segmentNumber"] = msg.messageInfoSegmentNumber;
+    value["messagePartInfo_numberOfSegments"] = msg.messageInfoSegments;
+    value["isMetaInfoValid"] = msg.isMetaInfoValid;
+    value["smsMetaInfo_msgIndex"] = msg.msgIndex;
+    value["smsMetaInfo_tagType"] = Helper::tagTypeToString(msg.tagType);
+    return value;
+}
+
+SmsMsg SmsStore::fromJson(const Json::Value &value) {
+    SmsMsg msg;
+    msg.text = value["text"].asString();
+    msg.sender = value["sender"].asString();
+    msg.receiver = value["receiver"].asString();
+    msg.encoding = Helper::getencodingMethod(value["encoding"].asString());
+    msg.pduBuffer = value["rawPdu"].asString();
+    msg.pdu = value["pdu"].asString();
+    msg.messageInfoRefNumber = value["messagePartInfo_refNumber"].asInt();
+    msg.messageInfoSegmentNumber = value["messagePartInfo_segmentNumber"].asInt();
+    msg.messageInfoSegments = value["messagePartInfo_numberOfSegments"].asInt();
+    msg.isMetaInfoValid = value["isMetaInfoValid"].asBool();
+    msg.msgIndex = value["smsMetaInfo_msgIndex"].asInt();
+    msg.tagType = Helper::getTagType(value["smsMetaInfo_tagType"].asString());
+    return msg;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       SmsStore.hpp
+ *
+ * @brief      SmsStore keeps the SMS messages of one slot in memory, indexed by message
+ *             index with a bitmap of the used indexes and an index per tag type.
+ *             Changes are appended to a journal next to the system-state JSON file, which
+ *             is rewritten (compacted) only once the journal grows beyond a threshold.
+ */
+
+#ifndef SMS_STORE_HPP
+#define SMS_STORE_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <jsoncpp/json/json.h>
+#include <telux/tel/SmsManager.hpp>
+
+struct SmsMsg  {
+    std::string text;
+    std::string sender;
+    std::string receiver;
+    telux::tel::SmsEncoding encoding;
+    std::string pdu;
+    std::string pduBuffer;
+    int messageInfoRefNumber;
+    int messageInfoSegments;
+    int messageInfoSegmentNumber;
+    bool isMetaInfoValid;
+    int msgIndex;
+    telux::tel::SmsTagType tagType;
+};
+
+class SmsStore {
+public:
+    /**
+     * @param [in] jsonFileName    System-state file, relative to the JSON directory
+     * @param [in] section         Manager object in that file holding "SmsDatabaseStorage"
+     */
+    SmsStore(std::string jsonFileName, std::string section);
+    ~SmsStore();
+
+    /**
+     * Loads the messages from the system-state file and replays the journal left by a
+     * previous run on top of them.
+     */
+    void load();
+
+    int size();
+
+    /* Returns the lowest message index that is not in use */
+    int getFreeIndex();
+
+    /* Stores the message at the lowest free index and returns that index */
+    int add(SmsMsg msg);
+
+    bool get(int msgIndex, SmsMsg &msg);
+
+    /* Returns the meta info of all messages, or only those with the given tag, by index */
+    std::vector<telux::tel::SmsMetaInfo> getMetaInfos();
+    std::vector<telux::tel::SmsMetaInfo> getMetaInfos(telux::tel::SmsTagType tagType);
+
+    bool setTag(int msgIndex, telux::tel::SmsTagType tagType);
+    bool remove(int msgIndex);
+    int removeByTag(telux::tel::SmsTagType tagType);
+    void clear();
+
+    /**
+     * Writes rootObj with the current messages to the system-state file and restarts the
+     * journal. Used by the other writers of the system-state file, so that they don't
+     * overwrite the messages with an older copy.
+     */
+    void compact(Json::Value rootObj);
+
+private:
+    static const int COMPACT_THRESHOLD = 256;
+
+    std::string getFilePath(std::string fileName);
+    int findFreeIndex();
+    Json::Value toJson(const SmsMsg &msg);
+    SmsMsg fromJson(const Json::Value &value);
+    void insert(const SmsMsg &msg);
+    void erase(std::map<int, SmsMsg>::iterator it);
+    void applyJournalEntry(const Json::Value &entry);
+    void appendToJournal(const Json::Value &entry);
+    void compactLocked(Json::Value &rootObj);
+
+    std::mutex mutex_;
+    std::string jsonFileName_;
+    std::string section_;
+    std::string journalPath_;
+    std::ofstream journal_;
+    Json::StreamWriterBuilder writerBuilder_;
+    int journalEntries_ = 0;
+    std::map<int, SmsMsg> messages_;
+    /* Bit n of word n / 64 is set when message index n is in use */
+    std::vector<uint64_t> usedIndexes_;
+    std::map<telux::tel::SmsTagType, std::set<int>> tagIndex_;
+};
+
+#endif // SMS_STORE_HPP
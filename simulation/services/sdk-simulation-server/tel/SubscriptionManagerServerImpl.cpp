@@ -35,6 +35,7 @@
 #include"SubscriptionManagerServerImpl.hpp"
 #include "libs/tel/TelDefinesStub.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 #include <telux/common/DeviceConfig.hpp>
 
 #define PATH "system-state/tel/ISubscriptionManagerState.json"
@@ -54,8 +55,8 @@ grpc::Status SubscriptionManagerServerImpl::readJson() {
     }
     return grpc::Status::OK;
 }
-grpc::Status SubscriptionManagerServerImpl::InitService(ServerContext* context,
-    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+grpc::Status SubscriptionManagerServerImpl::InitService(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     grpc::Status readStatus = readJson();
     if(readStatus.ok()) {
         int cbDelay = rootObj["ISubscriptionManager"]["IsSubsystemReadyDelay"].asInt();
@@ -76,8 +77,8 @@ grpc::Status SubscriptionManagerServerImpl::InitService(ServerContext* context,
     return readStatus;
 }
 
-grpc::Status SubscriptionManagerServerImpl::GetServiceStatus(ServerContext* context,
-    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+grpc::Status SubscriptionManagerServerImpl::GetServiceStatus(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     grpc::Status readStatus = readJson();
     if(readStatus.ok()) {
         int cbDelay = rootObj["ISubscriptionManager"]["IsSubsystemReadyDelay"].asInt();
@@ -93,8 +94,8 @@ grpc::Status SubscriptionManagerServerImpl::GetServiceStatus(ServerContext* cont
     return readStatus;
 }
 
-grpc::Status SubscriptionManagerServerImpl::IsSubsystemReady(ServerContext* context,
-    const google::protobuf::Empty* request, commonStub::IsSubsystemReadyReply* response) {
+grpc::Status SubscriptionManagerServerImpl::IsSubsystemReady(const google::protobuf::Empty* request,
+    commonStub::IsSubsystemReadyReply* response) {
     grpc::Status readStatus = readJson();
     if(readStatus.ok()) {
         bool status = false;
@@ -108,7 +109,7 @@ grpc::Status SubscriptionManagerServerImpl::IsSubsystemReady(ServerContext* cont
     }
     return readStatus;
 }
-grpc::Status SubscriptionManagerServerImpl::GetSubscription(ServerContext* context,
+grpc::Status SubscriptionManagerServerImpl::GetSubscription(
     const ::telStub::GetSubscriptionRequest* request, telStub::Subscription* response) {
     LOG(DEBUG, __FUNCTION__);
 
@@ -345,3 +346,31 @@ void SubscriptionManagerServerImpl::handlesubscriptionInfoChanged(std::string ev
     auto& eventImpl = EventService::getInstance();
     eventImpl.updateEventQueue(anyResponse);
 }
+
+grpc::ServerUnaryReactor* SubscriptionManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* SubscriptionManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* SubscriptionManagerServerImpl::IsSubsystemReady(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::IsSubsystemReadyReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return IsSubsystemReady(request, response); });
+}
+
+grpc::ServerUnaryReactor* SubscriptionManagerServerImpl::GetSubscription(
+    grpc::CallbackServerContext* context, const ::telStub::GetSubscriptionRequest* request,
+    telStub::Subscription* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetSubscription(request, response); });
+}
@@ -67,24 +67,36 @@ using grpc::Status;
 using telStub::SubscriptionService;
 using commonStub::ServiceStatus;
 
-class SubscriptionManagerServerImpl final : public telStub::SubscriptionService::Service,
+class SubscriptionManagerServerImpl final : public telStub::SubscriptionService::CallbackService,
                                             public IServerEventListener,
                                             public
                                     std::enable_shared_from_this<SubscriptionManagerServerImpl> {
 
 public:
     SubscriptionManagerServerImpl();
-    grpc::Status InitService(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status GetServiceStatus(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status IsSubsystemReady(ServerContext* context, const google::protobuf::Empty* request,
+    grpc::ServerUnaryReactor* IsSubsystemReady(grpc::CallbackServerContext* context,
+        const google::protobuf::Empty* request,
         commonStub::IsSubsystemReadyReply* response) override;
-    grpc::Status GetSubscription(ServerContext* context,
-        const ::telStub::GetSubscriptionRequest* request,
-        telStub::Subscription* response) override;
+    grpc::ServerUnaryReactor* GetSubscription(grpc::CallbackServerContext* context,
+        const ::telStub::GetSubscriptionRequest* request, telStub::Subscription* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent message);
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status IsSubsystemReady(const google::protobuf::Empty* request,
+        commonStub::IsSubsystemReadyReply* response);
+    grpc::Status GetSubscription(const ::telStub::GetSubscriptionRequest* request,
+        telStub::Subscription* response);
+
     Json::Value rootObj;
     grpc::Status readJson();
     void handleEvent(std::string token , std::string event);
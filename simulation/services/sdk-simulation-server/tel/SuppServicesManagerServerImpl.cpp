@@ -7,6 +7,7 @@
 
 #include "libs/common/CommonUtils.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
+#include "common/RpcExecutor.hpp"
 #include <telux/common/DeviceConfig.hpp>
 #include <telux/tel/SuppServicesManager.hpp>
 
@@ -20,13 +21,13 @@ SuppServicesManagerServerImpl::SuppServicesManagerServerImpl() {
     LOG(DEBUG, __FUNCTION__);
 }
 
-grpc::Status SuppServicesManagerServerImpl::CleanUpService(ServerContext* context,
-    const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) {
+grpc::Status SuppServicesManagerServerImpl::CleanUpService(const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
     return grpc::Status::OK;
 }
 
-grpc::Status SuppServicesManagerServerImpl::InitService(ServerContext* context,
+grpc::Status SuppServicesManagerServerImpl::InitService(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -54,7 +55,7 @@ grpc::Status SuppServicesManagerServerImpl::InitService(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status SuppServicesManagerServerImpl::GetServiceStatus(ServerContext* context,
+grpc::Status SuppServicesManagerServerImpl::GetServiceStatus(
     const ::commonStub::GetServiceStatusRequest* request,
     commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -71,7 +72,7 @@ grpc::Status SuppServicesManagerServerImpl::GetServiceStatus(ServerContext* cont
     return grpc::Status::OK;
 }
 
-grpc::Status SuppServicesManagerServerImpl::SetCallWaitingPref(ServerContext* context,
+grpc::Status SuppServicesManagerServerImpl::SetCallWaitingPref(
     const ::telStub::SetCallWaitingPrefRequest* request,
     telStub::SetCallWaitingPrefReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -116,7 +117,7 @@ grpc::Status SuppServicesManagerServerImpl::SetCallWaitingPref(ServerContext* co
     return grpc::Status::OK;
 }
 
-grpc::Status SuppServicesManagerServerImpl::RequestCallWaitingPref(ServerContext* context,
+grpc::Status SuppServicesManagerServerImpl::RequestCallWaitingPref(
     const ::telStub::RequestCallWaitingPrefRequest* request,
     telStub::RequestCallWaitingPrefReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -161,9 +162,8 @@ grpc::Status SuppServicesManagerServerImpl::RequestCallWaitingPref(ServerContext
     return grpc::Status::OK;
 }
 
-grpc::Status SuppServicesManagerServerImpl::SetForwardingPref(ServerContext* context,
-    const ::telStub::SetForwardingPrefRequest* request,
-    telStub::SetForwardingPrefReply* response) {
+grpc::Status SuppServicesManagerServerImpl::SetForwardingPref(
+    const ::telStub::SetForwardingPrefRequest* request, telStub::SetForwardingPrefReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int slotId = request->slot_id();
     std::string apiJsonPath = (slotId == DEFAULT_SLOT_ID)? JSON_PATH1 : JSON_PATH2;
@@ -282,7 +282,7 @@ grpc::Status SuppServicesManagerServerImpl::SetForwardingPref(ServerContext* con
     return grpc::Status::OK;
 }
 
-grpc::Status SuppServicesManagerServerImpl::RequestForwardingPref(ServerContext* context,
+grpc::Status SuppServicesManagerServerImpl::RequestForwardingPref(
     const ::telStub::RequestForwardingPrefRequest* request,
     telStub::RequestForwardingPrefReply* response) {
     LOG(DEBUG, __FUNCTION__);
@@ -350,8 +350,7 @@ grpc::Status SuppServicesManagerServerImpl::RequestForwardingPref(ServerContext*
     return grpc::Status::OK;
 }
 
-grpc::Status SuppServicesManagerServerImpl::SetOirPref(ServerContext* context,
-    const ::telStub::SetOirPrefRequest* request,
+grpc::Status SuppServicesManagerServerImpl::SetOirPref(const ::telStub::SetOirPrefRequest* request,
     telStub::SetOirPrefReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int slotId = request->slot_id();
@@ -401,7 +400,7 @@ grpc::Status SuppServicesManagerServerImpl::SetOirPref(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status SuppServicesManagerServerImpl::RequestOirPref(ServerContext* context,
+grpc::Status SuppServicesManagerServerImpl::RequestOirPref(
     const ::telStub::RequestOirPrefRequest* request, telStub::RequestOirPrefReply* response) {
     LOG(DEBUG, __FUNCTION__);
     int slotId = request->slot_id();
@@ -464,3 +463,66 @@ void SuppServicesManagerServerImpl::onEventUpdate(::eventService::UnsolicitedEve
 void SuppServicesManagerServerImpl::onEventUpdate(std::string event) {
     LOG(ERROR, __FUNCTION__, " Event not supported");
 }
+
+grpc::ServerUnaryReactor* SuppServicesManagerServerImpl::InitService(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* SuppServicesManagerServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const ::commonStub::GetServiceStatusRequest* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* SuppServicesManagerServerImpl::CleanUpService(
+    grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request,
+    ::google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return CleanUpService(request, response); });
+}
+
+grpc::ServerUnaryReactor* SuppServicesManagerServerImpl::SetCallWaitingPref(
+    grpc::CallbackServerContext* context, const ::telStub::SetCallWaitingPrefRequest* request,
+    telStub::SetCallWaitingPrefReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetCallWaitingPref(request, response); });
+}
+
+grpc::ServerUnaryReactor* SuppServicesManagerServerImpl::RequestCallWaitingPref(
+    grpc::CallbackServerContext* context, const ::telStub::RequestCallWaitingPrefRequest* request,
+    telStub::RequestCallWaitingPrefReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestCallWaitingPref(request, response); });
+}
+
+grpc::ServerUnaryReactor* SuppServicesManagerServerImpl::SetForwardingPref(
+    grpc::CallbackServerContext* context, const ::telStub::SetForwardingPrefRequest* request,
+    telStub::SetForwardingPrefReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetForwardingPref(request, response); });
+}
+
+grpc::ServerUnaryReactor* SuppServicesManagerServerImpl::RequestForwardingPref(
+    grpc::CallbackServerContext* context, const ::telStub::RequestForwardingPrefRequest* request,
+    telStub::RequestForwardingPrefReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestForwardingPref(request, response); });
+}
+
+grpc::ServerUnaryReactor* SuppServicesManagerServerImpl::SetOirPref(
+    grpc::CallbackServerContext* context, const ::telStub::SetOirPrefRequest* request,
+    telStub::SetOirPrefReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return SetOirPref(request, response); });
+}
+
+grpc::ServerUnaryReactor* SuppServicesManagerServerImpl::RequestOirPref(
+    grpc::CallbackServerContext* context, const ::telStub::RequestOirPrefRequest* request,
+    telStub::RequestOirPrefReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return RequestOirPref(request, response); });
+}
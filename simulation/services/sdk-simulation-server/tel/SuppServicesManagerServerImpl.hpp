@@ -21,42 +21,61 @@
 #include "event/ServerEventManager.hpp"
 #include "event/EventService.hpp"
 
-class SuppServicesManagerServerImpl final : public telStub::SuppServicesService::Service,
+class SuppServicesManagerServerImpl final : public telStub::SuppServicesService::CallbackService,
                                     public IServerEventListener,
                                     public
                                     std::enable_shared_from_this<SuppServicesManagerServerImpl> {
 
 public:
     SuppServicesManagerServerImpl();
-    grpc::Status InitService(ServerContext* context,
+    grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status GetServiceStatus(ServerContext* context,
+    grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
         const ::commonStub::GetServiceStatusRequest* request,
         commonStub::GetServiceStatusReply* response) override;
-    grpc::Status CleanUpService(ServerContext* context,
+    grpc::ServerUnaryReactor* CleanUpService(grpc::CallbackServerContext* context,
         const ::google::protobuf::Empty* request, ::google::protobuf::Empty* response) override;
-    grpc::Status SetCallWaitingPref(ServerContext* context,
+    grpc::ServerUnaryReactor* SetCallWaitingPref(grpc::CallbackServerContext* context,
         const ::telStub::SetCallWaitingPrefRequest* request,
         telStub::SetCallWaitingPrefReply* response) override;
-    grpc::Status RequestCallWaitingPref(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestCallWaitingPref(grpc::CallbackServerContext* context,
         const ::telStub::RequestCallWaitingPrefRequest* request,
         telStub::RequestCallWaitingPrefReply* response) override;
-    grpc::Status SetForwardingPref(ServerContext* context,
+    grpc::ServerUnaryReactor* SetForwardingPref(grpc::CallbackServerContext* context,
         const ::telStub::SetForwardingPrefRequest* request,
         telStub::SetForwardingPrefReply* response) override;
-    grpc::Status RequestForwardingPref(ServerContext* context,
+    grpc::ServerUnaryReactor* RequestForwardingPref(grpc::CallbackServerContext* context,
         const ::telStub::RequestForwardingPrefRequest* request,
         telStub::RequestForwardingPrefReply* response) override;
-    grpc::Status SetOirPref(ServerContext* context,
-        const ::telStub::SetOirPrefRequest* request,
-        telStub::SetOirPrefReply* response) override;
-    grpc::Status RequestOirPref(ServerContext* context,
+    grpc::ServerUnaryReactor* SetOirPref(grpc::CallbackServerContext* context,
+        const ::telStub::SetOirPrefRequest* request, telStub::SetOirPrefReply* response) override;
+    grpc::ServerUnaryReactor* RequestOirPref(grpc::CallbackServerContext* context,
         const ::telStub::RequestOirPrefRequest* request,
         telStub::RequestOirPrefReply* response) override;
     void onEventUpdate(::eventService::UnsolicitedEvent message) override;
 
 private:
+    /* Handlers of the RPCs, run on the RPC executor */
+    grpc::Status InitService(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status GetServiceStatus(const ::commonStub::GetServiceStatusRequest* request,
+        commonStub::GetServiceStatusReply* response);
+    grpc::Status CleanUpService(const ::google::protobuf::Empty* request,
+        ::google::protobuf::Empty* response);
+    grpc::Status SetCallWaitingPref(const ::telStub::SetCallWaitingPrefRequest* request,
+        telStub::SetCallWaitingPrefReply* response);
+    grpc::Status RequestCallWaitingPref(const ::telStub::RequestCallWaitingPrefRequest* request,
+        telStub::RequestCallWaitingPrefReply* response);
+    grpc::Status SetForwardingPref(const ::telStub::SetForwardingPrefRequest* request,
+        telStub::SetForwardingPrefReply* response);
+    grpc::Status RequestForwardingPref(const ::telStub::RequestForwardingPrefRequest* request,
+        telStub::RequestForwardingPrefReply* response);
+    grpc::Status SetOirPref(const ::telStub::SetOirPrefRequest* request,
+        telStub::SetOirPrefReply* response);
+    grpc::Status RequestOirPref(const ::telStub::RequestOirPrefRequest* request,
+        telStub::RequestOirPrefReply* response);
+
     void onEventUpdate(std::string event);
 
 };
@@ -4,6 +4,11 @@
 */
 
 #include "TelUtil.hpp"
+
+#include <sys/stat.h>
+
+#include "FileInfo.hpp"
+#include "RadioStateModel.hpp"
 #include "libs/common/JsonParser.hpp"
 #include "libs/common/Logger.hpp"
 #include "libs/common/event-manager/EventParserUtil.hpp"
@@ -31,6 +36,31 @@
 namespace telux {
 namespace tel {
 
+/* Reads the next space separated field of an event parameter */
+static std::string readField(std::istringstream &fields) {
+    std::string field;
+    fields >> field;
+    return field;
+}
+
+static int readIntField(std::istringstream &fields) {
+    return std::stoi(readField(fields));
+}
+
+int64_t TelUtil::getJsonFileModifiedTime(std::string fileName) {
+    // Same lookup order as JsonParser
+    struct stat fileStat;
+    std::string filePath = std::string(DEFAULT_JSON_FILE_PATH) + fileName;
+    if (stat(filePath.c_str(), &fileStat) != 0) {
+        filePath = std::string(DEFAULT_SIM_FILE_PREFIX) + filePath;
+        if (stat(filePath.c_str(), &fileStat) != 0) {
+            return -1;
+        }
+    }
+    return static_cast<int64_t>(fileStat.st_mtim.tv_sec) * 1000000000
+        + fileStat.st_mtim.tv_nsec;
+}
+
 telux::common::ErrorCode TelUtil::readFromJsonFile(int phoneId, std::string subsystem,
     Json::Value &rootObj, std::string &jsonfilename) {
     if (subsystem == TEL_PHONE_MANAGER) {
@@ -88,6 +118,8 @@ JsonData TelUtil::readGetPhoneIdRespFromJsonFile(telStub::GetPhoneIdReply *respo
 JsonData TelUtil::readSignalStrengthRespFromJsonFile(int phoneId,
     telStub::GetSignalStrengthReply *response) {
     LOG(DEBUG, __FUNCTION__);
+    // signal strength is written lazily, make sure the file is up to date
+    RadioStateModel::getInstance().flush(phoneId);
     JsonData data;
     telux::common::ErrorCode error = readJsonData(phoneId, TEL_PHONE_MANAGER,
         "requestSignalStrength", data);
@@ -420,6 +452,7 @@ JsonData TelUtil::readOperatingModeRespFromJsonFile(telStub::GetOperatingModeRep
 
 JsonData TelUtil::readCellInfoListRespFromJsonFile(int phoneId,
     telStub::RequestCellInfoListReply *response) {
+    RadioStateModel::getInstance().flush(phoneId);
     JsonData data;
     if (ErrorCode::SUCCESS != readJsonData(phoneId, TEL_PHONE_MANAGER, "requestCellInfo", data)) {
         LOG(ERROR, __FUNCTION__, " Reading JSON File failed" );
@@ -707,181 +740,8 @@ JsonData TelUtil::readRequestOperatorInfoRespFromJsonFile(int phoneId,
 telux::common::ErrorCode TelUtil::readSignalStrengthEventFromJsonFile(int phoneId,
     telStub::SignalStrengthChangeEvent &event) {
     LOG(DEBUG, __FUNCTION__);
-    Json::Value stateRootObj;
-    std::string jsonfilename;
-    telux::common::ErrorCode error = readFromJsonFile(phoneId, TEL_PHONE_MANAGER,
-        stateRootObj, jsonfilename);
-    if (error != ErrorCode::SUCCESS) {
-        LOG(ERROR, __FUNCTION__, " Reading JSON File failed" );
-        return error;
-    }
-    telStub::RadioTechnology servingRat;
-    telStub::ServiceDomainInfo_Domain servingDomain;
-    error = TelUtil::readSystemInfoFromJsonFile(phoneId, servingRat, servingDomain);
-    if (error != ErrorCode::SUCCESS) {
-        LOG(ERROR, __FUNCTION__, " Reading System Info failed" );
-        return error;
-    }
-    // gsm signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_GSM) {
-        event.mutable_signal_strength()->mutable_gsm_signal_strength_info()->
-            set_gsm_signal_strength(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]
-            ["gsmSignalStrengthInfo"]["gsmSignalStrength"].asInt());
-        event.mutable_signal_strength()->mutable_gsm_signal_strength_info()->
-            set_gsm_bit_error_rate(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["gsmSignalStrengthInfo"]["gsmBitErrorRate"].asInt());
-    } else {
-        event.mutable_signal_strength()->mutable_gsm_signal_strength_info()->\
-            set_gsm_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_gsm_signal_strength_info()->\
-            set_gsm_bit_error_rate(INVALID_SIGNAL_STRENGTH_VALUE);
-    }
-    LOG(DEBUG, __FUNCTION__, " gsmSignalStrength:", event.mutable_signal_strength()->\
-        mutable_gsm_signal_strength_info()->gsm_signal_strength(),
-        " gsmBitErrorRate", event.mutable_signal_strength()->\
-        mutable_gsm_signal_strength_info()->gsm_bit_error_rate());
-
-    // lte signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_LTE) {
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->
-            set_lte_signal_strength(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["lteSignalStrengthInfo"]["lteSignalStrength"].asInt());
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_lte_rsrp(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["lteRsrp"].asInt());
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_lte_rsrq(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["lteRsrq"].asInt());
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_lte_rssnr(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["lteRssnr"].asInt());
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_lte_cqi(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["lteCqi"].asInt());
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_timing_advance(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["timingAdvance"].asInt());
-    } else {
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->
-            set_lte_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_lte_rsrp(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_lte_rsrq(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_lte_rssnr(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_lte_cqi(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->set_timing_advance(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-    }
-    LOG(DEBUG, __FUNCTION__, " lteSignalStrength: ",
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->\
-            lte_signal_strength(), " lteRsrp: ",
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->\
-            lte_rsrp(), " lteRssnr: ",
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->\
-            lte_rssnr(), " lteRsrq: ",
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->\
-            lte_rsrq(), " lteCqi: ",
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->\
-            lte_cqi(), " timingAdvance: ",
-        event.mutable_signal_strength()->mutable_lte_signal_strength_info()->\
-            timing_advance());
-
-    // wcdma signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_UMTS) {
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->
-        set_signal_strength(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-            ["wcdmaSignalStrengthInfo"]["signalStrength"].asInt());
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->
-            set_bit_error_rate(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["wcdmaSignalStrengthInfo"]["bitErrorRate"].asInt());
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->
-            set_ecio(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["wcdmaSignalStrengthInfo"]["ecio"].asInt());
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->
-            set_rscp(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["wcdmaSignalStrengthInfo"]["rscp"].asInt());
-    } else {
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->
-            set_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->
-            set_bit_error_rate(INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->
-            set_ecio(INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->
-            set_rscp(INVALID_SIGNAL_STRENGTH_VALUE);
-    }
-    LOG(DEBUG, __FUNCTION__, " wcdmaSignalStrength: ",
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->\
-        signal_strength(), " bitErrorRate: ",
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->\
-        bit_error_rate(), " ecio: ",
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->\
-        ecio(), " rscp: ",
-        event.mutable_signal_strength()->mutable_wcdma_signal_strength_info()->\
-        rscp());
-
-    // nr5g signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_NR5G) {
-        event.mutable_signal_strength()->mutable_nr5g_signal_strength_info()->set_rsrp(
-        stateRootObj[TEL_PHONE_MANAGER]\
-        ["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rsrp"].asInt());
-        event.mutable_signal_strength()->mutable_nr5g_signal_strength_info()->set_rsrq(
-            stateRootObj[TEL_PHONE_MANAGER]\
-            ["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rsrq"].asInt());
-        event.mutable_signal_strength()->mutable_nr5g_signal_strength_info()->set_rssnr(
-            stateRootObj[TEL_PHONE_MANAGER]\
-            ["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rssnr"].asInt());
-    } else {
-        event.mutable_signal_strength()->mutable_nr5g_signal_strength_info()->set_rsrp(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_nr5g_signal_strength_info()->set_rsrq(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_nr5g_signal_strength_info()->set_rssnr(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-    }
-    LOG(DEBUG, __FUNCTION__, " nr5gRsrp: ",
-        stateRootObj[TEL_PHONE_MANAGER]\
-        ["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rsrp"].asInt(), " nr5gRsrq: ",
-        stateRootObj[TEL_PHONE_MANAGER]\
-        ["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rsrq"].asInt(), " nr5gRssnr: ",
-        stateRootObj[TEL_PHONE_MANAGER]\
-        ["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rssnr"].asInt());
-    // nb1 ntn signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_NB1_NTN) {
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->
-            set_signal_strength(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["nb1NtnSignalStrengthInfo"]["signalStrength"].asInt());
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->set_rsrp(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-            ["rsrp"].asInt());
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->set_rsrq(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-            ["rsrq"].asInt());
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->set_rssnr(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-            ["rssnr"].asInt());
-    } else {
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->
-            set_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->set_rsrp(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->set_rsrq(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->set_rssnr(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-    }
-    LOG(DEBUG, __FUNCTION__, " nb1NtnSignalStrength: ",
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->\
-            signal_strength(), " rsrp: ",
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->\
-            rsrp(), " rssnr: ",
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->\
-            rssnr(), " rsrq: ",
-        event.mutable_signal_strength()->mutable_nb1_ntn_signal_strength_info()->\
-            rsrq());
+    telux::common::ErrorCode error = readSignalStrengthFromJsonFile(phoneId,
+        *event.mutable_signal_strength());
     event.set_phone_id(phoneId);
     return error;
 }
@@ -890,11 +750,10 @@ telux::common::ErrorCode TelUtil::readCellInfoListEventFromJsonFile(int phoneId,
     telStub::CellInfoListEvent &cellInfoListEvent) {
     LOG(DEBUG, __FUNCTION__);
     Json::Value stateRootObj;
-    std::string jsonfilename;
-    telux::common::ErrorCode error = readFromJsonFile(phoneId, TEL_PHONE_MANAGER,
-        stateRootObj, jsonfilename);
+    telux::common::ErrorCode error = RadioStateModel::getInstance().getCellInfoList(phoneId,
+        stateRootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"]);
     if (error != ErrorCode::SUCCESS) {
-        LOG(ERROR, __FUNCTION__, " Reading JSON File failed" );
+        LOG(ERROR, __FUNCTION__, " Reading cell info list failed" );
         return error;
     }
     telStub::RadioTechnology servingRat;
@@ -1223,167 +1082,11 @@ telux::common::ErrorCode TelUtil::readOperatorInfoEventFromJsonFile(int phoneId,
 telux::common::ErrorCode TelUtil::readSignalStrengthFromJsonFile(int phoneId,
     telStub::SignalStrength &signalStrength) {
     LOG(DEBUG, __FUNCTION__);
-    Json::Value stateRootObj;
-    std::string jsonfilename;
-    telux::common::ErrorCode error = readFromJsonFile(phoneId, TEL_PHONE_MANAGER,
-        stateRootObj, jsonfilename);
-    if (error != ErrorCode::SUCCESS) {
-        LOG(ERROR, __FUNCTION__, " Reading JSON File failed" );
-        return error;
-    }
-
-    telStub::RadioTechnology servingRat;
-    telStub::ServiceDomainInfo_Domain servingDomain;
-    error = TelUtil::readSystemInfoFromJsonFile(phoneId, servingRat, servingDomain);
+    telux::common::ErrorCode error =
+        RadioStateModel::getInstance().getSignalStrength(phoneId, signalStrength);
     if (error != ErrorCode::SUCCESS) {
-        LOG(ERROR, __FUNCTION__, " Reading System Info failed" );
-        return error;
-    }
-
-    // gsm signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_GSM) {
-        signalStrength.mutable_gsm_signal_strength_info()->
-        set_gsm_signal_strength(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]
-            ["gsmSignalStrengthInfo"]["gsmSignalStrength"].asInt());
-        signalStrength.mutable_gsm_signal_strength_info()->
-            set_gsm_bit_error_rate(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["gsmSignalStrengthInfo"]["gsmBitErrorRate"].asInt());
-    } else {
-        signalStrength.mutable_gsm_signal_strength_info()->set_gsm_signal_strength(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_gsm_signal_strength_info()->set_gsm_bit_error_rate(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-    }
-    LOG(DEBUG, __FUNCTION__, " gsmSignalStrength: ",
-        signalStrength.mutable_gsm_signal_strength_info()->gsm_signal_strength(),
-        " gsmBitErrorRate: ",
-        signalStrength.mutable_gsm_signal_strength_info()->gsm_bit_error_rate());
-
-    // lte signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_LTE) {
-        signalStrength.mutable_lte_signal_strength_info()->
-            set_lte_signal_strength(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["lteSignalStrengthInfo"]["lteSignalStrength"].asInt());
-        signalStrength.mutable_lte_signal_strength_info()->set_lte_rsrp(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["lteRsrp"].asInt());
-        signalStrength.mutable_lte_signal_strength_info()->set_lte_rsrq(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["lteRsrq"].asInt());
-        signalStrength.mutable_lte_signal_strength_info()->set_lte_rssnr(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["lteRssnr"].asInt());
-        signalStrength.mutable_lte_signal_strength_info()->set_lte_cqi(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["lteCqi"].asInt());
-        signalStrength.mutable_lte_signal_strength_info()->set_timing_advance(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-            ["timingAdvance"].asInt());
-    } else {
-        signalStrength.mutable_lte_signal_strength_info()->
-            set_lte_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_lte_signal_strength_info()->set_lte_rsrp(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_lte_signal_strength_info()->set_lte_rsrq(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_lte_signal_strength_info()->set_lte_rssnr(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_lte_signal_strength_info()->set_lte_cqi(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_lte_signal_strength_info()->set_timing_advance(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-    }
-    LOG(DEBUG, __FUNCTION__, " lteSignalStrength: ",
-        signalStrength.mutable_lte_signal_strength_info()->lte_signal_strength(), " lteRsrp: ",
-        signalStrength.mutable_lte_signal_strength_info()->lte_rsrp(), " lteRsrq: ",
-        signalStrength.mutable_lte_signal_strength_info()->lte_rsrq(), " lteRssnr: ",
-        signalStrength.mutable_lte_signal_strength_info()->lte_rssnr(), " lteCqi: ",
-        signalStrength.mutable_lte_signal_strength_info()->lte_cqi(), " timingAdvance: ",
-        signalStrength.mutable_lte_signal_strength_info()->timing_advance());
-
-    // wcdma signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_UMTS) {
-        signalStrength.mutable_wcdma_signal_strength_info()->
-        set_signal_strength(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-            ["wcdmaSignalStrengthInfo"]["signalStrength"].asInt());
-        signalStrength.mutable_wcdma_signal_strength_info()->
-            set_bit_error_rate(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["wcdmaSignalStrengthInfo"]["bitErrorRate"].asInt());
-        signalStrength.mutable_wcdma_signal_strength_info()->
-            set_ecio(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["wcdmaSignalStrengthInfo"]["ecio"].asInt());
-        signalStrength.mutable_wcdma_signal_strength_info()->
-            set_rscp(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["wcdmaSignalStrengthInfo"]["rscp"].asInt());
-    } else {
-        signalStrength.mutable_wcdma_signal_strength_info()->
-            set_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_wcdma_signal_strength_info()->
-            set_bit_error_rate(INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_wcdma_signal_strength_info()->
-            set_ecio(INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_wcdma_signal_strength_info()->
-            set_rscp(INVALID_SIGNAL_STRENGTH_VALUE);
-    }
-    LOG(DEBUG, __FUNCTION__, " wcdmaSignalStrength: ",
-        signalStrength.mutable_wcdma_signal_strength_info()->signal_strength(),
-        " bitErrorRate: ",
-        signalStrength.mutable_wcdma_signal_strength_info()->bit_error_rate(),
-        " ecio: ",
-        signalStrength.mutable_wcdma_signal_strength_info()->ecio(),
-        " rscp: ",
-        signalStrength.mutable_wcdma_signal_strength_info()->rscp());
-
-    // nr5g signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_NR5G) {
-        signalStrength.mutable_nr5g_signal_strength_info()->set_rsrp(
-        stateRootObj[TEL_PHONE_MANAGER]\
-        ["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rsrp"].asInt());
-        signalStrength.mutable_nr5g_signal_strength_info()->set_rsrq(
-            stateRootObj[TEL_PHONE_MANAGER]\
-            ["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rsrq"].asInt());
-        signalStrength.mutable_nr5g_signal_strength_info()->set_rssnr(
-            stateRootObj[TEL_PHONE_MANAGER]\
-            ["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rssnr"].asInt());
-    } else {
-        signalStrength.mutable_nr5g_signal_strength_info()->set_rsrp(INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_nr5g_signal_strength_info()->set_rsrq(INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_nr5g_signal_strength_info()->set_rssnr(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-    }
-    LOG(DEBUG, __FUNCTION__, " nr5gRsrp: ",
-        signalStrength.mutable_nr5g_signal_strength_info()->rsrp(), " nr5gRsrq: ",
-        signalStrength.mutable_nr5g_signal_strength_info()->rsrq(), " nr5gRssnr: ",
-        signalStrength.mutable_nr5g_signal_strength_info()->rssnr());
-    // NB1 NTN signal strength
-    if (servingRat == telStub::RadioTechnology::RADIO_TECH_NB1_NTN) {
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->
-            set_signal_strength(stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                ["nb1NtnSignalStrengthInfo"]["signalStrength"].asInt());
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->set_rsrp(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-            ["rsrp"].asInt());
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->set_rsrq(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-            ["rsrq"].asInt());
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->set_rssnr(
-            stateRootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-            ["rssnr"].asInt());
-    } else {
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->
-            set_signal_strength(INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->set_rsrp(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->set_rsrq(
-            INVALID_SIGNAL_STRENGTH_VALUE);
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->set_rssnr(
-            INVALID_SIGNAL_STRENGTH_VALUE);
+        LOG(ERROR, __FUNCTION__, " Reading signal strength failed" );
     }
-    LOG(DEBUG, __FUNCTION__, " nb1NtnSignalStrength: ",
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->signal_strength(), " nb1NtnRsrp: ",
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->rsrp(), " nb1NtnRsrq: ",
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->rsrq(), " nb1NtnRssnr: ",
-        signalStrength.mutable_nb1_ntn_signal_strength_info()->rssnr());
     return error;
 }
 
@@ -1481,53 +1184,7 @@ telux::common::ErrorCode TelUtil::readRatPreferenceFromJsonFile(int phoneId,
 telux::common::ErrorCode TelUtil::writeSignalStrengthToJsonFile(int phoneId,
     telStub::SignalStrengthChangeEvent &event) {
     LOG(DEBUG, __FUNCTION__);
-    Json::Value rootObj;
-    std::string jsonfilename;
-    telux::common::ErrorCode error = readFromJsonFile(phoneId, TEL_PHONE_MANAGER, rootObj,
-        jsonfilename);
-    if (error != ErrorCode::SUCCESS) {
-        LOG(ERROR, __FUNCTION__, " Reading JSON File failed" );
-        return error;
-    }
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["gsmSignalStrengthInfo"]["gsmSignalStrength"] =
-        event.signal_strength().gsm_signal_strength_info().gsm_signal_strength();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["gsmSignalStrengthInfo"]["gsmBitErrorRate"] =
-        event.signal_strength().gsm_signal_strength_info().gsm_bit_error_rate();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["wcdmaSignalStrengthInfo"]["signalStrength"] =
-        event.signal_strength().wcdma_signal_strength_info().signal_strength();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["wcdmaSignalStrengthInfo"]["bitErrorRate"] =
-        event.signal_strength().wcdma_signal_strength_info().bit_error_rate();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["wcdmaSignalStrengthInfo"]["ecio"] =
-        event.signal_strength().wcdma_signal_strength_info().ecio();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["wcdmaSignalStrengthInfo"]["rscp"] =
-        event.signal_strength().wcdma_signal_strength_info().rscp();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]["lteSignalStrength"] =
-        event.signal_strength().lte_signal_strength_info().lte_signal_strength();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]["lteRsrp"] =
-        event.signal_strength().lte_signal_strength_info().lte_rsrp();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]["lteRsrq"] =
-        event.signal_strength().lte_signal_strength_info().lte_rsrp();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]["lteRssnr"] =
-        event.signal_strength().lte_signal_strength_info().lte_rssnr();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]["lteCqi"] =
-        event.signal_strength().lte_signal_strength_info().lte_cqi();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]["timingAdvance"] =
-        event.signal_strength().lte_signal_strength_info().timing_advance();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rsrp"] =
-        event.signal_strength().nr5g_signal_strength_info().rsrp();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rsrq"] =
-        event.signal_strength().nr5g_signal_strength_info().rsrq();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nr5gSignalStrengthInfo"]["rssnr"] =
-        event.signal_strength().nr5g_signal_strength_info().rssnr();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]["signalStrength"] =
-        event.signal_strength().nb1_ntn_signal_strength_info().signal_strength();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]["rsrp"] =
-        event.signal_strength().nb1_ntn_signal_strength_info().rsrp();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]["rsrq"] =
-        event.signal_strength().nb1_ntn_signal_strength_info().rsrq();
-    rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]["rssnr"] =
-        event.signal_strength().nb1_ntn_signal_strength_info().rssnr();
-    return JsonParser::writeToJsonFile(rootObj, jsonfilename);
+    return RadioStateModel::getInstance().setSignalStrength(phoneId, event.signal_strength());
 }
 
 telux::common::ErrorCode TelUtil::writeVoiceServiceStateToJsonFile(int phoneId,
@@ -1913,6 +1570,7 @@ telux::common::ErrorCode TelUtil::writeConfigureSignalStrengthExToJsonFileAndRep
              data.stateRootObj[TEL_PHONE_MANAGER]["configureSignalStrengthExInfo"]\
                  ["hysteresisMs"] = hysTimer;
              JsonParser::writeToJsonFile(data.stateRootObj, stateJsonPath);
+             RadioStateModel::getInstance().invalidateCriteria(phoneId);
         }
     } else {
         LOG(ERROR, __FUNCTION__, " Unable to read from JSON");
@@ -1928,285 +1586,77 @@ telux::common::ErrorCode TelUtil::writeConfigureSignalStrengthExToJsonFileAndRep
 }
 
 telux::common::ErrorCode TelUtil::writeSignalStrengthToJsonFile(std::vector<std::string> params,
-    int &phoneId, bool &notify) {
+    int &phoneId, bool &notify, telStub::SignalStrengthChangeEvent &event) {
     LOG(DEBUG, __FUNCTION__);
     telux::common::ErrorCode errorCode = telux::common::ErrorCode::INTERNAL_ERR;
+    notify = false;
     try {
         // Read string to get slotId
-        std::string token = telux::common::EventParserUtil::getNextToken(params[0],
-            DEFAULT_DELIMITER);
-        phoneId = std::stoi(token);
+        std::istringstream slotFields(params.at(0));
+        phoneId = readIntField(slotFields);
         LOG(DEBUG, __FUNCTION__, " Slot id is: ", phoneId);
         if (phoneId < SLOT_1 || phoneId > SLOT_2) {
             LOG(ERROR, " Invalid input for slot id");
             return errorCode;
         }
-        Json::Value rootObj;
-        std::string jsonfilename = (phoneId == SLOT_1)? PHONE_JSON_STATE_PATH1 :
-            PHONE_JSON_STATE_PATH2;
-        errorCode = JsonParser::readFromJsonFile(rootObj, jsonfilename);
-        if (errorCode != ErrorCode::SUCCESS) {
-            LOG(ERROR, __FUNCTION__, " Reading JSON File failed" );
-            return errorCode;
-        }
-        // retrieve serving rat
-        std::string stateJsonPath = (phoneId == SLOT_1)?
-            "tel/IServingSystemManagerStateSlot1" : "tel/IServingSystemManagerStateSlot2";
-        int servingRat = std::stoi(CommonUtils::readSystemDataValue(stateJsonPath, "",
-            {TEL_SERVING_MANAGER, "ServingSystemInfo", "rat"}));
-        LOG(DEBUG, __FUNCTION__, " Serving RAT is: ", servingRat);
 
+        // Only the RATs present in the event are updated
+        telStub::SignalStrength update;
         int signalStrengthInfoCount = params.size() - 1;
         LOG(DEBUG, __FUNCTION__, " signalStrengthInfoCount : ", signalStrengthInfoCount);
         for (int index = 1; index <= signalStrengthInfoCount; index++) {
-            std::string rat = telux::common::EventParserUtil::getNextToken(params[index],
-                DEFAULT_DELIMITER);
+            std::istringstream fields(params[index]);
+            std::string rat;
+            fields >> rat;
             LOG(DEBUG, __FUNCTION__, " RAT Type is: ", rat);
             if (rat == "GSM") {
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int signalStrength = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int bitErrorRate = std::stoi(token);
-                LOG(DEBUG, __FUNCTION__," signalStrength: ", signalStrength," bitErrorRate: ",
-                    bitErrorRate);
-
-                if (servingRat == static_cast<int>(telStub::RadioTechnology::RADIO_TECH_GSM)) {
-                    int oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                        ["gsmSignalStrengthInfo"]["gsmSignalStrength"].asInt();
-                    notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                        telStub::RadioTechnology::RADIO_TECH_GSM,
-                        telStub::SignalStrengthMeasurementType::RSSI, oldValue, signalStrength);
-                }
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["gsmSignalStrengthInfo"]\
-                    ["gsmSignalStrength"] = signalStrength;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["gsmSignalStrengthInfo"]\
-                    ["gsmBitErrorRate"] = bitErrorRate;
+                auto info = update.mutable_gsm_signal_strength_info();
+                info->set_gsm_signal_strength(readIntField(fields));
+                info->set_gsm_bit_error_rate(readIntField(fields));
+                LOG(DEBUG, __FUNCTION__," signalStrength: ", info->gsm_signal_strength(),
+                    " bitErrorRate: ", info->gsm_bit_error_rate());
             } else if(rat == "WCDMA") {
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int signalStrength = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int bitErrorRate = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int ecio = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rscp = std::stoi(token);
-                LOG(DEBUG, __FUNCTION__, " signalStrength: ", signalStrength, " bitErrorRate: ",
-                    bitErrorRate, " ecio: ", ecio, " rscp: ", rscp);
-
-                if (servingRat == static_cast<int>(telStub::RadioTechnology::RADIO_TECH_UMTS)) {
-                    int oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                        ["wcdmaSignalStrengthInfo"]["signalStrength"].asInt();
-                    notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                        telStub::RadioTechnology::RADIO_TECH_UMTS,
-                        telStub::SignalStrengthMeasurementType::RSSI, oldValue, signalStrength);
-
-                    if (!notify) { // if any one field changes, need to notify,
-                                  // skip next field check
-                        oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                            ["wcdmaSignalStrengthInfo"]["ecio"].asInt();
-                        notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                            telStub::RadioTechnology::RADIO_TECH_UMTS,
-                            telStub::SignalStrengthMeasurementType::ECIO, oldValue, ecio);
-                    }
-                    if (!notify) { // if any one field changes,need to notify,
-                                   // skip next field check
-                        oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                            ["wcdmaSignalStrengthInfo"]["rscp"].asInt();
-                        notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                            telStub::RadioTechnology::RADIO_TECH_UMTS,
-                            telStub::SignalStrengthMeasurementType::RSCP, oldValue, rscp);
-                    }
-                }
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["wcdmaSignalStrengthInfo"]\
-                    ["signalStrength"] = signalStrength;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["wcdmaSignalStrengthInfo"]\
-                    ["bitErrorRate"] = bitErrorRate;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["wcdmaSignalStrengthInfo"]\
-                    ["ecio"] = ecio;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["wcdmaSignalStrengthInfo"]\
-                    ["rscp"] = rscp;
+                auto info = update.mutable_wcdma_signal_strength_info();
+                info->set_signal_strength(readIntField(fields));
+                info->set_bit_error_rate(readIntField(fields));
+                info->set_ecio(readIntField(fields));
+                info->set_rscp(readIntField(fields));
+                LOG(DEBUG, __FUNCTION__, " signalStrength: ", info->signal_strength(),
+                    " bitErrorRate: ", info->bit_error_rate(), " ecio: ", info->ecio(),
+                    " rscp: ", info->rscp());
             } else if(rat == "LTE") {
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int signalStrength = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rsrp = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rsrq = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rssnr = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int cqi = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int timingAdvance = std::stoi(token);
-                LOG(DEBUG, __FUNCTION__," signalStrength: ", signalStrength," rsrp: ",
-                    rsrp, " rsrq: ", rsrq," rssnr: ", rssnr, " cqi: ", cqi," timingAdvance: ",
-                    timingAdvance);
-
-                if (servingRat == static_cast<int>(telStub::RadioTechnology::RADIO_TECH_LTE)) {
-                    int oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                        ["lteSignalStrengthInfo"]["lteSignalStrength"].asInt();
-                    notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                        telStub::RadioTechnology::RADIO_TECH_LTE,
-                        telStub::SignalStrengthMeasurementType::RSSI, oldValue, signalStrength);
-                    if (!notify) { // if any one field changes, need to notify
-                                   // skip next field check
-                        oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                            ["lteSignalStrengthInfo"]["lteRsrp"].asInt();
-                        notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                            telStub::RadioTechnology::RADIO_TECH_LTE,
-                            telStub::SignalStrengthMeasurementType::RSRP, oldValue, rsrp);
-                    }
-                    if (!notify) { // if any one field changes, need to notify
-                                   // skip next field check
-                        oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                            ["lteSignalStrengthInfo"]["lteRsrq"].asInt();
-                        notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                            telStub::RadioTechnology::RADIO_TECH_LTE,
-                            telStub::SignalStrengthMeasurementType::RSRQ, oldValue, rsrq);
-                    }
-                    if (!notify) { // if any one field changes, need to notify
-                                   // skip next field check
-                        oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                            ["lteSignalStrengthInfo"]["lteRssnr"].asInt();
-                        notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                            telStub::RadioTechnology::RADIO_TECH_LTE,
-                            telStub::SignalStrengthMeasurementType::SNR, oldValue, rssnr);
-                    }
-                }
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-                    ["lteSignalStrength"] = signalStrength;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-                    ["lteRsrp"] = rsrp;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-                    ["lteRsrq"] = rsrq;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-                    ["lteRssnr"] = rssnr;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-                    ["lteCqi"] = cqi;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["lteSignalStrengthInfo"]\
-                    ["timingAdvance"] = timingAdvance;
+                auto info = update.mutable_lte_signal_strength_info();
+                info->set_lte_signal_strength(readIntField(fields));
+                info->set_lte_rsrp(readIntField(fields));
+                info->set_lte_rsrq(readIntField(fields));
+                info->set_lte_rssnr(readIntField(fields));
+                info->set_lte_cqi(readIntField(fields));
+                info->set_timing_advance(readIntField(fields));
+                LOG(DEBUG, __FUNCTION__," signalStrength: ", info->lte_signal_strength(),
+                    " rsrp: ", info->lte_rsrp(), " rsrq: ", info->lte_rsrq(), " rssnr: ",
+                    info->lte_rssnr(), " cqi: ", info->lte_cqi(), " timingAdvance: ",
+                    info->timing_advance());
             } else if(rat == "NR5G") {
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rsrp = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rsrq = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rssnr = std::stoi(token);
-                LOG(DEBUG, __FUNCTION__, " rsrp: ", rsrp, " rsrq: ", rsrq, " rssnr: ", rssnr);
-
-                if (servingRat == static_cast<int>(telStub::RadioTechnology::RADIO_TECH_NR5G)) {
-                    int oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                        ["nr5gSignalStrengthInfo"]["rsrp"].asInt();
-                    notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                        telStub::RadioTechnology::RADIO_TECH_NR5G,
-                        telStub::SignalStrengthMeasurementType::RSRP, oldValue, rsrp);
-                    if (!notify) { // if any one field changes for particular RAT, need to notify
-                                  // skip next field check
-                        oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                            ["nr5gSignalStrengthInfo"]["rsrq"].asInt();
-                        notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                            telStub::RadioTechnology::RADIO_TECH_NR5G,
-                            telStub::SignalStrengthMeasurementType::RSRQ, oldValue, rsrq);
-                    }
-                    if (!notify) { // if any one field changes for particular RAT, need to notify
-                                  // skip next field check
-                        oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                            ["nr5gSignalStrengthInfo"]["rssnr"].asInt();
-                        notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                            telStub::RadioTechnology::RADIO_TECH_NR5G,
-                            telStub::SignalStrengthMeasurementType::SNR, oldValue, rssnr);
-                    }
-                }
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nr5gSignalStrengthInfo"]\
-                    ["rsrp"] = rsrp;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nr5gSignalStrengthInfo"]\
-                    ["rsrq"] = rsrq;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nr5gSignalStrengthInfo"]\
-                    ["rssnr"] = rssnr;
+                auto info = update.mutable_nr5g_signal_strength_info();
+                info->set_rsrp(readIntField(fields));
+                info->set_rsrq(readIntField(fields));
+                info->set_rssnr(readIntField(fields));
+                LOG(DEBUG, __FUNCTION__, " rsrp: ", info->rsrp(), " rsrq: ", info->rsrq(),
+                    " rssnr: ", info->rssnr());
             } else if(rat == "NB1_NTN") {
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int signalStrength = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rsrp = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rsrq = std::stoi(token);
-                token = telux::common::EventParserUtil::getNextToken(params[index],
-                    DEFAULT_DELIMITER);
-                int rssnr = std::stoi(token);
-                LOG(DEBUG, __FUNCTION__, " signalStrength ", signalStrength, " rsrp: ", rsrp,
-                    " rsrq: ", rsrq, " rssnr: ", rssnr);
-
-                if (servingRat == static_cast<int>(telStub::RadioTechnology::RADIO_TECH_NB1_NTN)) {
-                    int oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                        ["nb1NtnSignalStrengthInfo"]["signalStrength"].asInt();
-                    notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                        telStub::RadioTechnology::RADIO_TECH_NB1_NTN,
-                        telStub::SignalStrengthMeasurementType::RSSI, oldValue, signalStrength);
-                    if (!notify) { // if any one field changes, need to notify
-                                   // skip next field check
-                        oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                            ["nb1NtnSignalStrengthInfo"]["rsrp"].asInt();
-                        notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                            telStub::RadioTechnology::RADIO_TECH_NB1_NTN,
-                            telStub::SignalStrengthMeasurementType::RSRP, oldValue, rsrp);
-                        if (!notify) { // if any one field changes for particular RAT, need to
-                                  // notify, skip next field check
-                            oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                                ["nb1NtnSignalStrengthInfo"]["rsrq"].asInt();
-                            notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                                telStub::RadioTechnology::RADIO_TECH_NB1_NTN,
-                                telStub::SignalStrengthMeasurementType::RSRQ, oldValue, rsrq);
-                        }
-                        if (!notify) { // if any one field changes for particular RAT, need to
-                                  // notify, skip next field check
-                            oldValue = rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]\
-                                ["nb1NtnSignalStrengthInfo"]["rssnr"].asInt();
-                            notify = checkSignalStrengthCriteriaAndNotify(phoneId,
-                                telStub::RadioTechnology::RADIO_TECH_NB1_NTN,
-                                telStub::SignalStrengthMeasurementType::SNR, oldValue, rssnr);
-                        }
-                   }
-                }
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-                    ["signalStrength"] = signalStrength;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-                    ["rsrp"] = rsrp;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-                    ["rsrq"] = rsrq;
-                rootObj[TEL_PHONE_MANAGER]["signalStrengthInfo"]["nb1NtnSignalStrengthInfo"]\
-                    ["rssnr"] = rssnr;
+                auto info = update.mutable_nb1_ntn_signal_strength_info();
+                info->set_signal_strength(readIntField(fields));
+                info->set_rsrp(readIntField(fields));
+                info->set_rsrq(readIntField(fields));
+                info->set_rssnr(readIntField(fields));
+                LOG(DEBUG, __FUNCTION__, " signalStrength ", info->signal_strength(), " rsrp: ",
+                    info->rsrp(), " rsrq: ", info->rsrq(), " rssnr: ", info->rssnr());
             } else {
                 LOG(ERROR, " Invalid or deprecated RAT");
             }
         }
-        LOG(DEBUG, __FUNCTION__, " need to notify : ", notify);
-        // last notification time (this will be used if hystereis timer criteria is set)
-        auto current = std::chrono::system_clock::now();
-        std::time_t now_c = std::chrono::system_clock::to_time_t(current);
-        auto tm = std::localtime(&now_c);
-        char buffer[32];
-        std::strftime(buffer, 32, "%Y-%m-%d %H:%M:%S", tm);
-        rootObj[TEL_PHONE_MANAGER]["lastNotificationInfo"]["ssNotificationTimeStamp"] =
-            std::string(buffer);
-        errorCode = JsonParser::writeToJsonFile(rootObj, jsonfilename);
+        errorCode = RadioStateModel::getInstance().updateSignalStrength(phoneId, update, notify,
+            event);
     }  catch(exception const & ex) {
         LOG(ERROR, __FUNCTION__, " Exception Occured: ", ex.what());
         errorCode = telux::common::ErrorCode::INTERNAL_ERR;
@@ -2215,34 +1665,27 @@ telux::common::ErrorCode TelUtil::writeSignalStrengthToJsonFile(std::vector<std:
 }
 
 telux::common::ErrorCode TelUtil::writeCellInfoListToJsonFile(std::vector<std::string> params,
-    int &phoneId) {
-    Json::Value rootObj;
-    std::string jsonfilename = "";
+    int &phoneId, bool &changed) {
+    Json::Value cellList(Json::arrayValue);
+    changed = false;
     try {
         // Read string to get slotId
-        std::string token = EventParserUtil::getNextToken(params[0], DEFAULT_DELIMITER);
-        phoneId = std::stoi(token);
+        std::istringstream slotFields(params.at(0));
+        phoneId = readIntField(slotFields);
+        std::string token;
         LOG(DEBUG, __FUNCTION__, " PhoneId : ", phoneId);
         if (phoneId < SLOT_1 || phoneId > SLOT_2) {
             LOG(ERROR, " Invalid input for phone id");
             return telux::common::ErrorCode::INVALID_ARGUMENTS;
         }
 
-        jsonfilename = (phoneId == SLOT_1)? PHONE_JSON_STATE_PATH1 : PHONE_JSON_STATE_PATH2;
-        telux::common::ErrorCode error = JsonParser::readFromJsonFile(rootObj, jsonfilename);
-        if (error != ErrorCode::SUCCESS) {
-            LOG(ERROR, __FUNCTION__, " Reading JSON File failed" );
-            return telux::common::ErrorCode::INVALID_ARGUMENTS;
-        }
-
-        rootObj[TEL_PHONE_MANAGER] ["cellInfo"]["cellList"].clear();
-        int jsonCellCount = rootObj[TEL_PHONE_MANAGER] ["cellInfo"]["cellList"].size();
         int newCellCount = params.size() - 1;
-        LOG(DEBUG, " jsonCellCount ", jsonCellCount , " newCellCount ", newCellCount);
+        LOG(DEBUG, " newCellCount ", newCellCount);
 
         for (int i = 1; i <= newCellCount; i++) {
             LOG(DEBUG, " Parsing Params:" , params[i]);
-            token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+            std::istringstream fields(params[i]);
+            token = readField(fields);
             int cell = std::stoi(token);
             LOG(DEBUG, __FUNCTION__, " Cell Type is: ", cell);
             ::telStub::CellInfo_CellType cellType = static_cast<::telStub::CellInfo_CellType>(cell);
@@ -2253,125 +1696,125 @@ telux::common::ErrorCode TelUtil::writeCellInfoListToJsonFile(std::vector<std::s
                 return telux::common::ErrorCode::INVALID_ARGUMENTS;
             }
 
-            token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+            token = readField(fields);
             int registered = std::stoi(token);
             LOG(DEBUG, __FUNCTION__, " Is registered cell: ", registered);
 
-            rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["cellType"] = cell;
-            rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["registered"] = registered;
+            cellList[i-1]["cellType"] = cell;
+            cellList[i-1]["registered"] = registered;
 
             switch(cellType) {
                 case ::telStub::CellInfo_CellType::CellInfo_CellType_GSM:
                 {
-                    std::string mcc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    std::string mnc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    std::string mcc = readField(fields);
+                    std::string mnc = readField(fields);
+                    token = readField(fields);
                     int lac = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int cid = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int arfcn = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int bsic = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int signalStrength = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int bitErrorRate = std::stoi(token);
 
                     LOG(DEBUG, __FUNCTION__," mcc:", mcc," mnc:", mnc, " lac:", lac, " cid:",
                         cid, " arfcn:", arfcn, " bsic:", bsic, " signalStrength:", signalStrength
                         , " bitErrorRate:", bitErrorRate);
 
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["gsmCellInfo"]\
+                    cellList[i-1]["gsmCellInfo"]\
                         ["gsmCellIdentity"]["mcc"] = mcc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["gsmCellInfo"]\
+                    cellList[i-1]["gsmCellInfo"]\
                         ["gsmCellIdentity"]["mnc"] = mnc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["gsmCellInfo"]\
+                    cellList[i-1]["gsmCellInfo"]\
                         ["gsmCellIdentity"]["lac"] = lac;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["gsmCellInfo"]\
+                    cellList[i-1]["gsmCellInfo"]\
                         ["gsmCellIdentity"]["cid"] = cid;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["gsmCellInfo"]\
+                    cellList[i-1]["gsmCellInfo"]\
                         ["gsmCellIdentity"]["arfcn"] = arfcn;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["gsmCellInfo"]\
+                    cellList[i-1]["gsmCellInfo"]\
                         ["gsmCellIdentity"]["bsic"] = bsic;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["gsmCellInfo"]\
+                    cellList[i-1]["gsmCellInfo"]\
                         ["gsmSignalStrengthInfo"]["gsmSignalStrength"] = signalStrength;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["gsmCellInfo"]\
+                    cellList[i-1]["gsmCellInfo"]\
                         ["gsmSignalStrengthInfo"]["gsmBitErrorRate"] = bitErrorRate;
 
                     break;
                 }
                 case ::telStub::CellInfo_CellType::CellInfo_CellType_WCDMA:
                 {
-                    std::string mcc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    std::string mnc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    std::string mcc = readField(fields);
+                    std::string mnc = readField(fields);
+                    token = readField(fields);
                     int lac = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int cid = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int psc = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int uarfcn = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int signalStrength = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int bitErrorRate = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int ecio = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int rscp = std::stoi(token);
 
                     LOG(DEBUG, __FUNCTION__," mcc:", mcc," mnc:", mnc, " lac:", lac, " cid:",
                         cid, " psc:", psc, " uarfcn:", uarfcn, " signalStrength:", signalStrength
                         , " bitErrorRate:", bitErrorRate, " ecio:", ecio, "rscp:", rscp);
 
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaCellIdentity"]["mcc"] = mcc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaCellIdentity"]["mnc"] = mnc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaCellIdentity"]["lac"] = lac;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaCellIdentity"]["cid"] = cid;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaCellIdentity"]["psc"] = psc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaCellIdentity"]["uarfcn"] = uarfcn;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaSignalStrengthInfo"]["signalStrength"] = signalStrength;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaSignalStrengthInfo"]["bitErrorRate"] = bitErrorRate;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaSignalStrengthInfo"]["ecio"] = ecio;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["wcdmaCellInfo"]\
+                    cellList[i-1]["wcdmaCellInfo"]\
                         ["wcdmaSignalStrengthInfo"]["rscp"] = rscp;
 
                     break;
                 }
                 case ::telStub::CellInfo_CellType::CellInfo_CellType_LTE:
                 {
-                    std::string mcc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    std::string mnc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    std::string mcc = readField(fields);
+                    std::string mnc = readField(fields);
+                    token = readField(fields);
                     int ci = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int pci = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int tac = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int earfcn = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int signalStrength = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int lteRsrp = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int lteRsrq = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int lteRssnr = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int lteCqi = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int timingAdvance = std::stoi(token);
 
                     LOG(DEBUG, __FUNCTION__," mcc:", mcc," mnc:", mnc, " ci:", ci, " pci:",
@@ -2379,117 +1822,117 @@ telux::common::ErrorCode TelUtil::writeCellInfoListToJsonFile(std::vector<std::s
                         , "lteRsrp:", lteRsrp, "lteRsrq:", lteRsrq, "lteRssnr:", lteRssnr
                         , "lteCqi:", lteCqi, "timingAdvance:", timingAdvance);
 
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteCellIdentity"]["mcc"] = mcc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteCellIdentity"]["mnc"] = mnc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteCellIdentity"]["ci"] = ci;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteCellIdentity"]["pci"] = pci;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteCellIdentity"]["tac"] = tac;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteCellIdentity"]["earfcn"] = earfcn;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteSignalStrengthInfo"]["lteSignalStrength"] = signalStrength;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteSignalStrengthInfo"]["lteRsrp"] = lteRsrp;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteSignalStrengthInfo"]["lteRsrq"] = lteRsrq;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteSignalStrengthInfo"]["lteRssnr"] = lteRssnr;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteSignalStrengthInfo"]["lteCqi"] = lteCqi;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["lteCellInfo"]\
+                    cellList[i-1]["lteCellInfo"]\
                         ["lteSignalStrengthInfo"]["timingAdvance"] = timingAdvance;
 
                     break;
                 }
                 case ::telStub::CellInfo_CellType::CellInfo_CellType_NR5G:
                 {
-                    std::string mcc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    std::string mnc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    std::string mcc = readField(fields);
+                    std::string mnc = readField(fields);
+                    token = readField(fields);
                     int ci = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int pci = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int tac = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int arfcn = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int rsrp = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int rsrq = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int rssnr = std::stoi(token);
 
                     LOG(DEBUG, __FUNCTION__," mcc:", mcc," mnc:", mnc, " ci:", ci, " pci:",
                         pci, " tac:", tac, " arfcn:", arfcn, " rsrp:", rsrp, "rsrq:", rsrq, "rssnr:"
                         , rssnr);
 
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["nr5gCellInfo"]["nr5gCellIdentity"]["mcc"] = mcc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["nr5gCellInfo"]["nr5gCellIdentity"]["mnc"] = mnc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["nr5gCellInfo"]["nr5gCellIdentity"]["ci"] = ci;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["nr5gCellInfo"]["nr5gCellIdentity"]["pci"] = pci;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["nr5gCellInfo"]["nr5gCellIdentity"]["tac"] = tac;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["nr5gCellInfo"]["nr5gCellIdentity"]["arfcn"] = arfcn;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["nr5gCellInfo"]["nr5gSignalStrengthInfo"]["rsrp"] = rsrp;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["nr5gCellInfo"]["nr5gSignalStrengthInfo"]["rsrq"] = rsrq;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["nr5gCellInfo"]["nr5gSignalStrengthInfo"]["rssnr"] = rssnr;
 
                     break;
                 }
                 case ::telStub::CellInfo_CellType::CellInfo_CellType_NB1_NTN:
                 {
-                    std::string mcc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    std::string mnc = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    std::string mcc = readField(fields);
+                    std::string mnc = readField(fields);
+                    token = readField(fields);
                     int ci = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int tac = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int earfcn = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int signalStrength = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int rsrp = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int rsrq = std::stoi(token);
-                    token = EventParserUtil::getNextToken(params[i], DEFAULT_DELIMITER);
+                    token = readField(fields);
                     int rssnr = std::stoi(token);
 
                     LOG(DEBUG, __FUNCTION__," mcc:", mcc," mnc:", mnc, " ci:", ci, " tac:", tac,
                         " earfcn:", earfcn, " signalStrength:", signalStrength
                         , "rsrp:", rsrp, "rsrq:", rsrq, "rssnr:", rssnr);
 
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["nb1NtnCellInfo"]\
+                    cellList[i-1]["nb1NtnCellInfo"]\
                         ["nb1NtnCellIdentity"]["mcc"] = mcc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["nb1NtnCellInfo"]\
+                    cellList[i-1]["nb1NtnCellInfo"]\
                         ["nb1NtnCellIdentity"]["mnc"] = mnc;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["nb1NtnCellInfo"]\
+                    cellList[i-1]["nb1NtnCellInfo"]\
                         ["nb1NtnCellIdentity"]["ci"] = ci;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["nb1NtnCellInfo"]\
+                    cellList[i-1]["nb1NtnCellInfo"]\
                         ["nb1NtnCellIdentity"]["tac"] = tac;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["nb1NtnCellInfo"]\
+                    cellList[i-1]["nb1NtnCellInfo"]\
                         ["nb1NtnCellIdentity"]["earfcn"] = earfcn;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["nb1NtnCellInfo"]\
+                    cellList[i-1]["nb1NtnCellInfo"]\
                         ["nb1NtnSignalStrengthInfo"]["signalStrength"] = signalStrength;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["nb1NtnCellInfo"]\
+                    cellList[i-1]["nb1NtnCellInfo"]\
                         ["nb1NtnSignalStrengthInfo"]["rsrp"] = rsrp;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["nb1NtnCellInfo"]\
+                    cellList[i-1]["nb1NtnCellInfo"]\
                         ["nb1NtnSignalStrengthInfo"]["rsrq"] = rsrq;
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]["nb1NtnCellInfo"]\
+                    cellList[i-1]["nb1NtnCellInfo"]\
                         ["nb1NtnSignalStrengthInfo"]["rssnr"] = rssnr;
                     break;
                  }
@@ -2497,7 +1940,7 @@ telux::common::ErrorCode TelUtil::writeCellInfoListToJsonFile(std::vector<std::s
                 case ::telStub::CellInfo_CellType::CellInfo_CellType_TDSCDMA:
                 default:
                 {
-                    rootObj[TEL_PHONE_MANAGER]["cellInfo"]["cellList"][i-1]\
+                    cellList[i-1]\
                         ["registered"] = 0; // none of the cell is registered
                     LOG(ERROR, " Invalid or deprecated cell type");
                     break;
@@ -2508,7 +1951,7 @@ telux::common::ErrorCode TelUtil::writeCellInfoListToJsonFile(std::vector<std::s
         LOG(ERROR, __FUNCTION__, " Exception Occured: ", ex.what());
         return telux::common::ErrorCode::GENERIC_FAILURE;
     }
-    return JsonParser::writeToJsonFile(rootObj, jsonfilename);
+    return RadioStateModel::getInstance().updateCellInfoList(phoneId, cellList, changed);
 }
 
 telux::common::ErrorCode TelUtil::writeVoiceServiceStateToJsonFile(std::string eventParams,
@@ -2886,210 +2329,5 @@ telStub::VoiceServiceTechnology TelUtil::convertVoiceTechStringToEnum(std::strin
     return ::telStub::VoiceServiceTechnology::VOICE_TECH_INVALID;
 }
 
-/*
- * This function is to check signal strength criteria and control notification
- * based on the criteria set on subscription.
- * HysteresisMs is set, it is the highest priority and other criteria is ignored.
- * Delta or thresholdList can be set as criteria on particular RAT(rat+sigMeasType),
- * hysteresisDb can be applied only on top of thresholsList.If none of the criteria
- * is specified, as per on-target behaviour default values(specified in the RIL) are
- * set.
- * For example: RSSI(50), ECIO(10), SNR(40), RSRQ(20), RSRP(60), RSCP(40)
- */
-int TelUtil::checkSignalStrengthCriteriaAndNotify(int phoneId, int rat, int sigMeasType,
-    int oldValue, int newValue) {
-    LOG(DEBUG, __FUNCTION__);
-    bool notify = false;
-    JsonData data;
-    std::string stateJsonPath = "";
-
-    telux::common::ErrorCode error = readJsonData(phoneId, TEL_PHONE_MANAGER,
-        "configureSignalStrength", data, stateJsonPath);
-    if (error == ErrorCode::SUCCESS) {
-        if (data.status == telux::common::Status::SUCCESS) {
-            uint16_t hysteresisMs = data.stateRootObj[TEL_PHONE_MANAGER]\
-                ["configureSignalStrengthExInfo"]["hysteresisMs"].asInt();
-            LOG(DEBUG, __FUNCTION__, " hysteresis timer : ", static_cast<int>(hysteresisMs));
-            // if hysteresis timer is set, skip other criteria check
-            if (hysteresisMs > 0) {
-                std::string lastNotificationString = data.stateRootObj[TEL_PHONE_MANAGER]\
-                    ["lastNotificationInfo"]["ssNotificationTimeStamp"].asString();
-                LOG(DEBUG, __FUNCTION__, " lastNotification time : ", lastNotificationString);
-                std::tm timeDate = {};
-                std::istringstream ss(lastNotificationString);
-                ss >> std::get_time(&timeDate, "%Y-%m-%d %H:%M:%S");
-                auto lastNotification = std::chrono::system_clock::from_time_t(mktime(&timeDate));
-                auto current = std::chrono::system_clock::now();
-                std::chrono::duration<double> elapsed_seconds = current - lastNotification;
-                LOG(DEBUG, __FUNCTION__, " signal strength last notification in milliseconds : ",
-                    elapsed_seconds.count()*1000);
-                if ((elapsed_seconds.count()*1000) > hysteresisMs) {
-                    // hysteresis timer crossed, notify here
-                    LOG(DEBUG, __FUNCTION__, " Criteria: hysteresis timer satisfied");
-                    notify = true;
-                }
-            } else {
-                int diff = 0;
-                uint16_t defaultDelta = 0;
-                int diffSoFar = 0;
-                int thresholdValue = 0;
-                bool ratMatched = false;
-                LOG(DEBUG, __FUNCTION__," oldValue : ", oldValue, " newValue : ", newValue);
-                int currentCount = data.stateRootObj[TEL_PHONE_MANAGER]\
-                    ["configureSignalStrengthExInfo"]["configureSignalStrengthExInfoList"].size();
-                LOG(DEBUG, __FUNCTION__," current config count is : ", currentCount);
-                int configType = static_cast<int>(telStub::SignalStrengthConfigExType::EX_DELTA);
-                for (int j = 0; j < currentCount; j++) {
-                    // check config type for RAT and signal measurement type provided from event
-                    if (rat == (data.stateRootObj[TEL_PHONE_MANAGER]\
-                        ["configureSignalStrengthExInfo"]["configureSignalStrengthExInfoList"][j]\
-                        ["radioTech"].asInt()) &&
-                        sigMeasType == (data.stateRootObj[TEL_PHONE_MANAGER]\
-                            ["configureSignalStrengthExInfo"]["configureSignalStrengthExInfoList"]\
-                            [j]["sigMeasType"].asInt())) {
-                        LOG(DEBUG, __FUNCTION__, " matched RAT");
-                        ratMatched = true;
-                        int ctCount = data.stateRootObj[TEL_PHONE_MANAGER]\
-                            ["configureSignalStrengthExInfo"]["configureSignalStrengthExInfoList"]\
-                            [j]["configExType"].size();
-                        LOG(DEBUG, __FUNCTION__," configType+++ count : ", ctCount);
-                        for (int ct = 0; ct < ctCount; ct++) {
-                            configType = data.stateRootObj[TEL_PHONE_MANAGER]\
-                                ["configureSignalStrengthExInfo"]\
-                                ["configureSignalStrengthExInfoList"][j]["configExType"][ct].asInt();
-                            LOG(DEBUG, __FUNCTION__," configType : ", configType);
-                            if (configType ==
-                                static_cast<int>(telStub::SignalStrengthConfigExType::EX_DELTA)) {
-                                diff = newValue - oldValue;
-                                diff = (diff < 0) ? (-1*diff) : diff;
-                                uint16_t delta = data.stateRootObj[TEL_PHONE_MANAGER]\
-                                    ["configureSignalStrengthExInfo"]\
-                                    ["configureSignalStrengthExInfoList"][j]["delta"].asInt();
-                                LOG(DEBUG, " delta : ", delta);
-                                if (diff >= (delta/10)) {
-                                    // send notification
-                                    LOG(DEBUG, __FUNCTION__, " Criteria: delta satisfied");
-                                    notify = true;
-                                }
-                            } else if (configType == static_cast<int>
-                                (telStub::SignalStrengthConfigExType::EX_THRESHOLD)) {
-                                int thresholdListLen = data.stateRootObj[TEL_PHONE_MANAGER]\
-                                ["configureSignalStrengthExInfo"]\
-                                ["configureSignalStrengthExInfoList"][j]["thresholdList"].size();
-                                LOG(DEBUG, "  threshold list size :", thresholdListLen);
-                                if (thresholdListLen > 0 && thresholdListLen <= MAX_THRESHOLD_LIST)
-                                {
-                                    // signal strength(RSSI) and SNR is passed as positive integer,
-                                    // convert to negative to compare with threshold.
-                                    if (sigMeasType == static_cast<int>
-                                        (telStub::SignalStrengthMeasurementType::RSSI)
-                                        || sigMeasType == static_cast<int>
-                                        (telStub::SignalStrengthMeasurementType::SNR))
-                                    {
-                                        // SNR can be negative or positive(range -200 to 300)
-                                        if (oldValue > 0 && newValue > 0) {
-                                            oldValue = oldValue * -1;
-                                            newValue = newValue * -1;
-                                        }
-                                    }
-                                    for (int thIdx = 0; thIdx < thresholdListLen; thIdx++) {
-                                       int threshold = ((data.stateRootObj[TEL_PHONE_MANAGER]\
-                                           ["configureSignalStrengthExInfo"]
-                                           ["configureSignalStrengthExInfoList"][j]\
-                                           ["thresholdList"][thIdx].asInt())/10);
-                                        LOG(DEBUG, __FUNCTION__, " threshold: ", threshold * 10);
-                                       // if newValue < threshold <= oldValue
-                                       if ((newValue < threshold) && (threshold <= oldValue)) {
-                                           LOG(DEBUG, __FUNCTION__,
-                                               " Criteria: threshold satisfied");
-                                           notify = true;
-                                           diff = newValue - threshold;
-                                           diff = (diff < 0) ? (-1*diff) : diff;
-                                           if (diff >= diffSoFar) {
-                                               diffSoFar = diff;
-                                               thresholdValue = threshold;
-                                           }
-                                       }
-                                       // if oldValue < threshold <= newValue
-                                       if ((oldValue < threshold) && (threshold  <= newValue))
-                                       {
-                                           LOG(DEBUG, __FUNCTION__,
-                                               " Criteria: threshold satisfied");
-                                           notify = true;
-                                           diff = newValue - threshold;
-                                           diff = (diff < 0) ? (-1*diff) : diff;
-                                           if (diff >= diffSoFar)
-                                           {
-                                               diffSoFar = diff;
-                                               thresholdValue = threshold;
-                                           }
-                                       }
-                                    }
-                                }
-                            }
-                            if (configType == static_cast<int>
-                                (telStub::SignalStrengthConfigExType::EX_HYSTERESIS_DB)){
-                                uint16_t hysteresisDb = data.stateRootObj[TEL_PHONE_MANAGER]\
-                                    ["configureSignalStrengthExInfo"]\
-                                    ["configureSignalStrengthExInfoList"][j]["hysteresisDb"].asInt();
-                                LOG(DEBUG, " hysteresisDb : ", hysteresisDb);
-                                if (notify && hysteresisDb > 0) {
-                                    diff = 0; // reset diff, threshold criteria is satisfied
-                                    diff = newValue - thresholdValue;
-                                    diff = (diff < 0) ? (-1*diff) : diff;
-                                }
-                                if (diff > (hysteresisDb/10)) {
-                                    // send notification
-                                    LOG(DEBUG, __FUNCTION__,
-                                        " Criteria: threshold + hysteresis delta satisfied");
-                                    notify = true;
-                                }
-                            }
-                        }
-                    }
-                }
-                if (!ratMatched) {
-                    LOG(DEBUG, __FUNCTION__, " Criteria is not set, checking with default");
-                    diff = newValue - oldValue;
-                    diff = (diff < 0) ? (-1*diff) : diff;
-                    switch (sigMeasType) {
-                        case telStub::SignalStrengthMeasurementType::RSSI:
-                            defaultDelta = 50;
-                            break;
-                        case telStub::SignalStrengthMeasurementType::ECIO:
-                            defaultDelta = 10;
-                            break;
-                        case telStub::SignalStrengthMeasurementType::SNR:
-                        case telStub::SignalStrengthMeasurementType::RSCP:
-                            defaultDelta = 40;
-                            break;
-                        case telStub::SignalStrengthMeasurementType::RSRP:
-                            defaultDelta = 60;
-                            break;
-                        case telStub::SignalStrengthMeasurementType::RSRQ:
-                            defaultDelta = 20;
-                            break;
-                        default:
-                            LOG(DEBUG, __FUNCTION__, " not supported signal type");
-                            break;
-                    }
-                    // compare with default delta
-                    if (diff >= (defaultDelta/10)) {
-                        // send notification
-                        LOG(DEBUG, __FUNCTION__, " Criteria: default delta satisfied");
-                        notify = true;
-                    }
-                }
-            }
-        }
-    } else {
-        LOG(ERROR, __FUNCTION__, " Unable to read from JSON");
-        // notify if no signal strength config criteria is set
-        notify = true;
-    }
-    LOG(DEBUG, __FUNCTION__, " notify : ", notify);
-    return notify;
-}
-
 }  // End of namespace tel
 }  // End of namespace telux
@@ -23,6 +23,10 @@ namespace tel {
 class TelUtil {
 
 public:
+    /**
+     * Returns the modification time of a JSON file in nanoseconds, -1 if it doesn't exist.
+     */
+    static int64_t getJsonFileModifiedTime(std::string fileName);
     static telux::common::ErrorCode readFromJsonFile(int phoneId, std::string subsystem,
         Json::Value &rootObj, std::string &jsonfilename);
     static telux::common::ErrorCode readJsonData(int phoneId, std::string subsystem,
@@ -106,9 +110,9 @@ public:
         telStub::ConfigureSignalStrengthExReply* response, uint16_t hysTimer);
 
     static telux::common::ErrorCode writeSignalStrengthToJsonFile(std::vector<std::string> params,
-        int &phoneId, bool &notify);
+        int &phoneId, bool &notify, telStub::SignalStrengthChangeEvent &event);
     static telux::common::ErrorCode writeCellInfoListToJsonFile(std::vector<std::string> params,
-        int &phoneId);
+        int &phoneId, bool &changed);
     static telux::common::ErrorCode writeVoiceServiceStateToJsonFile(std::string params,
         int &phoneId);
     static telux::common::ErrorCode writeOperatingModeToJsonFile(std::string params,
@@ -130,8 +134,6 @@ public:
         telStub::ServiceState serviceState);
     static telStub::VoiceRadioTechnologyChangeEvent createVoiceRadioTechnologyChangeEvent(
         int phoneId, telStub::RadioTechnology rat);
-    static int checkSignalStrengthCriteriaAndNotify(int phoneId, int rat, int sigMeasType,
-        int oldValue, int newValue);
 
     //Utilities
     static telStub::RATCapability convertRATCapStringToEnum(std::string radioCap);
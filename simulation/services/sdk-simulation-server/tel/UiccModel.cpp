@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "UiccModel.hpp"
+
+#include "TelUtil.hpp"
+#include "libs/common/CommonUtils.hpp"
+#include "libs/common/JsonParser.hpp"
+#include "libs/common/Logger.hpp"
+
+#define CARD_JSON_STATE_PATH1 "system-state/tel/ICardManagerStateSlot1.json"
+#define CARD_JSON_STATE_PATH2 "system-state/tel/ICardManagerStateSlot2.json"
+#define CARD_JSON_API_PATH1 "api/tel/ICardManagerSlot1.json"
+#define CARD_JSON_API_PATH2 "api/tel/ICardManagerSlot2.json"
+
+#define TEL_CARD_MANAGER "ICardManager"
+#define LINEAR_FIXED_FILES "LinearFixedEFFiles"
+#define TRANSPARENT_FILES "TransparentEFFiles"
+#define DF_LINEAR_FIXED_FILES "DFLinearFixedEFRecords"
+#define DF_TRANSPARENT_FILES "DFTransparentEFRecords"
+#define OPEN_LOGICAL_CHANNEL "openLogicalChannel"
+
+#define SLOT_1 1
+
+using telux::common::ErrorCode;
+
+namespace telux {
+namespace tel {
+
+/* Sections of the system-state file holding the response of each APDU channel */
+static const char *APDU_SECTIONS[] = {
+    "transmitApduLogicalChannel",
+    "transmitApduBasicChannel",
+    "exchangeSimIO"
+};
+
+static std::string getStateFileName(int slotId) {
+    return (slotId == SLOT_1) ? CARD_JSON_STATE_PATH1 : CARD_JSON_STATE_PATH2;
+}
+
+static std::string getApiFileName(int slotId) {
+    return (slotId == SLOT_1) ? CARD_JSON_API_PATH1 : CARD_JSON_API_PATH2;
+}
+
+/* Path of an EF record in the system-state file, relative to ICardManager */
+static std::vector<Json::Value> getRecordPath(int appIndex, bool isLinearFixed,
+    Json::ArrayIndex recordIndex) {
+    std::vector<Json::Value> path;
+    path.emplace_back("EFs");
+    if (appIndex < 0) {
+        path.emplace_back(isLinearFixed ? DF_LINEAR_FIXED_FILES : DF_TRANSPARENT_FILES);
+    } else {
+        path.emplace_back("ADF");
+        path.emplace_back(static_cast<Json::UInt>(appIndex));
+        path.emplace_back(isLinearFixed ? LINEAR_FIXED_FILES : TRANSPARENT_FILES);
+    }
+    path.emplace_back(static_cast<Json::UInt>(recordIndex));
+    return path;
+}
+
+static std::string getPathKey(const std::vector<Json::Value> &path) {
+    std::string key;
+    for (auto &element : path) {
+        key += "/" + (element.isString() ? element.asString() : std::to_string(element.asUInt()));
+    }
+    return key;
+}
+
+static void toIccResult(const std::vector<int> &data, const std::string &payload, int sw1,
+    int sw2, telux::tel::IccResult &result) {
+    result.sw1 = sw1;
+    result.sw2 = sw2;
+    result.payload = payload;
+    result.data = data;
+}
+
+UiccModel::UiccModel()
+   : timerService_(telux::common::TimerService::getInstance()) {
+    LOG(DEBUG, __FUNCTION__);
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int slotId = SLOT_1; slotId < SLOT_1 + NUM_SLOTS; slotId++) {
+        loadLocked(slotId, slots_[slotId - SLOT_1]);
+    }
+}
+
+UiccModel::~UiccModel() {
+    LOG(DEBUG, __FUNCTION__);
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int slotId = SLOT_1; slotId < SLOT_1 + NUM_SLOTS; slotId++) {
+        SlotState &slot = slots_[slotId - SLOT_1];
+        if (slot.flushTimerId != telux::common::TimerService::INVALID_TIMER_ID) {
+            timerService_->cancel(slot.flushTimerId);
+        }
+        flushLocked(slotId, slot);
+    }
+}
+
+UiccModel::SlotState *UiccModel::getSlotLocked(int slotId) {
+    if ((slotId < SLOT_1) || (slotId >= SLOT_1 + NUM_SLOTS)) {
+        LOG(ERROR, __FUNCTION__, " Invalid slot ", slotId);
+        return nullptr;
+    }
+    SlotState &slot = slots_[slotId - SLOT_1];
+    int64_t mtime = TelUtil::getJsonFileModifiedTime(getStateFileName(slotId));
+    if ((!slot.isLoaded) || (mtime != slot.fileMtime)) {
+        // Modified by someone else, apply the pending updates on top of it before reloading
+        flushLocked(slotId, slot);
+        loadLocked(slotId, slot);
+    }
+    return slot.isLoaded ? &slot : nullptr;
+}
+
+void UiccModel::loadLocked(int slotId, SlotState &slot) {
+    std::string jsonfilename = getStateFileName(slotId);
+    Json::Value rootObj;
+    slot.fileMtime = TelUtil::getJsonFileModifiedTime(jsonfilename);
+    if (JsonParser::readFromJsonFile(rootObj, jsonfilename) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Reading JSON File failed! ", jsonfilename);
+        slot.isLoaded = false;
+        return;
+    }
+    LOG(DEBUG, __FUNCTION__, " Slot: ", slotId);
+    const Json::Value &card = rootObj[TEL_CARD_MANAGER];
+    const Json::Value &efs = card["EFs"];
+    slot.applications.clear();
+    const Json::Value &adfs = efs["ADF"];
+    for (Json::ArrayIndex i = 0; i < adfs.size(); i++) {
+        std::string aid = adfs[i]["AppId"].asString();
+        if (slot.applications.count(aid)) {
+            // The first application with an AID is the one found by lookups
+            continue;
+        }
+        Application &app = slot.applications[aid];
+        app.jsonIndex = static_cast<int>(i);
+        parseFiles(adfs[i][LINEAR_FIXED_FILES], true, app.linearFixedFiles);
+        parseFiles(adfs[i][TRANSPARENT_FILES], false, app.transparentFiles);
+    }
+    slot.df = Application();
+    parseFiles(efs[DF_LINEAR_FIXED_FILES], true, slot.df.linearFixedFiles);
+    parseFiles(efs[DF_TRANSPARENT_FILES], false, slot.df.transparentFiles);
+
+    slot.configuredChannel = card[OPEN_LOGICAL_CHANNEL]["onChannelResponseChannel"].asInt();
+    slot.openChannels.clear();
+    if (card[OPEN_LOGICAL_CHANNEL]["isOpen"].asBool()) {
+        slot.openChannels.insert(slot.configuredChannel);
+    }
+    for (int i = 0; i < NUM_APDU_CHANNELS; i++) {
+        const Json::Value &section = card[APDU_SECTIONS[i]];
+        Record &response = slot.apduResponses[i];
+        response.sw1 = section["onChannelResponseSw1"].asInt();
+        response.sw2 = section["onChannelResponseSw2"].asInt();
+        response.payload = section["onChannelResponsePayload"].asString();
+        response.data = CommonUtils::convertStringToVector(
+            section["onChannelResponseData"].asString());
+    }
+    slot.isLoaded = true;
+}
+
+void UiccModel::parseFiles(const Json::Value &files, bool isLinearFixed,
+    std::unordered_map<uint16_t, ElementaryFile> &table) {
+    table.clear();
+    Json::ArrayIndex i = 0;
+    while (i < files.size()) {
+        // A linear fixed file is a header with the number of records followed by the records
+        uint16_t fileId = static_cast<uint16_t>(files[i]["fileId"].asInt());
+        Json::ArrayIndex first = isLinearFixed ? i + 1 : i;
+        Json::ArrayIndex count = isLinearFixed ? files[i]["numberOfRecords"].asUInt() : 1;
+        ElementaryFile file;
+        for (Json::ArrayIndex j = first; (j < first + count) && (j < files.size()); j++) {
+            Record record;
+            record.sw1 = files[j]["sw1"].asInt();
+            record.sw2 = files[j]["sw2"].asInt();
+            record.payload = files[j]["payload"].asString();
+            record.data = CommonUtils::convertStringToVector(files[j]["data"].asString());
+            record.jsonIndex = j;
+            file.records.emplace_back(record);
+        }
+        table.emplace(fileId, std::move(file));
+        i = first + count;
+    }
+}
+
+UiccModel::Application *UiccModel::findApplicationLocked(SlotState &slot,
+    const std::string &aid, bool isDfAllowed) {
+    auto it = slot.applications.find(aid);
+    if (it != slot.applications.end()) {
+        return &it->second;
+    }
+    if (!isDfAllowed) {
+        LOG(DEBUG, __FUNCTION__, " Valid AppId not found");
+        return nullptr;
+    }
+    return &slot.df;
+}
+
+UiccModel::ElementaryFile *UiccModel::findFileLocked(SlotState &slot, const std::string &aid,
+    uint16_t fileId, bool isLinearFixed, int &appIndex) {
+    Application *app = findApplicationLocked(slot, aid, true);
+    auto &table = isLinearFixed ? app->linearFixedFiles : app->transparentFiles;
+    auto it = table.find(fileId);
+    if (it == table.end()) {
+        LOG(DEBUG, __FUNCTION__, " FileId not found ", fileId);
+        return nullptr;
+    }
+    appIndex = app->jsonIndex;
+    return &it->second;
+}
+
+telux::common::ErrorCode UiccModel::readRecord(int slotId, const std::string &aid,
+    uint16_t fileId, int recordNumber, telux::tel::IccResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlotLocked(slotId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    int appIndex = -1;
+    ElementaryFile *file = findFileLocked(*slot, aid, fileId, true, appIndex);
+    if ((!file) || (recordNumber < 1)
+        || (recordNumber > static_cast<int>(file->records.size()))) {
+        LOG(DEBUG, __FUNCTION__, " Valid record not found ", recordNumber);
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    const Record &record = file->records[recordNumber - 1];
+    toIccResult(record.data, record.payload, record.sw1, record.sw2, result);
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode UiccModel::readAllRecords(int slotId, const std::string &aid,
+    uint16_t fileId, std::vector<telux::tel::IccResult> &records) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlotLocked(slotId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    int appIndex = -1;
+    ElementaryFile *file = findFileLocked(*slot, aid, fileId, true, appIndex);
+    if (!file) {
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    records.reserve(file->records.size());
+    for (auto &record : file->records) {
+        telux::tel::IccResult result;
+        toIccResult(record.data, record.payload, record.sw1, record.sw2, result);
+        records.emplace_back(result);
+    }
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode UiccModel::readTransparent(int slotId, const std::string &aid,
+    uint16_t fileId, telux::tel::IccResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlotLocked(slotId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    int appIndex = -1;
+    ElementaryFile *file = findFileLocked(*slot, aid, fileId, false, appIndex);
+    if ((!file) || file->records.empty()) {
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    const Record &record = file->records[0];
+    toIccResult(record.data, record.payload, record.sw1, record.sw2, result);
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode UiccModel::writeRecord(int slotId, const std::string &aid,
+    uint16_t fileId, int recordNumber, const std::vector<uint8_t> &data,
+    telux::tel::IccResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlotLocked(slotId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    int appIndex = -1;
+    ElementaryFile *file = findFileLocked(*slot, aid, fileId, true, appIndex);
+    if ((!file) || (recordNumber < 1)
+        || (recordNumber > static_cast<int>(file->records.size()))) {
+        LOG(DEBUG, __FUNCTION__, " Valid record not found ", recordNumber);
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    Record &record = file->records[recordNumber - 1];
+    updateRecordLocked(slotId, *slot, getRecordPath(appIndex, true, record.jsonIndex), record,
+        data);
+    toIccResult(std::vector<int>(), "", record.sw1, record.sw2, result);
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode UiccModel::writeTransparent(int slotId, const std::string &aid,
+    uint16_t fileId, const std::vector<uint8_t> &data, telux::tel::IccResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlotLocked(slotId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    int appIndex = -1;
+    ElementaryFile *file = findFileLocked(*slot, aid, fileId, false, appIndex);
+    if ((!file) || file->records.empty()) {
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    Record &record = file->records[0];
+    updateRecordLocked(slotId, *slot, getRecordPath(appIndex, false, record.jsonIndex), record,
+        data);
+    toIccResult(std::vector<int>(), "", record.sw1, record.sw2, result);
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode UiccModel::getFileAttributes(int slotId, const std::string &aid,
+    uint16_t fileId, telux::tel::EfType efType, telux::tel::FileAttributes &attributes,
+    telux::tel::IccResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlotLocked(slotId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    Application *app = findApplicationLocked(*slot, aid, false);
+    if (!app) {
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    bool isLinearFixed = (efType == telux::tel::EfType::LINEAR_FIXED);
+    if ((!isLinearFixed) && (efType != telux::tel::EfType::TRANSPARENT)) {
+        LOG(DEBUG, __FUNCTION__, " Unknown EFType");
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    auto &table = isLinearFixed ? app->linearFixedFiles : app->transparentFiles;
+    auto it = table.find(fileId);
+    if ((it == table.end()) || it->second.records.empty()) {
+        LOG(DEBUG, __FUNCTION__, " FileId not found ", fileId);
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    const Record &record = it->second.records[0];
+    attributes.recordSize = record.data.size();
+    if (isLinearFixed) {
+        attributes.recordCount = it->second.records.size();
+        attributes.fileSize = attributes.recordCount * attributes.recordSize;
+        toIccResult(record.data, record.payload, record.sw1, record.sw2, result);
+    } else {
+        attributes.recordCount = 0;
+        attributes.fileSize = attributes.recordSize;
+        toIccResult(std::vector<int>(), record.payload, record.sw1, record.sw2, result);
+    }
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode UiccModel::openLogicalChannel(int slotId, int &channelId,
+    telux::tel::IccResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlotLocked(slotId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    if (slot->openChannels.count(slot->configuredChannel)) {
+        LOG(DEBUG, __FUNCTION__, " already open");
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    slot->openChannels.insert(slot->configuredChannel);
+    journalLocked(slotId, *slot, {OPEN_LOGICAL_CHANNEL}, "isOpen", true);
+    const Record &response = slot->apduResponses[static_cast<int>(ApduChannel::LOGICAL)];
+    toIccResult(response.data, response.payload, response.sw1, response.sw2, result);
+    channelId = slot->configuredChannel;
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode UiccModel::closeLogicalChannel(int slotId, int channelId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlotLocked(slotId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    if (channelId != slot->configuredChannel) {
+        LOG(DEBUG, __FUNCTION__, " Invalid channel");
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    if (!slot->openChannels.erase(channelId)) {
+        LOG(DEBUG, __FUNCTION__, " already closed");
+        return ErrorCode::GENERIC_FAILURE;
+    }
+    journalLocked(slotId, *slot, {OPEN_LOGICAL_CHANNEL}, "isOpen", false);
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode UiccModel::transmit(int slotId, ApduChannel channel,
+    const std::vector<uint8_t> &data, telux::tel::IccResult &result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SlotState *slot = getSlotLocked(slotId);
+    if (!slot) {
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    int index = static_cast<int>(channel);
+    Record &response = slot->apduResponses[index];
+    std::vector<Json::Value> path = {APDU_SECTIONS[index]};
+    std::string dataStr = CommonUtils::convertVectorToString(data, false);
+    response.payload = CommonUtils::convertVectorToString(data, true);
+    response.data = CommonUtils::convertStringToVector(dataStr);
+    journalLocked(slotId, *slot, path, "onChannelResponseData", dataStr);
+    journalLocked(slotId, *slot, path, "onChannelResponsePayload", response.payload);
+    toIccResult(response.data, response.payload, response.sw1, response.sw2, result);
+    return ErrorCode::SUCCESS;
+}
+
+telux::common::ErrorCode UiccModel::getApiResponse(int slotId, const std::string &apiName,
+    Json::Value &rootObj) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if ((slotId < SLOT_1) || (slotId >= SLOT_1 + NUM_SLOTS)) {
+        LOG(ERROR, __FUNCTION__, " Invalid slot ", slotId);
+        return ErrorCode::INVALID_ARGUMENTS;
+    }
+    SlotState &slot = slots_[slotId - SLOT_1];
+    std::string jsonfilename = getApiFileName(slotId);
+    int64_t mtime = TelUtil::getJsonFileModifiedTime(jsonfilename);
+    if ((mtime < 0) || (mtime != slot.apiFileMtime)) {
+        Json::Value apiRoot;
+        if (JsonParser::readFromJsonFile(apiRoot, jsonfilename) != ErrorCode::SUCCESS) {
+            LOG(ERROR, __FUNCTION__, " Reading JSON File failed! ", jsonfilename);
+            return ErrorCode::GENERIC_FAILURE;
+        }
+        slot.apiRoot = apiRoot;
+        slot.apiFileMtime = mtime;
+    }
+    const Json::Value &api = slot.apiRoot[TEL_CARD_MANAGER];
+    rootObj = Json::Value(Json::objectValue);
+    rootObj[TEL_CARD_MANAGER][apiName] = api[apiName];
+    rootObj[TEL_CARD_MANAGER]["DefaultCallbackDelay"] = api["DefaultCallbackDelay"];
+    return ErrorCode::SUCCESS;
+}
+
+void UiccModel::updateRecordLocked(int slotId, SlotState &slot, std::vector<Json::Value> path,
+    Record &record, const std::vector<uint8_t> &data) {
+    std::string dataStr = CommonUtils::convertVectorToString(data, false);
+    record.payload = CommonUtils::convertVectorToString(data, true);
+    record.data = CommonUtils::convertStringToVector(dataStr);
+    journalLocked(slotId, slot, path, "data", dataStr);
+    journalLocked(slotId, slot, path, "payload", record.payload);
+}
+
+void UiccModel::journalLocked(int slotId, SlotState &slot, const std::vector<Json::Value> &path,
+    const char *key, const Json::Value &value) {
+    auto &entry = slot.journal[getPathKey(path)];
+    entry.first = path;
+    entry.second[key] = value;
+    scheduleFlushLocked(slotId, slot);
+}
+
+void UiccModel::scheduleFlushLocked(int slotId, SlotState &slot) {
+    if (slot.flushTimerId != telux::common::TimerService::INVALID_TIMER_ID) {
+        return;
+    }
+    std::weak_ptr<UiccModel> weakSelf = shared_from_this();
+    timerService_->runAfter(FLUSH_INTERVAL_MS, [weakSelf, slotId]() {
+        if (auto self = weakSelf.lock()) {
+            std::lock_guard<std::mutex> lock(self->mutex_);
+            SlotState &slot = self->slots_[slotId - SLOT_1];
+            slot.flushTimerId = telux::common::TimerService::INVALID_TIMER_ID;
+            self->flushLocked(slotId, slot);
+        }
+    }, &slot.flushTimerId);
+}
+
+void UiccModel::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int slotId = SLOT_1; slotId < SLOT_1 + NUM_SLOTS; slotId++) {
+        SlotState &slot = slots_[slotId - SLOT_1];
+        if (slot.flushTimerId != telux::common::TimerService::INVALID_TIMER_ID) {
+            timerService_->cancel(slot.flushTimerId);
+            slot.flushTimerId = telux::common::TimerService::INVALID_TIMER_ID;
+        }
+        flushLocked(slotId, slot);
+    }
+}
+
+void UiccModel::flushLocked(int slotId, SlotState &slot) {
+    if (slot.journal.empty()) {
+        return;
+    }
+    LOG(DEBUG, __FUNCTION__, " Slot: ", slotId, ", updates: ", slot.journal.size());
+    std::string jsonfilename = getStateFileName(slotId);
+    Json::Value rootObj;
+    if (JsonParser::readFromJsonFile(rootObj, jsonfilename) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Reading JSON File failed! ", jsonfilename);
+        return;
+    }
+    for (auto &entry : slot.journal) {
+        Json::Value *node = &rootObj[TEL_CARD_MANAGER];
+        for (auto &element : entry.second.first) {
+            node = element.isString() ? &(*node)[element.asString()]
+                : &(*node)[element.asUInt()];
+        }
+        for (auto &key : entry.second.second.getMemberNames()) {
+            (*node)[key] = entry.second.second[key];
+        }
+    }
+    if (JsonParser::writeToJsonFile(rootObj, jsonfilename) != ErrorCode::SUCCESS) {
+        LOG(ERROR, __FUNCTION__, " Writing JSON File failed! ", jsonfilename);
+        return;
+    }
+    slot.journal.clear();
+    // The model already holds what was written, don't reload it
+    slot.fileMtime = TelUtil::getJsonFileModifiedTime(jsonfilename);
+}
+
+}  // end of namespace tel
+}  // end of namespace telux
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       UiccModel.hpp
+ *
+ * @brief      UiccModel keeps the elementary files, logical channel and APDU responses of
+ *             each card in memory. Files are looked up by AID and file id in hash tables and
+ *             their records are parsed once when the card system-state file is loaded.
+ *             Updates are journaled and written back to the system-state file
+ *             asynchronously. The file is reloaded when it is modified by someone else.
+ */
+
+#ifndef UICC_MODEL_HPP
+#define UICC_MODEL_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <jsoncpp/json/json.h>
+#include <telux/common/CommonDefines.hpp>
+#include <telux/tel/CardDefines.hpp>
+#include <telux/tel/CardFileHandler.hpp>
+
+#include "libs/common/TimerService.hpp"
+
+namespace telux {
+namespace tel {
+
+class UiccModel : public std::enable_shared_from_this<UiccModel> {
+ public:
+    /* Requests answered with the canned response of a section of the system-state file */
+    enum class ApduChannel {
+        LOGICAL,
+        BASIC,
+        SIM_IO
+    };
+
+    UiccModel();
+    ~UiccModel();
+
+    /**
+     * Lookups of the file APIs search the DF files when no application has the AID.
+     */
+    telux::common::ErrorCode readRecord(int slotId, const std::string &aid, uint16_t fileId,
+        int recordNumber, telux::tel::IccResult &result);
+    telux::common::ErrorCode readAllRecords(int slotId, const std::string &aid, uint16_t fileId,
+        std::vector<telux::tel::IccResult> &records);
+    telux::common::ErrorCode readTransparent(int slotId, const std::string &aid,
+        uint16_t fileId, telux::tel::IccResult &result);
+    telux::common::ErrorCode writeRecord(int slotId, const std::string &aid, uint16_t fileId,
+        int recordNumber, const std::vector<uint8_t> &data, telux::tel::IccResult &result);
+    telux::common::ErrorCode writeTransparent(int slotId, const std::string &aid,
+        uint16_t fileId, const std::vector<uint8_t> &data, telux::tel::IccResult &result);
+
+    /**
+     * Gets the attributes of an EF of an application, the result is that of the first record.
+     */
+    telux::common::ErrorCode getFileAttributes(int slotId, const std::string &aid,
+        uint16_t fileId, telux::tel::EfType efType, telux::tel::FileAttributes &attributes,
+        telux::tel::IccResult &result);
+
+    telux::common::ErrorCode openLogicalChannel(int slotId, int &channelId,
+        telux::tel::IccResult &result);
+    telux::common::ErrorCode closeLogicalChannel(int slotId, int channelId);
+
+    /**
+     * Stores the request data as the response data of the channel and returns the response.
+     */
+    telux::common::ErrorCode transmit(int slotId, ApduChannel channel,
+        const std::vector<uint8_t> &data, telux::tel::IccResult &result);
+
+    /**
+     * Gets the configured response of an API from the card API file, the file is only read
+     * again when it has been modified.
+     *
+     * @param [out] rootObj    Holds ICardManager with the API and the default callback delay
+     */
+    telux::common::ErrorCode getApiResponse(int slotId, const std::string &apiName,
+        Json::Value &rootObj);
+
+    /**
+     * Writes the journaled updates of all slots to their system-state files.
+     */
+    void flush();
+
+ private:
+    static const int FLUSH_INTERVAL_MS = 1000;
+    static const int NUM_SLOTS = 2;
+    static const int NUM_APDU_CHANNELS = 3;
+
+    struct Record {
+        int sw1 = 0;
+        int sw2 = 0;
+        std::string payload;
+        std::vector<int> data;
+        /* Index of the record in the JSON file array */
+        Json::ArrayIndex jsonIndex = 0;
+    };
+
+    struct ElementaryFile {
+        /* A transparent file has a single record */
+        std::vector<Record> records;
+    };
+
+    struct Application {
+        /* Index in the ADF array, -1 for the DF files */
+        int jsonIndex = -1;
+        std::unordered_map<uint16_t, ElementaryFile> linearFixedFiles;
+        std::unordered_map<uint16_t, ElementaryFile> transparentFiles;
+    };
+
+    struct SlotState {
+        bool isLoaded = false;
+        int64_t fileMtime = -1;
+        std::unordered_map<std::string, Application> applications;
+        Application df;
+        /* The card answers open requests with a single configured channel */
+        int configuredChannel = -1;
+        std::set<int> openChannels;
+        Record apduResponses[NUM_APDU_CHANNELS];
+
+        /* Pending updates, keyed by the path of the updated JSON object */
+        std::map<std::string, std::pair<std::vector<Json::Value>, Json::Value>> journal;
+        telux::common::TimerService::TimerId flushTimerId
+            = telux::common::TimerService::INVALID_TIMER_ID;
+
+        Json::Value apiRoot;
+        int64_t apiFileMtime = -1;
+    };
+
+    UiccModel(const UiccModel &) = delete;
+    UiccModel &operator=(const UiccModel &) = delete;
+
+    SlotState *getSlotLocked(int slotId);
+    void loadLocked(int slotId, SlotState &slot);
+    void parseFiles(const Json::Value &files, bool isLinearFixed,
+        std::unordered_map<uint16_t, ElementaryFile> &table);
+    Application *findApplicationLocked(SlotState &slot, const std::string &aid,
+        bool isDfAllowed);
+    ElementaryFile *findFileLocked(SlotState &slot, const std::string &aid, uint16_t fileId,
+        bool isLinearFixed, int &appIndex);
+    void updateRecordLocked(int slotId, SlotState &slot, std::vector<Json::Value> path,
+        Record &record, const std::vector<uint8_t> &data);
+    void journalLocked(int slotId, SlotState &slot, const std::vector<Json::Value> &path,
+        const char *key, const Json::Value &value);
+    void scheduleFlushLocked(int slotId, SlotState &slot);
+    void flushLocked(int slotId, SlotState &slot);
+
+    std::mutex mutex_;
+    std::shared_ptr<telux::common::TimerService> timerService_;
+    SlotState slots_[NUM_SLOTS];
+};
+
+}  // end of namespace tel
+}  // end of namespace telux
+
+#endif  // UICC_MODEL_HPP
@@ -4,6 +4,7 @@
  */
 
 #include "ThermalGrpcServerImpl.hpp"
+#include "common/RpcExecutor.hpp"
 
 uint16_t ThermalGrpcServerImpl::OnCdevLevelChngNotifyCnt_ = 0;
 uint16_t ThermalGrpcServerImpl::OnTripEvntNotifyCnt_ = 0;
@@ -11,6 +12,7 @@ uint16_t ThermalGrpcServerImpl::OnTripEvntNotifyCnt_ = 0;
 #define THERM_SSR_FILTER "thermal_ssr"
 #define THERM_TRIP_FILTER "thermal_onTripChange"
 #define THERM_CDEV_FILTER "thermal_onCdevChange"
+#define THERM_STATE_FILTER "thermal_onStateChange"
 
 ThermalGrpcServerImpl::ThermalGrpcServerImpl() {
     LOG(DEBUG, __FUNCTION__);
@@ -38,9 +40,8 @@ void ThermalGrpcServerImpl::onSSREvent(telux::common::ServiceStatus srvStatus) {
     clientEvent_.updateEventQueue(anyResponse);
 }
 
-grpc::Status ThermalGrpcServerImpl::InitService(ServerContext* context,
-        const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response) {
+grpc::Status ThermalGrpcServerImpl::InitService(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     grpc::Status gStatus = grpc::Status::OK;
@@ -69,12 +70,19 @@ grpc::Status ThermalGrpcServerImpl::InitService(ServerContext* context,
         return grpc::Status(grpc::StatusCode::CANCELLED, ":: init failed");
     }
 
+    {
+        std::lock_guard<std::mutex> lk(setTempMutex_);
+        if (!isTripEvaluatorBuilt_) {
+            tripEvaluator_.build(jsonHelper_->tZoneList_, jsonHelper_->tripBindings_);
+            isTripEvaluatorBuilt_ = true;
+        }
+    }
+
     return setResponse(srvStatus,response);
 }
 
-grpc::Status ThermalGrpcServerImpl::GetServiceStatus(ServerContext* context,
-        const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response) {
+grpc::Status ThermalGrpcServerImpl::GetServiceStatus(const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     telux::common::ServiceStatus srvStatus = getServiceStatus();
@@ -83,15 +91,18 @@ grpc::Status ThermalGrpcServerImpl::GetServiceStatus(ServerContext* context,
     return setResponse(srvStatus,response);
 }
 
-grpc::Status ThermalGrpcServerImpl::GetThermalZones(ServerContext* context,
-        const ::thermStub::GetThermalZonesRequest* request,
-        ::thermStub::GetThermalZonesReply* response) {
+grpc::Status ThermalGrpcServerImpl::GetThermalZones(
+    const ::thermStub::GetThermalZonesRequest* request,
+    ::thermStub::GetThermalZonesReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::vector<std::shared_ptr<telux::therm::ThermalZoneImpl>> tZones;
 
 //    auto status = getThermalZones(response);
     auto status = jsonHelper_->getThermalZones(tZones);
+    response->set_status(static_cast<::commonStub::Status>(status));
+    response->set_by_id_status(static_cast<::commonStub::Status>(
+        jsonHelper_->getApiStatus("getThermalZone")));
     if (status == telux::common::Status::NOTALLOWED) {
         // Response status is set as ERROR
         return grpc::Status::OK;
@@ -100,6 +111,9 @@ grpc::Status ThermalGrpcServerImpl::GetThermalZones(ServerContext* context,
         return grpc::Status::OK;
     }
 
+    // The zones are copied along with the generation they belong to
+    std::lock_guard<std::mutex> lk(setTempMutex_);
+    response->set_generation(generation_);
     for (auto tz : tZones) {
         ::thermStub::ThermalZone &grpcTz = *response->add_thermal_zones();
         grpcTz.set_id(tz->getId());
@@ -135,14 +149,17 @@ grpc::Status ThermalGrpcServerImpl::GetThermalZones(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ThermalGrpcServerImpl::GetCoolingDevices(ServerContext* context,
-        const ::thermStub::GetCoolingDevicesRequest* request,
-        ::thermStub::GetCoolingDevicesReply* response) {
+grpc::Status ThermalGrpcServerImpl::GetCoolingDevices(
+    const ::thermStub::GetCoolingDevicesRequest* request,
+    ::thermStub::GetCoolingDevicesReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::vector<std::shared_ptr<telux::therm::CoolingDeviceImpl>> cDevs;
 
     auto status = jsonHelper_->getCoolingDevices(cDevs);
+    response->set_status(static_cast<::commonStub::Status>(status));
+    response->set_by_id_status(static_cast<::commonStub::Status>(
+        jsonHelper_->getApiStatus("getCoolingDevice")));
     if (status == telux::common::Status::NOTALLOWED) {
         // Response status is set as ERROR
         return grpc::Status::OK;
@@ -151,6 +168,8 @@ grpc::Status ThermalGrpcServerImpl::GetCoolingDevices(ServerContext* context,
         return grpc::Status::OK;
     }
 
+    std::lock_guard<std::mutex> lk(setTempMutex_);
+    response->set_generation(generation_);
     for (auto cd : cDevs) {
         ::thermStub::CoolingDevice &grpcCdev = *response->add_cooling_devices();
         grpcCdev.set_id(cd->getId());
@@ -162,9 +181,9 @@ grpc::Status ThermalGrpcServerImpl::GetCoolingDevices(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ThermalGrpcServerImpl::GetThermalZoneById(ServerContext* context,
-        const ::thermStub::GetThermalZoneByIdRequest* request,
-        ::thermStub::GetThermalZoneByIdReply* response) {
+grpc::Status ThermalGrpcServerImpl::GetThermalZoneById(
+    const ::thermStub::GetThermalZoneByIdRequest* request,
+    ::thermStub::GetThermalZoneByIdReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::shared_ptr<telux::therm::ThermalZoneImpl> tz;
@@ -213,9 +232,9 @@ grpc::Status ThermalGrpcServerImpl::GetThermalZoneById(ServerContext* context,
     return grpc::Status::OK;
 }
 
-grpc::Status ThermalGrpcServerImpl::GetCoolingDeviceById(ServerContext* context,
-        const ::thermStub::GetCoolingDeviceByIdRequest* request,
-        ::thermStub::GetCoolingDeviceByIdReply* response) {
+grpc::Status ThermalGrpcServerImpl::GetCoolingDeviceById(
+    const ::thermStub::GetCoolingDeviceByIdRequest* request,
+    ::thermStub::GetCoolingDeviceByIdReply* response) {
     LOG(DEBUG, __FUNCTION__);
 
     std::shared_ptr<telux::therm::CoolingDeviceImpl> cd;
@@ -258,9 +277,7 @@ grpc::Status ThermalGrpcServerImpl::RegisterOnCoolingDeviceLevelChange(
 }
 
 grpc::Status ThermalGrpcServerImpl::DeRegisterOnCoolingDeviceLevelChange(
-        ServerContext* context,
-        const ::commonStub::DeRegisterNotificationRequest* request,
-        google::protobuf::Empty* response) {
+    const ::commonStub::DeRegisterNotificationRequest* request, google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
 
     auto status = deRegisterCdevStateChangeEvent(request->client_id());
@@ -289,9 +306,8 @@ grpc::Status ThermalGrpcServerImpl::RegisterOnTripEvent(
     return status;
 }
 
-grpc::Status ThermalGrpcServerImpl::DeRegisterOnTripEvent(ServerContext* context,
-        const ::commonStub::DeRegisterNotificationRequest* request,
-        google::protobuf::Empty* response) {
+grpc::Status ThermalGrpcServerImpl::DeRegisterOnTripEvent(
+    const ::commonStub::DeRegisterNotificationRequest* request, google::protobuf::Empty* response) {
     LOG(DEBUG, __FUNCTION__);
 
     auto status = deRegisterTripEvent(request->client_id());
@@ -391,6 +407,17 @@ telux::common::Status ThermalGrpcServerImpl::sendCdevUpdateEvent(
     return telux::common::Status::SUCCESS;
 }
 
+void ThermalGrpcServerImpl::sendStateChangeEvent(uint64_t generation) {
+    LOG(DEBUG, __FUNCTION__, ":: generation: ", generation);
+
+    thermStub::ThermalStateChangeEvent stateEvent;
+    ::eventService::EventResponse anyResponse;
+
+    stateEvent.set_generation(generation);
+    anyResponse.set_filter(THERM_STATE_FILTER);
+    anyResponse.mutable_any()->PackFrom(stateEvent);
+    clientEvent_.updateEventQueue(anyResponse);
+}
 
 telux::common::Status ThermalGrpcServerImpl::getNewCdevStateUpdate(int trend, int tZoneId,
         int tripId) {
@@ -403,12 +430,12 @@ telux::common::Status ThermalGrpcServerImpl::getNewCdevStateUpdate(int trend, in
     switch(trend) {
         case TREND_RAISING: {
             LOG(DEBUG, __FUNCTION__);
-            cDevs = jsonHelper_->getCoolingDeviceLevel(tZoneId, tripId, TREND_RAISING);
+            cDevs = tripEvaluator_.getCoolingDeviceLevel(tZoneId, tripId, TREND_RAISING);
             break;
         }
         case TREND_DROPPING: {
             LOG(DEBUG, __FUNCTION__);
-            cDevs = jsonHelper_->getCoolingDeviceLevel(tZoneId, tripId, TREND_DROPPING);
+            cDevs = tripEvaluator_.getCoolingDeviceLevel(tZoneId, tripId, TREND_DROPPING);
             break;
         }
         default:
@@ -434,60 +461,7 @@ telux::common::Status ThermalGrpcServerImpl::getNewCdevStateUpdate(int trend, in
     return rStatus;
 }
 
-telux::common::Status ThermalGrpcServerImpl::getTripUpdate(int prevTemp, int newTemp,
-        int tZoneId, std::shared_ptr<telux::therm::ITripPoint> &tp) {
-    LOG(DEBUG, __FUNCTION__, ":: tZoneId: ", tZoneId,
-            ", prevTemp: ", prevTemp, ", newTemp: ", newTemp);
-    telux::common::Status status = telux::common::Status::ALREADY;
-
-    auto tripTemp     = tp->getThresholdTemp();
-    auto tripHystTemp = tp->getHysteresis();
-    auto tripId       = tp->getTripId();
-
-    // Generate Trip update event
-    if ((prevTemp < tripTemp) && (newTemp >= tripTemp)) {
-        // CROSSED_OVER
-        LOG(DEBUG, __FUNCTION__, ":: prevTemp: ", prevTemp,
-            ", tripTemp: ", tripTemp, ", newTemp: ", newTemp,
-            ", tripId: ", tripId);
-
-        status = sendTripUpdateEvent(tp, tZoneId, CROSSED_OVER);
-        if (status != telux::common::Status::SUCCESS) {
-            LOG(ERROR, __FUNCTION__, ":: sending trip update event failed" );
-        }
-        getNewCdevStateUpdate(TREND_RAISING, tZoneId, tripId);
-    } else if ( (newTemp < (tripTemp - tripHystTemp)) &&
-                (prevTemp >= (tripTemp - tripHystTemp)) ) {
-        // CROSSED_UNDER
-        LOG(DEBUG, __FUNCTION__, ":: prevTemp: ", prevTemp,
-            ", tripTemp: ", tripTemp, ", newTemp: ", newTemp,
-            ", tripHystTemp: ", tripHystTemp,
-            ", tripId: ", tripId);
-
-        status = sendTripUpdateEvent(tp, tZoneId, CROSSED_UNDER);
-        if (status != telux::common::Status::SUCCESS) {
-            LOG(ERROR, __FUNCTION__, ":: sending trip update event failed" );
-        }
-        getNewCdevStateUpdate(TREND_DROPPING, tZoneId, tripId);
-    } else {
-        // STABLE - don't do anything
-        LOG(DEBUG, __FUNCTION__, ":: prevTemp: ", prevTemp,
-            ", tripTemp: ", tripTemp, ", newTemp: ", newTemp,
-            ", tripId: ", tripId, ", tripHystTemp: ", tripHystTemp);
-    }
-    return status;
-}
-
 // Call this when Temp changes for particular Tzone
-telux::common::Status ThermalGrpcServerImpl::getTripAndCdevUpdate(int tZoneId, int prevTzoneTemp,
-        int newTzoneTemp, std::shared_ptr<telux::therm::ITripPoint> tp) {
-    LOG(DEBUG, __FUNCTION__, ":: ZoneId: ", tZoneId, ", tripId: ", tp->getTripId());
-    telux::common::Status rStatus = telux::common::Status::SUCCESS;
-
-    rStatus = getTripUpdate(prevTzoneTemp, newTzoneTemp, tZoneId, tp);
-    return rStatus;
-}
-
 telux::common::Status ThermalGrpcServerImpl::setThermalZone(int tZoneId, int newTemp) {
     LOG(DEBUG, __FUNCTION__, ":: setting tZone: ", tZoneId, " to temp: ", newTemp);
     telux::common::Status status;
@@ -504,17 +478,23 @@ telux::common::Status ThermalGrpcServerImpl::setThermalZone(int tZoneId, int new
 
     auto tz = (*itr);
     auto prevTemp = tz->getCurrentTemp();
-    int lowestTemp = INT_MAX;
     tz->setCurrentTemp(newTemp);
-    auto tps = tz->getTripPoints();
-    for (auto tp : tps) {
-        (tp->getThresholdTemp() <= lowestTemp) ? (lowestTemp = tp->getThresholdTemp())
-            : (lowestTemp = lowestTemp);
-        status = getTripAndCdevUpdate(tZoneId, prevTemp, newTemp, tp);
-    }
+    ++generation_;
 
-    if (status == telux::common::Status::SUCCESS) {
-        return status;
+    std::vector<TripCrossing> crossings;
+    tripEvaluator_.evaluate(tZoneId, prevTemp, newTemp, crossings);
+    for (auto &crossing : crossings) {
+        LOG(DEBUG, __FUNCTION__, ":: prevTemp: ", prevTemp,
+            ", tripTemp: ", crossing.tripPoint->getThresholdTemp(), ", newTemp: ", newTemp,
+            ", tripHystTemp: ", crossing.tripPoint->getHysteresis(),
+            ", tripId: ", crossing.tripPoint->getTripId());
+
+        status = sendTripUpdateEvent(crossing.tripPoint, tZoneId, crossing.event);
+        if (status != telux::common::Status::SUCCESS) {
+            LOG(ERROR, __FUNCTION__, ":: sending trip update event failed" );
+        }
+        getNewCdevStateUpdate((crossing.event == CROSSED_OVER) ? TREND_RAISING : TREND_DROPPING,
+            tZoneId, crossing.tripPoint->getTripId());
     }
 
     /** Trip points are STABLE however Cdev need to be updated
@@ -530,8 +510,9 @@ telux::common::Status ThermalGrpcServerImpl::setThermalZone(int tZoneId, int new
      **            however cDev level comes down gradually
      **            (one step down for e.g. from 11 to 0)
      */
-    if ((newTemp < lowestTemp) && (newTemp < prevTemp)) {
-        for (auto tp : tps) {
+    auto lowestTemp = tripEvaluator_.getLowestThreshold(tZoneId);
+    if (crossings.empty() && (newTemp < lowestTemp) && (newTemp < prevTemp)) {
+        for (auto tp : tz->getTripPoints()) {
             LOG(DEBUG, __FUNCTION__, ":: prevTemp: ", prevTemp,
                     ", lowestTemp: ", lowestTemp, ", newTemp: ", newTemp);
             status = getNewCdevStateUpdate(TREND_DROPPING, tZoneId, tp->getTripId());
@@ -541,7 +522,9 @@ telux::common::Status ThermalGrpcServerImpl::setThermalZone(int tZoneId, int new
         }
     }
 
-    return status;
+    // Sent last so the clients refreshing their thermal state see the new levels
+    sendStateChangeEvent(generation_);
+    return telux::common::Status::SUCCESS;
 }
 
 grpc::Status ThermalGrpcServerImpl::registerTripEvent(
@@ -604,7 +587,8 @@ std::shared_ptr<telux::therm::CoolingDeviceImpl> ThermalGrpcServerImpl::setCooli
     if (trend == TREND_DROPPING) {
         // Note: Temp decrease gradually
         auto currLevel = cd->getCurrentCoolingLevel();
-        auto cDevs = jsonHelper_->getCoolingDeviceLevel(tZoneId, tripId, TREND_RAISING, cDevId);
+        auto cDevs = tripEvaluator_.getCoolingDeviceLevel(tZoneId, tripId, TREND_RAISING,
+            cDevId);
         for (auto cdev : cDevs) {
             auto currState = cdev.second;
             LOG(DEBUG, __FUNCTION__,
@@ -619,3 +603,60 @@ std::shared_ptr<telux::therm::CoolingDeviceImpl> ThermalGrpcServerImpl::setCooli
 
     return cd;
 }
+
+grpc::ServerUnaryReactor* ThermalGrpcServerImpl::InitService(grpc::CallbackServerContext* context,
+    const google::protobuf::Empty* request, commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return InitService(request, response); });
+}
+
+grpc::ServerUnaryReactor* ThermalGrpcServerImpl::GetServiceStatus(
+    grpc::CallbackServerContext* context, const google::protobuf::Empty* request,
+    commonStub::GetServiceStatusReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetServiceStatus(request, response); });
+}
+
+grpc::ServerUnaryReactor* ThermalGrpcServerImpl::GetThermalZones(
+    grpc::CallbackServerContext* context, const ::thermStub::GetThermalZonesRequest* request,
+    ::thermStub::GetThermalZonesReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetThermalZones(request, response); });
+}
+
+grpc::ServerUnaryReactor* ThermalGrpcServerImpl::GetCoolingDevices(
+    grpc::CallbackServerContext* context, const ::thermStub::GetCoolingDevicesRequest* request,
+    ::thermStub::GetCoolingDevicesReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetCoolingDevices(request, response); });
+}
+
+grpc::ServerUnaryReactor* ThermalGrpcServerImpl::GetThermalZoneById(
+    grpc::CallbackServerContext* context, const ::thermStub::GetThermalZoneByIdRequest* request,
+    ::thermStub::GetThermalZoneByIdReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetThermalZoneById(request, response); });
+}
+
+grpc::ServerUnaryReactor* ThermalGrpcServerImpl::GetCoolingDeviceById(
+    grpc::CallbackServerContext* context, const ::thermStub::GetCoolingDeviceByIdRequest* request,
+    ::thermStub::GetCoolingDeviceByIdReply* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return GetCoolingDeviceById(request, response); });
+}
+
+grpc::ServerUnaryReactor* ThermalGrpcServerImpl::DeRegisterOnCoolingDeviceLevelChange(
+    grpc::CallbackServerContext* context,
+    const ::commonStub::DeRegisterNotificationRequest* request, google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() {
+            return DeRegisterOnCoolingDeviceLevelChange(request, response);
+        });
+}
+
+grpc::ServerUnaryReactor* ThermalGrpcServerImpl::DeRegisterOnTripEvent(
+    grpc::CallbackServerContext* context,
+    const ::commonStub::DeRegisterNotificationRequest* request, google::protobuf::Empty* response) {
+    return RpcExecutor::getInstance().execute(context,
+        [this, request, response]() { return DeRegisterOnTripEvent(request, response); });
+}
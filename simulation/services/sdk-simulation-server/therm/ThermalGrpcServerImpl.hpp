@@ -35,7 +35,18 @@ using thermStub::Thermal;
 using commonStub::ServiceStatus;
 using commonStub::GetServiceStatusReply;
 
-class ThermalGrpcServerImpl final : public thermStub::Thermal::Service,
+/* The notification streams stay synchronous, the other RPCs run on the RPC executor */
+using ThermalService = Thermal::WithCallbackMethod_InitService<
+    Thermal::WithCallbackMethod_GetServiceStatus<
+    Thermal::WithCallbackMethod_GetThermalZones<
+    Thermal::WithCallbackMethod_GetCoolingDevices<
+    Thermal::WithCallbackMethod_GetThermalZoneById<
+    Thermal::WithCallbackMethod_GetCoolingDeviceById<
+    Thermal::WithCallbackMethod_DeRegisterOnCoolingDeviceLevelChange<
+    Thermal::WithCallbackMethod_DeRegisterOnTripEvent<
+    Thermal::Service>>>>>>>>;
+
+class ThermalGrpcServerImpl final : public ThermalService,
                                     public ThermalManagerServerImpl {
     public:
 
@@ -43,32 +54,33 @@ class ThermalGrpcServerImpl final : public thermStub::Thermal::Service,
         ~ ThermalGrpcServerImpl();
 
         /* ############## Overrided methods ####################### */
-        grpc::Status InitService(ServerContext *context,
-            const google::protobuf::Empty *request,
-            commonStub::GetServiceStatusReply* response) override ;
+        grpc::ServerUnaryReactor* InitService(grpc::CallbackServerContext* context,
+            const google::protobuf::Empty* request,
+            commonStub::GetServiceStatusReply* response) override;
 
-        grpc::Status GetServiceStatus(ServerContext* context,
+        grpc::ServerUnaryReactor* GetServiceStatus(grpc::CallbackServerContext* context,
             const google::protobuf::Empty* request,
-        commonStub::GetServiceStatusReply* response) override;
+            commonStub::GetServiceStatusReply* response) override;
 
-        grpc::Status GetThermalZones(ServerContext* context,
+        grpc::ServerUnaryReactor* GetThermalZones(grpc::CallbackServerContext* context,
             const ::thermStub::GetThermalZonesRequest* request,
             ::thermStub::GetThermalZonesReply* response) override;
-        grpc::Status GetCoolingDevices(ServerContext* context,
+        grpc::ServerUnaryReactor* GetCoolingDevices(grpc::CallbackServerContext* context,
             const ::thermStub::GetCoolingDevicesRequest* request,
             ::thermStub::GetCoolingDevicesReply* response) override;
 
-        grpc::Status GetThermalZoneById(ServerContext* context,
+        grpc::ServerUnaryReactor* GetThermalZoneById(grpc::CallbackServerContext* context,
             const ::thermStub::GetThermalZoneByIdRequest* request,
             ::thermStub::GetThermalZoneByIdReply* response) override;
-        grpc::Status GetCoolingDeviceById(ServerContext* context,
+        grpc::ServerUnaryReactor* GetCoolingDeviceById(grpc::CallbackServerContext* context,
             const ::thermStub::GetCoolingDeviceByIdRequest* request,
             ::thermStub::GetCoolingDeviceByIdReply* response) override;
 
         grpc::Status RegisterOnCoolingDeviceLevelChange(ServerContext* context,
             const google::protobuf::Empty* request,
             ServerWriter<::thermStub::RegisterOnCoolingDeviceLevelChangeReply>* response) override;
-        grpc::Status DeRegisterOnCoolingDeviceLevelChange(ServerContext* context,
+        grpc::ServerUnaryReactor* DeRegisterOnCoolingDeviceLevelChange(
+            grpc::CallbackServerContext* context,
             const ::commonStub::DeRegisterNotificationRequest* request,
             google::protobuf::Empty* response) override;
 
@@ -76,11 +88,31 @@ class ThermalGrpcServerImpl final : public thermStub::Thermal::Service,
             const google::protobuf::Empty* request,
             ServerWriter<::thermStub::RegisterOnTripEventReply>* response) override;
 
-        grpc::Status DeRegisterOnTripEvent(ServerContext* context,
+        grpc::ServerUnaryReactor* DeRegisterOnTripEvent(grpc::CallbackServerContext* context,
             const ::commonStub::DeRegisterNotificationRequest* request,
             google::protobuf::Empty* response) override;
 
     private:
+        /* Handlers of the RPCs, run on the RPC executor */
+        grpc::Status InitService(const google::protobuf::Empty* request,
+            commonStub::GetServiceStatusReply* response);
+        grpc::Status GetServiceStatus(const google::protobuf::Empty* request,
+            commonStub::GetServiceStatusReply* response);
+        grpc::Status GetThermalZones(const ::thermStub::GetThermalZonesRequest* request,
+            ::thermStub::GetThermalZonesReply* response);
+        grpc::Status GetCoolingDevices(const ::thermStub::GetCoolingDevicesRequest* request,
+            ::thermStub::GetCoolingDevicesReply* response);
+        grpc::Status GetThermalZoneById(const ::thermStub::GetThermalZoneByIdRequest* request,
+            ::thermStub::GetThermalZoneByIdReply* response);
+        grpc::Status GetCoolingDeviceById(
+            const ::thermStub::GetCoolingDeviceByIdRequest* request,
+            ::thermStub::GetCoolingDeviceByIdReply* response);
+        grpc::Status DeRegisterOnCoolingDeviceLevelChange(
+            const ::commonStub::DeRegisterNotificationRequest* request,
+            google::protobuf::Empty* response);
+        grpc::Status DeRegisterOnTripEvent(
+            const ::commonStub::DeRegisterNotificationRequest* request,
+            google::protobuf::Empty* response);
 
         /* ############## Helper methods ####################### */
         grpc::Status setResponse(telux::common::ServiceStatus srvStatus,
@@ -93,13 +125,11 @@ class ThermalGrpcServerImpl final : public thermStub::Thermal::Service,
         telux::common::Status sendCdevUpdateEvent(std::shared_ptr<telux::therm::CoolingDeviceImpl> &cd,
                 unsigned int newState);
 
+        void sendStateChangeEvent(uint64_t generation);
+
         telux::common::Status getNewCdevStateUpdate(int trend, int tZoneId, int tripId);
-        telux::common::Status getTripUpdate(int prevTemp, int newTemp, int tZoneId,
-                std::shared_ptr<telux::therm::ITripPoint> &tp);
 
         // Call this when Temp changes for particular Tzone
-        telux::common::Status getTripAndCdevUpdate(int tZoneId, int prevTzoneTemp, int newTzoneTemp,
-                std::shared_ptr<telux::therm::ITripPoint> tp);
         telux::common::Status setThermalZone(int tZoneId, int newTemp);
 
         void onSSREvent(telux::common::ServiceStatus srvStatus);
@@ -147,6 +177,10 @@ class ThermalGrpcServerImpl final : public thermStub::Thermal::Service,
                 int cDevId, int trend, int nextCdevState);
 
         std::shared_ptr<ThermalJsonImpl> jsonHelper_;
+        ThermalTripEvaluator tripEvaluator_;
+        bool isTripEvaluatorBuilt_ = false;
+        /* Incremented each time a zone temperature is set, under setTempMutex_ */
+        uint64_t generation_ = 0;
         std::map<uint16_t, ServerWriter<thermStub::RegisterOnCoolingDeviceLevelChangeReply>*>
             onCoolingDeviceLevelChangeReplyWriters_;
         std::mutex onCoolingDeviceLevelChangeMutex_;
@@ -155,6 +189,7 @@ class ThermalGrpcServerImpl final : public thermStub::Thermal::Service,
         std::map<uint16_t, ServerWriter<thermStub::RegisterOnTripEventReply>*>
             onTripEventReplyWriters_;
         std::mutex onTripEventMutex_;
+        /* Guards the zone temperatures, the trip evaluator and the generation */
         std::mutex setTempMutex_;
         std::mutex setCdevMutex_;
         std::condition_variable onTripEventCv_;
@@ -21,27 +21,35 @@ telux::common::Status ThermalJsonImpl::readJsonObjects() {
     LOG(DEBUG, __FUNCTION__, ":: State Json Path: ", THERMAL_STATE_JSON,
             " Api Json Path: ", THERMAL_MANAGER_API_JSON);
 
+    Json::Value thermState;
+    Json::Value thermMgrApi;
     telux::common::ErrorCode error =
-        JsonParser::readFromJsonFile(thermState_, THERMAL_STATE_JSON);
+        JsonParser::readFromJsonFile(thermState, THERMAL_STATE_JSON);
     if (error != telux::common::ErrorCode::SUCCESS) {
         LOG(ERROR, __FUNCTION__, ":: Reading JSON File failed! " );
         return telux::common::Status::NOSUCH;
     }
 
     error =
-        JsonParser::readFromJsonFile(thermMgrApi_, THERMAL_MANAGER_API_JSON);
+        JsonParser::readFromJsonFile(thermMgrApi, THERMAL_MANAGER_API_JSON);
     if (error != telux::common::ErrorCode::SUCCESS) {
         LOG(ERROR, __FUNCTION__, ":: Reading JSON File failed! " );
         return telux::common::Status::NOSUCH;
     }
+
+    // The queries use the API JSON read here, it is read again when a client
+    // initializes or gets the service status
+    std::lock_guard<std::mutex> lock(mutex_);
+    thermState_.swap(thermState);
+    thermMgrApi_.swap(thermMgrApi);
     return telux::common::Status::SUCCESS;
 }
 
 telux::common::ServiceStatus ThermalJsonImpl::initServiceStatus() {
     readJsonObjects();
+    std::lock_guard<std::mutex> lock(mutex_);
     std::string srvStatus = thermMgrApi_["IThermalManager"]["IsSubsystemReady"].asString();
     LOG(DEBUG, __FUNCTION__, ":: SubSystemStatus: ", srvStatus);
-    std::lock_guard<std::mutex> lock(mutex_);
     serviceStatus_ = CommonUtils::mapServiceStatus(srvStatus);
     LOG(DEBUG, __FUNCTION__, ":: SubSystemStatus: ", static_cast<int>(serviceStatus_));
     return serviceStatus_;
@@ -49,6 +57,7 @@ telux::common::ServiceStatus ThermalJsonImpl::initServiceStatus() {
 
 int ThermalJsonImpl::getSubsystemReadyDelay() {
     readJsonObjects();
+    std::lock_guard<std::mutex> lock(mutex_);
     int subSysDelay = thermMgrApi_["IThermalManager"]["IsSubsystemReadyDelay"].asInt();
     LOG(DEBUG, __FUNCTION__, ":: SubSystemDelay: ", subSysDelay);
     return subSysDelay;
@@ -76,15 +85,7 @@ telux::therm::TripType ThermalJsonImpl::getTripType(std::string tripType) {
 telux::common::Status ThermalJsonImpl::getThermalZones(
         std::vector<std::shared_ptr<telux::therm::ThermalZoneImpl>> &tZones) {
 
-    auto error =
-        JsonParser::readFromJsonFile(thermMgrApi_, THERMAL_MANAGER_API_JSON);
-    if (error != telux::common::ErrorCode::SUCCESS) {
-        LOG(ERROR, __FUNCTION__, ":: Reading JSON File failed! " );
-        return telux::common::Status::NOSUCH;
-    }
-
-    auto tzsApi = thermMgrApi_["IThermalManager"]["getThermalZones"];
-    if (tzsApi["error"] != "SUCCESS") {
+    if (getApiError("getThermalZones") != "SUCCESS") {
         return telux::common::Status::NOTALLOWED;
     }
 
@@ -95,15 +96,7 @@ telux::common::Status ThermalJsonImpl::getThermalZones(
 telux::common::Status ThermalJsonImpl::getCoolingDevices(
         std::vector<std::shared_ptr<telux::therm::CoolingDeviceImpl>> &cDevs) {
 
-    auto error =
-        JsonParser::readFromJsonFile(thermMgrApi_, THERMAL_MANAGER_API_JSON);
-    if (error != telux::common::ErrorCode::SUCCESS) {
-        LOG(ERROR, __FUNCTION__, ":: Reading JSON File failed! " );
-        return telux::common::Status::NOSUCH;
-    }
-
-    auto cdevApi = thermMgrApi_["IThermalManager"]["getCoolingDevices"];
-    if (cdevApi["error"] != "SUCCESS") {
+    if (getApiError("getCoolingDevices") != "SUCCESS") {
         return telux::common::Status::NOTALLOWED;
     }
 
@@ -113,7 +106,12 @@ telux::common::Status ThermalJsonImpl::getCoolingDevices(
 
 telux::common::Status ThermalJsonImpl::getThermalZones() {
 
-    auto tzs = thermState_["thermalZones"];
+    std::lock_guard<std::mutex> lock(mutex_);
+    // The zones are kept across the clients, their temperature is set by the events
+    if (!tZoneList_.empty()) {
+        return telux::common::Status::SUCCESS;
+    }
+    auto &tzs = thermState_["thermalZones"];
     for (Json::Value tz : tzs) {
         std::shared_ptr<telux::therm::ThermalZoneImpl> tZone =
             std::make_shared<telux::therm::ThermalZoneImpl>();
@@ -143,9 +141,13 @@ telux::common::Status ThermalJsonImpl::getThermalZones() {
             std::vector<std::shared_ptr<telux::therm::ITripPoint>> bindingInfo;
             auto bTps = cd["tripPoints"];
             for (auto bTp : bTps) {
-                std::shared_ptr<telux::therm::TripPointImpl> tripPoint =
-                    std::make_shared<telux::therm::TripPointImpl>();
-                tripPoint->setTZoneId(tZone->getId());
+                TripBinding binding;
+                binding.tZoneId = tZone->getId();
+                binding.tripId = bTp["id"].asInt();
+                binding.cDevId = boundCoolingDevice.coolingDeviceId;
+                binding.level = bTp["level"].asInt();
+                binding.clr = bTp["clr"].asInt();
+                tripBindings_.push_back(binding);
                 for(auto tp : tripInfo) {
                     if (tp->getTripId() == bTp["id"].asInt()) {
                         tp->setTZoneId(tZone->getId());
@@ -165,7 +167,11 @@ telux::common::Status ThermalJsonImpl::getThermalZones() {
 
 telux::common::Status ThermalJsonImpl::getCoolingDevices() {
 
-    auto cds = thermState_["coolingDevices"];
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!cDevList_.empty()) {
+        return telux::common::Status::SUCCESS;
+    }
+    auto &cds = thermState_["coolingDevices"];
     for (Json::Value cd : cds) {
         std::shared_ptr<telux::therm::CoolingDeviceImpl> cDev
             = std::make_shared<telux::therm::CoolingDeviceImpl>();
@@ -220,59 +226,21 @@ telux::common::Status ThermalJsonImpl::getCoolingDeviceById(int cDevId,
 }
 
 telux::common::Status ThermalJsonImpl::findId(std::string api, int id) {
+    return getApiStatus(api);
+}
 
-    auto error =
-        JsonParser::readFromJsonFile(thermMgrApi_, THERMAL_MANAGER_API_JSON);
-    if (error != telux::common::ErrorCode::SUCCESS) {
-        LOG(ERROR, __FUNCTION__, ":: Reading JSON File failed! " );
-        return telux::common::Status::NOSUCH;
-    }
-
-    std::string status;
-    auto resp = thermMgrApi_["IThermalManager"][api];
+telux::common::Status ThermalJsonImpl::getApiStatus(const std::string &api) {
 
-    if (resp["error"].asString() == "SUCCESS") {
+    std::string error = getApiError(api);
+    if (error == "SUCCESS") {
         return telux::common::Status::SUCCESS;
-    } else if(resp["error"].asString() == "FAILED") {
+    } else if(error == "FAILED") {
         return telux::common::Status::NOTALLOWED;
     }
     return telux::common::Status::NOTALLOWED;
 }
 
-std::map<int, int> ThermalJsonImpl::getCoolingDeviceLevel(
-        int tZoneId, int tripId, int trend, int cDevId) {
-    LOG(DEBUG, __FUNCTION__, "tZoneId: ", tZoneId, ", tripId: ", tripId,
-            ", trend: ", trend);
-
-    // map of cdevId and cDevNextLevel
-    std::map<int, int> cDevLevels;
-    auto tzs = thermState_["thermalZones"];
-    for (auto tz : tzs) {
-        if (tz["id"].asInt() == tZoneId) {
-            auto cds = tz["boundCoolingDevices"];
-            for (auto cd : cds) {
-                // get cDev level/clr for specific cdev
-                if (cDevId != -1) {
-                    if (cd["id"].asInt() != cDevId) {
-                        continue;
-                    }
-                }
-
-                auto tps = cd["tripPoints"];
-                for (auto tp : tps) {
-                    if (tp["id"].asInt() == tripId) {
-                        if (trend == TREND_RAISING) {
-                            cDevLevels[cd["id"].asInt()] = tp["level"].asInt();
-                        } else if (trend == TREND_DROPPING) {
-                            cDevLevels[cd["id"].asInt()] = tp["clr"].asInt();
-                        } else {
-                            // STABLE - Don't do anything
-                        }
-                    }
-                }
-            }
-            break;
-        }
-    }
-    return cDevLevels;
+std::string ThermalJsonImpl::getApiError(const std::string &api) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return thermMgrApi_["IThermalManager"][api]["error"].asString();
 }
@@ -14,12 +14,7 @@
 #include "../../../libs/common/CommonUtils.hpp"
 #include "../../../common/therm/ThermalZoneImpl.hpp"
 #include "../../../common/therm/CoolingDeviceImpl.hpp"
-
-#define TREND_RAISING   1
-#define TREND_STABLE    0
-#define TREND_DROPPING  -1
-#define CROSSED_OVER    1
-#define CROSSED_UNDER   0
+#include "ThermalTripEvaluator.hpp"
 
 class ThermalJsonImpl {
     public:
@@ -48,14 +43,17 @@ class ThermalJsonImpl {
         telux::common::Status getCoolingDeviceById(int cDevId,
                 std::shared_ptr<telux::therm::CoolingDeviceImpl> &cDev);
 
-        std::map<int, int> getCoolingDeviceLevel(
-                int tZoneId, int tripId, int trend, int cDevId = -1);
+        /* SUCCESS unless an error is configured for the API */
+        telux::common::Status getApiStatus(const std::string &api);
 
         std::vector<std::shared_ptr<telux::therm::ThermalZoneImpl>> tZoneList_;
         std::vector<std::shared_ptr<telux::therm::CoolingDeviceImpl>> cDevList_;
+        /* Cooling device levels of the trip points, filled with tZoneList_ */
+        std::vector<TripBinding> tripBindings_;
 
     private:
         telux::common::Status findId(std::string api, int id);
+        std::string getApiError(const std::string &api);
 
         Json::Value thermState_;
         Json::Value thermMgrApi_;
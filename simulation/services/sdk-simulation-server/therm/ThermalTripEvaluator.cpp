@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+#include "ThermalTripEvaluator.hpp"
+
+#include <algorithm>
+#include <climits>
+
+#include "libs/common/Logger.hpp"
+
+namespace {
+
+using TripEntry = std::pair<int, std::shared_ptr<telux::therm::ITripPoint>>;
+
+bool isBelow(int temp, const TripEntry &entry) {
+    return temp < entry.first;
+}
+
+bool isLess(const TripEntry &lhs, const TripEntry &rhs) {
+    return lhs.first < rhs.first;
+}
+
+}  // namespace
+
+void ThermalTripEvaluator::build(
+        const std::vector<std::shared_ptr<telux::therm::ThermalZoneImpl>> &tZones,
+        const std::vector<TripBinding> &bindings) {
+    zones_.clear();
+    bindings_.clear();
+    for (auto &tz : tZones) {
+        Zone &zone = zones_[tz->getId()];
+        for (auto &tp : tz->getTripPoints()) {
+            zone.overs.emplace_back(tp->getThresholdTemp(), tp);
+            zone.unders.emplace_back(tp->getThresholdTemp() - tp->getHysteresis(), tp);
+        }
+        // Trips with the same temperature are evaluated in the order they are listed
+        std::stable_sort(zone.overs.begin(), zone.overs.end(), isLess);
+        std::stable_sort(zone.unders.begin(), zone.unders.end(), isLess);
+    }
+    for (auto &binding : bindings) {
+        bindings_[std::make_pair(binding.tZoneId, binding.tripId)].push_back(binding);
+    }
+    LOG(DEBUG, __FUNCTION__, ":: zones: ", zones_.size(), ", bound trips: ", bindings_.size());
+}
+
+bool ThermalTripEvaluator::evaluate(int tZoneId, int prevTemp, int newTemp,
+        std::vector<TripCrossing> &crossings) const {
+    auto itr = zones_.find(tZoneId);
+    if (itr == zones_.end()) {
+        return false;
+    }
+    const Zone &zone = itr->second;
+    if (newTemp > prevTemp) {
+        // Crossed over the trips with prevTemp < threshold <= newTemp
+        auto first = std::upper_bound(zone.overs.begin(), zone.overs.end(), prevTemp, isBelow);
+        auto last = std::upper_bound(first, zone.overs.end(), newTemp, isBelow);
+        for (auto entry = first; entry != last; ++entry) {
+            crossings.push_back(TripCrossing{entry->second, CROSSED_OVER});
+        }
+    } else if (newTemp < prevTemp) {
+        // Crossed under the trips with newTemp < clear temperature <= prevTemp
+        auto first = std::upper_bound(zone.unders.begin(), zone.unders.end(), newTemp,
+            isBelow);
+        auto last = std::upper_bound(first, zone.unders.end(), prevTemp, isBelow);
+        while (last != first) {
+            --last;
+            crossings.push_back(TripCrossing{last->second, CROSSED_UNDER});
+        }
+    }
+    return true;
+}
+
+int ThermalTripEvaluator::getLowestThreshold(int tZoneId) const {
+    auto itr = zones_.find(tZoneId);
+    if ((itr == zones_.end()) || itr->second.overs.empty()) {
+        return INT_MAX;
+    }
+    return itr->second.overs.front().first;
+}
+
+std::map<int, int> ThermalTripEvaluator::getCoolingDeviceLevel(int tZoneId, int tripId,
+        int trend, int cDevId) const {
+    LOG(DEBUG, __FUNCTION__, "tZoneId: ", tZoneId, ", tripId: ", tripId,
+            ", trend: ", trend);
+
+    // map of cdevId and cDevNextLevel
+    std::map<int, int> cDevLevels;
+    if ((trend != TREND_RAISING) && (trend != TREND_DROPPING)) {
+        return cDevLevels;
+    }
+    auto itr = bindings_.find(std::make_pair(tZoneId, tripId));
+    if (itr == bindings_.end()) {
+        return cDevLevels;
+    }
+    for (auto &binding : itr->second) {
+        if ((cDevId != -1) && (binding.cDevId != cDevId)) {
+            continue;
+        }
+        cDevLevels[binding.cDevId] = (trend == TREND_RAISING) ? binding.level : binding.clr;
+    }
+    return cDevLevels;
+}
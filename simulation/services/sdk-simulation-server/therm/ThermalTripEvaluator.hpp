@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       ThermalTripEvaluator.hpp
+ *
+ * @brief      ThermalTripEvaluator finds the trip points crossed when the temperature of a
+ *             thermal zone changes. The trip points of each zone are kept sorted by
+ *             threshold and by clear temperature (threshold - hysteresis), so the trips
+ *             crossed by a change are a contiguous range found with two binary searches.
+ *             It also keeps the cooling device levels bound to each trip point, which
+ *             were looked up in the thermal state JSON on every crossing before.
+ */
+
+#ifndef THERMAL_TRIP_EVALUATOR_HPP
+#define THERMAL_TRIP_EVALUATOR_HPP
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../../common/therm/ThermalZoneImpl.hpp"
+
+#define TREND_RAISING   1
+#define TREND_STABLE    0
+#define TREND_DROPPING  -1
+#define CROSSED_OVER    1
+#define CROSSED_UNDER   0
+
+/* Levels a cooling device is set to when a trip point of a zone is crossed */
+struct TripBinding {
+    int tZoneId = -1;
+    int tripId = -1;
+    int cDevId = -1;
+    /* Level once the trip is crossed over */
+    int level = 0;
+    /* Level once the trip is crossed under */
+    int clr = 0;
+};
+
+/* Trip point crossed by a temperature change, in the order the events are sent */
+struct TripCrossing {
+    std::shared_ptr<telux::therm::ITripPoint> tripPoint;
+    /* CROSSED_OVER or CROSSED_UNDER */
+    int event;
+};
+
+class ThermalTripEvaluator {
+ public:
+    void build(const std::vector<std::shared_ptr<telux::therm::ThermalZoneImpl>> &tZones,
+        const std::vector<TripBinding> &bindings);
+
+    /**
+     * Gets the trip points crossed over when the temperature rises, in increasing
+     * threshold order, or crossed under when it drops, in decreasing clear temperature
+     * order.
+     *
+     * @returns false if the zone isn't known
+     */
+    bool evaluate(int tZoneId, int prevTemp, int newTemp,
+        std::vector<TripCrossing> &crossings) const;
+
+    /**
+     * @returns Lowest trip threshold of the zone, INT_MAX if it has no trip points
+     */
+    int getLowestThreshold(int tZoneId) const;
+
+    /**
+     * Gets the next level of the cooling devices bound to a trip point, keyed by cooling
+     * device id. TREND_STABLE gives no levels.
+     *
+     * @param [in] cDevId  Cooling device to get the level of, -1 for all of them
+     */
+    std::map<int, int> getCoolingDeviceLevel(int tZoneId, int tripId, int trend,
+        int cDevId = -1) const;
+
+ private:
+    struct Zone {
+        /* Sorted by threshold */
+        std::vector<std::pair<int, std::shared_ptr<telux::therm::ITripPoint>>> overs;
+        /* Sorted by clear temperature */
+        std::vector<std::pair<int, std::shared_ptr<telux::therm::ITripPoint>>> unders;
+    };
+
+    std::unordered_map<int, Zone> zones_;
+    /* Bindings of a trip point keyed by zone id and trip id, in the JSON order */
+    std::map<std::pair<int, int>, std::vector<TripBinding>> bindings_;
+};
+
+#endif  // THERMAL_TRIP_EVALUATOR_HPP
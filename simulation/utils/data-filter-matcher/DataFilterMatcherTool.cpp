@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       DataFilterMatcherTool.cpp
+ *
+ * @brief      Checks packet headers against data restrict filters with the filter matcher
+ *             of the data library.
+ *
+ *             The script mode adds the filters through the IDataFilterManager API and
+ *             prints whether each packet is let through. The script is read from a file or
+ *             from the standard input, one command per line, '#' starting a comment. A
+ *             prefix is an address with an optional /length, or "any":
+ *               filter <protocol> <src prefix> <dest prefix> <dest port> <dest port range>
+ *               packet <protocol> <src addr> <dest addr> <src port> <dest port>
+ *
+ *             The benchmark mode synthesizes a filter set and packet headers and times the
+ *             compiled matcher against a linear evaluation of the filters one by one.
+ */
+
+#include <arpa/inet.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <telux/data/DataFactory.hpp>
+
+#include "libs/data/DataFilterManagerStub.hpp"
+#include "libs/data/DataRestrictFilterMatcher.hpp"
+
+extern "C" {
+#include <getopt.h>
+}
+
+#define APP_NAME "telsdk_data_filter_matcher"
+#define PROTO_TCP 6
+#define PROTO_UDP 17
+#define DEFAULT_BENCHMARK_PACKETS 100000
+
+using telux::data::DataFilterManagerStub;
+using telux::data::DataRestrictFilterMatcher;
+using telux::data::IIpFilter;
+using telux::data::IpPacketHeader;
+
+namespace {
+
+void printUsage() {
+    std::cout << "Usage: " << APP_NAME << " [-s <slot id>] [-f <script>]\n"
+        << "       " << APP_NAME << " -b <filter count> [-n <packet count>]\n"
+        << "  -s <slot id>       Slot of the data filter manager, 1 by default\n"
+        << "  -f <script>        Reads the commands from the file instead of the standard"
+        << " input\n"
+        << "  -b <filter count>  Benchmarks the matcher on synthetic filters\n"
+        << "  -n <packet count>  Packets matched by the benchmark, "
+        << DEFAULT_BENCHMARK_PACKETS << " by default\n"
+        << "  -h                 Prints this help\n"
+        << "Commands:\n"
+        << "  filter <protocol> <src prefix> <dest prefix> <dest port> <dest port range>\n"
+        << "  packet <protocol> <src addr> <dest addr> <src port> <dest port>" << std::endl;
+}
+
+/**
+ * Sets the source or destination of a filter from a prefix, "any" leaves it unset.
+ */
+bool setPrefix(const std::string &prefix, bool isSource, telux::data::IPv4Info &ipv4Info,
+    telux::data::IPv6Info &ipv6Info) {
+    if (prefix == "any") {
+        return true;
+    }
+    std::string addr = prefix.substr(0, prefix.find('/'));
+    int length = -1;
+    if (addr.size() < prefix.size()) {
+        length = std::atoi(prefix.substr(addr.size() + 1).c_str());
+    }
+    uint8_t bytes[16];
+    if (inet_pton(AF_INET, addr.c_str(), bytes) == 1) {
+        std::string mask;
+        if ((length >= 0) && (length <= 32)) {
+            uint32_t bits = (length == 0) ? 0 : htonl(~((1ULL << (32 - length)) - 1));
+            char buf[INET_ADDRSTRLEN];
+            mask = inet_ntop(AF_INET, &bits, buf, sizeof(buf));
+        }
+        (isSource ? ipv4Info.srcAddr : ipv4Info.destAddr) = addr;
+        (isSource ? ipv4Info.srcSubnetMask : ipv4Info.destSubnetMask) = mask;
+        return true;
+    }
+    if (inet_pton(AF_INET6, addr.c_str(), bytes) == 1) {
+        uint8_t prefixLength = ((length > 0) && (length <= 128)) ? length : 128;
+        (isSource ? ipv6Info.srcAddr : ipv6Info.destAddr) = addr;
+        (isSource ? ipv6Info.srcPrefixLen : ipv6Info.dstPrefixLen) = prefixLength;
+        return true;
+    }
+    return false;
+}
+
+std::shared_ptr<IIpFilter> makeFilter(int protocol, const std::string &src,
+    const std::string &dest, uint16_t destPort, uint16_t destPortRange) {
+    auto filter = telux::data::DataFactory::getInstance().getNewIpFilter(
+        static_cast<telux::data::IpProtocol>(protocol));
+    if (filter == nullptr) {
+        return nullptr;
+    }
+    telux::data::IPv4Info ipv4Info;
+    telux::data::IPv6Info ipv6Info = {};
+    if (!setPrefix(src, true, ipv4Info, ipv6Info) || !setPrefix(dest, false, ipv4Info,
+        ipv6Info)) {
+        return nullptr;
+    }
+    filter->setIPv4Info(ipv4Info);
+    filter->setIPv6Info(ipv6Info);
+    telux::data::PortInfo port;
+    port.port = destPort;
+    port.range = destPortRange;
+    if (auto udpFilter = std::dynamic_pointer_cast<telux::data::IUdpFilter>(filter)) {
+        telux::data::UdpInfo udpInfo;
+        udpInfo.dest = port;
+        udpFilter->setUdpInfo(udpInfo);
+    } else if (auto tcpFilter = std::dynamic_pointer_cast<telux::data::ITcpFilter>(filter)) {
+        telux::data::TcpInfo tcpInfo;
+        tcpInfo.dest = port;
+        tcpFilter->setTcpInfo(tcpInfo);
+    }
+    return filter;
+}
+
+bool addFilter(std::shared_ptr<DataFilterManagerStub> filterMgr, std::istringstream &args) {
+    int protocol = 0;
+    std::string src;
+    std::string dest;
+    uint16_t destPort = 0;
+    uint16_t destPortRange = 0;
+    if (!(args >> protocol >> src >> dest >> destPort >> destPortRange)) {
+        return false;
+    }
+    auto filter = makeFilter(protocol, src, dest, destPort, destPortRange);
+    if (filter == nullptr) {
+        return false;
+    }
+    telux::common::Status status = filterMgr->addDataRestrictFilter(filter);
+    if (status != telux::common::Status::SUCCESS) {
+        std::cout << "Adding filter failed, status: " << static_cast<int>(status) << std::endl;
+    }
+    return true;
+}
+
+bool checkPacket(std::shared_ptr<DataFilterManagerStub> filterMgr, std::istringstream &args) {
+    int protocol = 0;
+    std::string src;
+    std::string dest;
+    uint16_t srcPort = 0;
+    uint16_t destPort = 0;
+    IpPacketHeader header;
+    if (!(args >> protocol >> src >> dest >> srcPort >> destPort)
+        || !DataRestrictFilterMatcher::makeHeader(src, dest,
+            static_cast<telux::data::IpProtocol>(protocol), srcPort, destPort, header)) {
+        return false;
+    }
+    std::cout << src << ":" << srcPort << " -> " << dest << ":" << destPort << " "
+        << (filterMgr->matchesDataRestrictFilter(header) ? "allowed" : "dropped")
+        << std::endl;
+    return true;
+}
+
+int runScript(std::shared_ptr<DataFilterManagerStub> filterMgr, std::istream &script) {
+    std::string line;
+    int lineNum = 0;
+    while (std::getline(script, line)) {
+        lineNum++;
+        std::istringstream args(line.substr(0, line.find('#')));
+        std::string command;
+        if (!(args >> command)) {
+            continue;
+        }
+        bool isValid = false;
+        if (command == "filter") {
+            isValid = addFilter(filterMgr, args);
+        } else if (command == "packet") {
+            isValid = checkPacket(filterMgr, args);
+        }
+        if (!isValid) {
+            std::cout << "Invalid command at line " << lineNum << ": " << line << std::endl;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+std::string getIPv4Address(uint32_t value) {
+    uint32_t addr = htonl(value);
+    char buf[INET_ADDRSTRLEN];
+    return inet_ntop(AF_INET, &addr, buf, sizeof(buf));
+}
+
+int runBenchmark(int filterCount, int packetCount) {
+    // Fixed seed so that runs are comparable. The filters and the packets share the
+    // 10.0.0.0/16 destinations and a 1000 ports window so that a share of them matches.
+    std::mt19937 random(1);
+    std::vector<std::shared_ptr<IIpFilter>> filters;
+    for (int idx = 0; idx < filterCount; idx++) {
+        int protocol = (idx % 2) ? PROTO_UDP : PROTO_TCP;
+        std::string dest = getIPv4Address(0x0A000000 | ((random() & 0xFF) << 8)) + "/24";
+        uint16_t destPort = 1024 + random() % 1000;
+        filters.push_back(makeFilter(protocol, "any", dest, destPort, random() % 100));
+    }
+    std::vector<IpPacketHeader> headers(packetCount);
+    for (auto &header : headers) {
+        DataRestrictFilterMatcher::makeHeader(getIPv4Address(0xC0A80000 | (random() & 0xFFFF)),
+            getIPv4Address(0x0A000000 | (random() & 0xFFFF)),
+            (random() % 2) ? PROTO_UDP : PROTO_TCP, 1024 + random() % 60000,
+            1024 + random() % 1000, header);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    DataRestrictFilterMatcher matcher(filters);
+    auto compiled = std::chrono::steady_clock::now();
+    int matched = 0;
+    for (auto &header : headers) {
+        matched += matcher.matches(header);
+    }
+    auto matchEnd = std::chrono::steady_clock::now();
+
+    // Linear evaluation, the filters are checked in turn until one matches
+    std::vector<std::unique_ptr<DataRestrictFilterMatcher>> linear;
+    for (auto &filter : filters) {
+        linear.emplace_back(new DataRestrictFilterMatcher(
+            std::vector<std::shared_ptr<IIpFilter>>{filter}));
+    }
+    auto linearStart = std::chrono::steady_clock::now();
+    int linearMatched = 0;
+    for (auto &header : headers) {
+        for (auto &single : linear) {
+            if (single->matches(header)) {
+                linearMatched++;
+                break;
+            }
+        }
+    }
+    auto linearEnd = std::chrono::steady_clock::now();
+
+    using Nanoseconds = std::chrono::duration<double, std::nano>;
+    std::cout << "filters: " << filterCount << ", packets: " << packetCount
+        << ", matched: " << matched << "\n"
+        << "compile: " << std::chrono::duration_cast<std::chrono::microseconds>(
+            compiled - start).count() << " us\n"
+        << "matcher: " << Nanoseconds(matchEnd - compiled).count() / packetCount
+        << " ns/packet\n"
+        << "linear:  " << Nanoseconds(linearEnd - linearStart).count() / packetCount
+        << " ns/packet" << std::endl;
+    if (matched != linearMatched) {
+        std::cout << "Mismatch, linear evaluation matched " << linearMatched << std::endl;
+        return -1;
+    }
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    std::string scriptPath;
+    int slotId = DEFAULT_SLOT_ID;
+    int filterCount = 0;
+    int packetCount = DEFAULT_BENCHMARK_PACKETS;
+    int opt;
+    while ((opt = getopt(argc, argv, "s:f:b:n:h")) != -1) {
+        switch (opt) {
+            case 's':
+                slotId = std::atoi(optarg);
+                break;
+            case 'f':
+                scriptPath = optarg;
+                break;
+            case 'b':
+                filterCount = std::atoi(optarg);
+                break;
+            case 'n':
+                packetCount = std::atoi(optarg);
+                break;
+            case 'h':
+                printUsage();
+                return 0;
+            default:
+                printUsage();
+                return -1;
+        }
+    }
+
+    if (filterCount > 0) {
+        return (packetCount > 0) ? runBenchmark(filterCount, packetCount) : -1;
+    }
+
+    std::promise<telux::common::ServiceStatus> initPromise;
+    auto filterMgr = telux::data::DataFactory::getInstance().getDataFilterManager(
+        static_cast<SlotId>(slotId), [&initPromise](telux::common::ServiceStatus status) {
+            initPromise.set_value(status);
+        });
+    if ((filterMgr == nullptr) || (initPromise.get_future().get()
+        != telux::common::ServiceStatus::SERVICE_AVAILABLE)) {
+        std::cout << "Data filter manager is unavailable" << std::endl;
+        return -1;
+    }
+    // The matching API is only on the simulation implementation
+    auto filterStub = std::dynamic_pointer_cast<DataFilterManagerStub>(filterMgr);
+    if (filterStub == nullptr) {
+        std::cout << "Data filter manager isn't the simulation one" << std::endl;
+        return -1;
+    }
+
+    if (scriptPath.empty()) {
+        return runScript(filterStub, std::cin);
+    }
+    std::ifstream script(scriptPath);
+    if (!script.is_open()) {
+        std::cout << "Unable to open " << scriptPath << std::endl;
+        return -1;
+    }
+    return runScript(filterStub, script);
+}
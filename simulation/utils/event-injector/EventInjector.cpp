@@ -41,6 +41,9 @@
  */
 
 #include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
 #include <thread>
 #include <grpcpp/grpcpp.h>
 
@@ -55,6 +58,8 @@ extern "C" {
 #include "EventInjector.hpp"
 
 #define EVENT_JSON "Events.json"
+#define DEFAULT_SCENARIO_RATE 1.0
+#define DEFAULT_SCENARIO_BATCH_SIZE 1000
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -117,15 +122,21 @@ telux::common::Status EventInjector::parseAndHandleArguments(int argc, char **ar
     int arg;
     std::string filter;
     std::string event;
+    std::string scenarioFile;
+    double rate = DEFAULT_SCENARIO_RATE;
+    int batchSize = DEFAULT_SCENARIO_BATCH_SIZE;
 
     static struct option long_options[] = {
         {"help",          optional_argument, 0, 'h'},
         {"filter",        required_argument, 0, 'f'},
         {"event",         required_argument, 0, 'e'},
+        {"scenario",      required_argument, 0, 's'},
+        {"rate",          required_argument, 0, 'r'},
+        {"batch",         required_argument, 0, 'b'},
         {NULL, 0, 0, '\0'}
     };
 
-    while((arg = getopt_long(argc, argv, "h::f:e:", long_options, NULL)) != -1) {
+    while((arg = getopt_long(argc, argv, "h::f:e:s:r:b:", long_options, NULL)) != -1) {
         switch(arg) {
             case 'h':
                 {
@@ -164,6 +175,21 @@ telux::common::Status EventInjector::parseAndHandleArguments(int argc, char **ar
                     LOG(DEBUG, __FUNCTION__, " Final Event string is ", event);
                 }
                 break;
+            case 's':
+                {
+                    scenarioFile = optarg;
+                }
+                break;
+            case 'r':
+                {
+                    rate = atof(optarg);
+                }
+                break;
+            case 'b':
+                {
+                    batchSize = atoi(optarg);
+                }
+                break;
             default:
                 LOG(ERROR, __FUNCTION__, " Entered options is not valid!");
                 return telux::common::Status::FAILED;
@@ -172,6 +198,103 @@ telux::common::Status EventInjector::parseAndHandleArguments(int argc, char **ar
             sendMessage(filter, event);
         }
     }
+    if (!scenarioFile.empty()) {
+        if ((rate < 0) || (batchSize <= 0)) {
+            LOG(ERROR, __FUNCTION__, " Invalid rate ", rate, " or batch size ", batchSize);
+            return telux::common::Status::INVALIDPARAM;
+        }
+        return runScenario(scenarioFile, rate, batchSize);
+    }
+    return telux::common::Status::SUCCESS;
+}
+
+/**
+ * Replays a scenario file. Each line holds "<timestamp in ms> <filter> <event>", lines
+ * that are empty or start with '#' are skipped. Events are sent when their timestamp,
+ * relative to the first event and divided by the rate, has elapsed; a rate of 0 sends
+ * them as fast as possible. A stream is used per batchSize events so that the server
+ * acknowledges them batch by batch, and the file is read while it is being replayed.
+ */
+telux::common::Status EventInjector::runScenario(std::string scenarioFile, double rate,
+    uint32_t batchSize) {
+    std::ifstream scenario(scenarioFile);
+    if (!scenario.is_open()) {
+        LOG(ERROR, __FUNCTION__, " Unable to open scenario ", scenarioFile);
+        return telux::common::Status::FAILED;
+    }
+
+    std::unique_ptr<ClientContext> context;
+    std::unique_ptr<grpc::ClientWriter<::eventService::UnsolicitedEvent>> writer;
+    ::eventService::InjectEventsReply reply;
+    auto finishBatch = [&]() -> bool {
+        writer->WritesDone();
+        grpc::Status reqStatus = writer->Finish();
+        writer.reset();
+        context.reset();
+        if (!reqStatus.ok()) {
+            LOG(ERROR, __FUNCTION__, " Scenario stream failed ", reqStatus.error_message());
+            return false;
+        }
+        LOG(INFO, __FUNCTION__, " Batch acknowledged, received ", reply.received(),
+            " rejected ", reply.rejected());
+        return true;
+    };
+
+    std::string line;
+    uint32_t lineNumber = 0;
+    uint32_t inBatch = 0;
+    uint64_t sent = 0;
+    uint64_t firstTimestamp = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (std::getline(scenario, line)) {
+        ++lineNumber;
+        std::istringstream iss(line);
+        uint64_t timestamp;
+        ::eventService::UnsolicitedEvent request;
+        std::string filter, event;
+        if (!(iss >> timestamp)) {
+            if (!(line.empty() || (line[0] == '#'))) {
+                LOG(ERROR, __FUNCTION__, " Skipping line ", lineNumber, " without timestamp");
+            }
+            continue;
+        }
+        iss >> filter;
+        std::getline(iss >> std::ws, event);
+        if (filter.empty() || event.empty()) {
+            LOG(ERROR, __FUNCTION__, " Skipping line ", lineNumber, " without filter or event");
+            continue;
+        }
+        if (sent == 0) {
+            firstTimestamp = timestamp;
+        }
+        if ((rate > 0) && (timestamp > firstTimestamp)) {
+            std::this_thread::sleep_until(start + std::chrono::microseconds(
+                static_cast<uint64_t>((timestamp - firstTimestamp) * 1000 / rate)));
+        }
+
+        if (!writer) {
+            context.reset(new ClientContext());
+            writer = stub_->InjectEvents(context.get(), &reply);
+        }
+        request.set_filter(filter);
+        request.set_event(event);
+        if (!writer->Write(request)) {
+            LOG(ERROR, __FUNCTION__, " Server closed the scenario stream");
+            finishBatch();
+            return telux::common::Status::FAILED;
+        }
+        ++sent;
+        if (++inBatch == batchSize) {
+            inBatch = 0;
+            if (!finishBatch()) {
+                return telux::common::Status::FAILED;
+            }
+        }
+    }
+    if (writer && !finishBatch()) {
+        return telux::common::Status::FAILED;
+    }
+    std::cout << "Scenario replayed, " << sent << " events sent" << std::endl;
     return telux::common::Status::SUCCESS;
 }
 
@@ -46,6 +46,7 @@
 
 #include <string>
 #include <memory>
+#include <cstdint>
 
 #include "protos/proto-src/event_simulation.grpc.pb.h"
 
@@ -65,6 +66,7 @@ public:
 private:
     void printHelp(std::string subsystem = "", std::string event = "");
     Status sendMessage(std::string filter, std::string event);
+    Status runScenario(std::string scenarioFile, double rate, uint32_t batchSize);
     Json::Value eventObj_;
     std::unique_ptr<::eventService::EventDispatcherService::Stub> stub_;
 };
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2024 Qualcomm Innovation Center, Inc. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause-Clear
+ */
+
+/**
+ * @file       QoSShaperTool.cpp
+ *
+ * @brief      Runs a packet stream through the QoS simulation of the data library.
+ *             The traffic classes and filters are created through the IQoSManager API,
+ *             then each packet is shaped, or only metered, and its traffic class, verdict
+ *             and departure time are printed.
+ *
+ *             The script is read from a file or from the standard input, one command per
+ *             line, '#' starting a comment:
+ *               tc <class> <ul|dl> [<min Mbps> <max Mbps>]
+ *               filter <class> <ul|dl> <protocol> <dest port>
+ *               packet <ul|dl> <protocol> <src addr> <dest addr> <src port> <dest port>
+ *                      <length> <arrival us>
+ */
+
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <telux/data/DataFactory.hpp>
+
+#include "libs/data/net/QoSManagerStub.hpp"
+
+extern "C" {
+#include <getopt.h>
+}
+
+#define APP_NAME "telsdk_qos_shaper"
+
+using telux::common::ErrorCode;
+using telux::data::DataPath;
+using telux::data::Direction;
+using telux::data::FieldType;
+using telux::data::net::QoSManagerStub;
+using telux::data::net::QoSPacket;
+using telux::data::net::QoSPacketResult;
+using telux::data::net::QoSVerdict;
+
+namespace {
+
+void printUsage() {
+    std::cout << "Usage: " << APP_NAME << " [-f <script>] [-m]\n"
+        << "  -f <script>  Reads the commands from the file instead of the standard input\n"
+        << "  -m           Meters the packets without delaying them\n"
+        << "  -h           Prints this help\n"
+        << "Commands:\n"
+        << "  tc <class> <ul|dl> [<min Mbps> <max Mbps>]\n"
+        << "  filter <class> <ul|dl> <protocol> <dest port>\n"
+        << "  packet <ul|dl> <protocol> <src addr> <dest addr> <src port> <dest port>"
+        << " <length> <arrival us>" << std::endl;
+}
+
+bool parseDirection(const std::string &str, Direction &direction) {
+    if (str == "ul") {
+        direction = Direction::UPLINK;
+    } else if (str == "dl") {
+        direction = Direction::DOWNLINK;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string verdictToString(QoSVerdict verdict) {
+    switch (verdict) {
+        case QoSVerdict::CONFORM:
+            return "CONFORM";
+        case QoSVerdict::BORROW:
+            return "BORROW";
+        case QoSVerdict::EXCEED:
+            return "EXCEED";
+    }
+    return "UNKNOWN";
+}
+
+bool createTrafficClass(std::shared_ptr<QoSManagerStub> qosMgr, std::istringstream &args) {
+    int trafficClass = 0;
+    std::string dir;
+    Direction direction;
+    if (!(args >> trafficClass >> dir) || !parseDirection(dir, direction)) {
+        return false;
+    }
+    telux::data::net::TcConfigBuilder builder;
+    builder.setTrafficClass(static_cast<telux::data::TrafficClass>(trafficClass))
+        .setDirection(direction)
+        .setDataPath(DataPath::APPS_TO_WAN);
+    uint32_t minBandwidth = 0;
+    uint32_t maxBandwidth = 0;
+    if (args >> minBandwidth >> maxBandwidth) {
+        telux::data::net::BandwidthConfig bandwidthConfig;
+        bandwidthConfig.setDlBandwidthRange(minBandwidth, maxBandwidth);
+        builder.setBandwidthConfig(bandwidthConfig);
+    }
+    telux::data::net::TcConfigErrorCode tcConfigErrorCode;
+    ErrorCode error = qosMgr->createTrafficClass(builder.build(), tcConfigErrorCode);
+    if (error != ErrorCode::SUCCESS) {
+        std::cout << "Creating traffic class " << trafficClass << " failed, error: "
+            << static_cast<int>(error) << std::endl;
+    }
+    return true;
+}
+
+bool addFilter(std::shared_ptr<QoSManagerStub> qosMgr, std::istringstream &args) {
+    int trafficClass = 0;
+    std::string dir;
+    Direction direction;
+    int protocol = 0;
+    uint16_t destPort = 0;
+    if (!(args >> trafficClass >> dir >> protocol >> destPort)
+        || !parseDirection(dir, direction)) {
+        return false;
+    }
+    telux::data::TrafficFilterBuilder builder;
+    builder.setDirection(direction)
+        .setIPProtocol(static_cast<telux::data::IpProtocol>(protocol))
+        .setPort(destPort, FieldType::DESTINATION);
+    telux::data::net::QoSFilterConfig config;
+    config.trafficClass = static_cast<telux::data::TrafficClass>(trafficClass);
+    config.trafficFilter = builder.build();
+    telux::data::net::QoSFilterHandle handle;
+    telux::data::net::QoSFilterErrorCode qosFilterErrorCode;
+    ErrorCode error = qosMgr->addQoSFilter(config, handle, qosFilterErrorCode);
+    if (error != ErrorCode::SUCCESS) {
+        std::cout << "Adding filter to traffic class " << trafficClass << " failed, error: "
+            << static_cast<int>(error) << std::endl;
+    }
+    return true;
+}
+
+bool sendPacket(std::shared_ptr<QoSManagerStub> qosMgr, std::istringstream &args,
+    bool meterOnly) {
+    QoSPacket packet;
+    std::string dir;
+    int protocol = 0;
+    if (!(args >> dir >> protocol >> packet.srcAddr >> packet.destAddr >> packet.srcPort
+        >> packet.destPort >> packet.length >> packet.timestampUs)
+        || !parseDirection(dir, packet.direction)) {
+        return false;
+    }
+    packet.protocol = static_cast<telux::data::IpProtocol>(protocol);
+    QoSPacketResult result;
+    ErrorCode error = meterOnly ? qosMgr->meterPacket(packet, result)
+        : qosMgr->shapePacket(packet, result);
+    if (error != ErrorCode::SUCCESS) {
+        std::cout << "Packet at " << packet.timestampUs << " failed, error: "
+            << static_cast<int>(error) << std::endl;
+        return true;
+    }
+    std::cout << packet.timestampUs << " ";
+    if (!result.isClassified) {
+        std::cout << "unclassified" << std::endl;
+        return true;
+    }
+    std::cout << "class: " << +result.trafficClass << ", verdict: "
+        << verdictToString(result.verdict);
+    if (!meterOnly) {
+        std::cout << ", departure: " << result.departureUs;
+    }
+    std::cout << std::endl;
+    return true;
+}
+
+int runScript(std::shared_ptr<QoSManagerStub> qosMgr, std::istream &script, bool meterOnly) {
+    std::string line;
+    int lineNum = 0;
+    while (std::getline(script, line)) {
+        lineNum++;
+        std::istringstream args(line.substr(0, line.find('#')));
+        std::string command;
+        if (!(args >> command)) {
+            continue;
+        }
+        bool isValid = false;
+        if (command == "tc") {
+            isValid = createTrafficClass(qosMgr, args);
+        } else if (command == "filter") {
+            isValid = addFilter(qosMgr, args);
+        } else if (command == "packet") {
+            isValid = sendPacket(qosMgr, args, meterOnly);
+        }
+        if (!isValid) {
+            std::cout << "Invalid command at line " << lineNum << ": " << line << std::endl;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    std::string scriptPath;
+    bool meterOnly = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "f:mh")) != -1) {
+        switch (opt) {
+            case 'f':
+                scriptPath = optarg;
+                break;
+            case 'm':
+                meterOnly = true;
+                break;
+            case 'h':
+                printUsage();
+                return 0;
+            default:
+                printUsage();
+                return -1;
+        }
+    }
+
+    std::promise<telux::common::ServiceStatus> initPromise;
+    auto qosMgr = telux::data::DataFactory::getInstance().getQoSManager(
+        [&initPromise](telux::common::ServiceStatus status) {
+            initPromise.set_value(status);
+        });
+    if ((qosMgr == nullptr) || (initPromise.get_future().get()
+        != telux::common::ServiceStatus::SERVICE_AVAILABLE)) {
+        std::cout << "QoS manager is unavailable" << std::endl;
+        return -1;
+    }
+    // The packet API is only on the simulation implementation
+    auto qosStub = std::dynamic_pointer_cast<QoSManagerStub>(qosMgr);
+    if (qosStub == nullptr) {
+        std::cout << "QoS manager isn't the simulation one" << std::endl;
+        return -1;
+    }
+    qosStub->deleteAllQosConfigs();
+
+    if (scriptPath.empty()) {
+        return runScript(qosStub, std::cin, meterOnly);
+    }
+    std::ifstream script(scriptPath);
+    if (!script.is_open()) {
+        std::cout << "Unable to open " << scriptPath << std::endl;
+        return -1;
+    }
+    return runScript(qosStub, script, meterOnly);
+}